@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/toolchain.h>
+#include <stdint.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+/* Distance between two samples in the strided (_s) variants, e.g. interleaved XYZ */
+#define BENCH_STRIDE 3
+
+/* Input sample types, named after the function suffixes */
+typedef flt32_t bench_f32_t;
+typedef int8_t bench_i8_t;
+typedef int16_t bench_i16_t;
+typedef int32_t bench_i32_t;
+
+/* Inputs of CONFIG_APP_BENCH_NUM_MAX samples at BENCH_STRIDE, filled once at startup */
+extern bench_f32_t bench_input_f32[];
+extern bench_i8_t bench_input_i8[];
+extern bench_i16_t bench_input_i16[];
+extern bench_i32_t bench_input_i32[];
+
+/**
+ * @brief Benchmarked call
+ * @param num Number of samples
+ * @param stride Sample stride of the strided variants
+ */
+typedef void (*bench_fn_t)(uint16_t num, size32_t stride);
+
+/**
+ * @brief Preparation before each measurement, not timed
+ * @param num Number of samples
+ */
+typedef void (*bench_setup_t)(uint16_t num);
+
+struct bench_case {
+	const char *name;
+	/* Fixed number of samples, 0 to sweep all input sizes */
+	uint16_t num;
+	bench_setup_t setup;
+	bench_fn_t fn;
+};
+
+/**
+ * @brief Register a benchmark case
+ *
+ * Cases run in the order of their identifiers.
+ *
+ * @param _id Case identifier
+ * @param _num Fixed number of samples, 0 to sweep all input sizes
+ * @param _setup Preparation before each measurement or NULL
+ * @param _fn Benchmarked call
+ */
+#define BENCH_CASE(_id, _num, _setup, _fn)					\
+	static const STRUCT_SECTION_ITERABLE(bench_case, bench_case_##_id) = {	\
+		.name = #_id,							\
+		.num = _num,							\
+		.setup = _setup,						\
+		.fn = _fn,							\
+	}
+
+#endif /* _BENCH_H_ */
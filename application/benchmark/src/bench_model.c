@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/sys/printk.h>
+#include "detection_user_model.h"
+#include "bench.h"
+
+/*
+ * The stages of one inference of the generated model, each timed on its own:
+ * filling the input window, feature extraction, the Neuton network, and
+ * everything together including output decoding as nrf_edgeai_run_inference()
+ * does it.
+ */
+
+static nrf_edgeai_t *p_model;
+
+static nrf_edgeai_t *bench_model(void)
+{
+	nrf_edgeai_err_t res;
+
+	if (p_model == NULL) {
+		p_model = nrf_edgeai_user_model();
+		res = nrf_edgeai_init(p_model);
+		if (res != NRF_EDGEAI_ERR_SUCCESS) {
+			printk("Failed to initialize EdgeAI: %d\n", res);
+		}
+	}
+
+	return p_model;
+}
+
+static void bench_feed_window(void)
+{
+	nrf_edgeai_t *p_edgeai = bench_model();
+	uint16_t num = nrf_edgeai_input_window_size(p_edgeai) *
+		       nrf_edgeai_uniq_inputs_num(p_edgeai);
+
+	(void)nrf_edgeai_feed_inputs(p_edgeai, bench_input_f32, num);
+}
+
+static void bench_model_setup(uint16_t num)
+{
+	(void)bench_model();
+}
+
+static void bench_model_feed_window(uint16_t num, size32_t stride)
+{
+	bench_feed_window();
+}
+BENCH_CASE(model_feed_window, 1, bench_model_setup, bench_model_feed_window);
+
+static void bench_model_process_features_setup(uint16_t num)
+{
+	bench_feed_window();
+}
+
+static void bench_model_process_features(uint16_t num, size32_t stride)
+{
+	(void)p_model->interfaces.process_features(&p_model->input, p_model->p_dsp);
+}
+BENCH_CASE(model_process_features, 1, bench_model_process_features_setup,
+	   bench_model_process_features);
+
+static void bench_model_run_inference_setup(uint16_t num)
+{
+	bench_feed_window();
+	(void)p_model->interfaces.process_features(&p_model->input, p_model->p_dsp);
+}
+
+static void bench_model_run_inference(uint16_t num, size32_t stride)
+{
+	p_model->interfaces.run_inference(p_model);
+}
+BENCH_CASE(model_run_inference, 1, bench_model_run_inference_setup, bench_model_run_inference);
+
+static void bench_model_total_setup(uint16_t num)
+{
+	bench_feed_window();
+}
+
+static void bench_model_total(uint16_t num, size32_t stride)
+{
+	(void)nrf_edgeai_run_inference(p_model);
+}
+BENCH_CASE(model_total, 1, bench_model_total_setup, bench_model_total);
@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_edgeai/dsp/nrf_dsp_statistic.h>
+
+#include "app_dsp.h"
+#include "bench.h"
+
+/* Window of the peak to peak low and high frequency features */
+#define BENCH_PK2PK_WINDOW 8
+
+/*
+ * Every case gets a fresh statistic context, so cached sums from previous
+ * calls are never reused and the full cost of the function is measured.
+ * The call arguments are written with the names p, num, stride, ctx and
+ * the scalar outputs a and b.
+ */
+#define BENCH_STAT(_fn, _type, ...)						\
+	static void bench_##_fn(uint16_t num, size32_t stride)			\
+	{									\
+		const bench_##_type##_t *p = bench_input_##_type;		\
+		__maybe_unused nrf_dsp_stat_ctx_##_type##_t ctx = { 0 };	\
+		__maybe_unused bench_##_type##_t a = 1;				\
+		__maybe_unused bench_##_type##_t b;				\
+										\
+		(void)_fn(__VA_ARGS__);						\
+	}									\
+	BENCH_CASE(stat_##_fn, 0, NULL, bench_##_fn)
+
+/* Same as BENCH_STAT for functions returning a result structure in res */
+#define BENCH_STAT_RES(_fn, _type, _res_type, ...)				\
+	static void bench_##_fn(uint16_t num, size32_t stride)			\
+	{									\
+		const bench_##_type##_t *p = bench_input_##_type;		\
+		__maybe_unused nrf_dsp_stat_ctx_##_type##_t ctx = { 0 };	\
+		_res_type res;							\
+										\
+		_fn(__VA_ARGS__);						\
+	}									\
+	BENCH_CASE(stat_##_fn, 0, NULL, bench_##_fn)
+
+BENCH_STAT(nrf_dsp_absmax_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_absmax_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_absmax_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_absmax_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_absmax_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_absmax_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_absmax_i32, i32, p, num);
+BENCH_STAT(nrf_dsp_absmax_i32_s, i32, p, num, stride);
+BENCH_STAT(nrf_dsp_absmean_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_absmean_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_absmean_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_absmean_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_absmean_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_absmean_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_absmin_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_absmin_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_absmin_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_absmin_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_absmin_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_absmin_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_absmin_i32, i32, p, num);
+BENCH_STAT(nrf_dsp_absmin_i32_s, i32, p, num, stride);
+BENCH_STAT(nrf_dsp_abssum_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_abssum_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_abssum_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_abssum_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_abssum_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_abssum_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_amdf_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_amdf_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_amdf_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_amdf_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_amdf_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_amdf_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_autocorr_f32, f32, p, num, 1, &ctx);
+BENCH_STAT(nrf_dsp_autocorr_i8, i8, p, num, 1, &ctx);
+BENCH_STAT(nrf_dsp_autocorr_i16, i16, p, num, 1, &ctx);
+BENCH_STAT(nrf_dsp_crest_f32, f32, p, num, &a, &ctx);
+BENCH_STAT(nrf_dsp_crest_f32_s, f32, p, num, stride, &a, &ctx);
+BENCH_STAT(nrf_dsp_crest_i8, i8, p, num, &a, &ctx);
+BENCH_STAT(nrf_dsp_crest_i8_s, i8, p, num, stride, &a, &ctx);
+BENCH_STAT(nrf_dsp_crest_i16, i16, p, num, &a, &ctx);
+BENCH_STAT(nrf_dsp_crest_i16_s, i16, p, num, stride, &a, &ctx);
+BENCH_STAT_RES(nrf_dsp_hjorth_f32, f32, nrf_dsp_hjorth_params_f32_t, p, num, &res, &ctx);
+BENCH_STAT_RES(nrf_dsp_hjorth_i8, i8, nrf_dsp_hjorth_params_i8_t, p, num, &res, &ctx);
+BENCH_STAT_RES(nrf_dsp_hjorth_i16, i16, nrf_dsp_hjorth_params_i16_t, p, num, &res, &ctx);
+BENCH_STAT(nrf_dsp_kur_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_kur_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_kur_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_kur_i16, i16, p, num, &ctx);
+BENCH_STAT_RES(nrf_dsp_lrp_f32, f32, nrf_dsp_linear_reg_params_f32_t, p, num, &res, &ctx);
+BENCH_STAT_RES(nrf_dsp_lrp_i16, i16, nrf_dsp_linear_reg_params_i16_t, p, num, &res, &ctx);
+BENCH_STAT_RES(nrf_dsp_lrp_i8, i8, nrf_dsp_linear_reg_params_i8_t, p, num, &res, &ctx);
+BENCH_STAT(nrf_dsp_madf_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_madf_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_madf_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_madf_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_madf_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_madf_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_madv_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_madv_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_madv_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_madv_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_madv_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_madv_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_madv_i32, i32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_madv_i32_s, i32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_max_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_max_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_max_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_max_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_max_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_max_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_max_i32, i32, p, num);
+BENCH_STAT(nrf_dsp_max_i32_s, i32, p, num, stride);
+BENCH_STAT(nrf_dsp_mcr_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mcr_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_mcr_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mcr_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_mcr_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mcr_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_mcr_i32, i32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mcr_i32_s, i32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_mean_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mean_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_mean_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mean_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_mean_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mean_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_mean_i32, i32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_mean_i32_s, i32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_min_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_min_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_min_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_min_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_min_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_min_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_min_i32, i32, p, num);
+BENCH_STAT(nrf_dsp_min_i32_s, i32, p, num, stride);
+BENCH_STAT(nrf_dsp_min_max_f32, f32, p, num, &a, &b);
+BENCH_STAT(nrf_dsp_min_max_f32_s, f32, p, num, stride, &a, &b);
+BENCH_STAT(nrf_dsp_min_max_i8, i8, p, num, &a, &b);
+BENCH_STAT(nrf_dsp_min_max_i8_s, i8, p, num, stride, &a, &b);
+BENCH_STAT(nrf_dsp_min_max_i16, i16, p, num, &a, &b);
+BENCH_STAT(nrf_dsp_min_max_i16_s, i16, p, num, stride, &a, &b);
+BENCH_STAT(nrf_dsp_min_max_i32, i32, p, num, &a, &b);
+BENCH_STAT(nrf_dsp_min_max_i32_s, i32, p, num, stride, &a, &b);
+BENCH_STAT_RES(nrf_dsp_moments_f32, f32, nrf_dsp_moments_f32_t, p, num, &ctx, &res);
+BENCH_STAT_RES(nrf_dsp_moments_f32_s, f32, nrf_dsp_moments_f32_t, p, num, stride, &ctx, &res);
+BENCH_STAT_RES(nrf_dsp_moments_i8, i8, nrf_dsp_moments_i8_t, p, num, &ctx, &res);
+BENCH_STAT_RES(nrf_dsp_moments_i16, i16, nrf_dsp_moments_i16_t, p, num, &ctx, &res);
+BENCH_STAT(nrf_dsp_pk2pk_lf_hf_f32, f32, p, num, BENCH_PK2PK_WINDOW, &a, &b);
+BENCH_STAT(nrf_dsp_pk2pk_lf_hf_f32_s, f32, p, num, stride, BENCH_PK2PK_WINDOW, &a, &b);
+/* The integer variants return both peak to peak values widened, into one result */
+BENCH_STAT_RES(nrf_dsp_pk2pk_lf_hf_i8, i8, int16_t, p, num, BENCH_PK2PK_WINDOW, &res, &res);
+BENCH_STAT_RES(nrf_dsp_pk2pk_lf_hf_i8_s, i8, int16_t,
+	       p, num, stride, BENCH_PK2PK_WINDOW, &res, &res);
+BENCH_STAT_RES(nrf_dsp_pk2pk_lf_hf_i16, i16, int32_t, p, num, BENCH_PK2PK_WINDOW, &res, &res);
+BENCH_STAT_RES(nrf_dsp_pk2pk_lf_hf_i16_s, i16, int32_t,
+	       p, num, stride, BENCH_PK2PK_WINDOW, &res, &res);
+BENCH_STAT(nrf_dsp_pk2pk_hf_f32, f32, p, num, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_hf_f32_s, f32, p, num, stride, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_hf_i8, i8, p, num, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_hf_i8_s, i8, p, num, stride, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_hf_i16, i16, p, num, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_hf_i16_s, i16, p, num, stride, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_lf_f32, f32, p, num, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_lf_f32_s, f32, p, num, stride, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_lf_i8, i8, p, num, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_lf_i8_s, i8, p, num, stride, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_lf_i16, i16, p, num, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_pk2pk_lf_i16_s, i16, p, num, stride, BENCH_PK2PK_WINDOW);
+BENCH_STAT(nrf_dsp_psom_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_psom_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_psom_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_psom_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_psom_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_psom_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_psos_f32, f32, p, num, NRF_DSP_SIGMA_FACTOR_P_1, &ctx);
+BENCH_STAT(nrf_dsp_psos_f32_s, f32, p, num, NRF_DSP_SIGMA_FACTOR_P_1, stride, &ctx);
+BENCH_STAT(nrf_dsp_psos_i8, i8, p, num, NRF_DSP_SIGMA_FACTOR_P_1, &ctx);
+BENCH_STAT(nrf_dsp_psos_i8_s, i8, p, num, NRF_DSP_SIGMA_FACTOR_P_1, stride, &ctx);
+BENCH_STAT(nrf_dsp_psos_i16, i16, p, num, NRF_DSP_SIGMA_FACTOR_P_1, &ctx);
+BENCH_STAT(nrf_dsp_psos_i16_s, i16, p, num, NRF_DSP_SIGMA_FACTOR_P_1, stride, &ctx);
+BENCH_STAT(nrf_dsp_psot_f32, f32, p, num, 0);
+BENCH_STAT(nrf_dsp_psot_f32_s, f32, p, num, stride, 0);
+BENCH_STAT(nrf_dsp_psot_i8, i8, p, num, 0);
+BENCH_STAT(nrf_dsp_psot_i8_s, i8, p, num, stride, 0);
+BENCH_STAT(nrf_dsp_psot_i16, i16, p, num, 0);
+BENCH_STAT(nrf_dsp_psot_i16_s, i16, p, num, stride, 0);
+BENCH_STAT(nrf_dsp_range_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_range_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_range_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_range_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_range_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_range_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_range_i32, i32, p, num);
+BENCH_STAT(nrf_dsp_range_i32_s, i32, p, num, stride);
+BENCH_STAT(nrf_dsp_rds_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_rds_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_rds_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_rds_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_rds_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_rds_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_rms_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_rms_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_rms_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_rms_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_rms_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_rms_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_rssq_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_rssq_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_rssq_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_rssq_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_rssq_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_rssq_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_scr_f32, f32, p, num, NRF_DSP_SIGMA_FACTOR_P_1, &ctx);
+BENCH_STAT(nrf_dsp_scr_f32_s, f32, p, num, NRF_DSP_SIGMA_FACTOR_P_1, stride, &ctx);
+BENCH_STAT(nrf_dsp_scr_i8, i8, p, num, NRF_DSP_SIGMA_FACTOR_P_1, &ctx);
+BENCH_STAT(nrf_dsp_scr_i8_s, i8, p, num, NRF_DSP_SIGMA_FACTOR_P_1, stride, &ctx);
+BENCH_STAT(nrf_dsp_scr_i16, i16, p, num, NRF_DSP_SIGMA_FACTOR_P_1, &ctx);
+BENCH_STAT(nrf_dsp_scr_i16_s, i16, p, num, NRF_DSP_SIGMA_FACTOR_P_1, stride, &ctx);
+BENCH_STAT(nrf_dsp_skew_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_skew_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_skew_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_skew_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_stddev_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_stddev_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_stddev_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_stddev_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_stddev_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_stddev_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_sum_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_sum_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_sum_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_sum_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_sum_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_sum_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_sum_i32, i32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_sum_i32_s, i32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_tcr_f32, f32, p, num, 0);
+BENCH_STAT(nrf_dsp_tcr_f32_s, f32, p, num, stride, 0);
+BENCH_STAT(nrf_dsp_tcr_i8, i8, p, num, 0);
+BENCH_STAT(nrf_dsp_tcr_i8_s, i8, p, num, stride, 0);
+BENCH_STAT(nrf_dsp_tcr_i16, i16, p, num, 0);
+BENCH_STAT(nrf_dsp_tcr_i16_s, i16, p, num, stride, 0);
+BENCH_STAT(nrf_dsp_tcr_i32, i32, p, num, 0);
+BENCH_STAT(nrf_dsp_tcr_i32_s, i32, p, num, stride, 0);
+BENCH_STAT(nrf_dsp_tss_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_tss_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_tss_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_tss_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_tss_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_tss_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_tss_sum_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_tss_sum_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_tss_sum_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_tss_sum_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_tss_sum_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_tss_sum_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT(nrf_dsp_var_f32, f32, p, num, &ctx);
+BENCH_STAT(nrf_dsp_var_f32_s, f32, p, num, stride, &ctx);
+BENCH_STAT_RES(nrf_dsp_deriv_var_f32, f32, nrf_dsp_derivative_var_f32_t, p, num, &res);
+BENCH_STAT(nrf_dsp_var_i8, i8, p, num, &ctx);
+BENCH_STAT(nrf_dsp_var_i8_s, i8, p, num, stride, &ctx);
+BENCH_STAT_RES(nrf_dsp_deriv_var_i8, i8, nrf_dsp_derivative_var_i8_t, p, num, &res);
+BENCH_STAT(nrf_dsp_var_i16, i16, p, num, &ctx);
+BENCH_STAT(nrf_dsp_var_i16_s, i16, p, num, stride, &ctx);
+BENCH_STAT_RES(nrf_dsp_deriv_var_i16, i16, nrf_dsp_derivative_var_i16_t, p, num, &res);
+BENCH_STAT(nrf_dsp_zcr_f32, f32, p, num);
+BENCH_STAT(nrf_dsp_zcr_f32_s, f32, p, num, stride);
+BENCH_STAT(nrf_dsp_zcr_i8, i8, p, num);
+BENCH_STAT(nrf_dsp_zcr_i8_s, i8, p, num, stride);
+BENCH_STAT(nrf_dsp_zcr_i16, i16, p, num);
+BENCH_STAT(nrf_dsp_zcr_i16_s, i16, p, num, stride);
+BENCH_STAT(nrf_dsp_zcr_i32, i32, p, num);
+BENCH_STAT(nrf_dsp_zcr_i32_s, i32, p, num, stride);
+
+/*
+ * Autocorrelation at all lags up to _max_lag, once with direct sums and once
+ * with the path app_dsp_autocorr_init_f32() picks, which is the FFT path
+ * when it costs less
+ */
+#define BENCH_APP_AUTOCORR(_num, _max_lag)						\
+	BUILD_ASSERT(_num <= CONFIG_APP_BENCH_NUM_MAX);					\
+	APP_DSP_AUTOCORR_DEFINE(app_autocorr_##_num##_##_max_lag, _num, _max_lag);	\
+	static struct app_dsp_autocorr app_autocorr_direct_##_num##_##_max_lag = {	\
+		.num = _num,								\
+		.max_lag = _max_lag,							\
+	};										\
+	static float app_autocorr_out_##_num##_##_max_lag[_max_lag + 1];		\
+											\
+	static void bench_app_autocorr_##_num##_##_max_lag##_setup(uint16_t num)	\
+	{										\
+		(void)app_dsp_autocorr_init_f32(&app_autocorr_##_num##_##_max_lag);	\
+		(void)app_dsp_autocorr_init_f32(&app_autocorr_direct_##_num##_##_max_lag); \
+	}										\
+											\
+	static void bench_app_autocorr_##_num##_##_max_lag(uint16_t num, size32_t stride) \
+	{										\
+		app_dsp_autocorr_f32(&app_autocorr_##_num##_##_max_lag, bench_input_f32,	\
+				     app_autocorr_out_##_num##_##_max_lag);		\
+	}										\
+											\
+	static void bench_app_autocorr_direct_##_num##_##_max_lag(uint16_t num,	\
+								  size32_t stride)	\
+	{										\
+		app_dsp_autocorr_f32(&app_autocorr_direct_##_num##_##_max_lag,		\
+				     bench_input_f32, app_autocorr_out_##_num##_##_max_lag); \
+	}										\
+	BENCH_CASE(stat_app_autocorr_f32_##_num##_##_max_lag, _num,			\
+		   bench_app_autocorr_##_num##_##_max_lag##_setup,			\
+		   bench_app_autocorr_##_num##_##_max_lag);				\
+	BENCH_CASE(stat_app_autocorr_direct_f32_##_num##_##_max_lag, _num,		\
+		   bench_app_autocorr_##_num##_##_max_lag##_setup,			\
+		   bench_app_autocorr_direct_##_num##_##_max_lag)
+
+/*
+ * Mean, variance, skewness and kurtosis in one pass, against
+ * nrf_dsp_skew_* and nrf_dsp_kur_* taking the mean in a pass of their own
+ */
+#define BENCH_APP_MOMENTS(_suffix, _type, ...)					\
+	static void bench_app_moments_##_suffix(uint16_t num, size32_t stride)	\
+	{									\
+		const bench_##_type##_t *p = bench_input_##_type;		\
+		struct app_dsp_moments moments;					\
+										\
+		app_dsp_moments_reset(&moments);				\
+		app_dsp_moments_update_##_suffix(&moments, __VA_ARGS__);	\
+		(void)app_dsp_moments_skew_f32(&moments);			\
+		(void)app_dsp_moments_kur_f32(&moments);			\
+	}									\
+	BENCH_CASE(stat_app_moments_##_suffix, 0, NULL, bench_app_moments_##_suffix)
+
+BENCH_APP_MOMENTS(f32, f32, p, num);
+BENCH_APP_MOMENTS(f32_s, f32, p, num, stride);
+BENCH_APP_MOMENTS(i16, i16, p, num);
+BENCH_APP_MOMENTS(i16_s, i16, p, num, stride);
+
+/* All four crossing rates in one pass, against one nrf_dsp_*cr_* call per rate */
+#define BENCH_APP_CROSSINGS(_suffix, _type, _rate_type, ...)				\
+	static void bench_app_crossings_##_suffix(uint16_t num, size32_t stride)	\
+	{										\
+		const bench_##_type##_t *p = bench_input_##_type;			\
+		_rate_type rates[APP_DSP_CROSSING_NUM];					\
+											\
+		app_dsp_crossings_##_suffix(__VA_ARGS__, BIT_MASK(APP_DSP_CROSSING_NUM), 1,	\
+					    NRF_DSP_SIGMA_FACTOR_P_1, rates);		\
+	}										\
+	BENCH_CASE(stat_app_crossings_##_suffix, 0, NULL, bench_app_crossings_##_suffix)
+
+BENCH_APP_CROSSINGS(f32, f32, float, p, num);
+BENCH_APP_CROSSINGS(f32_s, f32, float, p, num, stride);
+BENCH_APP_CROSSINGS(i16, i16, int16_t, p, num);
+BENCH_APP_CROSSINGS(i16_s, i16, int16_t, p, num, stride);
+
+/*
+ * Streaming low and high frequency peak-to-peak over a sliding window of 128
+ * inputs, per input added, against nrf_dsp_pk2pk_lf_hf_* per window
+ */
+APP_DSP_PK2PK_DEFINE(app_pk2pk, 128, BENCH_PK2PK_WINDOW);
+
+static void bench_app_pk2pk_setup(uint16_t num)
+{
+	app_dsp_pk2pk_reset(&app_pk2pk);
+}
+
+static void bench_app_pk2pk_f32(uint16_t num, size32_t stride)
+{
+	float lf;
+	float hf;
+
+	app_dsp_pk2pk_update_f32(&app_pk2pk, bench_input_f32, num);
+	(void)app_dsp_pk2pk_get_f32(&app_pk2pk, &lf, &hf);
+}
+BENCH_CASE(stat_app_pk2pk_f32, 0, bench_app_pk2pk_setup, bench_app_pk2pk_f32);
+
+BENCH_APP_AUTOCORR(128, 16);
+BENCH_APP_AUTOCORR(256, 32);
+BENCH_APP_AUTOCORR(256, 128);
+
+/*
+ * Float24 dot product, sum of squares and square roots of a block, one
+ * nrf_dsp_f24 call per operation against the app_dsp_f24 block kernels
+ */
+static nrf_dsp_f24_t bench_f24[CONFIG_APP_BENCH_NUM_MAX];
+static volatile nrf_dsp_f24_t bench_f24_res;
+
+static void bench_f24_setup(uint16_t num)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		bench_f24[i] = nrf_dsp_i16_to_f24(bench_input_i16[i]);
+	}
+}
+
+/* The second vector of the dot products starts past the longest first one */
+static void bench_f24_dot_i16(uint16_t num, size32_t stride)
+{
+	const int16_t *p_b = &bench_input_i16[CONFIG_APP_BENCH_NUM_MAX];
+	nrf_dsp_f24_t sum = nrf_dsp_f24_init(0, 0, NRF_DSP_F24_UNSIGNED);
+
+	for (uint16_t i = 0; i < num; i++) {
+		sum = nrf_dsp_f24_add(sum, nrf_dsp_f24_mul(nrf_dsp_i16_to_f24(bench_input_i16[i]),
+							   nrf_dsp_i16_to_f24(p_b[i])));
+	}
+	bench_f24_res = sum;
+}
+BENCH_CASE(stat_f24_mul_add_dot_i16, 0, NULL, bench_f24_dot_i16);
+
+static void bench_app_f24_dot_i16(uint16_t num, size32_t stride)
+{
+	bench_f24_res = app_dsp_f24_dot_i16(bench_input_i16,
+					    &bench_input_i16[CONFIG_APP_BENCH_NUM_MAX], num);
+}
+BENCH_CASE(stat_app_f24_dot_i16, 0, NULL, bench_app_f24_dot_i16);
+
+static void bench_f24_sum_sq_i16(uint16_t num, size32_t stride)
+{
+	nrf_dsp_f24_t sum = nrf_dsp_f24_init(0, 0, NRF_DSP_F24_UNSIGNED);
+
+	for (uint16_t i = 0; i < num; i++) {
+		nrf_dsp_f24_t x = nrf_dsp_i16_to_f24(bench_input_i16[i]);
+
+		sum = nrf_dsp_f24_add(sum, nrf_dsp_f24_mul(x, x));
+	}
+	bench_f24_res = sum;
+}
+BENCH_CASE(stat_f24_mul_add_sum_sq_i16, 0, NULL, bench_f24_sum_sq_i16);
+
+static void bench_app_f24_sum_sq_i16(uint16_t num, size32_t stride)
+{
+	bench_f24_res = app_dsp_f24_sum_sq_i16(bench_input_i16, num);
+}
+BENCH_CASE(stat_app_f24_sum_sq_i16, 0, NULL, bench_app_f24_sum_sq_i16);
+
+static void bench_f24_sqrt(uint16_t num, size32_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		bench_f24[i] = nrf_dsp_f24_sqrt(bench_f24[i]);
+	}
+}
+BENCH_CASE(stat_nrf_dsp_f24_sqrt, 0, bench_f24_setup, bench_f24_sqrt);
+
+static void bench_app_f24_sqrt(uint16_t num, size32_t stride)
+{
+	app_dsp_f24_sqrt(bench_f24, num, bench_f24);
+}
+BENCH_CASE(stat_app_f24_sqrt, 0, bench_f24_setup, bench_app_f24_sqrt);
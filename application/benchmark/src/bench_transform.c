@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <nrf_edgeai/dsp/nrf_dsp_spectral.h>
+#include <nrf_edgeai/dsp/nrf_dsp_transform.h>
+
+/* The constant tables are defined in the headers, include them in this file only */
+#include <nrf_edgeai/dsp/transform/fft/nrf_dsp_fft_const_tables_f32.h>
+#include <nrf_edgeai/dsp/transform/fft/nrf_dsp_fft_const_tables_i16.h>
+
+#include "app_dsp.h"
+#include "bench.h"
+
+/* Largest real FFT length benchmarked */
+#define BENCH_FFT_LEN_MAX 512
+
+/* The real FFTs work in place on the input, it is copied in before every run */
+static bench_f32_t fft_input_f32[BENCH_FFT_LEN_MAX];
+static bench_f32_t fft_output_f32[2 * BENCH_FFT_LEN_MAX];
+static bench_i16_t fft_input_i16[BENCH_FFT_LEN_MAX];
+static bench_i16_t fft_output_i16[2 * BENCH_FFT_LEN_MAX];
+
+BUILD_ASSERT(BENCH_FFT_LEN_MAX <= CONFIG_APP_BENCH_NUM_MAX, "FFT input exceeds bench input");
+
+/*
+ * Real FFT of _len samples, computed with a complex FFT of half the length,
+ * the tables are named after the lengths of the real and complex FFT
+ */
+#define BENCH_RFFT(_type, _T, _len, _cfft_len)					\
+	static nrf_dsp_rfft_##_type##_t rfft_##_type##_##_len;			\
+										\
+	static void bench_rfft_##_type##_##_len##_setup(uint16_t num)		\
+	{									\
+		nrf_dsp_rfft_init_##_type(&rfft_##_type##_##_len, _len,		\
+				       NRF_DSP_RFFT_TWIDDLE_COEF_##_len##_##_T,	\
+				       NRF_DSP_CFFT_TWIDDLE_COEF_##_cfft_len##_##_T, \
+				       NRF_DSP_BITREVINDEX_TABLE_##_cfft_len##_##_T, \
+				       NRF_DSP_BITREVINDEX_TABLE_##_cfft_len##_##_T##_LEN); \
+		memcpy(fft_input_##_type, bench_input_##_type,			\
+		       _len * sizeof(bench_##_type##_t));			\
+	}									\
+										\
+	static void bench_rfft_##_type##_##_len(uint16_t num, size32_t stride)	\
+	{									\
+		nrf_dsp_rfft_##_type(&rfft_##_type##_##_len, fft_input_##_type, fft_output_##_type); \
+	}									\
+	BENCH_CASE(transform_rfft_##_type##_##_len, _len, bench_rfft_##_type##_##_len##_setup, \
+		   bench_rfft_##_type##_##_len)
+
+BENCH_RFFT(f32, F32, 128, 64);
+BENCH_RFFT(f32, F32, 256, 128);
+BENCH_RFFT(f32, F32, 512, 256);
+BENCH_RFFT(i16, I16, 128, 64);
+BENCH_RFFT(i16, I16, 256, 128);
+BENCH_RFFT(i16, I16, 512, 256);
+
+/*
+ * Mixed-radix real FFT of _len samples. Window lengths are benchmarked next
+ * to the power of two lengths they would otherwise be zero padded to.
+ */
+#define BENCH_APP_RFFT(_len)							\
+	static struct app_dsp_rfft_f32 app_rfft_##_len;				\
+	static float app_rfft_twiddle_##_len[APP_DSP_RFFT_TWIDDLE_LEN(_len)];	\
+										\
+	BUILD_ASSERT(APP_DSP_RFFT_OUTPUT_LEN(_len) <= 2 * BENCH_FFT_LEN_MAX);	\
+										\
+	static void bench_app_rfft_##_len##_setup(uint16_t num)			\
+	{									\
+		(void)app_dsp_rfft_init_f32(&app_rfft_##_len, _len,		\
+					    app_rfft_twiddle_##_len);		\
+	}									\
+										\
+	static void bench_app_rfft_##_len(uint16_t num, size32_t stride)	\
+	{									\
+		app_dsp_rfft_f32(&app_rfft_##_len, bench_input_f32, fft_output_f32); \
+	}									\
+	BENCH_CASE(transform_app_rfft_f32_##_len, _len, bench_app_rfft_##_len##_setup, \
+		   bench_app_rfft_##_len)
+
+BENCH_APP_RFFT(50);
+BENCH_APP_RFFT(64);
+BENCH_APP_RFFT(120);
+BENCH_APP_RFFT(128);
+
+/* 64 samples on the twiddle table of the 128 sample plan, against a table of its own */
+static struct app_dsp_rfft_f32 app_rfft_shared_64;
+
+static void bench_app_rfft_shared_64_setup(uint16_t num)
+{
+	(void)app_dsp_rfft_init_f32(&app_rfft_128, 128, app_rfft_twiddle_128);
+	(void)app_dsp_rfft_init_shared_f32(&app_rfft_shared_64, 64, &app_rfft_128);
+}
+
+static void bench_app_rfft_shared_64(uint16_t num, size32_t stride)
+{
+	app_dsp_rfft_f32(&app_rfft_shared_64, bench_input_f32, fft_output_f32);
+}
+BENCH_CASE(transform_app_rfft_shared_f32_64, 64, bench_app_rfft_shared_64_setup,
+	   bench_app_rfft_shared_64);
+
+/* Highest peaks found in the swept input as a spectrum */
+#define BENCH_FINDPEAKS_NUM 8
+#define BENCH_FINDPEAKS_DISTANCE 2
+
+static int16_t findpeaks_output[BENCH_FINDPEAKS_NUM];
+
+#define BENCH_FINDPEAKS(_prefix, _type)						\
+	static void bench_##_prefix##_findpeaks_##_type(uint16_t num, size32_t stride) \
+	{									\
+		_prefix##_findpeaks_##_type(bench_input_##_type, num, 0,	\
+					    BENCH_FINDPEAKS_DISTANCE, findpeaks_output, \
+					    BENCH_FINDPEAKS_NUM);		\
+	}									\
+	BENCH_CASE(spectral_##_prefix##_findpeaks_##_type, 0, NULL,		\
+		   bench_##_prefix##_findpeaks_##_type)
+
+BENCH_FINDPEAKS(nrf_dsp, f32);
+BENCH_FINDPEAKS(nrf_dsp, i16);
+BENCH_FINDPEAKS(app_dsp, f32);
+BENCH_FINDPEAKS(app_dsp, i16);
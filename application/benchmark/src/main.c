@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Cycle counts of the nrf_dsp statistics, transforms and the generated model
+ * on target. Every case runs CONFIG_APP_BENCH_ITERATIONS times per input size
+ * with interrupts locked and the fastest run, minus the measurement overhead,
+ * is printed as one row: case, samples, cycles, cycles per sample.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include "bench.h"
+
+/* Smallest input size of the sweep */
+#define BENCH_NUM_MIN 32
+
+#define BENCH_INPUT_LEN (CONFIG_APP_BENCH_NUM_MAX * BENCH_STRIDE)
+
+bench_f32_t bench_input_f32[BENCH_INPUT_LEN];
+bench_i8_t bench_input_i8[BENCH_INPUT_LEN];
+bench_i16_t bench_input_i16[BENCH_INPUT_LEN];
+bench_i32_t bench_input_i32[BENCH_INPUT_LEN];
+
+static uint32_t overhead;
+
+/* Pseudo random but identical inputs on every run, so results compare across builds */
+static void bench_input_fill(void)
+{
+	uint32_t state = 1;
+
+	for (int i = 0; i < BENCH_INPUT_LEN; i++) {
+		int32_t value;
+
+		state = state * 1664525u + 1013904223u;
+		value = (int32_t)(state >> 16) - 32768;
+
+		bench_input_f32[i] = value / 32.768f;
+		bench_input_i8[i] = value / 328;
+		bench_input_i16[i] = value;
+		bench_input_i32[i] = value * 1024;
+	}
+}
+
+static int bench_counter_init(void)
+{
+	uint32_t start;
+
+	if (DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) {
+		printk("DWT cycle counter not implemented\n");
+		return -ENOTSUP;
+	}
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	/* Counting can be blocked for the non-secure image by the debug configuration */
+	start = DWT->CYCCNT;
+	k_busy_wait(10);
+	if (DWT->CYCCNT == start) {
+		printk("DWT cycle counter not running\n");
+		return -EACCES;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Fastest of CONFIG_APP_BENCH_ITERATIONS runs of a case
+ * @param bench Benchmark case
+ * @param num Number of samples
+ * @return Cycles of the fastest run including the measurement overhead
+ */
+static uint32_t bench_measure(const struct bench_case *bench, uint16_t num)
+{
+	uint32_t best = UINT32_MAX;
+
+	for (int i = 0; i < CONFIG_APP_BENCH_ITERATIONS; i++) {
+		unsigned int key;
+		uint32_t start;
+		uint32_t cycles;
+
+		if (bench->setup) {
+			bench->setup(num);
+		}
+
+		key = irq_lock();
+		start = DWT->CYCCNT;
+		bench->fn(num, BENCH_STRIDE);
+		cycles = DWT->CYCCNT - start;
+		irq_unlock(key);
+
+		best = MIN(best, cycles);
+	}
+
+	return best;
+}
+
+static void bench_empty(uint16_t num, size32_t stride)
+{
+	__asm__ volatile("" ::: "memory");
+}
+
+static void bench_run(const struct bench_case *bench, uint16_t num)
+{
+	uint32_t cycles = bench_measure(bench, num);
+	uint32_t per_sample_x100;
+
+	cycles = (cycles > overhead) ? cycles - overhead : 0;
+	per_sample_x100 = (uint32_t)(((uint64_t)cycles * 100 + num / 2) / num);
+
+	printk("%-40s %5u %10u %7u.%02u\n", bench->name, num, cycles,
+	       per_sample_x100 / 100, per_sample_x100 % 100);
+}
+
+int main(void)
+{
+	const struct bench_case calibration = {
+		.name = "calibration",
+		.fn = bench_empty,
+	};
+	int ret;
+
+	ret = bench_counter_init();
+	if (ret) {
+		return ret;
+	}
+
+	bench_input_fill();
+	overhead = bench_measure(&calibration, 1);
+
+	printk("Benchmark on %s at %u Hz, %d iterations, overhead %u cycles\n",
+	       CONFIG_BOARD, SystemCoreClock, CONFIG_APP_BENCH_ITERATIONS, overhead);
+	printk("%-40s %5s %10s %10s\n", "case", "num", "cycles", "per sample");
+
+	STRUCT_SECTION_FOREACH(bench_case, bench) {
+		if (bench->num) {
+			bench_run(bench, bench->num);
+			continue;
+		}
+
+		for (uint32_t num = BENCH_NUM_MIN; num <= CONFIG_APP_BENCH_NUM_MAX; num *= 2) {
+			bench_run(bench, num);
+		}
+	}
+
+	printk("Benchmark complete\n");
+
+	return 0;
+}
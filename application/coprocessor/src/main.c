@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Acquisition image for the VPR coprocessor of nRF54L and nRF54H SoCs. Owns
+ * the IMU behind the imu0 alias, samples it at the ODR requested by the
+ * sampling module on the application core, averages each group of decimation
+ * samples and sends the published samples in blocks over IPC service, see
+ * modules/sampling/sampling_coproc.h. The application core sleeps until a
+ * block arrives. The ipc0 instance, imu0 and its bus come from a board overlay,
+ * see APP_SAMPLING_COPROC in Kconfig.sysbuild.
+ *
+ * The VPR has no FPU, so sensor values are scaled to counts in integer
+ * arithmetic.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+#include "sampling_coproc.h"
+
+LOG_MODULE_REGISTER(app_coproc, CONFIG_APP_COPROC_LOG_LEVEL);
+
+/* Standard gravity and pi in millionths */
+#define GRAVITY_MICRO 9806650LL
+#define PI_MICRO 3141593LL
+
+static const struct device *const ipc_dev = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+static const struct device *const imu_dev = DEVICE_DT_GET(DT_ALIAS(imu0));
+
+static struct ipc_ept ept;
+static K_SEM_DEFINE(bound_sem, 0, 1);
+
+union coproc_control {
+	uint8_t type;
+	struct sampling_coproc_start start;
+	struct sampling_coproc_stop stop;
+};
+
+/* Start and stop messages, in arrival order */
+K_MSGQ_DEFINE(control_msgq, sizeof(union coproc_control), CONFIG_APP_COPROC_QUEUE_SIZE, 4);
+
+static struct k_timer sample_timer;
+
+/* Settings of the current run */
+static struct sampling_coproc_start run;
+
+/* Block being filled */
+static struct sampling_coproc_samples block = {
+	.type = SAMPLING_COPROC_MSG_SAMPLES,
+};
+
+/* Sums of the group being averaged, indexed by IMU sample */
+static struct {
+	int32_t sum[SAMPLING_COPROC_AXES];
+	uint32_t group;
+	uint16_t count;
+} decimator;
+
+static void ept_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	k_sem_give(&bound_sem);
+}
+
+static void ept_received(const void *data, size_t len, void *priv)
+{
+	union coproc_control msg = { 0 };
+	uint8_t type = len > 0 ? *(const uint8_t *)data : 0;
+
+	ARG_UNUSED(priv);
+
+	if ((type == SAMPLING_COPROC_MSG_START && len == sizeof(msg.start)) ||
+	    (type == SAMPLING_COPROC_MSG_STOP && len == sizeof(msg.stop))) {
+		memcpy(&msg, data, len);
+	} else {
+		LOG_WRN("Malformed message from application core, %zu bytes", len);
+		return;
+	}
+
+	if (k_msgq_put(&control_msgq, &msg, K_NO_WAIT)) {
+		LOG_WRN("Control queue full, message dropped");
+	}
+}
+
+static const struct ipc_ept_cfg ept_cfg = {
+	.name = SAMPLING_COPROC_ENDPOINT,
+	.cb = {
+		.bound = ept_bound,
+		.received = ept_received,
+	},
+};
+
+static int16_t clamp_counts(int64_t counts)
+{
+	return (int16_t)CLAMP(counts, INT16_MIN, INT16_MAX);
+}
+
+/* Acceleration in m/s^2 to counts of the accel range */
+static int16_t accel_counts(const struct sensor_value *value)
+{
+	int64_t micro = (int64_t)value->val1 * 1000000 + value->val2;
+
+	return clamp_counts(micro * 32768 / (run.accel_range_g * GRAVITY_MICRO));
+}
+
+/* Angular rate in rad/s to counts of the gyro range */
+static int16_t gyro_counts(const struct sensor_value *value)
+{
+	int64_t micro = (int64_t)value->val1 * 1000000 + value->val2;
+
+	return clamp_counts(micro * 32768 * 180 / (run.gyro_range_dps * PI_MICRO));
+}
+
+static int imu_configure(int accel_hz, int gyro_hz)
+{
+	struct sensor_value value;
+	int ret;
+
+	sensor_g_to_ms2(run.accel_range_g, &value);
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_ACCEL_XYZ, SENSOR_ATTR_FULL_SCALE, &value);
+	if (ret) {
+		LOG_ERR("Failed to set accel range: %d", ret);
+		return ret;
+	}
+
+	sensor_degrees_to_rad(run.gyro_range_dps, &value);
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_GYRO_XYZ, SENSOR_ATTR_FULL_SCALE, &value);
+	if (ret) {
+		LOG_ERR("Failed to set gyro range: %d", ret);
+		return ret;
+	}
+
+	value.val1 = accel_hz;
+	value.val2 = 0;
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_ACCEL_XYZ, SENSOR_ATTR_SAMPLING_FREQUENCY,
+			      &value);
+	if (ret) {
+		LOG_ERR("Failed to set accel ODR: %d", ret);
+		return ret;
+	}
+
+	value.val1 = gyro_hz;
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_GYRO_XYZ, SENSOR_ATTR_SAMPLING_FREQUENCY,
+			      &value);
+	if (ret) {
+		LOG_ERR("Failed to set gyro ODR: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+static int imu_read(int16_t values[SAMPLING_COPROC_AXES])
+{
+	struct sensor_value accel[3];
+	struct sensor_value gyro[3];
+	int ret;
+
+	ret = sensor_sample_fetch(imu_dev);
+	if (ret == 0) {
+		ret = sensor_channel_get(imu_dev, SENSOR_CHAN_ACCEL_XYZ, accel);
+	}
+	if (ret == 0 && run.gyro_enabled) {
+		ret = sensor_channel_get(imu_dev, SENSOR_CHAN_GYRO_XYZ, gyro);
+	}
+	if (ret) {
+		return ret;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		values[i] = accel_counts(&accel[i]);
+		values[3 + i] = run.gyro_enabled ? gyro_counts(&gyro[i]) : 0;
+	}
+
+	return 0;
+}
+
+static void block_send(void)
+{
+	int ret;
+
+	if (block.count == 0) {
+		return;
+	}
+
+	/* No shared buffer free means the application core is behind, drop the block */
+	ret = ipc_service_send(&ept, &block, sizeof(block));
+	if (ret < 0) {
+		LOG_WRN("Failed to send samples: %d", ret);
+	}
+
+	block.count = 0;
+}
+
+/**
+ * @brief Add one IMU sample to its group and the group average to the block
+ *
+ * Groups are identified by the IMU sample sequence number, like the average
+ * decimator of the sampling module. The samples of a message are
+ * consecutive, so a published sample after a gap starts a new block.
+ */
+static void sample_add(uint32_t imu_seq, const int16_t values[SAMPLING_COPROC_AXES])
+{
+	uint32_t group = imu_seq / run.decimation;
+
+	if (decimator.count == 0 || group != decimator.group) {
+		memset(decimator.sum, 0, sizeof(decimator.sum));
+		decimator.group = group;
+		decimator.count = 0;
+	}
+
+	for (int i = 0; i < SAMPLING_COPROC_AXES; i++) {
+		decimator.sum[i] += values[i];
+	}
+	decimator.count++;
+
+	if ((imu_seq % run.decimation) != (run.decimation - 1U)) {
+		return;
+	}
+
+	if (block.count > 0 && group != block.seq + block.count) {
+		block_send();
+	}
+
+	if (block.count == 0) {
+		block.seq = group;
+	}
+
+	for (int i = 0; i < SAMPLING_COPROC_AXES; i++) {
+		block.values[block.count][i] = decimator.sum[i] / decimator.count;
+	}
+	decimator.count = 0;
+
+	if (++block.count >= run.block_samples) {
+		block_send();
+	}
+}
+
+/**
+ * @brief Sample the IMU until a stop message arrives
+ * @return Control message that ended the run
+ */
+static union coproc_control acquire(void)
+{
+	union coproc_control msg;
+	uint32_t imu_seq = 0;
+
+	block.count = 0;
+	decimator.count = 0;
+
+	k_timer_start(&sample_timer, K_USEC(USEC_PER_SEC / run.odr_hz),
+		      K_USEC(USEC_PER_SEC / run.odr_hz));
+
+	while (k_msgq_get(&control_msgq, &msg, K_NO_WAIT) != 0) {
+		/* Missed periods leave a gap in the IMU sequence */
+		uint32_t periods = k_timer_status_sync(&sample_timer);
+		int16_t values[SAMPLING_COPROC_AXES];
+
+		imu_seq += periods - 1;
+
+		if (imu_read(values) == 0) {
+			sample_add(imu_seq, values);
+		} else {
+			LOG_WRN("Failed to read IMU");
+		}
+
+		imu_seq++;
+	}
+
+	k_timer_stop(&sample_timer);
+
+	return msg;
+}
+
+int main(void)
+{
+	union coproc_control msg;
+	int ret;
+
+	if (!device_is_ready(imu_dev)) {
+		LOG_ERR("IMU device not ready");
+		return -ENODEV;
+	}
+
+	k_timer_init(&sample_timer, NULL, NULL);
+
+	ret = ipc_service_open_instance(ipc_dev);
+	if (ret && ret != -EALREADY) {
+		LOG_ERR("Failed to open IPC instance: %d", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc_dev, &ept, &ept_cfg);
+	if (ret) {
+		LOG_ERR("Failed to register IPC endpoint: %d", ret);
+		return ret;
+	}
+
+	k_sem_take(&bound_sem, K_FOREVER);
+
+	LOG_INF("Sampling coprocessor ready, IMU %s", imu_dev->name);
+
+	k_msgq_get(&control_msgq, &msg, K_FOREVER);
+
+	while (1) {
+		if (msg.type != SAMPLING_COPROC_MSG_START) {
+			/* Stopped, keep the IMU powered down until the next start */
+			k_msgq_get(&control_msgq, &msg, K_FOREVER);
+			continue;
+		}
+
+		run = msg.start;
+		if (run.odr_hz == 0 || run.decimation == 0 || run.block_samples == 0 ||
+		    run.block_samples > SAMPLING_COPROC_BLOCK_MAX) {
+			LOG_ERR("Invalid start message");
+			msg.type = SAMPLING_COPROC_MSG_STOP;
+			continue;
+		}
+
+		ret = imu_configure(run.odr_hz, run.gyro_enabled ? run.odr_hz : 0);
+		if (ret) {
+			msg.type = SAMPLING_COPROC_MSG_STOP;
+			continue;
+		}
+
+		LOG_INF("Sampling at %u Hz, decimated by %u, %u samples per block", run.odr_hz,
+			run.decimation, run.block_samples);
+
+		msg = acquire();
+
+		/* Power both sensors down, a new start supersedes the run */
+		if (msg.type == SAMPLING_COPROC_MSG_STOP) {
+			(void)imu_configure(0, 0);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,1582 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _APP_DSP_H_
+#define _APP_DSP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <nrf_edgeai/rt/nrf_edgeai_dsp_pipeline_types.h>
+#include <nrf_edgeai/dsp/support/nrf_dsp_f24.h>
+#include <nrf_edgeai/dsp/transform/nrf_dsp_melspectr.h>
+
+/**
+ * @brief Calculate the scaled Euclidean norm of a block of float32 XYZ vectors
+ *
+ * out[i] = scale * sqrt(x[i]^2 + y[i]^2 + z[i]^2)
+ *
+ * @param p_xyz Pointer to the X component of the first vector, Y and Z follow it
+ * @param stride Distance in elements between two consecutive vectors (3 if packed)
+ * @param num Number of vectors
+ * @param scale Scale factor folded into the result, e.g. unit conversion
+ * @param p_out Output array of num magnitudes
+ */
+void app_dsp_magnitude_f32(const float *p_xyz, uint16_t stride, uint16_t num,
+			   float scale, float *p_out);
+
+/**
+ * @brief Calculate the scaled Euclidean norm of a block of int16 XYZ vectors
+ *
+ * out[i] = scale * sqrt(x[i]^2 + y[i]^2 + z[i]^2)
+ *
+ * On cores with the DSP extension X and Y are squared and summed by one SMLAD.
+ *
+ * @param p_xyz Pointer to the X component of the first vector, Y and Z follow it
+ * @param stride Distance in elements between two consecutive vectors (3 if packed)
+ * @param num Number of vectors
+ * @param scale Scale factor folded into the result, e.g. counts to milli-g
+ * @param p_out Output array of num magnitudes
+ */
+void app_dsp_magnitude_i16(const int16_t *p_xyz, uint16_t stride, uint16_t num,
+			   float scale, float *p_out);
+
+/**
+ * @brief Calculate the scaled Euclidean norm of int16 XYZ vectors with integer math only
+ *
+ * out[i] = isqrt(x[i]^2 + y[i]^2 + z[i]^2) * scale_q16 / 2^16, rounded and saturated to int16
+ *
+ * On cores with the DSP extension X and Y are squared and summed by one SMLAD.
+ *
+ * @param p_xyz Pointer to the X component of the first vector, Y and Z follow it
+ * @param stride Distance in elements between two consecutive vectors (3 if packed)
+ * @param num Number of vectors
+ * @param scale_q16 Unsigned Q16.16 scale factor folded into the result
+ * @param p_out Output array of num magnitudes
+ */
+void app_dsp_magnitude_i16_q16(const int16_t *p_xyz, uint16_t stride, uint16_t num,
+			       uint32_t scale_q16, int16_t *p_out);
+
+/** Basic statistics of an int16 vector */
+struct app_dsp_stats_i16 {
+	int32_t sum;
+	uint64_t sum_sq;
+	int16_t min;
+	int16_t max;
+};
+
+/**
+ * @brief Calculate sum, sum of squares, min and max of an int16 vector in one pass
+ *
+ * On cores with the DSP extension two samples are processed per iteration
+ * with SMLAD/SMLALD for the sums and SSUB16/SEL for min/max. Other cores use
+ * the equivalent portable C loop.
+ *
+ * @param p_input Input vector
+ * @param num Number of samples, at least 1
+ * @param p_stats Output statistics
+ */
+void app_dsp_stats_i16(const int16_t *p_input, uint16_t num, struct app_dsp_stats_i16 *p_stats);
+
+/**
+ * @brief Calculate the dot product of two int16 vectors as a Float24 value
+ *
+ * Replaces a chain of nrf_dsp_f24_mul() and nrf_dsp_f24_add() per sample.
+ * The sum is exact in 64 bits and normalized once, two samples per SMLALD on
+ * cores with the DSP extension, so the result is the exact dot product
+ * truncated to a 16-bit mantissa.
+ *
+ * @param p_a First vector
+ * @param p_b Second vector
+ * @param num Number of samples
+ *
+ * @return sum(a[i] * b[i])
+ */
+nrf_dsp_f24_t app_dsp_f24_dot_i16(const int16_t *p_a, const int16_t *p_b, uint16_t num);
+
+/**
+ * @brief Calculate the sum of squares of an int16 vector as a Float24 value
+ *
+ * Same as app_dsp_f24_dot_i16() with the vector on both sides.
+ *
+ * @param p_input Input vector
+ * @param num Number of samples
+ *
+ * @return sum(x[i]^2)
+ */
+nrf_dsp_f24_t app_dsp_f24_sum_sq_i16(const int16_t *p_input, uint16_t num);
+
+/**
+ * @brief Calculate the square roots of an array of Float24 values
+ *
+ * Takes an integer square root of each mantissa widened to 31 or 32 bits,
+ * so the roots keep a full 16-bit mantissa without the normalization steps
+ * of nrf_dsp_f24_sqrt(). Negative inputs give zero.
+ *
+ * @param p_input Input values
+ * @param num Number of values
+ * @param p_out Output roots, may be p_input
+ */
+void app_dsp_f24_sqrt(const nrf_dsp_f24_t *p_input, uint16_t num, nrf_dsp_f24_t *p_out);
+
+/** Time-domain features supported by the app_dsp feature kernels */
+#define APP_DSP_FEATURES									\
+	(NRF_EDGEAI_FEATURE_BIT_MIN | NRF_EDGEAI_FEATURE_BIT_MAX | NRF_EDGEAI_FEATURE_BIT_RANGE |	\
+	 NRF_EDGEAI_FEATURE_BIT_MEAN | NRF_EDGEAI_FEATURE_BIT_MAD | NRF_EDGEAI_FEATURE_BIT_STD |	\
+	 NRF_EDGEAI_FEATURE_BIT_RMS | NRF_EDGEAI_FEATURE_BIT_MCR | NRF_EDGEAI_FEATURE_BIT_ABSMEAN |	\
+	 NRF_EDGEAI_FEATURE_BIT_AMDF | NRF_EDGEAI_FEATURE_BIT_PSOM |					\
+	 NRF_EDGEAI_FEATURE_BIT_HJ_MOBILITY | NRF_EDGEAI_FEATURE_BIT_HJ_COMPLEXITY)
+
+/** Window statistics the supported time-domain features are derived from */
+struct app_dsp_stats {
+	float offset;			/* Reference the sums are taken relative to */
+	float sum;			/* sum(x - offset) */
+	float sum_sq;			/* sum((x - offset)^2) */
+	float abs_sum;			/* sum(|x|) */
+	float min;
+	float max;
+	float diff_abs_sum;		/* sum(|x[i] - x[i + 1]|) */
+	float diff_sq_sum;		/* sum((x[i] - x[i + 1])^2) */
+	float diff2_sq_sum;		/* sum((x[i] - 2 * x[i + 1] + x[i + 2])^2) */
+};
+
+/**
+ * @brief Accumulate window statistics in a single pass
+ *
+ * Sums are taken relative to the first sample, which keeps the variance well
+ * conditioned for inputs with a large DC component such as acceleration
+ * magnitudes. Difference sums are only accumulated when the mask requests a
+ * feature that needs them.
+ *
+ * @param p_window Window samples, oldest first
+ * @param num Number of samples, at least 3
+ * @param mask nrf_edgeai time-domain feature mask
+ * @param p_stats Output statistics
+ */
+void app_dsp_stats_f32(const float *p_window, uint16_t num, uint32_t mask,
+		       struct app_dsp_stats *p_stats);
+
+/**
+ * @brief Derive time-domain features from window statistics
+ *
+ * MAD, mean crossing rate and PSOM are relative to the window mean and take
+ * one more pass over the window when requested. Features are written in the
+ * nrf_edgeai time-domain feature order, the supported subset is
+ * APP_DSP_FEATURES and other mask bits are ignored. Results match the nrf_dsp
+ * kernels up to float rounding.
+ *
+ * @param p_stats Window statistics
+ * @param p_window Window samples, oldest first
+ * @param num Number of samples
+ * @param mask nrf_edgeai time-domain feature mask
+ * @param p_features Output features
+ * @return Number of features written
+ */
+uint16_t app_dsp_stats_features_f32(const struct app_dsp_stats *p_stats, const float *p_window,
+				    uint16_t num, uint32_t mask, float *p_features);
+
+/**
+ * @brief Calculate the time-domain features requested by a mask in a fused pass
+ *
+ * Equivalent to app_dsp_stats_f32() followed by app_dsp_stats_features_f32().
+ *
+ * @param p_window Window samples, oldest first
+ * @param num Number of samples, at least 3
+ * @param mask nrf_edgeai time-domain feature mask
+ * @param p_features Output features
+ * @return Number of features written
+ */
+uint16_t app_dsp_features_f32(const float *p_window, uint16_t num, uint32_t mask,
+			      float *p_features);
+
+/**
+ * @brief Window statistics accumulated while the window fills
+ *
+ * Spreads the statistics pass of app_dsp_stats_f32() over the runs of
+ * samples fed into a window, only the features are left for the full
+ * window.
+ */
+struct app_dsp_stats_acc {
+	struct app_dsp_stats stats;
+	uint16_t num;			/* Samples accumulated */
+	float prev;			/* Last sample */
+	float prev_d1;			/* Last first difference */
+};
+
+/**
+ * @brief Restart the accumulated statistics for a new window
+ * @param p_acc Accumulated statistics
+ */
+void app_dsp_stats_acc_reset(struct app_dsp_stats_acc *p_acc);
+
+/**
+ * @brief Add the next samples of the window to the accumulated statistics
+ *
+ * Samples are taken in the order of app_dsp_stats_f32(), so the statistics
+ * of the full window are the same as its single pass.
+ *
+ * @param p_acc Accumulated statistics
+ * @param p_samples Next samples of the window, oldest first
+ * @param num Number of samples
+ * @param mask nrf_edgeai time-domain feature mask
+ */
+void app_dsp_stats_acc_add_f32(struct app_dsp_stats_acc *p_acc, const float *p_samples,
+			       uint16_t num, uint32_t mask);
+
+/** Maximum number of axes of the multi-axis feature kernels, e.g. accel and gyro XYZ */
+#define APP_DSP_AXES_MAX 6
+
+/**
+ * @brief Layout of a multi-axis window
+ *
+ * Sample i of axis a is p_window[i * sample_stride + a * axis_stride].
+ */
+struct app_dsp_axes {
+	uint16_t num;			/* Number of axes, up to APP_DSP_AXES_MAX */
+	uint16_t sample_stride;
+	uint16_t axis_stride;
+};
+
+/** Layout of samples interleaved by axis, e.g. {x0, y0, z0, x1, y1, z1, ...} */
+#define APP_DSP_AXES_INTERLEAVED(_num) ((struct app_dsp_axes){ (_num), (_num), 1 })
+
+/** Layout of one column per axis, e.g. the runtime window {x0, x1, ..., y0, y1, ...} */
+#define APP_DSP_AXES_COLUMNS(_num, _len) ((struct app_dsp_axes){ (_num), 1, (_len) })
+
+/**
+ * @brief Accumulate the window statistics of all axes in a single pass
+ *
+ * Same statistics as app_dsp_stats_f32() for each axis, with the window
+ * walked once for all axes instead of once per axis, so interleaved sensor
+ * data does not need to be split up first.
+ *
+ * @param p_window First sample of the first axis
+ * @param num Number of samples per axis, at least 3
+ * @param p_axes Window layout
+ * @param mask nrf_edgeai time-domain feature mask, the union of all axes
+ * @param p_stats Output statistics, one per axis
+ */
+void app_dsp_stats_multi_f32(const float *p_window, uint16_t num,
+			     const struct app_dsp_axes *p_axes, uint32_t mask,
+			     struct app_dsp_stats *p_stats);
+
+/**
+ * @brief Calculate the time-domain features of all axes of a window
+ *
+ * Equivalent to app_dsp_features_f32() on each axis in turn, features are
+ * written axis after axis as the runtime does for unique input features.
+ *
+ * @param p_window First sample of the first axis
+ * @param num Number of samples per axis, at least 3
+ * @param p_axes Window layout
+ * @param p_masks nrf_edgeai time-domain feature mask of each axis
+ * @param p_features Output features
+ * @return Number of features written
+ */
+uint16_t app_dsp_features_multi_f32(const float *p_window, uint16_t num,
+				    const struct app_dsp_axes *p_axes, const uint32_t *p_masks,
+				    float *p_features);
+
+/** Sample held by a sliding min/max deque */
+struct app_dsp_online_entry {
+	float value;
+	uint32_t seq;
+};
+
+/** Monotonic deque over the samples of a sliding window */
+struct app_dsp_online_deque {
+	struct app_dsp_online_entry *p_entries;
+	uint16_t head;
+	uint16_t num;
+};
+
+/**
+ * @brief Online time-domain feature state for one sliding window
+ *
+ * Define with APP_DSP_ONLINE_DEFINE(). Running sums are kept relative to the
+ * offset taken at the last resync.
+ */
+struct app_dsp_online {
+	uint16_t size;
+	uint16_t shift;
+	float *p_leaving;		/* Oldest shift samples of the last window */
+	struct app_dsp_online_deque min;
+	struct app_dsp_online_deque max;
+	bool valid;
+	uint16_t replaced;		/* Samples replaced since the last resync */
+	uint32_t seq;			/* Sequence number of the next sample */
+	float anchor;			/* Sample expected at the head of the next window */
+	struct app_dsp_stats stats;
+};
+
+/**
+ * @brief Statically define online feature state for a window
+ * @param _name Name of the struct app_dsp_online variable
+ * @param _size Window size in samples
+ * @param _shift Window shift in samples
+ */
+#define APP_DSP_ONLINE_DEFINE(_name, _size, _shift)					\
+	static float _name##_leaving[_shift];						\
+	static struct app_dsp_online_entry _name##_min_entries[_size];			\
+	static struct app_dsp_online_entry _name##_max_entries[_size];			\
+	static struct app_dsp_online _name = {						\
+		.size = _size,								\
+		.shift = _shift,							\
+		.p_leaving = _name##_leaving,						\
+		.min.p_entries = _name##_min_entries,					\
+		.max.p_entries = _name##_max_entries,					\
+	}
+
+/**
+ * @brief Calculate time-domain features of a sliding window incrementally
+ *
+ * The window is expected to have moved by exactly shift samples since the
+ * previous call. Sums and min/max are updated from the samples entering and
+ * leaving the window only. All state is recomputed from scratch on the first
+ * call, when the window does not line up with the previous one, and each time
+ * a full window worth of samples has been replaced, bounding rounding drift.
+ *
+ * Features are written as by app_dsp_stats_features_f32().
+ *
+ * @param p_online Online feature state
+ * @param p_window Window samples, oldest first
+ * @param num Number of samples, must equal the window size
+ * @param mask nrf_edgeai time-domain feature mask
+ * @param p_features Output features
+ * @return Number of features written
+ */
+uint16_t app_dsp_online_features_f32(struct app_dsp_online *p_online, const float *p_window,
+				     uint16_t num, uint32_t mask, float *p_features);
+
+/**
+ * @brief Time-domain features already calculated for one input window
+ *
+ * Models that take features from the same window look them up here instead
+ * of recomputing them. A window is identified by its input stream, a window
+ * id such as the sequence number of its last sample, and its size. Values
+ * are stored by nrf_edgeai time-domain feature index.
+ */
+struct app_dsp_feature_cache {
+	uint32_t stream;
+	uint32_t window;
+	uint16_t num;
+	uint32_t valid;			/* Mask of the features held for the window */
+	float values[NRF_EDGEAI_FEATURE_cnt];
+	uint32_t hits;			/* Lookups served without computing a feature */
+	uint32_t misses;
+};
+
+/**
+ * @brief Select the window the next cached feature lookups refer to
+ *
+ * The cached features are dropped when the stream or window differs from
+ * the current one.
+ *
+ * @param p_cache Feature cache
+ * @param stream Input stream id
+ * @param window Window id within the stream
+ */
+void app_dsp_feature_cache_set_window(struct app_dsp_feature_cache *p_cache, uint32_t stream,
+				      uint32_t window);
+
+/**
+ * @brief Calculate time-domain features, reusing those cached for the current window
+ *
+ * Only the requested features missing from the cache are computed with
+ * app_dsp_features_f32() and added to it. Features are written as by
+ * app_dsp_stats_features_f32().
+ *
+ * @param p_cache Feature cache, set to the window with app_dsp_feature_cache_set_window()
+ * @param p_window Window samples, oldest first
+ * @param num Number of samples, at least 3
+ * @param mask nrf_edgeai time-domain feature mask
+ * @param p_features Output features
+ * @return Number of features written
+ */
+uint16_t app_dsp_features_cached_f32(struct app_dsp_feature_cache *p_cache, const float *p_window,
+				     uint16_t num, uint32_t mask, float *p_features);
+
+/** Most radix stages of a mixed-radix FFT, enough for any 16 bit length */
+#define APP_DSP_FFT_STAGES_MAX 16
+
+/** Twiddle buffer length in floats for a real FFT of _len samples */
+#define APP_DSP_RFFT_TWIDDLE_LEN(_len) (2 * (_len))
+
+/**
+ * Output buffer length in floats for a real FFT of _len samples. Odd lengths
+ * need room for the full complex spectrum while it is computed.
+ */
+#define APP_DSP_RFFT_OUTPUT_LEN(_len) (((_len) & 1) ? 2 * (_len) : (_len) + 2)
+
+/**
+ * @brief Mixed-radix real FFT plan
+ *
+ * Handles any length whose only prime factors are 2, 3 and 5, such as window
+ * sizes chosen for model accuracy rather than for the power of two FFTs of
+ * nrf_dsp. Even lengths are computed with a complex FFT of half the length.
+ */
+struct app_dsp_rfft_f32 {
+	uint16_t len;
+	uint16_t cfft_len;		/* Length of the complex FFT */
+	uint8_t stages;
+	uint16_t factors[2 * APP_DSP_FFT_STAGES_MAX];	/* Radix and remaining length per stage */
+	const float *p_twiddle;		/* Complex FFT twiddles, then the real split twiddles */
+	uint16_t twiddle_stride;	/* Distance between twiddles of this plan in the table */
+};
+
+/**
+ * @brief Initialize a mixed-radix real FFT plan
+ *
+ * @param p_rfft Plan to initialize
+ * @param len Number of real samples, at least 2
+ * @param p_twiddle Twiddle buffer of APP_DSP_RFFT_TWIDDLE_LEN(len) floats, owned by the plan
+ * @return 0 on success, -EINVAL if len has a prime factor other than 2, 3 or 5
+ */
+int app_dsp_rfft_init_f32(struct app_dsp_rfft_f32 *p_rfft, uint16_t len, float *p_twiddle);
+
+/**
+ * @brief Initialize a mixed-radix real FFT plan on the twiddle table of a longer plan
+ *
+ * The twiddles of a length are every n-th twiddle of a length n times
+ * longer, so plans for several window lengths can share the one table of
+ * the longest. The base plan must stay initialized while this one is used.
+ *
+ * @param p_rfft Plan to initialize
+ * @param len Number of real samples, at least 2
+ * @param p_base Initialized plan of a multiple of len samples
+ * @return 0 on success, -EINVAL if len is not supported or does not fit the base plan
+ */
+int app_dsp_rfft_init_shared_f32(struct app_dsp_rfft_f32 *p_rfft, uint16_t len,
+				 const struct app_dsp_rfft_f32 *p_base);
+
+/**
+ * @brief Calculate the spectrum of a real signal with a mixed-radix FFT
+ *
+ * Bins 0 to len / 2 are written as interleaved real and imaginary parts, the
+ * imaginary parts of the DC and, for even lengths, Nyquist bins are zero. The
+ * spectrum is not normalized.
+ *
+ * @param p_rfft Initialized plan
+ * @param p_input Input of len samples, not modified
+ * @param p_output Output of APP_DSP_RFFT_OUTPUT_LEN(len) floats, must not overlap the input
+ */
+void app_dsp_rfft_f32(const struct app_dsp_rfft_f32 *p_rfft, const float *p_input,
+		      float *p_output);
+
+/**
+ * @brief Load a window into a real FFT buffer with a window function applied
+ *
+ * out[i] = x[i] * w[i] for i < num and out[i] = 0 up to len, in one pass
+ * instead of separate copy, windowing and zero padding passes. The window
+ * function is typically a const table in flash.
+ *
+ * @param p_input Window samples
+ * @param num Number of samples
+ * @param p_window Window function of num coefficients
+ * @param len FFT length, at least num
+ * @param p_out FFT buffer of len floats, may be the same as p_input
+ */
+void app_dsp_window_load_f32(const float *p_input, uint16_t num, const float *p_window,
+			     uint16_t len, float *p_out);
+
+/**
+ * @brief Autocorrelation of a window at lags 0 to max_lag
+ *
+ * Define with APP_DSP_AUTOCORR_DEFINE() and initialize with
+ * app_dsp_autocorr_init_f32(), which picks the direct sums, O(num * max_lag),
+ * or the FFT of the zero padded window, O(len * log(len)), whichever costs
+ * less for the window length and maximum lag. Without the FFT buffers the
+ * direct sums are always used.
+ */
+struct app_dsp_autocorr {
+	uint16_t num;			/* Window length */
+	uint16_t max_lag;		/* Largest lag, below num */
+	bool use_fft;
+	struct app_dsp_rfft_f32 rfft;	/* Plan of app_dsp_autocorr_fft_len() samples */
+	float *p_twiddle;		/* APP_DSP_RFFT_TWIDDLE_LEN() of the FFT length or NULL */
+	float *p_work;			/* APP_DSP_AUTOCORR_WORK_LEN() of the FFT length or NULL */
+};
+
+/** Upper bound of app_dsp_autocorr_fft_len() for buffers sized at compile time */
+#define APP_DSP_AUTOCORR_FFT_LEN_MAX(_num, _max_lag) ((5 * ((_num) + (_max_lag))) / 4 + 2)
+
+/** Work buffer length in floats for an FFT length */
+#define APP_DSP_AUTOCORR_WORK_LEN(_fft_len) (2 * (_fft_len) + 2)
+
+/**
+ * @brief Statically define autocorrelation state with FFT buffers
+ *
+ * @param _name Name of the struct app_dsp_autocorr variable
+ * @param _num Window length
+ * @param _max_lag Largest lag
+ */
+#define APP_DSP_AUTOCORR_DEFINE(_name, _num, _max_lag)					\
+	static float _name##_twiddle[APP_DSP_RFFT_TWIDDLE_LEN(				\
+		APP_DSP_AUTOCORR_FFT_LEN_MAX(_num, _max_lag))];				\
+	static float _name##_work[APP_DSP_AUTOCORR_WORK_LEN(				\
+		APP_DSP_AUTOCORR_FFT_LEN_MAX(_num, _max_lag))];				\
+	static struct app_dsp_autocorr _name = {					\
+		.num = _num,								\
+		.max_lag = _max_lag,							\
+		.p_twiddle = _name##_twiddle,						\
+		.p_work = _name##_work,							\
+	}
+
+/**
+ * @brief Get the FFT length of the autocorrelation FFT path
+ *
+ * @param num Window length
+ * @param max_lag Largest lag
+ * @return Smallest even length of at least num + max_lag with prime factors up to 5
+ */
+uint16_t app_dsp_autocorr_fft_len(uint16_t num, uint16_t max_lag);
+
+/**
+ * @brief Initialize autocorrelation state, choosing between direct sums and the FFT
+ *
+ * @param p_autocorr Autocorrelation state
+ * @return 0 on success, -EINVAL if max_lag is not below num
+ */
+int app_dsp_autocorr_init_f32(struct app_dsp_autocorr *p_autocorr);
+
+/**
+ * @brief Calculate the autocorrelation of a window at lags 0 to max_lag
+ *
+ * out[k] = sum((x[i] - mean) * (x[i + k] - mean)) / ((num - k) * var), the
+ * definition of nrf_dsp_autocorr_f32() with the population variance, for
+ * all lags in one call. A constant window gives 0 at all lags.
+ *
+ * @param p_autocorr Autocorrelation state
+ * @param p_input Window samples, oldest first
+ * @param p_output Output of max_lag + 1 coefficients
+ */
+void app_dsp_autocorr_f32(const struct app_dsp_autocorr *p_autocorr, const float *p_input,
+			  float *p_output);
+
+/**
+ * @brief Sliding DFT state for selected bins of a window
+ *
+ * Define with APP_DSP_SDFT_DEFINE() and initialize with app_dsp_sdft_init_f32().
+ * Each new sample updates every tracked bin in constant time. Bins are of a
+ * rectangular window of the last len samples, oldest first.
+ */
+struct app_dsp_sdft {
+	uint16_t len;
+	uint16_t num_bins;
+	const uint16_t *p_bins;		/* Tracked bin indices, below len / 2 + 1 */
+	float *p_history;		/* Ring of the last len samples */
+	float *p_state;			/* Interleaved real and imaginary part per bin */
+	float *p_twiddle;		/* exp(2 pi i bin / len) per bin */
+	uint16_t head;			/* Position of the oldest sample */
+	uint16_t filled;		/* Samples in the history, up to len */
+	uint16_t replaced;		/* Samples pushed since the last resync */
+};
+
+/**
+ * @brief Statically define sliding DFT state
+ * @param _name Name of the struct app_dsp_sdft variable
+ * @param _len Window length in samples
+ * @param _bins Array of the bin indices to track
+ */
+#define APP_DSP_SDFT_DEFINE(_name, _len, _bins)						\
+	static float _name##_history[_len];						\
+	static float _name##_state[2 * (sizeof(_bins) / sizeof((_bins)[0]))];		\
+	static float _name##_twiddle[2 * (sizeof(_bins) / sizeof((_bins)[0]))];		\
+	static struct app_dsp_sdft _name = {						\
+		.len = _len,								\
+		.num_bins = sizeof(_bins) / sizeof((_bins)[0]),				\
+		.p_bins = _bins,							\
+		.p_history = _name##_history,						\
+		.p_state = _name##_state,						\
+		.p_twiddle = _name##_twiddle,						\
+	}
+
+/**
+ * @brief Initialize sliding DFT state, dropping all samples pushed so far
+ *
+ * @param p_sdft Sliding DFT state
+ */
+void app_dsp_sdft_init_f32(struct app_dsp_sdft *p_sdft);
+
+/**
+ * @brief Update the tracked bins with new samples
+ *
+ * Costs O(bins) per sample. The bins are recomputed from the history each
+ * time a full window worth of samples has been pushed, bounding the rounding
+ * drift of the recursion at an amortized cost of O(bins) per sample as well.
+ *
+ * @param p_sdft Sliding DFT state
+ * @param p_samples New samples, oldest first
+ * @param num Number of samples
+ */
+void app_dsp_sdft_update_f32(struct app_dsp_sdft *p_sdft, const float *p_samples, uint16_t num);
+
+/**
+ * @brief Write the amplitudes of the tracked bins into an amplitude spectrum
+ *
+ * spectrum[bin] = scale * |X[bin]| for each tracked bin, other entries are
+ * left untouched. The spectrum can be passed to the nrf_dsp spectral
+ * features, which must only read tracked bins: nrf_dsp_freq_thd_f32() needs
+ * the base bin and its harmonics, nrf_dsp_freq_snr_f32() every bin.
+ *
+ * @param p_sdft Sliding DFT state
+ * @param scale Scale factor folded into the amplitudes, e.g. 2 / len
+ * @param p_spectrum Amplitude spectrum indexed by bin
+ * @return true once a full window of samples has been pushed
+ */
+bool app_dsp_sdft_amplitude_f32(const struct app_dsp_sdft *p_sdft, float scale,
+				float *p_spectrum);
+
+/**
+ * @brief Multichannel FIR decimator
+ *
+ * Input frames are pushed into a delay line per channel and the filter is
+ * only evaluated for the frames that are kept, so decimating by a factor M
+ * costs num_taps / M multiply-adds per input sample and channel, as a
+ * polyphase filter bank. The caller picks the kept frames, which keeps the
+ * output phase tied to its own sample numbering. Each delay line is stored
+ * twice so the taps are contiguous for any head position.
+ */
+struct app_dsp_decimator {
+	const float *p_coeffs;		/* num_taps coefficients */
+	float *p_state;			/* APP_DSP_DECIMATOR_STATE_LEN() floats */
+	uint16_t num_taps;
+	uint16_t channels;
+	uint16_t head;			/* Position of the newest sample in each line */
+};
+
+/** Decimator state length in floats */
+#define APP_DSP_DECIMATOR_STATE_LEN(_taps, _channels) (2 * (_taps) * (_channels))
+
+/**
+ * @brief Design a Hamming windowed-sinc low-pass filter with unity DC gain
+ *
+ * For decimation by M, a cutoff somewhat below 0.5 / M keeps the band that
+ * aliases into the output away from it. About 8 * M taps give the window
+ * a transition band narrow enough for that.
+ *
+ * @param p_coeffs Output coefficients
+ * @param num_taps Number of coefficients
+ * @param cutoff Cutoff frequency as a fraction of the input sample rate, below 0.5
+ */
+void app_dsp_decimator_design_f32(float *p_coeffs, uint16_t num_taps, float cutoff);
+
+/**
+ * @brief Initialize a decimator with zeroed delay lines
+ *
+ * @param p_decimator Decimator state
+ * @param p_coeffs Filter coefficients, referenced by the state
+ * @param num_taps Number of coefficients
+ * @param channels Number of channels per frame
+ * @param p_state Delay lines of APP_DSP_DECIMATOR_STATE_LEN() floats, owned by the state
+ */
+void app_dsp_decimator_init_f32(struct app_dsp_decimator *p_decimator, const float *p_coeffs,
+				uint16_t num_taps, uint16_t channels, float *p_state);
+
+/**
+ * @brief Fill the delay lines with one frame
+ *
+ * Starting from a steady frame instead of zeros avoids the step response of
+ * the filter at the start of a stream.
+ *
+ * @param p_decimator Decimator state
+ * @param p_frame One value per channel
+ */
+void app_dsp_decimator_reset_f32(struct app_dsp_decimator *p_decimator, const float *p_frame);
+
+/**
+ * @brief Push an input frame into the delay lines
+ *
+ * @param p_decimator Decimator state
+ * @param p_frame One value per channel
+ */
+void app_dsp_decimator_push_f32(struct app_dsp_decimator *p_decimator, const float *p_frame);
+
+/**
+ * @brief Calculate the filter output at the newest frame
+ *
+ * Call it after pushing every M-th frame. The output lags the input by
+ * (num_taps - 1) / 2 input samples for a symmetric filter.
+ *
+ * @param p_decimator Decimator state
+ * @param p_output One value per channel
+ */
+void app_dsp_decimator_output_f32(const struct app_dsp_decimator *p_decimator, float *p_output);
+
+/**
+ * @brief Ring of mel-spectrogram frames
+ *
+ * Frames are computed with nrf_dsp_melspectr_make_f32() straight into their
+ * ring slot, and each frame is mirrored time_bands frames further so the
+ * frames of the ring are always contiguous, oldest first. Adding a frame
+ * costs O(freq_bands) instead of the O(freq_bands * time_bands) memmove of
+ * nrf_dsp_melspectr_shift_f32().
+ */
+struct app_dsp_melspectr_ring {
+	nrf_dsp_melspectr_ctx_f32_t *p_ctx;	/* p_melspectrum holds 2 * time_bands frames */
+	uint16_t head;			/* Slot of the next frame */
+	uint16_t fill;			/* Frames in the ring, up to time_bands */
+};
+
+/** Mel-spectrogram buffer length in floats for a ring of _time_bands frames */
+#define APP_DSP_MELSPECTR_RING_LEN(_freq_bands, _time_bands) (2 * (_freq_bands) * (_time_bands))
+
+/**
+ * @brief Initialize an empty mel-spectrogram ring
+ *
+ * @param p_ring Mel-spectrogram ring
+ * @param p_ctx Initialized runtime mel-spectrogram context with a buffer of
+ *		APP_DSP_MELSPECTR_RING_LEN() floats, owned by the ring
+ */
+void app_dsp_melspectr_ring_init(struct app_dsp_melspectr_ring *p_ring,
+				 nrf_dsp_melspectr_ctx_f32_t *p_ctx);
+
+/**
+ * @brief Add the frame of one audio block to the ring, replacing the oldest frame when full
+ *
+ * @param p_ring Mel-spectrogram ring
+ * @param p_audio_input Audio block, transformed in place as by nrf_dsp_melspectr_make_f32()
+ * @return true if the ring holds time_bands frames
+ */
+bool app_dsp_melspectr_ring_push_f32(struct app_dsp_melspectr_ring *p_ring,
+				     flt32_t *p_audio_input);
+
+/**
+ * @brief Drop the oldest frames, e.g. to hop several frames between inferences
+ *
+ * @param p_ring Mel-spectrogram ring
+ * @param num Number of frames to drop
+ */
+void app_dsp_melspectr_ring_drop(struct app_dsp_melspectr_ring *p_ring, uint16_t num);
+
+/**
+ * @brief Get the frames of the ring without copying them
+ *
+ * The view holds fill frames of freq_bands floats each, oldest first, in the
+ * layout of the runtime mel-spectrogram buffer, and is valid until the next
+ * frame is pushed.
+ *
+ * @param p_ring Mel-spectrogram ring
+ * @return Oldest frame
+ */
+const flt32_t *app_dsp_melspectr_ring_view_f32(const struct app_dsp_melspectr_ring *p_ring);
+
+/**
+ * @brief Block floating point amplitude spectrum
+ *
+ * All bins share one exponent: amplitude[k] = p_amplitude[k] * 2^exponent,
+ * in the units of the transformed input samples.
+ */
+struct app_dsp_bfp_spectrum {
+	int16_t *p_amplitude;		/* Mantissas, bins 0 to num - 1 */
+	uint16_t num;
+	int16_t exponent;
+};
+
+/**
+ * @brief Calculate the block floating point amplitude spectrum of an integer RFHT
+ *
+ * |X[k]| = sqrt((H[k]^2 + H[len - k]^2) / 2) for bins 0 to len / 2. The
+ * mantissas are normalized so the largest bin uses the full int16 range,
+ * with integer math only.
+ *
+ * @param p_fht Hartley coefficients in natural order, e.g. from nrf_dsp_rfht_i16()
+ * @param len RFHT length, a power of two
+ * @param fract_bits Fraction bits of the coefficients as returned by nrf_dsp_rfht_i16()
+ * @param p_spectrum Output spectrum, p_amplitude holds len / 2 + 1 elements
+ */
+void app_dsp_bfp_spectrum_i16(const int16_t *p_fht, uint16_t len, uint16_t fract_bits,
+			      struct app_dsp_bfp_spectrum *p_spectrum);
+
+/**
+ * @brief Calculate the spectral centroid of a block floating point spectrum
+ *
+ * The shared exponent cancels out, so no conversion is needed.
+ *
+ * @param p_spectrum Amplitude spectrum
+ * @return Unsigned Q16.16 centroid in bins, 0 for an empty spectrum
+ */
+uint32_t app_dsp_bfp_centroid_q16(const struct app_dsp_bfp_spectrum *p_spectrum);
+
+/**
+ * @brief Calculate the spectral spread of a block floating point spectrum around its centroid
+ *
+ * @param p_spectrum Amplitude spectrum
+ * @param centroid_q16 Centroid from app_dsp_bfp_centroid_q16()
+ * @return Unsigned Q16.16 spread in bins, 0 for an empty spectrum
+ */
+uint32_t app_dsp_bfp_spread_q16(const struct app_dsp_bfp_spectrum *p_spectrum,
+				uint32_t centroid_q16);
+
+/**
+ * @brief Find the highest peaks of a block floating point spectrum
+ *
+ * The minimum peak height is converted to the block exponent and the peaks
+ * are found with nrf_dsp_findpeaks_i16().
+ *
+ * @param p_spectrum Amplitude spectrum
+ * @param min_peak_height_q16 Unsigned Q16.16 minimum peak amplitude in input units
+ * @param min_peak_distance Minimum distance between peaks in bins
+ * @param p_peaks Output bin indices, -1 where no peak was found
+ * @param peaks_num Number of peaks to find
+ */
+void app_dsp_bfp_findpeaks_i16(const struct app_dsp_bfp_spectrum *p_spectrum,
+			       uint32_t min_peak_height_q16, uint16_t min_peak_distance,
+			       int16_t *p_peaks, uint16_t peaks_num);
+
+/** Most peaks app_dsp_findpeaks_*() return, further outputs are set to -1 */
+#define APP_DSP_FINDPEAKS_MAX 16
+
+/**
+ * @brief Find the highest peaks of a vector in one pass
+ *
+ * Same results as nrf_dsp_findpeaks_f32(): a peak is a value above both
+ * neighbours and not below the minimum height, a peak closer than the
+ * minimum distance to the previous peak found is dropped. The runtime keeps
+ * the candidates in a sorted list, moving it at every insertion. Here the
+ * highest peaks are kept in a fixed-size heap, one O(log peaks_num) step
+ * per peak, and sorted once at the end.
+ *
+ * @param p_input Input vector, e.g. an amplitude spectrum
+ * @param num Number of elements
+ * @param min_peak_height Minimum peak value
+ * @param min_peak_distance Minimum distance between peaks in elements
+ * @param p_peaks Output indices, highest peak first, -1 where no peak was found
+ * @param peaks_num Number of peaks to find
+ */
+void app_dsp_findpeaks_f32(const float *p_input, uint16_t num, float min_peak_height,
+			   uint16_t min_peak_distance, int16_t *p_peaks, uint16_t peaks_num);
+
+/**
+ * @brief Find the highest peaks of a fixed-point vector in one pass
+ *
+ * Same results as nrf_dsp_findpeaks_i16(). With the DSP extension two
+ * values are tested against their neighbours and the height per step.
+ *
+ * @param p_input Input vector, e.g. an amplitude spectrum
+ * @param num Number of elements
+ * @param min_peak_height Minimum peak value
+ * @param min_peak_distance Minimum distance between peaks in elements
+ * @param p_peaks Output indices, highest peak first, -1 where no peak was found
+ * @param peaks_num Number of peaks to find
+ */
+void app_dsp_findpeaks_i16(const int16_t *p_input, uint16_t num, int16_t min_peak_height,
+			   uint16_t min_peak_distance, int16_t *p_peaks, uint16_t peaks_num);
+
+/**
+ * @brief Min-max scaling of a feature vector with reciprocal ranges
+ *
+ * The runtime scales with a division per feature, after clipping in a
+ * separate pass. The reciprocals of the ranges are calculated once here so
+ * scaling, clipping and quantization take a single multiply-add pass.
+ */
+struct app_dsp_scale {
+	const float *p_min;
+	float *p_recip;			/* 1 / (max - min), 0 for an empty range */
+	uint16_t num;
+};
+
+/**
+ * @brief Initialize min-max scaling, calculating the reciprocal ranges
+ *
+ * @param p_scale Scaling state
+ * @param p_min Minimum of each feature, referenced by the state
+ * @param p_max Maximum of each feature
+ * @param num Number of features
+ * @param p_recip Reciprocal ranges of num elements, owned by the state
+ */
+void app_dsp_scale_init_f32(struct app_dsp_scale *p_scale, const float *p_min,
+			    const float *p_max, uint16_t num, float *p_recip);
+
+/**
+ * @brief Scale features to [0, 1], clipping them to the scaling range
+ *
+ * out[i] = clamp((in[i] - min[i]) / (max[i] - min[i]), 0, 1), out can alias in.
+ *
+ * @param p_scale Scaling state
+ * @param p_input Input features
+ * @param p_output Output features
+ */
+void app_dsp_scale_clip_f32(const struct app_dsp_scale *p_scale, const float *p_input,
+			    float *p_output);
+
+/**
+ * @brief Scale features to [0, 1] with clipping and quantize them to INT8
+ *
+ * Same result as app_dsp_scale_clip_f32() followed by nrf_dsp_quantize_f32_to_i8()
+ * without NRF_DSP_USE_MATH_ROUNDING, i.e. truncated to [0, 127].
+ *
+ * @param p_scale Scaling state
+ * @param p_input Input features
+ * @param p_output Output features
+ */
+void app_dsp_scale_clip_i8(const struct app_dsp_scale *p_scale, const float *p_input,
+			   int8_t *p_output);
+
+/**
+ * @brief Scale features to [0, 1] with clipping and quantize them to INT16
+ *
+ * Same result as app_dsp_scale_clip_f32() followed by nrf_dsp_quantize_f32_to_i16()
+ * without NRF_DSP_USE_MATH_ROUNDING, i.e. truncated to [0, 32767].
+ *
+ * @param p_scale Scaling state
+ * @param p_input Input features
+ * @param p_output Output features
+ */
+void app_dsp_scale_clip_i16(const struct app_dsp_scale *p_scale, const float *p_input,
+			    int16_t *p_output);
+
+/**
+ * @brief Mahony orientation filter
+ *
+ * Integrates the gyro rates into a unit quaternion and pulls it towards the
+ * measured gravity direction with a proportional-integral correction of the
+ * error between measured and estimated gravity. The integral term tracks
+ * the gyro bias. Costs about 60 multiply-adds and one square root per
+ * update, without trigonometric functions.
+ */
+struct app_dsp_mahony {
+	float q[4];			/* Orientation w, x, y, z, sensor to world frame */
+	float integral[3];		/* Integrated error, the gyro bias estimate in rad/s */
+	float kp;			/* Proportional gain in rad/s */
+	float ki;			/* Integral gain in rad/s^2 */
+	bool initialized;		/* Orientation set from the first accelerometer sample */
+};
+
+/**
+ * @brief Initialize a Mahony filter
+ *
+ * The orientation is taken from the accelerometer at the first update, so
+ * the filter does not have to converge from an arbitrary start.
+ *
+ * @param p_mahony Filter state
+ * @param kp Proportional gain, larger follows the accelerometer faster
+ * @param ki Integral gain, 0 disables the gyro bias estimation
+ */
+void app_dsp_mahony_init_f32(struct app_dsp_mahony *p_mahony, float kp, float ki);
+
+/**
+ * @brief Update the orientation with one sample
+ *
+ * @param p_mahony Filter state
+ * @param p_accel Acceleration x, y, z in any unit, only its direction is used
+ * @param p_gyro Angular rate x, y, z in rad/s
+ * @param dt Time since the previous update in seconds
+ */
+void app_dsp_mahony_update_f32(struct app_dsp_mahony *p_mahony, const float *p_accel,
+			       const float *p_gyro, float dt);
+
+/**
+ * @brief Unit gravity direction in the sensor frame for the current orientation
+ *
+ * Subtracting it scaled by 1 g from the acceleration leaves the linear
+ * acceleration.
+ *
+ * @param p_mahony Filter state
+ * @param p_gravity Output x, y, z
+ */
+void app_dsp_mahony_gravity_f32(const struct app_dsp_mahony *p_mahony, float *p_gravity);
+
+/**
+ * @brief Running quantile estimate of a stream, P-square algorithm
+ *
+ * Tracks one quantile with five markers instead of storing the values: the
+ * minimum, the maximum, the quantile and the two midpoints between them.
+ * The markers move towards their ideal ranks by piecewise parabolic
+ * interpolation. Costs a few divisions per update.
+ */
+struct app_dsp_quantile {
+	float heights[5];		/* Marker values, heights[2] is the estimate */
+	float desired[5];		/* Ideal marker ranks */
+	int32_t positions[5];		/* Actual marker ranks */
+	float quantile;			/* Tracked quantile, 0 to 1 */
+	uint32_t count;			/* Values seen */
+};
+
+/**
+ * @brief Initialize a running quantile estimate
+ * @param p_quantile Estimator state
+ * @param quantile Quantile to track, 0 to 1
+ */
+void app_dsp_quantile_init_f32(struct app_dsp_quantile *p_quantile, float quantile);
+
+/**
+ * @brief Add values to the running quantile estimate
+ * @param p_quantile Estimator state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ */
+void app_dsp_quantile_update_f32(struct app_dsp_quantile *p_quantile, const float *p_input,
+				 uint16_t num);
+
+/**
+ * @brief Add values to the running quantile estimate, every stride-th value of the input
+ * @param p_quantile Estimator state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_quantile_update_f32_s(struct app_dsp_quantile *p_quantile, const float *p_input,
+				   uint16_t num, uint16_t stride);
+
+/**
+ * @brief Add fixed-point values to the running quantile estimate
+ *
+ * The markers are kept in float, the estimate is in the units of the input.
+ *
+ * @param p_quantile Estimator state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ */
+void app_dsp_quantile_update_i16(struct app_dsp_quantile *p_quantile, const int16_t *p_input,
+				 uint16_t num);
+
+/**
+ * @brief Add fixed-point values to the running quantile estimate, every stride-th value
+ * @param p_quantile Estimator state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_quantile_update_i16_s(struct app_dsp_quantile *p_quantile, const int16_t *p_input,
+				   uint16_t num, uint16_t stride);
+
+/**
+ * @brief Get the running quantile estimate
+ *
+ * Exact for the first five values, an estimate afterwards.
+ *
+ * @param p_quantile Estimator state
+ * @return Quantile of the values seen, 0 if there are none
+ */
+float app_dsp_quantile_get_f32(const struct app_dsp_quantile *p_quantile);
+
+/**
+ * @brief Histogram of a stream with log-spaced bins
+ *
+ * Values are counted in units of the resolution. The first 2^sub_bits bins
+ * are one unit wide, each following octave is split into 2^sub_bits bins,
+ * so a bin is at most 1/2^sub_bits of its value wide. Values beyond the
+ * last bin are counted in it, negative values in the first one. Covering
+ * all of uint32_t takes (33 - sub_bits) * 2^sub_bits bins. Define with
+ * APP_DSP_HISTOGRAM_DEFINE().
+ */
+struct app_dsp_histogram {
+	uint32_t *p_counts;		/* Values per bin */
+	uint16_t bins_num;
+	uint8_t sub_bits;		/* log2 of the bins per octave */
+	float resolution;		/* Width of the first bins in input units */
+	uint32_t count;			/* Values counted */
+};
+
+/**
+ * @brief Statically define an empty histogram
+ * @param _name Name of the struct app_dsp_histogram variable
+ * @param _bins Number of bins
+ * @param _sub_bits log2 of the bins per octave, 0 to 7
+ * @param _resolution Width of the first bins in input units
+ */
+#define APP_DSP_HISTOGRAM_DEFINE(_name, _bins, _sub_bits, _resolution)			\
+	static uint32_t _name##_counts[_bins];						\
+	static struct app_dsp_histogram _name = {					\
+		.p_counts = _name##_counts,						\
+		.bins_num = _bins,							\
+		.sub_bits = _sub_bits,							\
+		.resolution = _resolution,						\
+	}
+
+/**
+ * @brief Clear the counts of a histogram
+ * @param p_histogram Histogram
+ */
+void app_dsp_histogram_reset(struct app_dsp_histogram *p_histogram);
+
+/**
+ * @brief Count values in a histogram
+ * @param p_histogram Histogram
+ * @param p_input Values
+ * @param num Number of values
+ */
+void app_dsp_histogram_update_f32(struct app_dsp_histogram *p_histogram, const float *p_input,
+				  uint16_t num);
+
+/**
+ * @brief Count every stride-th value of the input in a histogram
+ * @param p_histogram Histogram
+ * @param p_input Values
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_histogram_update_f32_s(struct app_dsp_histogram *p_histogram, const float *p_input,
+				    uint16_t num, uint16_t stride);
+
+/**
+ * @brief Count fixed-point values in a histogram
+ *
+ * The values are taken as multiples of the resolution, e.g. the resolution
+ * is the physical value of one count.
+ *
+ * @param p_histogram Histogram
+ * @param p_input Values
+ * @param num Number of values
+ */
+void app_dsp_histogram_update_i16(struct app_dsp_histogram *p_histogram, const int16_t *p_input,
+				  uint16_t num);
+
+/**
+ * @brief Count every stride-th fixed-point value of the input in a histogram
+ * @param p_histogram Histogram
+ * @param p_input Values, multiples of the resolution
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_histogram_update_i16_s(struct app_dsp_histogram *p_histogram,
+				    const int16_t *p_input, uint16_t num, uint16_t stride);
+
+/**
+ * @brief Get a quantile of the counted values
+ *
+ * Returns the middle of the bin holding the quantile, in input units.
+ *
+ * @param p_histogram Histogram
+ * @param quantile Quantile, 0 to 1
+ * @return Quantile estimate, 0 if no values have been counted
+ */
+float app_dsp_histogram_quantile_f32(const struct app_dsp_histogram *p_histogram, float quantile);
+
+/**
+ * @brief Exponentially weighted running mean and variance of a stream
+ *
+ * Tracks slow statistics, e.g. a drifting baseline, without storing a
+ * window. The weight of a value decays by (1 - alpha) with every newer one,
+ * about 1 / alpha values contribute. Costs three multiply-adds per value.
+ */
+struct app_dsp_ewma {
+	float mean;
+	float var;
+	float alpha;			/* Weight of the newest value, 0 to 1 */
+	bool initialized;		/* Mean set from the first value */
+};
+
+/**
+ * @brief Initialize exponentially weighted statistics
+ *
+ * The first value sets the mean, so the statistics do not have to converge
+ * from 0.
+ *
+ * @param p_ewma Statistics state
+ * @param alpha Weight of the newest value, 0 to 1
+ */
+void app_dsp_ewma_init_f32(struct app_dsp_ewma *p_ewma, float alpha);
+
+/**
+ * @brief Update exponentially weighted statistics with values
+ * @param p_ewma Statistics state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ */
+void app_dsp_ewma_update_f32(struct app_dsp_ewma *p_ewma, const float *p_input, uint16_t num);
+
+/**
+ * @brief Update exponentially weighted statistics with every stride-th value of the input
+ * @param p_ewma Statistics state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_ewma_update_f32_s(struct app_dsp_ewma *p_ewma, const float *p_input, uint16_t num,
+			       uint16_t stride);
+
+/**
+ * @brief Update exponentially weighted statistics with fixed-point values
+ *
+ * The statistics are kept in float in the units of the input.
+ *
+ * @param p_ewma Statistics state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ */
+void app_dsp_ewma_update_i16(struct app_dsp_ewma *p_ewma, const int16_t *p_input, uint16_t num);
+
+/**
+ * @brief Update exponentially weighted statistics with every stride-th fixed-point value
+ * @param p_ewma Statistics state
+ * @param p_input New values, oldest first
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_ewma_update_i16_s(struct app_dsp_ewma *p_ewma, const int16_t *p_input,
+			       uint16_t num, uint16_t stride);
+
+/**
+ * @brief Exponentially weighted mean
+ * @param p_ewma Statistics state
+ * @return Mean, 0 before the first value
+ */
+float app_dsp_ewma_mean_f32(const struct app_dsp_ewma *p_ewma);
+
+/**
+ * @brief Exponentially weighted variance
+ * @param p_ewma Statistics state
+ * @return Variance, 0 before the second value
+ */
+float app_dsp_ewma_var_f32(const struct app_dsp_ewma *p_ewma);
+
+/**
+ * @brief Exponentially weighted root mean square
+ * @param p_ewma Statistics state
+ * @return Root of the weighted mean of the squared values
+ */
+float app_dsp_ewma_rms_f32(const struct app_dsp_ewma *p_ewma);
+
+/**
+ * @brief Per-device correction of min-max scaling, calibrated online
+ *
+ * Tracks the exponentially weighted mean and variance of each scaled
+ * feature over a calibration period, then freezes a gain and offset per
+ * feature that map them onto reference statistics, e.g. those of the
+ * training data in the same condition. A sensor bias or gain of the device
+ * is thereby removed from the features. The correction is folded into the
+ * minimum and reciprocal range of a scaling state, so once calibrated the
+ * features still take the single app_dsp_scale_clip_f32() pass.
+ */
+struct app_dsp_scale_cal {
+	const struct app_dsp_scale *p_active;	/* Scaling to apply, the calibrated one once frozen */
+	const struct app_dsp_scale *p_ref;	/* Scaling of the training data */
+	const float *p_ref_mean;		/* Reference mean of each scaled feature */
+	const float *p_ref_std;			/* Reference standard deviation of each scaled feature */
+	struct app_dsp_ewma *p_stats;		/* Statistics of each scaled feature while calibrating */
+	struct app_dsp_scale scale;		/* Calibrated scaling, set when frozen */
+	float *p_min;				/* Calibrated minimum of each feature */
+	uint32_t remaining;			/* Vectors until the calibration freezes */
+};
+
+/**
+ * @brief Start the calibration of a scaling state
+ *
+ * The reference scaling is applied until the calibration freezes. It may be
+ * initialized later, before the first update.
+ *
+ * @param p_cal Calibration state
+ * @param p_ref Scaling of the training data, referenced by the state
+ * @param p_ref_mean Reference mean of each scaled feature
+ * @param p_ref_std Reference standard deviation of each scaled feature
+ * @param num Number of features
+ * @param vectors Number of feature vectors to calibrate on, at least 1
+ * @param p_stats Statistics of num elements, owned by the state
+ * @param p_min Calibrated minimums of num elements, owned by the state
+ * @param p_recip Calibrated reciprocal ranges of num elements, owned by the state
+ */
+void app_dsp_scale_cal_init(struct app_dsp_scale_cal *p_cal, const struct app_dsp_scale *p_ref,
+			    const float *p_ref_mean, const float *p_ref_std, uint16_t num,
+			    uint32_t vectors, struct app_dsp_ewma *p_stats, float *p_min,
+			    float *p_recip);
+
+/**
+ * @brief Add a scaled feature vector to the calibration
+ *
+ * Does nothing once the calibration is frozen, so it can be called for every
+ * vector scaled with app_dsp_scale_cal_active().
+ *
+ * @param p_cal Calibration state
+ * @param p_scaled Features scaled with app_dsp_scale_cal_active()
+ *
+ * @return true if this vector completed the calibration
+ */
+bool app_dsp_scale_cal_update_f32(struct app_dsp_scale_cal *p_cal, const float *p_scaled);
+
+/**
+ * @brief Scaling to apply to the features
+ * @param p_cal Calibration state
+ * @return Reference scaling while calibrating, the calibrated one afterwards
+ */
+static inline const struct app_dsp_scale *
+app_dsp_scale_cal_active(const struct app_dsp_scale_cal *p_cal)
+{
+	return p_cal->p_active;
+}
+
+/**
+ * @brief Central moments of a stream in one pass
+ *
+ * Mean and the sums of the squared, cubed and fourth powers of the
+ * deviations from it, updated per value with the Welford and Terriberry
+ * recurrences. Unlike nrf_dsp_var_f32(), nrf_dsp_skew_f32() and
+ * nrf_dsp_kur_f32(), which take the mean in a first pass over the window,
+ * the input is read once and never needs to be kept. States of subwindows
+ * combine with app_dsp_moments_merge(), e.g. to get the window statistics
+ * from the statistics of its shifts or of blocks processed separately.
+ */
+struct app_dsp_moments {
+	uint32_t count;
+	float mean;
+	float m2;
+	float m3;
+	float m4;
+};
+
+/**
+ * @brief Reset central moments to no values
+ * @param p_moments Moments state
+ */
+void app_dsp_moments_reset(struct app_dsp_moments *p_moments);
+
+/**
+ * @brief Update central moments with values
+ * @param p_moments Moments state
+ * @param p_input New values
+ * @param num Number of values
+ */
+void app_dsp_moments_update_f32(struct app_dsp_moments *p_moments, const float *p_input,
+				uint16_t num);
+
+/**
+ * @brief Update central moments with every stride-th value of the input
+ * @param p_moments Moments state
+ * @param p_input New values
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_moments_update_f32_s(struct app_dsp_moments *p_moments, const float *p_input,
+				  uint16_t num, uint16_t stride);
+
+/**
+ * @brief Update central moments with fixed-point values
+ *
+ * The moments are kept in float in the units of the input.
+ *
+ * @param p_moments Moments state
+ * @param p_input New values
+ * @param num Number of values
+ */
+void app_dsp_moments_update_i16(struct app_dsp_moments *p_moments, const int16_t *p_input,
+				uint16_t num);
+
+/**
+ * @brief Update central moments with every stride-th fixed-point value
+ * @param p_moments Moments state
+ * @param p_input New values
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ */
+void app_dsp_moments_update_i16_s(struct app_dsp_moments *p_moments, const int16_t *p_input,
+				  uint16_t num, uint16_t stride);
+
+/**
+ * @brief Add the values counted in another state
+ *
+ * The result equals updating one state with the values of both.
+ *
+ * @param p_moments Moments state, updated
+ * @param p_other Moments of the other values
+ */
+void app_dsp_moments_merge(struct app_dsp_moments *p_moments,
+			   const struct app_dsp_moments *p_other);
+
+/**
+ * @brief Mean of the values
+ * @param p_moments Moments state
+ * @return Mean, 0 without values
+ */
+float app_dsp_moments_mean_f32(const struct app_dsp_moments *p_moments);
+
+/**
+ * @brief Population variance of the values
+ * @param p_moments Moments state
+ * @return Variance, 0 without values
+ */
+float app_dsp_moments_var_f32(const struct app_dsp_moments *p_moments);
+
+/**
+ * @brief Skewness of the values
+ * @param p_moments Moments state
+ * @return Skewness, 0 if the values are constant
+ */
+float app_dsp_moments_skew_f32(const struct app_dsp_moments *p_moments);
+
+/**
+ * @brief Excess kurtosis of the values, as nrf_dsp_kur_f32()
+ * @param p_moments Moments state
+ * @return Excess kurtosis, 0 if the values are constant
+ */
+float app_dsp_moments_kur_f32(const struct app_dsp_moments *p_moments);
+
+/** Crossing rates of app_dsp_crossings_*(), bit n of their mask requests rate n */
+enum app_dsp_crossing {
+	APP_DSP_CROSSING_ZERO,		/* Crossings of 0, as nrf_dsp_zcr_f32() */
+	APP_DSP_CROSSING_MEAN,		/* Crossings of the mean, as nrf_dsp_mcr_f32() */
+	APP_DSP_CROSSING_THRESHOLD,	/* Crossings of a threshold, as nrf_dsp_tcr_f32() */
+	APP_DSP_CROSSING_SIGMA,		/* Crossings of mean + k * stddev, as nrf_dsp_scr_f32() */
+	APP_DSP_CROSSING_NUM,
+};
+
+/**
+ * @brief Calculate zero, mean, threshold and sigma crossing rates in one pass
+ *
+ * A crossing is a change of the sign of the value minus the reference
+ * between consecutive values, the rate is the number of crossings over
+ * num - 1 transitions. All four references are compared per value with
+ * branchless sign-bit arithmetic, so the crossing pass costs the same for
+ * any mask. The mean and standard deviation take one pass of their own,
+ * only when the mean or sigma crossing rate is requested.
+ *
+ * @param p_input Input vector
+ * @param num Number of values
+ * @param mask Rates to calculate, BIT() of enum app_dsp_crossing
+ * @param threshold Reference of APP_DSP_CROSSING_THRESHOLD
+ * @param sigma_factor Standard deviations from the mean of APP_DSP_CROSSING_SIGMA
+ * @param p_rates APP_DSP_CROSSING_NUM rates, indexed by enum app_dsp_crossing,
+ *		  0 for rates not requested
+ */
+void app_dsp_crossings_f32(const float *p_input, uint16_t num, uint8_t mask, float threshold,
+			   nrf_dsp_sigma_factor_t sigma_factor, float *p_rates);
+
+/**
+ * @brief Calculate crossing rates of every stride-th value of the input
+ * @param p_input Input vector
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ * @param mask Rates to calculate, BIT() of enum app_dsp_crossing
+ * @param threshold Reference of APP_DSP_CROSSING_THRESHOLD
+ * @param sigma_factor Standard deviations from the mean of APP_DSP_CROSSING_SIGMA
+ * @param p_rates APP_DSP_CROSSING_NUM rates, indexed by enum app_dsp_crossing
+ */
+void app_dsp_crossings_f32_s(const float *p_input, uint16_t num, uint16_t stride, uint8_t mask,
+			     float threshold, nrf_dsp_sigma_factor_t sigma_factor, float *p_rates);
+
+/**
+ * @brief Calculate crossing rates of an int16 vector in one pass
+ *
+ * Rates are multiplied by 1000 like the int results of nrf_dsp_zcr_i16()
+ * and the other nrf_dsp crossing rate kernels. On cores with the DSP
+ * extension two values are compared per QSUB16.
+ *
+ * @param p_input Input vector
+ * @param num Number of values
+ * @param mask Rates to calculate, BIT() of enum app_dsp_crossing
+ * @param threshold Reference of APP_DSP_CROSSING_THRESHOLD
+ * @param sigma_factor Standard deviations from the mean of APP_DSP_CROSSING_SIGMA
+ * @param p_rates APP_DSP_CROSSING_NUM rates times 1000, indexed by enum app_dsp_crossing
+ */
+void app_dsp_crossings_i16(const int16_t *p_input, uint16_t num, uint8_t mask,
+			   int16_t threshold, nrf_dsp_sigma_factor_t sigma_factor,
+			   int16_t *p_rates);
+
+/**
+ * @brief Calculate crossing rates of every stride-th value of an int16 vector
+ * @param p_input Input vector
+ * @param num Number of values
+ * @param stride Distance between consecutive values in elements
+ * @param mask Rates to calculate, BIT() of enum app_dsp_crossing
+ * @param threshold Reference of APP_DSP_CROSSING_THRESHOLD
+ * @param sigma_factor Standard deviations from the mean of APP_DSP_CROSSING_SIGMA
+ * @param p_rates APP_DSP_CROSSING_NUM rates times 1000, indexed by enum app_dsp_crossing
+ */
+void app_dsp_crossings_i16_s(const int16_t *p_input, uint16_t num, uint16_t stride,
+			     uint8_t mask, int16_t threshold, nrf_dsp_sigma_factor_t sigma_factor,
+			     int16_t *p_rates);
+
+/**
+ * @brief Sliding window low and high frequency peak-to-peak amplitudes
+ *
+ * Streaming nrf_dsp_pk2pk_lf_hf_f32() over the last num inputs: the
+ * low-pass is the moving average of window_size inputs, the high-pass the
+ * input in the middle of that window minus the average. The moving average
+ * is a running sum over a ring of the last window_size inputs, the extremes
+ * of the num - window_size + 1 filtered values of the window are kept in
+ * monotonic deques. Each input costs O(1) amortized, independent of both
+ * sizes, where rerunning nrf_dsp_pk2pk_lf_hf_f32() on every shift of an
+ * overlapping window costs O(num). Define with APP_DSP_PK2PK_DEFINE().
+ */
+struct app_dsp_pk2pk {
+	float *p_ring;			/* Last window_size inputs */
+	uint16_t window_size;		/* Moving average length, nrf_dsp window_size */
+	uint16_t size;			/* Filtered values per window */
+	uint16_t ring_pos;		/* Oldest input in the ring once it is full */
+	uint32_t added;			/* Inputs since the reset */
+	float sum;			/* Sum of the ring */
+	struct app_dsp_online_deque lf_min;
+	struct app_dsp_online_deque lf_max;
+	struct app_dsp_online_deque hf_min;
+	struct app_dsp_online_deque hf_max;
+};
+
+/**
+ * @brief Statically define sliding peak-to-peak state
+ * @param _name Name of the struct app_dsp_pk2pk variable
+ * @param _num Window size in inputs, as num of nrf_dsp_pk2pk_lf_hf_f32()
+ * @param _window_size Moving average length, at most _num
+ */
+#define APP_DSP_PK2PK_DEFINE(_name, _num, _window_size)					\
+	static float _name##_ring[_window_size];					\
+	static struct app_dsp_online_entry						\
+		_name##_entries[4][(_num) - (_window_size) + 1];			\
+	static struct app_dsp_pk2pk _name = {						\
+		.p_ring = _name##_ring,							\
+		.window_size = _window_size,						\
+		.size = (_num) - (_window_size) + 1,					\
+		.lf_min.p_entries = _name##_entries[0],					\
+		.lf_max.p_entries = _name##_entries[1],					\
+		.hf_min.p_entries = _name##_entries[2],					\
+		.hf_max.p_entries = _name##_entries[3],					\
+	}
+
+/**
+ * @brief Reset sliding peak-to-peak state to no inputs
+ * @param p_pk2pk Peak-to-peak state
+ */
+void app_dsp_pk2pk_reset(struct app_dsp_pk2pk *p_pk2pk);
+
+/**
+ * @brief Add inputs to the sliding window
+ * @param p_pk2pk Peak-to-peak state
+ * @param p_input New inputs, oldest first
+ * @param num Number of inputs
+ */
+void app_dsp_pk2pk_update_f32(struct app_dsp_pk2pk *p_pk2pk, const float *p_input, uint16_t num);
+
+/**
+ * @brief Add every stride-th input to the sliding window
+ * @param p_pk2pk Peak-to-peak state
+ * @param p_input New inputs, oldest first
+ * @param num Number of inputs
+ * @param stride Distance between consecutive inputs in elements
+ */
+void app_dsp_pk2pk_update_f32_s(struct app_dsp_pk2pk *p_pk2pk, const float *p_input,
+				uint16_t num, uint16_t stride);
+
+/**
+ * @brief Add fixed-point inputs to the sliding window
+ *
+ * The amplitudes are kept in float in the units of the input.
+ *
+ * @param p_pk2pk Peak-to-peak state
+ * @param p_input New inputs, oldest first
+ * @param num Number of inputs
+ */
+void app_dsp_pk2pk_update_i16(struct app_dsp_pk2pk *p_pk2pk, const int16_t *p_input,
+			      uint16_t num);
+
+/**
+ * @brief Add every stride-th fixed-point input to the sliding window
+ * @param p_pk2pk Peak-to-peak state
+ * @param p_input New inputs, oldest first
+ * @param num Number of inputs
+ * @param stride Distance between consecutive inputs in elements
+ */
+void app_dsp_pk2pk_update_i16_s(struct app_dsp_pk2pk *p_pk2pk, const int16_t *p_input,
+				uint16_t num, uint16_t stride);
+
+/**
+ * @brief Get the peak-to-peak amplitudes of the last num inputs
+ * @param p_pk2pk Peak-to-peak state
+ * @param p_pk2pk_lf Low frequency amplitude, as nrf_dsp_pk2pk_lf_f32()
+ * @param p_pk2pk_hf High frequency amplitude, as nrf_dsp_pk2pk_hf_f32()
+ * @return true if num inputs have been added since the reset
+ */
+bool app_dsp_pk2pk_get_f32(const struct app_dsp_pk2pk *p_pk2pk, float *p_pk2pk_lf,
+			   float *p_pk2pk_hf);
+
+#endif /* _APP_DSP_H_ */
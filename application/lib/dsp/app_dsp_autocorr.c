@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+/*
+ * Cost of the FFT path in multiply-accumulates of the direct path, per
+ * point and radix stage of the two real FFTs and per point of the power
+ * spectrum. Host measurements put it at about 0.5, rounded up for margin.
+ */
+#define AUTOCORR_FFT_COST 1
+
+static bool is_5_smooth(uint16_t n)
+{
+	static const uint16_t radices[] = { 2, 3, 5 };
+
+	for (uint16_t i = 0; i < ARRAY_SIZE(radices); i++) {
+		while (n % radices[i] == 0) {
+			n /= radices[i];
+		}
+	}
+
+	return n == 1;
+}
+
+static uint32_t ilog2_ceil(uint32_t n)
+{
+	uint32_t log = 0;
+
+	while ((1UL << log) < n) {
+		log++;
+	}
+
+	return log;
+}
+
+uint16_t app_dsp_autocorr_fft_len(uint16_t num, uint16_t max_lag)
+{
+	/* Even lengths, the real FFT of odd lengths takes a full length complex FFT */
+	uint16_t len = num + max_lag + ((num + max_lag) & 1);
+
+	while (!is_5_smooth(len / 2)) {
+		len += 2;
+	}
+
+	return len;
+}
+
+int app_dsp_autocorr_init_f32(struct app_dsp_autocorr *p_autocorr)
+{
+	uint16_t num = p_autocorr->num;
+	uint16_t max_lag = p_autocorr->max_lag;
+	uint32_t direct_cost = (uint32_t)(max_lag + 1) * (num - max_lag / 2);
+	uint32_t fft_cost;
+	uint16_t len;
+
+	if (max_lag >= num) {
+		return -EINVAL;
+	}
+
+	p_autocorr->use_fft = false;
+
+	if (p_autocorr->p_twiddle == NULL || p_autocorr->p_work == NULL) {
+		return 0;
+	}
+
+	len = app_dsp_autocorr_fft_len(num, max_lag);
+	fft_cost = AUTOCORR_FFT_COST * len * (2 * ilog2_ceil(len) + 1);
+
+	if (direct_cost > fft_cost) {
+		p_autocorr->use_fft =
+			(app_dsp_rfft_init_f32(&p_autocorr->rfft, len, p_autocorr->p_twiddle) == 0);
+	}
+
+	return 0;
+}
+
+/* acc[k] = sum((x[i] - mean) * (x[i + k] - mean)) for lags 0 to max_lag, by definition */
+static void autocorr_direct(const struct app_dsp_autocorr *p_autocorr, const float *p_input,
+			    float mean, float *p_acc)
+{
+	for (uint16_t k = 0; k <= p_autocorr->max_lag; k++) {
+		float acc = 0.0f;
+
+		for (uint16_t i = 0; i + k < p_autocorr->num; i++) {
+			acc += (p_input[i] - mean) * (p_input[i + k] - mean);
+		}
+
+		p_acc[k] = acc;
+	}
+}
+
+/*
+ * Same sums as the inverse FFT of the power spectrum of the zero padded
+ * window. The padding to at least num + max_lag keeps the circular
+ * correlation from wrapping into the lags used. The power spectrum is real
+ * and even, so its inverse FFT is the forward FFT scaled by 1 / len, and
+ * one real FFT plan serves both directions.
+ */
+static void autocorr_fft(const struct app_dsp_autocorr *p_autocorr, const float *p_input,
+			 float mean, float *p_acc)
+{
+	const uint16_t len = p_autocorr->rfft.len;
+	float *p_time = p_autocorr->p_work;
+	float *p_spectrum = p_autocorr->p_work + len;
+
+	for (uint16_t i = 0; i < p_autocorr->num; i++) {
+		p_time[i] = p_input[i] - mean;
+	}
+	memset(&p_time[p_autocorr->num], 0, (len - p_autocorr->num) * sizeof(float));
+
+	app_dsp_rfft_f32(&p_autocorr->rfft, p_time, p_spectrum);
+
+	for (uint16_t k = 0; k <= len / 2; k++) {
+		float re = p_spectrum[2 * k];
+		float im = p_spectrum[2 * k + 1];
+
+		p_time[k] = re * re + im * im;
+	}
+	for (uint16_t k = 1; k < len / 2; k++) {
+		p_time[len - k] = p_time[k];
+	}
+
+	app_dsp_rfft_f32(&p_autocorr->rfft, p_time, p_spectrum);
+
+	for (uint16_t k = 0; k <= p_autocorr->max_lag; k++) {
+		p_acc[k] = p_spectrum[2 * k] / len;
+	}
+}
+
+void app_dsp_autocorr_f32(const struct app_dsp_autocorr *p_autocorr, const float *p_input,
+			  float *p_output)
+{
+	const uint16_t num = p_autocorr->num;
+	float mean = 0.0f;
+	float var;
+
+	for (uint16_t i = 0; i < num; i++) {
+		mean += p_input[i];
+	}
+	mean /= num;
+
+	if (p_autocorr->use_fft) {
+		autocorr_fft(p_autocorr, p_input, mean, p_output);
+	} else {
+		autocorr_direct(p_autocorr, p_input, mean, p_output);
+	}
+
+	/* Normalized as nrf_dsp_autocorr_f32(), by the number of products and the variance */
+	var = p_output[0] / num;
+
+	for (uint16_t k = 0; k <= p_autocorr->max_lag; k++) {
+		p_output[k] = (var > 0.0f) ? p_output[k] / ((num - k) * var) : 0.0f;
+	}
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/sys/util.h>
+#include <nrf_edgeai/dsp/spectral/nrf_dsp_findpeaks.h>
+#include "app_dsp.h"
+
+/* Bitwise integer square root, floor(sqrt(value)) */
+static uint32_t isqrt_u64(uint64_t value)
+{
+	uint64_t root = 0;
+	uint64_t bit = 1ULL << 62;
+
+	while (bit > value) {
+		bit >>= 2;
+	}
+
+	while (bit != 0) {
+		if (value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return (uint32_t)root;
+}
+
+/* Twice the power of bin k, at most 2^31 */
+static inline uint32_t bin_power2(const int16_t *p_fht, uint16_t len, uint16_t k)
+{
+	int32_t a = p_fht[k];
+	int32_t b = p_fht[(len - k) & (len - 1)];
+
+	return (uint32_t)(a * a) + (uint32_t)(b * b);
+}
+
+void app_dsp_bfp_spectrum_i16(const int16_t *p_fht, uint16_t len, uint16_t fract_bits,
+			      struct app_dsp_bfp_spectrum *p_spectrum)
+{
+	const uint16_t num = len / 2 + 1;
+	const uint64_t full_scale = (uint64_t)INT16_MAX * INT16_MAX * 2;
+	uint32_t max_power2 = 0;
+	uint16_t shift = 0;
+
+	for (uint16_t k = 0; k < num; k++) {
+		max_power2 = MAX(max_power2, bin_power2(p_fht, len, k));
+	}
+
+	/* Each step of the power shift by two scales the amplitudes by one bit */
+	while (max_power2 != 0 && shift < 15 &&
+	       ((uint64_t)max_power2 << (2 * (shift + 1))) <= full_scale) {
+		shift++;
+	}
+
+	for (uint16_t k = 0; k < num; k++) {
+		uint32_t amplitude = isqrt_u64(((uint64_t)bin_power2(p_fht, len, k) << (2 * shift)) / 2);
+
+		p_spectrum->p_amplitude[k] = (int16_t)MIN(amplitude, INT16_MAX);
+	}
+
+	p_spectrum->num = num;
+	p_spectrum->exponent = -(int16_t)(fract_bits + shift);
+}
+
+uint32_t app_dsp_bfp_centroid_q16(const struct app_dsp_bfp_spectrum *p_spectrum)
+{
+	uint64_t weighted = 0;
+	uint32_t sum = 0;
+
+	for (uint16_t k = 0; k < p_spectrum->num; k++) {
+		weighted += (uint64_t)k * (uint16_t)p_spectrum->p_amplitude[k];
+		sum += (uint16_t)p_spectrum->p_amplitude[k];
+	}
+
+	return (sum != 0) ? (uint32_t)((weighted << 16) / sum) : 0;
+}
+
+uint32_t app_dsp_bfp_spread_q16(const struct app_dsp_bfp_spectrum *p_spectrum,
+				uint32_t centroid_q16)
+{
+	uint64_t weighted = 0;
+	uint32_t sum = 0;
+
+	for (uint16_t k = 0; k < p_spectrum->num; k++) {
+		/* Q8 distance to the centroid keeps the weighted squares within 64 bits */
+		int64_t distance_q8 = (((int64_t)k << 16) - centroid_q16) / 256;
+
+		weighted += (uint64_t)(distance_q8 * distance_q8) * (uint16_t)p_spectrum->p_amplitude[k];
+		sum += (uint16_t)p_spectrum->p_amplitude[k];
+	}
+
+	if (sum == 0) {
+		return 0;
+	}
+
+	/* The variance is Q16, shifting it by 16 more bits makes its root Q16 */
+	return isqrt_u64((weighted / sum) << 16);
+}
+
+void app_dsp_bfp_findpeaks_i16(const struct app_dsp_bfp_spectrum *p_spectrum,
+			       uint32_t min_peak_height_q16, uint16_t min_peak_distance,
+			       int16_t *p_peaks, uint16_t peaks_num)
+{
+	/* mantissa = height * 2^-16 * 2^-exponent */
+	int16_t shift = -16 - p_spectrum->exponent;
+	uint64_t height;
+
+	if (shift >= 0) {
+		height = (shift < 32) ? ((uint64_t)min_peak_height_q16 << shift) : UINT64_MAX;
+	} else {
+		height = (shift > -32) ? (min_peak_height_q16 >> -shift) : 0;
+	}
+
+	nrf_dsp_findpeaks_i16(p_spectrum->p_amplitude, p_spectrum->num,
+			      (int16_t)MIN(height, INT16_MAX), min_peak_distance, p_peaks, peaks_num);
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+#endif
+
+/* Rates given to the int16 variants are scaled like the nrf_dsp int results */
+#define CROSSINGS_INT_FACTOR 1000
+
+/* Rates that need the window mean and standard deviation */
+#define CROSSINGS_MEAN_PASS (BIT(APP_DSP_CROSSING_MEAN) | BIT(APP_DSP_CROSSING_SIGMA))
+
+/*
+ * Every value is compared with the four references at once. Bit k of the
+ * below mask is the sign of the value minus reference k, a crossing is a
+ * change of the bit between consecutive values. The changes are added to
+ * four 16-bit lane counters in two words, without a branch per reference.
+ */
+struct crossings_count {
+	uint32_t lanes_01;
+	uint32_t lanes_23;
+	uint32_t prev_below;
+};
+
+static inline void crossings_add(struct crossings_count *p_count, uint32_t below)
+{
+	uint32_t changes = below ^ p_count->prev_below;
+
+	p_count->lanes_01 += (changes & 0x1) | ((changes & 0x2) << 15);
+	p_count->lanes_23 += ((changes >> 2) & 0x1) | ((changes & 0x8) << 13);
+	p_count->prev_below = below;
+}
+
+static inline uint16_t crossings_get(const struct crossings_count *p_count,
+				     enum app_dsp_crossing crossing)
+{
+	uint32_t lanes = (crossing < APP_DSP_CROSSING_THRESHOLD) ? p_count->lanes_01 :
+								   p_count->lanes_23;
+
+	return (crossing & 1) ? lanes >> 16 : lanes & 0xffff;
+}
+
+/* References of the four rates from the window mean and its standard deviation */
+static void crossings_refs_f32(float mean, float stddev, float threshold,
+			       nrf_dsp_sigma_factor_t sigma_factor, float *p_refs)
+{
+	p_refs[APP_DSP_CROSSING_ZERO] = 0.0f;
+	p_refs[APP_DSP_CROSSING_MEAN] = mean;
+	p_refs[APP_DSP_CROSSING_THRESHOLD] = threshold;
+	p_refs[APP_DSP_CROSSING_SIGMA] = mean + (float)sigma_factor * stddev;
+}
+
+/* signbit() may return any non-zero value for a set sign */
+static inline uint32_t below_f32(float x, const float *p_refs)
+{
+	return (signbit(x - p_refs[0]) != 0) | ((signbit(x - p_refs[1]) != 0) << 1) |
+	       ((signbit(x - p_refs[2]) != 0) << 2) | ((signbit(x - p_refs[3]) != 0) << 3);
+}
+
+void app_dsp_crossings_f32(const float *p_input, uint16_t num, uint8_t mask, float threshold,
+			   nrf_dsp_sigma_factor_t sigma_factor, float *p_rates)
+{
+	app_dsp_crossings_f32_s(p_input, num, 1, mask, threshold, sigma_factor, p_rates);
+}
+
+void app_dsp_crossings_f32_s(const float *p_input, uint16_t num, uint16_t stride, uint8_t mask,
+			     float threshold, nrf_dsp_sigma_factor_t sigma_factor, float *p_rates)
+{
+	struct crossings_count count = { 0 };
+	float mean = 0.0f;
+	float stddev = 0.0f;
+	float refs[APP_DSP_CROSSING_NUM];
+
+	if (num < 2) {
+		memset(p_rates, 0, APP_DSP_CROSSING_NUM * sizeof(p_rates[0]));
+		return;
+	}
+
+	/* Sums relative to the first value keep the variance well conditioned */
+	if (mask & CROSSINGS_MEAN_PASS) {
+		float offset = p_input[0];
+		float sum = 0.0f;
+		float sum_sq = 0.0f;
+
+		for (uint16_t i = 0; i < num; i++) {
+			float rel = p_input[i * stride] - offset;
+
+			sum += rel;
+			sum_sq += rel * rel;
+		}
+
+		mean = sum / num;
+		stddev = sqrtf(MAX(sum_sq / num - mean * mean, 0.0f));
+		mean += offset;
+	}
+
+	crossings_refs_f32(mean, stddev, threshold, sigma_factor, refs);
+
+	count.prev_below = below_f32(p_input[0], refs);
+	for (uint16_t i = 1; i < num; i++) {
+		crossings_add(&count, below_f32(p_input[i * stride], refs));
+	}
+
+	for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+		p_rates[k] = (mask & BIT(k)) ? crossings_get(&count, k) / (num - 1.0f) : 0.0f;
+	}
+}
+
+/*
+ * Integer references, x < ref for a real ref is x < ceil(ref) for an integer
+ * x. Up to INT16_MAX + 1, a level above all values, to compare int16 values.
+ */
+static void crossings_refs_i16(const int16_t *p_input, uint16_t num, uint16_t stride,
+			       uint8_t mask, int16_t threshold,
+			       nrf_dsp_sigma_factor_t sigma_factor, int32_t *p_refs)
+{
+	float mean = 0.0f;
+	float stddev = 0.0f;
+
+	if (mask & CROSSINGS_MEAN_PASS) {
+		int32_t sum = 0;
+		uint64_t sum_sq = 0;
+
+		if (stride == 1) {
+			struct app_dsp_stats_i16 stats;
+
+			app_dsp_stats_i16(p_input, num, &stats);
+			sum = stats.sum;
+			sum_sq = stats.sum_sq;
+		} else {
+			for (uint16_t i = 0; i < num; i++) {
+				int32_t x = p_input[i * stride];
+
+				sum += x;
+				sum_sq += (uint32_t)(x * x);
+			}
+		}
+
+		mean = (float)sum / num;
+		stddev = sqrtf(MAX((float)sum_sq / num - mean * mean, 0.0f));
+	}
+
+	p_refs[APP_DSP_CROSSING_ZERO] = 0;
+	p_refs[APP_DSP_CROSSING_MEAN] = (int32_t)ceilf(mean);
+	p_refs[APP_DSP_CROSSING_THRESHOLD] = threshold;
+	p_refs[APP_DSP_CROSSING_SIGMA] = CLAMP((int32_t)ceilf(mean + (float)sigma_factor * stddev),
+					       INT16_MIN, INT16_MAX + 1);
+}
+
+/* Sign bits of the differences, which do not overflow in 32 bits */
+static inline uint32_t below_i16(int32_t x, const int32_t *p_refs)
+{
+	return ((uint32_t)(x - p_refs[0]) >> 31) | (((uint32_t)(x - p_refs[1]) >> 31) << 1) |
+	       (((uint32_t)(x - p_refs[2]) >> 31) << 2) | (((uint32_t)(x - p_refs[3]) >> 31) << 3);
+}
+
+static void crossings_rates_i16(const struct crossings_count *p_count, uint16_t num,
+				uint8_t mask, int16_t *p_rates)
+{
+	for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+		p_rates[k] = (mask & BIT(k)) ?
+			     crossings_get(p_count, k) * CROSSINGS_INT_FACTOR / (num - 1) : 0;
+	}
+}
+
+void app_dsp_crossings_i16_s(const int16_t *p_input, uint16_t num, uint16_t stride,
+			     uint8_t mask, int16_t threshold, nrf_dsp_sigma_factor_t sigma_factor,
+			     int16_t *p_rates)
+{
+	struct crossings_count count = { 0 };
+	int32_t refs[APP_DSP_CROSSING_NUM];
+
+	if (num < 2) {
+		memset(p_rates, 0, APP_DSP_CROSSING_NUM * sizeof(p_rates[0]));
+		return;
+	}
+
+	crossings_refs_i16(p_input, num, stride, mask, threshold, sigma_factor, refs);
+
+	count.prev_below = below_i16(p_input[0], refs);
+	for (uint16_t i = 1; i < num; i++) {
+		crossings_add(&count, below_i16(p_input[i * stride], refs));
+	}
+
+	crossings_rates_i16(&count, num, mask, p_rates);
+}
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+
+/*
+ * Two int16 lanes per 32-bit word. QSUB16 subtracts a reference from both
+ * values at once, saturated so the lane sign bits 15 and 31 stay the signs
+ * of the exact differences. A reference of INT16_MAX + 1 does not fit a
+ * lane, all values are below it.
+ */
+void app_dsp_crossings_i16(const int16_t *p_input, uint16_t num, uint8_t mask,
+			   int16_t threshold, nrf_dsp_sigma_factor_t sigma_factor,
+			   int16_t *p_rates)
+{
+	struct crossings_count count = { 0 };
+	int32_t refs[APP_DSP_CROSSING_NUM];
+	uint32_t refs2[APP_DSP_CROSSING_NUM];
+	uint32_t above_all = 0;
+	uint16_t i = 1;
+
+	if (num < 2) {
+		memset(p_rates, 0, APP_DSP_CROSSING_NUM * sizeof(p_rates[0]));
+		return;
+	}
+
+	crossings_refs_i16(p_input, num, 1, mask, threshold, sigma_factor, refs);
+
+	for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+		uint16_t ref = MIN(refs[k], INT16_MAX);
+
+		refs2[k] = ((uint32_t)ref << 16) | ref;
+		above_all |= (refs[k] > INT16_MAX) << k;
+	}
+
+	count.prev_below = below_i16(p_input[0], refs);
+
+	for (; (i + 2) <= num; i += 2) {
+		uint32_t x2;
+		uint32_t sign_lo = above_all;
+		uint32_t sign_hi = above_all;
+
+		/* Unaligned word loads are allowed on ARMv7-M and ARMv8-M Mainline */
+		memcpy(&x2, &p_input[i], sizeof(x2));
+
+		for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+			uint32_t diff2 = __QSUB16(x2, refs2[k]);
+
+			sign_lo |= ((diff2 >> 15) & 0x1) << k;
+			sign_hi |= (diff2 >> 31) << k;
+		}
+
+		crossings_add(&count, sign_lo);
+		crossings_add(&count, sign_hi);
+	}
+
+	if (i < num) {
+		crossings_add(&count, below_i16(p_input[i], refs));
+	}
+
+	crossings_rates_i16(&count, num, mask, p_rates);
+}
+
+#else
+
+void app_dsp_crossings_i16(const int16_t *p_input, uint16_t num, uint8_t mask,
+			   int16_t threshold, nrf_dsp_sigma_factor_t sigma_factor,
+			   int16_t *p_rates)
+{
+	app_dsp_crossings_i16_s(p_input, num, 1, mask, threshold, sigma_factor, p_rates);
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <string.h>
+#include "app_dsp.h"
+
+#define DECIMATE_PI 3.14159265358979f
+
+void app_dsp_decimator_design_f32(float *p_coeffs, uint16_t num_taps, float cutoff)
+{
+	float center = 0.5f * (num_taps - 1);
+	float sum = 0.0f;
+
+	/* Hamming windowed sinc */
+	for (uint16_t n = 0; n < num_taps; n++) {
+		float t = n - center;
+		float h = 2.0f * cutoff;
+		float window = 1.0f;
+
+		if (t != 0.0f) {
+			h = sinf(2.0f * DECIMATE_PI * cutoff * t) / (DECIMATE_PI * t);
+		}
+
+		if (num_taps > 1) {
+			window = 0.54f - 0.46f * cosf(2.0f * DECIMATE_PI * n / (num_taps - 1));
+		}
+
+		p_coeffs[n] = h * window;
+		sum += p_coeffs[n];
+	}
+
+	/* Unity gain at DC, so offsets like gravity pass unchanged */
+	for (uint16_t n = 0; n < num_taps; n++) {
+		p_coeffs[n] /= sum;
+	}
+}
+
+void app_dsp_decimator_init_f32(struct app_dsp_decimator *p_decimator, const float *p_coeffs,
+				uint16_t num_taps, uint16_t channels, float *p_state)
+{
+	p_decimator->p_coeffs = p_coeffs;
+	p_decimator->p_state = p_state;
+	p_decimator->num_taps = num_taps;
+	p_decimator->channels = channels;
+	p_decimator->head = 0;
+
+	memset(p_state, 0, APP_DSP_DECIMATOR_STATE_LEN(num_taps, channels) * sizeof(float));
+}
+
+void app_dsp_decimator_reset_f32(struct app_dsp_decimator *p_decimator, const float *p_frame)
+{
+	for (uint16_t c = 0; c < p_decimator->channels; c++) {
+		float *p_line = &p_decimator->p_state[2 * p_decimator->num_taps * c];
+
+		for (uint16_t n = 0; n < 2 * p_decimator->num_taps; n++) {
+			p_line[n] = p_frame[c];
+		}
+	}
+
+	p_decimator->head = 0;
+}
+
+void app_dsp_decimator_push_f32(struct app_dsp_decimator *p_decimator, const float *p_frame)
+{
+	uint16_t taps = p_decimator->num_taps;
+
+	/* The newest sample goes in front, mirrored one line length further */
+	p_decimator->head = (p_decimator->head == 0 ? taps : p_decimator->head) - 1;
+
+	for (uint16_t c = 0; c < p_decimator->channels; c++) {
+		float *p_line = &p_decimator->p_state[2 * taps * c];
+
+		p_line[p_decimator->head] = p_frame[c];
+		p_line[p_decimator->head + taps] = p_frame[c];
+	}
+}
+
+void app_dsp_decimator_output_f32(const struct app_dsp_decimator *p_decimator, float *p_output)
+{
+	uint16_t taps = p_decimator->num_taps;
+	const float *p_coeffs = p_decimator->p_coeffs;
+
+	for (uint16_t c = 0; c < p_decimator->channels; c++) {
+		/* Newest first, contiguous thanks to the mirrored copy */
+		const float *p_x = &p_decimator->p_state[2 * taps * c + p_decimator->head];
+		float acc = 0.0f;
+
+		for (uint16_t k = 0; k < taps; k++) {
+			acc += p_coeffs[k] * p_x[k];
+		}
+
+		p_output[c] = acc;
+	}
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include "app_dsp.h"
+
+static void ewma_add(struct app_dsp_ewma *p_ewma, float value)
+{
+	float diff;
+	float step;
+
+	if (!p_ewma->initialized) {
+		p_ewma->mean = value;
+		p_ewma->var = 0.0f;
+		p_ewma->initialized = true;
+		return;
+	}
+
+	/* Incremental update, the variance is taken around the mean before the value */
+	diff = value - p_ewma->mean;
+	step = p_ewma->alpha * diff;
+	p_ewma->mean += step;
+	p_ewma->var = (1.0f - p_ewma->alpha) * (p_ewma->var + diff * step);
+}
+
+void app_dsp_ewma_init_f32(struct app_dsp_ewma *p_ewma, float alpha)
+{
+	p_ewma->mean = 0.0f;
+	p_ewma->var = 0.0f;
+	p_ewma->alpha = alpha;
+	p_ewma->initialized = false;
+}
+
+void app_dsp_ewma_update_f32(struct app_dsp_ewma *p_ewma, const float *p_input, uint16_t num)
+{
+	app_dsp_ewma_update_f32_s(p_ewma, p_input, num, 1);
+}
+
+void app_dsp_ewma_update_f32_s(struct app_dsp_ewma *p_ewma, const float *p_input, uint16_t num,
+			       uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		ewma_add(p_ewma, p_input[i * stride]);
+	}
+}
+
+void app_dsp_ewma_update_i16(struct app_dsp_ewma *p_ewma, const int16_t *p_input, uint16_t num)
+{
+	app_dsp_ewma_update_i16_s(p_ewma, p_input, num, 1);
+}
+
+void app_dsp_ewma_update_i16_s(struct app_dsp_ewma *p_ewma, const int16_t *p_input,
+			       uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		ewma_add(p_ewma, p_input[i * stride]);
+	}
+}
+
+float app_dsp_ewma_mean_f32(const struct app_dsp_ewma *p_ewma)
+{
+	return p_ewma->mean;
+}
+
+float app_dsp_ewma_var_f32(const struct app_dsp_ewma *p_ewma)
+{
+	return p_ewma->var;
+}
+
+float app_dsp_ewma_rms_f32(const struct app_dsp_ewma *p_ewma)
+{
+	return sqrtf(p_ewma->var + p_ewma->mean * p_ewma->mean);
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include "app_dsp.h"
+
+/*
+ * Chaining nrf_dsp_f24_mul() and nrf_dsp_f24_add() normalizes the mantissa
+ * back to 16 bits after every product and every sum, and aligns the
+ * exponents of the two addends each time. The products of two int16 fit in
+ * 32 bits and a block of at most UINT16_MAX of them in 48, so the block
+ * kernels below accumulate exactly in 64 bits and normalize once at the end.
+ * The result is the exact sum truncated to a 16-bit mantissa, never less
+ * accurate than the per-operation chain.
+ */
+
+/* Truncate a 64-bit magnitude to a 16-bit mantissa and a power of two */
+static nrf_dsp_f24_t f24_from_u64(uint64_t value, uint8_t sign)
+{
+	int8_t exp = 0;
+
+	if (value > UINT16_MAX) {
+		exp = (int8_t)(64 - __builtin_clzll(value) - 16);
+		value >>= exp;
+	}
+
+	return nrf_dsp_f24_init((uint16_t)value, exp, sign);
+}
+
+static nrf_dsp_f24_t f24_from_i64(int64_t value)
+{
+	return (value < 0) ? f24_from_u64(-(uint64_t)value, NRF_DSP_F24_SIGNED)
+			   : f24_from_u64((uint64_t)value, NRF_DSP_F24_UNSIGNED);
+}
+
+/* Integer square root of a 32-bit value, one result bit per iteration */
+static uint32_t isqrt_u32(uint32_t value)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > value) {
+		bit >>= 2;
+	}
+
+	while (bit != 0) {
+		if (value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+
+/* Two int16 lanes per 32-bit word, SMLALD adds both products to the 64-bit sum */
+
+nrf_dsp_f24_t app_dsp_f24_dot_i16(const int16_t *p_a, const int16_t *p_b, uint16_t num)
+{
+	int64_t sum = 0;
+	uint16_t i = 0;
+
+	for (; (i + 2) <= num; i += 2) {
+		uint32_t a2;
+		uint32_t b2;
+
+		/* Unaligned word loads are allowed on ARMv7-M and ARMv8-M Mainline */
+		memcpy(&a2, &p_a[i], sizeof(a2));
+		memcpy(&b2, &p_b[i], sizeof(b2));
+
+		sum = (int64_t)__SMLALD(a2, b2, (uint64_t)sum);
+	}
+
+	if (i < num) {
+		sum += (int32_t)p_a[i] * p_b[i];
+	}
+
+	return f24_from_i64(sum);
+}
+
+nrf_dsp_f24_t app_dsp_f24_sum_sq_i16(const int16_t *p_input, uint16_t num)
+{
+	uint64_t sum_sq = 0;
+	uint16_t i = 0;
+
+	for (; (i + 2) <= num; i += 2) {
+		uint32_t x2;
+
+		memcpy(&x2, &p_input[i], sizeof(x2));
+
+		sum_sq = __SMLALD(x2, x2, sum_sq);
+	}
+
+	if (i < num) {
+		int32_t x = p_input[i];
+
+		sum_sq += (uint32_t)(x * x);
+	}
+
+	return f24_from_u64(sum_sq, NRF_DSP_F24_UNSIGNED);
+}
+
+#else
+
+nrf_dsp_f24_t app_dsp_f24_dot_i16(const int16_t *p_a, const int16_t *p_b, uint16_t num)
+{
+	int64_t sum = 0;
+
+	/* Each product fits in 32 bits, only the sum needs 64 */
+	for (uint16_t i = 0; i < num; i++) {
+		sum += (int32_t)p_a[i] * p_b[i];
+	}
+
+	return f24_from_i64(sum);
+}
+
+nrf_dsp_f24_t app_dsp_f24_sum_sq_i16(const int16_t *p_input, uint16_t num)
+{
+	uint64_t sum_sq = 0;
+
+	for (uint16_t i = 0; i < num; i++) {
+		int32_t x = p_input[i];
+
+		sum_sq += (uint32_t)(x * x);
+	}
+
+	return f24_from_u64(sum_sq, NRF_DSP_F24_UNSIGNED);
+}
+
+#endif
+
+void app_dsp_f24_sqrt(const nrf_dsp_f24_t *p_input, uint16_t num, nrf_dsp_f24_t *p_out)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		int8_t exp = nrf_dsp_f24_get_exp(p_input[i]);
+		uint8_t shift;
+
+		if (NRF_DSP_F24_SIGN(p_input[i]) || (p_input[i].man == 0)) {
+			p_out[i] = nrf_dsp_f24_init(0, 0, NRF_DSP_F24_UNSIGNED);
+			continue;
+		}
+
+		/*
+		 * Widen the mantissa to 31 or 32 bits, whichever leaves an even
+		 * exponent. Its root then fills 15 or 16 bits of the mantissa.
+		 */
+		shift = __builtin_clz(p_input[i].man);
+		shift -= (exp - shift) & 1;
+
+		p_out[i] = nrf_dsp_f24_init(
+			(uint16_t)isqrt_u32((uint32_t)p_input[i].man << shift),
+			(int8_t)((exp - shift) / 2), NRF_DSP_F24_UNSIGNED);
+	}
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "app_dsp.h"
+
+void app_dsp_feature_cache_set_window(struct app_dsp_feature_cache *p_cache, uint32_t stream,
+				      uint32_t window)
+{
+	if (p_cache->stream != stream || p_cache->window != window) {
+		p_cache->stream = stream;
+		p_cache->window = window;
+		p_cache->valid = 0;
+	}
+}
+
+uint16_t app_dsp_features_cached_f32(struct app_dsp_feature_cache *p_cache, const float *p_window,
+				     uint16_t num, uint32_t mask, float *p_features)
+{
+	float *p_out = p_features;
+	uint32_t missing;
+
+	mask &= APP_DSP_FEATURES;
+
+	/* Same window id for a window of another size, e.g. from a second model */
+	if (p_cache->num != num) {
+		p_cache->num = num;
+		p_cache->valid = 0;
+	}
+
+	missing = mask & ~p_cache->valid;
+	if (missing) {
+		float computed[NRF_EDGEAI_FEATURE_cnt];
+		const float *p_value = computed;
+
+		/* Features come out in bit order, one value per mask bit */
+		app_dsp_features_f32(p_window, num, missing, computed);
+		for (uint32_t bits = missing; bits; bits &= bits - 1) {
+			p_cache->values[__builtin_ctz(bits)] = *p_value++;
+		}
+
+		p_cache->valid |= missing;
+		p_cache->misses++;
+	} else {
+		p_cache->hits++;
+	}
+
+	for (uint32_t bits = mask; bits; bits &= bits - 1) {
+		*p_out++ = p_cache->values[__builtin_ctz(bits)];
+	}
+
+	return p_out - p_features;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "app_dsp_features_inline.h"
+
+void app_dsp_stats_f32(const float *p_window, uint16_t num, uint32_t mask,
+		       struct app_dsp_stats *p_stats)
+{
+	app_dsp_stats_inline_f32(p_window, num, mask, p_stats);
+}
+
+uint16_t app_dsp_stats_features_f32(const struct app_dsp_stats *p_stats, const float *p_window,
+				    uint16_t num, uint32_t mask, float *p_features)
+{
+	return app_dsp_stats_features_inline_f32(p_stats, p_window, num, mask, p_features);
+}
+
+uint16_t app_dsp_features_f32(const float *p_window, uint16_t num, uint32_t mask,
+			      float *p_features)
+{
+	return app_dsp_features_inline_f32(p_window, num, mask, p_features);
+}
+
+void app_dsp_stats_acc_reset(struct app_dsp_stats_acc *p_acc)
+{
+	p_acc->num = 0;
+}
+
+void app_dsp_stats_acc_add_f32(struct app_dsp_stats_acc *p_acc, const float *p_samples,
+			       uint16_t num, uint32_t mask)
+{
+	struct app_dsp_stats *p_stats = &p_acc->stats;
+	bool diffs = (mask & APP_DSP_DIFF_FEATURES) != 0;
+
+	if (num == 0) {
+		return;
+	}
+
+	if (p_acc->num == 0) {
+		*p_stats = (struct app_dsp_stats){
+			.offset = p_samples[0],
+			.min = p_samples[0],
+			.max = p_samples[0],
+		};
+		p_acc->prev = p_samples[0];
+		p_acc->prev_d1 = 0.0f;
+	}
+
+	for (uint16_t i = 0; i < num; i++) {
+		float x = p_samples[i];
+		float rel = x - p_stats->offset;
+
+		p_stats->sum += rel;
+		p_stats->sum_sq += rel * rel;
+		p_stats->abs_sum += fabsf(x);
+		p_stats->min = fminf(p_stats->min, x);
+		p_stats->max = fmaxf(p_stats->max, x);
+
+		if (diffs && (p_acc->num + i) > 0) {
+			float d1 = p_acc->prev - x;
+
+			p_stats->diff_abs_sum += fabsf(d1);
+			p_stats->diff_sq_sum += d1 * d1;
+
+			if ((p_acc->num + i) > 1) {
+				float d2 = p_acc->prev_d1 - d1;
+
+				p_stats->diff2_sq_sum += d2 * d2;
+			}
+
+			p_acc->prev_d1 = d1;
+		}
+
+		p_acc->prev = x;
+	}
+
+	p_acc->num += num;
+}
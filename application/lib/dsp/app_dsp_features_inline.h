@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _APP_DSP_FEATURES_INLINE_H_
+#define _APP_DSP_FEATURES_INLINE_H_
+
+/*
+ * Always inlined bodies of the fused time-domain feature kernels. With a
+ * compile-time constant mask the compiler drops the branches of features
+ * a model does not use, see app_dsp_features_inline_f32(). The out-of-line
+ * app_dsp_*_f32() functions in app_dsp.h wrap these.
+ */
+
+#include <math.h>
+#include <zephyr/toolchain.h>
+#include "app_dsp.h"
+
+/*
+ * Feature definitions follow the nrf_dsp kernels used by the runtime:
+ * population variance, mean crossing rate over num - 1 transitions,
+ * AMDF at lag 1, and Hjorth parameters from the mean squared first and
+ * second differences.
+ */
+
+/*
+ * Smallest variance, in squared input units, a Hjorth parameter divides by.
+ * A flat window, e.g. a device lying still, gets 0 instead of NaN or Inf.
+ */
+#define APP_DSP_HJORTH_VAR_MIN 1e-6f
+
+/* Features that need the first and second difference sums */
+#define APP_DSP_DIFF_FEATURES								\
+	(NRF_EDGEAI_FEATURE_BIT_AMDF | NRF_EDGEAI_FEATURE_BIT_HJ_MOBILITY |		\
+	 NRF_EDGEAI_FEATURE_BIT_HJ_COMPLEXITY)
+
+/* Features that need a pass over the window relative to its mean */
+#define APP_DSP_MEAN_PASS_FEATURES \
+	(NRF_EDGEAI_FEATURE_BIT_MAD | NRF_EDGEAI_FEATURE_BIT_MCR | NRF_EDGEAI_FEATURE_BIT_PSOM)
+
+/** Inlined app_dsp_stats_f32() */
+static ALWAYS_INLINE void app_dsp_stats_inline_f32(const float *p_window, uint16_t num,
+						   uint32_t mask, struct app_dsp_stats *p_stats)
+{
+	bool diffs = (mask & APP_DSP_DIFF_FEATURES) != 0;
+	float offset = p_window[0];
+	float sum = 0.0f;
+	float sum_sq = 0.0f;
+	float abs_sum = 0.0f;
+	float min = p_window[0];
+	float max = p_window[0];
+	float diff_abs_sum = 0.0f;
+	float diff_sq_sum = 0.0f;
+	float diff2_sq_sum = 0.0f;
+	float prev = p_window[0];
+	float prev_d1 = 0.0f;
+
+	for (uint16_t i = 0; i < num; i++) {
+		float x = p_window[i];
+		float rel = x - offset;
+
+		sum += rel;
+		sum_sq += rel * rel;
+		abs_sum += fabsf(x);
+		min = fminf(min, x);
+		max = fmaxf(max, x);
+
+		if (diffs && i > 0) {
+			float d1 = prev - x;
+
+			diff_abs_sum += fabsf(d1);
+			diff_sq_sum += d1 * d1;
+
+			if (i > 1) {
+				float d2 = prev_d1 - d1;
+
+				diff2_sq_sum += d2 * d2;
+			}
+
+			prev_d1 = d1;
+		}
+
+		prev = x;
+	}
+
+	*p_stats = (struct app_dsp_stats){
+		.offset = offset,
+		.sum = sum,
+		.sum_sq = sum_sq,
+		.abs_sum = abs_sum,
+		.min = min,
+		.max = max,
+		.diff_abs_sum = diff_abs_sum,
+		.diff_sq_sum = diff_sq_sum,
+		.diff2_sq_sum = diff2_sq_sum,
+	};
+}
+
+/** Sums of the pass over the window relative to its mean */
+struct app_dsp_mean_pass {
+	float mad_sum;			/* sum(|x - mean|) */
+	uint16_t crossings;		/* Sign changes of x - mean */
+	uint16_t over_mean;		/* Samples above the mean */
+};
+
+/** Window mean from its statistics */
+static ALWAYS_INLINE float app_dsp_stats_mean_inline_f32(const struct app_dsp_stats *p_stats,
+							 uint16_t num)
+{
+	return p_stats->offset + p_stats->sum / (float)num;
+}
+
+/**
+ * Write the features requested by a mask from the window statistics, p_pass
+ * is only read when the mask requests APP_DSP_MEAN_PASS_FEATURES
+ */
+static ALWAYS_INLINE uint16_t
+app_dsp_stats_emit_inline_f32(const struct app_dsp_stats *p_stats,
+			      const struct app_dsp_mean_pass *p_pass, uint16_t num, uint32_t mask,
+			      float *p_features)
+{
+	float *p_out = p_features;
+	float n = (float)num;
+	float mean_rel = p_stats->sum / n;
+	float mean = p_stats->offset + mean_rel;
+	float var = fmaxf(p_stats->sum_sq / n - mean_rel * mean_rel, 0.0f);
+
+	if (mask & NRF_EDGEAI_FEATURE_BIT_MIN) {
+		*p_out++ = p_stats->min;
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_MAX) {
+		*p_out++ = p_stats->max;
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_RANGE) {
+		*p_out++ = p_stats->max - p_stats->min;
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_MEAN) {
+		*p_out++ = mean;
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_MAD) {
+		*p_out++ = p_pass->mad_sum / n;
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_STD) {
+		*p_out++ = sqrtf(var);
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_RMS) {
+		*p_out++ = sqrtf(var + mean * mean);
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_MCR) {
+		*p_out++ = (float)p_pass->crossings / (n - 1.0f);
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_ABSMEAN) {
+		*p_out++ = p_stats->abs_sum / n;
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_AMDF) {
+		*p_out++ = p_stats->diff_abs_sum / (n - 1.0f);
+	}
+	if (mask & NRF_EDGEAI_FEATURE_BIT_PSOM) {
+		*p_out++ = (float)p_pass->over_mean / n;
+	}
+	if (mask & (NRF_EDGEAI_FEATURE_BIT_HJ_MOBILITY | NRF_EDGEAI_FEATURE_BIT_HJ_COMPLEXITY)) {
+		float var_d1 = p_stats->diff_sq_sum / (n - 1.0f);
+		float var_d2 = p_stats->diff2_sq_sum / (n - 2.0f);
+		bool flat = (var <= APP_DSP_HJORTH_VAR_MIN) || (var_d1 <= APP_DSP_HJORTH_VAR_MIN);
+		float mobility = flat ? 0.0f : sqrtf(var_d1 / var);
+
+		if (mask & NRF_EDGEAI_FEATURE_BIT_HJ_MOBILITY) {
+			*p_out++ = mobility;
+		}
+		if (mask & NRF_EDGEAI_FEATURE_BIT_HJ_COMPLEXITY) {
+			*p_out++ = flat ? 0.0f : sqrtf(fmaxf(var_d2, 0.0f) / var_d1) / mobility;
+		}
+	}
+
+	return p_out - p_features;
+}
+
+/** Inlined app_dsp_stats_features_f32() */
+static ALWAYS_INLINE uint16_t
+app_dsp_stats_features_inline_f32(const struct app_dsp_stats *p_stats, const float *p_window,
+				  uint16_t num, uint32_t mask, float *p_features)
+{
+	struct app_dsp_mean_pass pass = { 0 };
+
+	/* Single fused pass for the features relative to the window mean */
+	if (mask & APP_DSP_MEAN_PASS_FEATURES) {
+		float mean = app_dsp_stats_mean_inline_f32(p_stats, num);
+		bool prev_below = signbit(p_window[0] - mean);
+
+		for (uint16_t i = 0; i < num; i++) {
+			float dev = p_window[i] - mean;
+			bool below = signbit(dev);
+
+			pass.mad_sum += fabsf(dev);
+			pass.over_mean += (dev > 0.0f);
+			pass.crossings += (below != prev_below);
+			prev_below = below;
+		}
+	}
+
+	return app_dsp_stats_emit_inline_f32(p_stats, &pass, num, mask, p_features);
+}
+
+/** Inlined app_dsp_features_f32(), for callers with a constant feature mask */
+static ALWAYS_INLINE uint16_t app_dsp_features_inline_f32(const float *p_window, uint16_t num,
+							  uint32_t mask, float *p_features)
+{
+	struct app_dsp_stats stats;
+
+	app_dsp_stats_inline_f32(p_window, num, mask, &stats);
+
+	return app_dsp_stats_features_inline_f32(&stats, p_window, num, mask, p_features);
+}
+
+#endif /* _APP_DSP_FEATURES_INLINE_H_ */
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "app_dsp_features_inline.h"
+
+/*
+ * The bodies are inlined with a constant number of axes for the common
+ * 3 and 6 axis layouts, so the loops over the axes unroll and the
+ * accumulators of all axes stay in FPU registers.
+ */
+
+static ALWAYS_INLINE void stats_multi(const float *p_window, uint16_t num,
+				      const struct app_dsp_axes *p_axes, uint16_t axes,
+				      uint32_t mask, struct app_dsp_stats *p_stats)
+{
+	bool diffs = (mask & APP_DSP_DIFF_FEATURES) != 0;
+	float offset[APP_DSP_AXES_MAX];
+	float sum[APP_DSP_AXES_MAX] = { 0 };
+	float sum_sq[APP_DSP_AXES_MAX] = { 0 };
+	float abs_sum[APP_DSP_AXES_MAX] = { 0 };
+	float min[APP_DSP_AXES_MAX];
+	float max[APP_DSP_AXES_MAX];
+	float diff_abs_sum[APP_DSP_AXES_MAX] = { 0 };
+	float diff_sq_sum[APP_DSP_AXES_MAX] = { 0 };
+	float diff2_sq_sum[APP_DSP_AXES_MAX] = { 0 };
+	float prev[APP_DSP_AXES_MAX];
+	float prev_d1[APP_DSP_AXES_MAX] = { 0 };
+
+	for (uint16_t a = 0; a < axes; a++) {
+		offset[a] = p_window[a * p_axes->axis_stride];
+		min[a] = offset[a];
+		max[a] = offset[a];
+		prev[a] = offset[a];
+	}
+
+	for (uint16_t i = 0; i < num; i++) {
+		const float *p_sample = p_window + i * p_axes->sample_stride;
+
+		for (uint16_t a = 0; a < axes; a++) {
+			float x = p_sample[a * p_axes->axis_stride];
+			float rel = x - offset[a];
+
+			sum[a] += rel;
+			sum_sq[a] += rel * rel;
+			abs_sum[a] += fabsf(x);
+			min[a] = fminf(min[a], x);
+			max[a] = fmaxf(max[a], x);
+
+			if (diffs && i > 0) {
+				float d1 = prev[a] - x;
+
+				diff_abs_sum[a] += fabsf(d1);
+				diff_sq_sum[a] += d1 * d1;
+
+				if (i > 1) {
+					float d2 = prev_d1[a] - d1;
+
+					diff2_sq_sum[a] += d2 * d2;
+				}
+
+				prev_d1[a] = d1;
+			}
+
+			prev[a] = x;
+		}
+	}
+
+	for (uint16_t a = 0; a < axes; a++) {
+		p_stats[a] = (struct app_dsp_stats){
+			.offset = offset[a],
+			.sum = sum[a],
+			.sum_sq = sum_sq[a],
+			.abs_sum = abs_sum[a],
+			.min = min[a],
+			.max = max[a],
+			.diff_abs_sum = diff_abs_sum[a],
+			.diff_sq_sum = diff_sq_sum[a],
+			.diff2_sq_sum = diff2_sq_sum[a],
+		};
+	}
+}
+
+static ALWAYS_INLINE void mean_pass_multi(const float *p_window, uint16_t num,
+					  const struct app_dsp_axes *p_axes, uint16_t axes,
+					  const struct app_dsp_stats *p_stats,
+					  struct app_dsp_mean_pass *p_pass)
+{
+	float mean[APP_DSP_AXES_MAX];
+	bool prev_below[APP_DSP_AXES_MAX];
+
+	for (uint16_t a = 0; a < axes; a++) {
+		mean[a] = app_dsp_stats_mean_inline_f32(&p_stats[a], num);
+		prev_below[a] = signbit(p_window[a * p_axes->axis_stride] - mean[a]);
+		p_pass[a] = (struct app_dsp_mean_pass){ 0 };
+	}
+
+	for (uint16_t i = 0; i < num; i++) {
+		const float *p_sample = p_window + i * p_axes->sample_stride;
+
+		for (uint16_t a = 0; a < axes; a++) {
+			float dev = p_sample[a * p_axes->axis_stride] - mean[a];
+			bool below = signbit(dev);
+
+			p_pass[a].mad_sum += fabsf(dev);
+			p_pass[a].over_mean += (dev > 0.0f);
+			p_pass[a].crossings += (below != prev_below[a]);
+			prev_below[a] = below;
+		}
+	}
+}
+
+void app_dsp_stats_multi_f32(const float *p_window, uint16_t num,
+			     const struct app_dsp_axes *p_axes, uint32_t mask,
+			     struct app_dsp_stats *p_stats)
+{
+	switch (p_axes->num) {
+	case 3:
+		stats_multi(p_window, num, p_axes, 3, mask, p_stats);
+		break;
+	case 6:
+		stats_multi(p_window, num, p_axes, 6, mask, p_stats);
+		break;
+	default:
+		stats_multi(p_window, num, p_axes, p_axes->num, mask, p_stats);
+		break;
+	}
+}
+
+uint16_t app_dsp_features_multi_f32(const float *p_window, uint16_t num,
+				    const struct app_dsp_axes *p_axes, const uint32_t *p_masks,
+				    float *p_features)
+{
+	struct app_dsp_stats stats[APP_DSP_AXES_MAX];
+	struct app_dsp_mean_pass pass[APP_DSP_AXES_MAX];
+	float *p_out = p_features;
+	uint32_t mask = 0;
+
+	for (uint16_t a = 0; a < p_axes->num; a++) {
+		mask |= p_masks[a];
+	}
+
+	app_dsp_stats_multi_f32(p_window, num, p_axes, mask, stats);
+
+	if (mask & APP_DSP_MEAN_PASS_FEATURES) {
+		switch (p_axes->num) {
+		case 3:
+			mean_pass_multi(p_window, num, p_axes, 3, stats, pass);
+			break;
+		case 6:
+			mean_pass_multi(p_window, num, p_axes, 6, stats, pass);
+			break;
+		default:
+			mean_pass_multi(p_window, num, p_axes, p_axes->num, stats, pass);
+			break;
+		}
+	}
+
+	for (uint16_t a = 0; a < p_axes->num; a++) {
+		p_out += app_dsp_stats_emit_inline_f32(&stats[a], &pass[a], num, p_masks[a], p_out);
+	}
+
+	return p_out - p_features;
+}
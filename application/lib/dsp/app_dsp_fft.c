@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <math.h>
+#include "app_dsp.h"
+
+#define FFT_PI 3.14159265358979f
+
+struct fft_cpx {
+	float r;
+	float i;
+};
+
+static inline struct fft_cpx cpx_mul(struct fft_cpx a, struct fft_cpx b)
+{
+	return (struct fft_cpx){ a.r * b.r - a.i * b.i, a.r * b.i + a.i * b.r };
+}
+
+static inline struct fft_cpx cpx_add(struct fft_cpx a, struct fft_cpx b)
+{
+	return (struct fft_cpx){ a.r + b.r, a.i + b.i };
+}
+
+static inline struct fft_cpx cpx_sub(struct fft_cpx a, struct fft_cpx b)
+{
+	return (struct fft_cpx){ a.r - b.r, a.i - b.i };
+}
+
+static void bfly2(struct fft_cpx *p_out, const struct fft_cpx *p_tw, uint16_t fstride, uint16_t m)
+{
+	struct fft_cpx *p_out2 = p_out + m;
+
+	for (uint16_t k = 0; k < m; k++) {
+		struct fft_cpx t = cpx_mul(p_out2[k], p_tw[k * fstride]);
+
+		p_out2[k] = cpx_sub(p_out[k], t);
+		p_out[k] = cpx_add(p_out[k], t);
+	}
+}
+
+static void bfly3(struct fft_cpx *p_out, const struct fft_cpx *p_tw, uint16_t fstride, uint16_t m)
+{
+	/* Imaginary part of exp(-2 pi i / 3) */
+	const float epi3 = p_tw[fstride * m].i;
+
+	for (uint16_t k = 0; k < m; k++) {
+		struct fft_cpx s1 = cpx_mul(p_out[k + m], p_tw[k * fstride]);
+		struct fft_cpx s2 = cpx_mul(p_out[k + 2 * m], p_tw[2 * k * fstride]);
+		struct fft_cpx s3 = cpx_add(s1, s2);
+		struct fft_cpx s0 = cpx_sub(s1, s2);
+		struct fft_cpx half = { p_out[k].r - 0.5f * s3.r, p_out[k].i - 0.5f * s3.i };
+
+		s0.r *= epi3;
+		s0.i *= epi3;
+		p_out[k] = cpx_add(p_out[k], s3);
+		p_out[k + m] = (struct fft_cpx){ half.r - s0.i, half.i + s0.r };
+		p_out[k + 2 * m] = (struct fft_cpx){ half.r + s0.i, half.i - s0.r };
+	}
+}
+
+static void bfly4(struct fft_cpx *p_out, const struct fft_cpx *p_tw, uint16_t fstride, uint16_t m)
+{
+	for (uint16_t k = 0; k < m; k++) {
+		struct fft_cpx s0 = cpx_mul(p_out[k + m], p_tw[k * fstride]);
+		struct fft_cpx s1 = cpx_mul(p_out[k + 2 * m], p_tw[2 * k * fstride]);
+		struct fft_cpx s2 = cpx_mul(p_out[k + 3 * m], p_tw[3 * k * fstride]);
+		struct fft_cpx s5 = cpx_sub(p_out[k], s1);
+		struct fft_cpx s3 = cpx_add(s0, s2);
+		struct fft_cpx s4 = cpx_sub(s0, s2);
+		struct fft_cpx f0 = cpx_add(p_out[k], s1);
+
+		p_out[k] = cpx_add(f0, s3);
+		p_out[k + 2 * m] = cpx_sub(f0, s3);
+		p_out[k + m] = (struct fft_cpx){ s5.r + s4.i, s5.i - s4.r };
+		p_out[k + 3 * m] = (struct fft_cpx){ s5.r - s4.i, s5.i + s4.r };
+	}
+}
+
+static void bfly5(struct fft_cpx *p_out, const struct fft_cpx *p_tw, uint16_t fstride, uint16_t m)
+{
+	/* exp(-2 pi i / 5) and exp(-4 pi i / 5) */
+	const struct fft_cpx ya = p_tw[fstride * m];
+	const struct fft_cpx yb = p_tw[2 * fstride * m];
+
+	for (uint16_t k = 0; k < m; k++) {
+		struct fft_cpx s0 = p_out[k];
+		struct fft_cpx s1 = cpx_mul(p_out[k + m], p_tw[k * fstride]);
+		struct fft_cpx s2 = cpx_mul(p_out[k + 2 * m], p_tw[2 * k * fstride]);
+		struct fft_cpx s3 = cpx_mul(p_out[k + 3 * m], p_tw[3 * k * fstride]);
+		struct fft_cpx s4 = cpx_mul(p_out[k + 4 * m], p_tw[4 * k * fstride]);
+		struct fft_cpx s7 = cpx_add(s1, s4);
+		struct fft_cpx s10 = cpx_sub(s1, s4);
+		struct fft_cpx s8 = cpx_add(s2, s3);
+		struct fft_cpx s9 = cpx_sub(s2, s3);
+		struct fft_cpx s5 = { s0.r + s7.r * ya.r + s8.r * yb.r,
+				      s0.i + s7.i * ya.r + s8.i * yb.r };
+		struct fft_cpx s6 = { s10.i * ya.i + s9.i * yb.i,
+				      -s10.r * ya.i - s9.r * yb.i };
+		struct fft_cpx s11 = { s0.r + s7.r * yb.r + s8.r * ya.r,
+				       s0.i + s7.i * yb.r + s8.i * ya.r };
+		struct fft_cpx s12 = { -s10.i * yb.i + s9.i * ya.i,
+				       s10.r * yb.i - s9.r * ya.i };
+
+		p_out[k] = (struct fft_cpx){ s0.r + s7.r + s8.r, s0.i + s7.i + s8.i };
+		p_out[k + m] = cpx_sub(s5, s6);
+		p_out[k + 4 * m] = cpx_add(s5, s6);
+		p_out[k + 2 * m] = cpx_add(s11, s12);
+		p_out[k + 3 * m] = cpx_sub(s11, s12);
+	}
+}
+
+/*
+ * Decimation in time, one level per radix stage. The input is read with a
+ * stride of step floats, a step of 1 reads real samples.
+ */
+static void fft_work(const struct app_dsp_rfft_f32 *p_rfft, struct fft_cpx *p_out,
+		     const float *p_in, uint16_t fstride, uint16_t step, const uint16_t *p_factors)
+{
+	const struct fft_cpx *p_tw = (const struct fft_cpx *)p_rfft->p_twiddle;
+	const uint16_t p = p_factors[0];
+	const uint16_t m = p_factors[1];
+	const uint16_t in_stride = fstride * step;
+
+	if (m == 1) {
+		for (uint16_t j = 0; j < p; j++, p_in += in_stride) {
+			p_out[j].r = p_in[0];
+			p_out[j].i = (step == 1) ? 0.0f : p_in[1];
+		}
+	} else {
+		for (uint16_t j = 0; j < p; j++, p_in += in_stride) {
+			fft_work(p_rfft, p_out + j * m, p_in, fstride * p, step, p_factors + 2);
+		}
+	}
+
+	/* A shared table holds the twiddles of a longer FFT, every twiddle_stride-th is ours */
+	switch (p) {
+	case 2:
+		bfly2(p_out, p_tw, fstride * p_rfft->twiddle_stride, m);
+		break;
+	case 3:
+		bfly3(p_out, p_tw, fstride * p_rfft->twiddle_stride, m);
+		break;
+	case 4:
+		bfly4(p_out, p_tw, fstride * p_rfft->twiddle_stride, m);
+		break;
+	default:
+		bfly5(p_out, p_tw, fstride * p_rfft->twiddle_stride, m);
+		break;
+	}
+}
+
+/* Factor the complex FFT length into radix stages */
+static int rfft_plan(struct app_dsp_rfft_f32 *p_rfft, uint16_t len)
+{
+	uint16_t n;
+	uint16_t p = 4;
+
+	if (len < 2) {
+		return -EINVAL;
+	}
+
+	p_rfft->len = len;
+	p_rfft->cfft_len = (len & 1) ? len : len / 2;
+	p_rfft->stages = 0;
+
+	/* Radix 4 stages first, then 2, 3 and 5 */
+	n = p_rfft->cfft_len;
+	while (n > 1) {
+		while (n % p) {
+			p = (p == 4) ? 2 : (p == 2) ? 3 : p + 2;
+			if (p > 5) {
+				return -EINVAL;
+			}
+		}
+		n /= p;
+		p_rfft->factors[2 * p_rfft->stages] = p;
+		p_rfft->factors[2 * p_rfft->stages + 1] = n;
+		p_rfft->stages++;
+	}
+
+	return 0;
+}
+
+int app_dsp_rfft_init_f32(struct app_dsp_rfft_f32 *p_rfft, uint16_t len, float *p_twiddle)
+{
+	int err = rfft_plan(p_rfft, len);
+
+	if (err) {
+		return err;
+	}
+
+	p_rfft->p_twiddle = p_twiddle;
+	p_rfft->twiddle_stride = 1;
+
+	for (uint16_t k = 0; k < p_rfft->cfft_len; k++) {
+		float phase = -2.0f * FFT_PI * k / p_rfft->cfft_len;
+
+		p_twiddle[2 * k] = cosf(phase);
+		p_twiddle[2 * k + 1] = sinf(phase);
+	}
+
+	/* Split twiddles -i * exp(-2 pi i k / len) of even lengths */
+	if (!(len & 1)) {
+		float *p_split = p_twiddle + 2 * p_rfft->cfft_len;
+
+		for (uint16_t k = 0; k < p_rfft->cfft_len; k++) {
+			float phase = -FFT_PI * ((float)k / p_rfft->cfft_len + 0.5f);
+
+			p_split[2 * k] = cosf(phase);
+			p_split[2 * k + 1] = sinf(phase);
+		}
+	}
+
+	return 0;
+}
+
+int app_dsp_rfft_init_shared_f32(struct app_dsp_rfft_f32 *p_rfft, uint16_t len,
+				 const struct app_dsp_rfft_f32 *p_base)
+{
+	int err = rfft_plan(p_rfft, len);
+
+	/* Any length dividing the base length has its twiddles in the base table */
+	if (err || p_base->len % len) {
+		return -EINVAL;
+	}
+
+	p_rfft->p_twiddle = p_base->p_twiddle;
+	p_rfft->twiddle_stride = p_base->twiddle_stride * (p_base->cfft_len / p_rfft->cfft_len);
+
+	return 0;
+}
+
+void app_dsp_rfft_f32(const struct app_dsp_rfft_f32 *p_rfft, const float *p_input,
+		      float *p_output)
+{
+	struct fft_cpx *p_out = (struct fft_cpx *)p_output;
+	const uint16_t half = p_rfft->cfft_len;
+	const uint16_t stride = p_rfft->twiddle_stride;
+	const struct fft_cpx *p_split;
+	struct fft_cpx dc;
+
+	if (p_rfft->len & 1) {
+		fft_work(p_rfft, p_out, p_input, 1, 1, p_rfft->factors);
+		p_out[0].i = 0.0f;
+		return;
+	}
+
+	/* Even samples in the real parts, odd samples in the imaginary parts */
+	if (p_rfft->stages == 0) {
+		p_out[0] = (struct fft_cpx){ p_input[0], p_input[1] };
+	} else {
+		fft_work(p_rfft, p_out, p_input, 1, 2, p_rfft->factors);
+	}
+
+	/* Split the half length spectrum into the spectrum of the real signal, in place */
+	p_split = (const struct fft_cpx *)p_rfft->p_twiddle + half * stride;
+	dc = p_out[0];
+	p_out[0] = (struct fft_cpx){ dc.r + dc.i, 0.0f };
+	p_out[half] = (struct fft_cpx){ dc.r - dc.i, 0.0f };
+
+	for (uint16_t k = 1; k <= half / 2; k++) {
+		struct fft_cpx fpk = p_out[k];
+		struct fft_cpx fpnk = { p_out[half - k].r, -p_out[half - k].i };
+		struct fft_cpx f1k = cpx_add(fpk, fpnk);
+		struct fft_cpx tw = cpx_mul(cpx_sub(fpk, fpnk), p_split[k * stride]);
+
+		p_out[k] = (struct fft_cpx){ 0.5f * (f1k.r + tw.r), 0.5f * (f1k.i + tw.i) };
+		p_out[half - k] = (struct fft_cpx){ 0.5f * (f1k.r - tw.r), 0.5f * (tw.i - f1k.i) };
+	}
+}
+
+void app_dsp_window_load_f32(const float *p_input, uint16_t num, const float *p_window,
+			     uint16_t len, float *p_out)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		p_out[i] = p_input[i] * p_window[i];
+	}
+
+	for (uint16_t i = num; i < len; i++) {
+		p_out[i] = 0.0f;
+	}
+}
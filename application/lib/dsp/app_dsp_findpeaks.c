@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+#endif
+
+struct findpeaks_entry {
+	float value;
+	int16_t index;
+};
+
+/*
+ * The highest peaks found so far in a min-heap, the lowest one at the root
+ * is the one a higher peak replaces. Equal peaks rank by index, the earlier
+ * one is higher, as in the sorted list of nrf_dsp_findpeaks_f32().
+ */
+struct findpeaks_heap {
+	struct findpeaks_entry entries[APP_DSP_FINDPEAKS_MAX];
+	uint16_t num;
+	uint16_t size;
+	int32_t last;
+	uint16_t min_distance;
+};
+
+static inline bool entry_below(const struct findpeaks_entry *p_a,
+			       const struct findpeaks_entry *p_b)
+{
+	return (p_a->value < p_b->value) || (p_a->value == p_b->value && p_a->index > p_b->index);
+}
+
+static void heap_sift_down(struct findpeaks_heap *p_heap, uint16_t pos)
+{
+	struct findpeaks_entry entry = p_heap->entries[pos];
+
+	while (2 * pos + 1 < p_heap->num) {
+		uint16_t child = 2 * pos + 1;
+
+		if (child + 1 < p_heap->num &&
+		    entry_below(&p_heap->entries[child + 1], &p_heap->entries[child])) {
+			child++;
+		}
+
+		if (!entry_below(&p_heap->entries[child], &entry)) {
+			break;
+		}
+
+		p_heap->entries[pos] = p_heap->entries[child];
+		pos = child;
+	}
+
+	p_heap->entries[pos] = entry;
+}
+
+static void heap_init(struct findpeaks_heap *p_heap, uint16_t min_distance, uint16_t peaks_num)
+{
+	p_heap->num = 0;
+	p_heap->size = MIN(peaks_num, APP_DSP_FINDPEAKS_MAX);
+	p_heap->last = -(int32_t)min_distance;
+	p_heap->min_distance = min_distance;
+}
+
+/*
+ * A peak closer than the minimum distance to the previous accepted peak is
+ * dropped, whatever its height. An accepted peak sets the distance
+ * reference even if it is too low to enter the heap.
+ */
+static void heap_offer(struct findpeaks_heap *p_heap, float value, uint16_t index)
+{
+	struct findpeaks_entry entry = {
+		.value = value,
+		.index = index,
+	};
+
+	if ((int32_t)index - p_heap->last < p_heap->min_distance) {
+		return;
+	}
+
+	p_heap->last = index;
+
+	if (p_heap->num < p_heap->size) {
+		uint16_t pos = p_heap->num++;
+
+		while (pos > 0 && entry_below(&entry, &p_heap->entries[(pos - 1) / 2])) {
+			p_heap->entries[pos] = p_heap->entries[(pos - 1) / 2];
+			pos = (pos - 1) / 2;
+		}
+
+		p_heap->entries[pos] = entry;
+	} else if (p_heap->size > 0 && entry_below(&p_heap->entries[0], &entry)) {
+		p_heap->entries[0] = entry;
+		heap_sift_down(p_heap, 0);
+	}
+}
+
+/* Pop the lowest peak into the last free output until the heap is empty */
+static void heap_output(struct findpeaks_heap *p_heap, int16_t *p_peaks, uint16_t peaks_num)
+{
+	for (uint16_t k = p_heap->num; k < peaks_num; k++) {
+		p_peaks[k] = -1;
+	}
+
+	while (p_heap->num > 0) {
+		p_peaks[p_heap->num - 1] = p_heap->entries[0].index;
+		p_heap->entries[0] = p_heap->entries[--p_heap->num];
+		heap_sift_down(p_heap, 0);
+	}
+}
+
+void app_dsp_findpeaks_f32(const float *p_input, uint16_t num, float min_peak_height,
+			   uint16_t min_peak_distance, int16_t *p_peaks, uint16_t peaks_num)
+{
+	struct findpeaks_heap heap;
+
+	heap_init(&heap, min_peak_distance, peaks_num);
+
+	for (uint16_t i = 1; i + 1 < num; i++) {
+		float x = p_input[i];
+
+		if (x > p_input[i - 1] && x > p_input[i + 1] && x >= min_peak_height) {
+			heap_offer(&heap, x, i);
+		}
+	}
+
+	heap_output(&heap, p_peaks, peaks_num);
+}
+
+static inline void findpeaks_at_i16(struct findpeaks_heap *p_heap, const int16_t *p_input,
+				    uint16_t i, int16_t min_peak_height)
+{
+	int16_t x = p_input[i];
+
+	if (x > p_input[i - 1] && x > p_input[i + 1] && x >= min_peak_height) {
+		heap_offer(p_heap, x, i);
+	}
+}
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+
+/*
+ * Two candidates per step. QSUB16 compares both values with their left and
+ * right neighbours and the height at once, saturated so the lane sign bits
+ * 15 and 31 stay the signs of the exact differences. Most spectrum bins are
+ * no peak, their pairs are rejected without a branch per value.
+ */
+void app_dsp_findpeaks_i16(const int16_t *p_input, uint16_t num, int16_t min_peak_height,
+			   uint16_t min_peak_distance, int16_t *p_peaks, uint16_t peaks_num)
+{
+	uint32_t height2 = ((uint32_t)(uint16_t)min_peak_height << 16) | (uint16_t)min_peak_height;
+	struct findpeaks_heap heap;
+	uint16_t i = 1;
+
+	heap_init(&heap, min_peak_distance, peaks_num);
+
+	for (; (i + 2) < num; i += 2) {
+		uint32_t left2;
+		uint32_t x2;
+		uint32_t right2;
+		uint32_t peak2;
+
+		/* Unaligned word loads are allowed on ARMv7-M and ARMv8-M Mainline */
+		memcpy(&left2, &p_input[i - 1], sizeof(left2));
+		memcpy(&x2, &p_input[i], sizeof(x2));
+		memcpy(&right2, &p_input[i + 1], sizeof(right2));
+
+		/* Sign bits set where x is above both neighbours and not below the height */
+		peak2 = __QSUB16(left2, x2) & __QSUB16(right2, x2) & ~__QSUB16(x2, height2);
+		peak2 &= 0x80008000;
+
+		if (peak2 == 0) {
+			continue;
+		}
+
+		if (peak2 & 0x8000) {
+			heap_offer(&heap, (int16_t)x2, i);
+		}
+
+		if (peak2 & 0x80000000) {
+			heap_offer(&heap, (int16_t)(x2 >> 16), i + 1);
+		}
+	}
+
+	if (i + 1 < num) {
+		findpeaks_at_i16(&heap, p_input, i, min_peak_height);
+	}
+
+	heap_output(&heap, p_peaks, peaks_num);
+}
+
+#else
+
+void app_dsp_findpeaks_i16(const int16_t *p_input, uint16_t num, int16_t min_peak_height,
+			   uint16_t min_peak_distance, int16_t *p_peaks, uint16_t peaks_num)
+{
+	struct findpeaks_heap heap;
+
+	heap_init(&heap, min_peak_distance, peaks_num);
+
+	for (uint16_t i = 1; i + 1 < num; i++) {
+		findpeaks_at_i16(&heap, p_input, i, min_peak_height);
+	}
+
+	heap_output(&heap, p_peaks, peaks_num);
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/sys/util.h>
+#include <math.h>
+#include <string.h>
+#include "app_dsp.h"
+
+/* Bin of a value in units of the resolution */
+static uint16_t histogram_bin(const struct app_dsp_histogram *p_histogram, uint32_t units)
+{
+	uint8_t sub_bits = p_histogram->sub_bits;
+	uint32_t sub = 1U << sub_bits;
+	uint32_t bin;
+
+	if (units < sub) {
+		bin = units;
+	} else {
+		/* Octave and the sub-bin given by the bits below its leading one */
+		uint8_t shift = 31 - __builtin_clz(units) - sub_bits;
+
+		bin = sub + shift * sub + ((units >> shift) - sub);
+	}
+
+	return MIN(bin, p_histogram->bins_num - 1U);
+}
+
+static void histogram_add(struct app_dsp_histogram *p_histogram, uint32_t units)
+{
+	p_histogram->p_counts[histogram_bin(p_histogram, units)]++;
+	p_histogram->count++;
+}
+
+/* Value in units of the resolution, clamped to the range of the bins */
+static uint32_t histogram_units_f32(const struct app_dsp_histogram *p_histogram, float value)
+{
+	float units = value / p_histogram->resolution;
+
+	if (!(units > 0.0f)) {
+		return 0;
+	}
+
+	return units >= (float)UINT32_MAX ? UINT32_MAX : (uint32_t)units;
+}
+
+void app_dsp_histogram_reset(struct app_dsp_histogram *p_histogram)
+{
+	memset(p_histogram->p_counts, 0, p_histogram->bins_num * sizeof(p_histogram->p_counts[0]));
+	p_histogram->count = 0;
+}
+
+void app_dsp_histogram_update_f32(struct app_dsp_histogram *p_histogram, const float *p_input,
+				  uint16_t num)
+{
+	app_dsp_histogram_update_f32_s(p_histogram, p_input, num, 1);
+}
+
+void app_dsp_histogram_update_f32_s(struct app_dsp_histogram *p_histogram, const float *p_input,
+				    uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		histogram_add(p_histogram, histogram_units_f32(p_histogram, p_input[i * stride]));
+	}
+}
+
+void app_dsp_histogram_update_i16(struct app_dsp_histogram *p_histogram, const int16_t *p_input,
+				  uint16_t num)
+{
+	app_dsp_histogram_update_i16_s(p_histogram, p_input, num, 1);
+}
+
+void app_dsp_histogram_update_i16_s(struct app_dsp_histogram *p_histogram,
+				    const int16_t *p_input, uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		int16_t value = p_input[i * stride];
+
+		histogram_add(p_histogram, value > 0 ? value : 0);
+	}
+}
+
+float app_dsp_histogram_quantile_f32(const struct app_dsp_histogram *p_histogram, float quantile)
+{
+	uint32_t sub = 1U << p_histogram->sub_bits;
+	uint32_t target;
+	uint32_t cumulative = 0;
+	uint32_t low;
+	uint32_t width;
+	uint16_t bin;
+
+	if (p_histogram->count == 0) {
+		return 0.0f;
+	}
+
+	/* Rank of the quantile, counted from 1 */
+	target = MAX((uint32_t)ceilf(quantile * p_histogram->count), 1U);
+
+	for (bin = 0; bin < p_histogram->bins_num - 1U; bin++) {
+		cumulative += p_histogram->p_counts[bin];
+		if (cumulative >= target) {
+			break;
+		}
+	}
+
+	if (bin < sub) {
+		low = bin;
+		width = 1;
+	} else {
+		uint32_t shift = (bin - sub) / sub;
+
+		low = (sub + (bin - sub) % sub) << shift;
+		width = 1U << shift;
+	}
+
+	return (low + (width - 1) * 0.5f) * p_histogram->resolution;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+#endif
+
+/*
+ * The sum of squares is never negative, so sqrtf() compiles to a single
+ * VSQRT.F32 on cores with an FPU and never takes the errno slow path.
+ */
+
+void app_dsp_magnitude_f32(const float *p_xyz, uint16_t stride, uint16_t num,
+			   float scale, float *p_out)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		float x = p_xyz[0];
+		float y = p_xyz[1];
+		float z = p_xyz[2];
+
+		p_out[i] = sqrtf(x * x + y * y + z * z) * scale;
+		p_xyz += stride;
+	}
+}
+
+/* x^2 + y^2 + z^2, at most 3 * 2^30, fits in 32 bits unsigned */
+static inline uint32_t sum_sq_i16(const int16_t *p_xyz)
+{
+	int32_t z = p_xyz[2];
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	uint32_t xy;
+
+	/*
+	 * X and Y share a word, SMLAD squares both lanes and adds them to z^2. The
+	 * signed accumulator wraps above 2^31, the bits are the unsigned sum.
+	 */
+	memcpy(&xy, p_xyz, sizeof(xy));
+	return __SMLAD(xy, xy, (uint32_t)(z * z));
+#else
+	int32_t x = p_xyz[0];
+	int32_t y = p_xyz[1];
+
+	return (uint32_t)(x * x) + (uint32_t)(y * y) + (uint32_t)(z * z);
+#endif
+}
+
+void app_dsp_magnitude_i16(const int16_t *p_xyz, uint16_t stride, uint16_t num,
+			   float scale, float *p_out)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		p_out[i] = sqrtf((float)sum_sq_i16(p_xyz)) * scale;
+		p_xyz += stride;
+	}
+}
+
+/* Bitwise integer square root, floor(sqrt(value)) */
+static uint32_t isqrt_u32(uint32_t value)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > value) {
+		bit >>= 2;
+	}
+
+	while (bit != 0) {
+		if (value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+void app_dsp_magnitude_i16_q16(const int16_t *p_xyz, uint16_t stride, uint16_t num,
+			       uint32_t scale_q16, int16_t *p_out)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		uint32_t root = isqrt_u32(sum_sq_i16(p_xyz));
+		/* Root is at most 56756, the product fits in 64 bits for any scale */
+		uint64_t scaled = ((uint64_t)root * scale_q16 + 0x8000) >> 16;
+
+		p_out[i] = (int16_t)MIN(scaled, INT16_MAX);
+		p_xyz += stride;
+	}
+}
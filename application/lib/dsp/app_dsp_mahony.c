@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <string.h>
+#include "app_dsp.h"
+
+static void mahony_normalize(float *p_q)
+{
+	float norm = sqrtf(p_q[0] * p_q[0] + p_q[1] * p_q[1] + p_q[2] * p_q[2] + p_q[3] * p_q[3]);
+
+	for (int i = 0; i < 4; i++) {
+		p_q[i] /= norm;
+	}
+}
+
+/* Rotation with no yaw whose gravity direction is the unit vector p_a */
+static void mahony_align(struct app_dsp_mahony *p_mahony, const float *p_a)
+{
+	/* Shortest rotation taking (0, 0, 1) to p_a, conjugated to map sensor to world */
+	float w = 1.0f + p_a[2];
+
+	if (w < 1e-6f) {
+		/* Upside down, rotate half a turn about x */
+		p_mahony->q[0] = 0.0f;
+		p_mahony->q[1] = 1.0f;
+		p_mahony->q[2] = 0.0f;
+		p_mahony->q[3] = 0.0f;
+		return;
+	}
+
+	p_mahony->q[0] = w;
+	p_mahony->q[1] = p_a[1];
+	p_mahony->q[2] = -p_a[0];
+	p_mahony->q[3] = 0.0f;
+	mahony_normalize(p_mahony->q);
+}
+
+void app_dsp_mahony_init_f32(struct app_dsp_mahony *p_mahony, float kp, float ki)
+{
+	memset(p_mahony, 0, sizeof(*p_mahony));
+	p_mahony->q[0] = 1.0f;
+	p_mahony->kp = kp;
+	p_mahony->ki = ki;
+}
+
+void app_dsp_mahony_gravity_f32(const struct app_dsp_mahony *p_mahony, float *p_gravity)
+{
+	const float *q = p_mahony->q;
+
+	/* Third row of the world to sensor rotation matrix */
+	p_gravity[0] = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+	p_gravity[1] = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+	p_gravity[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+}
+
+void app_dsp_mahony_update_f32(struct app_dsp_mahony *p_mahony, const float *p_accel,
+			       const float *p_gyro, float dt)
+{
+	float norm = sqrtf(p_accel[0] * p_accel[0] + p_accel[1] * p_accel[1] +
+			   p_accel[2] * p_accel[2]);
+	float g[3] = { p_gyro[0], p_gyro[1], p_gyro[2] };
+	float *q = p_mahony->q;
+	float dq[4];
+
+	if (norm > 0.0f) {
+		float a[3] = { p_accel[0] / norm, p_accel[1] / norm, p_accel[2] / norm };
+		float v[3];
+		float e[3];
+
+		if (!p_mahony->initialized) {
+			mahony_align(p_mahony, a);
+			p_mahony->initialized = true;
+			return;
+		}
+
+		/* Error between measured and estimated gravity direction */
+		app_dsp_mahony_gravity_f32(p_mahony, v);
+		e[0] = a[1] * v[2] - a[2] * v[1];
+		e[1] = a[2] * v[0] - a[0] * v[2];
+		e[2] = a[0] * v[1] - a[1] * v[0];
+
+		for (int i = 0; i < 3; i++) {
+			if (p_mahony->ki > 0.0f) {
+				p_mahony->integral[i] += p_mahony->ki * e[i] * dt;
+			}
+
+			g[i] += p_mahony->kp * e[i] + p_mahony->integral[i];
+		}
+	}
+
+	/* q += 0.5 * q * (0, g) * dt */
+	dq[0] = -q[1] * g[0] - q[2] * g[1] - q[3] * g[2];
+	dq[1] = q[0] * g[0] + q[2] * g[2] - q[3] * g[1];
+	dq[2] = q[0] * g[1] - q[1] * g[2] + q[3] * g[0];
+	dq[3] = q[0] * g[2] + q[1] * g[1] - q[2] * g[0];
+
+	for (int i = 0; i < 4; i++) {
+		q[i] += 0.5f * dt * dq[i];
+	}
+
+	mahony_normalize(q);
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+/*
+ * The ring drives nrf_dsp_melspectr_make_f32() through behaviour its header
+ * does not document, as seen in the runtime version shipped in
+ * external/edge-ai:
+ * - the frame is written as freq_bands consecutive floats at
+ *   p_melspectrum + current_fill * freq_bands, and no other frame is read or
+ *   written, so the mirrored copies survive;
+ * - current_fill is only advanced, then compared with time_bands to report
+ *   a full spectrogram. Setting it before each call selects the ring slot
+ *   and the runtime never shifts the buffer itself.
+ * The runtime is a prebuilt library, so its context layout is pinned below.
+ * Check both points again when the runtime is updated and these trip.
+ */
+BUILD_ASSERT(offsetof(nrf_dsp_melspectr_ctx_f32_t, p_melspectrum) == 0,
+	     "Mel-spectrogram context layout changed, check the ring against the runtime");
+BUILD_ASSERT(sizeof(((nrf_dsp_melspectr_ctx_f32_t *)0)->p_melspectrum) == sizeof(flt32_t *),
+	     "Mel-spectrogram context layout changed, check the ring against the runtime");
+BUILD_ASSERT(offsetof(nrf_dsp_melspectr_ctx_f32_t, current_fill) ==
+		     offsetof(nrf_dsp_melspectr_ctx_f32_t, sample_rate) + sizeof(uint16_t),
+	     "Mel-spectrogram context layout changed, check the ring against the runtime");
+BUILD_ASSERT(offsetof(nrf_dsp_melspectr_ctx_f32_t, freq_bands) ==
+		     offsetof(nrf_dsp_melspectr_ctx_f32_t, current_fill) + sizeof(uint16_t),
+	     "Mel-spectrogram context layout changed, check the ring against the runtime");
+BUILD_ASSERT(offsetof(nrf_dsp_melspectr_ctx_f32_t, time_bands) ==
+		     offsetof(nrf_dsp_melspectr_ctx_f32_t, freq_bands) + sizeof(uint16_t),
+	     "Mel-spectrogram context layout changed, check the ring against the runtime");
+BUILD_ASSERT(sizeof(nrf_dsp_melspectr_ctx_f32_t) ==
+		     ROUND_UP(offsetof(nrf_dsp_melspectr_ctx_f32_t, time_bands) + sizeof(uint16_t),
+			      __alignof__(nrf_dsp_melspectr_ctx_f32_t)),
+	     "Mel-spectrogram context layout changed, check the ring against the runtime");
+/* The ring indices are stored in current_fill and compared with time_bands */
+BUILD_ASSERT(sizeof(((nrf_dsp_melspectr_ctx_f32_t *)0)->current_fill) ==
+		     sizeof(((struct app_dsp_melspectr_ring *)0)->head),
+	     "Ring slot does not fit the runtime fill position");
+
+void app_dsp_melspectr_ring_init(struct app_dsp_melspectr_ring *p_ring,
+				 nrf_dsp_melspectr_ctx_f32_t *p_ctx)
+{
+	p_ring->p_ctx = p_ctx;
+	p_ring->head = 0;
+	p_ring->fill = 0;
+}
+
+bool app_dsp_melspectr_ring_push_f32(struct app_dsp_melspectr_ring *p_ring,
+				     flt32_t *p_audio_input)
+{
+	nrf_dsp_melspectr_ctx_f32_t *p_ctx = p_ring->p_ctx;
+	const uint16_t bands = p_ctx->freq_bands;
+	flt32_t *p_frame = &p_ctx->p_melspectrum[p_ring->head * bands];
+
+	/* The runtime writes the frame at its fill position, see above */
+	p_ctx->current_fill = p_ring->head;
+	(void)nrf_dsp_melspectr_make_f32(p_ctx, p_audio_input);
+	memcpy(p_frame + p_ctx->time_bands * bands, p_frame, bands * sizeof(flt32_t));
+
+	if (++p_ring->head == p_ctx->time_bands) {
+		p_ring->head = 0;
+	}
+
+	if (p_ring->fill < p_ctx->time_bands) {
+		p_ring->fill++;
+	}
+
+	return p_ring->fill == p_ctx->time_bands;
+}
+
+void app_dsp_melspectr_ring_drop(struct app_dsp_melspectr_ring *p_ring, uint16_t num)
+{
+	p_ring->fill = (num < p_ring->fill) ? (p_ring->fill - num) : 0;
+}
+
+const flt32_t *app_dsp_melspectr_ring_view_f32(const struct app_dsp_melspectr_ring *p_ring)
+{
+	const nrf_dsp_melspectr_ctx_f32_t *p_ctx = p_ring->p_ctx;
+	uint16_t oldest = p_ring->head + p_ctx->time_bands - p_ring->fill;
+
+	if (oldest >= p_ctx->time_bands) {
+		oldest -= p_ctx->time_bands;
+	}
+
+	return &p_ctx->p_melspectrum[oldest * p_ctx->freq_bands];
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include "app_dsp.h"
+
+static void moments_add(struct app_dsp_moments *p_moments, float value)
+{
+	float n1 = p_moments->count;
+	float n = n1 + 1.0f;
+	float delta = value - p_moments->mean;
+	float delta_n = delta / n;
+	float delta_n2 = delta_n * delta_n;
+	float term = delta * delta_n * n1;
+
+	/* Higher moments first, they use the lower moments before the value */
+	p_moments->mean += delta_n;
+	p_moments->m4 += term * delta_n2 * (n * n - 3.0f * n + 3.0f) +
+			 6.0f * delta_n2 * p_moments->m2 - 4.0f * delta_n * p_moments->m3;
+	p_moments->m3 += term * delta_n * (n - 2.0f) - 3.0f * delta_n * p_moments->m2;
+	p_moments->m2 += term;
+	p_moments->count++;
+}
+
+void app_dsp_moments_reset(struct app_dsp_moments *p_moments)
+{
+	p_moments->count = 0;
+	p_moments->mean = 0.0f;
+	p_moments->m2 = 0.0f;
+	p_moments->m3 = 0.0f;
+	p_moments->m4 = 0.0f;
+}
+
+void app_dsp_moments_update_f32(struct app_dsp_moments *p_moments, const float *p_input,
+				uint16_t num)
+{
+	app_dsp_moments_update_f32_s(p_moments, p_input, num, 1);
+}
+
+void app_dsp_moments_update_f32_s(struct app_dsp_moments *p_moments, const float *p_input,
+				  uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		moments_add(p_moments, p_input[i * stride]);
+	}
+}
+
+void app_dsp_moments_update_i16(struct app_dsp_moments *p_moments, const int16_t *p_input,
+				uint16_t num)
+{
+	app_dsp_moments_update_i16_s(p_moments, p_input, num, 1);
+}
+
+void app_dsp_moments_update_i16_s(struct app_dsp_moments *p_moments, const int16_t *p_input,
+				  uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		moments_add(p_moments, p_input[i * stride]);
+	}
+}
+
+void app_dsp_moments_merge(struct app_dsp_moments *p_moments,
+			   const struct app_dsp_moments *p_other)
+{
+	float na = p_moments->count;
+	float nb = p_other->count;
+	float n = na + nb;
+	float delta;
+	float delta2;
+	float m2;
+	float m3;
+
+	if (p_other->count == 0) {
+		return;
+	}
+
+	if (p_moments->count == 0) {
+		*p_moments = *p_other;
+		return;
+	}
+
+	/* Pairwise combination of the central moment sums */
+	delta = p_other->mean - p_moments->mean;
+	delta2 = delta * delta;
+	m2 = p_moments->m2 + p_other->m2 + delta2 * na * nb / n;
+	m3 = p_moments->m3 + p_other->m3 + delta2 * delta * na * nb * (na - nb) / (n * n) +
+	     3.0f * delta * (na * p_other->m2 - nb * p_moments->m2) / n;
+
+	p_moments->m4 += p_other->m4 +
+			 delta2 * delta2 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n) +
+			 6.0f * delta2 * (na * na * p_other->m2 + nb * nb * p_moments->m2) /
+			 (n * n) + 4.0f * delta * (na * p_other->m3 - nb * p_moments->m3) / n;
+	p_moments->m3 = m3;
+	p_moments->m2 = m2;
+	p_moments->mean += delta * nb / n;
+	p_moments->count += p_other->count;
+}
+
+float app_dsp_moments_mean_f32(const struct app_dsp_moments *p_moments)
+{
+	return p_moments->mean;
+}
+
+float app_dsp_moments_var_f32(const struct app_dsp_moments *p_moments)
+{
+	return (p_moments->count > 0) ? p_moments->m2 / p_moments->count : 0.0f;
+}
+
+float app_dsp_moments_skew_f32(const struct app_dsp_moments *p_moments)
+{
+	if (p_moments->m2 <= 0.0f) {
+		return 0.0f;
+	}
+
+	return sqrtf(p_moments->count) * p_moments->m3 / (p_moments->m2 * sqrtf(p_moments->m2));
+}
+
+float app_dsp_moments_kur_f32(const struct app_dsp_moments *p_moments)
+{
+	if (p_moments->m2 <= 0.0f) {
+		return 0.0f;
+	}
+
+	return p_moments->count * p_moments->m4 / (p_moments->m2 * p_moments->m2) - 3.0f;
+}
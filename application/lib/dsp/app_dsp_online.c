@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include "app_dsp.h"
+
+static void deque_reset(struct app_dsp_online_deque *p_deque)
+{
+	p_deque->head = 0;
+	p_deque->num = 0;
+}
+
+static struct app_dsp_online_entry *deque_at(const struct app_dsp_online *p_online,
+					     const struct app_dsp_online_deque *p_deque,
+					     uint16_t index)
+{
+	uint16_t pos = p_deque->head + index;
+
+	if (pos >= p_online->size) {
+		pos -= p_online->size;
+	}
+
+	return &p_deque->p_entries[pos];
+}
+
+/* Drop entries that compare true against the new value, then append it */
+static void deque_push(const struct app_dsp_online *p_online, struct app_dsp_online_deque *p_deque,
+		       float value, bool is_max)
+{
+	while (p_deque->num > 0) {
+		float back = deque_at(p_online, p_deque, p_deque->num - 1)->value;
+
+		if (is_max ? (back > value) : (back < value)) {
+			break;
+		}
+
+		p_deque->num--;
+	}
+
+	*deque_at(p_online, p_deque, p_deque->num) = (struct app_dsp_online_entry){
+		.value = value,
+		.seq = p_online->seq,
+	};
+	p_deque->num++;
+}
+
+/* Drop entries that leave the window when the next sample is added */
+static void deque_expire(const struct app_dsp_online *p_online, struct app_dsp_online_deque *p_deque)
+{
+	uint32_t first_seq = p_online->seq + 1 - p_online->size;
+
+	while (p_deque->num > 0 &&
+	       (int32_t)(deque_at(p_online, p_deque, 0)->seq - first_seq) < 0) {
+		p_deque->head++;
+		if (p_deque->head >= p_online->size) {
+			p_deque->head = 0;
+		}
+		p_deque->num--;
+	}
+}
+
+static void online_push(struct app_dsp_online *p_online, float value)
+{
+	deque_expire(p_online, &p_online->min);
+	deque_expire(p_online, &p_online->max);
+	deque_push(p_online, &p_online->min, value, false);
+	deque_push(p_online, &p_online->max, value, true);
+	p_online->seq++;
+}
+
+static void online_add(struct app_dsp_online *p_online, float value)
+{
+	float rel = value - p_online->stats.offset;
+
+	p_online->stats.sum += rel;
+	p_online->stats.sum_sq += rel * rel;
+	p_online->stats.abs_sum += fabsf(value);
+
+	online_push(p_online, value);
+}
+
+static void online_remove(struct app_dsp_online *p_online, float value)
+{
+	float rel = value - p_online->stats.offset;
+
+	p_online->stats.sum -= rel;
+	p_online->stats.sum_sq -= rel * rel;
+	p_online->stats.abs_sum -= fabsf(value);
+}
+
+static void online_add_diffs(struct app_dsp_online *p_online, float d1, float d2)
+{
+	p_online->stats.diff_abs_sum += fabsf(d1);
+	p_online->stats.diff_sq_sum += d1 * d1;
+	p_online->stats.diff2_sq_sum += d2 * d2;
+}
+
+static void online_remove_diffs(struct app_dsp_online *p_online, float d1, float d2)
+{
+	p_online->stats.diff_abs_sum -= fabsf(d1);
+	p_online->stats.diff_sq_sum -= d1 * d1;
+	p_online->stats.diff2_sq_sum -= d2 * d2;
+}
+
+static void online_resync(struct app_dsp_online *p_online, const float *p_window)
+{
+	app_dsp_stats_f32(p_window, p_online->size, APP_DSP_FEATURES, &p_online->stats);
+
+	deque_reset(&p_online->min);
+	deque_reset(&p_online->max);
+
+	for (uint16_t i = 0; i < p_online->size; i++) {
+		online_push(p_online, p_window[i]);
+	}
+
+	p_online->replaced = 0;
+	p_online->valid = true;
+}
+
+/* Sample at index i of the previous window */
+static float online_previous(const struct app_dsp_online *p_online, const float *p_window,
+			     uint16_t i)
+{
+	return (i < p_online->shift) ? p_online->p_leaving[i] : p_window[i - p_online->shift];
+}
+
+static void online_slide(struct app_dsp_online *p_online, const float *p_window)
+{
+	uint16_t num = p_online->size;
+	uint16_t shift = p_online->shift;
+
+	/* Samples, differences and second differences that left the window */
+	for (uint16_t i = 0; i < shift; i++) {
+		float x0 = online_previous(p_online, p_window, i);
+		float x1 = online_previous(p_online, p_window, i + 1);
+		float x2 = online_previous(p_online, p_window, i + 2);
+
+		online_remove(p_online, x0);
+		online_remove_diffs(p_online, x0 - x1, x0 - 2.0f * x1 + x2);
+	}
+
+	/* Samples, differences and second differences that entered the window */
+	for (uint16_t i = num - shift; i < num; i++) {
+		float d1 = p_window[i - 1] - p_window[i];
+		float d2 = p_window[i - 2] - 2.0f * p_window[i - 1] + p_window[i];
+
+		online_add(p_online, p_window[i]);
+		online_add_diffs(p_online, d1, d2);
+	}
+
+	p_online->replaced += shift;
+}
+
+uint16_t app_dsp_online_features_f32(struct app_dsp_online *p_online, const float *p_window,
+				     uint16_t num, uint32_t mask, float *p_features)
+{
+	/* Incremental second differences need two samples kept across a slide */
+	bool can_slide = (p_online->shift + 2) <= p_online->size;
+
+	if (num != p_online->size) {
+		return 0;
+	}
+
+	if (can_slide && p_online->valid && p_window[0] == p_online->anchor &&
+	    (p_online->replaced + p_online->shift) < p_online->size) {
+		online_slide(p_online, p_window);
+	} else {
+		online_resync(p_online, p_window);
+	}
+
+	if (can_slide) {
+		for (uint16_t i = 0; i < p_online->shift; i++) {
+			p_online->p_leaving[i] = p_window[i];
+		}
+		p_online->anchor = p_window[p_online->shift];
+	}
+
+	p_online->stats.min = deque_at(p_online, &p_online->min, 0)->value;
+	p_online->stats.max = deque_at(p_online, &p_online->max, 0)->value;
+
+	return app_dsp_stats_features_f32(&p_online->stats, p_window, num, mask, p_features);
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "app_dsp.h"
+
+static struct app_dsp_online_entry *deque_at(const struct app_dsp_pk2pk *p_pk2pk,
+					     const struct app_dsp_online_deque *p_deque,
+					     uint16_t index)
+{
+	uint16_t pos = p_deque->head + index;
+
+	if (pos >= p_pk2pk->size) {
+		pos -= p_pk2pk->size;
+	}
+
+	return &p_deque->p_entries[pos];
+}
+
+/* Drop the front entry if it left the outer window with filtered value seq */
+static void deque_expire(const struct app_dsp_pk2pk *p_pk2pk, struct app_dsp_online_deque *p_deque,
+			 uint32_t seq)
+{
+	if (p_deque->num > 0 && seq - deque_at(p_pk2pk, p_deque, 0)->seq >= p_pk2pk->size) {
+		p_deque->head = (p_deque->head + 1 < p_pk2pk->size) ? p_deque->head + 1 : 0;
+		p_deque->num--;
+	}
+}
+
+/* Drop entries that can no longer be the extreme, then append the value */
+static void deque_push(const struct app_dsp_pk2pk *p_pk2pk, struct app_dsp_online_deque *p_deque,
+		       float value, uint32_t seq, bool is_max)
+{
+	deque_expire(p_pk2pk, p_deque, seq);
+
+	while (p_deque->num > 0) {
+		float back = deque_at(p_pk2pk, p_deque, p_deque->num - 1)->value;
+
+		if (is_max ? (back > value) : (back < value)) {
+			break;
+		}
+
+		p_deque->num--;
+	}
+
+	*deque_at(p_pk2pk, p_deque, p_deque->num) = (struct app_dsp_online_entry){
+		.value = value,
+		.seq = seq,
+	};
+	p_deque->num++;
+}
+
+static void pk2pk_add(struct app_dsp_pk2pk *p_pk2pk, float value)
+{
+	uint16_t window_size = p_pk2pk->window_size;
+	uint32_t seq;
+	float lf;
+	float hf;
+
+	if (p_pk2pk->added >= window_size) {
+		p_pk2pk->sum -= p_pk2pk->p_ring[p_pk2pk->ring_pos];
+	}
+	p_pk2pk->sum += value;
+	p_pk2pk->p_ring[p_pk2pk->ring_pos] = value;
+	p_pk2pk->added++;
+
+	if (++p_pk2pk->ring_pos == window_size) {
+		p_pk2pk->ring_pos = 0;
+
+		/* The ring holds the moving average window, resum it to bound rounding drift */
+		p_pk2pk->sum = 0.0f;
+		for (uint16_t i = 0; i < window_size; i++) {
+			p_pk2pk->sum += p_pk2pk->p_ring[i];
+		}
+	}
+
+	if (p_pk2pk->added < window_size) {
+		return;
+	}
+
+	/* The oldest input is at ring_pos, the high-pass output is taken at the middle */
+	seq = p_pk2pk->added - window_size;
+	lf = p_pk2pk->sum / window_size;
+	hf = p_pk2pk->p_ring[(p_pk2pk->ring_pos + window_size / 2) % window_size] - lf;
+
+	deque_push(p_pk2pk, &p_pk2pk->lf_min, lf, seq, false);
+	deque_push(p_pk2pk, &p_pk2pk->lf_max, lf, seq, true);
+	deque_push(p_pk2pk, &p_pk2pk->hf_min, hf, seq, false);
+	deque_push(p_pk2pk, &p_pk2pk->hf_max, hf, seq, true);
+}
+
+void app_dsp_pk2pk_reset(struct app_dsp_pk2pk *p_pk2pk)
+{
+	p_pk2pk->ring_pos = 0;
+	p_pk2pk->added = 0;
+	p_pk2pk->sum = 0.0f;
+	p_pk2pk->lf_min.head = 0;
+	p_pk2pk->lf_min.num = 0;
+	p_pk2pk->lf_max.head = 0;
+	p_pk2pk->lf_max.num = 0;
+	p_pk2pk->hf_min.head = 0;
+	p_pk2pk->hf_min.num = 0;
+	p_pk2pk->hf_max.head = 0;
+	p_pk2pk->hf_max.num = 0;
+}
+
+void app_dsp_pk2pk_update_f32(struct app_dsp_pk2pk *p_pk2pk, const float *p_input, uint16_t num)
+{
+	app_dsp_pk2pk_update_f32_s(p_pk2pk, p_input, num, 1);
+}
+
+void app_dsp_pk2pk_update_f32_s(struct app_dsp_pk2pk *p_pk2pk, const float *p_input,
+				uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		pk2pk_add(p_pk2pk, p_input[i * stride]);
+	}
+}
+
+void app_dsp_pk2pk_update_i16(struct app_dsp_pk2pk *p_pk2pk, const int16_t *p_input,
+			      uint16_t num)
+{
+	app_dsp_pk2pk_update_i16_s(p_pk2pk, p_input, num, 1);
+}
+
+void app_dsp_pk2pk_update_i16_s(struct app_dsp_pk2pk *p_pk2pk, const int16_t *p_input,
+				uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		pk2pk_add(p_pk2pk, p_input[i * stride]);
+	}
+}
+
+bool app_dsp_pk2pk_get_f32(const struct app_dsp_pk2pk *p_pk2pk, float *p_pk2pk_lf,
+			   float *p_pk2pk_hf)
+{
+	if (p_pk2pk->added < (uint32_t)p_pk2pk->size + p_pk2pk->window_size - 1) {
+		return false;
+	}
+
+	*p_pk2pk_lf = deque_at(p_pk2pk, &p_pk2pk->lf_max, 0)->value -
+		      deque_at(p_pk2pk, &p_pk2pk->lf_min, 0)->value;
+	*p_pk2pk_hf = deque_at(p_pk2pk, &p_pk2pk->hf_max, 0)->value -
+		      deque_at(p_pk2pk, &p_pk2pk->hf_min, 0)->value;
+
+	return true;
+}
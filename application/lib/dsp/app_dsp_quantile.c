@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include "app_dsp.h"
+
+/* Marker height predicted by a parabola through the marker and its neighbours */
+static float quantile_parabolic(const struct app_dsp_quantile *p_quantile, int i, int d)
+{
+	const float *q = p_quantile->heights;
+	const int32_t *n = p_quantile->positions;
+
+	return q[i] + (float)d / (n[i + 1] - n[i - 1]) *
+		      ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+		       (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+}
+
+static float quantile_linear(const struct app_dsp_quantile *p_quantile, int i, int d)
+{
+	const float *q = p_quantile->heights;
+	const int32_t *n = p_quantile->positions;
+
+	return q[i] + d * (q[i + d] - q[i]) / (n[i + d] - n[i]);
+}
+
+void app_dsp_quantile_init_f32(struct app_dsp_quantile *p_quantile, float quantile)
+{
+	memset(p_quantile, 0, sizeof(*p_quantile));
+	p_quantile->quantile = quantile;
+}
+
+static void quantile_add(struct app_dsp_quantile *p_quantile, float value)
+{
+	const float p = p_quantile->quantile;
+	const float increments[5] = {0.0f, p / 2.0f, p, (1.0f + p) / 2.0f, 1.0f};
+	float *q = p_quantile->heights;
+	int32_t *n = p_quantile->positions;
+	int k;
+
+	/* The first five values are kept sorted as the initial marker heights */
+	if (p_quantile->count < 5) {
+		int i = p_quantile->count++;
+
+		for (; i > 0 && q[i - 1] > value; i--) {
+			q[i] = q[i - 1];
+		}
+		q[i] = value;
+
+		if (p_quantile->count == 5) {
+			for (i = 0; i < 5; i++) {
+				n[i] = i;
+				p_quantile->desired[i] = 4.0f * increments[i];
+			}
+		}
+		return;
+	}
+
+	p_quantile->count++;
+
+	/* Cell the value falls into, the extreme markers follow new extremes */
+	if (value < q[0]) {
+		q[0] = value;
+		k = 0;
+	} else if (value >= q[4]) {
+		q[4] = value;
+		k = 3;
+	} else {
+		for (k = 0; value >= q[k + 1]; k++) {
+		}
+	}
+
+	for (int i = k + 1; i < 5; i++) {
+		n[i]++;
+	}
+	for (int i = 0; i < 5; i++) {
+		p_quantile->desired[i] += increments[i];
+	}
+
+	/* Move the middle markers one rank towards their desired ranks */
+	for (int i = 1; i < 4; i++) {
+		float offset = p_quantile->desired[i] - n[i];
+
+		if ((offset >= 1.0f && n[i + 1] - n[i] > 1) ||
+		    (offset <= -1.0f && n[i - 1] - n[i] < -1)) {
+			int d = offset > 0.0f ? 1 : -1;
+			float height = quantile_parabolic(p_quantile, i, d);
+
+			if (height <= q[i - 1] || height >= q[i + 1]) {
+				height = quantile_linear(p_quantile, i, d);
+			}
+			q[i] = height;
+			n[i] += d;
+		}
+	}
+}
+
+void app_dsp_quantile_update_f32(struct app_dsp_quantile *p_quantile, const float *p_input,
+				 uint16_t num)
+{
+	app_dsp_quantile_update_f32_s(p_quantile, p_input, num, 1);
+}
+
+void app_dsp_quantile_update_f32_s(struct app_dsp_quantile *p_quantile, const float *p_input,
+				   uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		quantile_add(p_quantile, p_input[i * stride]);
+	}
+}
+
+void app_dsp_quantile_update_i16(struct app_dsp_quantile *p_quantile, const int16_t *p_input,
+				 uint16_t num)
+{
+	app_dsp_quantile_update_i16_s(p_quantile, p_input, num, 1);
+}
+
+void app_dsp_quantile_update_i16_s(struct app_dsp_quantile *p_quantile, const int16_t *p_input,
+				   uint16_t num, uint16_t stride)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		quantile_add(p_quantile, p_input[i * stride]);
+	}
+}
+
+float app_dsp_quantile_get_f32(const struct app_dsp_quantile *p_quantile)
+{
+	uint32_t count = p_quantile->count;
+
+	if (count == 0) {
+		return 0.0f;
+	}
+
+	if (count < 5) {
+		/* Nearest rank of the values sorted so far */
+		return p_quantile->heights[(uint32_t)(p_quantile->quantile * (count - 1) + 0.5f)];
+	}
+
+	return p_quantile->heights[2];
+}
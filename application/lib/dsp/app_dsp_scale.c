@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include "app_dsp.h"
+
+/* Full scale of nrf_dsp_quantize_f32_to_i8() and nrf_dsp_quantize_f32_to_i16() */
+#define SCALE_Q7_FULL  127.0f
+#define SCALE_Q15_FULL 32767.0f
+
+/* Below this standard deviation a feature is taken as constant, only its offset is corrected */
+#define SCALE_CAL_STD_MIN 1e-6f
+
+static inline float scale_clip(const struct app_dsp_scale *p_scale, float x, uint16_t i)
+{
+	float y = (x - p_scale->p_min[i]) * p_scale->p_recip[i];
+
+	return (y < 0.0f) ? 0.0f : (y > 1.0f) ? 1.0f : y;
+}
+
+void app_dsp_scale_init_f32(struct app_dsp_scale *p_scale, const float *p_min,
+			    const float *p_max, uint16_t num, float *p_recip)
+{
+	p_scale->p_min = p_min;
+	p_scale->p_recip = p_recip;
+	p_scale->num = num;
+
+	for (uint16_t i = 0; i < num; i++) {
+		float range = p_max[i] - p_min[i];
+
+		p_recip[i] = (range > 0.0f) ? 1.0f / range : 0.0f;
+	}
+}
+
+void app_dsp_scale_clip_f32(const struct app_dsp_scale *p_scale, const float *p_input,
+			    float *p_output)
+{
+	for (uint16_t i = 0; i < p_scale->num; i++) {
+		p_output[i] = scale_clip(p_scale, p_input[i], i);
+	}
+}
+
+void app_dsp_scale_clip_i8(const struct app_dsp_scale *p_scale, const float *p_input,
+			   int8_t *p_output)
+{
+	/* The clipped value is in [0, 1], so the conversion cannot overflow */
+	for (uint16_t i = 0; i < p_scale->num; i++) {
+		p_output[i] = (int8_t)(scale_clip(p_scale, p_input[i], i) * SCALE_Q7_FULL);
+	}
+}
+
+void app_dsp_scale_clip_i16(const struct app_dsp_scale *p_scale, const float *p_input,
+			    int16_t *p_output)
+{
+	for (uint16_t i = 0; i < p_scale->num; i++) {
+		p_output[i] = (int16_t)(scale_clip(p_scale, p_input[i], i) * SCALE_Q15_FULL);
+	}
+}
+
+void app_dsp_scale_cal_init(struct app_dsp_scale_cal *p_cal, const struct app_dsp_scale *p_ref,
+			    const float *p_ref_mean, const float *p_ref_std, uint16_t num,
+			    uint32_t vectors, struct app_dsp_ewma *p_stats, float *p_min,
+			    float *p_recip)
+{
+	/* The weight of an EWMA spanning the calibration vectors */
+	float alpha = 2.0f / ((float)vectors + 1.0f);
+
+	p_cal->p_active = p_ref;
+	p_cal->p_ref = p_ref;
+	p_cal->p_ref_mean = p_ref_mean;
+	p_cal->p_ref_std = p_ref_std;
+	p_cal->p_stats = p_stats;
+	p_cal->scale.p_min = p_min;
+	p_cal->scale.p_recip = p_recip;
+	p_cal->scale.num = num;
+	p_cal->p_min = p_min;
+	p_cal->remaining = vectors;
+
+	for (uint16_t i = 0; i < num; i++) {
+		app_dsp_ewma_init_f32(&p_stats[i], alpha);
+	}
+}
+
+/*
+ * The calibrated feature is (y - mean) * gain + ref_mean with y the scaled
+ * feature and gain = ref_std / std. With y = (x - min) * recip this is
+ * (x - min') * recip' for recip' = recip * gain and
+ * min' = min + (mean - ref_mean / gain) / recip.
+ */
+static void scale_cal_freeze(struct app_dsp_scale_cal *p_cal)
+{
+	const struct app_dsp_scale *p_ref = p_cal->p_ref;
+	float *p_recip = p_cal->scale.p_recip;
+
+	for (uint16_t i = 0; i < p_cal->scale.num; i++) {
+		float mean = app_dsp_ewma_mean_f32(&p_cal->p_stats[i]);
+		float std = sqrtf(app_dsp_ewma_var_f32(&p_cal->p_stats[i]));
+		float gain = 1.0f;
+
+		if (std > SCALE_CAL_STD_MIN && p_cal->p_ref_std[i] > SCALE_CAL_STD_MIN) {
+			gain = p_cal->p_ref_std[i] / std;
+		}
+
+		p_recip[i] = p_ref->p_recip[i] * gain;
+		p_cal->p_min[i] = p_ref->p_min[i];
+		if (p_ref->p_recip[i] > 0.0f) {
+			p_cal->p_min[i] += (mean - p_cal->p_ref_mean[i] / gain) / p_ref->p_recip[i];
+		}
+	}
+
+	p_cal->p_active = &p_cal->scale;
+}
+
+bool app_dsp_scale_cal_update_f32(struct app_dsp_scale_cal *p_cal, const float *p_scaled)
+{
+	if (p_cal->remaining == 0) {
+		return false;
+	}
+
+	for (uint16_t i = 0; i < p_cal->scale.num; i++) {
+		app_dsp_ewma_update_f32(&p_cal->p_stats[i], &p_scaled[i], 1);
+	}
+
+	if (--p_cal->remaining > 0) {
+		return false;
+	}
+
+	scale_cal_freeze(p_cal);
+	return true;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <string.h>
+#include "app_dsp.h"
+
+#define SDFT_PI 3.14159265358979f
+
+/* X[k] = (X[k] + x_in - x_out) * exp(2 pi i k / len) for every tracked bin */
+static void sdft_rotate(struct app_dsp_sdft *p_sdft, float delta)
+{
+	for (uint16_t b = 0; b < p_sdft->num_bins; b++) {
+		float *p_x = &p_sdft->p_state[2 * b];
+		const float *p_w = &p_sdft->p_twiddle[2 * b];
+		float re = p_x[0] + delta;
+		float im = p_x[1];
+
+		p_x[0] = re * p_w[0] - im * p_w[1];
+		p_x[1] = re * p_w[1] + im * p_w[0];
+	}
+}
+
+/* Recompute the bins from the history, the recursion from zero is the DFT of the window */
+static void sdft_resync(struct app_dsp_sdft *p_sdft)
+{
+	uint16_t pos = p_sdft->head;
+
+	memset(p_sdft->p_state, 0, 2 * p_sdft->num_bins * sizeof(float));
+
+	for (uint16_t n = 0; n < p_sdft->len; n++) {
+		sdft_rotate(p_sdft, p_sdft->p_history[pos]);
+		if (++pos == p_sdft->len) {
+			pos = 0;
+		}
+	}
+
+	p_sdft->replaced = 0;
+}
+
+void app_dsp_sdft_init_f32(struct app_dsp_sdft *p_sdft)
+{
+	for (uint16_t b = 0; b < p_sdft->num_bins; b++) {
+		float phase = 2.0f * SDFT_PI * p_sdft->p_bins[b] / p_sdft->len;
+
+		p_sdft->p_twiddle[2 * b] = cosf(phase);
+		p_sdft->p_twiddle[2 * b + 1] = sinf(phase);
+	}
+
+	memset(p_sdft->p_history, 0, p_sdft->len * sizeof(float));
+	memset(p_sdft->p_state, 0, 2 * p_sdft->num_bins * sizeof(float));
+	p_sdft->head = 0;
+	p_sdft->filled = 0;
+	p_sdft->replaced = 0;
+}
+
+void app_dsp_sdft_update_f32(struct app_dsp_sdft *p_sdft, const float *p_samples, uint16_t num)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		/* The history starts zeroed, so the first window needs no special case */
+		float leaving = p_sdft->p_history[p_sdft->head];
+
+		p_sdft->p_history[p_sdft->head] = p_samples[i];
+		if (++p_sdft->head == p_sdft->len) {
+			p_sdft->head = 0;
+		}
+
+		if (p_sdft->filled < p_sdft->len) {
+			p_sdft->filled++;
+		}
+
+		if (++p_sdft->replaced == p_sdft->len) {
+			sdft_resync(p_sdft);
+		} else {
+			sdft_rotate(p_sdft, p_samples[i] - leaving);
+		}
+	}
+}
+
+bool app_dsp_sdft_amplitude_f32(const struct app_dsp_sdft *p_sdft, float scale,
+				float *p_spectrum)
+{
+	for (uint16_t b = 0; b < p_sdft->num_bins; b++) {
+		const float *p_x = &p_sdft->p_state[2 * b];
+
+		p_spectrum[p_sdft->p_bins[b]] = scale * sqrtf(p_x[0] * p_x[0] + p_x[1] * p_x[1]);
+	}
+
+	return p_sdft->filled == p_sdft->len;
+}
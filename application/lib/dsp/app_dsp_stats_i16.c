@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+
+/*
+ * Two int16 lanes per 32-bit word. SSUB16 sets the per-lane GE flags when
+ * the first operand is greater or equal, which SEL then uses to pick the
+ * lanes of the maximum or minimum without branches.
+ */
+
+void app_dsp_stats_i16(const int16_t *p_input, uint16_t num, struct app_dsp_stats_i16 *p_stats)
+{
+	uint32_t sum = 0;
+	uint64_t sum_sq = 0;
+	uint32_t min2 = ((uint32_t)(uint16_t)p_input[0] << 16) | (uint16_t)p_input[0];
+	uint32_t max2 = min2;
+	uint16_t i = 0;
+
+	for (; (i + 2) <= num; i += 2) {
+		uint32_t x2;
+
+		/* Unaligned word loads are allowed on ARMv7-M and ARMv8-M Mainline */
+		memcpy(&x2, &p_input[i], sizeof(x2));
+
+		sum = __SMLAD(x2, 0x00010001, sum);
+		sum_sq = __SMLALD(x2, x2, sum_sq);
+
+		(void)__SSUB16(x2, max2);
+		max2 = __SEL(x2, max2);
+		(void)__SSUB16(x2, min2);
+		min2 = __SEL(min2, x2);
+	}
+
+	int16_t min = MIN((int16_t)min2, (int16_t)(min2 >> 16));
+	int16_t max = MAX((int16_t)max2, (int16_t)(max2 >> 16));
+
+	if (i < num) {
+		int32_t x = p_input[i];
+
+		sum += x;
+		sum_sq += (uint32_t)(x * x);
+		min = MIN(min, x);
+		max = MAX(max, x);
+	}
+
+	p_stats->sum = (int32_t)sum;
+	p_stats->sum_sq = sum_sq;
+	p_stats->min = min;
+	p_stats->max = max;
+}
+
+#else
+
+void app_dsp_stats_i16(const int16_t *p_input, uint16_t num, struct app_dsp_stats_i16 *p_stats)
+{
+	int32_t sum = 0;
+	uint64_t sum_sq = 0;
+	int16_t min = p_input[0];
+	int16_t max = p_input[0];
+
+	for (uint16_t i = 0; i < num; i++) {
+		int32_t x = p_input[i];
+
+		sum += x;
+		sum_sq += (uint32_t)(x * x);
+		min = MIN(min, x);
+		max = MAX(max, x);
+	}
+
+	p_stats->sum = sum;
+	p_stats->sum_sq = sum_sq;
+	p_stats->min = min;
+	p_stats->max = max;
+}
+
+#endif
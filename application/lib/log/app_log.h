@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _APP_LOG_H_
+#define _APP_LOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+/**
+ * @brief Log at most once per CONFIG_APP_LOG_RATELIMIT_MS from one call site
+ *
+ * For messages on the sampling and inference paths that can repeat for
+ * every sample or window. The first message is always logged, repeats
+ * within the interval are dropped before any formatting is done.
+ *
+ * @param _log Log macro, e.g. LOG_WRN
+ */
+#define APP_LOG_RATELIMIT(_log, ...)							\
+	do {										\
+		static uint32_t _app_log_last_ms;					\
+		static bool _app_log_logged;						\
+		uint32_t _app_log_now_ms = k_uptime_get_32();				\
+											\
+		if (!_app_log_logged ||							\
+		    (_app_log_now_ms - _app_log_last_ms) >= CONFIG_APP_LOG_RATELIMIT_MS) {	\
+			_app_log_logged = true;						\
+			_app_log_last_ms = _app_log_now_ms;				\
+			_log(__VA_ARGS__);						\
+		}									\
+	} while (0)
+
+#define APP_LOG_ERR_RATELIMIT(...) APP_LOG_RATELIMIT(LOG_ERR, __VA_ARGS__)
+#define APP_LOG_WRN_RATELIMIT(...) APP_LOG_RATELIMIT(LOG_WRN, __VA_ARGS__)
+
+#endif /* _APP_LOG_H_ */
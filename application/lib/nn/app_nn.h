@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _APP_NN_H_
+#define _APP_NN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/rt/nrf_edgeai_types.h>
+
+/**
+ * @brief One 32-bit word of a packed Neuton model
+ *
+ * A packed model is a stream of per-neuron records, generated offline by
+ * scripts/neuton_pack.py. Each record holds everything needed to evaluate
+ * one neuron, so inference walks a single sequential stream:
+ *
+ *   header  u16[0] internal links, u16[1] external links | activation type << 15
+ *   slot    u16[0] activation slot the neuron result is stored in
+ *   act     f32 activation weight
+ *   links   internal then external links in groups of two:
+ *           one word with two u16 source indices, then one f32 weight each;
+ *           an odd last link uses one index word and one weight word
+ *
+ * Internal links index activation slots rather than neurons. The generator
+ * reuses the slot of a neuron once all its successors are evaluated, so the
+ * activation buffer only needs to hold the peak live set of neurons.
+ *
+ * The q8 format stores each weight as an int8 multiple of a per-neuron scale
+ * and each source index as a one byte delta:
+ *
+ *   header  as above, counting the q8 links
+ *   slot    as above
+ *   act     f32 activation weight
+ *   scale   f32 weight scale of the neuron
+ *   links   internal then external links in groups of four:
+ *           one word with four u8 source deltas, then one word with
+ *           four s8 weights; a short last group is padded with zeros
+ *
+ * The links of each kind are sorted by source, a delta adds to the source of
+ * the previous link of the kind, the first to 0. Links that quantize to 0
+ * are left out, a gap of more than 255 is bridged by links of weight 0.
+ *
+ * The unit format moves links with a weight of exactly +1 or -1 out of the
+ * f32 links, so they are added or subtracted without a multiply:
+ *
+ *   header  as above, counting the f32 links only
+ *   slot    as above
+ *   act     f32 activation weight
+ *   units   u8[0] internal links of +1, u8[1] internal links of -1,
+ *           u8[2] external links of +1, u8[3] external links of -1
+ *   links   f32 internal then external links as above
+ *   unit    the unit links in the order of the units counts, two u16
+ *           source indices per word; an odd last link pads its word
+ *
+ * The f16 and bf16 formats store each weight in 16 bits, as IEEE half
+ * precision or as the high half of the f32, and widen it to f32 on load:
+ *
+ *   header  as above
+ *   slot    as above
+ *   act     f32 activation weight
+ *   links   internal then external links in groups of two:
+ *           one word with two u16 source indices, then one word with two
+ *           16-bit weights; an odd last link pads its weight word with 0
+ */
+union app_nn_packed_word {
+	uint32_t u32;
+	uint16_t u16[2];
+	uint8_t u8[4];
+	int8_t s8[4];
+	float f32;
+};
+
+/** Activation type flag in the external links field of a record header */
+#define APP_NN_PACKED_ACT_CLAMP 0x8000U
+
+/**
+ * @brief Run a packed f32 Neuton model
+ *
+ * Evaluates neurons in order, equivalent to nrf_nn_neuton_run_inference_f32()
+ * on the unpacked model. Internal links index activation slots holding earlier
+ * neurons, external links
+ * index model inputs, an external index of inputs_num or above is the bias.
+ * Neurons use sigmoid(act * sum) or, with APP_NN_PACKED_ACT_CLAMP, sum clamped
+ * to [0, 1].
+ *
+ * @param p_model Packed model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ */
+void app_nn_packed_run_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+			   uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num);
+
+/**
+ * @brief Output neuron of a packed model
+ *
+ * The generator orders the records so that each output neuron directly
+ * follows the neurons it depends on, outputs with the fewest neurons still
+ * to be evaluated first.
+ */
+struct app_nn_packed_output {
+	/* Record index of the output neuron */
+	uint16_t position;
+	/* Activation slot holding the output */
+	uint16_t slot;
+};
+
+/**
+ * @brief Run a packed f32 Neuton model until the top output stands out
+ *
+ * Same evaluation as app_nn_packed_run_f32(), but after each output neuron
+ * the evaluated outputs are compared. Once at least two are evaluated and the
+ * top one exceeds the second by more than margin, the remaining neurons are
+ * skipped and the slots of the outputs not evaluated are set to 0. Outputs
+ * evaluated later could still come out on top, so the result is an
+ * approximation of the full model that gets closer with larger margins.
+ *
+ * @param p_model Packed model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param p_outputs Output neurons in evaluation order
+ * @param outputs_num Number of output neurons
+ * @param margin Output margin required to stop early
+ * @return Number of neurons evaluated
+ */
+uint16_t app_nn_packed_run_early_exit_f32(const union app_nn_packed_word *p_model,
+					  float *p_neurons, uint16_t neurons_num,
+					  const float *p_inputs, uint16_t inputs_num,
+					  const struct app_nn_packed_output *p_outputs,
+					  uint16_t outputs_num, float margin);
+
+/**
+ * @brief Run a packed Neuton model with q8 weights
+ *
+ * Same evaluation as app_nn_packed_run_f32() on records in the q8 format,
+ * decoding each weight as its int8 value times the scale of the neuron.
+ *
+ * @param p_model Packed q8 model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ */
+void app_nn_packed_run_q8_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+			      uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num);
+
+/**
+ * @brief Run a packed Neuton model with q8 weights until the top output stands out
+ *
+ * Same evaluation as app_nn_packed_run_early_exit_f32() on records in the q8
+ * format.
+ *
+ * @param p_model Packed q8 model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param p_outputs Output neurons in evaluation order
+ * @param outputs_num Number of output neurons
+ * @param margin Output margin required to stop early
+ * @return Number of neurons evaluated
+ */
+uint16_t app_nn_packed_run_early_exit_q8_f32(const union app_nn_packed_word *p_model,
+					     float *p_neurons, uint16_t neurons_num,
+					     const float *p_inputs, uint16_t inputs_num,
+					     const struct app_nn_packed_output *p_outputs,
+					     uint16_t outputs_num, float margin);
+
+/**
+ * @brief Run a packed Neuton model with unit weight links
+ *
+ * Same evaluation as app_nn_packed_run_f32() on records in the unit format.
+ * The unit links are summed after the f32 links, so results can differ from
+ * the unpacked model in the last bits.
+ *
+ * @param p_model Packed unit model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ */
+void app_nn_packed_run_unit_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num);
+
+/**
+ * @brief Run a packed Neuton model with unit weight links until the top output stands out
+ *
+ * Same evaluation as app_nn_packed_run_early_exit_f32() on records in the
+ * unit format.
+ *
+ * @param p_model Packed unit model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param p_outputs Output neurons in evaluation order
+ * @param outputs_num Number of output neurons
+ * @param margin Output margin required to stop early
+ * @return Number of neurons evaluated
+ */
+uint16_t app_nn_packed_run_early_exit_unit_f32(const union app_nn_packed_word *p_model,
+					       float *p_neurons, uint16_t neurons_num,
+					       const float *p_inputs, uint16_t inputs_num,
+					       const struct app_nn_packed_output *p_outputs,
+					       uint16_t outputs_num, float margin);
+
+/**
+ * @brief Run a packed Neuton model with IEEE half precision weights
+ *
+ * Same evaluation as app_nn_packed_run_f32() on records in the f16 format,
+ * the weights are widened to f32 and the sums are computed in f32.
+ *
+ * @param p_model Packed f16 model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ */
+void app_nn_packed_run_f16_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+			       uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num);
+
+/**
+ * @brief Run a packed Neuton model with half precision weights until the top output stands out
+ *
+ * Same evaluation as app_nn_packed_run_early_exit_f32() on records in the
+ * f16 format.
+ *
+ * @param p_model Packed f16 model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param p_outputs Output neurons in evaluation order
+ * @param outputs_num Number of output neurons
+ * @param margin Output margin required to stop early
+ * @return Number of neurons evaluated
+ */
+uint16_t app_nn_packed_run_early_exit_f16_f32(const union app_nn_packed_word *p_model,
+					      float *p_neurons, uint16_t neurons_num,
+					      const float *p_inputs, uint16_t inputs_num,
+					      const struct app_nn_packed_output *p_outputs,
+					      uint16_t outputs_num, float margin);
+
+/**
+ * @brief Run a packed Neuton model with bfloat16 weights
+ *
+ * Same evaluation as app_nn_packed_run_f32() on records in the bf16 format,
+ * the weights are widened to f32 and the sums are computed in f32.
+ *
+ * @param p_model Packed bf16 model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ */
+void app_nn_packed_run_bf16_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num);
+
+/**
+ * @brief Run a packed Neuton model with bfloat16 weights until the top output stands out
+ *
+ * Same evaluation as app_nn_packed_run_early_exit_f32() on records in the
+ * bf16 format.
+ *
+ * @param p_model Packed bf16 model stream
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param p_outputs Output neurons in evaluation order
+ * @param outputs_num Number of output neurons
+ * @param margin Output margin required to stop early
+ * @return Number of neurons evaluated
+ */
+uint16_t app_nn_packed_run_early_exit_bf16_f32(const union app_nn_packed_word *p_model,
+					       float *p_neurons, uint16_t neurons_num,
+					       const float *p_inputs, uint16_t inputs_num,
+					       const struct app_nn_packed_output *p_outputs,
+					       uint16_t outputs_num, float margin);
+
+/**
+ * @brief Position in a packed model evaluated in steps
+ *
+ * Start an evaluation with p set to the packed model stream and n to 0.
+ */
+struct app_nn_packed_cursor {
+	/* Record of the next neuron */
+	const union app_nn_packed_word *p;
+	/* Number of neurons evaluated */
+	uint16_t n;
+};
+
+/**
+ * @brief Evaluate the next neurons of a packed f32 Neuton model
+ *
+ * Same evaluation as app_nn_packed_run_f32() split into calls of at most
+ * budget neurons each. The cursor keeps the position between the calls, the
+ * neuron slots and the inputs must be left as they are until the last one.
+ *
+ * @param p_cursor Position in the packed model stream, advanced by the neurons evaluated
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param budget Maximum number of neurons to evaluate
+ * @return true once all neurons are evaluated
+ */
+bool app_nn_packed_run_step_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num,
+				uint16_t budget);
+
+/**
+ * @brief Evaluate the next neurons of a packed Neuton model with q8 weights
+ *
+ * Same evaluation as app_nn_packed_run_step_f32() on records in the q8 format.
+ *
+ * @param p_cursor Position in the packed model stream, advanced by the neurons evaluated
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param budget Maximum number of neurons to evaluate
+ * @return true once all neurons are evaluated
+ */
+bool app_nn_packed_run_step_q8_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				   uint16_t neurons_num, const float *p_inputs,
+				   uint16_t inputs_num, uint16_t budget);
+
+/**
+ * @brief Evaluate the next neurons of a packed Neuton model with unit weight links
+ *
+ * Same evaluation as app_nn_packed_run_step_f32() on records in the unit format.
+ *
+ * @param p_cursor Position in the packed model stream, advanced by the neurons evaluated
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param budget Maximum number of neurons to evaluate
+ * @return true once all neurons are evaluated
+ */
+bool app_nn_packed_run_step_unit_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				     uint16_t neurons_num, const float *p_inputs,
+				     uint16_t inputs_num, uint16_t budget);
+
+/**
+ * @brief Evaluate the next neurons of a packed Neuton model with half precision weights
+ *
+ * Same evaluation as app_nn_packed_run_step_f32() on records in the f16 format.
+ *
+ * @param p_cursor Position in the packed model stream, advanced by the neurons evaluated
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param budget Maximum number of neurons to evaluate
+ * @return true once all neurons are evaluated
+ */
+bool app_nn_packed_run_step_f16_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				    uint16_t neurons_num, const float *p_inputs,
+				    uint16_t inputs_num, uint16_t budget);
+
+/**
+ * @brief Evaluate the next neurons of a packed Neuton model with bfloat16 weights
+ *
+ * Same evaluation as app_nn_packed_run_step_f32() on records in the bf16 format.
+ *
+ * @param p_cursor Position in the packed model stream, advanced by the neurons evaluated
+ * @param p_neurons Neuron activation slots, as many as the generator assigned
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ * @param budget Maximum number of neurons to evaluate
+ * @return true once all neurons are evaluated
+ */
+bool app_nn_packed_run_step_bf16_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				     uint16_t neurons_num, const float *p_inputs,
+				     uint16_t inputs_num, uint16_t budget);
+
+/** Maximum number of windows evaluated by one app_nn_packed_run_batch_f32() call */
+#define APP_NN_BATCH_MAX 8
+
+/**
+ * @brief Run a packed f32 Neuton model on a batch of input vectors
+ *
+ * Same evaluation as app_nn_packed_run_f32() for every input vector, but each
+ * record is read once per batch so link and weight fetches are shared by all
+ * windows. Activations are stored slot-major: the activation of slot s for
+ * window k is p_neurons[s * batch + k].
+ *
+ * @param p_model Packed model stream
+ * @param p_neurons Neuron activation slots, batch entries per slot
+ * @param neurons_num Number of neurons
+ * @param p_inputs Model inputs, batch consecutive vectors of inputs_num entries
+ * @param inputs_num Number of model inputs per vector
+ * @param batch Number of input vectors
+ * @return 0 on success, -EINVAL if batch exceeds APP_NN_BATCH_MAX, nothing is evaluated then
+ */
+int app_nn_packed_run_batch_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num,
+				uint16_t batch);
+
+/**
+ * @brief Run a q8 Neuton model with raw arguments
+ *
+ * Drop-in for nrf_nn_neuton_run_inference_raw_q8() with the same arguments
+ * and bit-exact results. With the DSP extension, four links are accumulated
+ * per step with two SMLAD on sign-extended weight pairs.
+ *
+ * @param p_neurons Neurons buffer
+ * @param neurons_num Number of neurons in the model
+ * @param p_neuron_links Source index of each link
+ * @param p_neuron_internal_links_num Cumulative internal link end of each neuron
+ * @param p_neuron_external_links_num Cumulative external link end of each neuron
+ * @param p_neuron_act_type_mask Activation type bit of each neuron, 1 for the clamp
+ * @param p_weights Weight of each link
+ * @param p_act_weights Activation weight of each neuron
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ */
+void app_nn_neuton_run_inference_raw_q8(uint8_t *p_neurons, uint32_t neurons_num,
+					const uint16_t *p_neuron_links,
+					const uint16_t *p_neuron_internal_links_num,
+					const uint16_t *p_neuron_external_links_num,
+					const uint8_t *p_neuron_act_type_mask, const int8_t *p_weights,
+					const uint8_t *p_act_weights, const uint8_t *p_inputs,
+					uint16_t inputs_num);
+
+/**
+ * @brief Run a q16 Neuton model with raw arguments
+ *
+ * Drop-in for nrf_nn_neuton_run_inference_raw_q16() with the same arguments
+ * and bit-exact results. With the DSP extension, two links are accumulated
+ * per step with one SMLALD.
+ *
+ * @param p_neurons Neurons buffer
+ * @param neurons_num Number of neurons in the model
+ * @param p_neuron_links Source index of each link
+ * @param p_neuron_internal_links_num Cumulative internal link end of each neuron
+ * @param p_neuron_external_links_num Cumulative external link end of each neuron
+ * @param p_neuron_act_type_mask Activation type bit of each neuron, 1 for the clamp
+ * @param p_weights Weight of each link
+ * @param p_act_weights Activation weight of each neuron
+ * @param p_inputs Model inputs
+ * @param inputs_num Number of model inputs
+ */
+void app_nn_neuton_run_inference_raw_q16(uint16_t *p_neurons, uint32_t neurons_num,
+					 const uint16_t *p_neuron_links,
+					 const uint16_t *p_neuron_internal_links_num,
+					 const uint16_t *p_neuron_external_links_num,
+					 const uint8_t *p_neuron_act_type_mask, const int16_t *p_weights,
+					 const uint16_t *p_act_weights, const uint16_t *p_inputs,
+					 uint16_t inputs_num);
+
+/**
+ * @brief Run the inference of a q8 model
+ *
+ * Run inference interface for generated q8 models, in place of
+ * nrf_edgeai_run_model_inference_q8(). Takes the inputs from the window or
+ * the extracted features as the model uses them and runs
+ * app_nn_neuton_run_inference_raw_q8().
+ *
+ * @param p_edgeai EdgeAI context of the model
+ */
+void app_nn_run_model_inference_q8(nrf_edgeai_t *p_edgeai);
+
+/**
+ * @brief Run the inference of a q16 model
+ *
+ * Same as app_nn_run_model_inference_q8() for q16 models, in place of
+ * nrf_edgeai_run_model_inference_q16().
+ *
+ * @param p_edgeai EdgeAI context of the model
+ */
+void app_nn_run_model_inference_q16(nrf_edgeai_t *p_edgeai);
+
+#endif /* _APP_NN_H_ */
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+#include "app_nn.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+#endif
+
+/* Source value of external links past the model inputs, 1.0 in the quantized range */
+#define NEUTON_BIAS_Q8  UINT8_MAX
+#define NEUTON_BIAS_Q16 UINT16_MAX
+
+/* Sigmoid activations of the runtime library, not declared in its public headers */
+uint8_t nrf_nn_neuton_sigmoid_q8(uint8_t act, int32_t sum);
+uint16_t nrf_nn_neuton_sigmoid_q16(uint16_t act, int64_t sum);
+
+static inline bool act_clamp(const uint8_t *p_act_type_mask, uint32_t n)
+{
+	return (p_act_type_mask[n >> 3] >> (n & 7)) & 1;
+}
+
+/* Same as nrf_nn_neuton_relu_q8(), the sum has 7 fraction bits */
+static inline uint8_t activation_q8(uint8_t act, int32_t sum, bool clamp)
+{
+	if (!clamp) {
+		return nrf_nn_neuton_sigmoid_q8(act, sum);
+	}
+
+	sum >>= 7;
+
+	return (sum < 0) ? 0 : (sum > UINT8_MAX) ? UINT8_MAX : (uint8_t)sum;
+}
+
+/* Same as nrf_nn_neuton_relu_q16(), the sum has 15 fraction bits */
+static inline uint16_t activation_q16(uint16_t act, int64_t sum, bool clamp)
+{
+	if (!clamp) {
+		return nrf_nn_neuton_sigmoid_q16(act, sum);
+	}
+
+	sum >>= 15;
+
+	return (sum < 0) ? 0 : (sum > UINT16_MAX) ? UINT16_MAX : (uint16_t)sum;
+}
+
+/*
+ * Link sources below bias_from are read from p_src, the others are the bias.
+ * Internal links pass UINT32_MAX, so the inlined check folds away for them.
+ */
+static ALWAYS_INLINE uint32_t source_q8(const uint8_t *p_src, uint32_t bias_from, uint16_t idx)
+{
+	return (idx < bias_from) ? p_src[idx] : NEUTON_BIAS_Q8;
+}
+
+static ALWAYS_INLINE uint32_t source_q16(const uint16_t *p_src, uint32_t bias_from, uint16_t idx)
+{
+	return (idx < bias_from) ? p_src[idx] : NEUTON_BIAS_Q16;
+}
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+
+/*
+ * Four links per step. SXTB16 sign-extends the even and the odd weights of
+ * a word into halfword pairs and the sources are gathered into the same
+ * lanes, so two SMLAD add all four products. s8 weights times u8 sources
+ * are exact in the 16-bit lanes and the sum is the one of the C reference.
+ */
+static ALWAYS_INLINE int32_t links_q8(const uint16_t *p_links, const int8_t *p_weights,
+				      uint32_t *p_j, uint32_t end, const uint8_t *p_src,
+				      uint32_t bias_from, int32_t sum)
+{
+	uint32_t j = *p_j;
+
+	for (; j + 4 <= end; j += 4) {
+		uint32_t w4;
+		uint32_t even;
+		uint32_t odd;
+
+		/* Unaligned word loads are allowed on ARMv7-M and ARMv8-M Mainline */
+		memcpy(&w4, &p_weights[j], sizeof(w4));
+
+		even = source_q8(p_src, bias_from, p_links[j]) |
+		       (source_q8(p_src, bias_from, p_links[j + 2]) << 16);
+		odd = source_q8(p_src, bias_from, p_links[j + 1]) |
+		      (source_q8(p_src, bias_from, p_links[j + 3]) << 16);
+
+		sum = (int32_t)__SMLAD(__SXTB16(w4), even, (uint32_t)sum);
+		sum = (int32_t)__SMLAD(__SXTB16(__ROR(w4, 8)), odd, (uint32_t)sum);
+	}
+
+	for (; j < end; j++) {
+		sum += p_weights[j] * (int32_t)source_q8(p_src, bias_from, p_links[j]);
+	}
+
+	*p_j = MAX(*p_j, end);
+
+	return sum;
+}
+
+/*
+ * Two links per step with one SMLALD. The u16 sources are offset to s16 by
+ * flipping their sign bits, x - 32768, and the offset is added back once as
+ * 32768 times the weight sum, which an SMLAD by 1 in both lanes gathers
+ * along the way. All steps are exact, the sum is the one of the C reference.
+ */
+static ALWAYS_INLINE int64_t links_q16(const uint16_t *p_links, const int16_t *p_weights,
+				       uint32_t *p_j, uint32_t end, const uint16_t *p_src,
+				       uint32_t bias_from, int64_t sum)
+{
+	uint32_t j = *p_j;
+	int32_t weights_sum = 0;
+
+	for (; j + 2 <= end; j += 2) {
+		uint32_t w2;
+		uint32_t x2;
+
+		/* Unaligned word loads are allowed on ARMv7-M and ARMv8-M Mainline */
+		memcpy(&w2, &p_weights[j], sizeof(w2));
+
+		x2 = source_q16(p_src, bias_from, p_links[j]) |
+		     (source_q16(p_src, bias_from, p_links[j + 1]) << 16);
+
+		sum = (int64_t)__SMLALD(w2, x2 ^ 0x80008000U, (uint64_t)sum);
+		weights_sum = (int32_t)__SMLAD(w2, 0x00010001U, (uint32_t)weights_sum);
+	}
+
+	sum += (int64_t)weights_sum * 32768;
+
+	for (; j < end; j++) {
+		sum += p_weights[j] * (int32_t)source_q16(p_src, bias_from, p_links[j]);
+	}
+
+	*p_j = MAX(*p_j, end);
+
+	return sum;
+}
+
+#else
+
+static ALWAYS_INLINE int32_t links_q8(const uint16_t *p_links, const int8_t *p_weights,
+				      uint32_t *p_j, uint32_t end, const uint8_t *p_src,
+				      uint32_t bias_from, int32_t sum)
+{
+	for (uint32_t j = *p_j; j < end; j++) {
+		sum += p_weights[j] * (int32_t)source_q8(p_src, bias_from, p_links[j]);
+	}
+
+	*p_j = MAX(*p_j, end);
+
+	return sum;
+}
+
+static ALWAYS_INLINE int64_t links_q16(const uint16_t *p_links, const int16_t *p_weights,
+				       uint32_t *p_j, uint32_t end, const uint16_t *p_src,
+				       uint32_t bias_from, int64_t sum)
+{
+	for (uint32_t j = *p_j; j < end; j++) {
+		sum += p_weights[j] * (int32_t)source_q16(p_src, bias_from, p_links[j]);
+	}
+
+	*p_j = MAX(*p_j, end);
+
+	return sum;
+}
+
+#endif
+
+void app_nn_neuton_run_inference_raw_q8(uint8_t *p_neurons, uint32_t neurons_num,
+					const uint16_t *p_neuron_links,
+					const uint16_t *p_neuron_internal_links_num,
+					const uint16_t *p_neuron_external_links_num,
+					const uint8_t *p_neuron_act_type_mask, const int8_t *p_weights,
+					const uint8_t *p_act_weights, const uint8_t *p_inputs,
+					uint16_t inputs_num)
+{
+	uint32_t j = 0;
+
+	for (uint32_t n = 0; n < neurons_num; n++) {
+		int32_t sum = 0;
+
+		sum = links_q8(p_neuron_links, p_weights, &j, p_neuron_internal_links_num[n],
+			       p_neurons, UINT32_MAX, sum);
+		sum = links_q8(p_neuron_links, p_weights, &j, p_neuron_external_links_num[n],
+			       p_inputs, inputs_num, sum);
+
+		p_neurons[n] = activation_q8(p_act_weights[n], sum,
+					     act_clamp(p_neuron_act_type_mask, n));
+	}
+}
+
+void app_nn_neuton_run_inference_raw_q16(uint16_t *p_neurons, uint32_t neurons_num,
+					 const uint16_t *p_neuron_links,
+					 const uint16_t *p_neuron_internal_links_num,
+					 const uint16_t *p_neuron_external_links_num,
+					 const uint8_t *p_neuron_act_type_mask, const int16_t *p_weights,
+					 const uint16_t *p_act_weights, const uint16_t *p_inputs,
+					 uint16_t inputs_num)
+{
+	uint32_t j = 0;
+
+	for (uint32_t n = 0; n < neurons_num; n++) {
+		int64_t sum = 0;
+
+		sum = links_q16(p_neuron_links, p_weights, &j, p_neuron_internal_links_num[n],
+				p_neurons, UINT32_MAX, sum);
+		sum = links_q16(p_neuron_links, p_weights, &j, p_neuron_external_links_num[n],
+				p_inputs, inputs_num, sum);
+
+		p_neurons[n] = activation_q16(p_act_weights[n], sum,
+					      act_clamp(p_neuron_act_type_mask, n));
+	}
+}
+
+/* Model inputs as nrf_edgeai_run_model_inference_q8() and _q16() select them */
+static const void *model_inputs(const nrf_edgeai_t *p_edgeai, uint16_t *p_num)
+{
+	if (p_edgeai->model.meta.uses_as_input.features.input) {
+		*p_num = p_edgeai->input.window_size * p_edgeai->input.unique_num_used;
+		return p_edgeai->input.window_memory.p_void;
+	}
+
+	*p_num = p_edgeai->p_dsp->features.overall_num;
+	return p_edgeai->p_dsp->features.extracted_memory.p_void;
+}
+
+void app_nn_run_model_inference_q8(nrf_edgeai_t *p_edgeai)
+{
+	const nrf_edgeai_model_meta_t *p_meta = &p_edgeai->model.meta;
+	const nrf_edgeai_model_params_q8_t *p_params = &p_edgeai->model.params.q8;
+	uint16_t inputs_num;
+	const uint8_t *p_inputs = model_inputs(p_edgeai, &inputs_num);
+
+	app_nn_neuton_run_inference_raw_q8(p_params->p_neurons, p_meta->neurons_num,
+					   p_meta->p_neuron_links,
+					   p_meta->p_neuron_internal_links_num,
+					   p_meta->p_neuron_external_links_num,
+					   p_meta->p_neuron_act_type_mask, p_params->p_weights,
+					   p_params->p_act_weights, p_inputs, inputs_num);
+}
+
+void app_nn_run_model_inference_q16(nrf_edgeai_t *p_edgeai)
+{
+	const nrf_edgeai_model_meta_t *p_meta = &p_edgeai->model.meta;
+	const nrf_edgeai_model_params_q16_t *p_params = &p_edgeai->model.params.q16;
+	uint16_t inputs_num;
+	const uint16_t *p_inputs = model_inputs(p_edgeai, &inputs_num);
+
+	app_nn_neuton_run_inference_raw_q16(p_params->p_neurons, p_meta->neurons_num,
+					    p_meta->p_neuron_links,
+					    p_meta->p_neuron_internal_links_num,
+					    p_meta->p_neuron_external_links_num,
+					    p_meta->p_neuron_act_type_mask, p_params->p_weights,
+					    p_params->p_act_weights, p_inputs, inputs_num);
+}
@@ -0,0 +1,654 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "app_nn.h"
+
+#if defined(CONFIG_APP_DETECTION_KERNELS_IN_RAM)
+#include <zephyr/linker/section_tags.h>
+/* Execute the inference loops from RAM instead of XIP flash */
+#define PACKED_RAMFUNC __ramfunc
+#else
+#define PACKED_RAMFUNC
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FAST_ACTIVATION)
+/* Sigmoid table steps per unit and last entry, the sigmoid is 1 within 6.2e-6 beyond it */
+#define SIGMOID_LUT_STEPS 8
+#define SIGMOID_LUT_END 96
+
+/* 1 / (1 + exp(-x)) at x = i / SIGMOID_LUT_STEPS */
+static const float sigmoid_lut[SIGMOID_LUT_END + 1] = {
+	0.500000000f, 0.531209373f, 0.562176501f, 0.592666600f, 0.622459331f, 0.651354865f,
+	0.679178699f, 0.705785028f, 0.731058579f, 0.754914987f, 0.777299861f, 0.798186778f,
+	0.817574476f, 0.835483537f, 0.851952802f, 0.867035760f, 0.880797078f, 0.893309406f,
+	0.904650535f, 0.914900955f, 0.924141820f, 0.932453309f, 0.939913350f, 0.946596670f,
+	0.952574127f, 0.957912272f, 0.962673113f, 0.966914022f, 0.970687769f, 0.974042643f,
+	0.977022630f, 0.979667647f, 0.982013790f, 0.984093608f, 0.985936373f, 0.987568349f,
+	0.989013057f, 0.990291524f, 0.991422515f, 0.992422759f, 0.993307149f, 0.994088931f,
+	0.994779874f, 0.995390428f, 0.995929862f, 0.996406397f, 0.996827317f, 0.997199073f,
+	0.997527377f, 0.997817284f, 0.998073265f, 0.998299278f, 0.998498818f, 0.998674978f,
+	0.998830490f, 0.998967769f, 0.999088949f, 0.999195914f, 0.999290330f, 0.999373666f,
+	0.999447221f, 0.999512143f, 0.999569443f, 0.999620015f, 0.999664650f, 0.999704043f,
+	0.999738810f, 0.999769493f, 0.999796573f, 0.999820472f, 0.999841564f, 0.999860178f,
+	0.999876605f, 0.999891103f, 0.999903898f, 0.999915189f, 0.999925154f, 0.999933948f,
+	0.999941709f, 0.999948558f, 0.999954602f, 0.999959936f, 0.999964644f, 0.999968798f,
+	0.999972464f, 0.999975700f, 0.999978555f, 0.999981075f, 0.999983299f, 0.999985261f,
+	0.999986993f, 0.999988521f, 0.999989870f, 0.999991060f, 0.999992111f, 0.999993038f,
+	0.999993856f
+};
+
+/*
+ * Linear interpolation between the table entries, mirrored for negative
+ * inputs with sigmoid(-x) = 1 - sigmoid(x). The error of the chords is at
+ * most max|sigmoid''| / (8 * SIGMOID_LUT_STEPS^2) = 1.9e-4.
+ */
+static inline float sigmoid(float x)
+{
+	float pos = fabsf(x) * SIGMOID_LUT_STEPS;
+	float y = 1.0f;
+
+	if (pos < SIGMOID_LUT_END) {
+		uint16_t i = (uint16_t)pos;
+		float t = pos - i;
+
+		y = sigmoid_lut[i] + t * (sigmoid_lut[i + 1] - sigmoid_lut[i]);
+	}
+
+	return (x < 0.0f) ? 1.0f - y : y;
+}
+#else
+static inline float sigmoid(float x)
+{
+	return 1.0f / (1.0f + expf(-x));
+}
+#endif
+
+static inline float activation(float sum, float act, bool clamp)
+{
+	if (clamp) {
+		return (sum > 1.0f) ? 1.0f : ((sum < 0.0f) ? 0.0f : sum);
+	}
+
+	return sigmoid(act * sum);
+}
+
+/* Add f32 links to the sum in link order, a source index of bias_idx or above is the bias */
+static inline float packed_links_f32(const union app_nn_packed_word **pp, uint16_t num,
+				     const float *p_src, uint16_t bias_idx, float sum)
+{
+	const union app_nn_packed_word *p = *pp;
+
+	for (uint16_t i = 0; i < num; i += 2) {
+		uint16_t idx = p[0].u16[0];
+
+		sum += p[1].f32 * ((idx < bias_idx) ? p_src[idx] : 1.0f);
+		if ((i + 1) < num) {
+			idx = p[0].u16[1];
+			sum += p[2].f32 * ((idx < bias_idx) ? p_src[idx] : 1.0f);
+			p += 3;
+		} else {
+			p += 2;
+		}
+	}
+
+	*pp = p;
+
+	return sum;
+}
+
+#if defined(APP_HOST_KERNELS)
+/* Host builds select the link loop at run time, see tools/host_replay/host_kernels.c */
+float app_nn_packed_links_f32_scalar(const union app_nn_packed_word **pp, uint16_t num,
+				     const float *p_src, uint16_t bias_idx, float sum)
+{
+	return packed_links_f32(pp, num, p_src, bias_idx, sum);
+}
+
+float app_nn_packed_links_f32(const union app_nn_packed_word **pp, uint16_t num,
+			      const float *p_src, uint16_t bias_idx, float sum);
+#define packed_links_f32 app_nn_packed_links_f32
+#endif
+
+/* Evaluate the neuron of one record, returns the next record */
+static inline const union app_nn_packed_word *packed_neuron_f32(const union app_nn_packed_word *p,
+								float *p_neurons,
+								const float *p_inputs,
+								uint16_t inputs_num)
+{
+	uint16_t internal_num = p[0].u16[0];
+	uint16_t external_num = p[0].u16[1] & ~APP_NN_PACKED_ACT_CLAMP;
+	bool clamp = (p[0].u16[1] & APP_NN_PACKED_ACT_CLAMP) != 0;
+	uint16_t slot = p[1].u16[0];
+	float act = p[2].f32;
+	float sum;
+
+	p += 3;
+
+	/* Links from the slots of earlier neurons, then from model inputs and the bias */
+	sum = packed_links_f32(&p, internal_num, p_neurons, UINT16_MAX, 0.0f);
+	sum = packed_links_f32(&p, external_num, p_inputs, inputs_num, sum);
+
+	p_neurons[slot] = activation(sum, act, clamp);
+
+	return p;
+}
+
+/* Sum of unit weight link sources, a source index of bias_idx or above is the bias */
+static inline float packed_units(const union app_nn_packed_word **pp, uint8_t num,
+				 const float *p_src, uint16_t bias_idx)
+{
+	const union app_nn_packed_word *p = *pp;
+	float sum = 0.0f;
+
+	for (uint16_t i = 0; i < num; i += 2, p++) {
+		uint16_t idx = p[0].u16[0];
+
+		sum += (idx < bias_idx) ? p_src[idx] : 1.0f;
+		if ((i + 1) < num) {
+			idx = p[0].u16[1];
+			sum += (idx < bias_idx) ? p_src[idx] : 1.0f;
+		}
+	}
+
+	*pp = p;
+
+	return sum;
+}
+
+/* Evaluate the neuron of one record with unit weight links, returns the next record */
+static inline const union app_nn_packed_word *packed_neuron_unit(const union app_nn_packed_word *p,
+								 float *p_neurons,
+								 const float *p_inputs,
+								 uint16_t inputs_num)
+{
+	uint16_t internal_num = p[0].u16[0];
+	uint16_t external_num = p[0].u16[1] & ~APP_NN_PACKED_ACT_CLAMP;
+	bool clamp = (p[0].u16[1] & APP_NN_PACKED_ACT_CLAMP) != 0;
+	uint16_t slot = p[1].u16[0];
+	float act = p[2].f32;
+	union app_nn_packed_word units = p[3];
+	float sum;
+
+	p += 4;
+
+	sum = packed_links_f32(&p, internal_num, p_neurons, UINT16_MAX, 0.0f);
+	sum = packed_links_f32(&p, external_num, p_inputs, inputs_num, sum);
+
+	/* Weights of +1 and -1 add and subtract their sources without a multiply */
+	sum += packed_units(&p, units.u8[0], p_neurons, UINT16_MAX);
+	sum -= packed_units(&p, units.u8[1], p_neurons, UINT16_MAX);
+	sum += packed_units(&p, units.u8[2], p_inputs, inputs_num);
+	sum -= packed_units(&p, units.u8[3], p_inputs, inputs_num);
+
+	p_neurons[slot] = activation(sum, act, clamp);
+
+	return p;
+}
+
+/*
+ * Weighted sum of q8 links, a source index of bias_idx or above is the bias.
+ * Each index byte is the delta to the source of the previous link.
+ */
+static inline float packed_links_q8(const union app_nn_packed_word **pp, uint16_t num,
+				    const float *p_src, uint16_t bias_idx)
+{
+	const union app_nn_packed_word *p = *pp;
+	uint16_t idx = 0;
+	float sum = 0.0f;
+
+	for (uint16_t i = 0; i < num; i += 4, p += 2) {
+		uint16_t group = ((num - i) < 4) ? (num - i) : 4;
+
+		for (uint16_t j = 0; j < group; j++) {
+			idx += p[0].u8[j];
+
+			sum += p[1].s8[j] * ((idx < bias_idx) ? p_src[idx] : 1.0f);
+		}
+	}
+
+	*pp = p;
+
+	return sum;
+}
+
+/* Evaluate the neuron of one q8 record, returns the next record */
+static inline const union app_nn_packed_word *packed_neuron_q8(const union app_nn_packed_word *p,
+							       float *p_neurons,
+							       const float *p_inputs,
+							       uint16_t inputs_num)
+{
+	uint16_t internal_num = p[0].u16[0];
+	uint16_t external_num = p[0].u16[1] & ~APP_NN_PACKED_ACT_CLAMP;
+	bool clamp = (p[0].u16[1] & APP_NN_PACKED_ACT_CLAMP) != 0;
+	uint16_t slot = p[1].u16[0];
+	float act = p[2].f32;
+	float scale = p[3].f32;
+	float sum;
+
+	p += 4;
+
+	/* The scale is shared by all links of the neuron, apply it once to the sum */
+	sum = packed_links_q8(&p, internal_num, p_neurons, UINT16_MAX);
+	sum += packed_links_q8(&p, external_num, p_inputs, inputs_num);
+
+	p_neurons[slot] = activation(scale * sum, act, clamp);
+
+	return p;
+}
+
+#if defined(__ARM_FP) && (__ARM_FP & 0x2)
+
+/* VCVTB and VCVTT widen the low and the high half of a register, exact for all halves */
+static inline void widen_f16(uint32_t pair, float *p_lo, float *p_hi)
+{
+	float halves;
+
+	memcpy(&halves, &pair, sizeof(halves));
+	__asm__("vcvtb.f32.f16 %0, %1" : "=t"(*p_lo) : "t"(halves));
+	__asm__("vcvtt.f32.f16 %0, %1" : "=t"(*p_hi) : "t"(halves));
+}
+
+#else
+
+static inline float f16_to_f32(uint16_t h)
+{
+	uint32_t sign = (uint32_t)(h & 0x8000U) << 16;
+	uint32_t exponent = (h >> 10) & 0x1fU;
+	uint32_t mantissa = h & 0x3ffU;
+	uint32_t bits;
+	float value;
+
+	if (exponent == 0) {
+		/* Zero and subnormals, mantissa * 2^-24 is exact in f32 */
+		value = mantissa * 0x1p-24f;
+		return sign ? -value : value;
+	}
+
+	bits = sign | ((exponent == 0x1fU) ? 0x7f800000U : ((exponent + 112) << 23)) |
+	       (mantissa << 13);
+	memcpy(&value, &bits, sizeof(value));
+
+	return value;
+}
+
+static inline void widen_f16(uint32_t pair, float *p_lo, float *p_hi)
+{
+	*p_lo = f16_to_f32(pair & 0xffffU);
+	*p_hi = f16_to_f32(pair >> 16);
+}
+
+#endif
+
+/* A bf16 is the high half of an f32, widening is a shift */
+static inline void widen_bf16(uint32_t pair, float *p_lo, float *p_hi)
+{
+	uint32_t lo = pair << 16;
+	uint32_t hi = pair & 0xffff0000U;
+
+	memcpy(p_lo, &lo, sizeof(*p_lo));
+	memcpy(p_hi, &hi, sizeof(*p_hi));
+}
+
+typedef void (*widen_t)(uint32_t pair, float *p_lo, float *p_hi);
+
+/* Add 16-bit weight links to the sum in link order, a source of bias_idx or above is the bias */
+static inline float packed_links_h16(widen_t widen, const union app_nn_packed_word **pp,
+				     uint16_t num, const float *p_src, uint16_t bias_idx,
+				     float sum)
+{
+	const union app_nn_packed_word *p = *pp;
+
+	for (uint16_t i = 0; i < num; i += 2, p += 2) {
+		uint16_t idx = p[0].u16[0];
+		float w0;
+		float w1;
+
+		widen(p[1].u32, &w0, &w1);
+
+		sum += w0 * ((idx < bias_idx) ? p_src[idx] : 1.0f);
+		if ((i + 1) < num) {
+			idx = p[0].u16[1];
+			sum += w1 * ((idx < bias_idx) ? p_src[idx] : 1.0f);
+		}
+	}
+
+	*pp = p;
+
+	return sum;
+}
+
+/* Evaluate the neuron of one 16-bit weight record, returns the next record */
+static inline const union app_nn_packed_word *packed_neuron_h16(widen_t widen,
+								const union app_nn_packed_word *p,
+								float *p_neurons,
+								const float *p_inputs,
+								uint16_t inputs_num)
+{
+	uint16_t internal_num = p[0].u16[0];
+	uint16_t external_num = p[0].u16[1] & ~APP_NN_PACKED_ACT_CLAMP;
+	bool clamp = (p[0].u16[1] & APP_NN_PACKED_ACT_CLAMP) != 0;
+	uint16_t slot = p[1].u16[0];
+	float act = p[2].f32;
+	float sum;
+
+	p += 3;
+
+	sum = packed_links_h16(widen, &p, internal_num, p_neurons, UINT16_MAX, 0.0f);
+	sum = packed_links_h16(widen, &p, external_num, p_inputs, inputs_num, sum);
+
+	p_neurons[slot] = activation(sum, act, clamp);
+
+	return p;
+}
+
+static inline const union app_nn_packed_word *packed_neuron_f16(const union app_nn_packed_word *p,
+								float *p_neurons,
+								const float *p_inputs,
+								uint16_t inputs_num)
+{
+	return packed_neuron_h16(widen_f16, p, p_neurons, p_inputs, inputs_num);
+}
+
+static inline const union app_nn_packed_word *packed_neuron_bf16(const union app_nn_packed_word *p,
+								 float *p_neurons,
+								 const float *p_inputs,
+								 uint16_t inputs_num)
+{
+	return packed_neuron_h16(widen_bf16, p, p_neurons, p_inputs, inputs_num);
+}
+
+typedef const union app_nn_packed_word *(*packed_neuron_t)(const union app_nn_packed_word *p,
+							   float *p_neurons,
+							   const float *p_inputs,
+							   uint16_t inputs_num);
+
+/* Inlined into each format, so the neuron function is a constant */
+static inline void packed_run(packed_neuron_t neuron, const union app_nn_packed_word *p_model,
+			      float *p_neurons, uint16_t neurons_num, const float *p_inputs,
+			      uint16_t inputs_num)
+{
+	const union app_nn_packed_word *p = p_model;
+
+	for (uint16_t n = 0; n < neurons_num; n++) {
+		p = neuron(p, p_neurons, p_inputs, inputs_num);
+	}
+}
+
+static inline bool packed_run_step(packed_neuron_t neuron, struct app_nn_packed_cursor *p_cursor,
+				   float *p_neurons, uint16_t neurons_num, const float *p_inputs,
+				   uint16_t inputs_num, uint16_t budget)
+{
+	const union app_nn_packed_word *p = p_cursor->p;
+	uint16_t n = p_cursor->n;
+	uint16_t end = ((neurons_num - n) > budget) ? (n + budget) : neurons_num;
+
+	for (; n < end; n++) {
+		p = neuron(p, p_neurons, p_inputs, inputs_num);
+	}
+
+	p_cursor->p = p;
+	p_cursor->n = n;
+
+	return n == neurons_num;
+}
+
+static inline uint16_t packed_run_early_exit(packed_neuron_t neuron,
+					     const union app_nn_packed_word *p_model,
+					     float *p_neurons, uint16_t neurons_num,
+					     const float *p_inputs, uint16_t inputs_num,
+					     const struct app_nn_packed_output *p_outputs,
+					     uint16_t outputs_num, float margin)
+{
+	const union app_nn_packed_word *p = p_model;
+	/* Outputs may be negative, the ranking starts below any of them */
+	float top = -INFINITY;
+	float second = -INFINITY;
+	uint16_t next = 0;
+	uint16_t n = 0;
+
+	while (n < neurons_num) {
+		float value;
+
+		p = neuron(p, p_neurons, p_inputs, inputs_num);
+		if (next == outputs_num || n++ != p_outputs[next].position) {
+			continue;
+		}
+
+		value = p_neurons[p_outputs[next++].slot];
+		if (value > top) {
+			second = top;
+			top = value;
+		} else if (value > second) {
+			second = value;
+		}
+
+		/* A margin needs two evaluated outputs, one alone is not ahead of anything */
+		if (next >= 2 && next < outputs_num && (top - second) > margin) {
+			for (uint16_t i = next; i < outputs_num; i++) {
+				p_neurons[p_outputs[i].slot] = 0.0f;
+			}
+			break;
+		}
+	}
+
+	return n;
+}
+
+PACKED_RAMFUNC
+void app_nn_packed_run_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+			   uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num)
+{
+	packed_run(packed_neuron_f32, p_model, p_neurons, neurons_num, p_inputs, inputs_num);
+}
+
+PACKED_RAMFUNC
+uint16_t app_nn_packed_run_early_exit_f32(const union app_nn_packed_word *p_model,
+					  float *p_neurons, uint16_t neurons_num,
+					  const float *p_inputs, uint16_t inputs_num,
+					  const struct app_nn_packed_output *p_outputs,
+					  uint16_t outputs_num, float margin)
+{
+	return packed_run_early_exit(packed_neuron_f32, p_model, p_neurons, neurons_num, p_inputs,
+				     inputs_num, p_outputs, outputs_num, margin);
+}
+
+PACKED_RAMFUNC
+bool app_nn_packed_run_step_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num,
+				uint16_t budget)
+{
+	return packed_run_step(packed_neuron_f32, p_cursor, p_neurons, neurons_num, p_inputs,
+			       inputs_num, budget);
+}
+
+PACKED_RAMFUNC
+void app_nn_packed_run_q8_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+			      uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num)
+{
+	packed_run(packed_neuron_q8, p_model, p_neurons, neurons_num, p_inputs, inputs_num);
+}
+
+PACKED_RAMFUNC
+uint16_t app_nn_packed_run_early_exit_q8_f32(const union app_nn_packed_word *p_model,
+					     float *p_neurons, uint16_t neurons_num,
+					     const float *p_inputs, uint16_t inputs_num,
+					     const struct app_nn_packed_output *p_outputs,
+					     uint16_t outputs_num, float margin)
+{
+	return packed_run_early_exit(packed_neuron_q8, p_model, p_neurons, neurons_num,
+				     p_inputs, inputs_num, p_outputs, outputs_num, margin);
+}
+
+PACKED_RAMFUNC
+bool app_nn_packed_run_step_q8_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				   uint16_t neurons_num, const float *p_inputs,
+				   uint16_t inputs_num, uint16_t budget)
+{
+	return packed_run_step(packed_neuron_q8, p_cursor, p_neurons, neurons_num, p_inputs,
+			       inputs_num, budget);
+}
+
+PACKED_RAMFUNC
+void app_nn_packed_run_unit_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num)
+{
+	packed_run(packed_neuron_unit, p_model, p_neurons, neurons_num, p_inputs, inputs_num);
+}
+
+PACKED_RAMFUNC
+uint16_t app_nn_packed_run_early_exit_unit_f32(const union app_nn_packed_word *p_model,
+					       float *p_neurons, uint16_t neurons_num,
+					       const float *p_inputs, uint16_t inputs_num,
+					       const struct app_nn_packed_output *p_outputs,
+					       uint16_t outputs_num, float margin)
+{
+	return packed_run_early_exit(packed_neuron_unit, p_model, p_neurons, neurons_num,
+				     p_inputs, inputs_num, p_outputs, outputs_num, margin);
+}
+
+PACKED_RAMFUNC
+bool app_nn_packed_run_step_unit_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				     uint16_t neurons_num, const float *p_inputs,
+				     uint16_t inputs_num, uint16_t budget)
+{
+	return packed_run_step(packed_neuron_unit, p_cursor, p_neurons, neurons_num, p_inputs,
+			       inputs_num, budget);
+}
+
+PACKED_RAMFUNC
+void app_nn_packed_run_f16_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+			       uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num)
+{
+	packed_run(packed_neuron_f16, p_model, p_neurons, neurons_num, p_inputs, inputs_num);
+}
+
+PACKED_RAMFUNC
+uint16_t app_nn_packed_run_early_exit_f16_f32(const union app_nn_packed_word *p_model,
+					      float *p_neurons, uint16_t neurons_num,
+					      const float *p_inputs, uint16_t inputs_num,
+					      const struct app_nn_packed_output *p_outputs,
+					      uint16_t outputs_num, float margin)
+{
+	return packed_run_early_exit(packed_neuron_f16, p_model, p_neurons, neurons_num,
+				     p_inputs, inputs_num, p_outputs, outputs_num, margin);
+}
+
+PACKED_RAMFUNC
+bool app_nn_packed_run_step_f16_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				    uint16_t neurons_num, const float *p_inputs,
+				    uint16_t inputs_num, uint16_t budget)
+{
+	return packed_run_step(packed_neuron_f16, p_cursor, p_neurons, neurons_num, p_inputs,
+			       inputs_num, budget);
+}
+
+PACKED_RAMFUNC
+void app_nn_packed_run_bf16_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num)
+{
+	packed_run(packed_neuron_bf16, p_model, p_neurons, neurons_num, p_inputs, inputs_num);
+}
+
+PACKED_RAMFUNC
+uint16_t app_nn_packed_run_early_exit_bf16_f32(const union app_nn_packed_word *p_model,
+					       float *p_neurons, uint16_t neurons_num,
+					       const float *p_inputs, uint16_t inputs_num,
+					       const struct app_nn_packed_output *p_outputs,
+					       uint16_t outputs_num, float margin)
+{
+	return packed_run_early_exit(packed_neuron_bf16, p_model, p_neurons, neurons_num,
+				     p_inputs, inputs_num, p_outputs, outputs_num, margin);
+}
+
+PACKED_RAMFUNC
+bool app_nn_packed_run_step_bf16_f32(struct app_nn_packed_cursor *p_cursor, float *p_neurons,
+				     uint16_t neurons_num, const float *p_inputs,
+				     uint16_t inputs_num, uint16_t budget)
+{
+	return packed_run_step(packed_neuron_bf16, p_cursor, p_neurons, neurons_num, p_inputs,
+			       inputs_num, budget);
+}
+
+/* Add one weighted source to the sums of every window, a NULL source is the bias */
+static inline void batch_accumulate(float *p_sums, const float *p_src, uint16_t stride,
+				    float weight, uint16_t batch)
+{
+	if (p_src == NULL) {
+		for (uint16_t k = 0; k < batch; k++) {
+			p_sums[k] += weight;
+		}
+		return;
+	}
+
+	for (uint16_t k = 0; k < batch; k++) {
+		p_sums[k] += weight * p_src[k * stride];
+	}
+}
+
+static inline const float *batch_input(const float *p_inputs, uint16_t inputs_num, uint16_t idx)
+{
+	return (idx < inputs_num) ? &p_inputs[idx] : NULL;
+}
+
+PACKED_RAMFUNC
+int app_nn_packed_run_batch_f32(const union app_nn_packed_word *p_model, float *p_neurons,
+				uint16_t neurons_num, const float *p_inputs, uint16_t inputs_num,
+				uint16_t batch)
+{
+	const union app_nn_packed_word *p = p_model;
+
+	if (batch > APP_NN_BATCH_MAX) {
+		return -EINVAL;
+	}
+
+	for (uint16_t n = 0; n < neurons_num; n++) {
+		uint16_t internal_num = p[0].u16[0];
+		uint16_t external_num = p[0].u16[1] & ~APP_NN_PACKED_ACT_CLAMP;
+		bool clamp = (p[0].u16[1] & APP_NN_PACKED_ACT_CLAMP) != 0;
+		float *p_dst = &p_neurons[p[1].u16[0] * batch];
+		float act = p[2].f32;
+		float sums[APP_NN_BATCH_MAX] = { 0 };
+
+		p += 3;
+
+		/* Links from the slots of earlier neurons, one weight fetch per batch */
+		for (uint16_t i = 0; i < internal_num; i += 2) {
+			batch_accumulate(sums, &p_neurons[p[0].u16[0] * batch], 1, p[1].f32, batch);
+			if ((i + 1) < internal_num) {
+				batch_accumulate(sums, &p_neurons[p[0].u16[1] * batch], 1, p[2].f32,
+						 batch);
+				p += 3;
+			} else {
+				p += 2;
+			}
+		}
+
+		/* Links from model inputs and the bias */
+		for (uint16_t i = 0; i < external_num; i += 2) {
+			batch_accumulate(sums, batch_input(p_inputs, inputs_num, p[0].u16[0]),
+					 inputs_num, p[1].f32, batch);
+			if ((i + 1) < external_num) {
+				batch_accumulate(sums, batch_input(p_inputs, inputs_num, p[0].u16[1]),
+						 inputs_num, p[2].f32, batch);
+				p += 3;
+			} else {
+				p += 2;
+			}
+		}
+
+		/* All sources are read, the destination may reuse one of their slots */
+		for (uint16_t k = 0; k < batch; k++) {
+			p_dst[k] = activation(sums[k], act, clamp);
+		}
+	}
+
+	return 0;
+}
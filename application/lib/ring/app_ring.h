@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _APP_RING_H_
+#define _APP_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Bounded single-producer, single-consumer ring of fixed-size elements.
+ *
+ * Both sides are wait-free and take no lock, so the producer may run in an
+ * ISR and the consumer in a thread, or the other way round. Each index is
+ * only written by its own side, the element is copied before the index
+ * that publishes it. Waking a consumer blocked on an empty ring is left to
+ * the caller, e.g. a semaphore given after app_ring_put().
+ */
+
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define APP_RING_CACHE_LINE CONFIG_DCACHE_LINE_SIZE
+#else
+#define APP_RING_CACHE_LINE 32
+#endif
+
+struct app_ring {
+	/* Written by the producer only */
+	atomic_t head __aligned(APP_RING_CACHE_LINE);
+	/* Written by the consumer only, on its own line to keep the sides apart */
+	atomic_t tail __aligned(APP_RING_CACHE_LINE);
+	uint8_t *buf;
+	uint32_t mask;
+	uint16_t elem_size;
+};
+
+/**
+ * @brief Statically define a ring
+ * @param _name Name of the ring
+ * @param _type Element type
+ * @param _size Number of elements, a power of two
+ */
+#define APP_RING_DEFINE(_name, _type, _size)						\
+	BUILD_ASSERT(IS_POWER_OF_TWO(_size), #_name " size must be a power of two");	\
+	static _type _name##_buf[_size];						\
+	static struct app_ring _name = {						\
+		.buf = (uint8_t *)_name##_buf,						\
+		.mask = (_size) - 1,							\
+		.elem_size = sizeof(_type),						\
+	}
+
+/**
+ * @brief Append an element (producer side)
+ * @param p_ring Ring
+ * @param p_elem Element to copy into the ring
+ * @return true on success, false if the ring is full
+ */
+static inline bool app_ring_put(struct app_ring *p_ring, const void *p_elem)
+{
+	atomic_val_t head = atomic_get(&p_ring->head);
+
+	if ((uint32_t)(head - atomic_get(&p_ring->tail)) > p_ring->mask) {
+		return false;
+	}
+
+	memcpy(p_ring->buf + (head & p_ring->mask) * p_ring->elem_size, p_elem,
+	       p_ring->elem_size);
+	atomic_set(&p_ring->head, head + 1);
+
+	return true;
+}
+
+/**
+ * @brief Remove the oldest element (consumer side)
+ * @param p_ring Ring
+ * @param p_elem Destination of the element
+ * @return true on success, false if the ring is empty
+ */
+static inline bool app_ring_get(struct app_ring *p_ring, void *p_elem)
+{
+	atomic_val_t tail = atomic_get(&p_ring->tail);
+
+	if (tail == atomic_get(&p_ring->head)) {
+		return false;
+	}
+
+	memcpy(p_elem, p_ring->buf + (tail & p_ring->mask) * p_ring->elem_size,
+	       p_ring->elem_size);
+	atomic_set(&p_ring->tail, tail + 1);
+
+	return true;
+}
+
+/**
+ * @brief Number of elements in the ring, exact on the consumer side
+ * @param p_ring Ring
+ * @return Number of elements
+ */
+static inline uint32_t app_ring_count(struct app_ring *p_ring)
+{
+	return (uint32_t)(atomic_get(&p_ring->head) - atomic_get(&p_ring->tail));
+}
+
+/**
+ * @brief Drop all elements (consumer side)
+ * @param p_ring Ring
+ */
+static inline void app_ring_flush(struct app_ring *p_ring)
+{
+	atomic_set(&p_ring->tail, atomic_get(&p_ring->head));
+}
+
+/**
+ * @brief Drop the elements put before a mark (consumer side)
+ *
+ * Lets another context empty the ring without writing the tail: it takes
+ * the mark with app_ring_mark() while the producer is stopped, the consumer
+ * drops up to it, so elements put after the mark are kept.
+ *
+ * @param p_ring Ring
+ * @param mark Value returned by app_ring_mark()
+ */
+static inline void app_ring_flush_to(struct app_ring *p_ring, atomic_val_t mark)
+{
+	if ((int32_t)(mark - atomic_get(&p_ring->tail)) > 0) {
+		atomic_set(&p_ring->tail, mark);
+	}
+}
+
+/**
+ * @brief Mark the elements put so far, for app_ring_flush_to()
+ * @param p_ring Ring
+ * @return Mark
+ */
+static inline atomic_val_t app_ring_mark(struct app_ring *p_ring)
+{
+	return atomic_get(&p_ring->head);
+}
+
+#endif /* _APP_RING_H_ */
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include "app_zbus.h"
+
+/* Shared by all deferred observers, below the sampling and inference threads */
+static K_THREAD_STACK_DEFINE(deferred_stack, CONFIG_APP_ZBUS_DEFERRED_STACK_SIZE);
+static struct k_work_q deferred_work_q;
+
+void app_zbus_deferred_put(struct app_zbus_deferred *p_deferred, const struct zbus_channel *chan)
+{
+	__ASSERT(zbus_chan_msg_size(chan) == p_deferred->p_msgq->msg_size,
+		 "Channel message size does not match the observer");
+
+	/* Called with the channel held, the message is stable while it is copied */
+	if (k_msgq_put(p_deferred->p_msgq, zbus_chan_const_msg(chan), K_NO_WAIT)) {
+		atomic_inc(&p_deferred->dropped);
+		return;
+	}
+
+	(void)k_work_submit_to_queue(&deferred_work_q, &p_deferred->work);
+}
+
+void app_zbus_deferred_work_fn(struct k_work *work)
+{
+	struct app_zbus_deferred *p_deferred = CONTAINER_OF(work, struct app_zbus_deferred, work);
+
+	if (k_msgq_get(p_deferred->p_msgq, p_deferred->p_msg, K_NO_WAIT)) {
+		return;
+	}
+
+	atomic_inc(&p_deferred->delivered);
+	p_deferred->handler(p_deferred->p_msg);
+
+	/* One message per run, so the observers sharing the queue take turns */
+	if (k_msgq_num_used_get(p_deferred->p_msgq) > 0) {
+		(void)k_work_submit_to_queue(&deferred_work_q, work);
+	}
+}
+
+void app_zbus_deferred_get_stats(struct app_zbus_deferred *p_deferred,
+				 struct app_zbus_deferred_stats *p_stats)
+{
+	p_stats->delivered = (uint32_t)atomic_get(&p_deferred->delivered);
+	p_stats->dropped = (uint32_t)atomic_get(&p_deferred->dropped);
+	p_stats->queued = k_msgq_num_used_get(p_deferred->p_msgq);
+}
+
+static int app_zbus_deferred_init(void)
+{
+	k_work_queue_start(&deferred_work_q, deferred_stack,
+			   K_THREAD_STACK_SIZEOF(deferred_stack),
+			   CONFIG_APP_ZBUS_DEFERRED_PRIORITY, &(struct k_work_queue_config){
+				   .name = "zbus_deferred",
+			   });
+
+	return 0;
+}
+
+/* Before main(), publishers may start with the first module initialized */
+SYS_INIT(app_zbus_deferred_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
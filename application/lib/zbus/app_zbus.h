@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _APP_ZBUS_H_
+#define _APP_ZBUS_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/zbus/zbus.h>
+
+/*
+ * Zbus observers in two classes. Plain listeners run in the context of the
+ * publisher while it holds the channel, so they must be short: the
+ * inference path, or copying an event into a ring. Deferred observers are
+ * listeners too, but they only copy the message into a bounded queue of
+ * their own and let a work item on a shared low priority work queue call
+ * the handler. A slow handler then never delays the publisher, and a full
+ * queue drops the newest message and counts it instead of blocking.
+ */
+
+/**
+ * @brief Handler of a deferred observer, runs on the deferred work queue
+ * @param p_msg Copy of the published message
+ */
+typedef void (*app_zbus_deferred_handler_t)(const void *p_msg);
+
+struct app_zbus_deferred {
+	struct k_work work;
+	struct k_msgq *p_msgq;
+	/* Message the handler is called with, owned by the work item */
+	void *p_msg;
+	app_zbus_deferred_handler_t handler;
+	/* Messages handed to the handler and dropped on a full queue */
+	atomic_t delivered;
+	atomic_t dropped;
+};
+
+/** Counters of a deferred observer since boot */
+struct app_zbus_deferred_stats {
+	uint32_t delivered;
+	uint32_t dropped;
+	/* Messages waiting for the handler */
+	uint32_t queued;
+};
+
+void app_zbus_deferred_work_fn(struct k_work *work);
+void app_zbus_deferred_put(struct app_zbus_deferred *p_deferred, const struct zbus_channel *chan);
+
+/**
+ * @brief Statically define a deferred observer
+ *
+ * Defines the zbus listener _name, to be added to a channel with
+ * ZBUS_CHAN_ADD_OBS() or zbus_chan_add_obs(), and _name_deferred for
+ * app_zbus_deferred_get_stats(). Messages are delivered in order.
+ *
+ * @param _name Observer name
+ * @param _msg_type Message type of the observed channels
+ * @param _depth Messages queued for the handler at most
+ * @param _handler Handler, an app_zbus_deferred_handler_t
+ */
+#define APP_ZBUS_DEFERRED_DEFINE(_name, _msg_type, _depth, _handler)			\
+	K_MSGQ_DEFINE(_name##_msgq, sizeof(_msg_type), _depth, 4);			\
+	static _msg_type _name##_msg;							\
+	static struct app_zbus_deferred _name##_deferred = {				\
+		.work = Z_WORK_INITIALIZER(app_zbus_deferred_work_fn),			\
+		.p_msgq = &_name##_msgq,						\
+		.p_msg = &_name##_msg,							\
+		.handler = _handler,							\
+	};										\
+	static void _name##_cb(const struct zbus_channel *chan)				\
+	{										\
+		app_zbus_deferred_put(&_name##_deferred, chan);				\
+	}										\
+	ZBUS_LISTENER_DEFINE(_name, _name##_cb)
+
+/**
+ * @brief Get the counters of a deferred observer
+ * @param p_deferred The _name_deferred of APP_ZBUS_DEFERRED_DEFINE()
+ * @param p_stats Counters since boot
+ */
+void app_zbus_deferred_get_stats(struct app_zbus_deferred *p_deferred,
+				 struct app_zbus_deferred_stats *p_stats);
+
+#endif /* _APP_ZBUS_H_ */
@@ -7,7 +7,12 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/zbus/zbus.h>
+
+#if defined(CONFIG_APP_BUTTON_INPUT_GPIO)
+#include <zephyr/drivers/gpio.h>
+#else
 #include <dk_buttons_and_leds.h>
+#endif
 
 #include "button.h"
 
@@ -22,114 +27,202 @@ ZBUS_CHAN_DEFINE(BUTTON_CHAN,
 		 ZBUS_MSG_INIT(0)
 )
 
-/* Button state tracking */
+/* Gesture in progress */
+enum button_phase {
+	/* Released, no gesture pending */
+	BUTTON_PHASE_IDLE,
+	/* Held, the gesture timer runs to the long press timeout */
+	BUTTON_PHASE_PRESSED,
+	/* Released, the gesture timer runs to the double press timeout */
+	BUTTON_PHASE_RELEASED,
+	/* Held after the long press was reported */
+	BUTTON_PHASE_LONG_PRESSED,
+};
+
+static void gesture_timer_handler(struct k_timer *timer);
+static K_TIMER_DEFINE(gesture_timer, gesture_timer_handler, NULL);
+
+/* Button state tracking, shared by the input and the gesture timer contexts */
+static struct k_spinlock button_lock;
 static struct {
+	enum button_phase phase;
 	uint32_t button_press_count;
-	uint64_t last_button_press_time;
-	uint32_t pressed_buttons;
-	struct k_work_delayable button_work;
-	struct k_work_delayable long_press_work;
 } button_state;
 
-/* Button pressed callback */
-static void button_pressed_callback(uint32_t button_state_mask, uint32_t has_changed)
+static void button_publish(enum button_event event)
 {
-	if (has_changed == 0) {
-		return;
-	}
+	struct button_event_msg msg = {
+		.event = event,
+	};
+	int err;
 
-	/* Handle button 1 press/release */
-	if (!(has_changed & DK_BTN1_MSK)) {
-		return;
+	/* Called in interrupt context, listeners may not block */
+	err = zbus_chan_pub(&BUTTON_CHAN, &msg, K_NO_WAIT);
+	if (err) {
+		LOG_WRN("Failed to publish button event %d: %d", event, err);
 	}
+}
 
-	/* Button pressed */
-	if (button_state_mask & DK_BTN1_MSK) {
-		int64_t now = k_uptime_get();
+/* Gesture timeout, a long press while held or the end of a press sequence */
+static void gesture_timer_handler(struct k_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&button_lock);
+	enum button_phase phase = button_state.phase;
+	uint32_t count = button_state.button_press_count;
 
-		if (now - button_state.last_button_press_time < CONFIG_APP_BUTTON_DEBOUNCE_TIME_MS) {
-			return;
+	if (phase == BUTTON_PHASE_PRESSED) {
+		button_state.phase = BUTTON_PHASE_LONG_PRESSED;
+		button_state.button_press_count = 0;
+	} else if (phase == BUTTON_PHASE_RELEASED) {
+		button_state.phase = BUTTON_PHASE_IDLE;
+		button_state.button_press_count = 0;
+	}
+	k_spin_unlock(&button_lock, key);
+
+	if (phase == BUTTON_PHASE_PRESSED) {
+		LOG_INF("Button long press detected");
+		button_publish(BUTTON_EVENT_LONG_PRESS);
+	} else if (phase == BUTTON_PHASE_RELEASED) {
+		if (count == 1) {
+			button_publish(BUTTON_EVENT_SINGLE_PRESS);
+		} else if (count == 2) {
+			button_publish(BUTTON_EVENT_DOUBLE_PRESS);
+		} else {
+			LOG_ERR("Invalid button press count: %d", count);
 		}
+	}
+}
+
+/**
+ * @brief Advance the gesture on a debounced button change
+ * @param pressed true if the button is now held
+ */
+static void button_input(bool pressed)
+{
+	k_spinlock_key_t key = k_spin_lock(&button_lock);
 
-		button_state.pressed_buttons |= DK_BTN1_MSK;
-		button_state.last_button_press_time = now;
-		button_state.button_press_count++;
+	if (pressed) {
+		if (button_state.phase == BUTTON_PHASE_IDLE ||
+		    button_state.phase == BUTTON_PHASE_RELEASED) {
+			button_state.phase = BUTTON_PHASE_PRESSED;
+			button_state.button_press_count++;
 
-		/* Start long press timer */
-		k_work_schedule(&button_state.long_press_work,
-				K_MSEC(CONFIG_APP_BUTTON_LONG_PRESS_TIMEOUT_MS));
+			/* Start long press timer */
+			k_timer_start(&gesture_timer,
+				      K_MSEC(CONFIG_APP_BUTTON_LONG_PRESS_TIMEOUT_MS), K_NO_WAIT);
 
-		LOG_DBG("Button pressed, count: %d", button_state.button_press_count);
+			LOG_DBG("Button pressed, count: %d", button_state.button_press_count);
+		}
+	} else if (button_state.phase == BUTTON_PHASE_PRESSED) {
+		button_state.phase = BUTTON_PHASE_RELEASED;
+
+		/* Wait for another press before reporting a short or double press */
+		k_timer_start(&gesture_timer, K_MSEC(CONFIG_APP_BUTTON_DOUBLE_PRESS_TIMEOUT_MS),
+			      K_NO_WAIT);
+
+		LOG_DBG("Button released");
+	} else if (button_state.phase == BUTTON_PHASE_LONG_PRESSED) {
+		button_state.phase = BUTTON_PHASE_IDLE;
 	}
-	/* Button released */
-	else {
-		button_state.pressed_buttons &= ~DK_BTN1_MSK;
 
-		/* Cancel long press timer if it was running */
-		if (k_work_delayable_is_pending(&button_state.long_press_work)) {
-			k_work_cancel_delayable(&button_state.long_press_work);
+	k_spin_unlock(&button_lock, key);
+}
 
-			/* Schedule short/double press detection */
-			k_work_reschedule(&button_state.button_work,
-					  K_MSEC(CONFIG_APP_BUTTON_DOUBLE_PRESS_TIMEOUT_MS));
+#if defined(CONFIG_APP_BUTTON_INPUT_GPIO)
+static const struct gpio_dt_spec button = GPIO_DT_SPEC_GET(DT_ALIAS(sw0), gpios);
+static struct gpio_callback button_cb;
 
-			LOG_DBG("Button released");
-		}
+/* Debounced level of the button */
+static bool button_pressed;
+
+static void debounce_timer_handler(struct k_timer *timer);
+static K_TIMER_DEFINE(debounce_timer, debounce_timer_handler, NULL);
+
+/* The level has been stable for the debounce time since the last edge */
+static void debounce_timer_handler(struct k_timer *timer)
+{
+	int level = gpio_pin_get_dt(&button);
+
+	if (level < 0 || (level > 0) == button_pressed) {
+		return;
 	}
+
+	button_pressed = level > 0;
+	button_input(button_pressed);
 }
 
-/* Long press work handler */
-static void long_press_work_handler(struct k_work *work)
+/* Every edge, bounces included, restarts the debounce time */
+static void button_edge_callback(const struct device *dev, struct gpio_callback *cb,
+				 uint32_t pins)
 {
-	ARG_UNUSED(work);
-	struct button_event_msg msg;
+	ARG_UNUSED(dev);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(pins);
 
-	/* Check if button is still pressed */
-	if (button_state.pressed_buttons & DK_BTN1_MSK) {
-		LOG_INF("Button long press detected");
+	k_timer_start(&debounce_timer, K_MSEC(CONFIG_APP_BUTTON_DEBOUNCE_TIME_MS), K_NO_WAIT);
+}
 
-		msg.event = BUTTON_EVENT_LONG_PRESS;
-		zbus_chan_pub(&BUTTON_CHAN, &msg, K_NO_WAIT);
+static int button_input_init(void)
+{
+	int err;
 
-		/* Reset button press count and state */
-		button_state.button_press_count = 0;
-		button_state.last_button_press_time = 0;
+	if (!gpio_is_ready_dt(&button)) {
+		LOG_ERR("Button GPIO not ready");
+		return -ENODEV;
+	}
+
+	err = gpio_pin_configure_dt(&button, GPIO_INPUT);
+	if (err) {
+		LOG_ERR("Failed to configure button GPIO: %d", err);
+		return err;
+	}
+
+	gpio_init_callback(&button_cb, button_edge_callback, BIT(button.pin));
+
+	err = gpio_add_callback_dt(&button, &button_cb);
+	if (err) {
+		LOG_ERR("Failed to add button callback: %d", err);
+		return err;
 	}
+
+	err = gpio_pin_interrupt_configure_dt(&button, GPIO_INT_EDGE_BOTH);
+	if (err) {
+		LOG_ERR("Failed to enable button interrupt: %d", err);
+		return err;
+	}
+
+	return 0;
 }
+#else
+/* Time of the last accepted press, only accessed from the DK library callback */
+static int64_t last_button_press_time;
 
-/* Button work handler */
-static void button_work_handler(struct k_work *work)
+/* Button pressed callback */
+static void button_pressed_callback(uint32_t button_state_mask, uint32_t has_changed)
 {
-	struct button_event_msg msg;
-
-	if (button_state.button_press_count == 1) {
-		msg.event = BUTTON_EVENT_SINGLE_PRESS;
-	} else if (button_state.button_press_count == 2) {
-		msg.event = BUTTON_EVENT_DOUBLE_PRESS;
-	} else {
-		LOG_ERR("Invalid button press count: %d", button_state.button_press_count);
-		button_state.button_press_count = 0;
-		button_state.last_button_press_time = 0;
+	/* Handle button 1 press/release */
+	if (!(has_changed & DK_BTN1_MSK)) {
 		return;
 	}
 
-	zbus_chan_pub(&BUTTON_CHAN, &msg, K_NO_WAIT);
+	/* Button pressed */
+	if (button_state_mask & DK_BTN1_MSK) {
+		int64_t now = k_uptime_get();
 
-	button_state.button_press_count = 0;
-	button_state.last_button_press_time = 0;
+		if (now - last_button_press_time < CONFIG_APP_BUTTON_DEBOUNCE_TIME_MS) {
+			return;
+		}
+
+		last_button_press_time = now;
+	}
+
+	button_input(button_state_mask & DK_BTN1_MSK);
 }
 
-int button_init(void)
+static int button_input_init(void)
 {
 	int err;
 
-	button_state.button_press_count = 0;
-	button_state.last_button_press_time = 0;
-	button_state.pressed_buttons = 0;
-
-	k_work_init_delayable(&button_state.button_work, button_work_handler);
-	k_work_init_delayable(&button_state.long_press_work, long_press_work_handler);
-
 	err = dk_buttons_init(button_pressed_callback);
 	if (err) {
 		LOG_ERR("Failed to initialize buttons: %d", err);
@@ -138,3 +231,12 @@ int button_init(void)
 
 	return 0;
 }
+#endif
+
+int button_init(void)
+{
+	button_state.phase = BUTTON_PHASE_IDLE;
+	button_state.button_press_count = 0;
+
+	return button_input_init();
+}
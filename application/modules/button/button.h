@@ -22,7 +22,10 @@ struct button_event_msg {
 	enum button_event event;
 };
 
-/* Zbus Channels */
+/*
+ * Zbus Channels, button events are published from the gesture timer in
+ * interrupt context, so listeners must not block
+ */
 ZBUS_CHAN_DECLARE(BUTTON_CHAN);
 
 /* Button Initialization */
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/fs/fcb.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+#include <errno.h>
+
+#include "capture.h"
+#include "detection.h"
+
+#if defined(CONFIG_APP_CAPTURE_COMPRESS)
+#include "sampling_codec.h"
+#endif
+
+LOG_MODULE_REGISTER(app_capture, CONFIG_APP_CAPTURE_LOG_LEVEL);
+
+BUILD_ASSERT(FIXED_PARTITION_EXISTS(capture_partition),
+	     "CONFIG_APP_CAPTURE needs a capture_partition flash partition");
+
+/* Capture thread, below the detection and report threads */
+#define CAPTURE_STACK_SIZE 1536
+#define CAPTURE_PRIORITY 12
+
+/* Length and CRC of a flash circular buffer entry, with one byte to spare */
+#define CAPTURE_ENTRY_OVERHEAD 4
+
+/* Samples per flash entry */
+#define CAPTURE_CHUNK_SAMPLES                                                                      \
+	((CONFIG_APP_CAPTURE_CHUNK_SIZE - CAPTURE_ENTRY_OVERHEAD -                                 \
+	  sizeof(struct capture_samples_header)) /                                                 \
+	 sizeof(struct sampling_history_sample))
+
+/* Samples are published up to a FIFO batch after their capture */
+#define CAPTURE_PUBLISH_DELAY_US                                                                   \
+	(SAMPLING_BATCH_MAX * USEC_PER_SEC / CONFIG_APP_SAMPLING_FREQUENCY_HZ)
+
+static struct k_spinlock capture_lock;
+static struct capture_stats capture_stats;
+
+/* Trigger of the capture in progress, owned by the capture thread while capture_busy is set */
+static struct capture_header trigger;
+static atomic_t capture_busy;
+
+#if defined(CONFIG_APP_CAPTURE_COMPRESS)
+static struct {
+	struct capture_samples_header hdr;
+	uint8_t data[CONFIG_APP_CAPTURE_CHUNK_SIZE - CAPTURE_ENTRY_OVERHEAD -
+		     sizeof(struct capture_samples_header)];
+} __packed chunk;
+
+BUILD_ASSERT(sizeof(chunk.data) >= SAMPLING_CODEC_SAMPLE_MAX,
+	     "CONFIG_APP_CAPTURE_CHUNK_SIZE is too small for an encoded sample");
+#else
+static struct {
+	struct capture_samples_header hdr;
+	struct sampling_history_sample samples[CAPTURE_CHUNK_SAMPLES];
+} __packed chunk;
+#endif
+
+static struct fcb capture_fcb;
+static struct flash_sector capture_sectors[CONFIG_APP_CAPTURE_SECTORS_MAX];
+static uint32_t capture_next_id;
+
+static K_SEM_DEFINE(capture_sem, 0, 1);
+
+static void capture_thread_fn(void *arg1, void *arg2, void *arg3);
+K_THREAD_DEFINE(capture_thread, CAPTURE_STACK_SIZE,
+		capture_thread_fn, NULL, NULL, NULL,
+		CAPTURE_PRIORITY, 0, 0);
+
+static void capture_result_callback(const struct zbus_channel *chan)
+{
+	const struct detection_result *result = zbus_chan_const_msg(chan);
+	k_spinlock_key_t key;
+
+	if (result->model != CONFIG_APP_CAPTURE_MODEL || result->predicted_class >= 32 ||
+	    !(BIT(result->predicted_class) & CONFIG_APP_CAPTURE_CLASS_MASK)) {
+		return;
+	}
+
+	if (atomic_set(&capture_busy, true)) {
+		key = k_spin_lock(&capture_lock);
+		capture_stats.skipped++;
+		k_spin_unlock(&capture_lock, key);
+		return;
+	}
+
+	trigger = (struct capture_header){
+		.type = CAPTURE_ENTRY_HEADER,
+		.model = result->model,
+		.predicted_class = result->predicted_class,
+		.timestamp_ms = result->timestamp,
+		.window_start_us = result->window_start_us,
+		.window_end_us = result->window_end_us,
+		.confidence_pct = (uint8_t)CLAMP(result->confidence * 100.0f, 0.0f, 100.0f),
+		.pre_windows = CONFIG_APP_CAPTURE_PRE_WINDOWS,
+		.post_windows = CONFIG_APP_CAPTURE_POST_WINDOWS,
+	};
+
+	k_sem_give(&capture_sem);
+}
+
+ZBUS_LISTENER_DEFINE(capture_result_listener, capture_result_callback);
+
+/* Append one entry, erasing the oldest sector when the buffer is full */
+static int capture_append(const void *data, uint16_t len)
+{
+	struct fcb_entry loc;
+	int ret;
+
+	ret = fcb_append(&capture_fcb, len, &loc);
+	if (ret == -ENOSPC) {
+		ret = fcb_rotate(&capture_fcb);
+		if (ret == 0) {
+			ret = fcb_append(&capture_fcb, len, &loc);
+		}
+	}
+
+	if (ret) {
+		return ret;
+	}
+
+	ret = flash_area_write(capture_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc), data, len);
+	if (ret) {
+		return ret;
+	}
+
+	return fcb_append_finish(&capture_fcb, &loc);
+}
+
+#if defined(CONFIG_APP_CAPTURE_COMPRESS)
+/**
+ * @brief Encode the samples from *p_index on into the chunk until it is full
+ * @return Size of the chunk entry
+ */
+static uint16_t capture_fill(const struct sampling_history_snapshot *p_snap, uint16_t *p_index,
+			     uint32_t end_us)
+{
+	struct sampling_codec_state state;
+	uint16_t i = *p_index;
+	size_t len = 0;
+	uint16_t n = 0;
+
+	sampling_codec_reset(&state);
+
+	while (len + SAMPLING_CODEC_SAMPLE_MAX <= sizeof(chunk.data) && i < p_snap->count &&
+	       (int32_t)(p_snap->samples[i].timestamp_us - end_us) <= 0) {
+		len += sampling_codec_encode(&state, p_snap->samples[i].timestamp_us,
+					     p_snap->samples[i].axes, &chunk.data[len]);
+		i++;
+		n++;
+	}
+
+	chunk.hdr = (struct capture_samples_header){
+		.type = CAPTURE_ENTRY_SAMPLES_CODED,
+		.count = n,
+	};
+	*p_index = i;
+
+	return sizeof(chunk.hdr) + len;
+}
+#else
+/**
+ * @brief Copy the samples from *p_index on into the chunk until it is full
+ * @return Size of the chunk entry
+ */
+static uint16_t capture_fill(const struct sampling_history_snapshot *p_snap, uint16_t *p_index,
+			     uint32_t end_us)
+{
+	uint16_t i = *p_index;
+	uint16_t n = 0;
+
+	while (n < ARRAY_SIZE(chunk.samples) && i < p_snap->count &&
+	       (int32_t)(p_snap->samples[i].timestamp_us - end_us) <= 0) {
+		chunk.samples[n++] = p_snap->samples[i++];
+	}
+
+	chunk.hdr = (struct capture_samples_header){
+		.type = CAPTURE_ENTRY_SAMPLES,
+		.count = n,
+	};
+	*p_index = i;
+
+	return sizeof(chunk.hdr) + n * sizeof(chunk.samples[0]);
+}
+#endif
+
+/* Write the samples of the trigger window and of the windows around it */
+static int capture_write(struct capture_header *p_trigger)
+{
+	uint32_t window_us = p_trigger->window_end_us - p_trigger->window_start_us +
+			     USEC_PER_SEC / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+	uint32_t start_us = p_trigger->window_start_us - p_trigger->pre_windows * window_us;
+	uint32_t end_us = p_trigger->window_end_us + p_trigger->post_windows * window_us;
+	int32_t wait_us = (int32_t)(end_us - sampling_time_us()) + CAPTURE_PUBLISH_DELAY_US;
+	const struct sampling_history_snapshot *p_snap;
+	k_spinlock_key_t key;
+	uint16_t i = 0;
+	int ret;
+
+	/* Let the windows after the trigger be sampled, stopped sampling cuts them short */
+	if (wait_us > 0) {
+		k_sleep(K_USEC(wait_us));
+	}
+
+	ret = sampling_history_snapshot(start_us, &p_snap);
+	if (ret) {
+		return ret;
+	}
+
+	p_trigger->id = capture_next_id++;
+
+	ret = capture_append(p_trigger, sizeof(*p_trigger));
+
+	while (ret == 0 && i < p_snap->count &&
+	       (int32_t)(p_snap->samples[i].timestamp_us - end_us) <= 0) {
+		uint16_t len = capture_fill(p_snap, &i, end_us);
+
+		chunk.hdr.id = p_trigger->id;
+
+		ret = capture_append(&chunk, len);
+		if (ret == 0) {
+			key = k_spin_lock(&capture_lock);
+			capture_stats.samples += chunk.hdr.count;
+			k_spin_unlock(&capture_lock, key);
+		}
+	}
+
+	key = k_spin_lock(&capture_lock);
+	capture_stats.lost += p_snap->lost;
+	k_spin_unlock(&capture_lock, key);
+
+	sampling_history_release(p_snap);
+
+	return ret;
+}
+
+static void capture_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	while (1) {
+		k_sem_take(&capture_sem, K_FOREVER);
+
+		ret = capture_write(&trigger);
+
+		key = k_spin_lock(&capture_lock);
+		if (ret) {
+			capture_stats.write_errors++;
+		} else {
+			capture_stats.captures++;
+		}
+		k_spin_unlock(&capture_lock, key);
+
+		if (ret) {
+			LOG_WRN("Failed to write capture %u: %d", trigger.id, ret);
+		} else {
+			LOG_INF("Capture %u of class %u written", trigger.id,
+				trigger.predicted_class);
+		}
+
+		atomic_clear(&capture_busy);
+	}
+}
+
+/* Continue the capture ids after the last capture in the buffer */
+static int capture_walk_cb(struct fcb_entry_ctx *loc_ctx, void *arg)
+{
+	struct capture_header hdr;
+	int ret;
+
+	ARG_UNUSED(arg);
+
+	if (loc_ctx->loc.fe_data_len != sizeof(hdr)) {
+		return 0;
+	}
+
+	ret = flash_area_read(loc_ctx->fap, FCB_ENTRY_FA_DATA_OFF(loc_ctx->loc), &hdr, sizeof(hdr));
+	if (ret == 0 && hdr.type == CAPTURE_ENTRY_HEADER) {
+		capture_next_id = hdr.id + 1;
+	}
+
+	return 0;
+}
+
+void capture_get_stats(struct capture_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&capture_lock);
+
+	*stats = capture_stats;
+	k_spin_unlock(&capture_lock, key);
+}
+
+int capture_init(void)
+{
+	uint32_t sector_cnt = ARRAY_SIZE(capture_sectors);
+	int ret;
+
+	ret = flash_area_get_sectors(FIXED_PARTITION_ID(capture_partition), &sector_cnt,
+				     capture_sectors);
+	if (ret) {
+		LOG_ERR("Failed to get capture partition sectors: %d", ret);
+		return ret;
+	}
+
+	capture_fcb.f_magic = CAPTURE_FCB_MAGIC;
+	capture_fcb.f_version = CAPTURE_FCB_VERSION;
+	capture_fcb.f_sector_cnt = (uint8_t)sector_cnt;
+	capture_fcb.f_scratch_cnt = 0;
+	capture_fcb.f_sectors = capture_sectors;
+
+	ret = fcb_init(FIXED_PARTITION_ID(capture_partition), &capture_fcb);
+	if (ret) {
+		LOG_ERR("Failed to open capture buffer: %d", ret);
+		return ret;
+	}
+
+	ret = fcb_walk(&capture_fcb, NULL, capture_walk_cb, NULL);
+	if (ret) {
+		LOG_WRN("Failed to read capture buffer: %d", ret);
+	}
+
+	ret = zbus_chan_add_obs(&detection_result_chan, &capture_result_listener, K_MSEC(100));
+	if (ret) {
+		LOG_ERR("Failed to observe detection results: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Capturing to %u flash sectors, next capture %u", sector_cnt, capture_next_id);
+	return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include "sampling_history.h"
+
+/* Magic of the sectors of the capture flash circular buffer, "CAPT" */
+#define CAPTURE_FCB_MAGIC 0x54504143U
+#define CAPTURE_FCB_VERSION 1
+
+/* First byte of every flash entry */
+enum capture_entry_type {
+	CAPTURE_ENTRY_HEADER = 1,
+	CAPTURE_ENTRY_SAMPLES = 2,
+	CAPTURE_ENTRY_SAMPLES_CODED = 3,
+};
+
+/**
+ * First entry of a capture, followed by its sample entries. All fields are
+ * little endian.
+ */
+struct capture_header {
+	uint8_t type;
+	uint8_t model;
+	uint16_t predicted_class;
+	/* Captures since the buffer was created, shared by the entries of a capture */
+	uint32_t id;
+	/* Uptime of the trigger result */
+	uint32_t timestamp_ms;
+	/* Capture times of the first and last sample of the trigger window */
+	uint32_t window_start_us;
+	uint32_t window_end_us;
+	uint8_t confidence_pct;
+	uint8_t pre_windows;
+	uint8_t post_windows;
+	uint8_t reserved;
+} __packed;
+
+/**
+ * Entry of consecutive samples of a capture, followed by count samples as
+ * struct sampling_history_sample, or for CAPTURE_ENTRY_SAMPLES_CODED by
+ * count samples encoded with sampling_codec_encode() from the reset state.
+ * Lost samples show as timestamp gaps.
+ */
+struct capture_samples_header {
+	uint8_t type;
+	uint8_t reserved;
+	uint16_t count;
+	uint32_t id;
+} __packed;
+
+/* Raw capture counters since boot */
+struct capture_stats {
+	/* Captures written */
+	uint32_t captures;
+	/* Trigger windows classified while a capture was in progress */
+	uint32_t skipped;
+	/* Samples written */
+	uint32_t samples;
+	/* Samples overwritten in the sampling history before they were copied */
+	uint32_t lost;
+	/* Failed flash writes, the rest of the capture is dropped */
+	uint32_t write_errors;
+};
+
+/**
+ * @brief Open the capture flash circular buffer and start watching detection results
+ * @return 0 on success, negative error code on failure
+ */
+int capture_init(void);
+
+/**
+ * @brief Get the capture counters
+ * @param stats Counters since boot
+ */
+void capture_get_stats(struct capture_stats *stats);
+
+#endif /* _CAPTURE_H_ */
@@ -8,44 +8,1636 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/zbus/zbus.h>
 #include <nrf_edgeai/nrf_edgeai.h>
-#include "nrf_edgeai_generated/nrf_edgeai_user_model.h"
+#include "detection_user_model.h"
+#include "nrf_edgeai_generated/nrf_edgeai_user_types.h"
 #include <math.h>
+#include <string.h>
+
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+#include "app_ring.h"
+#endif
+
+#include "profiling_marker.h"
+
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+#include "detection_smoothing.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+#include "detection_summary.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_HISTORY)
+#include "detection_history.h"
+#endif
+
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+#include "detection_dormant.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP)
+#include <zephyr/storage/flash_map.h>
+#include "detection_model_swap.h"
+
+/* Model image loaded at boot, from the partition when the board defines it */
+#define MODEL_PARTITION_IMAGE FIXED_PARTITION_EXISTS(model_partition)
+#else
+#define MODEL_PARTITION_IMAGE 0
+#endif
+
+#if defined(CONFIG_APP_DETECTION_REMOTE)
+#include "detection_remote.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_EXPORT_STREAM)
+#include "../sampling/sampling_stream.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+#include <zephyr/sys/atomic.h>
+#include <modem/lte_lc.h>
+#endif
+
+#if defined(CONFIG_APP_DETECTION_WARM_START)
+#include <zephyr/linker/section_tags.h>
+#include <zephyr/sys/crc.h>
+#endif
 
 #include "detection.h"
 #include "../sampling/sampling.h"
+#include "app_dsp.h"
+#include "app_log.h"
 
 LOG_MODULE_REGISTER(app_detection, CONFIG_APP_DETECTION_LOG_LEVEL);
 
-/* Zbus channel for publishing detection results */
-ZBUS_CHAN_DEFINE(detection_result_chan,
-		 struct detection_result,
-		 NULL,
-		 NULL,
-		 ZBUS_OBSERVERS_EMPTY,
-		 ZBUS_MSG_INIT(0));
+/* Zbus channel for publishing detection results */
+ZBUS_CHAN_DEFINE(detection_result_chan,
+		 struct detection_result,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+/* Zbus channel for publishing class summaries */
+ZBUS_CHAN_DEFINE(detection_summary_chan,
+		 struct detection_summary,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_EXPORT)
+/* Zbus channel for publishing the feature vectors of the windows */
+ZBUS_CHAN_DEFINE(detection_features_chan,
+		 struct detection_features,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+#endif
+
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+/* Zbus channel for publishing runs of windows classified at rest */
+ZBUS_CHAN_DEFINE(detection_dormant_chan,
+		 struct detection_dormant_event,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SCORE_TASKS)
+/* Zbus channel for publishing regression and anomaly detection results */
+ZBUS_CHAN_DEFINE(detection_score_chan,
+		 struct detection_score,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+/* Anomaly score quantile and threshold margin */
+#define ANOMALY_QUANTILE (CONFIG_APP_DETECTION_ANOMALY_QUANTILE_PERMILLE / 1000.0f)
+#define ANOMALY_MARGIN (CONFIG_APP_DETECTION_ANOMALY_MARGIN_PCT / 100.0f)
+#endif
+
+/* Model input value type, magnitudes are in milli-g */
+#if defined(CONFIG_APP_DETECTION_INPUT_I16)
+typedef int16_t detection_input_t;
+#define DETECTION_INPUT_TYPE NRF_EDGEAI_INPUT_I16
+/* Raw counts to milli-g in Q16.16: range_g * 1000 / 32768 * 65536 */
+#define ACCEL_MG_SCALE_Q16 (CONFIG_APP_SAMPLING_ACCEL_RANGE_G * 2000U)
+#else
+typedef float detection_input_t;
+#define DETECTION_INPUT_TYPE NRF_EDGEAI_INPUT_F32
+#endif
+
+/* Models loaded at runtime are checked at init, the generated one already here */
+BUILD_ASSERT(_Generic((nrf_user_input_t)0, detection_input_t: 1, default: 0),
+	     "Generated model input type does not match CONFIG_APP_DETECTION_INPUT_I16");
+
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+/**
+ * @brief Gate stage of a cascaded model, a threshold tree on window statistics
+ *
+ * A window with a magnitude range and, checked only then, a standard
+ * deviation within the limits is classified as reject_class without running
+ * the model.
+ */
+struct detection_gate {
+	float range_max_mg;
+	float stddev_max_mg;
+	uint16_t reject_class;
+};
+
+/* Still windows of the activity model are Idle, the limits can be tuned at runtime */
+static struct detection_gate activity_gate = {
+	.range_max_mg = CONFIG_APP_DETECTION_CASCADE_RANGE_MG,
+	.stddev_max_mg = CONFIG_APP_DETECTION_CASCADE_STDDEV_MG,
+	.reject_class = 0,
+};
+#endif
+
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+/* Per-sample values a model input feature can be fed from */
+enum detection_channel {
+	/* Acceleration in milli-g */
+	DETECTION_CHANNEL_ACCEL_X,
+	DETECTION_CHANNEL_ACCEL_Y,
+	DETECTION_CHANNEL_ACCEL_Z,
+	/* Angular rate in degrees per second */
+	DETECTION_CHANNEL_GYRO_X,
+	DETECTION_CHANNEL_GYRO_Y,
+	DETECTION_CHANNEL_GYRO_Z,
+	/* Acceleration magnitude in milli-g */
+	DETECTION_CHANNEL_ACCEL_MAGNITUDE,
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+	/* Acceleration without gravity in milli-g */
+	DETECTION_CHANNEL_LIN_ACCEL_X,
+	DETECTION_CHANNEL_LIN_ACCEL_Y,
+	DETECTION_CHANNEL_LIN_ACCEL_Z,
+#endif
+	DETECTION_CHANNEL_COUNT,
+};
+
+/* Channels read from the gyroscope, or from the orientation filter that needs it */
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+#define DETECTION_GYRO_CHANNELS                                                                   \
+	(BIT(DETECTION_CHANNEL_GYRO_X) | BIT(DETECTION_CHANNEL_GYRO_Y) |                          \
+	 BIT(DETECTION_CHANNEL_GYRO_Z) | BIT(DETECTION_CHANNEL_LIN_ACCEL_X) |                     \
+	 BIT(DETECTION_CHANNEL_LIN_ACCEL_Y) | BIT(DETECTION_CHANNEL_LIN_ACCEL_Z))
+#else
+#define DETECTION_GYRO_CHANNELS                                                                   \
+	(BIT(DETECTION_CHANNEL_GYRO_X) | BIT(DETECTION_CHANNEL_GYRO_Y) |                          \
+	 BIT(DETECTION_CHANNEL_GYRO_Z))
+#endif
+BUILD_ASSERT(DETECTION_CHANNEL_COUNT <= 32, "Channel masks are 32 bits");
+
+/* The activity model takes the acceleration magnitude only */
+static const uint8_t activity_channels[] = {
+	DETECTION_CHANNEL_ACCEL_MAGNITUDE,
+};
+#endif
+
+/**
+ * @brief Model instance fed from the shared IMU sample stream
+ */
+struct detection_model {
+	const char *name;
+	/* Generated model accessor, input feed and inference entry point */
+	nrf_edgeai_t *(*get)(void);
+	nrf_edgeai_err_t (*feed_inputs)(nrf_edgeai_t *p_edgeai, const void *p_input_values,
+					uint16_t num_values);
+	nrf_edgeai_err_t (*run_inference)(nrf_edgeai_t *p_edgeai);
+	/* Static memory report, NULL if the generated model has none */
+	void (*footprint)(nrf_edgeai_user_model_footprint_t *p_footprint);
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+	/* Per-class smoothing thresholds, NULL for the Kconfig defaults */
+	const struct detection_smoothing_config *smoothing_config;
+#endif
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+	/* Gate stage run before the model, NULL to run the model on every window */
+	struct detection_gate *gate;
+#endif
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+	/* Channel of each model input feature, in the order of the model inputs */
+	const uint8_t *channels;
+	uint8_t channels_num;
+#endif
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+	/* Classes at rest, one bit per class, 0 for a model not tracked */
+	uint32_t dormant_classes;
+#endif
+
+	nrf_edgeai_t *p_model;
+	/* Input window size, shift and number of samples fed into the current window */
+	uint16_t window_size;
+	uint16_t window_shift;
+	uint16_t window_fill;
+	/* Samples still discarded before the first window, staggers the window boundaries */
+	uint16_t phase_skip;
+	/* Track last published class to avoid spam */
+	uint16_t last_published_class;
+	/* Full windows and the inferences run on them */
+	uint32_t windows;
+	uint32_t inferences;
+	/* Window boundaries per inference and boundaries since the last inference */
+	uint16_t inference_stride;
+	uint16_t stride_count;
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+	/* Level of the last quiescent window inference ran on, valid if gate_armed */
+	bool gate_armed;
+	float gate_level;
+	uint32_t gated_windows;
+#endif
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+	uint32_t rejected_windows;
+#endif
+#if defined(CONFIG_APP_DETECTION_SPIKE_TRIGGER)
+	uint32_t event_windows;
+#endif
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+	/* Full window held in the other ping-pong buffer until the radio is idle */
+	bool deferred;
+	uint32_t deferred_end_us;
+	uint32_t deferred_windows;
+#endif
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+	struct detection_smoothing smoothing;
+#endif
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+	struct detection_summary_state summary;
+#endif
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+	struct detection_dormant dormant;
+#endif
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP)
+	/* Slots of updated models, p_model points to one of them once taken */
+	struct detection_model_swap swap;
+#endif
+#if defined(CONFIG_APP_DETECTION_SCORE_TASKS)
+	/* Running quantile of the calibration scores and the threshold derived from it */
+	struct app_dsp_quantile anomaly_quantile;
+	uint32_t anomaly_windows;
+	float anomaly_threshold;
+#endif
+};
+
+static nrf_edgeai_err_t user_model_run_inference(nrf_edgeai_t *p_edgeai)
+{
+#if defined(CONFIG_APP_DETECTION_STEPPED_INFERENCE)
+	nrf_edgeai_err_t res;
+
+	while ((res = nrf_edgeai_user_model_instance_run_inference_step(
+			p_edgeai, CONFIG_APP_DETECTION_STEP_NEURONS)) == NRF_EDGEAI_ERR_INPROGRESS) {
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+		/* Samples queue in the ring meanwhile, the window is not fed until the end */
+		k_yield();
+#endif
+	}
+
+	return res;
+#elif defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE)
+	return nrf_edgeai_user_model_instance_run_inference(p_edgeai);
+#else
+	return nrf_edgeai_run_inference(p_edgeai);
+#endif
+}
+
+/*
+ * Model registry, every model gets each sample. Models must not share a
+ * generated model since its buffers are static. Result model indices follow
+ * this table.
+ */
+static struct detection_model models[] = {
+	{
+		.name = "activity",
+		.get = nrf_edgeai_user_model,
+		.feed_inputs = nrf_edgeai_user_model_feed_inputs,
+		.run_inference = user_model_run_inference,
+		.footprint = nrf_edgeai_user_model_footprint,
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+		.gate = &activity_gate,
+#endif
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+		.channels = activity_channels,
+		.channels_num = ARRAY_SIZE(activity_channels),
+#endif
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+		/* Idle and Placed */
+		.dormant_classes = BIT(0) | BIT(6),
+#endif
+	},
+};
+
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+/* Number of samples the inference thread drains per feed call */
+#define INFERENCE_BLOCK_SIZE 32
+
+struct ring_entry {
+	detection_input_t value;
+	uint32_t time_us;
+};
+
+/* Single producer (IMU listeners), single consumer (inference thread) ring */
+APP_RING_DEFINE(sample_ring, struct ring_entry, CONFIG_APP_DETECTION_RING_SIZE);
+static uint32_t ring_dropped;
+/* Samples of the previous session, dropped by the inference thread on restart */
+static atomic_t ring_restart_mark;
+static atomic_t ring_restart_pending;
+static K_SEM_DEFINE(inference_sem, 0, 1);
+/* Held by the inference thread while it feeds the models, and by the benchmark */
+static K_MUTEX_DEFINE(inference_lock);
+
+static void inference_thread_fn(void *arg1, void *arg2, void *arg3);
+K_THREAD_DEFINE(inference_thread, CONFIG_APP_DETECTION_THREAD_STACK_SIZE,
+		inference_thread_fn, NULL, NULL, NULL,
+		CONFIG_APP_DETECTION_THREAD_PRIORITY, 0, 0);
+#endif
+
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+/* RRC connected, the modem may transmit at any time */
+static atomic_t modem_connected;
+
+static void detection_lte_handler(const struct lte_lc_evt *const evt)
+{
+	if (evt->type == LTE_LC_EVT_RRC_UPDATE) {
+		atomic_set(&modem_connected, evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED);
+	}
+}
+#endif
+
+/* Accelerometer scale from imu_value_t to milli-g (1g = 9.80665 m/s^2) */
+#define ACCEL_MG_SCALE (SAMPLING_ACCEL_SCALE * 1000.0f / 9.80665f)
+
+/* Distance in imu_value_t elements between two consecutive samples */
+#define IMU_SAMPLE_STRIDE (sizeof(struct imu_sample) / sizeof(imu_value_t))
+
+BUILD_ASSERT(sizeof(struct imu_sample) % sizeof(imu_value_t) == 0,
+	     "Samples must be a whole number of values apart");
+
+/* Sequence number of the next sample expected from sampling */
+static uint32_t next_seq;
+static struct detection_gap_stats gap_stats;
+
+/* Capture time of the last sample and running average of the sample period */
+#define SAMPLE_PERIOD_AVG_WEIGHT 16
+static uint32_t last_time_us;
+static uint32_t sample_period_us = USEC_PER_SEC / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+
+#if defined(CONFIG_APP_DETECTION_GAP_PAD) && defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+/* Last sample fed, repeated in place of lost samples */
+static struct imu_sample last_sample;
+#elif defined(CONFIG_APP_DETECTION_GAP_PAD)
+/* Last magnitude fed, repeated in place of lost samples */
+static detection_input_t last_input;
+#endif
+
+/**
+ * @brief Calculate acceleration magnitudes from 3-axis accelerometer data
+ * @param samples IMU samples, accelerometer in imu_value_t units
+ * @param num Number of samples
+ * @param magnitudes Output acceleration magnitudes in milli-g
+ */
+static void calculate_accel_magnitudes(const struct imu_sample *samples, uint16_t num,
+				       detection_input_t *magnitudes)
+{
+#if defined(CONFIG_APP_DETECTION_INPUT_I16)
+	app_dsp_magnitude_i16_q16(&samples->accel_x, IMU_SAMPLE_STRIDE, num,
+				  ACCEL_MG_SCALE_Q16, magnitudes);
+#elif defined(CONFIG_APP_SAMPLING_FORMAT_FLOAT)
+	app_dsp_magnitude_f32(&samples->accel_x, IMU_SAMPLE_STRIDE, num,
+			      ACCEL_MG_SCALE, magnitudes);
+#elif defined(CONFIG_APP_SAMPLING_FORMAT_RAW)
+	app_dsp_magnitude_i16(&samples->accel_x, IMU_SAMPLE_STRIDE, num,
+			      ACCEL_MG_SCALE, magnitudes);
+#else
+	for (uint16_t i = 0; i < num; i++) {
+		const struct imu_sample *sample = &samples[i];
+
+		/* Calculate magnitude: sqrt(x^2 + y^2 + z^2) */
+		double magnitude = sqrt(sample->accel_x * sample->accel_x +
+					sample->accel_y * sample->accel_y +
+					sample->accel_z * sample->accel_z);
+
+		/* Convert from m/s^2 to milli-g (1g = 9.80665 m/s^2) */
+		magnitudes[i] = (float)(magnitude / 9.80665 * 1000.0);
+	}
+#endif
+}
+
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE) || defined(CONFIG_APP_DETECTION_CASCADE)
+/**
+ * @brief Get the magnitude range of the full window
+ * @param model Model whose window is full
+ * @param p_min Smallest magnitude in milli-g
+ * @param p_max Largest magnitude in milli-g
+ */
+static void window_min_max(const struct detection_model *model, float *p_min, float *p_max)
+{
+	const nrf_edgeai_t *p_model = model->p_model;
+
+#if defined(CONFIG_APP_DETECTION_INPUT_I16)
+	int16_t min_i16;
+	int16_t max_i16;
+
+	nrf_dsp_min_max_i16(p_model->input.window_memory.p_i16, model->window_size,
+			    &min_i16, &max_i16);
+	*p_min = min_i16;
+	*p_max = max_i16;
+#else
+	nrf_dsp_min_max_f32(p_model->input.window_memory.p_f32, model->window_size, p_min, p_max);
+#endif
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+/* Magnitude range of a quiescent window, can be tuned at runtime */
+static float energy_gate_threshold_mg = CONFIG_APP_DETECTION_ENERGY_GATE_THRESHOLD_MG;
+
+/**
+ * @brief Check whether the full window is quiescent and matches the last inferred one
+ *
+ * A window is quiescent if its magnitude range is within the gate threshold.
+ * The first quiescent window at a given level still runs inference, later
+ * ones at the same level reuse its result.
+ *
+ * @return true if inference can be skipped for this window
+ */
+static bool window_unchanged(struct detection_model *model)
+{
+	float min;
+	float max;
+
+	window_min_max(model, &min, &max);
+
+	bool quiescent = (max - min) <= energy_gate_threshold_mg;
+	float level = (min + max) / 2.0f;
+
+	if (quiescent && model->gate_armed &&
+	    fabsf(level - model->gate_level) <= energy_gate_threshold_mg) {
+		return true;
+	}
+
+	model->gate_armed = quiescent;
+	model->gate_level = level;
+
+	return false;
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+/**
+ * @brief Run the gate stage of a model on the full window
+ * @return true if the window is rejected and the model need not run
+ */
+static bool window_rejected(const struct detection_model *model)
+{
+	const struct detection_gate *gate = model->gate;
+	const nrf_edgeai_t *p_model = model->p_model;
+	float stddev;
+	float min;
+	float max;
+
+	if (!gate) {
+		return false;
+	}
+
+	/* The range is cheaper, the standard deviation is only needed for a small one */
+	window_min_max(model, &min, &max);
+	if (max - min > gate->range_max_mg) {
+		return false;
+	}
+
+#if defined(CONFIG_APP_DETECTION_INPUT_I16)
+	stddev = nrf_dsp_stddev_i16(p_model->input.window_memory.p_i16, model->window_size, NULL);
+#else
+	stddev = nrf_dsp_stddev_f32(p_model->input.window_memory.p_f32, model->window_size, NULL);
+#endif
+
+	return stddev <= gate->stddev_max_mg;
+}
+#endif
+
+/**
+ * @brief Check whether a model is a classifier
+ * @param p_model Generated model
+ * @return true for classification models, which publish classes instead of scores
+ */
+static bool model_classifies(const nrf_edgeai_t *p_model)
+{
+	nrf_edgeai_model_task_t task = nrf_edgeai_model_task(p_model);
+
+	return task == NRF_EDGEAI_TASK_MULT_CLASS || task == NRF_EDGEAI_TASK_BIN_CLASS;
+}
+
+/**
+ * @brief Capture time of the first sample of the full window
+ * @param model Model whose window is full
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static uint32_t window_start_us(const struct detection_model *model, uint32_t window_end_us)
+{
+	/* Sample times within the window are not kept, only its end */
+	return window_end_us - (model->window_size - 1) * sample_period_us;
+}
+
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+/**
+ * @brief Publish the run of windows at rest that just reached CONFIG_APP_DORMANT_WINDOWS
+ * @param model Model whose window is full
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static void publish_dormant(struct detection_model *model, uint32_t window_end_us)
+{
+	struct detection_dormant_event event = {
+		.model = model - models,
+		.windows = model->dormant.windows,
+		.window_end_us = window_end_us,
+	};
+	int ret;
+
+	ret = zbus_chan_pub(&detection_dormant_chan, &event, K_NO_WAIT);
+	if (ret) {
+		APP_LOG_WRN_RATELIMIT("Failed to publish %s dormant event: %d", model->name, ret);
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_LAZY_DECODE)
+/**
+ * @brief Whether the model needs the probabilities of every window, not only of class changes
+ * @param model Model instance
+ */
+static bool model_tracks_dormant(const struct detection_model *model)
+{
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+	return model->dormant_classes != 0;
+#else
+	ARG_UNUSED(model);
+	return false;
+#endif
+}
+#endif
+
+/**
+ * @brief Post-process the classification of the full window and publish it on class change
+ * @param model Model whose window is full
+ * @param predicted_class Class of the window
+ * @param p_probabilities Class probabilities of the window, NULL for a repeated lazy class
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static void publish_classification(struct detection_model *model, uint16_t predicted_class,
+				   const float *p_probabilities, uint32_t window_end_us)
+{
+	float confidence = 0.0f;
+
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+	/* Publish the stable class instead of the class of this window */
+	predicted_class = detection_smoothing_update(&model->smoothing, p_probabilities,
+						     &confidence);
+	if (predicted_class == DETECTION_SMOOTHING_CLASS_NONE) {
+		return;
+	}
+#else
+	/* Only a class change is published with its confidence */
+	if (predicted_class != model->last_published_class) {
+		confidence = p_probabilities[predicted_class];
+	}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+	detection_summary_update(&model->summary, predicted_class, k_uptime_get_32());
+#endif
+
+#if defined(CONFIG_APP_DETECTION_HISTORY) || defined(CONFIG_APP_DORMANT_SLEEP)
+	/* Every classified window, with the confidence of a repeated class as well */
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+	float window_confidence = confidence;
+#else
+	float window_confidence = p_probabilities ? p_probabilities[predicted_class] : 0.0f;
+#endif
+#endif
+
+#if defined(CONFIG_APP_DETECTION_HISTORY)
+	detection_history_add(model - models, predicted_class, window_confidence,
+			      window_start_us(model, window_end_us), window_end_us);
+#endif
+
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+	if (detection_dormant_update(&model->dormant, predicted_class, window_confidence)) {
+		publish_dormant(model, window_end_us);
+	}
+#endif
+
+	/* Only publish to Zbus if class has changed (avoid spam) */
+	if (predicted_class != model->last_published_class) {
+		/* Prepare detection result */
+		struct detection_result result = {
+			.model = model - models,
+			.predicted_class = predicted_class,
+			.confidence = confidence,
+			.timestamp = k_uptime_get_32(),
+			.window_start_us = window_start_us(model, window_end_us),
+			.window_end_us = window_end_us,
+			.latency_us = sampling_time_us() - window_end_us,
+		};
+
+		/* Publish result to Zbus */
+		int ret = zbus_chan_pub(&detection_result_chan, &result, K_NO_WAIT);
+		if (ret) {
+			APP_LOG_WRN_RATELIMIT("Failed to publish detection result: %d", ret);
+		} else {
+			/* Update last published class */
+			model->last_published_class = predicted_class;
+		}
+	}
+}
+
+#if defined(CONFIG_APP_DETECTION_SCORE_TASKS)
+/**
+ * @brief Restart the anomaly threshold calibration of a model
+ * @param model Model instance
+ */
+static void anomaly_calibration_reset(struct detection_model *model)
+{
+	app_dsp_quantile_init_f32(&model->anomaly_quantile, ANOMALY_QUANTILE);
+	model->anomaly_windows = 0;
+	model->anomaly_threshold = 0.0f;
+}
+
+/**
+ * @brief Compare the anomaly score of the full window against the calibrated threshold
+ *
+ * The scores of the first windows feed a running quantile, the threshold
+ * is fixed from it once calibration ends. Later scores do not move the
+ * threshold, so a lasting anomaly is not learned as normal.
+ *
+ * @param model Model whose window is full
+ * @param p_score Score message, the threshold fields are filled in
+ */
+static void anomaly_classify(struct detection_model *model, struct detection_score *p_score)
+{
+	float score = p_score->outputs[0];
+
+	if (model->anomaly_windows < CONFIG_APP_DETECTION_ANOMALY_CALIBRATION_WINDOWS) {
+		app_dsp_quantile_update_f32(&model->anomaly_quantile, &score, 1);
+
+		if (++model->anomaly_windows == CONFIG_APP_DETECTION_ANOMALY_CALIBRATION_WINDOWS) {
+			model->anomaly_threshold =
+				app_dsp_quantile_get_f32(&model->anomaly_quantile) * ANOMALY_MARGIN;
+			LOG_INF("%s anomaly threshold calibrated: %d/1000", model->name,
+				(int)(model->anomaly_threshold * 1000.0f));
+		}
+	}
+
+	p_score->calibrated =
+		model->anomaly_windows >= CONFIG_APP_DETECTION_ANOMALY_CALIBRATION_WINDOWS;
+	p_score->threshold = model->anomaly_threshold;
+	p_score->anomalous = p_score->calibrated && score > model->anomaly_threshold;
+}
+
+/**
+ * @brief Publish the output of a regression or anomaly detection model for the full window
+ * @param model Model whose window is full
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static void publish_score(struct detection_model *model, uint32_t window_end_us)
+{
+	const nrf_edgeai_t *p_model = model->p_model;
+	struct detection_score score = {
+		.model = model - models,
+		.timestamp = k_uptime_get_32(),
+		.window_start_us = window_start_us(model, window_end_us),
+		.window_end_us = window_end_us,
+		.latency_us = sampling_time_us() - window_end_us,
+	};
+	int ret;
+
+	if (nrf_edgeai_model_task(p_model) == NRF_EDGEAI_TASK_ANOMALY_DETECTION) {
+		score.task = DETECTION_SCORE_ANOMALY;
+		score.outputs_num = 1;
+		score.outputs[0] = p_model->decoded_output.anomaly.score;
+		anomaly_classify(model, &score);
+	} else {
+		score.task = DETECTION_SCORE_REGRESSION;
+		score.outputs_num = p_model->decoded_output.regression.outputs_num;
+		memcpy(score.outputs, p_model->decoded_output.regression.p_outputs,
+		       score.outputs_num * sizeof(score.outputs[0]));
+	}
+
+	ret = zbus_chan_pub(&detection_score_chan, &score, K_NO_WAIT);
+	if (ret) {
+		APP_LOG_WRN_RATELIMIT("Failed to publish %s score: %d", model->name, ret);
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_EXPORT)
+/**
+ * @brief Publish the scaled features the model just ran inference on
+ *
+ * The feature buffer of the model holds them until its next inference, with
+ * CONFIG_APP_DETECTION_SHARED_SCRATCH until the next inference of any model.
+ *
+ * @param model Model whose window is full
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static void publish_features(struct detection_model *model, uint32_t window_end_us)
+{
+	const nrf_edgeai_t *p_model = model->p_model;
+	struct detection_features features = {
+		.model = model - models,
+		.features_num = MIN(p_model->p_dsp->features.overall_num, DETECTION_FEATURES_MAX),
+		.predicted_class = UINT16_MAX,
+		.window_end_us = window_end_us,
+	};
+	int ret;
+
+	if (model_classifies(p_model)) {
+		const float *p_probabilities = p_model->decoded_output.classif.probabilities.p_f32;
+
+		features.predicted_class = p_model->decoded_output.classif.predicted_class;
+		if (p_probabilities) {
+			features.confidence = p_probabilities[features.predicted_class];
+		}
+	}
+
+	memcpy(features.features, p_model->p_dsp->features.extracted_memory.p_f32,
+	       features.features_num * sizeof(features.features[0]));
+
+	ret = zbus_chan_pub(&detection_features_chan, &features, K_NO_WAIT);
+	if (ret) {
+		APP_LOG_WRN_RATELIMIT("Failed to publish %s features: %d", model->name, ret);
+	}
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_EXPORT_STREAM)
+	/* A full stream buffer drops the packet, the host sees a sequence gap */
+	(void)sampling_stream_send_features(features.model, features.predicted_class,
+					    window_end_us, features.features,
+					    features.features_num);
+#endif
+}
+#endif
+
+#if !defined(CONFIG_APP_DETECTION_REMOTE)
+/**
+ * @brief Run inference on the full window and publish the result on class change
+ * @param model Model whose window is full
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static void run_inference_and_publish(struct detection_model *model, uint32_t window_end_us)
+{
+	const nrf_edgeai_t *p_model = model->p_model;
+	nrf_edgeai_err_t res;
+
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+	if (window_unchanged(model)) {
+		model->gated_windows++;
+		LOG_DBG("Quiescent %s window, inference skipped (%u total)", model->name,
+			model->gated_windows);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+	if (window_rejected(model)) {
+		/* One-hot output of the reject class, the model output buffers are left as is.
+		 * Models share it, so the class of the previous gated model is cleared first.
+		 */
+		static float gate_output[DETECTION_GATE_CLASSES_MAX];
+
+		model->rejected_windows++;
+		LOG_DBG("%s window rejected by the gate stage (%u total)", model->name,
+			model->rejected_windows);
+		memset(gate_output, 0, sizeof(gate_output));
+		gate_output[model->gate->reject_class] = 1.0f;
+		publish_classification(model, model->gate->reject_class, gate_output,
+				       window_end_us);
+		return;
+	}
+#endif
+
+	model->inferences++;
+	res = model->run_inference(model->p_model);
+
+	profiling_marker_begin(PROFILING_MARKER_PUBLISH);
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_EXPORT)
+	if (res == NRF_EDGEAI_ERR_SUCCESS) {
+		publish_features(model, window_end_us);
+	}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SCORE_TASKS)
+	if (res == NRF_EDGEAI_ERR_SUCCESS && !model_classifies(p_model)) {
+		publish_score(model, window_end_us);
+	} else
+#endif
+	if (res == NRF_EDGEAI_ERR_SUCCESS) {
+		uint16_t predicted_class = p_model->decoded_output.classif.predicted_class;
+		const float *p_probabilities = p_model->decoded_output.classif.probabilities.p_f32;
+
+#if defined(CONFIG_APP_DETECTION_LAZY_DECODE)
+		/*
+		 * The decode left the probabilities, a repeated class does not need them
+		 * unless the model counts its windows at rest
+		 */
+		if (predicted_class != model->last_published_class || model_tracks_dormant(model)) {
+			p_probabilities = nrf_edgeai_user_model_probabilities(model->p_model);
+		}
+#endif
+		publish_classification(model, predicted_class, p_probabilities, window_end_us);
+	} else {
+		APP_LOG_ERR_RATELIMIT("%s inference failed: %d", model->name, res);
+	}
+
+	profiling_marker_end(PROFILING_MARKER_PUBLISH);
+}
+
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+/**
+ * @brief Run inference on the window a model held back while the radio was connected
+ * @param model Model with a deferred window
+ */
+static void model_run_deferred(struct detection_model *model)
+{
+	model->deferred = false;
+	run_inference_and_publish(model, model->deferred_end_us);
+}
+#endif
+#endif
+
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP)
+/**
+ * @brief Switch to an updated model loaded since the last window boundary
+ *
+ * The slots share the input window of the built-in model, so the window in
+ * progress carries over to the updated model.
+ *
+ * @param model Model instance at a window boundary
+ */
+static void model_take_update(struct detection_model *model)
+{
+	nrf_edgeai_t *p_model = detection_model_swap_take(&model->swap);
+
+	if (!p_model) {
+		return;
+	}
+
+	model->p_model = p_model;
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+	/* The last result came from the previous model, run the next window */
+	model->gate_armed = false;
+#endif
+#if defined(CONFIG_APP_DETECTION_SCORE_TASKS)
+	/* Scores of another network are on another scale */
+	anomaly_calibration_reset(model);
+#endif
+	LOG_INF("Updated %s model in use, %u neurons", model->name,
+		p_model->model.meta.neurons_num);
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SHARED_SCRATCH)
+/* Models run inference one at a time, in the listener or the inference thread */
+uint8_t detection_scratch[CONFIG_APP_DETECTION_SCRATCH_SIZE] __aligned(8);
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_CACHE)
+struct app_dsp_feature_cache detection_feature_cache;
+
+/* Samples fed to the models so far, the last sample of a window identifies it */
+static uint32_t stream_seq;
+#endif
+
+/**
+ * @brief Samples a model discards before its first window
+ *
+ * Spreads the first window boundaries of the models evenly over one window
+ * shift, so inferences of models with equal shifts never fall on the same
+ * sample. With the feature cache the windows stay aligned instead, so
+ * models on equal windows share their features.
+ *
+ * @param model Model instance
+ * @return Window phase in samples
+ */
+static uint16_t model_window_phase(const struct detection_model *model)
+{
+#if defined(CONFIG_APP_DETECTION_FEATURE_CACHE)
+	ARG_UNUSED(model);
+	return 0;
+#else
+	return (model - models) * model->window_shift / ARRAY_SIZE(models);
+#endif
+}
+
+#if defined(CONFIG_APP_DETECTION_REMOTE)
+/**
+ * @brief Publish a classification received from the remote core
+ *
+ * The remote core runs the models of the registry in registry order, the
+ * result is post-processed here as if inference had run locally.
+ *
+ * @param p_result Validated result message
+ */
+static void remote_result_cb(const struct detection_remote_result *p_result)
+{
+	struct detection_model *model;
+
+	if (p_result->model >= ARRAY_SIZE(models)) {
+		APP_LOG_WRN_RATELIMIT("Remote result for unknown model %u", p_result->model);
+		return;
+	}
+
+	model = &models[p_result->model];
+	if (p_result->outputs_num != nrf_edgeai_model_outputs_num(model->p_model)) {
+		APP_LOG_WRN_RATELIMIT("Remote %s model has %u classes", model->name,
+				      p_result->outputs_num);
+		return;
+	}
+
+	publish_classification(model, p_result->predicted_class, p_result->probabilities,
+			       p_result->window_end_us);
+}
+#else
+/**
+ * @brief Number of samples a model takes before its next window boundary
+ * @param model Model instance
+ * @return Samples until the window is full or the phase skip ends
+ */
+static uint16_t model_samples_to_boundary(const struct detection_model *model)
+{
+	if (model->phase_skip > 0) {
+		return model->phase_skip;
+	}
+
+	return model->window_size - model->window_fill;
+}
+
+/**
+ * @brief Feed a run of inputs that ends at most at the window boundary of the model
+ * @param model Model instance
+ * @param values Acceleration magnitudes in milli-g, or input vectors with multiple inputs
+ * @param num Number of samples
+ * @return true if the window is full and inference is due
+ */
+static bool model_feed(struct detection_model *model, const detection_input_t *values,
+		       uint16_t num)
+{
+	nrf_edgeai_err_t res;
+
+	if (model->phase_skip > 0) {
+		model->phase_skip -= num;
+		return false;
+	}
+
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+	/*
+	 * Once the radio is idle, or at the latest before the run that fills
+	 * the other buffer, since the feed then hands that one to inference
+	 * and continues in the deferred window
+	 */
+	if (model->deferred &&
+	    (!atomic_get(&modem_connected) || num == model_samples_to_boundary(model))) {
+		model_run_deferred(model);
+	}
+#endif
+
+	profiling_marker_begin(PROFILING_MARKER_FEED);
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+	/* One value per input feature and sample, the runtime splits them into columns */
+	res = model->feed_inputs(model->p_model, values, num * model->channels_num);
+#else
+	res = model->feed_inputs(model->p_model, values, num);
+#endif
+	profiling_marker_end(PROFILING_MARKER_FEED);
+
+	if (res == NRF_EDGEAI_ERR_SUCCESS) {
+		/* The oldest window_shift samples are discarded, the whole window in discrete mode */
+		model->window_fill = model->window_size - model->window_shift;
+		return true;
+	} else if (res == NRF_EDGEAI_ERR_INPROGRESS) {
+		model->window_fill += num;
+	} else {
+		APP_LOG_ERR_RATELIMIT("Failed to feed %s input: %d", model->name, res);
+	}
+
+	return false;
+}
+
+/**
+ * @brief Size of the next run of inputs fed to all models
+ *
+ * The runtime drops values fed beyond the end of the window, so inputs are
+ * fed in contiguous runs that each end at most at the nearest window boundary
+ * of any model.
+ *
+ * @param num Number of inputs left
+ * @return Number of inputs in the run
+ */
+static uint16_t feed_run_size(uint16_t num)
+{
+	ARRAY_FOR_EACH_PTR(models, model) {
+		num = MIN(num, model_samples_to_boundary(model));
+	}
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_CACHE)
+	stream_seq += num;
+	app_dsp_feature_cache_set_window(&detection_feature_cache,
+					 DETECTION_STREAM_ACCEL_MAGNITUDE, stream_seq);
+#endif
+
+	return num;
+}
+
+/**
+ * @brief Run inference on the full window of a model and take its pending update
+ * @param model Model whose window is full
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static void model_window_full(struct detection_model *model, uint32_t window_end_us)
+{
+	model->windows++;
+
+	/* A longer effective window shift skips the boundaries in between */
+	if (++model->stride_count >= model->inference_stride) {
+		model->stride_count = 0;
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+		if (atomic_get(&modem_connected)) {
+			/* Feeding continues in the other buffer, this window stays as is */
+			model->deferred = true;
+			model->deferred_end_us = window_end_us;
+			model->deferred_windows++;
+		} else
+#endif
+		run_inference_and_publish(model, window_end_us);
+	}
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP)
+	model_take_update(model);
+#endif
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+	k_yield();
+#endif
+}
+
+#if defined(CONFIG_APP_DETECTION_SPIKE_TRIGGER)
+/* Ring of the last magnitudes fed, head is where the next one goes */
+static detection_input_t spike_history[CONFIG_APP_DETECTION_SPIKE_HISTORY];
+static uint16_t spike_history_head;
+static uint16_t spike_history_num;
+/* Samples until the event window of a trigger ends, 0 if none is pending */
+static uint16_t spike_pending;
+/* Samples until the next trigger is accepted */
+static uint16_t spike_holdoff;
+
+static inline bool spike_triggers(detection_input_t value)
+{
+	return value > CONFIG_APP_DETECTION_SPIKE_HIGH_MG ||
+	       value < CONFIG_APP_DETECTION_SPIKE_LOW_MG;
+}
+
+/**
+ * @brief Check the next magnitudes for a spike and count down to its event window
+ *
+ * @param values Acceleration magnitudes in milli-g
+ * @param num Number of magnitudes
+ * @param p_event Set if an event window ends with the last magnitude taken
+ * @return Number of magnitudes taken, fewer than num if an event window ends before
+ */
+static uint16_t spike_advance(const detection_input_t *values, uint16_t num, bool *p_event)
+{
+	*p_event = false;
+
+	for (uint16_t i = 0; i < num; i++) {
+		if (spike_holdoff > 0) {
+			spike_holdoff--;
+		} else if (spike_pending == 0 && spike_triggers(values[i])) {
+			/* The triggering sample counts down too */
+			spike_pending = CONFIG_APP_DETECTION_SPIKE_POST_SAMPLES + 1;
+			spike_holdoff = CONFIG_APP_DETECTION_SPIKE_HOLDOFF_SAMPLES;
+		}
+
+		if (spike_pending > 0 && --spike_pending == 0) {
+			*p_event = true;
+			return i + 1;
+		}
+	}
+
+	return num;
+}
+
+/**
+ * @brief Add fed magnitudes to the history
+ * @param values Acceleration magnitudes in milli-g
+ * @param num Number of magnitudes
+ */
+static void spike_history_push(const detection_input_t *values, uint16_t num)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		spike_history[spike_history_head] = values[i];
+		spike_history_head = (spike_history_head + 1) % ARRAY_SIZE(spike_history);
+	}
+
+	spike_history_num = MIN(spike_history_num + num, ARRAY_SIZE(spike_history));
+}
+
+/**
+ * @brief Feed the last magnitudes of the history to a model
+ * @param model Model instance
+ * @param num Number of magnitudes, at most the window size and the history
+ * @return Status of the last feed, NRF_EDGEAI_ERR_SUCCESS if the window is full
+ */
+static nrf_edgeai_err_t spike_history_feed(struct detection_model *model, uint16_t num)
+{
+	uint16_t start = (spike_history_head + ARRAY_SIZE(spike_history) - num) %
+			 ARRAY_SIZE(spike_history);
+	uint16_t first = MIN(num, ARRAY_SIZE(spike_history) - start);
+	nrf_edgeai_err_t res;
+
+	res = model->feed_inputs(model->p_model, &spike_history[start], first);
+	if (res == NRF_EDGEAI_ERR_INPROGRESS && first < num) {
+		res = model->feed_inputs(model->p_model, spike_history, num - first);
+	}
+
+	return res;
+}
+
+/**
+ * @brief Run inference on the event window that ended with the last magnitude fed
+ *
+ * Each model gets its last window size magnitudes from the history in an
+ * emptied window. The samples of its window in progress are fed again
+ * after the inference, so the next regular window is the one it would have
+ * been. Models whose window just ran on the same sample are skipped.
+ *
+ * @param window_end_us Capture time of the last magnitude
+ */
+static void spike_event(uint32_t window_end_us)
+{
+	ARRAY_FOR_EACH_PTR(models, model) {
+		nrf_dsp_window_flatten_t *p_window = &model->p_model->input.p_window_ctx->discrete;
+		nrf_edgeai_err_t res;
+
+		if (model->phase_skip > 0 || model->window_size > spike_history_num ||
+		    (model->window_fill == 0 && model->stride_count == 0)) {
+			continue;
+		}
+
+		p_window->current_sample = 0;
+		res = spike_history_feed(model, model->window_size);
+		if (res != NRF_EDGEAI_ERR_SUCCESS) {
+			APP_LOG_ERR_RATELIMIT("Failed to feed %s event window: %d", model->name,
+					      res);
+			continue;
+		}
+
+		model->event_windows++;
+		run_inference_and_publish(model, window_end_us);
+
+		if (model->window_fill == 0) {
+			continue;
+		}
+
+		res = spike_history_feed(model, model->window_fill);
+		if (res != NRF_EDGEAI_ERR_INPROGRESS) {
+			APP_LOG_ERR_RATELIMIT("Failed to restore %s window: %d", model->name, res);
+		}
+	}
+}
+
+/**
+ * @brief Forget the history and a pending event, the stream restarts
+ */
+static void spike_reset(void)
+{
+	spike_history_num = 0;
+	spike_pending = 0;
+	spike_holdoff = 0;
+}
+#endif
+
+/**
+ * @brief Feed a block of magnitudes to all models, running inference at window boundaries
+ *
+ * Inferences run in stream order, one model at a time, and the inference
+ * thread yields between them so the cost of models whose windows close
+ * together is spread out.
+ *
+ * @param values Acceleration magnitudes in milli-g
+ * @param times Capture times of the magnitudes in microseconds
+ * @param num Number of magnitudes
+ */
+static void feed_magnitudes(const detection_input_t *values, const uint32_t *times,
+			    uint16_t num)
+{
+	while (num > 0) {
+		uint16_t chunk = feed_run_size(num);
+#if defined(CONFIG_APP_DETECTION_SPIKE_TRIGGER)
+		bool event;
+
+		/* A shorter run still ends at most at the window boundaries */
+		chunk = spike_advance(values, chunk, &event);
+#endif
+
+		ARRAY_FOR_EACH_PTR(models, model) {
+			if (model_feed(model, values, chunk)) {
+				model_window_full(model, times[chunk - 1]);
+			}
+		}
+
+#if defined(CONFIG_APP_DETECTION_SPIKE_TRIGGER)
+		spike_history_push(values, chunk);
+		if (event) {
+			spike_event(times[chunk - 1]);
+		}
+#endif
+
+		values += chunk;
+		times += chunk;
+		num -= chunk;
+	}
+}
+
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+/* Angular rate scale from imu_value_t to degrees per second */
+#define GYRO_DPS_SCALE (SAMPLING_GYRO_SCALE * 180.0f / 3.14159265f)
+
+/**
+ * @brief Get the value of one input channel of a sample
+ * @param sample IMU sample
+ * @param channel Input channel, see enum detection_channel
+ * @return Channel value
+ */
+static float sample_channel_value(const struct imu_sample *sample, uint8_t channel)
+{
+	detection_input_t magnitude;
+
+	switch (channel) {
+	case DETECTION_CHANNEL_ACCEL_X:
+		return sample->accel_x * ACCEL_MG_SCALE;
+	case DETECTION_CHANNEL_ACCEL_Y:
+		return sample->accel_y * ACCEL_MG_SCALE;
+	case DETECTION_CHANNEL_ACCEL_Z:
+		return sample->accel_z * ACCEL_MG_SCALE;
+	case DETECTION_CHANNEL_GYRO_X:
+		return sample->gyro_x * GYRO_DPS_SCALE;
+	case DETECTION_CHANNEL_GYRO_Y:
+		return sample->gyro_y * GYRO_DPS_SCALE;
+	case DETECTION_CHANNEL_GYRO_Z:
+		return sample->gyro_z * GYRO_DPS_SCALE;
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+	case DETECTION_CHANNEL_LIN_ACCEL_X:
+		return sample->lin_accel_x * ACCEL_MG_SCALE;
+	case DETECTION_CHANNEL_LIN_ACCEL_Y:
+		return sample->lin_accel_y * ACCEL_MG_SCALE;
+	case DETECTION_CHANNEL_LIN_ACCEL_Z:
+		return sample->lin_accel_z * ACCEL_MG_SCALE;
+#endif
+	default:
+		calculate_accel_magnitudes(sample, 1, &magnitude);
+		return magnitude;
+	}
+}
+
+/**
+ * @brief Build the input vectors of a model from consecutive samples
+ * @param model Model instance
+ * @param samples Samples in capture order
+ * @param num Number of samples
+ * @param p_vectors Output, one value per input feature and sample
+ */
+static void model_input_vectors(const struct detection_model *model,
+				const struct imu_sample *samples, uint16_t num,
+				detection_input_t *p_vectors)
+{
+	for (uint16_t i = 0; i < num; i++) {
+		for (uint8_t c = 0; c < model->channels_num; c++) {
+			*p_vectors++ = sample_channel_value(&samples[i], model->channels[c]);
+		}
+	}
+}
+
+/**
+ * @brief Feed consecutive samples to models with one or more input features
+ *
+ * Each sample becomes one vector with a value per input feature of the
+ * model, in the order of its channel list, and each run is fed to a model
+ * in one call.
+ *
+ * @param samples Samples in capture order
+ * @param count Number of samples, at most SAMPLING_BATCH_MAX
+ */
+static void feed_samples_multi(const struct imu_sample *samples, uint16_t count)
+{
+	static detection_input_t vectors[SAMPLING_BATCH_MAX * DETECTION_CHANNEL_COUNT];
+
+	while (count > 0) {
+		uint16_t chunk = feed_run_size(count);
+
+		ARRAY_FOR_EACH_PTR(models, model) {
+			if (model->phase_skip == 0) {
+				model_input_vectors(model, samples, chunk, vectors);
+			}
+
+			if (model_feed(model, vectors, chunk)) {
+				model_window_full(model, samples[chunk - 1].timestamp_us);
+			}
+		}
+
+#if defined(CONFIG_APP_DETECTION_GAP_PAD)
+		last_sample = samples[chunk - 1];
+#endif
+		samples += chunk;
+		count -= chunk;
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_DIRECT_WINDOW)
+/**
+ * @brief Get the free part of the input window of a model
+ *
+ * The model takes a single input feature, so the window holds consecutive
+ * inputs and the inputs up to the window boundary fit after the last one.
+ *
+ * @param model Model instance, not discarding samples before its first window
+ * @return Where the next input of the model goes
+ */
+static detection_input_t *model_window_acquire(struct detection_model *model)
+{
+	nrf_dsp_window_flatten_t *p_window = &model->p_model->input.p_window_ctx->discrete;
+
+	return (detection_input_t *)p_window->p_window.generic + p_window->current_sample;
+}
+
+/**
+ * @brief Add inputs written into the free part of the window, as the runtime feed does
+ * @param model Model instance
+ * @param num Number of inputs written, at most up to the window boundary
+ * @return true if the window is full and inference is due
+ */
+static bool model_window_commit(struct detection_model *model, uint16_t num)
+{
+	nrf_dsp_window_flatten_t *p_window = &model->p_model->input.p_window_ctx->discrete;
+
+	p_window->current_sample += num;
+	if (p_window->current_sample < p_window->max_samples_num) {
+		model->window_fill += num;
+		return false;
+	}
+
+	/* The next window starts empty */
+	p_window->current_sample = 0;
+	model->window_fill = 0;
+
+	return true;
+}
+
+/**
+ * @brief Feed consecutive samples, with the magnitudes written into a model window
+ *
+ * The magnitudes go straight into the window of the first model taking them
+ * instead of a buffer the runtime copies them from. Other models are fed a
+ * copy from that window. Inference only runs once all models are fed, as it
+ * may transform the window in place.
+ *
+ * @param samples Samples in capture order
+ * @param count Number of samples
+ */
+static void feed_samples_direct(const struct imu_sample *samples, uint16_t count)
+{
+	bool full[ARRAY_SIZE(models)];
+
+	while (count > 0) {
+		uint16_t chunk = feed_run_size(count);
+		const detection_input_t *values = NULL;
+
+		for (size_t i = 0; i < ARRAY_SIZE(models); i++) {
+			struct detection_model *model = &models[i];
+
+			if (values || model->phase_skip > 0) {
+				full[i] = model_feed(model, values, chunk);
+				continue;
+			}
+
+			detection_input_t *p_window = model_window_acquire(model);
+
+			calculate_accel_magnitudes(samples, chunk, p_window);
+			values = p_window;
+#if defined(CONFIG_APP_DETECTION_GAP_PAD)
+			last_input = values[chunk - 1];
+#endif
+			full[i] = model_window_commit(model, chunk);
+		}
+
+#if defined(CONFIG_APP_DETECTION_GAP_PAD)
+		if (!values) {
+			/* All models discard the run, only the last magnitude is kept */
+			calculate_accel_magnitudes(&samples[chunk - 1], 1, &last_input);
+		}
+#endif
+
+		for (size_t i = 0; i < ARRAY_SIZE(models); i++) {
+			if (full[i]) {
+				model_window_full(&models[i], samples[chunk - 1].timestamp_us);
+			}
+		}
+
+		samples += chunk;
+		count -= chunk;
+	}
+}
+#endif
+#endif
+
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+static void inference_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	static detection_input_t block[INFERENCE_BLOCK_SIZE];
+	static uint32_t block_times[INFERENCE_BLOCK_SIZE];
+	struct ring_entry entry;
+	uint16_t num;
+
+	LOG_INF("Inference thread started");
+
+	while (1) {
+		k_sem_take(&inference_sem, K_FOREVER);
+		k_mutex_lock(&inference_lock, K_FOREVER);
+
+		/* Drain the ring in blocks and feed each block in one go */
+		do {
+			if (atomic_cas(&ring_restart_pending, 1, 0)) {
+				app_ring_flush_to(&sample_ring, atomic_get(&ring_restart_mark));
+			}
+
+			for (num = 0; num < INFERENCE_BLOCK_SIZE; num++) {
+				if (!app_ring_get(&sample_ring, &entry)) {
+					break;
+				}
+
+				block[num] = entry.value;
+				block_times[num] = entry.time_us;
+			}
+
+			feed_magnitudes(block, block_times, num);
+		} while (num == INFERENCE_BLOCK_SIZE);
+
+		k_mutex_unlock(&inference_lock);
+	}
+}
+#endif
+
+/**
+ * @brief Feed one magnitude, inline, through the inference thread or to the remote core
+ * @param value Acceleration magnitude in milli-g
+ * @param time_us Capture time of the magnitude
+ */
+static void feed_input(detection_input_t value, uint32_t time_us)
+{
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+	const struct ring_entry entry = {
+		.value = value,
+		.time_us = time_us,
+	};
+
+	if (!app_ring_put(&sample_ring, &entry)) {
+		ring_dropped++;
+		APP_LOG_WRN_RATELIMIT("Inference ring full, %u samples dropped", ring_dropped);
+		return;
+	}
+
+	k_sem_give(&inference_sem);
+#elif defined(CONFIG_APP_DETECTION_REMOTE)
+	detection_remote_feed(&value, time_us);
+#else
+	feed_magnitudes(&value, &time_us, 1);
+#endif
+}
+
+#if defined(CONFIG_APP_DETECTION_GAP_RESET)
+/**
+ * @brief Discard the windows in progress of all models
+ */
+static void models_restart(void)
+{
+#if defined(CONFIG_APP_DETECTION_REMOTE)
+	/* The windows are on the remote core */
+	detection_remote_restart();
+#endif
+#if defined(CONFIG_APP_DETECTION_SPIKE_TRIGGER)
+	/* Event windows must not span the gap either */
+	spike_reset();
+#endif
+
+	ARRAY_FOR_EACH_PTR(models, model) {
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+		/* The deferred window was complete before the gap */
+		if (model->deferred) {
+			model_run_deferred(model);
+		}
+#endif
+#if !defined(CONFIG_APP_DETECTION_REMOTE)
+		/* Setting up the input again empties the window */
+		nrf_edgeai_err_t res = nrf_edgeai_init(model->p_model);
+
+		if (res != NRF_EDGEAI_ERR_SUCCESS) {
+			APP_LOG_ERR_RATELIMIT("Failed to restart %s window: %d", model->name, res);
+		}
+#endif
+
+		model->window_fill = 0;
+		model->phase_skip = model_window_phase(model);
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+		model->gate_armed = false;
+#endif
+	}
+}
+#endif
+
+/**
+ * @brief Track the sample period and account for samples lost before a block of samples
+ *
+ * Sequence numbers restart at 0 with sampling, so a sequence number below
+ * the expected one starts a new stream instead of a gap.
+ *
+ * @param samples Consecutive samples
+ * @param count Number of samples
+ */
+static void check_gap(const struct imu_sample *samples, uint16_t count)
+{
+	uint32_t seq = samples[0].seq;
+	uint32_t expected = next_seq;
+	uint32_t prev_time_us = last_time_us;
+	uint32_t lost;
+
+	next_seq = seq + count;
+	last_time_us = samples[count - 1].timestamp_us;
+
+	if (seq < expected) {
+		return;
+	}
+
+	lost = seq - expected;
+
+	if (expected > 0) {
+		int32_t period_us = (samples[0].timestamp_us - prev_time_us) / (lost + 1);
+
+		sample_period_us +=
+			(period_us - (int32_t)sample_period_us) / SAMPLE_PERIOD_AVG_WEIGHT;
+	}
+
+	if (lost == 0) {
+		return;
+	}
 
-/* EdgeAI model handle */
-static nrf_edgeai_t *p_model = NULL;
+	gap_stats.gaps++;
+	gap_stats.samples_lost += lost;
+	APP_LOG_WRN_RATELIMIT("%u samples lost before sample %u, %u lost in total", lost, seq,
+			      gap_stats.samples_lost);
 
-/* Track last published class to avoid spam */
-static uint16_t last_published_class = UINT16_MAX;  /* Start with invalid value */
+#if defined(CONFIG_APP_DETECTION_GAP_PAD)
+	if (lost <= CONFIG_APP_DETECTION_GAP_PAD_MAX) {
+		for (uint32_t i = 0; i < lost; i++) {
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+			last_sample.timestamp_us = prev_time_us + (i + 1) * sample_period_us;
+			feed_samples_multi(&last_sample, 1);
+#else
+			feed_input(last_input, prev_time_us + (i + 1) * sample_period_us);
+#endif
+		}
+		gap_stats.samples_padded += lost;
+	}
+#elif defined(CONFIG_APP_DETECTION_GAP_RESET)
+	models_restart();
+	gap_stats.window_resets++;
+#endif
+}
 
 /**
- * @brief Calculate acceleration magnitude from 3-axis accelerometer data
- * @param accel_x X-axis acceleration (m/s^2)
- * @param accel_y Y-axis acceleration (m/s^2)
- * @param accel_z Z-axis acceleration (m/s^2)
- * @return Acceleration magnitude in milli-g
+ * @brief Process one IMU sample, inline or through the inference thread
+ * @param sample IMU sample to process
  */
-static float calculate_accel_magnitude(double accel_x, double accel_y, double accel_z)
+static void process_sample(const struct imu_sample *sample)
 {
-	/* Calculate magnitude: sqrt(x^2 + y^2 + z^2) */
-	double magnitude = sqrt(accel_x * accel_x + accel_y * accel_y + accel_z * accel_z);
+	check_gap(sample, 1);
 
-	/* Convert from m/s^2 to milli-g (1g = 9.80665 m/s^2) */
-	float magnitude_mg = (float)(magnitude / 9.80665 * 1000.0);
+#if defined(CONFIG_APP_DETECTION_DIRECT_WINDOW)
+	feed_samples_direct(sample, 1);
+#elif defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+	feed_samples_multi(sample, 1);
+#else
+	/* Calculate acceleration magnitude (model expects single feature) */
+	detection_input_t accel_magnitude;
+
+	calculate_accel_magnitudes(sample, 1, &accel_magnitude);
+	feed_input(accel_magnitude, sample->timestamp_us);
 
-	return magnitude_mg;
+#if defined(CONFIG_APP_DETECTION_GAP_PAD)
+	last_input = accel_magnitude;
+#endif
+#endif
 }
 
 /**
@@ -54,97 +1646,824 @@ static float calculate_accel_magnitude(double accel_x, double accel_y, double ac
  */
 static void imu_data_listener_cb(const struct zbus_channel *chan)
 {
-	const struct imu_sample *sample = zbus_chan_const_msg(chan);
-	nrf_edgeai_err_t res;
+	process_sample(zbus_chan_const_msg(chan));
+}
 
-	/* Calculate acceleration magnitude (model expects single feature) */
-	float accel_magnitude = calculate_accel_magnitude(
-		sample->accel_x,
-		sample->accel_y,
-		sample->accel_z
-	);
+/**
+ * @brief Feed a block of consecutive samples
+ * @param samples Samples in capture order
+ * @param count Number of samples
+ */
+static void process_samples(const struct imu_sample *samples, uint16_t count)
+{
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+	for (uint16_t i = 0; i < count; i++) {
+		process_sample(&samples[i]);
+	}
+#elif defined(CONFIG_APP_DETECTION_DIRECT_WINDOW)
+	/* Samples within a batch are consecutive */
+	check_gap(samples, count);
 
-	/* Feed the sample to the EdgeAI model */
-	res = nrf_edgeai_feed_inputs(p_model, &accel_magnitude, 1);
+	/* Magnitudes of the batch are computed into the model window, one run at a time */
+	feed_samples_direct(samples, count);
+#elif defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+	/* Samples within a batch are consecutive */
+	check_gap(samples, count);
 
-	if (res == NRF_EDGEAI_ERR_SUCCESS) {
-		/* Window is full - run inference */
-		res = nrf_edgeai_run_inference(p_model);
-
-		if (res == NRF_EDGEAI_ERR_SUCCESS) {
-			/* Extract results from model output */
-			uint16_t predicted_class =
-				p_model->decoded_output.classif.predicted_class;
-			const float *p_probabilities =
-				p_model->decoded_output.classif.probabilities.p_f32;
-			float confidence = p_probabilities[predicted_class];
-
-			/* Only publish to Zbus if class has changed (avoid spam) */
-			if (predicted_class != last_published_class) {
-				/* Prepare detection result */
-				struct detection_result result = {
-					.predicted_class = predicted_class,
-					.confidence = confidence,
-					.timestamp = k_uptime_get_32(),
-				};
-
-				/* Publish result to Zbus */
-				int ret = zbus_chan_pub(&detection_result_chan, &result, K_NO_WAIT);
-				if (ret) {
-					LOG_WRN("Failed to publish detection result: %d", ret);
-				} else {
-					/* Update last published class */
-					last_published_class = predicted_class;
-				}
-			}
-		} else {
-			LOG_ERR("Inference failed: %d", res);
-		}
-	} else if (res != NRF_EDGEAI_ERR_INPROGRESS) {
-		/* Log errors, but not when window is still filling up */
-		LOG_ERR("Failed to feed input: %d", res);
+	feed_samples_multi(samples, count);
+#else
+	static detection_input_t magnitudes[SAMPLING_BATCH_MAX];
+#if !defined(CONFIG_APP_DETECTION_REMOTE)
+	static uint32_t times[SAMPLING_BATCH_MAX];
+#endif
+
+	/* Samples within a batch are consecutive */
+	check_gap(samples, count);
+
+	/* Feed the whole batch in one call per window run */
+	calculate_accel_magnitudes(samples, count, magnitudes);
+#if defined(CONFIG_APP_DETECTION_REMOTE)
+	for (uint16_t i = 0; i < count; i++) {
+		feed_input(magnitudes[i], samples[i].timestamp_us);
 	}
+#else
+	for (uint16_t i = 0; i < count; i++) {
+		times[i] = samples[i].timestamp_us;
+	}
+	feed_magnitudes(magnitudes, times, count);
+#endif
+
+#if defined(CONFIG_APP_DETECTION_GAP_PAD)
+	last_input = magnitudes[count - 1];
+#endif
+#endif
+}
+
+/**
+ * @brief Zbus listener callback for batched IMU data
+ * This function is called every time a FIFO batch is published on imu_batch_chan
+ */
+static void imu_batch_listener_cb(const struct zbus_channel *chan)
+{
+	const struct imu_sample_batch *batch = zbus_chan_const_msg(chan);
+
+	process_samples(batch->samples, batch->count);
+}
+
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+/**
+ * @brief Zbus listener callback for pooled IMU data blocks
+ *
+ * The block is consumed before returning, so no reference is taken.
+ */
+static void imu_block_listener_cb(const struct zbus_channel *chan)
+{
+	const struct imu_sample_block *block = zbus_chan_const_msg(chan);
+
+	process_samples(imu_sample_block_samples(block->buf), imu_sample_block_count(block->buf));
 }
+#endif
 
 /* Zbus listener for IMU data channel */
 ZBUS_LISTENER_DEFINE(imu_data_listener, imu_data_listener_cb);
 
-/* Subscribe the listener to the IMU data channel */
+/* Zbus listener for batched IMU data channel */
+ZBUS_LISTENER_DEFINE(imu_batch_listener, imu_batch_listener_cb);
+
+/* Subscribe the listeners to the IMU data channels */
 ZBUS_CHAN_ADD_OBS(imu_data_chan, imu_data_listener, 0);
+ZBUS_CHAN_ADD_OBS(imu_batch_chan, imu_batch_listener, 0);
 
-int detection_init(void)
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+/* Zbus listener for pooled IMU data block channel */
+ZBUS_LISTENER_DEFINE(imu_block_listener, imu_block_listener_cb);
+
+ZBUS_CHAN_ADD_OBS(imu_block_chan, imu_block_listener, 0);
+#endif
+
+/**
+ * @brief Initialize one registered model
+ * @param model Model instance
+ * @return 0 on success, negative error code on failure
+ */
+static int model_init(struct detection_model *model)
 {
+	nrf_edgeai_user_model_footprint_t footprint;
+	nrf_edgeai_t *p_model;
 	nrf_edgeai_err_t res;
 
-	LOG_INF("Initializing detection module");
-
 	/* Get the user-generated model */
-	p_model = nrf_edgeai_user_model();
+	p_model = model->get();
 	if (!p_model) {
-		LOG_ERR("Failed to get EdgeAI model");
+		LOG_ERR("Failed to get EdgeAI model %s", model->name);
 		return -ENOMEM;
 	}
 
 	/* Initialize the EdgeAI runtime */
 	res = nrf_edgeai_init(p_model);
 	if (res != NRF_EDGEAI_ERR_SUCCESS) {
-		LOG_ERR("Failed to initialize EdgeAI: %d", res);
+		LOG_ERR("Failed to initialize EdgeAI model %s: %d", model->name, res);
 		return -EIO;
 	}
 
+	if (nrf_edgeai_input_type(p_model) != DETECTION_INPUT_TYPE) {
+		LOG_ERR("Model %s input type %d does not match configured type %d", model->name,
+			nrf_edgeai_input_type(p_model), DETECTION_INPUT_TYPE);
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+	/* One channel per model input feature */
+	if (nrf_edgeai_uniq_inputs_num(p_model) != model->channels_num ||
+	    model->channels_num > DETECTION_CHANNEL_COUNT) {
+		LOG_ERR("Model %s expects %u input features, %u channels are configured",
+			model->name, nrf_edgeai_uniq_inputs_num(p_model), model->channels_num);
+		return -EINVAL;
+	}
+#else
+	/* The only model input is the acceleration magnitude */
+	if (nrf_edgeai_uniq_inputs_num(p_model) != 1) {
+		LOG_ERR("Model %s expects %u input features, only the accel magnitude is fed",
+			model->name, nrf_edgeai_uniq_inputs_num(p_model));
+		return -EINVAL;
+	}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SCORE_TASKS)
+	if (nrf_edgeai_model_task(p_model) == NRF_EDGEAI_TASK_REGRESSION &&
+	    nrf_edgeai_model_outputs_num(p_model) > DETECTION_SCORE_OUTPUTS_MAX) {
+		LOG_ERR("Model %s has too many regression outputs", model->name);
+		return -EINVAL;
+	}
+#else
+	if (!model_classifies(p_model)) {
+		LOG_ERR("Model %s task %d needs CONFIG_APP_DETECTION_SCORE_TASKS", model->name,
+			nrf_edgeai_model_task(p_model));
+		return -ENOTSUP;
+	}
+#endif
+
 	/* Reset detection state */
-	last_published_class = UINT16_MAX;
+	model->p_model = p_model;
+	model->window_size = nrf_edgeai_input_window_size(p_model);
+	model->window_shift = p_model->input.window_shift;
+	model->inference_stride = 1;
+	model->stride_count = 0;
+	model->window_fill = 0;
+	model->phase_skip = 0;
+	model->last_published_class = UINT16_MAX;
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+	model->gate_armed = false;
+#endif
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+	if (model->gate && (!model_classifies(p_model) ||
+			    nrf_edgeai_model_outputs_num(p_model) > DETECTION_GATE_CLASSES_MAX ||
+			    model->gate->reject_class >= nrf_edgeai_model_outputs_num(p_model))) {
+		LOG_ERR("Model %s does not have the classes of its gate", model->name);
+		return -EINVAL;
+	}
+	model->rejected_windows = 0;
+#endif
+#if defined(CONFIG_APP_DETECTION_SPIKE_TRIGGER)
+	if (model->window_size > CONFIG_APP_DETECTION_SPIKE_HISTORY) {
+		LOG_WRN("Model %s window is longer than the spike history, no event windows",
+			model->name);
+	}
+	model->event_windows = 0;
+#endif
+#if defined(CONFIG_APP_DETECTION_REMOTE)
+	if (nrf_edgeai_model_outputs_num(p_model) > DETECTION_REMOTE_CLASSES_MAX) {
+		LOG_ERR("Model %s has too many classes for the remote core", model->name);
+		return -EINVAL;
+	}
+#endif
+#if defined(CONFIG_APP_DETECTION_SCORE_TASKS)
+	anomaly_calibration_reset(model);
+#endif
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+	/* Models publishing scores have no classes to smooth */
+	if (model_classifies(p_model) &&
+	    detection_smoothing_init(&model->smoothing, nrf_edgeai_model_outputs_num(p_model),
+				     model->smoothing_config)) {
+		LOG_ERR("Model %s has too many classes for smoothing", model->name);
+		return -EINVAL;
+	}
+#endif
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+	/* Summaries of models publishing scores stay empty, they are not published */
+	if (detection_summary_init(&model->summary, model - models,
+				   model_classifies(p_model) ?
+				   nrf_edgeai_model_outputs_num(p_model) : 0,
+				   k_uptime_get_32())) {
+		LOG_ERR("Model %s has too many classes for summaries", model->name);
+		return -EINVAL;
+	}
+#endif
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP)
+	detection_model_swap_init(&model->swap, p_model);
+#endif
 
-	LOG_INF("EdgeAI model initialized:");
-	LOG_INF("  Window size: %u samples", nrf_edgeai_input_window_size(p_model));
+	LOG_INF("EdgeAI model %s initialized:", model->name);
+	LOG_INF("  Window size: %u samples", model->window_size);
+	LOG_INF("  Window shift: %u samples", model->window_shift);
 	LOG_INF("  Input features: %u", nrf_edgeai_uniq_inputs_num(p_model));
 	LOG_INF("  Output classes: %u", nrf_edgeai_model_outputs_num(p_model));
 
+	if (model->footprint) {
+		model->footprint(&footprint);
+		LOG_INF("  Flash: %u bytes (model %u, packed %u, scales %u, FFT %u)",
+			footprint.flash_total, footprint.meta_flash, footprint.packed_flash,
+			footprint.scales_flash, footprint.fft_flash);
+		LOG_INF("  RAM: %u bytes (window %u, features %u, FFT %u, neurons %u, "
+			"outputs %u, context %u, params %u)", footprint.ram_total,
+			footprint.input_window_ram, footprint.features_ram, footprint.fft_ram,
+			footprint.neurons_ram, footprint.outputs_ram, footprint.context_ram,
+			footprint.params_ram);
+#if defined(CONFIG_APP_DETECTION_SHARED_SCRATCH)
+		LOG_INF("  Scratch: %u of %u bytes shared", footprint.scratch_ram,
+			CONFIG_APP_DETECTION_SCRATCH_SIZE);
+#endif
+	}
+
+	return 0;
+}
+
+#if MODEL_PARTITION_IMAGE && defined(CONFIG_APP_DETECTION_MODEL_SWAP_MAPPED)
+/* The partition is in the internal flash, which is memory-mapped */
+#define MODEL_PARTITION_ADDRESS \
+	(DT_REG_ADDR(DT_CHOSEN(zephyr_flash)) + FIXED_PARTITION_OFFSET(model_partition))
+
+/**
+ * @brief Validate the model image in the model partition in place
+ *
+ * Runs in the system work queue after boot, so the first windows are
+ * classified by the built-in model meanwhile. The first registry model
+ * switches to the image at its next window boundary.
+ */
+static void model_map_work_fn(struct k_work *work)
+{
+	struct detection_model *model = &models[0];
+	int ret;
+
+	ARG_UNUSED(work);
+
+	ret = detection_model_swap_map(&model->swap, (const void *)MODEL_PARTITION_ADDRESS,
+				       FIXED_PARTITION_SIZE(model_partition));
+	if (ret == -ENOENT) {
+		LOG_INF("No model image in model partition, %s model built in", model->name);
+	} else if (ret) {
+		LOG_WRN("Model image in model partition rejected: %d", ret);
+	} else {
+		LOG_INF("Model image in model partition validated, used from the next window");
+	}
+}
+
+static K_WORK_DEFINE(model_map_work, model_map_work_fn);
+#elif MODEL_PARTITION_IMAGE
+/**
+ * @brief Use the model image stored in the model partition from the first window on
+ * @param model Initialized model instance
+ */
+static void model_load_partition(struct detection_model *model)
+{
+	const struct flash_area *p_area;
+	int ret;
+
+	ret = flash_area_open(FIXED_PARTITION_ID(model_partition), &p_area);
+	if (ret) {
+		LOG_WRN("Failed to open model partition: %d", ret);
+		return;
+	}
+
+	ret = detection_model_swap_load_area(&model->swap, p_area);
+	flash_area_close(p_area);
+
+	if (ret == -ENOENT) {
+		LOG_INF("No model image in model partition, %s model built in", model->name);
+	} else if (ret) {
+		LOG_WRN("Model image in model partition rejected: %d", ret);
+	} else {
+		model_take_update(model);
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+#define SUMMARY_INTERVAL K_SECONDS(CONFIG_APP_DETECTION_SUMMARY_INTERVAL_S)
+
+static void summary_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(summary_work, summary_work_fn);
+
+/* Publish the summary of the ended interval of every model */
+static void summary_work_fn(struct k_work *work)
+{
+	uint32_t now_ms = k_uptime_get_32();
+
+	ARRAY_FOR_EACH_PTR(models, model) {
+		struct detection_summary summary;
+		int ret;
+
+		if (!model_classifies(model->p_model)) {
+			continue;
+		}
+
+		detection_summary_take(&model->summary, now_ms, &summary);
+
+		ret = zbus_chan_pub(&detection_summary_chan, &summary, K_NO_WAIT);
+		if (ret) {
+			LOG_WRN("Failed to publish %s summary: %d", model->name, ret);
+		}
+	}
+
+	k_work_reschedule(&summary_work, sampling_align_timeout(SUMMARY_INTERVAL));
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_WARM_START)
+/* "DWRM", marks the state saved by detection_retain() */
+#define RETAINED_MAGIC 0x4457524dU
+
+/* Window of one model saved across System OFF */
+struct retained_model {
+	uint16_t window_size;
+	/* Samples of the window in progress, 0 if it did not fit */
+	uint16_t window_fill;
+	uint16_t phase_skip;
+	uint16_t stride_count;
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+	struct detection_smoothing smoothing;
+#endif
+	detection_input_t window[CONFIG_APP_DETECTION_WARM_START_SAMPLES];
+};
+
+struct retained_state {
+	uint32_t magic;
+	/* CRC-32 of the models */
+	uint32_t crc;
+	struct retained_model models[ARRAY_SIZE(models)];
+};
+
+/* Not cleared at boot, valid while the magic and the CRC match */
+static __noinit struct retained_state retained;
+
+static uint32_t retained_crc(void)
+{
+	return crc32_ieee((const uint8_t *)retained.models, sizeof(retained.models));
+}
+
+/**
+ * @brief Feed the windows saved before System OFF to the models again
+ *
+ * The state is taken at most once, a later reset without detection_retain()
+ * starts from empty windows.
+ */
+static void retained_restore(void)
+{
+	if (retained.magic != RETAINED_MAGIC || retained.crc != retained_crc()) {
+		return;
+	}
+
+	retained.magic = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(models); i++) {
+		struct detection_model *model = &models[i];
+		struct retained_model *p_retained = &retained.models[i];
+		nrf_edgeai_err_t res;
+
+		/* The saved state may come from another firmware */
+		if (p_retained->window_size != model->window_size) {
+			continue;
+		}
+
+		model->phase_skip = p_retained->phase_skip;
+		model->stride_count = p_retained->stride_count;
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+		if (p_retained->smoothing.num_classes == model->smoothing.num_classes) {
+			model->smoothing = p_retained->smoothing;
+			model->smoothing.p_config = model->smoothing_config;
+		}
+#endif
+
+		if (p_retained->window_fill == 0) {
+			continue;
+		}
+
+		res = model->feed_inputs(model->p_model, p_retained->window,
+					 p_retained->window_fill);
+		if (res != NRF_EDGEAI_ERR_INPROGRESS) {
+			LOG_WRN("Failed to restore %s window: %d", model->name, res);
+			continue;
+		}
+
+		model->window_fill = p_retained->window_fill;
+		LOG_INF("  Warm start: %u of %u %s window samples", model->window_fill,
+			model->window_size, model->name);
+	}
+}
+
+int detection_retain(void)
+{
+	int ret = 0;
+
+	retained.magic = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(models); i++) {
+		const struct detection_model *model = &models[i];
+		const nrf_dsp_window_flatten_t *p_window =
+			&model->p_model->input.p_window_ctx->discrete;
+		struct retained_model *p_retained = &retained.models[i];
+
+		p_retained->window_size = model->window_size;
+		p_retained->window_fill = 0;
+		p_retained->phase_skip = model->phase_skip;
+		p_retained->stride_count = model->stride_count;
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+		p_retained->smoothing = model->smoothing;
+#endif
+
+		if (model->window_fill > ARRAY_SIZE(p_retained->window)) {
+			LOG_WRN("%s window exceeds CONFIG_APP_DETECTION_WARM_START_SAMPLES",
+				model->name);
+			ret = -ENOSPC;
+			continue;
+		}
+
+		/* A discrete window holds the samples of the window in progress from its start */
+		memcpy(p_retained->window, p_window->p_window.generic,
+		       model->window_fill * sizeof(detection_input_t));
+		p_retained->window_fill = model->window_fill;
+	}
+
+	retained.crc = retained_crc();
+	retained.magic = RETAINED_MAGIC;
+
+	return ret;
+}
+#endif
+
+int detection_init(void)
+{
+	int ret;
+
+	LOG_INF("Initializing detection module");
+
+	for (size_t i = 0; i < ARRAY_SIZE(models); i++) {
+		ret = model_init(&models[i]);
+		if (ret) {
+			return ret;
+		}
+
+		models[i].phase_skip = model_window_phase(&models[i]);
+		if (models[i].phase_skip > 0) {
+			LOG_INF("  Window phase: %u samples", models[i].phase_skip);
+		}
+	}
+
+#if defined(CONFIG_APP_DETECTION_WARM_START)
+	retained_restore();
+#endif
+
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+	/* Next to the handler of whoever connects, e.g. the report module */
+	lte_lc_register_handler(detection_lte_handler);
+#endif
+
+#if defined(CONFIG_APP_DETECTION_REMOTE)
+	/* The local models only provide the window and class metadata */
+	ret = detection_remote_init(DETECTION_INPUT_TYPE, remote_result_cb);
+	if (ret) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+	k_work_schedule(&summary_work, SUMMARY_INTERVAL);
+#endif
+
+#if MODEL_PARTITION_IMAGE && defined(CONFIG_APP_DETECTION_MODEL_SWAP_MAPPED)
+	k_work_submit(&model_map_work);
+#elif MODEL_PARTITION_IMAGE
+	model_load_partition(&models[0]);
+#endif
+
+	return 0;
+}
+
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP)
+int detection_model_update(uint8_t model, const void *p_image, size_t size)
+{
+	int ret;
+
+	if (model >= ARRAY_SIZE(models)) {
+		return -EINVAL;
+	}
+
+	ret = detection_model_swap_load(&models[model].swap, p_image, size);
+	if (ret) {
+		LOG_WRN("Model image for %s rejected: %d", models[model].name, ret);
+	} else {
+		LOG_INF("Model image for %s loaded, used from the next window",
+			models[model].name);
+	}
+
+	return ret;
+}
+
+int detection_model_restore(uint8_t model)
+{
+	int ret;
+
+	if (model >= ARRAY_SIZE(models)) {
+		return -EINVAL;
+	}
+
+	ret = detection_model_swap_restore(&models[model].swap);
+	if (ret == 0) {
+		LOG_INF("Built-in %s model used from the next window", models[model].name);
+	}
+
+	return ret;
+}
+#endif
+
+const char *detection_model_name(uint8_t model)
+{
+	return (model < ARRAY_SIZE(models)) ? models[model].name : NULL;
+}
+
+int detection_get_model_stats(uint8_t model, struct detection_model_stats *stats)
+{
+	nrf_edgeai_user_model_footprint_t footprint;
+	const struct detection_model *p_model;
+
+	if (model >= ARRAY_SIZE(models)) {
+		return -EINVAL;
+	}
+
+	p_model = &models[model];
+	*stats = (struct detection_model_stats){
+		.windows = p_model->windows,
+		.inferences = p_model->inferences,
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+		.gated_windows = p_model->gated_windows,
+#endif
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+		.rejected_windows = p_model->rejected_windows,
+#endif
+#if defined(CONFIG_APP_DETECTION_SPIKE_TRIGGER)
+		.event_windows = p_model->event_windows,
+#endif
+#if defined(CONFIG_APP_DETECTION_MODEM_DEFER)
+		.deferred_windows = p_model->deferred_windows,
+#endif
+		.window_size = p_model->window_size,
+		.window_shift = p_model->window_shift * p_model->inference_stride,
+	};
+
+	if (p_model->footprint) {
+		p_model->footprint(&footprint);
+		stats->ram_bytes = footprint.ram_total;
+	}
+
+	return 0;
+}
+
+int detection_set_window_shift(uint8_t model, uint16_t shift)
+{
+#if !defined(CONFIG_APP_DETECTION_REMOTE) && !defined(CONFIG_APP_DETECTION_INCREMENTAL_FEATURES)
+	struct detection_model *p_model;
+
+	if (model >= ARRAY_SIZE(models)) {
+		return -EINVAL;
+	}
+
+	/* The runtime shift is built into the generated model, whole multiples skip windows */
+	p_model = &models[model];
+	if (p_model->window_shift == 0) {
+		/* Not initialized */
+		return -EINVAL;
+	}
+	if (shift == 0 || shift % p_model->window_shift != 0) {
+		LOG_WRN("%s window shift %u is not a multiple of %u", p_model->name, shift,
+			p_model->window_shift);
+		return -EINVAL;
+	}
+
+	p_model->inference_stride = shift / p_model->window_shift;
+
+	return 0;
+#else
+	/* Windows on the remote core or online features expecting every window */
+	ARG_UNUSED(model);
+	ARG_UNUSED(shift);
+
+	return -ENOTSUP;
+#endif
+}
+
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+void detection_set_energy_gate_threshold(float threshold_mg)
+{
+	energy_gate_threshold_mg = threshold_mg;
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+int detection_set_cascade_limits(uint8_t model, float range_max_mg, float stddev_max_mg)
+{
+	struct detection_gate *gate;
+
+	if (model >= ARRAY_SIZE(models) || !models[model].gate) {
+		return -EINVAL;
+	}
+
+	gate = models[model].gate;
+	gate->range_max_mg = range_max_mg;
+	gate->stddev_max_mg = stddev_max_mg;
+
+	return 0;
+}
+#endif
+
+int detection_benchmark(uint8_t model, uint16_t iterations, uint32_t *p_cycles)
+{
+#if defined(CONFIG_APP_DETECTION_REMOTE)
+	ARG_UNUSED(model);
+	ARG_UNUSED(iterations);
+	ARG_UNUSED(p_cycles);
+
+	return -ENOTSUP;
+#else
+	struct detection_model *p_model;
+	uint32_t start;
+	int ret = 0;
+
+	if (model >= ARRAY_SIZE(models) || iterations == 0) {
+		return -EINVAL;
+	}
+
+	p_model = &models[model];
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+	/* Sampling is stopped, but samples already queued may still be fed */
+	k_mutex_lock(&inference_lock, K_FOREVER);
+#endif
+	start = k_cycle_get_32();
+
+	for (uint16_t i = 0; i < iterations; i++) {
+		nrf_edgeai_err_t res = p_model->run_inference(p_model->p_model);
+
+		if (res != NRF_EDGEAI_ERR_SUCCESS) {
+			ret = -EIO;
+			break;
+		}
+	}
+
+	*p_cycles = (k_cycle_get_32() - start) / iterations;
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+	k_mutex_unlock(&inference_lock);
+#endif
+
+	return ret;
+#endif
+}
+
+#if defined(CONFIG_APP_DETECTION_THREAD_STATS)
+/**
+ * @brief Get the CPU and stack statistics of one thread
+ * @param tid Thread
+ * @param name Name reported for the thread
+ * @param stack_size Configured stack size of the thread
+ * @param stats Statistics since boot
+ * @return 0 on success, negative error code on failure
+ */
+static int thread_stats_get(k_tid_t tid, const char *name, size_t stack_size,
+			    struct detection_thread_stats *stats)
+{
+	k_thread_runtime_stats_t thread_stats;
+	k_thread_runtime_stats_t all_stats;
+	size_t unused;
+	int ret;
+
+	ret = k_thread_runtime_stats_get(tid, &thread_stats);
+	if (ret) {
+		return ret;
+	}
+
+	ret = k_thread_runtime_stats_all_get(&all_stats);
+	if (ret) {
+		return ret;
+	}
+
+	ret = k_thread_stack_space_get(tid, &unused);
+	if (ret) {
+		return ret;
+	}
+
+	stats->name = name;
+	stats->execution_cycles = thread_stats.execution_cycles;
+	stats->total_cycles = all_stats.execution_cycles;
+	stats->cpu_permille = 0;
+	if (all_stats.execution_cycles > 0) {
+		stats->cpu_permille = thread_stats.execution_cycles * 1000U /
+				      all_stats.execution_cycles;
+	}
+	stats->stack_size = stack_size;
+	stats->stack_used = stats->stack_size - unused;
+
 	return 0;
 }
+#endif
+
+int detection_get_thread_stats(uint8_t thread, struct detection_thread_stats *stats)
+{
+#if defined(CONFIG_APP_DETECTION_THREAD_STATS)
+	switch (thread) {
+	case 0:
+		return thread_stats_get(sampling_get_thread(), "sampling",
+					CONFIG_APP_SAMPLING_THREAD_STACK_SIZE, stats);
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+	case 1:
+		return thread_stats_get(inference_thread, "inference",
+					CONFIG_APP_DETECTION_THREAD_STACK_SIZE, stats);
+#endif
+	default:
+		return -ENOENT;
+	}
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+#endif
+}
+
+bool detection_uses_gyro(void)
+{
+#if defined(CONFIG_APP_DETECTION_MULTI_INPUT)
+	ARRAY_FOR_EACH_PTR(models, model) {
+		const nrf_edgeai_t *p_model = model->p_model;
+		const uint8_t *p_mask;
+
+		/* Not loaded, nothing is fed to it */
+		if (p_model == NULL) {
+			continue;
+		}
+
+		/* Init checked one channel per model input feature */
+		p_mask = p_model->input.p_usage_mask;
+		for (uint16_t c = 0; c < nrf_edgeai_uniq_inputs_num(p_model); c++) {
+			/* Inputs the model does not use are fed but never read */
+			if (p_mask != NULL && !(p_mask[c / 8] & BIT(c % 8))) {
+				continue;
+			}
+			if (DETECTION_GYRO_CHANNELS & BIT(model->channels[c])) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+#else
+	/* Init checked a single model input, fed the acceleration magnitude */
+	return false;
+#endif
+}
+
+void detection_get_gap_stats(struct detection_gap_stats *stats)
+{
+	*stats = gap_stats;
+}
 
 void detection_reset_state(void)
 {
-	last_published_class = UINT16_MAX;
+	ARRAY_FOR_EACH_PTR(models, model) {
+		model->last_published_class = UINT16_MAX;
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+		/* Run the next window even if quiescent so its result gets published */
+		model->gate_armed = false;
+#endif
+#if defined(CONFIG_APP_DETECTION_SMOOTHING)
+		/* Start smoothing from scratch so stale windows do not delay the next class */
+		(void)detection_smoothing_init(&model->smoothing, model->smoothing.num_classes,
+					       model->smoothing.p_config);
+#endif
+#if defined(CONFIG_APP_DETECTION_SUMMARY)
+		/* Time since the last window, e.g. asleep, counts to no class */
+		detection_summary_stop(&model->summary);
+#endif
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+		detection_dormant_init(&model->dormant, model->dormant_classes);
+#endif
+	}
+#if defined(CONFIG_APP_DETECTION_INFERENCE_THREAD)
+	/* Sampling is stopped, so nothing is put until it starts again. The inference thread
+	 * owns the tail and drops the samples left from the previous session before feeding
+	 * new ones, so the first window only holds samples of this session.
+	 */
+	ring_dropped = 0;
+	atomic_set(&ring_restart_mark, app_ring_mark(&sample_ring));
+	atomic_set(&ring_restart_pending, 1);
+	k_sem_give(&inference_sem);
+#endif
 	LOG_DBG("Detection state reset - next detection will be published");
 }
@@ -8,26 +8,335 @@
 #define _DETECTION_H_
 
 #include <zephyr/zbus/zbus.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * @brief Detection result structure published on Zbus
  */
 struct detection_result {
+	uint8_t model;             /* Index of the model in the detection registry */
 	uint16_t predicted_class;  /* Predicted class (0-6) */
 	float confidence;          /* Confidence score (0.0-1.0) */
 	uint32_t timestamp;        /* Timestamp of detection */
+	uint32_t window_start_us;  /* Capture time of the first sample of the window */
+	uint32_t window_end_us;    /* Capture time of the last sample of the window */
+	uint32_t latency_us;       /* Time from the last sample capture to the result */
 };
 
 /* Zbus channel declaration for detection results */
 ZBUS_CHAN_DECLARE(detection_result_chan);
 
+/**
+ * @brief Run of consecutive windows classified at rest published on Zbus
+ *
+ * Published once per run, when CONFIG_APP_DORMANT_WINDOWS windows of the model
+ * were classified in one of its rest classes, repeated classes included.
+ */
+struct detection_dormant_event {
+	uint8_t model;             /* Index of the model in the detection registry */
+	uint16_t windows;          /* Consecutive windows at rest */
+	uint32_t window_end_us;    /* Capture time of the last sample of the last window */
+};
+
+/* Zbus channel declaration for dormant events, CONFIG_APP_DORMANT_SLEEP */
+ZBUS_CHAN_DECLARE(detection_dormant_chan);
+
+/* Largest number of outputs of a regression model */
+#define DETECTION_SCORE_OUTPUTS_MAX 8
+
+/* Tasks of the models publishing scores instead of classes */
+enum detection_score_task {
+	DETECTION_SCORE_REGRESSION,
+	DETECTION_SCORE_ANOMALY,
+};
+
+/**
+ * @brief Output of a regression or anomaly detection model, published on Zbus for every window
+ *
+ * The anomaly threshold is calibrated on the first windows of the model, see
+ * CONFIG_APP_DETECTION_ANOMALY_CALIBRATION_WINDOWS. Windows are not flagged as
+ * anomalous before it is calibrated.
+ */
+struct detection_score {
+	uint8_t model;             /* Index of the model in the detection registry */
+	uint8_t task;              /* enum detection_score_task */
+	uint16_t outputs_num;      /* Regression outputs, 1 for the anomaly score */
+	float outputs[DETECTION_SCORE_OUTPUTS_MAX];
+	float threshold;           /* Anomaly score threshold, 0 while calibrating */
+	bool calibrated;           /* Anomaly threshold calibrated */
+	bool anomalous;            /* Anomaly score above the threshold */
+	uint32_t timestamp;        /* Timestamp of the result */
+	uint32_t window_start_us;  /* Capture time of the first sample of the window */
+	uint32_t window_end_us;    /* Capture time of the last sample of the window */
+	uint32_t latency_us;       /* Time from the last sample capture to the result */
+};
+
+/* Zbus channel declaration for regression and anomaly detection results */
+ZBUS_CHAN_DECLARE(detection_score_chan);
+
+/* Largest number of features in an exported feature vector */
+#define DETECTION_FEATURES_MAX 32
+
+/**
+ * @brief Scaled feature vector of one window, published on Zbus for every inference
+ *
+ * The features are the model inputs after min-max scaling, in the order of
+ * the generated model, so recordings of them can train the same network
+ * again. The class is the one of the window, before smoothing.
+ */
+struct detection_features {
+	uint8_t model;             /* Index of the model in the detection registry */
+	uint8_t features_num;      /* Valid entries of features */
+	uint16_t predicted_class;  /* Class of the window, UINT16_MAX for scores */
+	float confidence;          /* Probability of the class, 0 if not decoded */
+	uint32_t window_end_us;    /* Capture time of the last sample of the window */
+	float features[DETECTION_FEATURES_MAX];
+};
+
+/* Zbus channel declaration for exported feature vectors */
+ZBUS_CHAN_DECLARE(detection_features_chan);
+
+/* Largest number of classes of a summarized model */
+#define DETECTION_SUMMARY_CLASSES_MAX 8
+
+/* Episode duration histogram bins: < 10 s, < 1 min, < 10 min, < 1 h, longer */
+#define DETECTION_SUMMARY_DWELL_BINS 5
+
+/**
+ * @brief Class durations of one model over a reporting interval, published on Zbus
+ *
+ * Every classified window counts the time since the previous window to the
+ * class at that time. Time without classification, while detection is
+ * stopped or asleep, counts to no class.
+ */
+struct detection_summary {
+	uint8_t model;
+	uint16_t num_classes;
+	/* Uptime at the start of the interval and its length */
+	uint32_t start_ms;
+	uint32_t duration_ms;
+	/* Time spent in each class */
+	uint32_t dwell_ms[DETECTION_SUMMARY_CLASSES_MAX];
+	/* Episodes of each class started in the interval */
+	uint16_t entries[DETECTION_SUMMARY_CLASSES_MAX];
+	/* Durations of the episodes of each class ended in the interval */
+	uint16_t episodes[DETECTION_SUMMARY_CLASSES_MAX][DETECTION_SUMMARY_DWELL_BINS];
+};
+
+/* Zbus channel declaration for class summaries, one message per model and interval */
+ZBUS_CHAN_DECLARE(detection_summary_chan);
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_CACHE)
+#include "app_dsp.h"
+
+/* Input streams the models of the detection registry take features from */
+enum detection_stream {
+	DETECTION_STREAM_ACCEL_MAGNITUDE,
+};
+
+/* Features of the window being processed, shared by the models of the registry */
+extern struct app_dsp_feature_cache detection_feature_cache;
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SHARED_SCRATCH)
+/* Transient buffers of the inference running, borrowed by each model of the registry */
+extern uint8_t detection_scratch[CONFIG_APP_DETECTION_SCRATCH_SIZE];
+#endif
+
 /**
  * @brief Initialize the detection module
  * @return 0 on success, negative error code on failure
  */
 int detection_init(void);
 
+#if defined(CONFIG_APP_DETECTION_WARM_START)
+/**
+ * @brief Save the windows in progress to retained RAM before System OFF
+ *
+ * The next detection_init() feeds them to the models again. Call it with
+ * sampling stopped, samples queued for the inference thread are not saved.
+ *
+ * @return 0 on success, -ENOSPC if a window did not fit and starts empty
+ */
+int detection_retain(void);
+#endif
+
+/**
+ * @brief Get the name of a registered model
+ * @param model Model index as in struct detection_result
+ * @return Model name, NULL if there is no such model
+ */
+const char *detection_model_name(uint8_t model);
+
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP)
+/**
+ * @brief Replace the network of a registry model with a serialized model image
+ *
+ * The image is copied and validated, and the model switches to it at its
+ * next window boundary. Another image can be loaded once the switch is done.
+ *
+ * @param model Index of the model in the detection registry
+ * @param p_image Model image generated by scripts/model_image.py
+ * @param size Size of the image in bytes
+ * @return 0 on success, -EBUSY if the previous image is not in use yet,
+ *	   negative error code if the image is rejected
+ */
+int detection_model_update(uint8_t model, const void *p_image, size_t size);
+
+/**
+ * @brief Switch a registry model back to its built-in network
+ *
+ * Together with detection_model_update() this selects between the built-in
+ * model and images on a subset of its features, e.g. a cheaper model while
+ * the battery is low. The switch happens at the next window boundary.
+ *
+ * @param model Index of the model in the detection registry
+ * @return 0 on success, -EBUSY if the previous image is not in use yet,
+ *	   -EINVAL if there is no such model
+ */
+int detection_model_restore(uint8_t model);
+#endif
+
+/* Counters and window of one registry model */
+struct detection_model_stats {
+	/* Full windows since boot and the inferences run on them */
+	uint32_t windows;
+	uint32_t inferences;
+	/* Windows skipped by the energy gate and classified by the cascade gate */
+	uint32_t gated_windows;
+	uint32_t rejected_windows;
+	/* Spike triggered event windows, their inferences are counted in inferences */
+	uint32_t event_windows;
+	/* Inferences held back while the LTE radio was connected, also counted in inferences */
+	uint32_t deferred_windows;
+	uint16_t window_size;
+	uint16_t window_shift;
+	/* Static RAM of the generated model, 0 if it has no footprint report */
+	uint32_t ram_bytes;
+};
+
+/**
+ * @brief Get the counters of a registry model
+ *
+ * Windows are only counted with inference on this core.
+ *
+ * @param model Index of the model in the detection registry
+ * @param stats Counters since boot
+ * @return 0 on success, -EINVAL if there is no such model
+ */
+int detection_get_model_stats(uint8_t model, struct detection_model_stats *stats);
+
+/**
+ * @brief Change the effective window shift of a registry model
+ *
+ * The window shift of the runtime is built into the generated model, the
+ * full window size in discrete mode or CONFIG_APP_DETECTION_WINDOW_SHIFT
+ * with sliding windows. Multiples of it run inference on every n-th window
+ * only, trading latency for power. Takes effect from the next window.
+ *
+ * @param model Index of the model in the detection registry
+ * @param shift Effective window shift in samples, a multiple of the model shift
+ * @return 0 on success, -EINVAL if the model is out of range or not
+ *	   initialized, or the shift is not a non-zero multiple of the model
+ *	   shift, -ENOTSUP with remote inference or with
+ *	   CONFIG_APP_DETECTION_INCREMENTAL_FEATURES
+ */
+int detection_set_window_shift(uint8_t model, uint16_t shift);
+
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+/**
+ * @brief Change the magnitude range of quiescent windows for the energy gate
+ * @param threshold_mg Range in milli-g, used from the next window
+ */
+void detection_set_energy_gate_threshold(float threshold_mg);
+#endif
+
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+/* Largest number of classes of a model with a gate stage */
+#define DETECTION_GATE_CLASSES_MAX 16
+
+/**
+ * @brief Change the limits of the cascade gate stage of a registry model
+ * @param model Index of the model in the detection registry
+ * @param range_max_mg Largest magnitude range of a rejected window in milli-g
+ * @param stddev_max_mg Largest standard deviation of a rejected window in milli-g
+ * @return 0 on success, -EINVAL if the model has no gate stage
+ */
+int detection_set_cascade_limits(uint8_t model, float range_max_mg, float stddev_max_mg);
+#endif
+
+/**
+ * @brief Time inference of a registry model on its current window
+ *
+ * Sampling must be stopped, the model buffers are shared with detection.
+ * With CONFIG_APP_DETECTION_INFERENCE_THREAD it waits for the inference
+ * thread to finish feeding the samples it took. Nothing is published.
+ *
+ * @param model Index of the model in the detection registry
+ * @param iterations Number of inferences to average over
+ * @param p_cycles Average hardware cycles per inference
+ * @return 0 on success, -EINVAL if the model is out of range, -EIO if
+ *	   inference fails, -ENOTSUP with remote inference
+ */
+int detection_benchmark(uint8_t model, uint16_t iterations, uint32_t *p_cycles);
+
+/* CPU time and stack use of a thread on the sampling and inference path */
+struct detection_thread_stats {
+	const char *name;
+	/* Cycles run by the thread and by all threads including idle, since boot */
+	uint64_t execution_cycles;
+	uint64_t total_cycles;
+	/* CPU utilization since boot in per mille */
+	uint16_t cpu_permille;
+	/* Peak stack use and stack size in bytes */
+	size_t stack_used;
+	size_t stack_size;
+};
+
+/**
+ * @brief Get the CPU and stack statistics of a thread running detection
+ *
+ * Thread 0 is the sampling thread, which runs inference unless
+ * CONFIG_APP_DETECTION_INFERENCE_THREAD is enabled, thread 1 is the
+ * inference thread then. Requires CONFIG_APP_DETECTION_THREAD_STATS.
+ *
+ * @param thread Thread index, counted from 0
+ * @param stats Statistics since boot
+ * @return 0 on success, -ENOENT if there is no such thread, -ENOTSUP without
+ *	   CONFIG_APP_DETECTION_THREAD_STATS, negative error code on other failures
+ */
+int detection_get_thread_stats(uint8_t thread, struct detection_thread_stats *stats);
+
+/* Gaps in the sequence of samples received by detection since boot */
+struct detection_gap_stats {
+	/* Gaps in the sequence numbers of the samples */
+	uint32_t gaps;
+	/* Samples missing in the gaps */
+	uint32_t samples_lost;
+	/* Samples fed in place of lost ones with CONFIG_APP_DETECTION_GAP_PAD */
+	uint32_t samples_padded;
+	/* Window restarts with CONFIG_APP_DETECTION_GAP_RESET */
+	uint32_t window_resets;
+};
+
+/**
+ * @brief Get the sample gap counters
+ * @param stats Counters since boot
+ */
+void detection_get_gap_stats(struct detection_gap_stats *stats);
+
+/**
+ * @brief Check whether the model inputs are derived from gyroscope data
+ *
+ * Derived from the inputs of the loaded models: the channel fed to each
+ * input the model uses, as set by its usage mask.
+ *
+ * @return true if detection consumes the gyro fields of IMU samples
+ */
+bool detection_uses_gyro(void);
+
 /**
  * @brief Reset detection state (clears last published class)
  * Call this when starting a new detection session to ensure
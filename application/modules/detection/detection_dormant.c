@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include "detection_dormant.h"
+
+void detection_dormant_init(struct detection_dormant *p_dormant, uint32_t classes)
+{
+	p_dormant->classes = classes;
+	p_dormant->windows = 0;
+}
+
+bool detection_dormant_update(struct detection_dormant *p_dormant, uint16_t predicted_class,
+			      float confidence)
+{
+	bool at_rest = predicted_class < 32 && (p_dormant->classes & BIT(predicted_class)) &&
+		       confidence * 100.0f >= CONFIG_APP_DORMANT_CONFIDENCE_PCT;
+
+	if (!at_rest) {
+		p_dormant->windows = 0;
+		return false;
+	}
+
+	/* A run longer than the windows needed is reported once */
+	if (p_dormant->windows == CONFIG_APP_DORMANT_WINDOWS) {
+		return false;
+	}
+
+	return ++p_dormant->windows == CONFIG_APP_DORMANT_WINDOWS;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_DORMANT_H_
+#define _DETECTION_DORMANT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Run of consecutive windows of one model classified at rest
+ */
+struct detection_dormant {
+	/* Classes at rest, one bit per class */
+	uint32_t classes;
+	/* Consecutive windows at rest, saturated at CONFIG_APP_DORMANT_WINDOWS */
+	uint16_t windows;
+};
+
+/**
+ * @brief Start a new run, e.g. when detection starts again
+ * @param p_dormant Run state
+ * @param classes Classes at rest, one bit per class
+ */
+void detection_dormant_init(struct detection_dormant *p_dormant, uint32_t classes);
+
+/**
+ * @brief Count one classified window
+ *
+ * Call it for every window, not only for the class changes published on
+ * detection_result_chan, as a run at rest is one class repeated. A window of
+ * another class or below CONFIG_APP_DORMANT_CONFIDENCE_PCT ends the run.
+ *
+ * @param p_dormant Run state
+ * @param predicted_class Class of the window
+ * @param confidence Probability of the class in the window
+ * @return true for the window completing a run of CONFIG_APP_DORMANT_WINDOWS,
+ *	   once per run
+ */
+bool detection_dormant_update(struct detection_dormant *p_dormant, uint16_t predicted_class,
+			      float confidence);
+
+#endif /* _DETECTION_DORMANT_H_ */
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#include "detection_history.h"
+
+/* Latest windows, window n since boot at history[n % size] */
+static struct detection_history_entry history[CONFIG_APP_DETECTION_HISTORY_RESULTS];
+/* Windows added since boot, only written by the detection module */
+static atomic_t history_added;
+
+/*
+ * The slot of the oldest window is the one the writer fills next, so
+ * readers see at most one window less than the history holds
+ */
+#define HISTORY_READABLE (ARRAY_SIZE(history) - 1)
+
+/* Copy a window, false if the writer overwrote it before or during the copy */
+static bool history_read(uint32_t seq, struct detection_history_entry *p_entry)
+{
+	*p_entry = history[seq % ARRAY_SIZE(history)];
+
+	return (uint32_t)atomic_get(&history_added) - seq <= HISTORY_READABLE;
+}
+
+void detection_history_add(uint8_t model, uint16_t predicted_class, float confidence,
+			   uint32_t window_start_us, uint32_t window_end_us)
+{
+	atomic_val_t n = atomic_get(&history_added);
+	struct detection_history_entry *p = &history[(uint32_t)n % ARRAY_SIZE(history)];
+
+	p->window_start_us = window_start_us;
+	p->window_end_us = window_end_us;
+	p->predicted_class = predicted_class;
+	p->model = model;
+	p->confidence_q8 = (uint8_t)CLAMP(confidence * 256.0f, 0.0f, 255.0f);
+
+	/* Publish the window to readers after it is complete */
+	atomic_set(&history_added, n + 1);
+}
+
+uint32_t detection_history_seq(void)
+{
+	return (uint32_t)atomic_get(&history_added);
+}
+
+void detection_history_iter_latest(struct detection_history_iter *p_iter, uint16_t num)
+{
+	uint32_t added = (uint32_t)atomic_get(&history_added);
+
+	p_iter->next = added - MIN(MIN((uint32_t)num, HISTORY_READABLE), added);
+	p_iter->lost = 0;
+}
+
+bool detection_history_next(struct detection_history_iter *p_iter,
+			    struct detection_history_entry *p_entry)
+{
+	while (true) {
+		uint32_t added = (uint32_t)atomic_get(&history_added);
+
+		if (p_iter->next == added) {
+			return false;
+		}
+
+		/* Skip to the oldest window still readable */
+		if (added - p_iter->next > HISTORY_READABLE) {
+			p_iter->lost += added - HISTORY_READABLE - p_iter->next;
+			p_iter->next = added - HISTORY_READABLE;
+		}
+
+		if (history_read(p_iter->next, p_entry)) {
+			p_iter->next++;
+			return true;
+		}
+	}
+}
+
+bool detection_history_last(uint8_t model, struct detection_history_entry *p_entry)
+{
+	uint32_t added = (uint32_t)atomic_get(&history_added);
+	uint32_t num = MIN(added, HISTORY_READABLE);
+
+	/* Newest first, once one is overwritten so are all older ones */
+	for (uint32_t seq = added - 1; num > 0; seq--, num--) {
+		if (!history_read(seq, p_entry)) {
+			return false;
+		}
+
+		if (p_entry->model == model) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+uint16_t detection_history_count(uint8_t model, uint16_t predicted_class, uint32_t since_us,
+				 uint16_t *p_total)
+{
+	struct detection_history_entry entry;
+	uint32_t added = (uint32_t)atomic_get(&history_added);
+	uint32_t num = MIN(added, HISTORY_READABLE);
+	uint16_t count = 0;
+	uint16_t total = 0;
+
+	for (uint32_t seq = added - 1; num > 0; seq--, num--) {
+		if (!history_read(seq, &entry)) {
+			break;
+		}
+
+		/* Models finish their windows at different times, so check all of them */
+		if (entry.model == model && (int32_t)(entry.window_end_us - since_us) >= 0) {
+			total++;
+			count += (entry.predicted_class == predicted_class);
+		}
+	}
+
+	if (p_total) {
+		*p_total = total;
+	}
+
+	return count;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_HISTORY_H_
+#define _DETECTION_HISTORY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include "detection.h"
+
+/* Compact classified window */
+struct detection_history_entry {
+	/* Capture times of the first and last sample of the window */
+	uint32_t window_start_us;
+	uint32_t window_end_us;
+	uint16_t predicted_class;
+	/* Index of the model in the detection registry */
+	uint8_t model;
+	/* Confidence in 1/256 steps, saturated at 255 */
+	uint8_t confidence_q8;
+} __packed;
+
+/**
+ * @brief Position of a reader in the history
+ *
+ * Each reader keeps its own iterator, the history itself is shared.
+ */
+struct detection_history_iter {
+	/* Sequence number of the next entry to read */
+	uint32_t next;
+	/* Entries overwritten before this reader got to them */
+	uint32_t lost;
+};
+
+/**
+ * @brief Add a classified window to the history, called by the detection module
+ *
+ * Never waits, the oldest entry is overwritten. Windows are added in the
+ * context classifying them, so there is a single writer.
+ *
+ * @param model Index of the model in the detection registry
+ * @param predicted_class Class of the window, after smoothing if enabled
+ * @param confidence Confidence of the class from 0.0 to 1.0
+ * @param window_start_us Capture time of the first sample of the window
+ * @param window_end_us Capture time of the last sample of the window
+ */
+void detection_history_add(uint8_t model, uint16_t predicted_class, float confidence,
+			   uint32_t window_start_us, uint32_t window_end_us);
+
+/**
+ * @brief Number of windows added to the history since boot
+ *
+ * The sequence number of the next window added.
+ */
+uint32_t detection_history_seq(void);
+
+/**
+ * @brief Start reading at the newest windows
+ *
+ * @param p_iter Iterator to set up
+ * @param num Number of the newest windows to read first, 0 to read only
+ *	      windows added from now on
+ */
+void detection_history_iter_latest(struct detection_history_iter *p_iter, uint16_t num);
+
+/**
+ * @brief Read the next window of an iterator, oldest first
+ *
+ * Reads without a lock. An entry overwritten while it is copied is
+ * discarded, as are the ones overwritten before it was read, and the
+ * iterator continues at the oldest entry still in the history. Calling it
+ * again later returns the windows added meanwhile.
+ *
+ * @param p_iter Iterator
+ * @param p_entry Copy of the window
+ * @return true if a window was read, false if the iterator is at the newest one
+ */
+bool detection_history_next(struct detection_history_iter *p_iter,
+			    struct detection_history_entry *p_entry);
+
+/**
+ * @brief Find the newest window of a model
+ *
+ * @param model Index of the model in the detection registry
+ * @param p_entry Copy of the window
+ * @return true if the history holds a window of the model
+ */
+bool detection_history_last(uint8_t model, struct detection_history_entry *p_entry);
+
+/**
+ * @brief Count the windows of a model classified as a class
+ *
+ * @param model Index of the model in the detection registry
+ * @param predicted_class Class to count
+ * @param since_us Capture time of the last sample of the oldest window of
+ *		   interest
+ * @param p_total Windows of the model since then, may be NULL
+ * @return Windows of the class since then
+ */
+uint16_t detection_history_count(uint8_t model, uint16_t predicted_class, uint32_t since_us,
+				 uint16_t *p_total);
+
+#endif /* _DETECTION_HISTORY_H_ */
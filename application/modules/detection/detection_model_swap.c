@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+#include "detection_model_swap.h"
+
+BUILD_ASSERT((CONFIG_APP_DETECTION_MODEL_SWAP_IMAGE_MAX % sizeof(uint64_t)) == 0,
+	     "Image buffers hold 64-bit feature masks");
+
+/* Inference runs one model at a time, so all loaded models share one neuron buffer */
+static flt32_t swap_neurons[CONFIG_APP_DETECTION_MODEL_SWAP_NEURONS_MAX];
+
+static K_MUTEX_DEFINE(swap_lock);
+
+/**
+ * @brief Arrays of a model image
+ */
+struct image_layout {
+	const uint64_t *p_masks;
+	const flt32_t *p_weights;
+	const flt32_t *p_act_weights;
+	const flt32_t *p_features_min;
+	const flt32_t *p_features_max;
+	const uint16_t *p_links;
+	const uint16_t *p_internal_num;
+	const uint16_t *p_external_num;
+	const uint16_t *p_output_indices;
+	const uint8_t *p_act_type_mask;
+};
+
+static const void *image_array(const uint8_t *p_image, size_t *p_offset, size_t len)
+{
+	const void *p = p_image + *p_offset;
+
+	*p_offset = ROUND_UP(*p_offset + len, 4);
+
+	return p;
+}
+
+/**
+ * @brief Locate the arrays of an image
+ * @return Image size the header describes
+ */
+static size_t image_layout(const struct detection_model_image_header *p_hdr,
+			   struct image_layout *p_layout)
+{
+	const uint8_t *p_image = (const uint8_t *)p_hdr;
+	size_t offset = ROUND_UP(p_hdr->header_size, 8);
+
+	p_layout->p_masks = image_array(p_image, &offset, p_hdr->masks_num * sizeof(uint64_t));
+	p_layout->p_weights =
+		image_array(p_image, &offset, p_hdr->weights_num * sizeof(flt32_t));
+	p_layout->p_act_weights =
+		image_array(p_image, &offset, p_hdr->neurons_num * sizeof(flt32_t));
+	p_layout->p_features_min =
+		image_array(p_image, &offset, p_hdr->features_num * sizeof(flt32_t));
+	p_layout->p_features_max =
+		image_array(p_image, &offset, p_hdr->features_num * sizeof(flt32_t));
+	p_layout->p_links =
+		image_array(p_image, &offset, p_hdr->weights_num * sizeof(uint16_t));
+	p_layout->p_internal_num =
+		image_array(p_image, &offset, p_hdr->neurons_num * sizeof(uint16_t));
+	p_layout->p_external_num =
+		image_array(p_image, &offset, p_hdr->neurons_num * sizeof(uint16_t));
+	p_layout->p_output_indices =
+		image_array(p_image, &offset, p_hdr->outputs_num * sizeof(uint16_t));
+	p_layout->p_act_type_mask =
+		image_array(p_image, &offset, DIV_ROUND_UP(p_hdr->neurons_num, 8));
+
+	return offset;
+}
+
+/**
+ * @brief Check that every link of the network stays within the model
+ *
+ * Internal links index earlier neurons, external links index the extracted
+ * features or, one past them, the bias.
+ */
+static bool image_links_valid(const struct detection_model_image_header *p_hdr,
+			      const struct image_layout *p_layout)
+{
+	uint16_t first = 0;
+
+	for (uint16_t n = 0; n < p_hdr->neurons_num; n++) {
+		uint16_t internal = p_layout->p_internal_num[n];
+		uint16_t external = p_layout->p_external_num[n];
+
+		if (internal < first || external < internal || external > p_hdr->weights_num) {
+			return false;
+		}
+
+		for (uint16_t i = first; i < internal; i++) {
+			if (p_layout->p_links[i] >= n) {
+				return false;
+			}
+		}
+
+		for (uint16_t i = internal; i < external; i++) {
+			if (p_layout->p_links[i] > p_hdr->features_num) {
+				return false;
+			}
+		}
+
+		first = external;
+	}
+
+	for (uint16_t i = 0; i < p_hdr->outputs_num; i++) {
+		if (p_layout->p_output_indices[i] >= p_hdr->neurons_num) {
+			return false;
+		}
+	}
+
+	return first == p_hdr->weights_num;
+}
+
+/**
+ * @brief Check that the feature masks of an image fit the built-in model
+ *
+ * With feature subsets, an image may extract any subset of the features of
+ * the built-in model, which the DSP buffers are sized for. Otherwise the
+ * features must be the same.
+ */
+static bool image_features_compatible(const struct detection_model_image_header *p_hdr,
+				      const struct image_layout *p_layout,
+				      const nrf_edgeai_dsp_feature_extraction_t *p_features)
+{
+	if (p_hdr->masks_num != p_features->masks_num) {
+		return false;
+	}
+
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP_FEATURE_SUBSETS)
+	if (p_hdr->features_num > p_features->overall_num) {
+		return false;
+	}
+
+	for (uint16_t i = 0; i < p_hdr->masks_num; i++) {
+		if (p_layout->p_masks[i] & ~p_features->p_masks[i].all) {
+			return false;
+		}
+	}
+
+	return true;
+#else
+	return p_hdr->features_num == p_features->overall_num &&
+	       memcmp(p_layout->p_masks, p_features->p_masks,
+		      p_hdr->masks_num * sizeof(uint64_t)) == 0;
+#endif
+}
+
+/**
+ * @brief Check that an image fits the feature extraction and outputs of the built-in model
+ */
+static bool image_compatible(const struct detection_model_image_header *p_hdr,
+			     const struct image_layout *p_layout, const nrf_edgeai_t *p_builtin)
+{
+	return p_hdr->window_size == p_builtin->input.window_size &&
+	       p_hdr->task == p_builtin->model.meta.task &&
+	       p_hdr->outputs_num == p_builtin->model.meta.outputs_num &&
+	       p_hdr->neurons_num <= ARRAY_SIZE(swap_neurons) &&
+	       image_features_compatible(p_hdr, p_layout, &p_builtin->p_dsp->features);
+}
+
+void detection_model_swap_init(struct detection_model_swap *p_swap, const nrf_edgeai_t *p_builtin)
+{
+	p_swap->p_builtin = p_builtin;
+	p_swap->next = 0;
+	atomic_ptr_clear(&p_swap->pending);
+}
+
+/**
+ * @brief Lock the slot the next image is loaded into
+ * @return 0 with the lock held, negative error code otherwise
+ */
+static int slot_begin(struct detection_model_swap *p_swap, struct detection_model_slot **pp_slot)
+{
+	k_mutex_lock(&swap_lock, K_FOREVER);
+
+	/* The slot loaded before is in use once taken, so wait for it */
+	if (atomic_ptr_get(&p_swap->pending) != NULL) {
+		k_mutex_unlock(&swap_lock);
+		return -EBUSY;
+	}
+
+	*pp_slot = &p_swap->slots[p_swap->next];
+
+	return 0;
+}
+
+/**
+ * @brief Check that an image fits the buffer of a slot
+ */
+static int image_size_check(const struct detection_model_swap *p_swap, size_t size)
+{
+	if (size < sizeof(struct detection_model_image_header)) {
+		return -EINVAL;
+	}
+
+	if (size > sizeof(p_swap->slots[0].image)) {
+		return -EFBIG;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Validate an image and make a slot using it pending, releases the lock
+ * @param p_swap Model slots
+ * @param p_slot Locked slot
+ * @param p_hdr Image in the slot buffer or in memory-mapped flash, aligned to 8 bytes
+ * @param size Size of the image
+ */
+static int slot_commit(struct detection_model_swap *p_swap, struct detection_model_slot *p_slot,
+		       const struct detection_model_image_header *p_hdr, size_t size)
+{
+	const nrf_edgeai_t *p_builtin = p_swap->p_builtin;
+	struct image_layout layout;
+	int ret = 0;
+
+	if (p_hdr->magic != DETECTION_MODEL_IMAGE_MAGIC ||
+	    p_hdr->version != DETECTION_MODEL_IMAGE_VERSION ||
+	    p_hdr->header_size < sizeof(*p_hdr) || p_hdr->size != size ||
+	    p_hdr->weights_num > size || image_layout(p_hdr, &layout) > size) {
+		ret = -EINVAL;
+	} else if (crc32_ieee((const uint8_t *)p_hdr + p_hdr->header_size,
+			      size - p_hdr->header_size) != p_hdr->crc) {
+		ret = -EBADMSG;
+	} else if (!image_compatible(p_hdr, &layout, p_builtin) ||
+		   !image_links_valid(p_hdr, &layout)) {
+		ret = -EINVAL;
+	}
+
+	if (ret) {
+		k_mutex_unlock(&swap_lock);
+		return ret;
+	}
+
+	/*
+	 * The contexts have const members, so they are copied from the built-in
+	 * model and the members taken from the image are written over the copy.
+	 */
+	memcpy(&p_slot->edgeai, p_builtin, sizeof(p_slot->edgeai));
+	memcpy(&p_slot->dsp, p_builtin->p_dsp, sizeof(p_slot->dsp));
+	p_slot->dsp.features.meta.f32.p_min = layout.p_features_min;
+	p_slot->dsp.features.meta.f32.p_max = layout.p_features_max;
+#if defined(CONFIG_APP_DETECTION_MODEL_SWAP_FEATURE_SUBSETS)
+	/* The pipeline only runs the feature functions of the image masks */
+	memcpy((void *)&p_slot->dsp.features.overall_num, &p_hdr->features_num,
+	       sizeof(p_hdr->features_num));
+	p_slot->dsp.features.p_masks = (const nrf_edgeai_features_mask_t *)layout.p_masks;
+#endif
+	p_slot->edgeai.p_dsp = &p_slot->dsp;
+
+	const nrf_edgeai_model_meta_t meta = {
+		.p_neuron_internal_links_num = layout.p_internal_num,
+		.p_neuron_external_links_num = layout.p_external_num,
+		.p_output_neurons_indices = layout.p_output_indices,
+		.p_neuron_links = layout.p_links,
+		.p_neuron_act_type_mask = layout.p_act_type_mask,
+		.outputs_num = p_hdr->outputs_num,
+		.neurons_num = p_hdr->neurons_num,
+		.weights_num = p_hdr->weights_num,
+		.task = p_builtin->model.meta.task,
+		.uses_as_input = p_builtin->model.meta.uses_as_input,
+	};
+
+	memcpy(&p_slot->edgeai.model.meta, &meta, sizeof(meta));
+	memcpy((void *)&p_slot->edgeai.metadata.version.combined, &p_hdr->runtime_version,
+	       sizeof(p_hdr->runtime_version));
+	p_slot->edgeai.model.params.f32.p_weights = layout.p_weights;
+	p_slot->edgeai.model.params.f32.p_act_weights = layout.p_act_weights;
+	p_slot->edgeai.model.params.f32.p_neurons = swap_neurons;
+
+	if (!nrf_edgeai_is_runtime_compatible(&p_slot->edgeai)) {
+		k_mutex_unlock(&swap_lock);
+		return -ENOTSUP;
+	}
+
+	atomic_ptr_set(&p_swap->pending, &p_slot->edgeai);
+	p_swap->next ^= 1;
+
+	k_mutex_unlock(&swap_lock);
+
+	return 0;
+}
+
+int detection_model_swap_restore(struct detection_model_swap *p_swap)
+{
+	k_mutex_lock(&swap_lock, K_FOREVER);
+
+	if (atomic_ptr_get(&p_swap->pending) != NULL) {
+		k_mutex_unlock(&swap_lock);
+		return -EBUSY;
+	}
+
+	/* The built-in context is never written by the slots */
+	atomic_ptr_set(&p_swap->pending, (void *)p_swap->p_builtin);
+
+	k_mutex_unlock(&swap_lock);
+
+	return 0;
+}
+
+int detection_model_swap_load(struct detection_model_swap *p_swap, const void *p_image,
+			      size_t size)
+{
+	struct detection_model_slot *p_slot;
+	int ret;
+
+	ret = image_size_check(p_swap, size);
+	if (ret) {
+		return ret;
+	}
+
+	ret = slot_begin(p_swap, &p_slot);
+	if (ret) {
+		return ret;
+	}
+
+	memcpy(p_slot->image, p_image, size);
+
+	return slot_commit(p_swap, p_slot, (const void *)p_slot->image, size);
+}
+
+int detection_model_swap_load_area(struct detection_model_swap *p_swap,
+				   const struct flash_area *p_area)
+{
+	struct detection_model_image_header hdr;
+	struct detection_model_slot *p_slot;
+	int ret;
+
+	ret = flash_area_read(p_area, 0, &hdr, sizeof(hdr));
+	if (ret) {
+		return ret;
+	}
+
+	if (hdr.magic != DETECTION_MODEL_IMAGE_MAGIC) {
+		return -ENOENT;
+	}
+
+	if (hdr.size > p_area->fa_size) {
+		return -EINVAL;
+	}
+
+	ret = image_size_check(p_swap, hdr.size);
+	if (ret) {
+		return ret;
+	}
+
+	ret = slot_begin(p_swap, &p_slot);
+	if (ret) {
+		return ret;
+	}
+
+	ret = flash_area_read(p_area, 0, p_slot->image, hdr.size);
+	if (ret) {
+		k_mutex_unlock(&swap_lock);
+		return ret;
+	}
+
+	return slot_commit(p_swap, p_slot, (const void *)p_slot->image, hdr.size);
+}
+
+int detection_model_swap_map(struct detection_model_swap *p_swap, const void *p_image,
+			     size_t max_size)
+{
+	const struct detection_model_image_header *p_hdr = p_image;
+	struct detection_model_slot *p_slot;
+	int ret;
+
+	if (max_size < sizeof(*p_hdr) || p_hdr->magic != DETECTION_MODEL_IMAGE_MAGIC) {
+		return -ENOENT;
+	}
+
+	if (!IS_ALIGNED(p_image, sizeof(uint64_t)) || p_hdr->size > max_size ||
+	    p_hdr->size < sizeof(*p_hdr)) {
+		return -EINVAL;
+	}
+
+	ret = slot_begin(p_swap, &p_slot);
+	if (ret) {
+		return ret;
+	}
+
+	return slot_commit(p_swap, p_slot, p_hdr, p_hdr->size);
+}
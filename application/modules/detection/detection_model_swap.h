@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_MODEL_SWAP_H_
+#define _DETECTION_MODEL_SWAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+/* "NMDL" in little-endian byte order */
+#define DETECTION_MODEL_IMAGE_MAGIC 0x4c444d4eU
+
+#define DETECTION_MODEL_IMAGE_VERSION 2
+
+/**
+ * @brief Header of a serialized model image, generated by scripts/model_image.py
+ *
+ * The header is followed by these arrays, each starting at a multiple of
+ * 4 bytes from the start of the image:
+ *
+ *   u64 features_masks[masks_num]       feature extraction masks
+ *   f32 weights[weights_num]
+ *   f32 act_weights[neurons_num]        activation weights
+ *   f32 features_min[features_num]      feature scaling minimums
+ *   f32 features_max[features_num]      feature scaling maximums
+ *   u16 links[weights_num]
+ *   u16 internal_links_num[neurons_num]
+ *   u16 external_links_num[neurons_num]
+ *   u16 output_indices[outputs_num]
+ *   u8  act_type_mask[(neurons_num + 7) / 8]
+ *
+ * Images are copied into the RAM buffer of a model slot before use, or used
+ * in place from memory-mapped flash.
+ */
+struct detection_model_image_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t header_size;
+	/* Image size including the header */
+	uint32_t size;
+	/* CRC-32 (IEEE) of the image after the header */
+	uint32_t crc;
+	uint16_t window_size;
+	uint16_t task;
+	uint16_t neurons_num;
+	uint16_t outputs_num;
+	uint32_t weights_num;
+	uint16_t features_num;
+	uint16_t masks_num;
+	/* Edge AI runtime version the model was generated for, as in nrf_edgeai_rt_version_t */
+	uint32_t runtime_version;
+};
+
+struct flash_area;
+
+/**
+ * @brief Model slot holding a copy of a model image
+ */
+struct detection_model_slot {
+	nrf_edgeai_t edgeai;
+	nrf_edgeai_dsp_pipeline_t dsp;
+	uint64_t image[CONFIG_APP_DETECTION_MODEL_SWAP_IMAGE_MAX / sizeof(uint64_t)];
+};
+
+/**
+ * @brief Double buffered model slots of one registry model
+ *
+ * Both slots are based on a copy of the built-in model context, so they
+ * share its input window, DSP buffers and outputs. A loaded image only
+ * replaces the network and the feature scaling, the feature extraction and
+ * window of the built-in model stay in effect. With feature subsets the image
+ * may also drop features from the masks. The caller activates a pending slot
+ * at a window boundary, the window fill carries over to the new model.
+ */
+struct detection_model_swap {
+	const nrf_edgeai_t *p_builtin;
+	struct detection_model_slot slots[2];
+	/* Slot waiting to be activated, NULL if none */
+	atomic_ptr_t pending;
+	/* Slot the next image is loaded into, the other one may be in use */
+	uint8_t next;
+};
+
+/**
+ * @brief Prepare the model slots
+ * @param p_swap Model slots
+ * @param p_builtin Initialized built-in model the slots are based on
+ */
+void detection_model_swap_init(struct detection_model_swap *p_swap, const nrf_edgeai_t *p_builtin);
+
+/**
+ * @brief Load a model image into the slot not in use and make it pending
+ *
+ * May be called from any thread. Slots are loaded alternately and a slot
+ * is only loaded once the previous one was taken, so the slot in use is
+ * never written. The image is copied into the slot and validated against the
+ * built-in model, it may be overwritten once the call returns.
+ *
+ * @param p_swap Model slots
+ * @param p_image Serialized model image
+ * @param size Size of the image in bytes
+ * @return 0 on success, -EBUSY if a slot is still pending, -EFBIG if the image
+ *	   exceeds CONFIG_APP_DETECTION_MODEL_SWAP_IMAGE_MAX, -EINVAL if it is
+ *	   malformed or does not fit the built-in model, -EBADMSG on a CRC mismatch,
+ *	   -ENOTSUP if it was generated for an incompatible runtime version
+ */
+int detection_model_swap_load(struct detection_model_swap *p_swap, const void *p_image,
+			      size_t size);
+
+/**
+ * @brief Load the model image stored at the start of a flash area
+ *
+ * Same as detection_model_swap_load(), with the image read from flash.
+ *
+ * @param p_swap Model slots
+ * @param p_area Open flash area
+ * @return 0 on success, -ENOENT if the area holds no image, otherwise as
+ *	   detection_model_swap_load() or a flash read error
+ */
+int detection_model_swap_load_area(struct detection_model_swap *p_swap,
+				   const struct flash_area *p_area);
+
+/**
+ * @brief Use a model image in place from memory-mapped flash and make it pending
+ *
+ * Same as detection_model_swap_load(), without copying the image. The image
+ * is validated in place, which may take a while for a large image, so call
+ * it from a thread that may be delayed while inference goes on with the
+ * built-in model. The image must stay unchanged while the slot is in use.
+ *
+ * @param p_swap Model slots
+ * @param p_image Memory-mapped image, aligned to 8 bytes
+ * @param max_size Size of the memory holding the image
+ * @return 0 on success, -ENOENT if there is no image, otherwise as
+ *	   detection_model_swap_load()
+ */
+int detection_model_swap_map(struct detection_model_swap *p_swap, const void *p_image,
+			     size_t max_size);
+
+/**
+ * @brief Make the built-in model pending again
+ *
+ * Switches back from a loaded image at the next window boundary, e.g. from
+ * an image on a subset of the features to the full model.
+ *
+ * @param p_swap Model slots
+ * @return 0 on success, -EBUSY if a slot is still pending
+ */
+int detection_model_swap_restore(struct detection_model_swap *p_swap);
+
+/**
+ * @brief Take the pending slot
+ * @param p_swap Model slots
+ * @return Model context to use from now on, NULL if no slot is pending
+ */
+static inline nrf_edgeai_t *detection_model_swap_take(struct detection_model_swap *p_swap)
+{
+	return (nrf_edgeai_t *)atomic_ptr_clear(&p_swap->pending);
+}
+
+#endif /* _DETECTION_MODEL_SWAP_H_ */
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/logging/log.h>
+#include <errno.h>
+#include <string.h>
+#include "detection_remote.h"
+#include "app_log.h"
+
+LOG_MODULE_DECLARE(app_detection, CONFIG_APP_DETECTION_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_APP_DETECTION_REMOTE_BLOCK_SAMPLES <= DETECTION_REMOTE_BLOCK_MAX,
+	     "Samples messages hold at most DETECTION_REMOTE_BLOCK_MAX samples");
+
+static const struct device *const ipc_dev = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+static struct ipc_ept ept;
+static K_SEM_DEFINE(bound_sem, 0, 1);
+static detection_remote_result_cb_t result_handler;
+
+/* Block being filled, only accessed from the sampling context */
+static struct detection_remote_samples block = {
+	.type = DETECTION_REMOTE_MSG_SAMPLES,
+};
+static uint32_t dropped;
+
+static void ept_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	k_sem_give(&bound_sem);
+}
+
+static void ept_received(const void *data, size_t len, void *priv)
+{
+	const struct detection_remote_result *p_result = data;
+
+	ARG_UNUSED(priv);
+
+	if (len != sizeof(*p_result) || p_result->type != DETECTION_REMOTE_MSG_RESULT ||
+	    p_result->outputs_num > DETECTION_REMOTE_CLASSES_MAX ||
+	    p_result->predicted_class >= p_result->outputs_num) {
+		APP_LOG_WRN_RATELIMIT("Malformed message from remote core, %zu bytes", len);
+		return;
+	}
+
+	result_handler(p_result);
+}
+
+static const struct ipc_ept_cfg ept_cfg = {
+	.name = DETECTION_REMOTE_ENDPOINT,
+	.cb = {
+		.bound = ept_bound,
+		.received = ept_received,
+	},
+};
+
+int detection_remote_init(uint8_t input_type, detection_remote_result_cb_t result_cb)
+{
+	int ret;
+
+	if (input_type != sizeof(block.values.i16[0]) &&
+	    input_type != sizeof(block.values.f32[0])) {
+		return -EINVAL;
+	}
+
+	block.input_type = input_type;
+	result_handler = result_cb;
+
+	ret = ipc_service_open_instance(ipc_dev);
+	if (ret && ret != -EALREADY) {
+		LOG_ERR("Failed to open IPC instance: %d", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc_dev, &ept, &ept_cfg);
+	if (ret) {
+		LOG_ERR("Failed to register IPC endpoint: %d", ret);
+		return ret;
+	}
+
+	ret = k_sem_take(&bound_sem, K_MSEC(CONFIG_APP_DETECTION_REMOTE_BIND_TIMEOUT_MS));
+	if (ret) {
+		LOG_ERR("Remote core did not bind the detection endpoint");
+		return -ETIMEDOUT;
+	}
+
+	LOG_INF("Inference offloaded to the remote core, %u samples per message",
+		CONFIG_APP_DETECTION_REMOTE_BLOCK_SAMPLES);
+
+	return 0;
+}
+
+void detection_remote_feed(const void *p_value, uint32_t time_us)
+{
+	int ret;
+
+	block.times_us[block.count] = time_us;
+	memcpy((uint8_t *)&block.values + block.count * block.input_type, p_value,
+	       block.input_type);
+
+	if (++block.count < CONFIG_APP_DETECTION_REMOTE_BLOCK_SAMPLES) {
+		return;
+	}
+
+	/* No shared buffer free means the remote core is behind, drop the block */
+	ret = ipc_service_send(&ept, &block, sizeof(block));
+	if (ret < 0) {
+		dropped += block.count;
+		APP_LOG_WRN_RATELIMIT("Failed to send samples to remote core: %d, %u dropped", ret,
+				      dropped);
+	}
+
+	block.count = 0;
+}
+
+void detection_remote_restart(void)
+{
+	static const struct detection_remote_restart restart = {
+		.type = DETECTION_REMOTE_MSG_RESTART,
+	};
+	int ret;
+
+	block.count = 0;
+
+	ret = ipc_service_send(&ept, &restart, sizeof(restart));
+	if (ret < 0) {
+		APP_LOG_ERR_RATELIMIT("Failed to restart remote windows: %d", ret);
+	}
+}
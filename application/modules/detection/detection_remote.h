@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_REMOTE_H_
+#define _DETECTION_REMOTE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Name of the IPC service endpoint on both cores */
+#define DETECTION_REMOTE_ENDPOINT "detection"
+
+/* Largest number of samples in one samples message */
+#define DETECTION_REMOTE_BLOCK_MAX 32
+
+/* Largest number of model classes in one result message */
+#define DETECTION_REMOTE_CLASSES_MAX 16
+
+enum detection_remote_msg_type {
+	/* Application core to remote core */
+	DETECTION_REMOTE_MSG_SAMPLES = 1,
+	DETECTION_REMOTE_MSG_RESTART = 2,
+	/* Remote core to application core */
+	DETECTION_REMOTE_MSG_RESULT = 3,
+};
+
+/**
+ * @brief Block of consecutive model inputs
+ *
+ * Values are in the input type of the model, NRF_EDGEAI_INPUT_I16 or
+ * NRF_EDGEAI_INPUT_F32, whose value equals the size of one value in bytes.
+ */
+struct detection_remote_samples {
+	uint8_t type;
+	uint8_t input_type;
+	uint16_t count;
+	/* Capture times of the values in microseconds */
+	uint32_t times_us[DETECTION_REMOTE_BLOCK_MAX];
+	union {
+		int16_t i16[DETECTION_REMOTE_BLOCK_MAX];
+		float f32[DETECTION_REMOTE_BLOCK_MAX];
+	} values;
+};
+
+/**
+ * @brief Discard the windows in progress, sent without payload after a sample gap
+ */
+struct detection_remote_restart {
+	uint8_t type;
+};
+
+/**
+ * @brief Classification of one full window of a model
+ */
+struct detection_remote_result {
+	uint8_t type;
+	uint8_t model;
+	uint16_t predicted_class;
+	/* Capture time of the last sample of the window */
+	uint32_t window_end_us;
+	uint16_t outputs_num;
+	uint16_t reserved;
+	float probabilities[DETECTION_REMOTE_CLASSES_MAX];
+};
+
+/**
+ * @brief Handler of the results received from the remote core
+ * @param p_result Result, valid until the handler returns
+ */
+typedef void (*detection_remote_result_cb_t)(const struct detection_remote_result *p_result);
+
+/**
+ * @brief Open the IPC endpoint to the remote core
+ *
+ * Waits up to CONFIG_APP_DETECTION_REMOTE_BIND_TIMEOUT_MS for the remote core
+ * to register its endpoint. Results are handed to the handler in the IPC
+ * receive context.
+ *
+ * @param input_type Model input type, NRF_EDGEAI_INPUT_I16 or NRF_EDGEAI_INPUT_F32
+ * @param result_cb Result handler
+ * @return 0 on success, negative error code on failure
+ */
+int detection_remote_init(uint8_t input_type, detection_remote_result_cb_t result_cb);
+
+/**
+ * @brief Queue one model input, sent to the remote core once the block is full
+ * @param p_value Model input in the input type of the model
+ * @param time_us Capture time of the input
+ */
+void detection_remote_feed(const void *p_value, uint32_t time_us);
+
+/**
+ * @brief Drop the queued inputs and the windows in progress on the remote core
+ */
+void detection_remote_restart(void);
+
+#endif /* _DETECTION_REMOTE_H_ */
@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * "edgeai" shell commands to inspect the sampling and inference pipeline and
+ * tune it in the field without rebuilding.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <limits.h>
+#include <stdlib.h>
+
+#if defined(CONFIG_APP_PROFILING)
+#include "../profiling/profiling.h"
+#endif
+
+#include "detection.h"
+#include "../sampling/sampling.h"
+
+#if defined(CONFIG_APP_DETECTION_HISTORY)
+#include "detection_history.h"
+#endif
+
+/* Largest number of registry models with an inference rate */
+#define SHELL_MODELS_MAX 8
+
+/* Gate stages tunable at runtime */
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE) || defined(CONFIG_APP_DETECTION_CASCADE)
+#define SHELL_GATES 1
+#else
+#define SHELL_GATES 0
+#endif
+
+/*
+ * SHELL_COND_CMD*() still name the handler of a disabled command, so the
+ * handlers of optional commands are always defined and return -ENOTSUP.
+ */
+
+/* Inferences per model at the last stats command, for the inference rate */
+static uint32_t last_inferences[SHELL_MODELS_MAX];
+static int64_t last_stats_ms;
+
+/**
+ * @brief Parse an unsigned decimal argument
+ * @param arg Argument string
+ * @param max Largest accepted value
+ * @param p_value Parsed value
+ * @return 0 on success, -EINVAL if the argument is not a number up to max
+ */
+static int parse_uint(const char *arg, unsigned long max, unsigned long *p_value)
+{
+	char *end;
+
+	*p_value = strtoul(arg, &end, 10);
+
+	return (*end != '\0' || end == arg || *p_value > max) ? -EINVAL : 0;
+}
+
+/**
+ * @brief Parse a decimal argument that may have a fraction
+ * @param arg Argument string
+ * @param p_value Parsed value, not negative
+ * @return 0 on success, -EINVAL if the argument is not a number
+ */
+static int parse_float(const char *arg, float *p_value)
+{
+	char *end;
+
+	*p_value = strtof(arg, &end);
+
+	return (*end != '\0' || end == arg || *p_value < 0.0f) ? -EINVAL : 0;
+}
+
+/**
+ * @brief Stop sampling for a reconfiguration
+ * @return true if sampling was running and is to be restarted
+ */
+static bool pipeline_pause(void)
+{
+	return sampling_stop() == 0;
+}
+
+static void pipeline_resume(const struct shell *sh, bool was_running)
+{
+	int ret;
+
+	if (!was_running) {
+		return;
+	}
+
+	ret = sampling_start();
+	if (ret) {
+		shell_error(sh, "Failed to restart sampling: %d", ret);
+	}
+}
+
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	struct detection_model_stats model_stats;
+	struct detection_thread_stats thread_stats;
+	struct detection_gap_stats gap_stats;
+	struct sampling_stats sampling_stats;
+#if defined(CONFIG_APP_SAMPLING_TIMING)
+	struct sampling_timing_stats timing_stats;
+#endif
+	int64_t now_ms = k_uptime_get();
+	uint32_t elapsed_ms = now_ms - last_stats_ms;
+	size_t stack_used;
+	size_t stack_size;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sampling_get_stats(&sampling_stats);
+	detection_get_gap_stats(&gap_stats);
+
+	shell_print(sh, "Sampling at %d Hz ODR, %u Hz published", sampling_get_frequency(),
+		    CONFIG_APP_SAMPLING_FREQUENCY_HZ);
+	shell_print(sh, "  read errors %u, publish errors %u, overruns %u, pool drops %u",
+		    sampling_stats.read_errors, sampling_stats.publish_errors,
+		    sampling_stats.overruns, sampling_stats.pool_dropped);
+	shell_print(sh, "  gaps %u, samples lost %u, padded %u, window resets %u",
+		    gap_stats.gaps, gap_stats.samples_lost, gap_stats.samples_padded,
+		    gap_stats.window_resets);
+	if (sampling_get_stack_usage(&stack_used, &stack_size) == 0) {
+		shell_print(sh, "  thread stack %zu of %zu bytes", stack_used, stack_size);
+	}
+#if defined(CONFIG_APP_SAMPLING_TIMING)
+	if (sampling_get_timing_stats(&timing_stats) == 0) {
+		shell_print(sh, "  intervals %u, deadline misses %u, jitter max %u us, "
+			    "latency max %u us", timing_stats.intervals,
+			    timing_stats.deadline_misses, timing_stats.jitter_max_us,
+			    timing_stats.latency_max_us);
+		for (int i = 0; i < SAMPLING_TIMING_BINS; i++) {
+			if (i < SAMPLING_TIMING_BINS - 1) {
+				shell_print(sh, "    jitter < %6u us %8u",
+					    CONFIG_APP_SAMPLING_TIMING_BIN_US << i,
+					    timing_stats.jitter_hist[i]);
+			} else {
+				shell_print(sh, "    jitter >= %5u us %8u",
+					    CONFIG_APP_SAMPLING_TIMING_BIN_US << (i - 1),
+					    timing_stats.jitter_hist[i]);
+			}
+		}
+	}
+#endif
+
+	shell_print(sh, "%-12s %6s %6s %8s %8s %8s %8s %8s %8s %8s %8s", "model", "window",
+		    "shift", "windows", "infer", "gated", "rejected", "events", "deferred", "infer/s",
+		    "RAM");
+
+	for (uint8_t i = 0; detection_model_name(i); i++) {
+		uint32_t rate_milli = 0;
+
+		if (detection_get_model_stats(i, &model_stats)) {
+			continue;
+		}
+
+		if (i < ARRAY_SIZE(last_inferences)) {
+			if (elapsed_ms > 0) {
+				rate_milli = (uint64_t)(model_stats.inferences - last_inferences[i]) *
+					     MSEC_PER_SEC * 1000U / elapsed_ms;
+			}
+			last_inferences[i] = model_stats.inferences;
+		}
+
+		shell_print(sh, "%-12s %6u %6u %8u %8u %8u %8u %8u %8u %4u.%03u %8u",
+			    detection_model_name(i), model_stats.window_size,
+			    model_stats.window_shift, model_stats.windows, model_stats.inferences,
+			    model_stats.gated_windows, model_stats.rejected_windows,
+			    model_stats.event_windows, model_stats.deferred_windows,
+			    rate_milli / 1000U, rate_milli % 1000U, model_stats.ram_bytes);
+	}
+
+	last_stats_ms = now_ms;
+
+	if (detection_get_thread_stats(0, &thread_stats) == 0) {
+		shell_print(sh, "%-12s %8s %12s", "thread", "CPU", "stack");
+
+		for (uint8_t i = 0; detection_get_thread_stats(i, &thread_stats) == 0; i++) {
+			uint16_t permille = thread_stats.cpu_permille;
+
+			shell_print(sh, "%-12s %4u.%01u %% %5zu/%-6zu", thread_stats.name,
+				    permille / 10U, permille % 10U, thread_stats.stack_used,
+				    thread_stats.stack_size);
+		}
+	}
+
+#if defined(CONFIG_APP_PROFILING)
+	struct profiling_stats stats;
+
+	shell_print(sh, "%-18s %8s %8s %8s", "stage", "count", "avg", "p99");
+
+	for (int i = 0; i < PROFILING_STAGE_NUM; i++) {
+		profiling_get(i, &stats);
+		if (stats.count == 0) {
+			continue;
+		}
+
+		shell_print(sh, "%-18s %8u %8u %8u", profiling_stage_name(i), stats.count,
+			    stats.avg, stats.p99);
+	}
+#endif
+
+	return 0;
+}
+
+static int cmd_rate(const struct shell *sh, size_t argc, char **argv)
+{
+	unsigned long frequency_hz;
+	bool was_running;
+	int ret;
+
+	ARG_UNUSED(argc);
+
+	if (parse_uint(argv[1], INT_MAX, &frequency_hz)) {
+		shell_error(sh, "Invalid rate: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	/* The ODR can only change while sampling is stopped */
+	was_running = pipeline_pause();
+	ret = sampling_set_frequency(frequency_hz);
+	pipeline_resume(sh, was_running);
+
+	if (ret) {
+		shell_error(sh, "Failed to set %lu Hz: %d", frequency_hz, ret);
+		return ret;
+	}
+
+	shell_print(sh, "ODR set to %lu Hz", frequency_hz);
+
+	return 0;
+}
+
+static int cmd_window(const struct shell *sh, size_t argc, char **argv)
+{
+	unsigned long shift;
+	unsigned long model = 0;
+	int ret;
+
+	if (parse_uint(argv[1], UINT16_MAX, &shift) ||
+	    (argc > 2 && parse_uint(argv[2], UINT8_MAX, &model))) {
+		shell_error(sh, "Invalid arguments");
+		return -EINVAL;
+	}
+
+	ret = detection_set_window_shift(model, shift);
+	if (ret) {
+		shell_error(sh, "Failed to set window shift: %d", ret);
+		return ret;
+	}
+
+	shell_print(sh, "%s window shift %lu from the next window", detection_model_name(model),
+		    shift);
+
+	return 0;
+}
+
+static int cmd_history(const struct shell *sh, size_t argc, char **argv)
+{
+#if defined(CONFIG_APP_DETECTION_HISTORY)
+	struct detection_history_iter iter;
+	struct detection_history_entry entry;
+	unsigned long num = 16;
+
+	if (argc > 1 && parse_uint(argv[1], UINT16_MAX, &num)) {
+		shell_error(sh, "Invalid number of windows: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	shell_print(sh, "%-12s %6s %5s %12s %12s", "model", "class", "conf", "start us",
+		    "end us");
+
+	detection_history_iter_latest(&iter, num);
+	while (detection_history_next(&iter, &entry)) {
+		const char *name = detection_model_name(entry.model);
+
+		shell_print(sh, "%-12s %6u %5u %12u %12u", name ? name : "?",
+			    entry.predicted_class, entry.confidence_q8, entry.window_start_us,
+			    entry.window_end_us);
+	}
+
+	if (iter.lost > 0) {
+		shell_print(sh, "%u windows overwritten while printing", iter.lost);
+	}
+
+	return 0;
+#else
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	return -ENOTSUP;
+#endif
+}
+
+static int cmd_gate_energy(const struct shell *sh, size_t argc, char **argv)
+{
+#if defined(CONFIG_APP_DETECTION_ENERGY_GATE)
+	float threshold_mg;
+
+	ARG_UNUSED(argc);
+
+	if (parse_float(argv[1], &threshold_mg)) {
+		shell_error(sh, "Invalid threshold: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	detection_set_energy_gate_threshold(threshold_mg);
+	shell_print(sh, "Energy gate threshold set to %s mg", argv[1]);
+
+	return 0;
+#else
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	return -ENOTSUP;
+#endif
+}
+
+static int cmd_gate_cascade(const struct shell *sh, size_t argc, char **argv)
+{
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+	float range_max_mg;
+	float stddev_max_mg;
+	unsigned long model = 0;
+	int ret;
+
+	if (parse_float(argv[1], &range_max_mg) || parse_float(argv[2], &stddev_max_mg) ||
+	    (argc > 3 && parse_uint(argv[3], UINT8_MAX, &model))) {
+		shell_error(sh, "Invalid arguments");
+		return -EINVAL;
+	}
+
+	ret = detection_set_cascade_limits(model, range_max_mg, stddev_max_mg);
+	if (ret) {
+		shell_error(sh, "Model %lu has no gate stage", model);
+		return ret;
+	}
+
+	shell_print(sh, "Cascade gate limits set to %s mg range, %s mg deviation", argv[1],
+		    argv[2]);
+
+	return 0;
+#else
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	return -ENOTSUP;
+#endif
+}
+
+static int cmd_bench(const struct shell *sh, size_t argc, char **argv)
+{
+	unsigned long iterations = 100;
+	unsigned long model = 0;
+	uint32_t cycles;
+	bool was_running;
+	int ret;
+
+	if ((argc > 1 && parse_uint(argv[1], UINT16_MAX, &iterations)) ||
+	    (argc > 2 && parse_uint(argv[2], UINT8_MAX, &model))) {
+		shell_error(sh, "Invalid arguments");
+		return -EINVAL;
+	}
+
+	/* No new samples meanwhile, detection_benchmark() waits for queued ones to be fed */
+	was_running = pipeline_pause();
+	ret = detection_benchmark(model, iterations, &cycles);
+	pipeline_resume(sh, was_running);
+
+	if (ret) {
+		shell_error(sh, "Benchmark failed: %d", ret);
+		return ret;
+	}
+
+	shell_print(sh, "%s: %u cycles, %u us per inference over %lu runs",
+		    detection_model_name(model), cycles, k_cyc_to_us_floor32(cycles), iterations);
+
+	return 0;
+}
+
+static int cmd_replay(const struct shell *sh, size_t argc, char **argv)
+{
+#if defined(CONFIG_APP_SAMPLING_REPLAY)
+	uint32_t inferences[SHELL_MODELS_MAX] = {0};
+	struct detection_model_stats model_stats;
+	struct sampling_replay_stats replay_stats;
+	uint64_t hz = sys_clock_hw_cycles_per_sec();
+	int ret;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	/* A running replay or live sampling is restarted from the start of the trace */
+	(void)pipeline_pause();
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(inferences) && detection_model_name(i); i++) {
+		if (detection_get_model_stats(i, &model_stats) == 0) {
+			inferences[i] = model_stats.inferences;
+		}
+	}
+
+	ret = sampling_start();
+	if (ret) {
+		shell_error(sh, "Failed to start replay: %d", ret);
+		return ret;
+	}
+
+	ret = sampling_replay_wait(K_FOREVER, &replay_stats);
+	if (ret || replay_stats.cycles == 0) {
+		shell_error(sh, "Replay failed: %d", ret);
+		return -EIO;
+	}
+
+	shell_print(sh, "%u samples in %u ms, %u samples/s, %u publish errors",
+		    replay_stats.samples, (uint32_t)k_cyc_to_ms_floor64(replay_stats.cycles),
+		    (uint32_t)(replay_stats.samples * hz / replay_stats.cycles),
+		    replay_stats.publish_errors);
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(inferences) && detection_model_name(i); i++) {
+		uint32_t count;
+
+		if (detection_get_model_stats(i, &model_stats)) {
+			continue;
+		}
+
+		count = model_stats.inferences - inferences[i];
+		shell_print(sh, "%-12s %8u inferences, %u inferences/s", detection_model_name(i),
+			    count, (uint32_t)(count * hz / replay_stats.cycles));
+	}
+
+	return 0;
+#else
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	return -ENOTSUP;
+#endif
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(edgeai_gate_cmds,
+	SHELL_COND_CMD_ARG(CONFIG_APP_DETECTION_ENERGY_GATE, energy, NULL,
+			   "Set the energy gate range <mg>", cmd_gate_energy, 2, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_DETECTION_CASCADE, cascade, NULL,
+			   "Set the cascade gate limits <range mg> <stddev mg> [model]",
+			   cmd_gate_cascade, 3, 1),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(edgeai_cmds,
+	SHELL_CMD(stats, NULL, "Show sample losses, inference counts and rates, RAM use",
+		  cmd_stats),
+	SHELL_CMD_ARG(rate, NULL, "Set the IMU output data rate <hz>", cmd_rate, 2, 0),
+	SHELL_CMD_ARG(window, NULL, "Set the window shift, a multiple of the model shift "
+		      "<samples> [model]", cmd_window, 2, 1),
+	SHELL_COND_CMD(SHELL_GATES, gate, &edgeai_gate_cmds, "Tune the gate stages", NULL),
+	SHELL_COND_CMD_ARG(CONFIG_APP_DETECTION_HISTORY, history, NULL,
+			   "Show the latest classified windows [num]", cmd_history, 1, 1),
+	SHELL_CMD_ARG(bench, NULL, "Time inference on the current window [runs] [model]",
+		      cmd_bench, 1, 2),
+	SHELL_COND_CMD(CONFIG_APP_SAMPLING_REPLAY, replay, NULL,
+		       "Replay the recorded trace at full speed, print the throughput", cmd_replay),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(edgeai, &edgeai_cmds, "Sampling and inference pipeline", NULL);
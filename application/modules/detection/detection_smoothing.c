@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <errno.h>
+#include <string.h>
+#include "detection_smoothing.h"
+
+BUILD_ASSERT(CONFIG_APP_DETECTION_SMOOTHING_VOTE_WINDOWS <= UINT8_MAX,
+	     "Vote counts are 8 bit");
+
+/* Weight of the newest window in the exponential average */
+#define SMOOTHING_ALPHA (CONFIG_APP_DETECTION_SMOOTHING_ALPHA_PCT / 100.0f)
+
+static uint8_t min_confidence_pct(const struct detection_smoothing *p_smoothing, uint16_t class)
+{
+	const struct detection_smoothing_config *p_config = p_smoothing->p_config;
+
+	if (p_config && p_config->p_min_confidence_pct) {
+		return p_config->p_min_confidence_pct[class];
+	}
+
+	return CONFIG_APP_DETECTION_SMOOTHING_MIN_CONFIDENCE_PCT;
+}
+
+static uint8_t min_dwell(const struct detection_smoothing *p_smoothing, uint16_t class)
+{
+	const struct detection_smoothing_config *p_config = p_smoothing->p_config;
+
+	if (p_config && p_config->p_min_dwell) {
+		return p_config->p_min_dwell[class];
+	}
+
+	return CONFIG_APP_DETECTION_SMOOTHING_MIN_DWELL;
+}
+
+int detection_smoothing_init(struct detection_smoothing *p_smoothing, uint16_t num_classes,
+			     const struct detection_smoothing_config *p_config)
+{
+	if (num_classes == 0 || num_classes > DETECTION_SMOOTHING_CLASSES_MAX) {
+		return -EINVAL;
+	}
+
+	memset(p_smoothing, 0, sizeof(*p_smoothing));
+	p_smoothing->p_config = p_config;
+	p_smoothing->num_classes = num_classes;
+	p_smoothing->current = DETECTION_SMOOTHING_CLASS_NONE;
+	p_smoothing->pending = DETECTION_SMOOTHING_CLASS_NONE;
+
+	return 0;
+}
+
+/* Replace the oldest vote, windows without a confident class vote for none */
+static void smoothing_vote(struct detection_smoothing *p_smoothing, uint16_t class)
+{
+	if (p_smoothing->vote_num == CONFIG_APP_DETECTION_SMOOTHING_VOTE_WINDOWS) {
+		uint16_t oldest = p_smoothing->votes[p_smoothing->vote_head];
+
+		if (oldest != DETECTION_SMOOTHING_CLASS_NONE) {
+			p_smoothing->vote_counts[oldest]--;
+		}
+	} else {
+		p_smoothing->vote_num++;
+	}
+
+	p_smoothing->votes[p_smoothing->vote_head] = class;
+	if (class != DETECTION_SMOOTHING_CLASS_NONE) {
+		p_smoothing->vote_counts[class]++;
+	}
+
+	p_smoothing->vote_head++;
+	if (p_smoothing->vote_head == CONFIG_APP_DETECTION_SMOOTHING_VOTE_WINDOWS) {
+		p_smoothing->vote_head = 0;
+	}
+}
+
+/* Class with the most votes, the current class wins ties */
+static uint16_t smoothing_winner(const struct detection_smoothing *p_smoothing)
+{
+	uint16_t winner = p_smoothing->current;
+	uint8_t best = (winner != DETECTION_SMOOTHING_CLASS_NONE) ?
+		       p_smoothing->vote_counts[winner] : 0;
+
+	for (uint16_t i = 0; i < p_smoothing->num_classes; i++) {
+		if (p_smoothing->vote_counts[i] > best) {
+			best = p_smoothing->vote_counts[i];
+			winner = i;
+		}
+	}
+
+	return winner;
+}
+
+uint16_t detection_smoothing_update(struct detection_smoothing *p_smoothing,
+				    const float *p_probabilities, float *p_confidence)
+{
+	bool first = (p_smoothing->vote_num == 0);
+	uint16_t top = 0;
+	uint16_t winner;
+
+	for (uint16_t i = 0; i < p_smoothing->num_classes; i++) {
+		float *p_average = &p_smoothing->average[i];
+
+		*p_average = first ? p_probabilities[i] :
+			     *p_average + SMOOTHING_ALPHA * (p_probabilities[i] - *p_average);
+
+		if (*p_average > p_smoothing->average[top]) {
+			top = i;
+		}
+	}
+
+	if (p_smoothing->average[top] * 100.0f < min_confidence_pct(p_smoothing, top)) {
+		top = DETECTION_SMOOTHING_CLASS_NONE;
+	}
+
+	smoothing_vote(p_smoothing, top);
+	winner = smoothing_winner(p_smoothing);
+
+	if (winner == p_smoothing->current) {
+		p_smoothing->pending = DETECTION_SMOOTHING_CLASS_NONE;
+	} else {
+		if (winner != p_smoothing->pending) {
+			p_smoothing->pending = winner;
+			p_smoothing->pending_windows = 0;
+		}
+
+		if (++p_smoothing->pending_windows >= min_dwell(p_smoothing, winner)) {
+			p_smoothing->current = winner;
+			p_smoothing->pending = DETECTION_SMOOTHING_CLASS_NONE;
+		}
+	}
+
+	if (p_smoothing->current != DETECTION_SMOOTHING_CLASS_NONE) {
+		*p_confidence = p_smoothing->average[p_smoothing->current];
+	} else {
+		*p_confidence = 0.0f;
+	}
+
+	return p_smoothing->current;
+}
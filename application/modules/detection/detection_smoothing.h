@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_SMOOTHING_H_
+#define _DETECTION_SMOOTHING_H_
+
+#include <stdint.h>
+
+/* Largest number of classes a smoothed model may have */
+#define DETECTION_SMOOTHING_CLASSES_MAX 16
+
+/* No class accepted yet */
+#define DETECTION_SMOOTHING_CLASS_NONE UINT16_MAX
+
+/**
+ * @brief Per-class thresholds, NULL arrays use the Kconfig defaults for every class
+ */
+struct detection_smoothing_config {
+	/* Smoothed probability in percent a class needs to be voted for */
+	const uint8_t *p_min_confidence_pct;
+	/* Consecutive winning windows before a class replaces the current one */
+	const uint8_t *p_min_dwell;
+};
+
+/**
+ * @brief Smoothing state of one model
+ */
+struct detection_smoothing {
+	const struct detection_smoothing_config *p_config;
+	uint16_t num_classes;
+	/* Exponential average of the class probabilities */
+	float average[DETECTION_SMOOTHING_CLASSES_MAX];
+	/* Votes of the last windows and the number of votes per class */
+	uint16_t votes[CONFIG_APP_DETECTION_SMOOTHING_VOTE_WINDOWS];
+	uint8_t vote_counts[DETECTION_SMOOTHING_CLASSES_MAX];
+	uint8_t vote_head;
+	uint8_t vote_num;
+	/* Accepted class and the class waiting for its dwell time */
+	uint16_t current;
+	uint16_t pending;
+	uint8_t pending_windows;
+};
+
+/**
+ * @brief Reset the smoothing state, the next window starts from scratch
+ * @param p_smoothing Smoothing state
+ * @param num_classes Number of model classes
+ * @param p_config Per-class thresholds or NULL for the Kconfig defaults
+ * @return 0 on success, -EINVAL if the model has too many classes
+ */
+int detection_smoothing_init(struct detection_smoothing *p_smoothing, uint16_t num_classes,
+			     const struct detection_smoothing_config *p_config);
+
+/**
+ * @brief Smooth the class probabilities of one window
+ *
+ * The probabilities are averaged exponentially. The class with the highest
+ * average gets the vote of the window if it reaches its minimum confidence.
+ * The class with the most votes over the last windows replaces the current
+ * class once it has won for its minimum dwell time. Runs in O(classes).
+ *
+ * @param p_smoothing Smoothing state
+ * @param p_probabilities Class probabilities of the window
+ * @param p_confidence Smoothed probability of the returned class
+ * @return Accepted class, DETECTION_SMOOTHING_CLASS_NONE until one is accepted
+ */
+uint16_t detection_smoothing_update(struct detection_smoothing *p_smoothing,
+				    const float *p_probabilities, float *p_confidence);
+
+#endif /* _DETECTION_SMOOTHING_H_ */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+#include "detection_summary.h"
+
+/* Upper bounds of the episode duration histogram bins, the last bin is open */
+static const uint32_t dwell_bin_edges_ms[DETECTION_SUMMARY_DWELL_BINS - 1] = {
+	10 * MSEC_PER_SEC,
+	60 * MSEC_PER_SEC,
+	600 * MSEC_PER_SEC,
+	3600 * MSEC_PER_SEC,
+};
+
+static void summary_reset(struct detection_summary *p_summary, uint32_t now_ms)
+{
+	uint8_t model = p_summary->model;
+	uint16_t num_classes = p_summary->num_classes;
+
+	memset(p_summary, 0, sizeof(*p_summary));
+	p_summary->model = model;
+	p_summary->num_classes = num_classes;
+	p_summary->start_ms = now_ms;
+}
+
+/* Add the time since the last window to the running episode, call with the lock held */
+static void summary_advance(struct detection_summary_state *p_state, uint32_t now_ms)
+{
+	if (p_state->current != DETECTION_SUMMARY_CLASS_NONE) {
+		p_state->summary.dwell_ms[p_state->current] += now_ms - p_state->last_ms;
+		p_state->last_ms = now_ms;
+	}
+}
+
+/* Add the running episode to the histogram, call with the lock held */
+static void summary_end_episode(struct detection_summary_state *p_state)
+{
+	uint32_t duration_ms = p_state->last_ms - p_state->episode_start_ms;
+	uint16_t bin = 0;
+
+	if (p_state->current == DETECTION_SUMMARY_CLASS_NONE) {
+		return;
+	}
+
+	while (bin < ARRAY_SIZE(dwell_bin_edges_ms) && duration_ms >= dwell_bin_edges_ms[bin]) {
+		bin++;
+	}
+
+	p_state->summary.episodes[p_state->current][bin]++;
+	p_state->current = DETECTION_SUMMARY_CLASS_NONE;
+}
+
+int detection_summary_init(struct detection_summary_state *p_state, uint8_t model,
+			   uint16_t num_classes, uint32_t now_ms)
+{
+	if (num_classes > DETECTION_SUMMARY_CLASSES_MAX) {
+		return -EINVAL;
+	}
+
+	p_state->summary.model = model;
+	p_state->summary.num_classes = num_classes;
+	summary_reset(&p_state->summary, now_ms);
+	p_state->current = DETECTION_SUMMARY_CLASS_NONE;
+
+	return 0;
+}
+
+void detection_summary_update(struct detection_summary_state *p_state, uint16_t predicted_class,
+			      uint32_t now_ms)
+{
+	k_spinlock_key_t key;
+
+	if (predicted_class >= p_state->summary.num_classes) {
+		return;
+	}
+
+	key = k_spin_lock(&p_state->lock);
+
+	summary_advance(p_state, now_ms);
+
+	if (predicted_class != p_state->current) {
+		summary_end_episode(p_state);
+		p_state->current = predicted_class;
+		p_state->episode_start_ms = now_ms;
+		p_state->last_ms = now_ms;
+		p_state->summary.entries[predicted_class]++;
+	}
+
+	k_spin_unlock(&p_state->lock, key);
+}
+
+void detection_summary_stop(struct detection_summary_state *p_state)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_state->lock);
+
+	summary_end_episode(p_state);
+
+	k_spin_unlock(&p_state->lock, key);
+}
+
+void detection_summary_take(struct detection_summary_state *p_state, uint32_t now_ms,
+			    struct detection_summary *p_summary)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_state->lock);
+
+	/* Count the running episode up to now, it goes on in the next interval */
+	summary_advance(p_state, now_ms);
+	p_state->summary.duration_ms = now_ms - p_state->summary.start_ms;
+	*p_summary = p_state->summary;
+	summary_reset(&p_state->summary, now_ms);
+
+	k_spin_unlock(&p_state->lock, key);
+}
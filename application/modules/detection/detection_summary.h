@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_SUMMARY_H_
+#define _DETECTION_SUMMARY_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include "detection.h"
+
+/* No classified window yet, or since detection was reset */
+#define DETECTION_SUMMARY_CLASS_NONE UINT16_MAX
+
+/**
+ * @brief Class durations of one model over the current reporting interval
+ *
+ * Updated from the inference context and taken from the summary work item,
+ * so the accumulated summary is protected by a spinlock.
+ */
+struct detection_summary_state {
+	struct k_spinlock lock;
+	struct detection_summary summary;
+	/* Class of the running episode and its start */
+	uint16_t current;
+	uint32_t episode_start_ms;
+	/* Time of the last classified window */
+	uint32_t last_ms;
+};
+
+/**
+ * @brief Start the first reporting interval
+ * @param p_state Summary state
+ * @param model Index of the model in the detection registry
+ * @param num_classes Number of model classes
+ * @param now_ms Current uptime in milliseconds
+ * @return 0 on success, -EINVAL if the model has too many classes
+ */
+int detection_summary_init(struct detection_summary_state *p_state, uint8_t model,
+			   uint16_t num_classes, uint32_t now_ms);
+
+/**
+ * @brief Account the class of one window
+ *
+ * The time since the previous window counts to the class of the running
+ * episode, a different class ends the episode and starts a new one.
+ *
+ * @param p_state Summary state
+ * @param predicted_class Class of the window
+ * @param now_ms Window time in milliseconds
+ */
+void detection_summary_update(struct detection_summary_state *p_state, uint16_t predicted_class,
+			      uint32_t now_ms);
+
+/**
+ * @brief End the running episode at the last window
+ *
+ * Call it when classification stops, the time until the next window then
+ * counts to no class.
+ *
+ * @param p_state Summary state
+ */
+void detection_summary_stop(struct detection_summary_state *p_state);
+
+/**
+ * @brief Take the summary of the current interval and start the next one
+ *
+ * The running episode carries over to the next interval, its duration is
+ * added to the histogram of the interval it ends in.
+ *
+ * @param p_state Summary state
+ * @param now_ms Current uptime in milliseconds
+ * @param p_summary Summary of the ended interval
+ */
+void detection_summary_take(struct detection_summary_state *p_state, uint32_t now_ms,
+			    struct detection_summary *p_summary);
+
+#endif /* _DETECTION_SUMMARY_H_ */
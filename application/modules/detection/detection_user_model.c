@@ -0,0 +1,1371 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <float.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <nrf_edgeai/rt/nrf_edgeai_runtime.h>
+
+#include "detection_user_model.h"
+
+#if defined(CONFIG_APP_DETECTION_WEIGHTS_IN_RAM) && defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+/* Initialized data, the startup code copies the packed records to RAM once at boot */
+#define MODEL_PACKED_CONST
+#endif
+
+/*
+ * The export is compiled here for its constants and macros. Its own context,
+ * buffers and nrf_edgeai_user_model() are renamed out of the way and never
+ * referenced, so the linker drops them.
+ */
+nrf_edgeai_t *nrf_edgeai_user_model_export(void);
+
+#define nrf_edgeai_user_model nrf_edgeai_user_model_export
+#include "nrf_edgeai_generated/nrf_edgeai_user_model.c"
+#undef nrf_edgeai_user_model
+
+#if defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE)
+#include "app_dsp_features_inline.h"
+#elif defined(CONFIG_APP_DETECTION_INCREMENTAL_FEATURES) ||                                       \
+	defined(CONFIG_APP_DETECTION_FUSED_FEATURES)
+#include "app_dsp.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+#include "nrf_edgeai_generated/nrf_edgeai_user_model_packed.h"
+#elif defined(CONFIG_APP_DETECTION_COMPILED_MODEL)
+#include "nrf_edgeai_generated/nrf_edgeai_user_model_compiled.h"
+#endif
+
+#if defined(CONFIG_APP_PROFILING)
+#include "profiling.h"
+#endif
+
+#if defined(CONFIG_APP_PROFILING_MARKERS)
+#include "profiling_marker.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_CACHE) || defined(CONFIG_APP_DETECTION_SHARED_SCRATCH) || \
+	defined(CONFIG_APP_DETECTION_CASCADE)
+#include "detection.h"
+#endif
+
+#if defined(CONFIG_APP_DETECTION_CASCADE)
+/* Models loaded at runtime are checked at init, the generated one already here */
+BUILD_ASSERT(MODEL_OUTPUTS_NUM <= DETECTION_GATE_CLASSES_MAX,
+	     "Generated model has more classes than a cascade gate output holds");
+#endif
+
+/* Samples the window moves by per inference */
+#if defined(CONFIG_APP_DETECTION_SLIDING_WINDOW)
+#define MODEL_WINDOW_SHIFT CONFIG_APP_DETECTION_WINDOW_SHIFT
+BUILD_ASSERT(MODEL_WINDOW_SHIFT <= INPUT_WINDOW_SIZE,
+	     "CONFIG_APP_DETECTION_WINDOW_SHIFT exceeds the input window of the generated model");
+#else
+#define MODEL_WINDOW_SHIFT INPUT_WINDOW_SHIFT
+#endif
+
+/* Time-domain feature mask of an input feature, a compile-time constant */
+#define TIMEDOMAIN_FEATURES_MASK(_i) ((uint32_t)(FEATURES_EXTRACTION_MASK[_i] >> 32))
+
+/* The export names the context of its frequency-domain features as the time-domain one */
+#if defined(P_FREQDOMAIN_FEATURES_CTX)
+#define MODEL_USES_FREQDOMAIN_FEATURES 1
+#else
+#define MODEL_USES_FREQDOMAIN_FEATURES 0
+#endif
+
+#if MODEL_USES_FREQDOMAIN_FEATURES
+/* FFT plan for the window length, generated by scripts/fft_tables.py INPUT_WINDOW_SIZE */
+#include "nrf_edgeai_generated/nrf_edgeai_user_fft_tables.h"
+
+#if defined(FREQDOMAIN_WINDOW_LEN)
+#include <nrf_edgeai/dsp/nrf_dsp_fast_math.h>
+#include <nrf_edgeai/dsp/nrf_dsp_transform.h>
+#include "app_dsp.h"
+#endif
+
+BUILD_ASSERT(INPUT_WINDOW_SIZE <= FREQDOMAIN_RFFT_LEN,
+	     "FFT tables do not match the input window, regenerate them");
+#endif
+
+#if MODEL_USES_FREQDOMAIN_FEATURES && defined(CONFIG_APP_DETECTION_IN_PLACE_FFT)
+#if (INPUT_UNIQ_FEATURES_NUM != 1) || (INPUT_SUBWINDOW_NUM != 0)
+#error "In-place FFT supports one input feature without subwindows"
+#endif
+/* The window is transformed in place after its time-domain features, so it holds the FFT */
+#define MODEL_WINDOW_BUFFER_SIZE_BYTES (FREQDOMAIN_RFFT_LEN * INPUT_TYPE_SIZE)
+#elif defined(CONFIG_APP_DETECTION_MIRRORED_WINDOW)
+#if INPUT_UNIQ_FEATURES_NUM != 1
+#error "Mirrored window supports a single input feature only"
+#endif
+/* Ring of the window samples, each written twice one window size apart */
+#define MODEL_WINDOW_BUFFER_SIZE_BYTES (2 * INPUT_WINDOW_SIZE * INPUT_TYPE_SIZE)
+#else
+#define MODEL_WINDOW_BUFFER_SIZE_BYTES INPUT_WINDOW_BUFFER_SIZE_BYTES
+#endif
+
+#if defined(CONFIG_APP_DETECTION_PING_PONG_WINDOW)
+/* Two windows, one is fed while inference reads the other */
+#define MODEL_WINDOW_BUFFERS_NUM 2
+#else
+#define MODEL_WINDOW_BUFFERS_NUM 1
+#endif
+
+#if defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+/* Activation slots are reused between neurons, see scripts/neuton_pack.py */
+#define MODEL_NEURONS_BUFFER_NUM       MODEL_PACKED_SLOTS_NUM
+#define P_MODEL_OUTPUT_NEURONS_INDICES MODEL_PACKED_OUTPUT_SLOTS
+#elif defined(CONFIG_APP_DETECTION_COMPILED_MODEL)
+/* The compiled network keeps neurons in locals and only stores the outputs */
+#define MODEL_NEURONS_BUFFER_NUM       MODEL_OUTPUTS_NUM
+#define P_MODEL_OUTPUT_NEURONS_INDICES MODEL_COMPILED_OUTPUT_SLOTS
+#else
+#define MODEL_NEURONS_BUFFER_NUM       MODEL_NEURONS_NUM
+#define P_MODEL_OUTPUT_NEURONS_INDICES MODEL_OUTPUT_NEURONS_INDICES
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE) &&                                         \
+	defined(CONFIG_APP_DETECTION_FEATURE_CALIBRATION)
+#if !__has_include("nrf_edgeai_generated/nrf_edgeai_user_model_calibration.h")
+#error "Generate the feature reference with scripts/feature_reference.py"
+#endif
+/* Scaled features of the training data in the calibration condition */
+#include "nrf_edgeai_generated/nrf_edgeai_user_model_calibration.h"
+#endif
+
+/* Buffers only used while an inference runs */
+struct model_scratch {
+	nrf_user_neuron_t model_neurons[MODEL_NEURONS_BUFFER_NUM];
+	uint8_t extracted_features_buffer[EXTRACTED_FEATURES_BUFFER_SIZE_BYTES]
+		__NRF_EDGEAI_ALIGNED;
+#if MODEL_USES_FREQDOMAIN_FEATURES && !defined(CONFIG_APP_DETECTION_IN_PLACE_FFT)
+	flt32_t freqdomain_rfft_buffer[FREQDOMAIN_RFFT_LEN] __NRF_EDGEAI_ALIGNED;
+#endif
+};
+
+#define SCRATCH_MEMBER_SIZE(_member) sizeof(((struct model_scratch *)NULL)->_member)
+
+#if MODEL_USES_FREQDOMAIN_FEATURES
+#define FREQDOMAIN_FEATURES_NUM (sizeof(freqdomain_features_) / sizeof(freqdomain_features_[0]))
+#endif
+
+/*
+ * Mutable state of one model instance. The weights, links, scaling factors and
+ * pipeline function tables of the export are shared, so instances running on
+ * other streams or threads only add their buffers.
+ */
+struct nrf_edgeai_user_model_instance_s {
+	nrf_edgeai_t edgeai;
+	nrf_edgeai_window_ctx_t input_window_ctx;
+	nrf_edgeai_dsp_pipeline_t dsp_pipeline;
+#if defined(CONFIG_APP_DETECTION_INCREMENTAL_FEATURES)
+	nrf_edgeai_features_pipeline_ctx_t timedomain_pipeline;
+	struct app_dsp_online online_features;
+	float online_features_leaving[MODEL_WINDOW_SHIFT];
+	struct app_dsp_online_entry online_features_min_entries[INPUT_WINDOW_SIZE];
+	struct app_dsp_online_entry online_features_max_entries[INPUT_WINDOW_SIZE];
+#elif defined(CONFIG_APP_DETECTION_SUBWINDOW_FEATURES)
+	nrf_edgeai_features_pipeline_ctx_t timedomain_pipeline;
+	struct app_dsp_stats_acc window_stats;
+#endif
+#if defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE)
+	/* Min-max scaling of the features with the reciprocal ranges */
+	struct app_dsp_scale feature_scale;
+	flt32_t feature_scale_recip[EXTRACTED_FEATURES_NUM];
+#endif
+#if defined(CONFIG_APP_DETECTION_GATHER_FEED) &&                                                  \
+	(INPUT_UNIQ_FEATURES_USED_NUM != INPUT_UNIQ_FEATURES_NUM)
+	/* Input sample positions of the used features, from the usage mask at setup */
+	uint8_t input_gather_indices[INPUT_UNIQ_FEATURES_USED_NUM];
+#endif
+#if defined(CONFIG_APP_DETECTION_MIRRORED_WINDOW)
+	/* Samples until the next window is complete */
+	uint16_t window_missing;
+#endif
+#if defined(CONFIG_APP_DETECTION_FEATURE_CALIBRATION)
+	/* Feature scaling of this device, calibrated on the first windows */
+	struct app_dsp_scale_cal feature_cal;
+	struct app_dsp_ewma feature_cal_stats[EXTRACTED_FEATURES_NUM];
+	float feature_cal_min[EXTRACTED_FEATURES_NUM];
+	float feature_cal_recip[EXTRACTED_FEATURES_NUM];
+#endif
+#if defined(CONFIG_APP_DETECTION_STEPPED_INFERENCE)
+	/* Position of the inference in progress, NULL record when none is */
+	struct app_nn_packed_cursor step_cursor;
+#endif
+#if MODEL_USES_FREQDOMAIN_FEATURES
+	nrf_edgeai_features_pipeline_func_f32_t freqdomain_features[FREQDOMAIN_FEATURES_NUM];
+	nrf_edgeai_features_pipeline_ctx_t freqdomain_pipeline;
+	nrf_edgeai_features_freq_fft_ctx_t freqdomain_fft_ctx;
+#endif
+	nrf_user_output_t model_outputs[MODEL_OUTPUTS_NUM];
+	uint8_t input_window[MODEL_WINDOW_BUFFERS_NUM][MODEL_WINDOW_BUFFER_SIZE_BYTES]
+		__NRF_EDGEAI_ALIGNED;
+#if !defined(CONFIG_APP_DETECTION_SHARED_SCRATCH)
+	struct model_scratch scratch;
+#endif
+};
+
+#if defined(CONFIG_APP_DETECTION_SHARED_SCRATCH)
+BUILD_ASSERT(sizeof(struct model_scratch) <= CONFIG_APP_DETECTION_SCRATCH_SIZE,
+	     "Model buffers exceed CONFIG_APP_DETECTION_SCRATCH_SIZE");
+
+/* All instances and models borrow the scratch arena of the detection module */
+#define MODEL_SCRATCH(_p_instance) ((struct model_scratch *)detection_scratch)
+#define SCRATCH_RAM(_size)         0
+#else
+#define MODEL_SCRATCH(_p_instance) (&(_p_instance)->scratch)
+#define SCRATCH_RAM(_size)         (_size)
+#endif
+
+/* Instance of the input context the interfaces are called with */
+#define MODEL_INSTANCE_OF_INPUT(_p_input)                                                        \
+	((nrf_edgeai_user_model_instance_t *)((uint8_t *)(_p_input) -                              \
+					      offsetof(nrf_edgeai_user_model_instance_t,          \
+						       edgeai.input)))
+
+/* Instance returned by nrf_edgeai_user_model(), initialized on first use */
+static nrf_edgeai_user_model_instance_t model_default_instance;
+static bool model_default_instance_ready;
+
+#if defined(CONFIG_APP_DETECTION_WEIGHTS_IN_RAM) && !defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+/* Model parameters read by the inference, copied from the export by the first instance */
+static struct {
+	nrf_user_weight_t weights[sizeof(MODEL_WEIGHTS) / sizeof(nrf_user_weight_t)];
+	uint16_t links[sizeof(MODEL_NEURONS_LINKS) / sizeof(uint16_t)];
+	uint16_t internal_links_num[sizeof(MODEL_NEURON_INTERNAL_LINKS_NUM) / sizeof(uint16_t)];
+	uint16_t external_links_num[sizeof(MODEL_NEURON_EXTERNAL_LINKS_NUM) / sizeof(uint16_t)];
+	nrf_user_coeff_t act_weights[sizeof(MODEL_NEURON_ACTIVATION_WEIGHTS) /
+				     sizeof(nrf_user_coeff_t)];
+	uint8_t act_type_mask[sizeof(MODEL_NEURON_ACTIVATION_TYPE_MASK)];
+} model_params;
+static bool model_params_loaded;
+
+#define MODEL_PARAM(_ram, _export) (model_params._ram)
+#else
+#define MODEL_PARAM(_ram, _export) (_export)
+#endif
+
+/* Time-domain features */
+
+#if defined(CONFIG_APP_DETECTION_INCREMENTAL_FEATURES)
+/* Online state of the instance in the pipeline context, updated in O(shift) per inference */
+static size32_t online_timedomain_features(flt32_t *p_input, size32_t num, flt32_t *p_features,
+					   nrf_edgeai_features_mask_t feature_mask,
+					   void *p_pipeline_ctx,
+					   nrf_edgeai_feature_get_arg_cb_t get_argument,
+					   void *p_argument_ctx)
+{
+	return app_dsp_online_features_f32(p_pipeline_ctx, p_input, num,
+					   feature_mask.domain.time.all, p_features);
+}
+
+static const nrf_edgeai_features_pipeline_func_f32_t model_timedomain_features[] = {
+	online_timedomain_features,
+};
+#elif defined(CONFIG_APP_DETECTION_FUSED_FEATURES)
+/* All time-domain features of the mask in one pass over the window */
+static size32_t fused_timedomain_features(flt32_t *p_input, size32_t num, flt32_t *p_features,
+					  nrf_edgeai_features_mask_t feature_mask,
+					  void *p_pipeline_ctx,
+					  nrf_edgeai_feature_get_arg_cb_t get_argument,
+					  void *p_argument_ctx)
+{
+#if defined(CONFIG_APP_DETECTION_FEATURE_CACHE)
+	return app_dsp_features_cached_f32(&detection_feature_cache, p_input, num,
+					   feature_mask.domain.time.all, p_features);
+#elif defined(CONFIG_APP_DETECTION_SUBWINDOW_FEATURES)
+	const struct app_dsp_stats_acc *p_acc = p_pipeline_ctx;
+
+	/* Statistics accumulated while the window was fed, a window filled otherwise is read whole */
+	if (p_acc->num == num) {
+		return app_dsp_stats_features_f32(&p_acc->stats, p_input, num,
+						  feature_mask.domain.time.all, p_features);
+	}
+
+	return app_dsp_features_f32(p_input, num, feature_mask.domain.time.all, p_features);
+#else
+	return app_dsp_features_f32(p_input, num, feature_mask.domain.time.all, p_features);
+#endif
+}
+
+static const nrf_edgeai_features_pipeline_func_f32_t model_timedomain_features[] = {
+	fused_timedomain_features,
+};
+#else
+/* The feature functions of the export */
+#define model_timedomain_features timedomain_features_
+#endif
+
+#define TIMEDOMAIN_FEATURES_NUM                                                                   \
+	(sizeof(model_timedomain_features) / sizeof(model_timedomain_features[0]))
+
+#if defined(CONFIG_APP_PROFILING)
+BUILD_ASSERT(TIMEDOMAIN_FEATURES_NUM <= PROFILING_TIME_FEATURES_MAX,
+	     "Too many time-domain features to profile");
+
+/*
+ * Timing wrapper of the time-domain feature function at index i. The table
+ * of wrappers is sized for the largest pipeline, wrappers past
+ * TIMEDOMAIN_FEATURES_NUM are never called and clamp the index to stay in
+ * the bounds of the feature functions.
+ */
+#define PROFILED_TIMEDOMAIN_FEATURE(i)                                                            \
+	static size32_t profiled_timedomain_feature_##i(                                          \
+		flt32_t *p_input, size32_t num, flt32_t *p_features,                              \
+		nrf_edgeai_features_mask_t feature_mask, void *p_pipeline_ctx,                    \
+		nrf_edgeai_feature_get_arg_cb_t get_argument, void *p_argument_ctx)               \
+	{                                                                                         \
+		uint32_t start = profiling_cycles();                                              \
+		size32_t res = model_timedomain_features[MIN(i, TIMEDOMAIN_FEATURES_NUM - 1)](    \
+			p_input, num, p_features, feature_mask, p_pipeline_ctx, get_argument,     \
+			p_argument_ctx);                                                          \
+                                                                                                  \
+		profiling_record(PROFILING_STAGE_TIME_FEATURE_0 + i, profiling_cycles() - start); \
+		return res;                                                                       \
+	}
+
+PROFILED_TIMEDOMAIN_FEATURE(0)
+PROFILED_TIMEDOMAIN_FEATURE(1)
+PROFILED_TIMEDOMAIN_FEATURE(2)
+PROFILED_TIMEDOMAIN_FEATURE(3)
+PROFILED_TIMEDOMAIN_FEATURE(4)
+PROFILED_TIMEDOMAIN_FEATURE(5)
+PROFILED_TIMEDOMAIN_FEATURE(6)
+PROFILED_TIMEDOMAIN_FEATURE(7)
+PROFILED_TIMEDOMAIN_FEATURE(8)
+PROFILED_TIMEDOMAIN_FEATURE(9)
+PROFILED_TIMEDOMAIN_FEATURE(10)
+PROFILED_TIMEDOMAIN_FEATURE(11)
+
+static const nrf_edgeai_features_pipeline_func_f32_t
+	profiled_timedomain_features[PROFILING_TIME_FEATURES_MAX] = {
+		profiled_timedomain_feature_0,  profiled_timedomain_feature_1,
+		profiled_timedomain_feature_2,  profiled_timedomain_feature_3,
+		profiled_timedomain_feature_4,  profiled_timedomain_feature_5,
+		profiled_timedomain_feature_6,  profiled_timedomain_feature_7,
+		profiled_timedomain_feature_8,  profiled_timedomain_feature_9,
+		profiled_timedomain_feature_10, profiled_timedomain_feature_11,
+};
+#define P_MODEL_TIMEDOMAIN_FEATURES profiled_timedomain_features
+#else
+#define P_MODEL_TIMEDOMAIN_FEATURES model_timedomain_features
+#endif
+
+static const nrf_edgeai_features_pipeline_ctx_t model_timedomain_pipeline = {
+	.functions_num = TIMEDOMAIN_FEATURES_NUM,
+	.functions.p_void = P_MODEL_TIMEDOMAIN_FEATURES,
+	.p_ctx = P_TIMEDOMAIN_FEATURES_CTX,
+};
+
+/* Frequency-domain features */
+
+#if MODEL_USES_FREQDOMAIN_FEATURES
+#if defined(CONFIG_APP_DETECTION_IN_PLACE_FFT)
+/* No working buffer, the runtime computes the spectrum in the window memory */
+#define FREQDOMAIN_RFFT_BUFFER_SIZE_BYTES 0
+#else
+/* Real FFT working buffer of the instance, the window is copied in and transformed in place */
+#define FREQDOMAIN_RFFT_BUFFER_SIZE_BYTES SCRATCH_MEMBER_SIZE(freqdomain_rfft_buffer)
+#endif
+
+/* FFT context of an instance, which points it to its buffer */
+static const nrf_edgeai_features_freq_fft_ctx_t model_fft_ctx = {
+	.f32 = {
+		.p_rfft_buffer = NULL,
+		.p_rfft_twiddle_table = FREQDOMAIN_RFFT_TWIDDLE,
+		.p_cfft_twiddle_table = FREQDOMAIN_CFFT_TWIDDLE,
+		.p_cfft_bitrev_table = FREQDOMAIN_CFFT_BITREV,
+		.cfft_bitrev_table_len = FREQDOMAIN_CFFT_BITREV_LEN,
+		.rfft_len = FREQDOMAIN_RFFT_LEN,
+	},
+};
+
+#if defined(FREQDOMAIN_WINDOW_LEN)
+BUILD_ASSERT(FREQDOMAIN_WINDOW_LEN == INPUT_WINDOW_SIZE,
+	     "Window function does not match the input window, regenerate the FFT tables");
+
+/* Spectrum utility loading the FFT buffer with the window function applied in one pass */
+static size32_t freqdomain_rfft_feature(flt32_t *p_input, size32_t num, flt32_t *p_features,
+					nrf_edgeai_features_mask_t feature_mask,
+					void *p_pipeline_ctx,
+					nrf_edgeai_feature_get_arg_cb_t get_argument,
+					void *p_argument_ctx)
+{
+	nrf_edgeai_features_freq_fft_ctx_f32_t *p_fft_ctx =
+		&((nrf_edgeai_features_freq_fft_ctx_t *)p_pipeline_ctx)->f32;
+	nrf_dsp_rfft_f32_t rfft;
+
+#if defined(CONFIG_APP_DETECTION_IN_PLACE_FFT)
+	/*
+	 * The spectrum replaces the window of the input being processed, the spectral
+	 * features after this one read it there. Nothing resets the buffer, so it is
+	 * set on every call, not only while NULL, or later inputs would use the first.
+	 */
+	p_fft_ctx->p_rfft_buffer = p_input;
+#endif
+
+	app_dsp_window_load_f32(p_input, num, FREQDOMAIN_WINDOW, p_fft_ctx->rfft_len,
+				p_fft_ctx->p_rfft_buffer);
+
+	nrf_dsp_rfft_init_f32(&rfft, p_fft_ctx->rfft_len, p_fft_ctx->p_rfft_twiddle_table,
+			      p_fft_ctx->p_cfft_twiddle_table, p_fft_ctx->p_cfft_bitrev_table,
+			      p_fft_ctx->cfft_bitrev_table_len);
+	nrf_dsp_rfft_f32(&rfft, p_fft_ctx->p_rfft_buffer, p_fft_ctx->p_rfft_buffer);
+	nrf_dsp_cmplx_mag_f32(p_fft_ctx->p_rfft_buffer, p_fft_ctx->p_rfft_buffer,
+			      p_fft_ctx->rfft_len / 2);
+
+	return 0;
+}
+#else
+/* Spectrum utility zero padding the window to the FFT length, which the runtime does not do */
+static size32_t freqdomain_rfft_feature(flt32_t *p_input, size32_t num, flt32_t *p_features,
+					nrf_edgeai_features_mask_t feature_mask,
+					void *p_pipeline_ctx,
+					nrf_edgeai_feature_get_arg_cb_t get_argument,
+					void *p_argument_ctx)
+{
+	nrf_edgeai_features_freq_fft_ctx_t *p_fft_ctx = p_pipeline_ctx;
+	flt32_t *p_buffer = p_fft_ctx->f32.p_rfft_buffer ? p_fft_ctx->f32.p_rfft_buffer : p_input;
+
+	for (size32_t i = num; i < FREQDOMAIN_RFFT_LEN; i++) {
+		p_buffer[i] = 0.0f;
+	}
+
+	return FREQDOMAIN_RFFT_FEATURE(p_input, num, p_features, feature_mask, p_pipeline_ctx,
+				       get_argument, p_argument_ctx);
+}
+#endif
+
+#define FREQDOMAIN_BUFFERS_SIZE_BYTES                                                             \
+	(SCRATCH_RAM(FREQDOMAIN_RFFT_BUFFER_SIZE_BYTES) +                                         \
+	 sizeof(model_default_instance.freqdomain_features) +                                     \
+	 sizeof(model_default_instance.freqdomain_fft_ctx) +                                      \
+	 sizeof(model_default_instance.freqdomain_pipeline))
+#if defined(FREQDOMAIN_WINDOW_LEN)
+#define FREQDOMAIN_WINDOW_SIZE_BYTES sizeof(FREQDOMAIN_WINDOW)
+#else
+#define FREQDOMAIN_WINDOW_SIZE_BYTES 0
+#endif
+#define FREQDOMAIN_TABLES_SIZE_BYTES                                                              \
+	(sizeof(FREQDOMAIN_RFFT_TWIDDLE) + sizeof(FREQDOMAIN_CFFT_TWIDDLE) +                      \
+	 sizeof(FREQDOMAIN_CFFT_BITREV) + FREQDOMAIN_WINDOW_SIZE_BYTES)
+#else
+/* No frequency-domain features, so no FFT buffers */
+#define FREQDOMAIN_BUFFERS_SIZE_BYTES 0
+#define FREQDOMAIN_TABLES_SIZE_BYTES  0
+#endif
+
+/* DSP pipeline of an instance, which points it to its features buffer and pipeline contexts */
+static const nrf_edgeai_dsp_pipeline_t model_dsp_pipeline = {
+	.features = {
+		.p_masks = (nrf_edgeai_features_mask_t *)FEATURES_EXTRACTION_MASK,
+		.extracted_memory.p_void = NULL,
+		.overall_num = EXTRACTED_FEATURES_NUM,
+		.masks_num = sizeof(FEATURES_EXTRACTION_MASK) / sizeof(FEATURES_EXTRACTION_MASK[0]),
+		.p_timedomain_pipeline = &model_timedomain_pipeline,
+		.p_freqdomain_pipeline = NULL,
+		.meta.EXTRACTED_FEATURES_META_TYPE = {
+			.p_min = EXTRACTED_FEATURES_SCALE_MIN,
+			.p_max = EXTRACTED_FEATURES_SCALE_MAX,
+			.p_arguments = FEATURES_EXTRACTION_ARGUMENTS,
+		},
+	},
+};
+
+/* Specialized DSP pipeline */
+
+#if defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE)
+#if INPUT_SUBWINDOW_NUM != 0
+#error "Specialized DSP pipeline supports windows without subwindows only"
+#endif
+#if (INPUT_UNIQ_FEATURES_USED_NUM > 1) && (INPUT_UNIQ_FEATURES_USED_NUM != INPUT_UNIQ_FEATURES_NUM)
+#error "Specialized DSP pipeline supports several input features only if all are used"
+#endif
+#if INPUT_UNIQ_FEATURES_USED_NUM > APP_DSP_AXES_MAX
+#error "Specialized DSP pipeline supports up to APP_DSP_AXES_MAX input features"
+#endif
+#if MODEL_USES_FREQDOMAIN_FEATURES
+#error "Specialized DSP pipeline supports time-domain features only"
+#endif
+
+/* DSP pipeline of this model with the feature mask and scaling factors folded in */
+static nrf_edgeai_err_t specialized_process_features(nrf_edgeai_input_t *p_input,
+						     nrf_edgeai_dsp_pipeline_t *p_dsp)
+{
+	nrf_edgeai_user_model_instance_t *p_instance = MODEL_INSTANCE_OF_INPUT(p_input);
+	const flt32_t *p_window = p_input->window_memory.p_f32;
+	flt32_t *p_features = p_dsp->features.extracted_memory.p_f32;
+
+#if INPUT_UNIQ_FEATURES_USED_NUM == 1 && defined(CONFIG_APP_DETECTION_SUBWINDOW_FEATURES)
+	const struct app_dsp_stats_acc *p_acc = &p_instance->window_stats;
+
+	/* Statistics accumulated while the window was fed, a window filled otherwise is read whole */
+	if (p_acc->num == INPUT_WINDOW_SIZE) {
+		app_dsp_stats_features_inline_f32(&p_acc->stats, p_window, INPUT_WINDOW_SIZE,
+						  TIMEDOMAIN_FEATURES_MASK(0), p_features);
+	} else {
+		app_dsp_features_inline_f32(p_window, INPUT_WINDOW_SIZE,
+					    TIMEDOMAIN_FEATURES_MASK(0), p_features);
+	}
+#elif INPUT_UNIQ_FEATURES_USED_NUM == 1 && defined(APP_HOST_KERNELS)
+	/* Out of line, the host tools select the kernel at run time */
+	app_dsp_features_f32(p_window, INPUT_WINDOW_SIZE, TIMEDOMAIN_FEATURES_MASK(0), p_features);
+#elif INPUT_UNIQ_FEATURES_USED_NUM == 1
+	app_dsp_features_inline_f32(p_window, INPUT_WINDOW_SIZE, TIMEDOMAIN_FEATURES_MASK(0),
+				    p_features);
+#else
+	/* All axes in one pass over the window, which the runtime keeps one column per feature */
+	const struct app_dsp_axes axes =
+		APP_DSP_AXES_COLUMNS(INPUT_UNIQ_FEATURES_USED_NUM, INPUT_WINDOW_SIZE);
+	uint32_t masks[INPUT_UNIQ_FEATURES_USED_NUM];
+
+	for (uint16_t i = 0; i < INPUT_UNIQ_FEATURES_USED_NUM; i++) {
+		masks[i] = TIMEDOMAIN_FEATURES_MASK(i);
+	}
+
+	app_dsp_features_multi_f32(p_window, INPUT_WINDOW_SIZE, &axes, masks, p_features);
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_CALIBRATION)
+	/* Min-max scaling with clipping, corrected for the device once calibrated, in one pass */
+	app_dsp_scale_clip_f32(app_dsp_scale_cal_active(&p_instance->feature_cal), p_features,
+			       p_features);
+	app_dsp_scale_cal_update_f32(&p_instance->feature_cal, p_features);
+#else
+	/* Min-max scaling with clipping to the training range, in one pass */
+	app_dsp_scale_clip_f32(&p_instance->feature_scale, p_features, p_features);
+#endif
+
+	return NRF_EDGEAI_ERR_SUCCESS;
+}
+#endif
+
+/* Pipeline stages, the ones of the export replaced as configured */
+
+#undef NN_INPUT_SETUP_INTERFACE
+#undef NN_INPUT_FEED_INTERFACE
+#undef NN_PROCESS_FEATURES_INTERFACE
+#undef NN_RUN_INFERENCE_INTERFACE
+#undef NN_PROPAGATE_OUTPUTS_INTERFACE
+#undef NN_DECODE_OUTPUTS_INTERFACE
+
+#if defined(CONFIG_APP_DETECTION_SLIDING_WINDOW)
+#define NN_INPUT_SETUP_INTERFACE nrf_edgeai_input_setup_sliding_window
+#define NN_INPUT_FEED_INTERFACE  nrf_edgeai_input_feed_sliding_window_f32
+#else
+#define NN_INPUT_SETUP_INTERFACE nrf_edgeai_input_setup_discrete_window
+#define NN_INPUT_FEED_INTERFACE  nrf_edgeai_input_feed_discrete_window_f32
+#endif
+#if defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE)
+#define NN_PROCESS_FEATURES_INTERFACE specialized_process_features
+#else
+#define NN_PROCESS_FEATURES_INTERFACE nrf_edgeai_process_features_dsp_f32_f32
+#endif
+#if defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+#define NN_RUN_INFERENCE_INTERFACE run_packed_model_inference_f32
+#elif defined(CONFIG_APP_DETECTION_COMPILED_MODEL)
+#define NN_RUN_INFERENCE_INTERFACE run_compiled_model_inference_f32
+#else
+#define NN_RUN_INFERENCE_INTERFACE nrf_edgeai_run_model_inference_f32
+#endif
+#define NN_PROPAGATE_OUTPUTS_INTERFACE nrf_edgeai_output_propagate_f32
+#define NN_DECODE_OUTPUTS_INTERFACE    nrf_edgeai_output_decode_classification_f32
+
+#if defined(CONFIG_APP_DETECTION_MIRRORED_WINDOW)
+/* Sliding window setup of the ring, the window view starts at the ring start */
+static nrf_edgeai_err_t mirrored_input_setup(nrf_edgeai_input_t *p_input_ctx)
+{
+	nrf_edgeai_user_model_instance_t *p_instance = MODEL_INSTANCE_OF_INPUT(p_input_ctx);
+	nrf_edgeai_err_t res;
+
+	p_input_ctx->window_memory.p_void = p_instance->input_window[0];
+	res = NN_INPUT_SETUP_INTERFACE(p_input_ctx);
+
+	p_input_ctx->p_window_ctx->sliding.flatten.current_sample = 0;
+	p_instance->window_missing = INPUT_WINDOW_SIZE;
+
+	return res;
+}
+
+/*
+ * Sliding window feed into a ring holding every sample twice, at its position
+ * and one window size after it. The window is then the contiguous run from
+ * the oldest sample, so the full window is handed to inference by moving the
+ * window view instead of shifting the samples down by the window shift.
+ */
+static nrf_edgeai_err_t mirrored_feed_inputs(nrf_edgeai_input_t *p_input_ctx,
+					     void *p_input_values, uint16_t num_values)
+{
+	nrf_edgeai_user_model_instance_t *p_instance = MODEL_INSTANCE_OF_INPUT(p_input_ctx);
+	nrf_dsp_window_flatten_t *p_window = &p_input_ctx->p_window_ctx->sliding.flatten;
+	flt32_t *p_ring = p_window->p_window.f32;
+	const flt32_t *p_input = p_input_values;
+	uint16_t pos = p_window->current_sample;
+	uint16_t num = p_instance->window_missing;
+
+	if ((uintptr_t)p_input_values % sizeof(flt32_t)) {
+		return NRF_EDGEAI_ERR_WRONG_MEM_ALIGNMENT;
+	}
+
+	/* Samples beyond the end of the window are dropped */
+	if (num_values < num) {
+		num = num_values;
+	}
+
+	for (uint16_t i = 0; i < num; i++) {
+		p_ring[pos] = p_input[i];
+		p_ring[pos + INPUT_WINDOW_SIZE] = p_input[i];
+		pos = (pos + 1 < INPUT_WINDOW_SIZE) ? pos + 1 : 0;
+	}
+
+	p_window->current_sample = pos;
+	p_instance->window_missing -= num;
+	if (p_instance->window_missing > 0) {
+		return NRF_EDGEAI_ERR_INPROGRESS;
+	}
+
+	/* The oldest sample is the next one to be overwritten */
+	p_input_ctx->window_memory.p_f32 = &p_ring[pos];
+	p_instance->window_missing = MODEL_WINDOW_SHIFT;
+
+	return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+#undef NN_INPUT_SETUP_INTERFACE
+#define NN_INPUT_SETUP_INTERFACE mirrored_input_setup
+#undef NN_INPUT_FEED_INTERFACE
+#define NN_INPUT_FEED_INTERFACE mirrored_feed_inputs
+#endif
+
+#if defined(CONFIG_APP_DETECTION_GATHER_FEED) &&                                                  \
+	(INPUT_UNIQ_FEATURES_USED_NUM != INPUT_UNIQ_FEATURES_NUM)
+/* Discrete window setup that also turns the usage mask into the gather list */
+static nrf_edgeai_err_t gather_input_setup(nrf_edgeai_input_t *p_input_ctx)
+{
+	uint8_t *p_indices = MODEL_INSTANCE_OF_INPUT(p_input_ctx)->input_gather_indices;
+	nrf_edgeai_err_t res = NN_INPUT_SETUP_INTERFACE(p_input_ctx);
+	uint16_t used = 0;
+
+	for (uint16_t i = 0; i < INPUT_UNIQ_FEATURES_NUM && used < INPUT_UNIQ_FEATURES_USED_NUM;
+	     i++) {
+		if (p_input_ctx->p_usage_mask[i / 8] & (1U << (i % 8))) {
+			p_indices[used++] = (uint8_t)i;
+		}
+	}
+
+	p_input_ctx->p_window_ctx->discrete.uniq_features_collected = INPUT_UNIQ_FEATURES_USED_NUM;
+
+	return res;
+}
+
+/*
+ * Discrete window feed copying only the used features of each sample, from
+ * the gather list instead of testing the usage mask per value
+ */
+static nrf_edgeai_err_t gather_feed_inputs(nrf_edgeai_input_t *p_input_ctx, void *p_input_values,
+					   uint16_t num_values)
+{
+	const uint8_t *p_indices = MODEL_INSTANCE_OF_INPUT(p_input_ctx)->input_gather_indices;
+	nrf_dsp_window_flatten_t *p_window = &p_input_ctx->p_window_ctx->discrete;
+	const flt32_t *p_input = p_input_values;
+	uint16_t end = p_window->current_sample + num_values / INPUT_UNIQ_FEATURES_NUM;
+
+	if ((uintptr_t)p_input_values % sizeof(flt32_t)) {
+		return NRF_EDGEAI_ERR_WRONG_MEM_ALIGNMENT;
+	}
+
+	/* Samples beyond the end of the window are dropped */
+	if (end > INPUT_WINDOW_SIZE) {
+		end = INPUT_WINDOW_SIZE;
+	}
+
+	/* The window keeps one column per used feature */
+	for (uint16_t s = p_window->current_sample; s < end; s++) {
+		for (uint16_t f = 0; f < INPUT_UNIQ_FEATURES_USED_NUM; f++) {
+			p_window->p_window.f32[f * INPUT_WINDOW_SIZE + s] = p_input[p_indices[f]];
+		}
+		p_input += INPUT_UNIQ_FEATURES_NUM;
+	}
+
+	if (end < INPUT_WINDOW_SIZE) {
+		p_window->current_sample = end;
+		return NRF_EDGEAI_ERR_INPROGRESS;
+	}
+
+	p_window->current_sample = 0;
+	return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+#undef NN_INPUT_SETUP_INTERFACE
+#define NN_INPUT_SETUP_INTERFACE gather_input_setup
+#undef NN_INPUT_FEED_INTERFACE
+#define NN_INPUT_FEED_INTERFACE gather_feed_inputs
+#endif
+
+#if defined(CONFIG_APP_DETECTION_PING_PONG_WINDOW)
+/*
+ * Discrete window feed that hands the full window to inference and continues
+ * in the other buffer, so the next window is fed while the full one is read
+ */
+static nrf_edgeai_err_t pingpong_feed_inputs(nrf_edgeai_input_t *p_input_ctx,
+					     void *p_input_values, uint16_t num_values)
+{
+	uint8_t(*p_buffers)[MODEL_WINDOW_BUFFER_SIZE_BYTES] =
+		MODEL_INSTANCE_OF_INPUT(p_input_ctx)->input_window;
+	nrf_dsp_window_flatten_t *p_window = &p_input_ctx->p_window_ctx->discrete;
+	nrf_edgeai_err_t res = NN_INPUT_FEED_INTERFACE(p_input_ctx, p_input_values, num_values);
+
+	if (res == NRF_EDGEAI_ERR_SUCCESS) {
+		p_input_ctx->window_memory.p_void = p_window->p_window.generic;
+		p_window->p_window.generic = (p_window->p_window.generic == p_buffers[0])
+						     ? p_buffers[1]
+						     : p_buffers[0];
+	}
+
+	return res;
+}
+
+#undef NN_INPUT_FEED_INTERFACE
+#define NN_INPUT_FEED_INTERFACE pingpong_feed_inputs
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SUBWINDOW_FEATURES)
+#if INPUT_UNIQ_FEATURES_NUM != 1
+#error "Subwindow features support a single input feature only"
+#endif
+
+/*
+ * Discrete window feed that adds each run of samples to the statistics of the
+ * time-domain features, so the full window only derives the features from them
+ */
+static nrf_edgeai_err_t subwindow_feed_inputs(nrf_edgeai_input_t *p_input_ctx,
+					      void *p_input_values, uint16_t num_values)
+{
+	struct app_dsp_stats_acc *p_acc = &MODEL_INSTANCE_OF_INPUT(p_input_ctx)->window_stats;
+	const nrf_dsp_window_flatten_t *p_window = &p_input_ctx->p_window_ctx->discrete;
+	uint16_t room = p_window->max_samples_num - p_window->current_sample;
+
+	/* An empty window starts over, also when it was emptied without a feed */
+	if (p_window->current_sample == 0) {
+		app_dsp_stats_acc_reset(p_acc);
+	}
+
+	/* Samples beyond the end of the window are dropped by the feed */
+	app_dsp_stats_acc_add_f32(p_acc, p_input_values, (num_values < room) ? num_values : room,
+				  TIMEDOMAIN_FEATURES_MASK(0));
+
+	return NN_INPUT_FEED_INTERFACE(p_input_ctx, p_input_values, num_values);
+}
+
+#undef NN_INPUT_FEED_INTERFACE
+#define NN_INPUT_FEED_INTERFACE subwindow_feed_inputs
+#endif
+
+#if defined(CONFIG_APP_DETECTION_PACKED_MODEL_Q8)
+#define PACKED_RUN            app_nn_packed_run_q8_f32
+#define PACKED_RUN_EARLY_EXIT app_nn_packed_run_early_exit_q8_f32
+#define PACKED_RUN_STEP       app_nn_packed_run_step_q8_f32
+#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_UNIT)
+#define PACKED_RUN            app_nn_packed_run_unit_f32
+#define PACKED_RUN_EARLY_EXIT app_nn_packed_run_early_exit_unit_f32
+#define PACKED_RUN_STEP       app_nn_packed_run_step_unit_f32
+#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_BF16)
+#define PACKED_RUN            app_nn_packed_run_bf16_f32
+#define PACKED_RUN_EARLY_EXIT app_nn_packed_run_early_exit_bf16_f32
+#define PACKED_RUN_STEP       app_nn_packed_run_step_bf16_f32
+#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_F16)
+#define PACKED_RUN            app_nn_packed_run_f16_f32
+#define PACKED_RUN_EARLY_EXIT app_nn_packed_run_early_exit_f16_f32
+#define PACKED_RUN_STEP       app_nn_packed_run_step_f16_f32
+#else
+#define PACKED_RUN            app_nn_packed_run_f32
+#define PACKED_RUN_EARLY_EXIT app_nn_packed_run_early_exit_f32
+#define PACKED_RUN_STEP       app_nn_packed_run_step_f32
+#endif
+
+#if defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+/* Run the model from packed neuron records instead of the separate arrays */
+static void run_packed_model_inference_f32(nrf_edgeai_t *p_edgeai)
+{
+	flt32_t *p_neurons = p_edgeai->model.params.f32.p_neurons;
+#if MODEL_USES_AS_INPUT_INPUT_FEATURES
+	const flt32_t *p_inputs = p_edgeai->input.window_memory.p_f32;
+	uint16_t inputs_num = INPUT_UNIQ_FEATURES_USED_NUM * INPUT_WINDOW_SIZE;
+#else
+	const flt32_t *p_inputs = p_edgeai->p_dsp->features.extracted_memory.p_f32;
+	uint16_t inputs_num = p_edgeai->p_dsp->features.overall_num;
+#endif
+
+#if defined(CONFIG_APP_DETECTION_EARLY_EXIT)
+	(void)PACKED_RUN_EARLY_EXIT(MODEL_PACKED, p_neurons, MODEL_PACKED_RECORDS_NUM, p_inputs,
+				    inputs_num, MODEL_PACKED_OUTPUTS, MODEL_OUTPUTS_NUM,
+				    CONFIG_APP_DETECTION_EARLY_EXIT_MARGIN_PCT / 100.0f);
+#else
+	PACKED_RUN(MODEL_PACKED, p_neurons, MODEL_PACKED_RECORDS_NUM, p_inputs, inputs_num);
+#endif
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_COMPILED_MODEL)
+/* Run the network compiled to straight-line code, see scripts/neuton_compile.py */
+static void run_compiled_model_inference_f32(nrf_edgeai_t *p_edgeai)
+{
+#if MODEL_USES_AS_INPUT_INPUT_FEATURES
+	const flt32_t *p_inputs = p_edgeai->input.window_memory.p_f32;
+#else
+	const flt32_t *p_inputs = p_edgeai->p_dsp->features.extracted_memory.p_f32;
+#endif
+
+	model_compiled_run_f32_(p_inputs, p_edgeai->model.params.f32.p_neurons);
+}
+#endif
+
+#if defined(CONFIG_APP_DETECTION_LAZY_DECODE)
+/*
+ * Classification decode that takes the top class on the raw outputs and leaves
+ * the probabilities to nrf_edgeai_user_model_probabilities(). Dividing by the
+ * positive sum keeps the order of the outputs, so the class is the one of
+ * nrf_edgeai_output_decode_classification_f32().
+ */
+static void lazy_decode_classification_f32(nrf_edgeai_model_output_t *p_model_output,
+					   nrf_edgeai_decoded_output_t *p_decoded_output)
+{
+	const flt32_t *p_outputs = p_model_output->memory.p_f32;
+	uint16_t predicted_class = 0;
+	flt32_t sum = 0.0f;
+	flt32_t max = 0.0f;
+
+	for (uint16_t i = 0; i < p_model_output->num; i++) {
+		sum += p_outputs[i];
+	}
+
+	/* Vanishing outputs decode to all zero probabilities, class 0 */
+	if (sum > FLT_EPSILON) {
+		for (uint16_t i = 0; i < p_model_output->num; i++) {
+			if (p_outputs[i] > max) {
+				max = p_outputs[i];
+				predicted_class = i;
+			}
+		}
+	}
+
+	p_decoded_output->classif.predicted_class = predicted_class;
+	p_decoded_output->classif.num_classes = p_model_output->num;
+	p_decoded_output->classif.probabilities.p_f32 = NULL;
+}
+
+#undef NN_DECODE_OUTPUTS_INTERFACE
+#define NN_DECODE_OUTPUTS_INTERFACE lazy_decode_classification_f32
+#endif
+
+#if defined(CONFIG_APP_DETECTION_BATCH_INFERENCE)
+#if MODEL_USES_AS_INPUT_INPUT_FEATURES
+#define MODEL_INPUTS_NUM (INPUT_UNIQ_FEATURES_USED_NUM * INPUT_WINDOW_SIZE)
+#else
+#define MODEL_INPUTS_NUM EXTRACTED_FEATURES_NUM
+#endif
+
+BUILD_ASSERT(CONFIG_APP_DETECTION_BATCH_SIZE <= APP_NN_BATCH_MAX,
+	     "CONFIG_APP_DETECTION_BATCH_SIZE exceeds the batch of the packed model kernel");
+
+/* Activation slots for one batch, slot-major */
+static nrf_user_neuron_t
+	model_batch_neurons[MODEL_NEURONS_BUFFER_NUM * CONFIG_APP_DETECTION_BATCH_SIZE];
+
+void nrf_edgeai_user_model_run_batch(const flt32_t *p_inputs, uint16_t num, flt32_t *p_outputs)
+{
+	while (num > 0) {
+		uint16_t batch = (num < CONFIG_APP_DETECTION_BATCH_SIZE)
+					 ? num
+					 : CONFIG_APP_DETECTION_BATCH_SIZE;
+
+		/* Chunks never exceed APP_NN_BATCH_MAX, see the BUILD_ASSERT above */
+		(void)app_nn_packed_run_batch_f32(MODEL_PACKED, model_batch_neurons,
+						  MODEL_PACKED_RECORDS_NUM, p_inputs,
+						  MODEL_INPUTS_NUM, batch);
+
+		for (uint16_t k = 0; k < batch; k++) {
+			for (uint16_t i = 0; i < MODEL_OUTPUTS_NUM; i++) {
+				*p_outputs++ =
+					model_batch_neurons[MODEL_PACKED_OUTPUT_SLOTS[i] * batch + k];
+			}
+		}
+
+		p_inputs += batch * MODEL_INPUTS_NUM;
+		num -= batch;
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_PROFILING)
+/* Timing wrappers of the pipeline stages, they replace the interfaces selected above */
+static nrf_edgeai_err_t profiled_feed_inputs(nrf_edgeai_input_t *p_input_ctx,
+					     void *p_input_values, uint16_t num_values)
+{
+	uint32_t start = profiling_cycles();
+	nrf_edgeai_err_t res = NN_INPUT_FEED_INTERFACE(p_input_ctx, p_input_values, num_values);
+
+	profiling_record(PROFILING_STAGE_FEED_INPUTS, profiling_cycles() - start);
+	return res;
+}
+
+static nrf_edgeai_err_t profiled_process_features(nrf_edgeai_input_t *p_input,
+						  nrf_edgeai_dsp_pipeline_t *p_dsp)
+{
+	uint32_t start = profiling_cycles();
+	nrf_edgeai_err_t res = NN_PROCESS_FEATURES_INTERFACE(p_input, p_dsp);
+
+	profiling_record(PROFILING_STAGE_PROCESS_FEATURES, profiling_cycles() - start);
+	return res;
+}
+
+static void profiled_run_inference(nrf_edgeai_t *p_edgeai)
+{
+	uint32_t start = profiling_cycles();
+
+	NN_RUN_INFERENCE_INTERFACE(p_edgeai);
+	profiling_record(PROFILING_STAGE_RUN_INFERENCE, profiling_cycles() - start);
+}
+
+static void profiled_propagate_outputs(nrf_edgeai_model_t *p_model)
+{
+	uint32_t start = profiling_cycles();
+
+	NN_PROPAGATE_OUTPUTS_INTERFACE(p_model);
+	profiling_record(PROFILING_STAGE_PROPAGATE_OUTPUTS, profiling_cycles() - start);
+}
+
+static void profiled_decode_outputs(nrf_edgeai_model_output_t *p_model_output,
+				    nrf_edgeai_decoded_output_t *p_decoded_output)
+{
+	uint32_t start = profiling_cycles();
+
+	NN_DECODE_OUTPUTS_INTERFACE(p_model_output, p_decoded_output);
+	profiling_record(PROFILING_STAGE_DECODE_OUTPUTS, profiling_cycles() - start);
+}
+
+#undef NN_INPUT_FEED_INTERFACE
+#undef NN_PROCESS_FEATURES_INTERFACE
+#undef NN_RUN_INFERENCE_INTERFACE
+#undef NN_PROPAGATE_OUTPUTS_INTERFACE
+#undef NN_DECODE_OUTPUTS_INTERFACE
+#define NN_INPUT_FEED_INTERFACE        profiled_feed_inputs
+#define NN_PROCESS_FEATURES_INTERFACE  profiled_process_features
+#define NN_RUN_INFERENCE_INTERFACE     profiled_run_inference
+#define NN_PROPAGATE_OUTPUTS_INTERFACE profiled_propagate_outputs
+#define NN_DECODE_OUTPUTS_INTERFACE    profiled_decode_outputs
+#endif
+
+#if defined(CONFIG_APP_PROFILING_MARKERS)
+/* GPIO marker wrappers, outside the timing wrappers so the edges do not add to the cycles */
+static nrf_edgeai_err_t marked_process_features(nrf_edgeai_input_t *p_input,
+						nrf_edgeai_dsp_pipeline_t *p_dsp)
+{
+	nrf_edgeai_err_t res;
+
+	profiling_marker_begin(PROFILING_MARKER_FEATURES);
+	res = NN_PROCESS_FEATURES_INTERFACE(p_input, p_dsp);
+	profiling_marker_end(PROFILING_MARKER_FEATURES);
+	return res;
+}
+
+static void marked_run_inference(nrf_edgeai_t *p_edgeai)
+{
+	profiling_marker_begin(PROFILING_MARKER_INFERENCE);
+	NN_RUN_INFERENCE_INTERFACE(p_edgeai);
+	profiling_marker_end(PROFILING_MARKER_INFERENCE);
+}
+
+#undef NN_PROCESS_FEATURES_INTERFACE
+#undef NN_RUN_INFERENCE_INTERFACE
+#define NN_PROCESS_FEATURES_INTERFACE marked_process_features
+#define NN_RUN_INFERENCE_INTERFACE    marked_run_inference
+#endif
+
+/* Runtime context of an instance, which points it to its buffers */
+static const nrf_edgeai_t model_edgeai = {
+	.metadata.p_solution_id = EDGEAI_LAB_SOLUTION_ID_STR,
+	.metadata.version.combined = EDGEAI_RUNTIME_VERSION_COMBINED,
+
+	.input.p_used_for_lags_mask = INPUT_FEATURES_USED_FOR_LAGS_MASK,
+	.input.p_usage_mask = INPUT_FEATURES_USAGE_MASK,
+	.input.type = INPUT_FEATURE_DATA_TYPE,
+	.input.unique_num = INPUT_UNIQ_FEATURES_NUM,
+	.input.unique_num_used = INPUT_UNIQ_FEATURES_USED_NUM,
+	.input.unique_scales_num = INPUT_UNIQUE_SCALES_NUM,
+	.input.window_size = INPUT_WINDOW_SIZE,
+	.input.window_shift = MODEL_WINDOW_SHIFT,
+	.input.subwindow_num = INPUT_SUBWINDOW_NUM,
+	.input.window_memory.p_void = NULL,
+	.input.p_window_ctx = NULL,
+	.input.scale.INPUT_TYPE = {
+		.p_min = INPUT_FEATURES_SCALE_MIN,
+		.p_max = INPUT_FEATURES_SCALE_MAX,
+	},
+
+	.p_dsp = NULL,
+
+	.model.meta.p_neuron_internal_links_num =
+		MODEL_PARAM(internal_links_num, MODEL_NEURON_INTERNAL_LINKS_NUM),
+	.model.meta.p_neuron_external_links_num =
+		MODEL_PARAM(external_links_num, MODEL_NEURON_EXTERNAL_LINKS_NUM),
+	.model.meta.p_output_neurons_indices = P_MODEL_OUTPUT_NEURONS_INDICES,
+	.model.meta.p_neuron_links = MODEL_PARAM(links, MODEL_NEURONS_LINKS),
+	.model.meta.p_neuron_act_type_mask =
+		MODEL_PARAM(act_type_mask, MODEL_NEURON_ACTIVATION_TYPE_MASK),
+	.model.meta.outputs_num = MODEL_OUTPUTS_NUM,
+	.model.meta.neurons_num = MODEL_NEURONS_NUM,
+	.model.meta.weights_num = MODEL_WEIGHTS_NUM,
+	.model.meta.task = MODEL_TASK,
+	.model.meta.uses_as_input.all = MODEL_USES_AS_INPUT_MASK,
+	.model.params.MODEL_PARAMS_TYPE = {
+		.p_weights = MODEL_PARAM(weights, MODEL_WEIGHTS),
+		.p_act_weights = MODEL_PARAM(act_weights, MODEL_NEURON_ACTIVATION_WEIGHTS),
+		.p_neurons = NULL,
+	},
+	.model.output.memory.p_void = NULL,
+	.model.output.num = MODEL_OUTPUTS_NUM,
+
+	.interfaces.input_setup = NN_INPUT_SETUP_INTERFACE,
+	.interfaces.feed_inputs = NN_INPUT_FEED_INTERFACE,
+	.interfaces.process_features = NN_PROCESS_FEATURES_INTERFACE,
+	.interfaces.run_inference = NN_RUN_INFERENCE_INTERFACE,
+	.interfaces.propagate_outputs = NN_PROPAGATE_OUTPUTS_INTERFACE,
+	.interfaces.decode_outputs = NN_DECODE_OUTPUTS_INTERFACE,
+
+	.decoded_output = {NN_DECODED_OUTPUT_INIT},
+};
+
+uint32_t nrf_edgeai_user_model_instance_size(void)
+{
+	return sizeof(nrf_edgeai_user_model_instance_t);
+}
+
+nrf_edgeai_t *nrf_edgeai_user_model_instance_init(nrf_edgeai_user_model_instance_t *p_instance)
+{
+	nrf_edgeai_t *p_edgeai = &p_instance->edgeai;
+	nrf_edgeai_dsp_pipeline_t *p_dsp = &p_instance->dsp_pipeline;
+	struct model_scratch *p_scratch = MODEL_SCRATCH(p_instance);
+
+#if defined(CONFIG_APP_DETECTION_WEIGHTS_IN_RAM) && !defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+	if (!model_params_loaded) {
+		memcpy(model_params.weights, MODEL_WEIGHTS, sizeof(MODEL_WEIGHTS));
+		memcpy(model_params.links, MODEL_NEURONS_LINKS, sizeof(MODEL_NEURONS_LINKS));
+		memcpy(model_params.internal_links_num, MODEL_NEURON_INTERNAL_LINKS_NUM,
+		       sizeof(MODEL_NEURON_INTERNAL_LINKS_NUM));
+		memcpy(model_params.external_links_num, MODEL_NEURON_EXTERNAL_LINKS_NUM,
+		       sizeof(MODEL_NEURON_EXTERNAL_LINKS_NUM));
+		memcpy(model_params.act_weights, MODEL_NEURON_ACTIVATION_WEIGHTS,
+		       sizeof(MODEL_NEURON_ACTIVATION_WEIGHTS));
+		memcpy(model_params.act_type_mask, MODEL_NEURON_ACTIVATION_TYPE_MASK,
+		       sizeof(MODEL_NEURON_ACTIVATION_TYPE_MASK));
+		model_params_loaded = true;
+	}
+#endif
+
+	/* The contexts have const members, so they are copied from the templates */
+	memset(p_instance, 0, sizeof(*p_instance));
+	memcpy(p_edgeai, &model_edgeai, sizeof(model_edgeai));
+	memcpy(p_dsp, &model_dsp_pipeline, sizeof(model_dsp_pipeline));
+
+	p_edgeai->input.window_memory.p_void = &p_instance->input_window[0][0];
+	p_edgeai->input.p_window_ctx = &p_instance->input_window_ctx;
+	p_edgeai->p_dsp = p_dsp;
+	p_edgeai->model.params.MODEL_PARAMS_TYPE.p_neurons = p_scratch->model_neurons;
+	p_edgeai->model.output.memory.p_void = p_instance->model_outputs;
+	p_dsp->features.extracted_memory.p_void = p_scratch->extracted_features_buffer;
+
+#if defined(CONFIG_APP_DETECTION_INCREMENTAL_FEATURES)
+	p_instance->online_features = (struct app_dsp_online){
+		.size = INPUT_WINDOW_SIZE,
+		.shift = MODEL_WINDOW_SHIFT,
+		.p_leaving = p_instance->online_features_leaving,
+		.min.p_entries = p_instance->online_features_min_entries,
+		.max.p_entries = p_instance->online_features_max_entries,
+	};
+	memcpy(&p_instance->timedomain_pipeline, &model_timedomain_pipeline,
+	       sizeof(model_timedomain_pipeline));
+	p_instance->timedomain_pipeline.p_ctx = &p_instance->online_features;
+	p_dsp->features.p_timedomain_pipeline = &p_instance->timedomain_pipeline;
+#elif defined(CONFIG_APP_DETECTION_SUBWINDOW_FEATURES)
+	memcpy(&p_instance->timedomain_pipeline, &model_timedomain_pipeline,
+	       sizeof(model_timedomain_pipeline));
+	p_instance->timedomain_pipeline.p_ctx = &p_instance->window_stats;
+	p_dsp->features.p_timedomain_pipeline = &p_instance->timedomain_pipeline;
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE)
+	app_dsp_scale_init_f32(&p_instance->feature_scale, EXTRACTED_FEATURES_SCALE_MIN,
+			       EXTRACTED_FEATURES_SCALE_MAX, EXTRACTED_FEATURES_NUM,
+			       p_instance->feature_scale_recip);
+#endif
+
+#if defined(CONFIG_APP_DETECTION_FEATURE_CALIBRATION)
+	/* Calibrated against the reference scaling of the instance */
+	app_dsp_scale_cal_init(&p_instance->feature_cal, &p_instance->feature_scale,
+			       EXTRACTED_FEATURES_CAL_MEAN, EXTRACTED_FEATURES_CAL_STD,
+			       EXTRACTED_FEATURES_NUM,
+			       CONFIG_APP_DETECTION_FEATURE_CALIBRATION_WINDOWS,
+			       p_instance->feature_cal_stats, p_instance->feature_cal_min,
+			       p_instance->feature_cal_recip);
+#endif
+
+#if MODEL_USES_FREQDOMAIN_FEATURES
+	/* The functions of the export, with the spectrum utility replaced */
+	memcpy(p_instance->freqdomain_features, freqdomain_features_,
+	       sizeof(p_instance->freqdomain_features));
+	p_instance->freqdomain_features[0] = freqdomain_rfft_feature;
+	memcpy(&p_instance->freqdomain_fft_ctx, &model_fft_ctx, sizeof(model_fft_ctx));
+#if !defined(CONFIG_APP_DETECTION_IN_PLACE_FFT)
+	p_instance->freqdomain_fft_ctx.f32.p_rfft_buffer = p_scratch->freqdomain_rfft_buffer;
+#endif
+	p_instance->freqdomain_pipeline = (nrf_edgeai_features_pipeline_ctx_t){
+		.functions_num = FREQDOMAIN_FEATURES_NUM,
+		.functions.p_void = p_instance->freqdomain_features,
+		.p_ctx = &p_instance->freqdomain_fft_ctx,
+	};
+	p_dsp->features.p_freqdomain_pipeline = &p_instance->freqdomain_pipeline;
+#endif
+
+	return p_edgeai;
+}
+
+nrf_edgeai_t *nrf_edgeai_user_model(void)
+{
+	if (!model_default_instance_ready) {
+		(void)nrf_edgeai_user_model_instance_init(&model_default_instance);
+		model_default_instance_ready = true;
+	}
+
+	return &model_default_instance.edgeai;
+}
+
+nrf_edgeai_err_t nrf_edgeai_user_model_feed_inputs(nrf_edgeai_t *p_edgeai,
+						   const void *p_input_values,
+						   uint16_t num_values)
+{
+	/* The runtime entry point is not const-qualified, its feed stages only read the values */
+	return nrf_edgeai_feed_inputs(p_edgeai, (void *)p_input_values, num_values);
+}
+
+nrf_edgeai_err_t nrf_edgeai_user_model_instance_run_inference(nrf_edgeai_t *p_edgeai)
+{
+	nrf_edgeai_err_t res = NN_PROCESS_FEATURES_INTERFACE(&p_edgeai->input, p_edgeai->p_dsp);
+
+	if (res != NRF_EDGEAI_ERR_SUCCESS) {
+		return res;
+	}
+
+	NN_RUN_INFERENCE_INTERFACE(p_edgeai);
+	NN_PROPAGATE_OUTPUTS_INTERFACE(&p_edgeai->model);
+	NN_DECODE_OUTPUTS_INTERFACE(&p_edgeai->model.output, &p_edgeai->decoded_output);
+
+	return res;
+}
+
+#if defined(CONFIG_APP_DETECTION_STEPPED_INFERENCE)
+nrf_edgeai_err_t nrf_edgeai_user_model_instance_run_inference_step(nrf_edgeai_t *p_edgeai,
+								   uint16_t budget_neurons)
+{
+	struct app_nn_packed_cursor *p_cursor =
+		&MODEL_INSTANCE_OF_INPUT(&p_edgeai->input)->step_cursor;
+#if MODEL_USES_AS_INPUT_INPUT_FEATURES
+	const flt32_t *p_inputs = p_edgeai->input.window_memory.p_f32;
+	uint16_t inputs_num = INPUT_UNIQ_FEATURES_USED_NUM * INPUT_WINDOW_SIZE;
+#else
+	const flt32_t *p_inputs = p_edgeai->p_dsp->features.extracted_memory.p_f32;
+	uint16_t inputs_num = p_edgeai->p_dsp->features.overall_num;
+#endif
+
+	if (p_cursor->p == NULL) {
+		nrf_edgeai_err_t res =
+			NN_PROCESS_FEATURES_INTERFACE(&p_edgeai->input, p_edgeai->p_dsp);
+
+		if (res != NRF_EDGEAI_ERR_SUCCESS) {
+			return res;
+		}
+
+		/* Feature extraction is a step of its own, the neurons start with the next call */
+		p_cursor->p = MODEL_PACKED;
+		p_cursor->n = 0;
+
+		return NRF_EDGEAI_ERR_INPROGRESS;
+	}
+
+	if (!PACKED_RUN_STEP(p_cursor, p_edgeai->model.params.f32.p_neurons,
+			     MODEL_PACKED_RECORDS_NUM, p_inputs, inputs_num, budget_neurons)) {
+		return NRF_EDGEAI_ERR_INPROGRESS;
+	}
+
+	p_cursor->p = NULL;
+
+	NN_PROPAGATE_OUTPUTS_INTERFACE(&p_edgeai->model);
+	NN_DECODE_OUTPUTS_INTERFACE(&p_edgeai->model.output, &p_edgeai->decoded_output);
+
+	return NRF_EDGEAI_ERR_SUCCESS;
+}
+#endif
+
+nrf_edgeai_err_t nrf_edgeai_user_model_run_inference(void)
+{
+	return nrf_edgeai_user_model_instance_run_inference(nrf_edgeai_user_model());
+}
+
+const flt32_t *nrf_edgeai_user_model_probabilities(nrf_edgeai_t *p_edgeai)
+{
+#if defined(CONFIG_APP_DETECTION_LAZY_DECODE)
+	nrf_edgeai_model_output_t *p_output = &p_edgeai->model.output;
+	flt32_t *p_outputs = p_output->memory.p_f32;
+	flt32_t sum = 0.0f;
+
+	if (p_edgeai->decoded_output.classif.probabilities.p_f32 != NULL) {
+		return p_edgeai->decoded_output.classif.probabilities.p_f32;
+	}
+
+	/* Same normalization as nrf_edgeai_output_decode_classification_f32() */
+	for (uint16_t i = 0; i < p_output->num; i++) {
+		sum += p_outputs[i];
+	}
+
+	if (sum > FLT_EPSILON) {
+		for (uint16_t i = 0; i < p_output->num; i++) {
+			p_outputs[i] /= sum;
+		}
+	} else {
+		memset(p_outputs, 0, p_output->num * sizeof(flt32_t));
+	}
+
+	p_edgeai->decoded_output.classif.probabilities.p_f32 = p_outputs;
+#endif
+
+	return p_edgeai->decoded_output.classif.probabilities.p_f32;
+}
+
+/* Footprint */
+
+#if MODEL_TASK == __NRF_EDGEAI_TASK_ANOMALY_DETECTION
+#define MODEL_TASK_META_SIZE_BYTES                                                                \
+	(sizeof(MODEL_AVERAGE_EMBEDDING) + sizeof(MODEL_OUTPUT_SCALE_MIN) +                       \
+	 sizeof(MODEL_OUTPUT_SCALE_MAX))
+#elif MODEL_TASK == __NRF_EDGEAI_TASK_REGRESSION
+#define MODEL_TASK_META_SIZE_BYTES (sizeof(MODEL_OUTPUT_SCALE_MIN) + sizeof(MODEL_OUTPUT_SCALE_MAX))
+#else
+#define MODEL_TASK_META_SIZE_BYTES 0
+#endif
+
+/* Model weights, links and output metadata in bytes, as nrf_edgeai_user_model_size() */
+#define MODEL_META_SIZE_BYTES                                                                     \
+	(sizeof(MODEL_WEIGHTS) + sizeof(MODEL_NEURONS_LINKS) +                                    \
+	 sizeof(MODEL_NEURON_EXTERNAL_LINKS_NUM) + sizeof(MODEL_NEURON_INTERNAL_LINKS_NUM) +      \
+	 sizeof(MODEL_NEURON_ACTIVATION_WEIGHTS) + sizeof(MODEL_NEURON_ACTIVATION_TYPE_MASK) +    \
+	 sizeof(MODEL_OUTPUT_NEURONS_INDICES) + MODEL_TASK_META_SIZE_BYTES)
+
+#if defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+#define MODEL_PACKED_SIZE_BYTES                                                                   \
+	(sizeof(MODEL_PACKED) + sizeof(MODEL_PACKED_OUTPUT_SLOTS) + sizeof(MODEL_PACKED_OUTPUTS))
+#else
+#define MODEL_PACKED_SIZE_BYTES 0
+#endif
+
+/* Input and feature scaling factors and the feature extraction mask in bytes */
+#define MODEL_SCALES_SIZE_BYTES                                                                   \
+	(sizeof(INPUT_FEATURES_SCALE_MIN) + sizeof(INPUT_FEATURES_SCALE_MAX) +                    \
+	 sizeof(EXTRACTED_FEATURES_SCALE_MIN) + sizeof(EXTRACTED_FEATURES_SCALE_MAX) +            \
+	 sizeof(FEATURES_EXTRACTION_MASK))
+
+/* Buffers and contexts of one instance, the ones of the default instance are counted */
+#define INPUT_WINDOW_RAM_SIZE_BYTES                                                               \
+	(sizeof(model_default_instance.input_window) +                                            \
+	 sizeof(model_default_instance.input_window_ctx))
+
+#if defined(CONFIG_APP_DETECTION_INCREMENTAL_FEATURES)
+#define ONLINE_FEATURES_SIZE_BYTES                                                                \
+	(sizeof(model_default_instance.timedomain_pipeline) +                                     \
+	 sizeof(model_default_instance.online_features) +                                         \
+	 sizeof(model_default_instance.online_features_leaving) +                                 \
+	 sizeof(model_default_instance.online_features_min_entries) +                             \
+	 sizeof(model_default_instance.online_features_max_entries))
+#elif defined(CONFIG_APP_DETECTION_SUBWINDOW_FEATURES)
+#define ONLINE_FEATURES_SIZE_BYTES                                                                \
+	(sizeof(model_default_instance.timedomain_pipeline) +                                     \
+	 sizeof(model_default_instance.window_stats))
+#else
+#define ONLINE_FEATURES_SIZE_BYTES 0
+#endif
+
+#if defined(CONFIG_APP_DETECTION_SPECIALIZED_PIPELINE)
+#define FEATURE_SCALE_SIZE_BYTES                                                                  \
+	(sizeof(model_default_instance.feature_scale) +                                           \
+	 sizeof(model_default_instance.feature_scale_recip))
+#else
+#define FEATURE_SCALE_SIZE_BYTES 0
+#endif
+
+#define FEATURES_RAM_SIZE_BYTES                                                                   \
+	(SCRATCH_RAM(SCRATCH_MEMBER_SIZE(extracted_features_buffer)) +                            \
+	 sizeof(model_default_instance.dsp_pipeline) + ONLINE_FEATURES_SIZE_BYTES +               \
+	 FEATURE_SCALE_SIZE_BYTES)
+
+#if defined(CONFIG_APP_DETECTION_BATCH_INFERENCE)
+#define NEURONS_RAM_SIZE_BYTES                                                                    \
+	(SCRATCH_RAM(SCRATCH_MEMBER_SIZE(model_neurons)) + sizeof(model_batch_neurons))
+#else
+#define NEURONS_RAM_SIZE_BYTES SCRATCH_RAM(SCRATCH_MEMBER_SIZE(model_neurons))
+#endif
+
+/* Model parameters in RAM, the packed records are copied at boot and their image stays in flash */
+#if defined(CONFIG_APP_DETECTION_WEIGHTS_IN_RAM) && defined(CONFIG_APP_DETECTION_PACKED_MODEL)
+#define MODEL_PARAMS_RAM_SIZE_BYTES sizeof(MODEL_PACKED)
+#elif defined(CONFIG_APP_DETECTION_WEIGHTS_IN_RAM)
+#define MODEL_PARAMS_RAM_SIZE_BYTES sizeof(model_params)
+#else
+#define MODEL_PARAMS_RAM_SIZE_BYTES 0
+#endif
+
+#define MODEL_FLASH_SIZE_BYTES                                                                    \
+	(MODEL_META_SIZE_BYTES + MODEL_PACKED_SIZE_BYTES + MODEL_SCALES_SIZE_BYTES +              \
+	 FREQDOMAIN_TABLES_SIZE_BYTES)
+
+#define MODEL_RAM_SIZE_BYTES                                                                      \
+	(INPUT_WINDOW_RAM_SIZE_BYTES + FEATURES_RAM_SIZE_BYTES + FREQDOMAIN_BUFFERS_SIZE_BYTES +  \
+	 NEURONS_RAM_SIZE_BYTES + sizeof(model_default_instance.model_outputs) +                  \
+	 sizeof(model_default_instance.edgeai) + MODEL_PARAMS_RAM_SIZE_BYTES)
+
+#if defined(CONFIG_APP_DETECTION_FLASH_BUDGET) && (CONFIG_APP_DETECTION_FLASH_BUDGET > 0)
+BUILD_ASSERT(MODEL_FLASH_SIZE_BYTES <= CONFIG_APP_DETECTION_FLASH_BUDGET,
+	     "Model constants exceed CONFIG_APP_DETECTION_FLASH_BUDGET");
+#endif
+
+#if defined(CONFIG_APP_DETECTION_RAM_BUDGET) && (CONFIG_APP_DETECTION_RAM_BUDGET > 0)
+BUILD_ASSERT(MODEL_RAM_SIZE_BYTES <= CONFIG_APP_DETECTION_RAM_BUDGET,
+	     "Model buffers exceed CONFIG_APP_DETECTION_RAM_BUDGET");
+#endif
+
+void nrf_edgeai_user_model_footprint(nrf_edgeai_user_model_footprint_t *p_footprint)
+{
+	p_footprint->meta_flash = MODEL_META_SIZE_BYTES;
+	p_footprint->packed_flash = MODEL_PACKED_SIZE_BYTES;
+	p_footprint->scales_flash = MODEL_SCALES_SIZE_BYTES;
+	p_footprint->fft_flash = FREQDOMAIN_TABLES_SIZE_BYTES;
+	p_footprint->input_window_ram = INPUT_WINDOW_RAM_SIZE_BYTES;
+	p_footprint->features_ram = FEATURES_RAM_SIZE_BYTES;
+	p_footprint->fft_ram = FREQDOMAIN_BUFFERS_SIZE_BYTES;
+	p_footprint->neurons_ram = NEURONS_RAM_SIZE_BYTES;
+	p_footprint->outputs_ram = sizeof(model_default_instance.model_outputs);
+	p_footprint->context_ram = sizeof(model_default_instance.edgeai);
+	p_footprint->params_ram = MODEL_PARAMS_RAM_SIZE_BYTES;
+#if defined(CONFIG_APP_DETECTION_SHARED_SCRATCH)
+	p_footprint->scratch_ram = sizeof(struct model_scratch);
+#else
+	p_footprint->scratch_ram = 0;
+#endif
+	p_footprint->flash_total = MODEL_FLASH_SIZE_BYTES;
+	p_footprint->ram_total = MODEL_RAM_SIZE_BYTES;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_USER_MODEL_H_
+#define _DETECTION_USER_MODEL_H_
+
+#include <stdint.h>
+#include <nrf_edgeai/rt/nrf_edgeai_types.h>
+#include "nrf_edgeai_generated/nrf_edgeai_user_model.h"
+
+/*
+ * Application side of the Edge AI Lab export in nrf_edgeai_generated/. The
+ * export is built unchanged, detection_user_model.c adds the model instances,
+ * the pipeline stages selected in Kconfig and the footprint around its
+ * constants, so a new export only replaces that directory.
+ * nrf_edgeai_user_model() returns the default instance of this file instead
+ * of the context of the export.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Static memory of the user model per component, in bytes
+ */
+typedef struct nrf_edgeai_user_model_footprint_s {
+	uint32_t meta_flash;       /* Weights, links and output metadata */
+	uint32_t packed_flash;     /* Packed neuron records, CONFIG_APP_DETECTION_PACKED_MODEL */
+	uint32_t scales_flash;     /* Input and feature scaling factors, feature masks */
+	uint32_t fft_flash;        /* FFT tables of frequency-domain features */
+	uint32_t input_window_ram; /* Input window and its context */
+	uint32_t features_ram;     /* Extracted features buffer and DSP pipeline state */
+	uint32_t fft_ram;          /* FFT buffers of frequency-domain features */
+	uint32_t neurons_ram;      /* Neuron activations, including batch buffers */
+	uint32_t outputs_ram;      /* Model outputs */
+	uint32_t context_ram;      /* Runtime context */
+	uint32_t params_ram;       /* Model parameters in RAM, CONFIG_APP_DETECTION_WEIGHTS_IN_RAM */
+	uint32_t scratch_ram;      /* Buffers borrowed from the shared scratch arena, not in the
+				    * totals, CONFIG_APP_DETECTION_SHARED_SCRATCH
+				    */
+	uint32_t flash_total;      /* Sum of the flash components */
+	uint32_t ram_total;        /* Sum of the RAM components */
+} nrf_edgeai_user_model_footprint_t;
+
+/**
+ * @brief Mutable state of one instance of the user model
+ *
+ * Input window, features, feature scaling, neuron and output buffers with the
+ * runtime context using them. Instances share the model constants, so the
+ * same model can run on several streams or threads, one instance each.
+ */
+typedef struct nrf_edgeai_user_model_instance_s nrf_edgeai_user_model_instance_t;
+
+/**
+ * @brief Get the memory size of one user model instance, in bytes
+ *
+ * @return Size to allocate for nrf_edgeai_user_model_instance_init()
+ */
+uint32_t nrf_edgeai_user_model_instance_size(void);
+
+/**
+ * @brief Initialize a user model instance in caller memory
+ *
+ * The memory is nrf_edgeai_user_model_instance_size() bytes aligned for any
+ * type, as malloc() returns it. Feed, run and read the instance through the
+ * returned context as the default one, from one thread at a time.
+ *
+ * @param p_instance Instance memory
+ *
+ * @return Runtime context of the instance
+ */
+nrf_edgeai_t *nrf_edgeai_user_model_instance_init(nrf_edgeai_user_model_instance_t *p_instance);
+
+/**
+ * @brief Get the static flash and RAM used by the user model
+ *
+ * Covers the constants and buffers defined for the model, not the runtime
+ * library code or the stacks of the threads running it. The RAM components
+ * are the ones of the default instance, each further instance adds the same.
+ *
+ * @param p_footprint Sizes per component
+ */
+void nrf_edgeai_user_model_footprint(nrf_edgeai_user_model_footprint_t *p_footprint);
+
+/**
+ * @brief Feed input values to the user model or one of its instances
+ *
+ * nrf_edgeai_feed_inputs() with read-only values: every feed stage of this
+ * file and of the runtime copies them into the input window.
+ *
+ * @param p_edgeai Context returned by nrf_edgeai_user_model_instance_init()
+ *		   or nrf_edgeai_user_model()
+ * @param p_input_values Input values of the model input type
+ * @param num_values Number of values, a multiple of the unique inputs
+ *
+ * @return Status code of nrf_edgeai_feed_inputs()
+ */
+nrf_edgeai_err_t nrf_edgeai_user_model_feed_inputs(nrf_edgeai_t *p_edgeai,
+						   const void *p_input_values,
+						   uint16_t num_values);
+
+/**
+ * @brief Run inference on the default instance with direct calls to its pipeline stages
+ *
+ * Equivalent to nrf_edgeai_run_inference(nrf_edgeai_user_model()), without the
+ * indirect calls through the runtime interfaces table.
+ *
+ * @return NRF Edge AI operation status code @ref nrf_edgeai_err_t
+ */
+nrf_edgeai_err_t nrf_edgeai_user_model_run_inference(void);
+
+/**
+ * @brief Run inference on a user model instance with direct calls to its pipeline stages
+ *
+ * @param p_edgeai Context returned by nrf_edgeai_user_model_instance_init()
+ *		   or nrf_edgeai_user_model()
+ *
+ * @return NRF Edge AI operation status code @ref nrf_edgeai_err_t
+ */
+nrf_edgeai_err_t nrf_edgeai_user_model_instance_run_inference(nrf_edgeai_t *p_edgeai);
+
+/**
+ * @brief Run the next step of an inference on a user model instance
+ *
+ * Splits nrf_edgeai_user_model_instance_run_inference() into bounded calls
+ * with the same results. The first call extracts the features, each further
+ * one evaluates up to budget_neurons neurons, the last one also decodes the
+ * outputs. Requires CONFIG_APP_DETECTION_STEPPED_INFERENCE.
+ * Do not feed the instance until the inference completes, and with
+ * CONFIG_APP_DETECTION_SHARED_SCRATCH do not run other models in between.
+ *
+ * @param p_edgeai Context returned by nrf_edgeai_user_model_instance_init()
+ *		   or nrf_edgeai_user_model()
+ * @param budget_neurons Maximum number of neurons evaluated by this call
+ *
+ * @return NRF_EDGEAI_ERR_INPROGRESS until the inference completes, then the
+ *	   status code of nrf_edgeai_user_model_instance_run_inference()
+ */
+nrf_edgeai_err_t nrf_edgeai_user_model_instance_run_inference_step(nrf_edgeai_t *p_edgeai,
+								   uint16_t budget_neurons);
+
+/**
+ * @brief Get the class probabilities of the last inference
+ *
+ * With CONFIG_APP_DETECTION_LAZY_DECODE the inference only takes the predicted
+ * class and leaves decoded_output.classif.probabilities NULL. The first call
+ * after it normalizes the model outputs in place, later calls return the same
+ * probabilities. Without the option the decode already computed them.
+ *
+ * @param p_edgeai Context of the user model or one of its instances
+ *
+ * @return Probabilities of decoded_output.classif.num_classes classes
+ */
+const flt32_t *nrf_edgeai_user_model_probabilities(nrf_edgeai_t *p_edgeai);
+
+/**
+ * @brief Run the model on a batch of prepared input vectors
+ *
+ * Evaluates the model graph once for all vectors instead of one inference
+ * per window. Requires CONFIG_APP_DETECTION_BATCH_INFERENCE.
+ * The input vectors are the scaled model inputs as produced by the DSP
+ * pipeline, the outputs are the raw output neuron values of each vector.
+ *
+ * @param p_inputs num consecutive model input vectors
+ * @param num Number of input vectors
+ * @param p_outputs num consecutive output vectors of nrf_edgeai_model_outputs_num() values
+ */
+void nrf_edgeai_user_model_run_batch(const flt32_t *p_inputs, uint16_t num, flt32_t *p_outputs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DETECTION_USER_MODEL_H_ */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DETECTION_USER_MODEL_HPP_
+#define _DETECTION_USER_MODEL_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <nrf_edgeai/nrf_edgeai.h>
+#include "detection_user_model.h"
+
+namespace edgeai
+{
+
+/**
+ * @brief C++17 view of a user model with its dimensions known at compile time
+ *
+ * Wraps the runtime context of the default instance or of one initialized by
+ * nrf_edgeai_user_model_instance_init(). The window, features and outputs are
+ * std::array buffers of the template sizes, so the loops filling and reading
+ * them have constant trip counts. Inference calls the pipeline stages of the
+ * user model directly, as nrf_edgeai_user_model_instance_run_inference() does,
+ * not through the runtime interfaces table.
+ *
+ * Call nrf_edgeai_init() on the default context before the first inference,
+ * as from C. Use one object from one thread at a time.
+ *
+ * @tparam Window   Input window size in samples
+ * @tparam Axes     Unique input features per sample, interleaved in the window
+ * @tparam Features Extracted features, the model inputs
+ * @tparam Outputs  Model outputs, the classes
+ */
+template <std::size_t Window, std::size_t Axes, std::size_t Features, std::size_t Outputs>
+class Model
+{
+public:
+    static constexpr std::size_t window_size  = Window;
+    static constexpr std::size_t axes_num     = Axes;
+    static constexpr std::size_t features_num = Features;
+    static constexpr std::size_t outputs_num  = Outputs;
+    static constexpr std::size_t input_len    = Window * Axes;
+
+    static_assert(Window > 0 && Axes > 0 && Features > 0 && Outputs > 0,
+                  "Model dimensions must not be zero");
+    static_assert(input_len <= UINT16_MAX, "Window does not fit one nrf_edgeai_feed_inputs() call");
+
+    using Sample        = std::array<flt32_t, Axes>;
+    using Input         = std::array<flt32_t, input_len>;
+    using FeatureVector = std::array<flt32_t, Features>;
+    using Probabilities = std::array<flt32_t, Outputs>;
+
+    /**
+     * @param p_edgeai Context returned by nrf_edgeai_user_model_instance_init()
+     *                 or nrf_edgeai_user_model()
+     */
+    explicit Model(nrf_edgeai_t* p_edgeai = nrf_edgeai_user_model()) noexcept : p_edgeai_(p_edgeai)
+    {
+    }
+
+    /**
+     * @brief Check the template dimensions against the ones of the context
+     *
+     * @return true if the generated dimensions are the ones of the model
+     */
+    bool matches() const noexcept
+    {
+        return nrf_edgeai_input_window_size(p_edgeai_) == Window &&
+               nrf_edgeai_uniq_inputs_num(p_edgeai_) == Axes &&
+               p_edgeai_->p_dsp->features.overall_num == Features &&
+               p_edgeai_->model.meta.outputs_num == Outputs;
+    }
+
+    /**
+     * @brief Add one sample to the window, run inference when it is full
+     *
+     * @param sample Values of the unique input features
+     *
+     * @return NRF_EDGEAI_ERR_INPROGRESS while the window fills, then the
+     *         status code of run()
+     */
+    nrf_edgeai_err_t push(const Sample& sample) noexcept
+    {
+        for (std::size_t i = 0; i < Axes; i++)
+        {
+            window_[fill_ * Axes + i] = sample[i];
+        }
+
+        if (++fill_ < Window)
+        {
+            return NRF_EDGEAI_ERR_INPROGRESS;
+        }
+
+        fill_ = 0;
+        return infer();
+    }
+
+    /**
+     * @brief Feed a whole window and run inference on it
+     *
+     * Discards the samples added by push() since the last inference.
+     *
+     * @param input Window samples, Axes interleaved values each
+     *
+     * @return NRF Edge AI operation status code @ref nrf_edgeai_err_t,
+     *         NRF_EDGEAI_ERR_INPROGRESS if a sliding window needs more samples
+     */
+    nrf_edgeai_err_t run(const Input& input) noexcept
+    {
+        fill_   = 0;
+        window_ = input;
+        return infer();
+    }
+
+    /** @brief Scaled features the last inference ran the model on */
+    const FeatureVector& features() const noexcept
+    {
+        return features_;
+    }
+
+    /** @brief Class probabilities of the last inference */
+    const Probabilities& probabilities() const noexcept
+    {
+        return probabilities_;
+    }
+
+    /** @brief Predicted class of the last inference */
+    uint16_t predicted_class() const noexcept
+    {
+        return predicted_class_;
+    }
+
+    /** @brief Runtime context, for the C API */
+    nrf_edgeai_t* context() const noexcept
+    {
+        return p_edgeai_;
+    }
+
+private:
+    nrf_edgeai_err_t infer() noexcept
+    {
+        // The runtime may scale the inputs in place, window_ is refilled anyway
+        nrf_edgeai_err_t res =
+            nrf_edgeai_feed_inputs(p_edgeai_, window_.data(), static_cast<uint16_t>(input_len));
+
+        if (res == NRF_EDGEAI_ERR_SUCCESS)
+        {
+            res = nrf_edgeai_user_model_instance_run_inference(p_edgeai_);
+        }
+        if (res != NRF_EDGEAI_ERR_SUCCESS)
+        {
+            return res;
+        }
+
+        std::memcpy(features_.data(), p_edgeai_->p_dsp->features.extracted_memory.p_f32,
+                    sizeof(features_));
+        std::memcpy(probabilities_.data(), nrf_edgeai_user_model_probabilities(p_edgeai_),
+                    sizeof(probabilities_));
+        predicted_class_ = p_edgeai_->decoded_output.classif.predicted_class;
+
+        return NRF_EDGEAI_ERR_SUCCESS;
+    }
+
+    nrf_edgeai_t* p_edgeai_;
+    std::size_t   fill_ = 0;
+    Input         window_{};
+    FeatureVector features_{};
+    Probabilities probabilities_{};
+    uint16_t      predicted_class_ = 0;
+};
+
+/**
+ * @brief The generated model: window of 50 samples of 1 input feature,
+ *        11 features, 7 classes
+ */
+using UserModel = Model<50, 1, 11, 7>;
+
+} // namespace edgeai
+
+#endif /* _DETECTION_USER_MODEL_HPP_ */
@@ -0,0 +1,98 @@
+/*
+ * Generated by scripts/fft_tables.py from nrf_dsp_fft_const_tables_f32.h, do not edit.
+ */
+
+#ifndef _NRF_EDGEAI_USER_FFT_TABLES_H_
+#define _NRF_EDGEAI_USER_FFT_TABLES_H_
+
+#include <nrf_edgeai/dsp/nrf_dsp_types.h>
+
+/** Real FFT length for a window of 50 samples */
+#define FREQDOMAIN_RFFT_LEN 128
+
+/** Runtime utility computing the amplitude spectrum at this length */
+#define FREQDOMAIN_RFFT_FEATURE nrf_edgeai_feature_utility_rfft_128_f32
+
+/** Length of the complex FFT bit reversal table */
+#define FREQDOMAIN_CFFT_BITREV_LEN 56
+
+/* FFT tables, 1136 bytes */
+static const flt32_t FREQDOMAIN_RFFT_TWIDDLE[128] = {
+	0.000000000f, 1.000000000f, 0.049067674f, 0.998795456f,
+	0.098017140f, 0.995184727f, 0.146730474f, 0.989176510f,
+	0.195090322f, 0.980785280f, 0.242980180f, 0.970031253f,
+	0.290284677f, 0.956940336f, 0.336889853f, 0.941544065f,
+	0.382683432f, 0.923879533f, 0.427555093f, 0.903989293f,
+	0.471396737f, 0.881921264f, 0.514102744f, 0.857728610f,
+	0.555570233f, 0.831469612f, 0.595699304f, 0.803207531f,
+	0.634393284f, 0.773010453f, 0.671558955f, 0.740951125f,
+	0.707106781f, 0.707106781f, 0.740951125f, 0.671558955f,
+	0.773010453f, 0.634393284f, 0.803207531f, 0.595699304f,
+	0.831469612f, 0.555570233f, 0.857728610f, 0.514102744f,
+	0.881921264f, 0.471396737f, 0.903989293f, 0.427555093f,
+	0.923879533f, 0.382683432f, 0.941544065f, 0.336889853f,
+	0.956940336f, 0.290284677f, 0.970031253f, 0.242980180f,
+	0.980785280f, 0.195090322f, 0.989176510f, 0.146730474f,
+	0.995184727f, 0.098017140f, 0.998795456f, 0.049067674f,
+	1.000000000f, 0.000000000f, 0.998795456f, -0.049067674f,
+	0.995184727f, -0.098017140f, 0.989176510f, -0.146730474f,
+	0.980785280f, -0.195090322f, 0.970031253f, -0.242980180f,
+	0.956940336f, -0.290284677f, 0.941544065f, -0.336889853f,
+	0.923879533f, -0.382683432f, 0.903989293f, -0.427555093f,
+	0.881921264f, -0.471396737f, 0.857728610f, -0.514102744f,
+	0.831469612f, -0.555570233f, 0.803207531f, -0.595699304f,
+	0.773010453f, -0.634393284f, 0.740951125f, -0.671558955f,
+	0.707106781f, -0.707106781f, 0.671558955f, -0.740951125f,
+	0.634393284f, -0.773010453f, 0.595699304f, -0.803207531f,
+	0.555570233f, -0.831469612f, 0.514102744f, -0.857728610f,
+	0.471396737f, -0.881921264f, 0.427555093f, -0.903989293f,
+	0.382683432f, -0.923879533f, 0.336889853f, -0.941544065f,
+	0.290284677f, -0.956940336f, 0.242980180f, -0.970031253f,
+	0.195090322f, -0.980785280f, 0.146730474f, -0.989176510f,
+	0.098017140f, -0.995184727f, 0.049067674f, -0.998795456f
+};
+
+static const flt32_t FREQDOMAIN_CFFT_TWIDDLE[128] = {
+	1.000000000f, 0.000000000f, 0.995184727f, 0.098017140f,
+	0.980785280f, 0.195090322f, 0.956940336f, 0.290284677f,
+	0.923879533f, 0.382683432f, 0.881921264f, 0.471396737f,
+	0.831469612f, 0.555570233f, 0.773010453f, 0.634393284f,
+	0.707106781f, 0.707106781f, 0.634393284f, 0.773010453f,
+	0.555570233f, 0.831469612f, 0.471396737f, 0.881921264f,
+	0.382683432f, 0.923879533f, 0.290284677f, 0.956940336f,
+	0.195090322f, 0.980785280f, 0.098017140f, 0.995184727f,
+	0.000000000f, 1.000000000f, -0.098017140f, 0.995184727f,
+	-0.195090322f, 0.980785280f, -0.290284677f, 0.956940336f,
+	-0.382683432f, 0.923879533f, -0.471396737f, 0.881921264f,
+	-0.555570233f, 0.831469612f, -0.634393284f, 0.773010453f,
+	-0.707106781f, 0.707106781f, -0.773010453f, 0.634393284f,
+	-0.831469612f, 0.555570233f, -0.881921264f, 0.471396737f,
+	-0.923879533f, 0.382683432f, -0.956940336f, 0.290284677f,
+	-0.980785280f, 0.195090322f, -0.995184727f, 0.098017140f,
+	-1.000000000f, 0.000000000f, -0.995184727f, -0.098017140f,
+	-0.980785280f, -0.195090322f, -0.956940336f, -0.290284677f,
+	-0.923879533f, -0.382683432f, -0.881921264f, -0.471396737f,
+	-0.831469612f, -0.555570233f, -0.773010453f, -0.634393284f,
+	-0.707106781f, -0.707106781f, -0.634393284f, -0.773010453f,
+	-0.555570233f, -0.831469612f, -0.471396737f, -0.881921264f,
+	-0.382683432f, -0.923879533f, -0.290284677f, -0.956940336f,
+	-0.195090322f, -0.980785280f, -0.098017140f, -0.995184727f,
+	-0.000000000f, -1.000000000f, 0.098017140f, -0.995184727f,
+	0.195090322f, -0.980785280f, 0.290284677f, -0.956940336f,
+	0.382683432f, -0.923879533f, 0.471396737f, -0.881921264f,
+	0.555570233f, -0.831469612f, 0.634393284f, -0.773010453f,
+	0.707106781f, -0.707106781f, 0.773010453f, -0.634393284f,
+	0.831469612f, -0.555570233f, 0.881921264f, -0.471396737f,
+	0.923879533f, -0.382683432f, 0.956940336f, -0.290284677f,
+	0.980785280f, -0.195090322f, 0.995184727f, -0.098017140f
+};
+
+static const uint16_t FREQDOMAIN_CFFT_BITREV[FREQDOMAIN_CFFT_BITREV_LEN] = {
+	8, 64, 16, 128, 24, 192, 32, 256, 40, 320, 48, 384,
+	56, 448, 80, 136, 88, 200, 96, 264, 104, 328, 112, 392,
+	120, 456, 152, 208, 160, 272, 168, 336, 176, 400, 184, 464,
+	224, 280, 232, 344, 240, 408, 248, 472, 296, 352, 304, 416,
+	312, 480, 368, 424, 376, 488, 440, 496
+};
+
+#endif /* _NRF_EDGEAI_USER_FFT_TABLES_H_ */
@@ -0,0 +1,409 @@
+/*
+ * Generated by scripts/neuton_compile.py from nrf_edgeai_user_model.c, do not edit.
+ */
+
+#ifndef _NRF_EDGEAI_USER_MODEL_COMPILED_H_
+#define _NRF_EDGEAI_USER_MODEL_COMPILED_H_
+
+#include <math.h>
+#include <nrf_edgeai/nrf_edgeai_ctypes.h>
+
+/** Neuron buffer entries holding the outputs */
+static const uint16_t MODEL_COMPILED_OUTPUT_SLOTS[] = { 0, 1, 2, 3, 4, 5, 6 };
+
+static inline flt32_t compiled_sigmoid_(flt32_t x)
+{
+    return 1.0f / (1.0f + expf(-x));
+}
+
+static inline flt32_t compiled_clamp_(flt32_t x)
+{
+    return (x > 1.0f) ? 1.0f : ((x < 0.0f) ? 0.0f : x);
+}
+
+/** Evaluate the 80 neurons and 795 links of the network, stores the outputs to p_outputs */
+static void model_compiled_run_f32_(const flt32_t* p_inputs, flt32_t* p_outputs)
+{
+    const flt32_t n0 = compiled_clamp_(
+        1.0f * p_inputs[0] + 1.0f * p_inputs[2] + 1.0f * p_inputs[3]
+        + 1.0f * p_inputs[7] - 0.177350596f * p_inputs[9] + 0.102552801f);
+    const flt32_t n1 = compiled_clamp_(
+        -0.5f * n0 + 0.5f * p_inputs[0] - 1.0f * p_inputs[1]
+        - 1.0f * p_inputs[2] + 0.5f * p_inputs[4] - 1.0f * p_inputs[6]
+        + 0.5f);
+    const flt32_t n2 = compiled_clamp_(
+        -0.984299898f * n0 + 0.728435576f * n1 + 0.376076788f * p_inputs[0]
+        + 0.824075818f * p_inputs[1] + 0.5f * p_inputs[4] - 0.5f * p_inputs[7]
+        + 0.44165951f * p_inputs[8] + 0.189211905f);
+    const flt32_t n3 = compiled_clamp_(
+        -1.0f * n1 + 0.726920187f);
+    const flt32_t n4 = compiled_clamp_(
+        0.772790015f * n0 + 0.211787507f * n1 - 0.394407392f * n2
+        - 0.624205589f * n3 + 1.0f * p_inputs[0] + 0.999023318f * p_inputs[1]
+        + 1.0f * p_inputs[2] + 0.295077085f * p_inputs[5] - 1.0f * p_inputs[7]
+        + 0.812500179f * p_inputs[9] + 0.101184398f * p_inputs[10] + 0.346051693f);
+    const flt32_t n5 = compiled_clamp_(
+        0.523817182f * n1 - 0.334205002f * n2 + 0.5f * p_inputs[0]
+        + 0.827145576f * p_inputs[1] - 0.5f * p_inputs[2] - 0.312124193f * p_inputs[5]
+        - 0.999998271f * p_inputs[7] + 0.47907269f);
+    const flt32_t n6 = compiled_clamp_(
+        -0.321583003f * n0 + 1.0f * p_inputs[0] + 1.0f * p_inputs[3]
+        - 0.0788429976f * p_inputs[8] + 0.032032799f * p_inputs[9] + 0.911234021f);
+    const flt32_t n7 = compiled_clamp_(
+        -0.898547828f * n0 - 0.216097504f * n1 + 0.0412205011f * n2
+        - 0.120142497f * n4 - 0.0140920002f * n5 - 1.0f * p_inputs[0]
+        - 0.106879704f * p_inputs[1] - 1.0f * p_inputs[2] - 1.0f * p_inputs[3]
+        - 0.227510005f * p_inputs[4] - 1.0f * p_inputs[7] - 0.0991692021f * p_inputs[8]
+        + 0.218320802f);
+    const flt32_t n8 = compiled_clamp_(
+        -1.0f * n1 + 0.303752303f * n2 + 0.999999881f * n3
+        - 0.00632369984f * n5 - 0.5f * p_inputs[0] - 1.0f * p_inputs[3]
+        + 0.0158322006f * p_inputs[7] + 0.209680796f * p_inputs[8] - 0.819161296f);
+    const flt32_t n9 = compiled_clamp_(
+        -0.762592375f * n0 - 0.47066021f * n2 + 0.227485806f * n4
+        - 1.0f * n8 + 0.482618988f * p_inputs[0] + 0.695839524f * p_inputs[2]
+        + 0.0175142996f * p_inputs[4] - 0.793463588f * p_inputs[7] + 0.911523104f * p_inputs[8]
+        - 0.126730606f);
+    const flt32_t n10 = compiled_clamp_(
+        0.875f * n1 - 0.81245321f * n3 + 0.250037014f);
+    const flt32_t n11 = compiled_sigmoid_(40.0f * (
+        -1.0f * n3 + 1.0f * n10 + 0.224323496f));
+    const flt32_t n12 = compiled_clamp_(
+        -0.230328098f * n0 - 0.884303629f * n1 - 1.0f * n2
+        + 0.53034991f * n6 - 0.5f * n9 - 0.817135513f * p_inputs[0]
+        + 0.419419199f * p_inputs[7] + 0.175852701f * p_inputs[9] + 0.107520603f);
+    const flt32_t n13 = compiled_clamp_(
+        1.0f * n1 - 0.977800608f * n3 - 0.0146906003f * n4
+        - 0.282246709f * n5 + 0.578865886f * n7 - 0.821481884f * p_inputs[1]
+        - 1.0f * p_inputs[2] - 0.6362679f * p_inputs[4] - 0.477871686f * p_inputs[6]
+        + 0.731387615f);
+    const flt32_t n14 = compiled_clamp_(
+        -1.0f * n0 + 0.75f * n7 - 1.0f * p_inputs[0]
+        - 1.0f * p_inputs[2] - 1.0f * p_inputs[3] - 1.0f * p_inputs[7]
+        + 0.0305578001f);
+    const flt32_t n15 = compiled_clamp_(
+        -0.3000741f * n0 + 0.0632160977f * n1 - 0.962798774f * n14
+        - 0.0550062992f * p_inputs[1] + 1.0f * p_inputs[2] + 0.625f * p_inputs[3]
+        - 0.981696188f * p_inputs[4] + 1.0f * p_inputs[7] + 0.0629630983f * p_inputs[8]
+        + 0.0232007001f);
+    const flt32_t n16 = compiled_clamp_(
+        0.0252995007f * n1 + 1.0f * n7 - 0.999999583f * p_inputs[0]
+        - 1.0f * p_inputs[2] - 0.710369706f * p_inputs[4] - 1.0f * p_inputs[7]
+        + 0.144472301f * p_inputs[8] - 0.0620007999f);
+    const flt32_t n17 = compiled_clamp_(
+        0.0713460967f * n0 - 0.942163885f * n1 + 0.234206706f * n2
+        + 1.0f * n7 + 0.96875f * n9 + 1.0f * n14
+        + 1.0f * n16 - 0.477093786f * p_inputs[0] + 0.796185017f * p_inputs[1]
+        - 1.0f * p_inputs[2] + 0.511618614f * p_inputs[4] - 1.0f * p_inputs[8]
+        + 0.293001086f * p_inputs[9] - 0.217961803f);
+    const flt32_t n18 = compiled_clamp_(
+        -0.836919725f * n2 + 0.49761501f * n5 + 0.978065312f * n6
+        - 0.998856723f * n8 + 1.0f * n9 - 0.338771909f * n12
+        - 0.454944015f * p_inputs[0] + 0.528610826f * p_inputs[2] + 0.205824003f * p_inputs[9]
+        - 0.794192612f);
+    const flt32_t n19 = compiled_clamp_(
+        -0.128107607f * n2 - 0.0238827001f * n5 - 0.248881802f * n6
+        + 0.887107491f * n8 - 1.0f * n18 + 0.198831499f * p_inputs[0]
+        - 0.5625f * p_inputs[4] + 0.0203431007f * p_inputs[5] + 0.31443271f * p_inputs[7]
+        - 0.160495207f * p_inputs[8] + 0.00281349989f * p_inputs[9] + 0.369130313f);
+    const flt32_t n20 = compiled_clamp_(
+        0.0139923999f * n5 - 0.9375f * n13 - 0.601125598f * n16
+        - 1.0f * p_inputs[0] + 1.0f * p_inputs[2] - 0.0415764004f * p_inputs[4]
+        + 0.5f * p_inputs[7] + 0.0133260004f * p_inputs[9] + 0.00757919997f);
+    const flt32_t n21 = compiled_clamp_(
+        0.862683773f * n2 - 0.690167487f * n6 - 0.95410949f * n12
+        + 1.0f * n18 - 0.418787301f * p_inputs[9] + 0.352541685f);
+    const flt32_t n22 = compiled_clamp_(
+        -0.374997914f * n1 + 0.000821000023f * n2 - 0.327088594f * n5
+        + 1.0f * n7 - 0.241705507f * n9 - 1.0f * n13
+        - 0.915963292f * n14 + 0.958984375f * n16 + 0.821894288f * n18
+        - 0.680776775f * n20 + 0.489483088f * p_inputs[0] - 0.327869087f * p_inputs[1]
+        - 0.792337418f * p_inputs[2] - 0.743837416f * p_inputs[4] + 0.00115080003f * p_inputs[9]
+        + 0.259533793f);
+    const flt32_t n23 = compiled_clamp_(
+        0.980623186f * n0 + 0.621936619f * n5 - 0.118439399f * n15
+        + 1.0f * n17 + 1.0f * n22 - 1.0f * p_inputs[0]
+        + 0.263516009f * p_inputs[1] + 0.999999881f * p_inputs[2] + 0.225837693f * p_inputs[8]
+        - 0.131072998f * p_inputs[9] - 0.414365709f);
+    const flt32_t n24 = compiled_clamp_(
+        -0.0182058997f * n1 + 0.248901501f * n3 + 0.328946114f * n5
+        + 0.0528807007f * n9 + 0.781231582f * n15 - 0.0340433009f * n21
+        - 1.0f * n23 + 1.0f * p_inputs[0] - 0.999999881f * p_inputs[2]
+        - 0.709048629f * p_inputs[7] - 0.232894301f);
+    const flt32_t n25 = compiled_clamp_(
+        0.00678519998f * n2 + 0.00200000009f * n6 + 0.0146501996f * n9
+        + 0.235493705f * n18 + 0.0576413982f * n23 - 1.0f * p_inputs[0]
+        + 0.0328556001f * p_inputs[1] - 1.0f * p_inputs[2] - 0.967828572f * p_inputs[7]
+        + 0.00740410015f);
+    const flt32_t n26 = compiled_clamp_(
+        0.0046362998f * n2 + 0.401444703f * n20 - 0.489230812f * n23
+        + 1.0f * p_inputs[0] - 1.0f * p_inputs[7] + 0.00209550001f);
+    const flt32_t n27 = compiled_clamp_(
+        0.873969674f * n2 - 0.595515072f * n5 - 1.0f * n14
+        - 1.0f * n26 - 0.318321407f * p_inputs[1] - 0.384434611f);
+    const flt32_t n28 = compiled_clamp_(
+        -0.617214382f * n5 + 1.0f * n17 + 1.0f * n19
+        + 1.0f * n25 - 1.0f * n26 - 1.0f * p_inputs[0]
+        + 0.96875f * p_inputs[1] + 0.0149750998f);
+    const flt32_t n29 = compiled_clamp_(
+        -0.661917686f * n2 - 0.592735708f * n12 - 1.0f * n18
+        + 0.686246216f * n19 - 0.755144f * n24 - 1.0f * n26
+        - 0.582035422f * p_inputs[0] + 0.00134870003f * p_inputs[2] + 0.000768699974f * p_inputs[9]
+        - 0.0595816001f * p_inputs[10] + 0.419306099f);
+    const flt32_t n30 = compiled_clamp_(
+        0.000235200001f * n2 - 0.212981805f * n24 + 1.0f * n26
+        + 0.906021297f * p_inputs[0] + 0.00648730015f * p_inputs[1] - 0.174945593f * p_inputs[2]
+        + 0.00571760023f * p_inputs[5] - 0.189119101f * p_inputs[7] + 0.00106259994f * p_inputs[8]
+        + 0.00123179995f);
+    const flt32_t n31 = compiled_clamp_(
+        0.185535595f * n0 - 0.174289197f * n1 - 0.1911259f * n2
+        + 0.818761885f * n5 + 0.556995094f * n6 + 0.0781906024f * n9
+        + 0.916407108f * n13 + 1.0f * n16 + 0.999999881f * n17
+        + 0.999999821f * n22 + 1.0f * n23 + 1.0f * n28
+        + 1.0f * n30 - 0.5f * p_inputs[0] - 0.205873296f * p_inputs[1]
+        - 0.494709313f * p_inputs[4] - 0.419890612f * p_inputs[6] + 0.264546812f * p_inputs[8]
+        - 0.668821812f);
+    const flt32_t n32 = compiled_clamp_(
+        -0.115188196f * n2 + 0.00945650041f * n4 - 0.943855882f * n6
+        - 1.0f * n22 - 0.495700389f * n28 - 1.0f * n31
+        - 1.0f * p_inputs[0] + 0.858136773f * p_inputs[1] + 0.0577297993f * p_inputs[8]
+        + 0.782351375f);
+    const flt32_t n33 = compiled_clamp_(
+        -0.792339385f * n0 - 0.746519089f * n2 - 0.760215878f * n9
+        + 1.0f * n30 + 0.226986796f * n31 - 0.71745199f * n32
+        - 0.913118601f * p_inputs[1] + 0.775420606f);
+    const flt32_t n34 = compiled_clamp_(
+        0.810234725f * n6 - 0.0900925994f * n9 - 1.0f * n26
+        - 1.0f * n30 - 0.0663935021f * n31 + 0.938033998f * n32
+        - 0.111177899f * n33 - 1.0f * p_inputs[0] + 0.918020785f * p_inputs[1]
+        - 0.875106215f);
+    const flt32_t n35 = compiled_clamp_(
+        -0.870491028f * n0 + 0.269156188f * n9 - 0.922630727f * n13
+        + 0.886850417f * n14 + 0.0866063982f * n16 - 1.0f * n24
+        - 1.0f * n31 + 0.916611075f * n32 - 1.0f * n33
+        - 1.0f * p_inputs[0] - 1.0f * p_inputs[1] + 0.5f * p_inputs[4]
+        + 0.684139073f * p_inputs[10] + 0.0557041988f);
+    const flt32_t n36 = compiled_clamp_(
+        0.626538992f * n13 - 1.0f * p_inputs[0] + 0.302279711f * p_inputs[1]
+        + 0.4375f * p_inputs[4] + 0.901133299f * p_inputs[9] + 0.60296911f * p_inputs[10]
+        - 0.9375f);
+    const flt32_t n37 = compiled_clamp_(
+        0.114515103f * n0 - 0.730399489f * n2 + 1.0f * n8
+        - 0.686647117f * n12 - 0.914620578f * n18 + 1.0f * n19
+        + 0.0910902992f * n20 + 0.821843982f * n28 + 0.0854587033f * n31
+        - 0.670893013f * p_inputs[0] - 0.382610798f * p_inputs[2] + 0.376810491f * p_inputs[3]
+        - 0.156972796f * p_inputs[7] - 0.563187897f * p_inputs[8] - 0.641778529f * p_inputs[10]
+        + 0.705534577f);
+    const flt32_t n38 = compiled_clamp_(
+        -0.0697695985f * n2 - 0.703748226f * n6 - 0.0774234012f * n18
+        + 0.918448627f * n37 - 0.875f * p_inputs[0] - 0.75f * p_inputs[2]
+        + 0.709467292f);
+    const flt32_t n39 = compiled_clamp_(
+        0.138508603f * n6 - 0.59901458f * n12 - 0.674313903f * n13
+        - 0.237412006f * n18 + 0.321894586f * n23 + 0.317839891f * n33
+        + 0.655750513f * n38 + 0.75f * p_inputs[0] - 0.875f * p_inputs[7]
+        - 0.0988207012f);
+    const flt32_t n40 = compiled_clamp_(
+        -0.625f * n6 - 0.5f * n31 - 0.705835819f * n35
+        + 1.0f * p_inputs[0] - 1.0f * p_inputs[1] - 0.400303304f * p_inputs[4]
+        - 0.812169373f * p_inputs[6] + 0.220991597f * p_inputs[10] + 0.887837589f);
+    const flt32_t n41 = compiled_clamp_(
+        -1.0f * n2 - 0.557116926f * n12 + 0.875f * n19
+        - 0.305989087f * n31 - 1.0f * n38 - 0.193707302f * p_inputs[0]
+        + 0.90625f * p_inputs[2] + 0.506798923f);
+    const flt32_t n42 = compiled_clamp_(
+        -1.0f * n15 - 0.0500376001f * n24 - 1.0f * n30
+        + 0.281960905f * n31 + 0.204835296f * n32 - 1.0f * p_inputs[0]
+        - 1.0f * p_inputs[2] - 1.0f * p_inputs[3] + 0.0307720006f * p_inputs[4]
+        + 0.5f * p_inputs[7] + 0.0135049f * p_inputs[8] + 0.0328295007f);
+    const flt32_t n43 = compiled_clamp_(
+        -0.118251801f * n1 + 0.0237121992f * n5 + 0.104849897f * n15
+        + 1.0f * n20 + 0.5f * n25 - 0.895137012f * n26
+        - 1.0f * n30 + 0.0546942018f * n31 + 0.572559476f * n32
+        - 1.0f * n37 - 0.506959677f * n40 + 1.0f * n42
+        - 1.0f * p_inputs[0] + 0.5f * p_inputs[2] - 1.0f * p_inputs[3]
+        - 0.343790114f * p_inputs[4] + 1.0f * p_inputs[7] - 0.0714142025f * p_inputs[8]
+        + 0.0404937007f);
+    const flt32_t n44 = compiled_clamp_(
+        0.777240217f * n2 + 0.5f * n32 - 1.0f * n40
+        + 1.0f * p_inputs[0] - 1.0f * p_inputs[2] + 0.0501350984f * p_inputs[7]
+        - 0.749648929f * p_inputs[8] - 0.243148997f);
+    const flt32_t n45 = compiled_clamp_(
+        -1.0f * n2 + 0.983617187f * n26 - 0.321482211f * n31
+        - 0.873125076f * p_inputs[0] + 0.679508328f * p_inputs[2] - 0.767263412f * p_inputs[8]
+        + 0.539729178f);
+    const flt32_t n46 = compiled_clamp_(
+        1.0f * n1 - 0.0507064015f * n2 - 0.263591111f * n5
+        + 0.163650602f * n13 - 1.0f * n20 - 0.999997675f * n24
+        - 1.0f * n26 - 0.625f * n31 - 1.0f * n38
+        - 1.0f * p_inputs[0] - 0.788316429f * p_inputs[1] + 0.838175118f * p_inputs[4]
+        - 0.463685989f * p_inputs[5] + 0.679341972f * p_inputs[9] + 0.168034494f * p_inputs[10]
+        - 0.172501504f);
+    const flt32_t n47 = compiled_clamp_(
+        1.0f * n35 - 0.858232617f * p_inputs[0] + 1.0f * p_inputs[4]
+        - 0.695071816f * p_inputs[10] + 0.00587960007f);
+    const flt32_t n48 = compiled_clamp_(
+        -0.875f * n13 + 0.5f * n25 - 1.0f * n26
+        + 0.875f * n28 + 0.537266314f * n43 - 0.5f * p_inputs[3]
+        + 0.00115609996f);
+    const flt32_t n49 = compiled_clamp_(
+        -0.324336886f * n0 - 0.234191403f * n13 + 0.298444897f * n16
+        - 0.232878402f * n20 + 1.0f * n26 - 0.253470689f * n42
+        + 1.0f * n47 - 0.100169301f * p_inputs[4] + 0.0100844996f);
+    const flt32_t n50 = compiled_clamp_(
+        -0.227534503f * n16 - 1.0f * n20 - 0.999796629f * n26
+        + 0.811673582f * n30 + 0.0261346996f * n38 - 0.284823805f * n47
+        - 0.891425014f * n48 + 0.863191128f * p_inputs[4] + 0.00664260006f);
+    const flt32_t n51 = compiled_clamp_(
+        -0.114401102f * n4 - 0.5f * n6 + 0.133023798f * n12
+        + 0.155566901f * n13 - 0.079610303f * n23 - 0.824809074f * n38
+        + 0.0883629993f * n41 - 1.0f * n45 - 1.0f * n48
+        - 0.423755705f * p_inputs[0] + 0.609554112f);
+    const flt32_t n52 = compiled_clamp_(
+        -1.0f * n20 + 0.313621312f * n24 + 0.93466258f * n26
+        - 0.41762501f * n31 + 1.0f * n35 - 0.6605196f * n42
+        - 0.997934699f * n48 - 0.0999720022f * n51 + 0.756030977f * p_inputs[0]
+        + 0.0822129026f * p_inputs[2] - 0.399011612f * p_inputs[7] + 0.0168901999f * p_inputs[8]
+        + 0.0324038006f);
+    const flt32_t n53 = compiled_clamp_(
+        0.000576300023f * n4 - 0.0720171034f * n15 - 0.761508822f * n24
+        - 0.891049087f * n42 - 1.0f * n48 + 0.764432192f * n51
+        + 0.282368213f * n52 + 1.0f * p_inputs[0] - 0.875f * p_inputs[7]
+        + 0.00250359997f);
+    const flt32_t n54 = compiled_clamp_(
+        0.219825804f * n7 - 0.0243207999f * n24 - 0.630146384f * n26
+        + 1.0f * n48 - 1.0f * p_inputs[0] + 0.00698729977f);
+    const flt32_t n55 = compiled_clamp_(
+        -0.2103111f * n26 - 0.853681624f * n31 + 0.513077378f * n32
+        + 0.114724003f * n35 - 0.772460878f * n43 + 0.5f * n46
+        + 0.123530596f * n47 - 0.787667274f * n48 + 1.0f * n53
+        - 0.488013715f * p_inputs[7] + 0.0482298993f * p_inputs[9] + 0.00570609979f);
+    const flt32_t n56 = compiled_clamp_(
+        -0.201482296f * n13 + 1.0f * n25 - 0.254197806f * n30
+        - 0.593776524f * n31 - 1.0f * n34 + 1.0f * n35
+        - 0.401643813f * n43 + 0.729282618f * n47 + 0.889327824f * n49
+        - 0.077698499f * p_inputs[1] - 1.0f * p_inputs[7] - 0.5f * p_inputs[10]
+        + 0.0176350009f);
+    const flt32_t n57 = compiled_clamp_(
+        0.00681139994f * n5 - 0.503054917f * n25 + 0.75f * n26
+        - 0.400640011f * n27 + 1.0f * n47 - 0.881500781f * n55
+        + 1.0f * n56 + 1.0f * p_inputs[2] - 1.0f * p_inputs[3]
+        + 0.791467488f * p_inputs[7] + 0.00978390034f);
+    const flt32_t n58 = compiled_clamp_(
+        0.275076002f * n5 - 0.269927889f * n15 + 0.375f * n30
+        + 0.58082962f * n47 + 1.0f * n56 - 1.0f * p_inputs[0]
+        - 0.247443303f * p_inputs[5] + 0.5f * p_inputs[7] + 0.000662999984f);
+    const flt32_t n59 = compiled_clamp_(
+        -0.999996424f * n0 + 0.386372507f * n1 + 0.342143089f * n4
+        + 1.0f * n6 + 0.716374516f * n21 + 1.0f * n22
+        + 0.757817686f * n30 - 1.0f * n32 - 0.163036093f * n40
+        - 0.539695024f * n51 + 1.0f * n53 - 0.250001103f * p_inputs[2]
+        - 0.448829591f * p_inputs[4] - 0.341892093f * p_inputs[9] - 0.906180918f);
+    const flt32_t n60 = compiled_clamp_(
+        0.451998502f * n0 - 0.871211827f * n21 - 0.5f * n23
+        - 0.974097908f * n42 - 0.941968322f * n43 + 1.0f * n48
+        - 1.0f * n51 + 0.873129725f * n52 + 0.93277818f * p_inputs[8]
+        + 0.223166093f * p_inputs[10] - 0.376421511f);
+    const flt32_t n61 = compiled_clamp_(
+        0.00270679989f * n0 - 0.470178008f * n1 - 0.0113461995f * n5
+        - 0.777666986f * n14 - 0.867675781f * n16 - 1.0f * n22
+        + 0.376422197f * n42 + 0.563738585f * n51 - 0.9765625f * n52
+        + 0.387654185f * n54 - 0.0338920988f * n58 - 0.73391211f * p_inputs[0]
+        + 0.0777750984f * p_inputs[1] + 0.0418566018f * p_inputs[4] - 0.144757107f * p_inputs[10]
+        + 0.0746477023f);
+    const flt32_t n62 = compiled_clamp_(
+        -1.0f * n3 + 0.629749477f * n22 + 1.0f * n53
+        + 1.0f * n58 + 0.979444385f * p_inputs[4] + 0.501897216f);
+    const flt32_t n63 = compiled_clamp_(
+        0.94490248f * n16 - 1.0f * n23 + 0.806929827f * n58
+        - 0.414785713f * p_inputs[10] + 0.00118929998f);
+    const flt32_t n64 = compiled_clamp_(
+        0.3125f * n47 + 1.0f * n53 - 0.30593729f * n55
+        + 1.0f * n56 + 0.342346489f * p_inputs[3] - 0.0445675999f * p_inputs[4]
+        + 0.00115350005f * p_inputs[9] + 0.00363230007f);
+    const flt32_t n65 = compiled_clamp_(
+        -0.105555698f * n20 - 0.413615704f * n24 + 0.547884524f * n32
+        - 0.400139093f * n35 + 0.0627364963f * n39 - 0.30044499f * n49
+        - 0.0811783969f * n55 - 0.132401705f * n56 - 1.0f * n64
+        + 0.90625f * p_inputs[0] + 0.0105411001f * p_inputs[1] - 1.0f * p_inputs[2]
+        - 1.0f * p_inputs[3] + 0.051231999f * p_inputs[9] - 0.0170938f);
+    const flt32_t n66 = compiled_clamp_(
+        0.0966434032f * n5 + 0.146238193f * n12 - 0.695862114f * n18
+        - 1.0f * n41 + 0.518318474f * p_inputs[2] + 0.293020606f * p_inputs[8]
+        + 0.0635680035f * p_inputs[9] - 0.175470605f);
+    const flt32_t n67 = compiled_sigmoid_(40.0f * (
+        -1.0f * n1 - 1.0f * n18 + 1.0f * n19
+        - 1.0f * n21 + 1.0f * n29 - 1.0f * n41
+        + 0.687499881f * n66 + 0.0f));
+    const flt32_t n68 = compiled_clamp_(
+        -0.972129583f * n5 + 1.0f * n6 + 0.650339127f * n16
+        - 1.0f * n21 + 1.0f * n22 + 0.83405149f * n24
+        + 0.9921875f * n29 - 0.44481501f * n32 + 0.869965196f * n40
+        - 0.386823714f * n51 + 0.999999881f * n53 + 0.350936115f * n58
+        + 0.95977807f * n64 - 0.631817818f * p_inputs[1] - 0.203892797f * p_inputs[9]
+        - 0.311613709f);
+    const flt32_t n69 = compiled_clamp_(
+        -0.0473054983f * n13 - 1.0f * n22 - 0.672016323f * n55
+        + 1.0f * n56 + 0.556193471f * n57 + 0.0415794998f * p_inputs[1]
+        + 0.00223400001f);
+    const flt32_t n70 = compiled_clamp_(
+        0.00626390008f * n5 - 0.921179891f * n13 - 0.628038585f * n22
+        - 0.529361188f * n25 - 0.524539471f * n32 + 0.321687609f * n35
+        + 0.46901691f * n55 + 0.170132503f * p_inputs[4] + 0.00329639995f);
+    const flt32_t n71 = compiled_sigmoid_(37.506237f * (
+        -1.0f * n0 + 1.0f * n7 - 1.0f * n15
+        + 1.0f * n16 + 1.0f * n17 - 1.0f * n20
+        + 1.0f * n22 + 0.999999404f * n27 - 1.0f * n35
+        - 0.625f * n36 + 0.708207488f * n46 - 1.0f * n49
+        + 1.0f * n50 - 1.0f * n64 + 0.878028929f * n65
+        - 1.0f * n69 - 1.0f * n70 + 0.0f));
+    const flt32_t n72 = compiled_clamp_(
+        -0.801136315f * n14 - 0.211854398f * n15 - 0.875f * n24
+        - 1.0f * n32 + 0.123983301f * n38 + 0.140871197f * n51
+        + 0.833318889f * n52 + 0.295857608f * n54 + 1.0f * n64
+        - 0.5f * n65 + 0.687084079f * p_inputs[0] - 0.96875f * p_inputs[7]
+        + 0.0109187001f);
+    const flt32_t n73 = compiled_sigmoid_(40.0f * (
+        0.413908213f * n6 - 1.0f * n14 - 0.906249881f * n23
+        + 0.875f * n24 - 0.978804827f * n25 + 0.499997914f * n26
+        - 1.0f * n28 + 1.0f * n30 - 1.0f * n42
+        - 1.0f * n43 - 1.0f * n44 + 1.0f * n45
+        - 1.0f * n48 + 1.0f * n52 + 1.0f * n53
+        - 1.0f * n54 + 1.0f * n72 - 0.37712729f));
+    const flt32_t n74 = compiled_clamp_(
+        0.281920612f * n0 - 0.760162413f * n16 + 0.327306896f * n20
+        - 0.0931032002f * n21 + 0.624088824f * n22 - 0.0771301016f * n72
+        - 0.299736708f * p_inputs[4] + 0.0304659009f);
+    const flt32_t n75 = compiled_sigmoid_(40.0f * (
+        -0.490738988f * n4 - 1.0f * n12 - 1.0f * n59
+        - 1.0f * n60 + 1.0f * n61 - 1.0f * n62
+        + 0.984375f * n63 - 1.0f * n68 + 0.33984381f * n74
+        + 0.205946997f));
+    const flt32_t n76 = compiled_clamp_(
+        -0.256997913f * n7 + 0.00352380006f * n12 - 0.399291605f * n13
+        + 0.404969394f * n34 + 0.799164474f * n38 - 1.0f * n41
+        - 0.967487574f * n45 - 0.413619697f * p_inputs[3] + 0.0126753002f);
+    const flt32_t n77 = compiled_sigmoid_(40.0f * (
+        -1.0f * n2 + 0.7578125f * n9 - 1.0f * n37
+        - 1.0f * n38 - 1.0f * n39 + 0.718749881f * n51
+        - 1.0f * n76 + 0.406334907f));
+    const flt32_t n78 = compiled_clamp_(
+        0.0108147003f * n5 - 0.443666399f * n25 + 0.0550596006f * n26
+        + 0.00264049997f * n47 - 0.960963011f * n50 + 0.998046875f * n56
+        + 0.000453099987f * p_inputs[5] + 0.00165690004f);
+    const flt32_t n79 = compiled_sigmoid_(40.0f * (
+        -0.670796275f * n5 - 1.0f * n13 - 1.0f * n31
+        + 1.0f * n32 - 0.715111673f * n33 + 0.5f * n34
+        - 1.0f * n40 - 1.0f * n55 + 1.0f * n56
+        + 1.0f * n57 + 1.0f * n58 + 1.0f * n78
+        + 0.175714403f));
+    p_outputs[0] = n71;
+    p_outputs[1] = n67;
+    p_outputs[2] = n77;
+    p_outputs[3] = n11;
+    p_outputs[4] = n75;
+    p_outputs[5] = n79;
+    p_outputs[6] = n73;
+}
+
+#endif /* _NRF_EDGEAI_USER_MODEL_COMPILED_H_ */
@@ -0,0 +1,6007 @@
+/*
+ * Generated by scripts/neuton_pack.py from nrf_edgeai_user_model.c, do not edit.
+ */
+
+#ifndef _NRF_EDGEAI_USER_MODEL_PACKED_H_
+#define _NRF_EDGEAI_USER_MODEL_PACKED_H_
+
+#include "app_nn.h"
+
+/** Qualifier of the packed records, defined empty to keep them in RAM */
+#ifndef MODEL_PACKED_CONST
+#define MODEL_PACKED_CONST const
+#endif
+
+/** Activation slots needed for the peak live set of neurons */
+#define MODEL_PACKED_SLOTS_NUM 52
+
+/** Number of packed neuron records */
+#define MODEL_PACKED_RECORDS_NUM 80
+
+/** Activation slots holding the output neurons */
+static const uint16_t MODEL_PACKED_OUTPUT_SLOTS[] = { 10, 18, 9, 3, 0, 29, 4 };
+
+/** Output neuron records in evaluation order */
+static const struct app_nn_packed_output MODEL_PACKED_OUTPUTS[] = {
+	{ .position = 4, .slot = 3 },
+	{ .position = 35, .slot = 18 },
+	{ .position = 48, .slot = 9 },
+	{ .position = 61, .slot = 29 },
+	{ .position = 67, .slot = 10 },
+	{ .position = 71, .slot = 4 },
+	{ .position = 79, .slot = 0 },
+};
+
+#if defined(CONFIG_APP_DETECTION_PACKED_MODEL_Q8)
+/** Packed neuron records with q8 weights, 3368 bytes, 769 links, largest weight error 0.0039370 */
+static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {
+	{ .u32 = 0x80060000 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04010200 },
+	{ .u32 = 0x7f7f7f7f },
+	{ .u32 = 0x00000202 },
+	{ .u32 = 0x00000de9 },
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c800000 }, /* 0.015625 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x000000e0 },
+	{ .u32 = 0x02010100 },
+	{ .u32 = 0x20c0c020 },
+	{ .u32 = 0x00000502 },
+	{ .u32 = 0x000020c0 },
+	{ .u32 = 0x80010001 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000005c },
+	{ .u32 = 0x80010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c000000 }, /* 0.0078125 */
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x00009870 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x00010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00000102 },
+	{ .u32 = 0x00007f81 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c000000 }, /* 0.0078125 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x00005d82 },
+	{ .u32 = 0x03030100 },
+	{ .u32 = 0xc0406930 },
+	{ .u32 = 0x00000301 },
+	{ .u32 = 0x00001839 },
+	{ .u32 = 0x80080004 },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02010100 },
+	{ .u32 = 0xceb11b62 },
+	{ .u32 = 0x03010100 },
+	{ .u32 = 0x257f7f7f },
+	{ .u32 = 0x01010202 },
+	{ .u32 = 0x2c0d6781 },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c0101f6 }, /* 0.00787400236 */
+	{ .u32 = 0x00000301 },
+	{ .u32 = 0x0000d643 },
+	{ .u32 = 0x03010100 },
+	{ .u32 = 0xd8c06940 },
+	{ .u32 = 0x00000402 },
+	{ .u32 = 0x00003d81 },
+	{ .u32 = 0x80050001 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x000000d7 },
+	{ .u32 = 0x01050300 },
+	{ .u32 = 0x04f67f7f },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x00000074 },
+	{ .u32 = 0x80080005 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x41e13cc9 }, /* 28.1546803 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01030100 },
+	{ .u32 = 0xf105e58e },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x000000fe },
+	{ .u32 = 0x01010100 },
+	{ .u32 = 0x8181f281 },
+	{ .u32 = 0x03010301 },
+	{ .u32 = 0x1cf381e3 },
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02020101 },
+	{ .u32 = 0xff277f81 },
+	{ .u32 = 0x01040300 },
+	{ .u32 = 0x1b0281c0 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x00000098 },
+	{ .u32 = 0x80060004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04010400 },
+	{ .u32 = 0x811dc49f },
+	{ .u32 = 0x03020200 },
+	{ .u32 = 0x9b02583d },
+	{ .u32 = 0x00000301 },
+	{ .u32 = 0x0000f074 },
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x41e0325a }, /* 28.0245857 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x03030100 },
+	{ .u32 = 0x438190e3 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x000000c0 },
+	{ .u32 = 0x02020700 },
+	{ .u32 = 0x0e163598 },
+	{ .u32 = 0x80050005 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x41bcbca4 }, /* 23.5921097 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01030101 },
+	{ .u32 = 0xdcfe847f },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x0000004a },
+	{ .u32 = 0x02020101 },
+	{ .u32 = 0xc3af8198 },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x0000005d },
+	{ .u32 = 0x80050002 },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c800000 }, /* 0.015625 */
+	{ .u32 = 0x00000800 },
+	{ .u32 = 0x000030c0 },
+	{ .u32 = 0x04010200 },
+	{ .u32 = 0xc0c0c0c0 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x80070003 },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x000c0100 },
+	{ .u32 = 0x008608da },
+	{ .u32 = 0x01010101 },
+	{ .u32 = 0x834f7ff9 },
+	{ .u32 = 0x00030103 },
+	{ .u32 = 0x0003087f },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00000701 },
+	{ .u32 = 0x00007f03 },
+	{ .u32 = 0x03020200 },
+	{ .u32 = 0x81a68181 },
+	{ .u32 = 0x00000301 },
+	{ .u32 = 0x0000f812 },
+	{ .u32 = 0x80070007 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04030100 },
+	{ .u32 = 0x7f1e8809 },
+	{ .u32 = 0x00020302 },
+	{ .u32 = 0x007f7f7b },
+	{ .u32 = 0x02010100 },
+	{ .u32 = 0x418165c3 },
+	{ .u32 = 0x00020104 },
+	{ .u32 = 0x00e42581 },
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02010204 },
+	{ .u32 = 0x817c3f96 },
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x0000d57f },
+	{ .u32 = 0x02070200 },
+	{ .u32 = 0x9b1a43c6 },
+	{ .u32 = 0x80060005 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02010204 },
+	{ .u32 = 0x71e0fdf0 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x02010400 },
+	{ .u32 = 0x2803b919 },
+	{ .u32 = 0x00000301 },
+	{ .u32 = 0x00002fec },
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000013 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00030606 },
+	{ .u32 = 0x00b48902 },
+	{ .u32 = 0x03020200 },
+	{ .u32 = 0x40fb7f81 },
+	{ .u32 = 0x00000202 },
+	{ .u32 = 0x00000102 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000014 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x06040304 },
+	{ .u32 = 0x7f87a86e },
+	{ .u32 = 0x00000209 },
+	{ .u32 = 0x00002dcb },
+	{ .u32 = 0x80050009 },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02020501 },
+	{ .u32 = 0xe17fd6d0 },
+	{ .u32 = 0x02020102 },
+	{ .u32 = 0x687a8c81 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x000000aa },
+	{ .u32 = 0x02010100 },
+	{ .u32 = 0xa29bd63e },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x80060005 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02080600 },
+	{ .u32 = 0x7ff14f7d },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x06010100 },
+	{ .u32 = 0x1d7f2181 },
+	{ .u32 = 0x00000201 },
+	{ .u32 = 0x0000cbef },
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000017 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04040101 },
+	{ .u32 = 0x072a20fe },
+	{ .u32 = 0x00020604 },
+	{ .u32 = 0x0081fc63 },
+	{ .u32 = 0x04050200 },
+	{ .u32 = 0xe2a6817f },
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x00000018 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x05070604 },
+	{ .u32 = 0x071e0201 },
+	{ .u32 = 0x05010100 },
+	{ .u32 = 0x85810481 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x80020003 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00030f04 },
+	{ .u32 = 0x00c23301 },
+	{ .u32 = 0x00000700 },
+	{ .u32 = 0x0000817f },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x06020a06 },
+	{ .u32 = 0x7f7f7fb2 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x000a0100 },
+	{ .u32 = 0x00027b81 },
+	{ .u32 = 0x80030006 },
+	{ .u32 = 0x0000001b },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01060704 },
+	{ .u32 = 0x5781b5ac },
+	{ .u32 = 0x00000205 },
+	{ .u32 = 0x000081a0 },
+	{ .u32 = 0x00010a00 },
+	{ .u32 = 0x0035f8b6 },
+	{ .u32 = 0x80050002 },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00000217 },
+	{ .u32 = 0x00007fe5 },
+	{ .u32 = 0x03010100 },
+	{ .u32 = 0x01ea0173 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x000000e8 },
+	{ .u32 = 0x8006000d },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x4207f5ae }, /* 33.9899216 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02030100 },
+	{ .u32 = 0x68e8ea18 },
+	{ .u32 = 0x03020301 },
+	{ .u32 = 0x7f740a47 },
+	{ .u32 = 0x04010501 },
+	{ .u32 = 0x7f7f7f7f },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x02030100 },
+	{ .u32 = 0xcbc1e6c0 },
+	{ .u32 = 0x00000302 },
+	{ .u32 = 0x0000ab22 },
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02050400 },
+	{ .u32 = 0xa97fa30f },
+	{ .u32 = 0x07010106 },
+	{ .u32 = 0x680c7f8c },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x04010200 },
+	{ .u32 = 0xec30cfab },
+	{ .u32 = 0x00010201 },
+	{ .u32 = 0x005aaeb8 },
+	{ .u32 = 0x80030004 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3becf965 }, /* 0.00723187874 */
+	{ .u32 = 0x08020304 },
+	{ .u32 = 0xf57f9ff6 },
+	{ .u32 = 0x00090200 },
+	{ .u32 = 0x00629887 },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0b070704 },
+	{ .u32 = 0xd96fb981 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x00090200 },
+	{ .u32 = 0x004073e7 },
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0e060506 },
+	{ .u32 = 0x81a8130c },
+	{ .u32 = 0x02010602 },
+	{ .u32 = 0xea082542 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c800000 }, /* 0.015625 */
+	{ .u32 = 0x02011001 },
+	{ .u32 = 0xc040c0c0 },
+	{ .u32 = 0x00010407 },
+	{ .u32 = 0x002cc040 },
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x41dfd6b8 }, /* 27.9798431 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0e020104 },
+	{ .u32 = 0x818801f1 },
+	{ .u32 = 0x00000305 },
+	{ .u32 = 0x000081c1 },
+	{ .u32 = 0x03070100 },
+	{ .u32 = 0x63076d81 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x12060400 },
+	{ .u32 = 0x7f9fa19b },
+	{ .u32 = 0x00000301 },
+	{ .u32 = 0x0000a51d },
+	{ .u32 = 0x00000a01 },
+	{ .u32 = 0x0000628c },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x030f0307 },
+	{ .u32 = 0x8181f567 },
+	{ .u32 = 0x00010301 },
+	{ .u32 = 0x00f277f8 },
+	{ .u32 = 0x000a0100 },
+	{ .u32 = 0x00917581 },
+	{ .u32 = 0x80050009 },
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01020a00 },
+	{ .u32 = 0x718b2291 },
+	{ .u32 = 0x03060802 },
+	{ .u32 = 0x7481810b },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x06030100 },
+	{ .u32 = 0x57408181 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c000000 }, /* 0.0078125 */
+	{ .u32 = 0x05010407 },
+	{ .u32 = 0xe2aab312 },
+	{ .u32 = 0x00030805 },
+	{ .u32 = 0x00295429 },
+	{ .u32 = 0x00040700 },
+	{ .u32 = 0x00f39060 },
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00061607 },
+	{ .u32 = 0x00a6c0b1 },
+	{ .u32 = 0x02030100 },
+	{ .u32 = 0x99cd817f },
+	{ .u32 = 0x00000104 },
+	{ .u32 = 0x0000711c },
+	{ .u32 = 0x80070005 },
+	{ .u32 = 0x00000025 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c800000 }, /* 0.015625 */
+	{ .u32 = 0x0105090e },
+	{ .u32 = 0x12c0fdc0 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x01010200 },
+	{ .u32 = 0x02c0c0c0 },
+	{ .u32 = 0x00030103 },
+	{ .u32 = 0x00020120 },
+	{ .u32 = 0x8007000c },
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x05030501 },
+	{ .u32 = 0x0d8103f1 },
+	{ .u32 = 0x03010505 },
+	{ .u32 = 0x818e407f },
+	{ .u32 = 0x01040301 },
+	{ .u32 = 0x7fc04907 },
+	{ .u32 = 0x01010200 },
+	{ .u32 = 0xd4814081 },
+	{ .u32 = 0x00030103 },
+	{ .u32 = 0x0005f77f },
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00041504 },
+	{ .u32 = 0x00d77d81 },
+	{ .u32 = 0x03060200 },
+	{ .u32 = 0x459f5691 },
+	{ .u32 = 0x80010005 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01010c0c },
+	{ .u32 = 0x6f814091 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x00000044 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x000000c0 },
+	{ .u32 = 0x80020009 },
+	{ .u32 = 0x00000029 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01040205 },
+	{ .u32 = 0x1411c0f1 },
+	{ .u32 = 0x0801080a },
+	{ .u32 = 0x810b97f6 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x00000b00 },
+	{ .u32 = 0x00004dca },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01120408 },
+	{ .u32 = 0x8165cddf },
+	{ .u32 = 0x00000503 },
+	{ .u32 = 0x00008533 },
+	{ .u32 = 0x00000803 },
+	{ .u32 = 0x000002cb },
+	{ .u32 = 0x00010007 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x07010504 },
+	{ .u32 = 0x81608181 },
+	{ .u32 = 0x000a010d },
+	{ .u32 = 0x005b8181 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000034 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0c070204 },
+	{ .u32 = 0x8181b46f },
+	{ .u32 = 0x00000a01 },
+	{ .u32 = 0x0000cfd8 },
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x06020301 },
+	{ .u32 = 0x15dffa7f },
+	{ .u32 = 0x04020407 },
+	{ .u32 = 0xb1818181 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x01030100 },
+	{ .u32 = 0xc56a9c81 },
+	{ .u32 = 0x00010104 },
+	{ .u32 = 0x00ea1556 },
+	{ .u32 = 0x80040001 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x01060400 },
+	{ .u32 = 0x01a87f93 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04030c00 },
+	{ .u32 = 0xe226e2d7 },
+	{ .u32 = 0x00050c06 },
+	{ .u32 = 0x007fe07f },
+	{ .u32 = 0x00000704 },
+	{ .u32 = 0x000001f3 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0306040f },
+	{ .u32 = 0x678181e3 },
+	{ .u32 = 0x00020a02 },
+	{ .u32 = 0x00dc8f03 },
+	{ .u32 = 0x00000704 },
+	{ .u32 = 0x0000016e },
+	{ .u32 = 0x80050008 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04020413 },
+	{ .u32 = 0xcb772881 },
+	{ .u32 = 0x01030206 },
+	{ .u32 = 0xf381ac7f },
+	{ .u32 = 0x01050200 },
+	{ .u32 = 0x02cd0a60 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x030e090e },
+	{ .u32 = 0x818f9ff7 },
+	{ .u32 = 0x00000401 },
+	{ .u32 = 0x00002461 },
+	{ .u32 = 0x00000700 },
+	{ .u32 = 0x0000917f },
+	{ .u32 = 0x80030009 },
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01020419 },
+	{ .u32 = 0x414094e5 },
+	{ .u32 = 0x02020303 },
+	{ .u32 = 0x109c9e0f },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x00020207 },
+	{ .u32 = 0x000106c2 },
+	{ .u32 = 0x80040009 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x01040c0c },
+	{ .u32 = 0xb5e07fe6 },
+	{ .u32 = 0x04030105 },
+	{ .u32 = 0x5dcd7f81 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000071 },
+	{ .u32 = 0x01030601 },
+	{ .u32 = 0x02c081f6 },
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x010e0406 },
+	{ .u32 = 0x5fc0cd01 },
+	{ .u32 = 0x00010511 },
+	{ .u32 = 0x007f907f },
+	{ .u32 = 0x04040102 },
+	{ .u32 = 0x0165817f },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0e0e0806 },
+	{ .u32 = 0x4a30de23 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x00020500 },
+	{ .u32 = 0x0040e181 },
+	{ .u32 = 0x80000005 },
+	{ .u32 = 0x00000033 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c00c183 }, /* 0.00785863701 */
+	{ .u32 = 0x13011206 },
+	{ .u32 = 0x8607c801 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x0001000c },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c800000 }, /* 0.015625 */
+	{ .u32 = 0x03110606 },
+	{ .u32 = 0x40c0c0d5 },
+	{ .u32 = 0x0b020101 },
+	{ .u32 = 0xc0c020d2 },
+	{ .u32 = 0x01010101 },
+	{ .u32 = 0x40404040 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x00000050 },
+	{ .u32 = 0x05030100 },
+	{ .u32 = 0x72382681 },
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x0000894d },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0101042a },
+	{ .u32 = 0x7fd97f28 },
+	{ .u32 = 0x00000103 },
+	{ .u32 = 0x0000fa2b },
+	{ .u32 = 0x80060009 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x09040211 },
+	{ .u32 = 0x46cbf308 },
+	{ .u32 = 0x04080102 },
+	{ .u32 = 0xf6dacd81 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x000000ef },
+	{ .u32 = 0x01010100 },
+	{ .u32 = 0x81810173 },
+	{ .u32 = 0x00000206 },
+	{ .u32 = 0x0000fe07 },
+	{ .u32 = 0x80010005 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x011a090c },
+	{ .u32 = 0x7fab81fa },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000047 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x80010007 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c000000 }, /* 0.0078125 */
+	{ .u32 = 0x03090606 },
+	{ .u32 = 0xbcb08a01 },
+	{ .u32 = 0x000c0308 },
+	{ .u32 = 0x003c29bd },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02020800 },
+	{ .u32 = 0x817f7f81 },
+	{ .u32 = 0x01010102 },
+	{ .u32 = 0x707f7f81 },
+	{ .u32 = 0x020a0202 },
+	{ .u32 = 0xb15a7f81 },
+	{ .u32 = 0x01070101 },
+	{ .u32 = 0x81818181 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x80050003 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x00041c04 },
+	{ .u32 = 0x00814063 },
+	{ .u32 = 0x01050200 },
+	{ .u32 = 0xa106817f },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x000000e1 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0f020f08 },
+	{ .u32 = 0x7fb0fd1c },
+	{ .u32 = 0x00000b00 },
+	{ .u32 = 0x00000181 },
+	{ .u32 = 0x8003000a },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x03010508 },
+	{ .u32 = 0xc0e59a26 },
+	{ .u32 = 0x02020706 },
+	{ .u32 = 0x7f811091 },
+	{ .u32 = 0x00000407 },
+	{ .u32 = 0x00006a12 },
+	{ .u32 = 0x00040700 },
+	{ .u32 = 0x00018557 },
+	{ .u32 = 0x00010011 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04010304 },
+	{ .u32 = 0x7f813581 },
+	{ .u32 = 0x01010901 },
+	{ .u32 = 0x846f8d81 },
+	{ .u32 = 0x09020101 },
+	{ .u32 = 0x817f813f },
+	{ .u32 = 0x05010101 },
+	{ .u32 = 0x7f817f81 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x0000007f },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000000d0 },
+	{ .u32 = 0x8004000b },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x420f3fca }, /* 35.8122940 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x02040100 },
+	{ .u32 = 0x7f2b3181 },
+	{ .u32 = 0x0407010d },
+	{ .u32 = 0x81607f5b },
+	{ .u32 = 0x00050504 },
+	{ .u32 = 0x007fbbeb },
+	{ .u32 = 0x02050202 },
+	{ .u32 = 0x8dd5c7e0 },
+	{ .u32 = 0x80030008 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x0f021400 },
+	{ .u32 = 0x84c09139 },
+	{ .u32 = 0x04010201 },
+	{ .u32 = 0x6f817f88 },
+	{ .u32 = 0x00010208 },
+	{ .u32 = 0x00d01c76 },
+	{ .u32 = 0x8005000a },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x05020501 },
+	{ .u32 = 0x9d31ffc4 },
+	{ .u32 = 0x04100602 },
+	{ .u32 = 0x48308192 },
+	{ .u32 = 0x00000504 },
+	{ .u32 = 0x0000fc84 },
+	{ .u32 = 0x06030100 },
+	{ .u32 = 0xee050aa3 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x04191302 },
+	{ .u32 = 0x7f7f5081 },
+	{ .u32 = 0x00000704 },
+	{ .u32 = 0x0000407c },
+	{ .u32 = 0x80010003 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x001c070f },
+	{ .u32 = 0x00668178 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x000000cb },
+	{ .u32 = 0x8003000d },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x05080106 },
+	{ .u32 = 0x81537f85 },
+	{ .u32 = 0x05040201 },
+	{ .u32 = 0xc87e6a7f },
+	{ .u32 = 0x05050202 },
+	{ .u32 = 0x7fcf6e7a },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x00020801 },
+	{ .u32 = 0x00d8e6b0 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3bc42245 }, /* 0.00598553071 */
+	{ .u32 = 0x04030c00 },
+	{ .u32 = 0x3781f32f },
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x000068f0 },
+	{ .u32 = 0x00000704 },
+	{ .u32 = 0x000005ce },
+	{ .u32 = 0x00010009 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x3c010204 }, /* 0.00787401575 */
+	{ .u32 = 0x03010100 },
+	{ .u32 = 0xc2817f2b },
+	{ .u32 = 0x03030201 },
+	{ .u32 = 0x81817d81 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x00000081 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000001a },
+};
+#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_UNIT)
+/** Packed neuron records with unit weight links, 5532 bytes, 211 unit links */
+static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {
+	{ .u32 = 0x80020000 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbe359b65 }, /* -0.1773506 */
+	{ .u32 = 0x3dd20734 }, /* 0.1025528 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x80030001 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x03000000 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x80010000 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f3a1771 }, /* 0.7269202 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x80010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0xbf4ffcef }, /* -0.8124532 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e8004da }, /* 0.2500370 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e65b50f }, /* 0.2243235 */
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf7bfb14 }, /* -0.9842999 */
+	{ .u32 = 0x3f3a7ac1 }, /* 0.7284356 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3ec08d23 }, /* 0.3760768 */
+	{ .u32 = 0x3f52f6a2 }, /* 0.8240758 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3ee22132 }, /* 0.4416595 */
+	{ .u32 = 0x3e41c0c4 }, /* 0.1892119 */
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01020000 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f45d591 }, /* 0.7727900 */
+	{ .u32 = 0x3e58ded3 }, /* 0.2117875 */
+	{ .u32 = 0x00020004 },
+	{ .u32 = 0xbec9efc4 }, /* -0.3944074 */
+	{ .u32 = 0xbf1fcbf0 }, /* -0.6242056 */
+	{ .u32 = 0x00050001 },
+	{ .u32 = 0x3f7fbffe }, /* 0.9990233 */
+	{ .u32 = 0x3e971458 }, /* 0.2950771 */
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0x3f500003 }, /* 0.8125002 */
+	{ .u32 = 0x3dcf39c4 }, /* 0.1011844 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3eb12db0 }, /* 0.3460517 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x3f0618e2 }, /* 0.5238172 */
+	{ .u32 = 0xbeab1ceb }, /* -0.3342050 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x3f53bfd0 }, /* 0.8271456 */
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0xbe9fcebe }, /* -0.3121242 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xbf7fffe3 }, /* -0.9999983 */
+	{ .u32 = 0x3ef54904 }, /* 0.4790727 */
+	{ .u32 = 0x80030001 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0xbea4a687 }, /* -0.3215830 */
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0xbda17870 }, /* -0.0788430 */
+	{ .u32 = 0x3d0334d3 }, /* 0.0320328 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f6946a2 }, /* 0.9112340 */
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x41e13cc9 }, /* 28.1546803 */
+	{ .u32 = 0x04000000 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf66073b }, /* -0.8985478 */
+	{ .u32 = 0xbe5d48aa }, /* -0.2160975 */
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0x3d28d6d4 }, /* 0.0412205 */
+	{ .u32 = 0xbdf60d45 }, /* -0.1201425 */
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0xbc66e222 }, /* -0.0140920 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbddae3bf }, /* -0.1068797 */
+	{ .u32 = 0xbe68f862 }, /* -0.2275100 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbdcb1939 }, /* -0.0991692 */
+	{ .u32 = 0x3e5f8f7d }, /* 0.2183208 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01000100 },
+	{ .u32 = 0x00020004 },
+	{ .u32 = 0x3e9b856c }, /* 0.3037523 */
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0xbbcf370a }, /* -0.0063237 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x3c81b288 }, /* 0.0158322 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3e56b690 }, /* 0.2096808 */
+	{ .u32 = 0xbf51b48e }, /* -0.8191613 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf433941 }, /* -0.7625924 */
+	{ .u32 = 0xbef0fa60 }, /* -0.4706602 */
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x3e68f20a }, /* 0.2274858 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3ef719d6 }, /* 0.4826190 */
+	{ .u32 = 0x3f32228a }, /* 0.6958395 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3c8f7a26 }, /* 0.0175143 */
+	{ .u32 = 0xbf4b206e }, /* -0.7934636 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3f695994 }, /* 0.9115231 */
+	{ .u32 = 0xbe01c5ab }, /* -0.1267306 */
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x41e0325a }, /* 28.0245857 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbe6bdb21 }, /* -0.2303281 */
+	{ .u32 = 0xbf6261b9 }, /* -0.8843036 */
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0x3f07c503 }, /* 0.5303499 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbf512fcb }, /* -0.8171355 */
+	{ .u32 = 0x3ed6be1d }, /* 0.4194192 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3e3412bb }, /* 0.1758527 */
+	{ .u32 = 0x3ddc33c3 }, /* 0.1075206 */
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x41bcbca4 }, /* 23.5921097 */
+	{ .u32 = 0x01000001 },
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0xbf7a5124 }, /* -0.9778006 */
+	{ .u32 = 0xbc70b0d8 }, /* -0.0146906 */
+	{ .u32 = 0x00080006 },
+	{ .u32 = 0xbe9082a4 }, /* -0.2822467 */
+	{ .u32 = 0x3f14308e }, /* 0.5788659 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbf524ca3 }, /* -0.8214819 */
+	{ .u32 = 0xbf22e274 }, /* -0.6362679 */
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0xbef4ab99 }, /* -0.4778717 */
+	{ .u32 = 0x3f3b3c38 }, /* 0.7313876 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x80010001 },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x04000100 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x3f400000 }, /* 0.7500000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3cfa545a }, /* 0.0305578 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x80050003 },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbe99a350 }, /* -0.3000741 */
+	{ .u32 = 0x3d817771 }, /* 0.0632161 */
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0xbf7679fb }, /* -0.9627988 */
+	{ .u32 = 0x00030001 },
+	{ .u32 = 0xbd614e49 }, /* -0.0550063 */
+	{ .u32 = 0x3f200000 }, /* 0.6250000 */
+	{ .u32 = 0x00080004 },
+	{ .u32 = 0xbf7b5071 }, /* -0.9816962 */
+	{ .u32 = 0x3d80f2cc }, /* 0.0629631 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3cbe0f65 }, /* 0.0232007 */
+	{ .u32 = 0x00070002 },
+	{ .u32 = 0x80040001 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x02000001 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x3ccf40e6 }, /* 0.0252995 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf7ffff9 }, /* -0.9999996 */
+	{ .u32 = 0xbf35daca }, /* -0.7103697 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3e13f08c }, /* 0.1444723 */
+	{ .u32 = 0xbd7df48d }, /* -0.0620008 */
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x00070002 },
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x02000003 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3d921de7 }, /* 0.0713461 */
+	{ .u32 = 0xbf7131a7 }, /* -0.9421639 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3e6fd3e2 }, /* 0.2342067 */
+	{ .u32 = 0x3f780000 }, /* 0.9687500 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbef445a3 }, /* -0.4770938 */
+	{ .u32 = 0x3f4bd2c8 }, /* 0.7961850 */
+	{ .u32 = 0x00090004 },
+	{ .u32 = 0x3f02f970 }, /* 0.5116186 */
+	{ .u32 = 0x3e96043d }, /* 0.2930011 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe5f3161 }, /* -0.2179618 */
+	{ .u32 = 0x000d0008 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbf56405f }, /* -0.8369197 */
+	{ .u32 = 0x3efec765 }, /* 0.4976150 */
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x3f7a627d }, /* 0.9780653 */
+	{ .u32 = 0xbf7fb513 }, /* -0.9988567 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbead7383 }, /* -0.3387719 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbee8ee6c }, /* -0.4549440 */
+	{ .u32 = 0x3f07530a }, /* 0.5286108 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3e52c387 }, /* 0.2058240 */
+	{ .u32 = 0xbf4b5035 }, /* -0.7941926 */
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x80070004 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbe032ea4 }, /* -0.1281076 */
+	{ .u32 = 0xbcc3a5a7 }, /* -0.0238827 */
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0xbe7edadf }, /* -0.2488818 */
+	{ .u32 = 0x3f63197a }, /* 0.8871075 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x3e4b9a7c }, /* 0.1988315 */
+	{ .u32 = 0xbf100000 }, /* -0.5625000 */
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0x3ca6a693 }, /* 0.0203431 */
+	{ .u32 = 0x3ea0fd53 }, /* 0.3144327 */
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0xbe2458db }, /* -0.1604952 */
+	{ .u32 = 0x3b3862b2 }, /* 0.0028135 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3ebcfea6 }, /* 0.3691303 */
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000013 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x01010000 },
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0x3c654061 }, /* 0.0139924 */
+	{ .u32 = 0xbf700000 }, /* -0.9375000 */
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0xbf19e35e }, /* -0.6011256 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbd2a4c04 }, /* -0.0415764 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3c5a554c }, /* 0.0133260 */
+	{ .u32 = 0x3bf85af0 }, /* 0.0075792 */
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80020003 },
+	{ .u32 = 0x00000014 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3f5cd8d8 }, /* 0.8626838 */
+	{ .u32 = 0xbf30aed1 }, /* -0.6901675 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbf744085 }, /* -0.9541095 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbed66b4a }, /* -0.4187873 */
+	{ .u32 = 0x3eb48058 }, /* 0.3525417 */
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x80060008 },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbebfffba }, /* -0.3749979 */
+	{ .u32 = 0x3a573861 }, /* 0.0008210 */
+	{ .u32 = 0x000a0006 },
+	{ .u32 = 0xbea77828 }, /* -0.3270886 */
+	{ .u32 = 0xbe7781a6 }, /* -0.2417055 */
+	{ .u32 = 0x000f000d },
+	{ .u32 = 0xbf6a7c92 }, /* -0.9159633 */
+	{ .u32 = 0x3f758000 }, /* 0.9589844 */
+	{ .u32 = 0x00130011 },
+	{ .u32 = 0x3f5267aa }, /* 0.8218943 */
+	{ .u32 = 0xbf2e4763 }, /* -0.6807768 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3efa9d87 }, /* 0.4894831 */
+	{ .u32 = 0xbea7de75 }, /* -0.3278691 */
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbf4ad6a0 }, /* -0.7923374 */
+	{ .u32 = 0xbf3e6c21 }, /* -0.7438374 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3a96d671 }, /* 0.0011508 */
+	{ .u32 = 0x3e84e19d }, /* 0.2595338 */
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x80050003 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01000002 },
+	{ .u32 = 0x00060000 },
+	{ .u32 = 0x3f7b0a1f }, /* 0.9806232 */
+	{ .u32 = 0x3f1f373d }, /* 0.6219366 */
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0xbdf2905b }, /* -0.1184394 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3e86eb92 }, /* 0.2635160 */
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0x3e6741ff }, /* 0.2258377 */
+	{ .u32 = 0xbe063800 }, /* -0.1310730 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbed427be }, /* -0.4143657 */
+	{ .u32 = 0x00150010 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80030006 },
+	{ .u32 = 0x00000017 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010100 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbc95248a }, /* -0.0182059 */
+	{ .u32 = 0x3e7ee009 }, /* 0.2489015 */
+	{ .u32 = 0x000a0006 },
+	{ .u32 = 0x3ea86ba0 }, /* 0.3289461 */
+	{ .u32 = 0x3d58996f }, /* 0.0528807 */
+	{ .u32 = 0x0014000e },
+	{ .u32 = 0x3f47fecb }, /* 0.7812316 */
+	{ .u32 = 0xbd0b70fd }, /* -0.0340433 */
+	{ .u32 = 0x00070002 },
+	{ .u32 = 0xbf7ffffe }, /* -0.9999999 */
+	{ .u32 = 0xbf358436 }, /* -0.7090486 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe6e7bd8 }, /* -0.2328943 */
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x00000018 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x02000000 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3bde5662 }, /* 0.0067852 */
+	{ .u32 = 0x3b03126f }, /* 0.0020000 */
+	{ .u32 = 0x0011000a },
+	{ .u32 = 0x3c700764 }, /* 0.0146502 */
+	{ .u32 = 0x3e712543 }, /* 0.2354937 */
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x3d6c1963 }, /* 0.0576414 */
+	{ .u32 = 0x00070001 },
+	{ .u32 = 0x3d069398 }, /* 0.0328556 */
+	{ .u32 = 0xbf77c39d }, /* -0.9678286 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3bf29e18 }, /* 0.0074041 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x80010003 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01010000 },
+	{ .u32 = 0x00130004 },
+	{ .u32 = 0x3b97ec1a }, /* 0.0046363 */
+	{ .u32 = 0x3ecd8a29 }, /* 0.4014447 */
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0xbefa7c76 }, /* -0.4892308 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3b0954a8 }, /* 0.0020955 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x80020001 },
+	{ .u32 = 0x0000001a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01000103 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0xbf1e01c3 }, /* -0.6172144 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x3f780000 }, /* 0.9687500 */
+	{ .u32 = 0x3c755a1f }, /* 0.0149751 */
+	{ .u32 = 0x00120010 },
+	{ .u32 = 0x00000018 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x0000001b },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000200 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbf297370 }, /* -0.6619177 */
+	{ .u32 = 0xbf17bd87 }, /* -0.5927357 */
+	{ .u32 = 0x00170012 },
+	{ .u32 = 0x3f2fadd5 }, /* 0.6862462 */
+	{ .u32 = 0xbf41511e }, /* -0.7551440 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf150046 }, /* -0.5820354 */
+	{ .u32 = 0x3ab0c6dd }, /* 0.0013487 */
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0x3a498295 }, /* 0.0007687 */
+	{ .u32 = 0xbd740bd6 }, /* -0.0595816 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3ed6af4a }, /* 0.4193061 */
+	{ .u32 = 0x00190011 },
+	{ .u32 = 0x80070002 },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00170004 },
+	{ .u32 = 0x3976a005 }, /* 0.0002352 */
+	{ .u32 = 0xbe5a17e7 }, /* -0.2129818 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f67f103 }, /* 0.9060213 */
+	{ .u32 = 0x3bd4936b }, /* 0.0064873 */
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0xbe3324f0 }, /* -0.1749456 */
+	{ .u32 = 0x3bbb5ab5 }, /* 0.0057176 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xbe41a870 }, /* -0.1891191 */
+	{ .u32 = 0x3a8b46f0 }, /* 0.0010626 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3aa17459 }, /* 0.0012318 */
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x80060009 },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x4207f5ae }, /* 33.9899216 */
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3e3dfd0b }, /* 0.1855356 */
+	{ .u32 = 0xbe3278de }, /* -0.1742892 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbe43b682 }, /* -0.1911259 */
+	{ .u32 = 0x3f519a61 }, /* 0.8187619 */
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0x3f0e973b }, /* 0.5569951 */
+	{ .u32 = 0x3da02265 }, /* 0.0781906 */
+	{ .u32 = 0x0010000c },
+	{ .u32 = 0x3f6a99a8 }, /* 0.9164071 */
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x3f7ffffd }, /* 0.9999998 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0xbe52d073 }, /* -0.2058733 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbefd4a8a }, /* -0.4947093 */
+	{ .u32 = 0xbed6fbe7 }, /* -0.4198906 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3e8772ae }, /* 0.2645468 */
+	{ .u32 = 0xbf2b37e8 }, /* -0.6688218 */
+	{ .u32 = 0x0016000f },
+	{ .u32 = 0x001c001a },
+	{ .u32 = 0x80070007 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x3dea86e5 }, /* 0.1145151 */
+	{ .u32 = 0xbf3afb76 }, /* -0.7303995 */
+	{ .u32 = 0x0011000b },
+	{ .u32 = 0xbf2fc81b }, /* -0.6866471 */
+	{ .u32 = 0xbf6a2493 }, /* -0.9146206 */
+	{ .u32 = 0x001a0013 },
+	{ .u32 = 0x3dba8d8d }, /* 0.0910903 */
+	{ .u32 = 0x3f52645e }, /* 0.8218440 */
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x3daf04f9 }, /* 0.0854587 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf2bbfa5 }, /* -0.6708930 */
+	{ .u32 = 0xbec3e590 }, /* -0.3826108 */
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x3ec0ed4e }, /* 0.3768105 */
+	{ .u32 = 0xbe20bd7a }, /* -0.1569728 */
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0xbf102d15 }, /* -0.5631879 */
+	{ .u32 = 0xbf244b99 }, /* -0.6417785 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f349dea }, /* 0.7055346 */
+	{ .u32 = 0x00120009 },
+	{ .u32 = 0x80030004 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbd8ee35d }, /* -0.0697696 */
+	{ .u32 = 0xbf3428d8 }, /* -0.7037482 */
+	{ .u32 = 0x00090011 },
+	{ .u32 = 0xbd9e9029 }, /* -0.0774234 */
+	{ .u32 = 0x3f6b1f73 }, /* 0.9184486 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0xbf400000 }, /* -0.7500000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f359fa6 }, /* 0.7094673 */
+	{ .u32 = 0x80030003 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000200 },
+	{ .u32 = 0x0012000b },
+	{ .u32 = 0xbf0e9f37 }, /* -0.5571169 */
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0xbe9caa9a }, /* -0.3059891 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbe465b35 }, /* -0.1937073 */
+	{ .u32 = 0x3f680000 }, /* 0.9062500 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f01bd93 }, /* 0.5067989 */
+	{ .u32 = 0x001e0004 },
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0x3dc5ecfa }, /* 0.0966434 */
+	{ .u32 = 0x3e15bf77 }, /* 0.1462382 */
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0xbf322405 }, /* -0.6958621 */
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x3f04b085 }, /* 0.5183185 */
+	{ .u32 = 0x3e9606cc }, /* 0.2930206 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3d822ff1 }, /* 0.0635680 */
+	{ .u32 = 0xbe33ae91 }, /* -0.1754706 */
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x00010001 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000402 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x3f2ffffe }, /* 0.6874999 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 }, /* 0.0000000 */
+	{ .u32 = 0x001b0012 },
+	{ .u32 = 0x00110001 },
+	{ .u32 = 0x001f0014 },
+	{ .u32 = 0x80030004 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x41dfd6b8 }, /* 27.9798431 */
+	{ .u32 = 0x01000200 },
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0xbdebe7ca }, /* -0.1151882 */
+	{ .u32 = 0x3c1aef70 }, /* 0.0094565 */
+	{ .u32 = 0x001a0007 },
+	{ .u32 = 0xbf71a08a }, /* -0.9438559 */
+	{ .u32 = 0xbefdcc71 }, /* -0.4957004 */
+	{ .u32 = 0x00080001 },
+	{ .u32 = 0x3f5baeda }, /* 0.8581368 */
+	{ .u32 = 0x3d6c7615 }, /* 0.0577298 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f48482e }, /* 0.7823514 */
+	{ .u32 = 0x001d0015 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf4ad6c1 }, /* -0.7923394 */
+	{ .u32 = 0xbf3f1be0 }, /* -0.7465191 */
+	{ .u32 = 0x001d000a },
+	{ .u32 = 0xbf429d82 }, /* -0.7602159 */
+	{ .u32 = 0x3e686f3a }, /* 0.2269868 */
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0xbf37aaef }, /* -0.7174520 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0xbf69c224 }, /* -0.9131186 */
+	{ .u32 = 0x3f4681f7 }, /* 0.7754206 */
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x01000200 },
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0x3f4f6b8b }, /* 0.8102347 */
+	{ .u32 = 0xbdb88278 }, /* -0.0900926 */
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0xbd87f951 }, /* -0.0663935 */
+	{ .u32 = 0x3f7022ff }, /* 0.9380340 */
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0xbde3b13d }, /* -0.1111779 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x3f6b0369 }, /* 0.9180208 */
+	{ .u32 = 0xbf6006f6 }, /* -0.8751062 */
+	{ .u32 = 0x001c0019 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80030006 },
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x02000300 },
+	{ .u32 = 0x000a0000 },
+	{ .u32 = 0xbf5ed880 }, /* -0.8704910 */
+	{ .u32 = 0x3e89ced7 }, /* 0.2691562 */
+	{ .u32 = 0x000d000c },
+	{ .u32 = 0xbf6c3187 }, /* -0.9226307 */
+	{ .u32 = 0x3f6308a1 }, /* 0.8868504 */
+	{ .u32 = 0x0020000f },
+	{ .u32 = 0x3db15eb2 }, /* 0.0866064 */
+	{ .u32 = 0x3f6aa706 }, /* 0.9166111 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x3f2f23bd }, /* 0.6841391 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d642a16 }, /* 0.0557042 */
+	{ .u32 = 0x001d0017 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3e0dd533 }, /* 0.1385086 */
+	{ .u32 = 0xbf195905 }, /* -0.5990146 */
+	{ .u32 = 0x0011000c },
+	{ .u32 = 0xbf2c9fd6 }, /* -0.6743139 */
+	{ .u32 = 0xbe731c22 }, /* -0.2374120 */
+	{ .u32 = 0x00210016 },
+	{ .u32 = 0x3ea4cf5e }, /* 0.3218946 */
+	{ .u32 = 0x3ea2bbe9 }, /* 0.3178399 */
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x3f27df44 }, /* 0.6557505 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x3f400000 }, /* 0.7500000 */
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbdca6282 }, /* -0.0988207 */
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x01010000 },
+	{ .u32 = 0x001d0007 },
+	{ .u32 = 0xbf200000 }, /* -0.6250000 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0xbf34b1a8 }, /* -0.7058358 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbeccf48e }, /* -0.4003033 */
+	{ .u32 = 0xbf4fea55 }, /* -0.8121694 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3e624b9f }, /* 0.2209916 */
+	{ .u32 = 0x3f634953 }, /* 0.8878376 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000025 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x03000200 },
+	{ .u32 = 0x001d0017 },
+	{ .u32 = 0xbd4cf43a }, /* -0.0500376 */
+	{ .u32 = 0x3e905d2e }, /* 0.2819609 */
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x3e51c058 }, /* 0.2048353 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3cfc1590 }, /* 0.0307720 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3c5d43a8 }, /* 0.0135049 */
+	{ .u32 = 0x3d06783a }, /* 0.0328295 */
+	{ .u32 = 0x001c000e },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x80040008 },
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x02010202 },
+	{ .u32 = 0x00060001 },
+	{ .u32 = 0xbdf22e00 }, /* -0.1182518 */
+	{ .u32 = 0x3cc24016 }, /* 0.0237122 */
+	{ .u32 = 0x0018000e },
+	{ .u32 = 0x3dd6bb8b }, /* 0.1048499 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbf6527b3 }, /* -0.8951370 */
+	{ .u32 = 0x3d600707 }, /* 0.0546942 */
+	{ .u32 = 0x00240020 },
+	{ .u32 = 0x3f129342 }, /* 0.5725595 */
+	{ .u32 = 0xbf01c81c }, /* -0.5069597 */
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0xbeb00542 }, /* -0.3437901 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbd92419c }, /* -0.0714142 */
+	{ .u32 = 0x3d25dcb9 }, /* 0.0404937 */
+	{ .u32 = 0x00250013 },
+	{ .u32 = 0x0009001c },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0x80040002 },
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0x3f7bce56 }, /* 0.9836172 */
+	{ .u32 = 0xbea49951 }, /* -0.3214822 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf5f8520 }, /* -0.8731251 */
+	{ .u32 = 0x3f2df442 }, /* 0.6795083 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbf446b60 }, /* -0.7672634 */
+	{ .u32 = 0x3f0a2bb1 }, /* 0.5397292 */
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x0018000c },
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x0026001a },
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0x3f098a49 }, /* 0.5372663 */
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x3a978847 }, /* 0.0011561 */
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x00000029 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000200 },
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0xbdea4b20 }, /* -0.1144011 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x000c000b },
+	{ .u32 = 0x3e083764 }, /* 0.1330238 */
+	{ .u32 = 0x3e1f4cee }, /* 0.1555669 */
+	{ .u32 = 0x001e0016 },
+	{ .u32 = 0xbda30aba }, /* -0.0796103 */
+	{ .u32 = 0xbf5326b0 }, /* -0.8248091 */
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x3db4f7a9 }, /* 0.0883630 */
+	{ .u32 = 0x000b0000 },
+	{ .u32 = 0xbed8f682 }, /* -0.4237557 */
+	{ .u32 = 0x3f1c0bbd }, /* 0.6095541 */
+	{ .u32 = 0x00280027 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbe83953b }, /* -0.2569979 */
+	{ .u32 = 0x3b66ef8e }, /* 0.0035238 */
+	{ .u32 = 0x0022000c },
+	{ .u32 = 0xbecc6ff3 }, /* -0.3992916 */
+	{ .u32 = 0x3ecf5826 }, /* 0.4049694 */
+	{ .u32 = 0x0027001e },
+	{ .u32 = 0x3f4c960b }, /* 0.7991645 */
+	{ .u32 = 0xbf77ad44 }, /* -0.9674876 */
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0xbed3c5f6 }, /* -0.4136197 */
+	{ .u32 = 0x3c4fac10 }, /* 0.0126753 */
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x00010002 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000500 },
+	{ .u32 = 0x0029000a },
+	{ .u32 = 0x3f420000 }, /* 0.7578125 */
+	{ .u32 = 0x3f37fffe }, /* 0.7187499 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3ed00b21 }, /* 0.4063349 */
+	{ .u32 = 0x00090004 },
+	{ .u32 = 0x0011001e },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x80020002 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000200 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0x3f5fbc7a }, /* 0.8739697 */
+	{ .u32 = 0xbf1873ad }, /* -0.5955151 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0xbea2fb06 }, /* -0.3183214 */
+	{ .u32 = 0xbec4d49d }, /* -0.3844346 */
+	{ .u32 = 0x0019000d },
+	{ .u32 = 0x80060005 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x01000301 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbd4fb184 }, /* -0.0507064 */
+	{ .u32 = 0xbe86f56a }, /* -0.2635911 */
+	{ .u32 = 0x0017000c },
+	{ .u32 = 0x3e279406 }, /* 0.1636506 */
+	{ .u32 = 0xbf7fffd9 }, /* -0.9999977 */
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0xbf200000 }, /* -0.6250000 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbf49cf1b }, /* -0.7883164 */
+	{ .u32 = 0x3f5692a5 }, /* 0.8381751 */
+	{ .u32 = 0x00090005 },
+	{ .u32 = 0xbeed6840 }, /* -0.4636860 */
+	{ .u32 = 0x3f2de95b }, /* 0.6793420 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3e2c113c }, /* 0.1680345 */
+	{ .u32 = 0xbe30a43c }, /* -0.1725015 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x00190013 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80030000 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00010001 },
+	{ .u32 = 0x000a0000 },
+	{ .u32 = 0xbf5bb522 }, /* -0.8582326 */
+	{ .u32 = 0xbf31f03a }, /* -0.6950718 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3bc0a9a9 }, /* 0.0058796 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x000c0000 },
+	{ .u32 = 0xbea60f7c }, /* -0.3243369 */
+	{ .u32 = 0xbe6fcfdf }, /* -0.2341914 */
+	{ .u32 = 0x0013000f },
+	{ .u32 = 0x3e98cdc5 }, /* 0.2984449 */
+	{ .u32 = 0xbe6e77ad }, /* -0.2328784 */
+	{ .u32 = 0x00000025 },
+	{ .u32 = 0xbe81c6e9 }, /* -0.2534707 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbdcd2590 }, /* -0.1001693 */
+	{ .u32 = 0x3c253975 }, /* 0.0100845 */
+	{ .u32 = 0x002a0019 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x0000002c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x0019000f },
+	{ .u32 = 0xbe68fece }, /* -0.2275345 */
+	{ .u32 = 0xbf7ff2ac }, /* -0.9997966 */
+	{ .u32 = 0x001e001c },
+	{ .u32 = 0x3f4fc9d7 }, /* 0.8116736 */
+	{ .u32 = 0x3cd61870 }, /* 0.0261347 */
+	{ .u32 = 0x0028002a },
+	{ .u32 = 0xbe91d46d }, /* -0.2848238 */
+	{ .u32 = 0xbf64346e }, /* -0.8914250 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3f5cfa18 }, /* 0.8631911 */
+	{ .u32 = 0x3bd9aa2b }, /* 0.0066426 */
+	{ .u32 = 0x00000013 },
+	{ .u32 = 0x80050006 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x00190017 },
+	{ .u32 = 0x3ea092f9 }, /* 0.3136213 */
+	{ .u32 = 0x3f6f460c }, /* 0.9346626 */
+	{ .u32 = 0x0025001d },
+	{ .u32 = 0xbed5d2f2 }, /* -0.4176250 */
+	{ .u32 = 0xbf2917d0 }, /* -0.6605196 */
+	{ .u32 = 0x00290028 },
+	{ .u32 = 0xbf7f78a6 }, /* -0.9979347 */
+	{ .u32 = 0xbdccbe1f }, /* -0.0999720 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f418b3f }, /* 0.7560310 */
+	{ .u32 = 0x3da85f3d }, /* 0.0822129 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xbecc4b40 }, /* -0.3990116 */
+	{ .u32 = 0x3c8a5d51 }, /* 0.0168902 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d04b9d9 }, /* 0.0324038 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x00000013 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010100 },
+	{ .u32 = 0x000e0005 },
+	{ .u32 = 0x3a1712d7 }, /* 0.0005763 */
+	{ .u32 = 0xbd937db4 }, /* -0.0720171 */
+	{ .u32 = 0x00250017 },
+	{ .u32 = 0xbf42f23e }, /* -0.7615088 */
+	{ .u32 = 0xbf641bcb }, /* -0.8910491 */
+	{ .u32 = 0x002d0029 },
+	{ .u32 = 0x3f43b1d4 }, /* 0.7644322 */
+	{ .u32 = 0x3e909291 }, /* 0.2823682 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0x3b241370 }, /* 0.0025036 */
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80030008 },
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbe575bcb }, /* -0.2103111 */
+	{ .u32 = 0xbf5a8ae1 }, /* -0.8536816 */
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x3f03590a }, /* 0.5130774 */
+	{ .u32 = 0x3deaf46b }, /* 0.1147240 */
+	{ .u32 = 0x001f0026 },
+	{ .u32 = 0xbf45bfff }, /* -0.7724609 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x0028002a },
+	{ .u32 = 0x3dfcfd9c }, /* 0.1235306 */
+	{ .u32 = 0xbf49a490 }, /* -0.7876673 */
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0xbef9dcef }, /* -0.4880137 */
+	{ .u32 = 0x3d458cb7 }, /* 0.0482299 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3bbafa3c }, /* 0.0057061 */
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x80030006 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01000102 },
+	{ .u32 = 0x001c000c },
+	{ .u32 = 0xbe4e5160 }, /* -0.2014823 */
+	{ .u32 = 0xbe822637 }, /* -0.2541978 */
+	{ .u32 = 0x0026001d },
+	{ .u32 = 0xbf1801bd }, /* -0.5937765 */
+	{ .u32 = 0xbecda442 }, /* -0.4016438 */
+	{ .u32 = 0x002b002a },
+	{ .u32 = 0x3f3ab244 }, /* 0.7292826 */
+	{ .u32 = 0x3f63aafd }, /* 0.8893278 */
+	{ .u32 = 0x000a0001 },
+	{ .u32 = 0xbd9f2064 }, /* -0.0776985 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3c907747 }, /* 0.0176350 */
+	{ .u32 = 0x00230018 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01010002 },
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0x3bdf322a }, /* 0.0068114 */
+	{ .u32 = 0xbf00c835 }, /* -0.5030549 */
+	{ .u32 = 0x000a0019 },
+	{ .u32 = 0x3f400000 }, /* 0.7500000 */
+	{ .u32 = 0xbecd20b0 }, /* -0.4006400 */
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0xbf61aa09 }, /* -0.8815008 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3f4a9d9d }, /* 0.7914675 */
+	{ .u32 = 0x3c204ca7 }, /* 0.0097839 */
+	{ .u32 = 0x0030002a },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x80030004 },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01000001 },
+	{ .u32 = 0x000e0006 },
+	{ .u32 = 0x3e8cd6c3 }, /* 0.2750760 */
+	{ .u32 = 0xbe8a33fd }, /* -0.2699279 */
+	{ .u32 = 0x002a001c },
+	{ .u32 = 0x3ec00000 }, /* 0.3750000 */
+	{ .u32 = 0x3f14b140 }, /* 0.5808296 */
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0xbe7d61c7 }, /* -0.2474433 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3a2dcd2d }, /* 0.0006630 */
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000033 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0x3c313024 }, /* 0.0108147 */
+	{ .u32 = 0xbee3283e }, /* -0.4436664 */
+	{ .u32 = 0x002a0019 },
+	{ .u32 = 0x3d61862d }, /* 0.0550596 */
+	{ .u32 = 0x3b2d0c3d }, /* 0.0026405 */
+	{ .u32 = 0x0030002c },
+	{ .u32 = 0xbf7601ac }, /* -0.9609630 */
+	{ .u32 = 0x3f7f8000 }, /* 0.9980469 */
+	{ .u32 = 0x000b0005 },
+	{ .u32 = 0x39ed8e0d }, /* 0.0004531 */
+	{ .u32 = 0x3ad92c57 }, /* 0.0016569 */
+	{ .u32 = 0x00010003 },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000405 },
+	{ .u32 = 0x00210006 },
+	{ .u32 = 0xbf2bb94e }, /* -0.6707963 */
+	{ .u32 = 0xbf37118f }, /* -0.7151117 */
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e33ee7a }, /* 0.1757144 */
+	{ .u32 = 0x00300020 },
+	{ .u32 = 0x00320031 },
+	{ .u32 = 0x00000033 },
+	{ .u32 = 0x001d000c },
+	{ .u32 = 0x002f0024 },
+	{ .u32 = 0x80050001 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x01000000 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x3f2064dc }, /* 0.6265390 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x3e9ac468 }, /* 0.3022797 */
+	{ .u32 = 0x3ee00000 }, /* 0.4375000 */
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0x3f66b0ac }, /* 0.9011333 */
+	{ .u32 = 0x3f1a5c2f }, /* 0.6029691 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbf700000 }, /* -0.9375000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80040002 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x002f002a },
+	{ .u32 = 0x3ea00000 }, /* 0.3125000 */
+	{ .u32 = 0xbe9ca3d0 }, /* -0.3059373 */
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0x3eaf480a }, /* 0.3423465 */
+	{ .u32 = 0xbd368c84 }, /* -0.0445676 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3a97310a }, /* 0.0011535 */
+	{ .u32 = 0x3b6e0be2 }, /* 0.0036323 */
+	{ .u32 = 0x0030002e },
+	{ .u32 = 0x80040008 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x02000100 },
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xbdd82d96 }, /* -0.1055557 */
+	{ .u32 = 0xbed3c570 }, /* -0.4136157 */
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x3f0c4229 }, /* 0.5478845 */
+	{ .u32 = 0xbeccdf08 }, /* -0.4001391 */
+	{ .u32 = 0x002b0011 },
+	{ .u32 = 0x3d807bfe }, /* 0.0627365 */
+	{ .u32 = 0xbe99d3ed }, /* -0.3004450 */
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0xbda640dc }, /* -0.0811784 */
+	{ .u32 = 0xbe079450 }, /* -0.1324017 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f680000 }, /* 0.9062500 */
+	{ .u32 = 0x3c2cb494 }, /* 0.0105411 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3d51d8a5 }, /* 0.0512320 */
+	{ .u32 = 0xbc8c084c }, /* -0.0170938 */
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0x80020003 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x002f000c },
+	{ .u32 = 0xbd41c369 }, /* -0.0473055 */
+	{ .u32 = 0xbf2c0943 }, /* -0.6720163 */
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x3f0e62b2 }, /* 0.5561935 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x3d2a4f44 }, /* 0.0415795 */
+	{ .u32 = 0x3b12684d }, /* 0.0022340 */
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0x3bcd4167 }, /* 0.0062639 */
+	{ .u32 = 0xbf6bd272 }, /* -0.9211799 */
+	{ .u32 = 0x00180015 },
+	{ .u32 = 0xbf20c723 }, /* -0.6280386 */
+	{ .u32 = 0xbf078437 }, /* -0.5293612 */
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0xbf064838 }, /* -0.5245395 */
+	{ .u32 = 0x3ea4b43d }, /* 0.3216876 */
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x3ef022fc }, /* 0.4690169 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3e2e3737 }, /* 0.1701325 */
+	{ .u32 = 0x3b58086a }, /* 0.0032964 */
+	{ .u32 = 0x00010004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00000805 },
+	{ .u32 = 0x0021000a },
+	{ .u32 = 0x3f7ffff6 }, /* 0.9999994 */
+	{ .u32 = 0xbf200000 }, /* -0.6250000 */
+	{ .u32 = 0x0011001f },
+	{ .u32 = 0x3f354d16 }, /* 0.7082075 */
+	{ .u32 = 0x3f60c681 }, /* 0.8780289 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 }, /* 0.0000000 */
+	{ .u32 = 0x000f0008 },
+	{ .u32 = 0x00150010 },
+	{ .u32 = 0x0000002c },
+	{ .u32 = 0x000e0000 },
+	{ .u32 = 0x00230013 },
+	{ .u32 = 0x0022002b },
+	{ .u32 = 0x000c002a },
+	{ .u32 = 0x80030002 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01010100 },
+	{ .u32 = 0x00200004 },
+	{ .u32 = 0x3f46f937 }, /* 0.7772402 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3d4d5a76 }, /* 0.0501351 */
+	{ .u32 = 0xbf3fe8fe }, /* -0.7496489 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe78fc0d }, /* -0.2431490 */
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x80010003 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x01000001 },
+	{ .u32 = 0x00170008 },
+	{ .u32 = 0x3e611a04 }, /* 0.2198258 */
+	{ .u32 = 0xbcc73c6a }, /* -0.0243208 */
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0xbf215146 }, /* -0.6301464 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3be4f5b8 }, /* 0.0069873 */
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80030008 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x000e000d },
+	{ .u32 = 0xbf4d1745 }, /* -0.8011363 */
+	{ .u32 = 0xbe58f05c }, /* -0.2118544 */
+	{ .u32 = 0x001e0017 },
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0x3dfdeaf5 }, /* 0.1239833 */
+	{ .u32 = 0x002d0029 },
+	{ .u32 = 0x3e10408a }, /* 0.1408712 */
+	{ .u32 = 0x3f555463 }, /* 0.8333189 */
+	{ .u32 = 0x00110008 },
+	{ .u32 = 0x3e977aa6 }, /* 0.2958576 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x3f2fe4be }, /* 0.6870841 */
+	{ .u32 = 0xbf780000 }, /* -0.9687500 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3c32e459 }, /* 0.0109187 */
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x00010005 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000705 },
+	{ .u32 = 0x00160007 },
+	{ .u32 = 0x3ed3ebc7 }, /* 0.4139082 */
+	{ .u32 = 0xbf67fffe }, /* -0.9062499 */
+	{ .u32 = 0x00180017 },
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0xbf7a92f4 }, /* -0.9788048 */
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x3effffba }, /* 0.4999979 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbec116d4 }, /* -0.3771273 */
+	{ .u32 = 0x0027001c },
+	{ .u32 = 0x002e002d },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x001a000d },
+	{ .u32 = 0x00260025 },
+	{ .u32 = 0x00280004 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x420f3fca }, /* 35.8122940 */
+	{ .u32 = 0x00000103 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf7fffc4 }, /* -0.9999964 */
+	{ .u32 = 0x3ec5d29e }, /* 0.3863725 */
+	{ .u32 = 0x00140005 },
+	{ .u32 = 0x3eaf2d61 }, /* 0.3421431 */
+	{ .u32 = 0x3f376452 }, /* 0.7163745 */
+	{ .u32 = 0x0024001c },
+	{ .u32 = 0x3f420057 }, /* 0.7578177 */
+	{ .u32 = 0xbe26f2ef }, /* -0.1630361 */
+	{ .u32 = 0x00000029 },
+	{ .u32 = 0xbf0a2974 }, /* -0.5396950 */
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbe800025 }, /* -0.2500011 */
+	{ .u32 = 0xbee5ccfe }, /* -0.4488296 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbeaf0c7b }, /* -0.3418921 */
+	{ .u32 = 0xbf67fb79 }, /* -0.9061809 */
+	{ .u32 = 0x00150007 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x80030006 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000101 },
+	{ .u32 = 0x00140000 },
+	{ .u32 = 0x3ee76c59 }, /* 0.4519985 */
+	{ .u32 = 0xbf5f07bd }, /* -0.8712118 */
+	{ .u32 = 0x00250016 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0xbf795e7b }, /* -0.9740979 */
+	{ .u32 = 0x002d0026 },
+	{ .u32 = 0xbf7124d6 }, /* -0.9419683 */
+	{ .u32 = 0x3f5f856e }, /* 0.8731297 */
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0x3f6eca8d }, /* 0.9327782 */
+	{ .u32 = 0x3e6485a7 }, /* 0.2231661 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbec0ba52 }, /* -0.3764215 */
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x00000029 },
+	{ .u32 = 0x8005000a },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3b316491 }, /* 0.0027068 */
+	{ .u32 = 0xbef0bb2c }, /* -0.4701780 */
+	{ .u32 = 0x000d0006 },
+	{ .u32 = 0xbc39e569 }, /* -0.0113462 */
+	{ .u32 = 0xbf47152f }, /* -0.7776670 */
+	{ .u32 = 0x0025000f },
+	{ .u32 = 0xbf5e2000 }, /* -0.8676758 */
+	{ .u32 = 0x3ec0ba69 }, /* 0.3764222 */
+	{ .u32 = 0x002d0029 },
+	{ .u32 = 0x3f10512c }, /* 0.5637386 */
+	{ .u32 = 0xbf7a0000 }, /* -0.9765625 */
+	{ .u32 = 0x00320008 },
+	{ .u32 = 0x3ec67a9c }, /* 0.3876542 */
+	{ .u32 = 0xbd0ad271 }, /* -0.0338921 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf3be1aa }, /* -0.7339121 */
+	{ .u32 = 0x3d9f488d }, /* 0.0777751 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3d2b71d4 }, /* 0.0418566 */
+	{ .u32 = 0xbe143b35 }, /* -0.1447571 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d98e0e5 }, /* 0.0746477 */
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x80020001 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000102 },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x3f213743 }, /* 0.6297495 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3f7abcde }, /* 0.9794444 */
+	{ .u32 = 0x3f007c56 }, /* 0.5018972 */
+	{ .u32 = 0x0032002e },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x80020002 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000100 },
+	{ .u32 = 0x0032000f },
+	{ .u32 = 0x3f71e521 }, /* 0.9449025 */
+	{ .u32 = 0x3f4e92f4 }, /* 0.8069298 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xbed45ecb }, /* -0.4147857 */
+	{ .u32 = 0x3a9be249 }, /* 0.0011893 */
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x8003000a },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000102 },
+	{ .u32 = 0x000f0006 },
+	{ .u32 = 0xbf78dd7c }, /* -0.9721296 */
+	{ .u32 = 0x3f267ca0 }, /* 0.6503391 */
+	{ .u32 = 0x001b0017 },
+	{ .u32 = 0x3f558466 }, /* 0.8340515 */
+	{ .u32 = 0x3f7e0000 }, /* 0.9921875 */
+	{ .u32 = 0x00240020 },
+	{ .u32 = 0xbee3becb }, /* -0.4448150 */
+	{ .u32 = 0x3f5eb60a }, /* 0.8699652 */
+	{ .u32 = 0x002e0029 },
+	{ .u32 = 0xbec60dc2 }, /* -0.3868237 */
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0x00220032 },
+	{ .u32 = 0x3eb3ade6 }, /* 0.3509361 */
+	{ .u32 = 0x3f75b404 }, /* 0.9597781 */
+	{ .u32 = 0x00090001 },
+	{ .u32 = 0xbf21bed0 }, /* -0.6318178 */
+	{ .u32 = 0xbe50c946 }, /* -0.2038928 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe9f8bd5 }, /* -0.3116137 */
+	{ .u32 = 0x00150007 },
+	{ .u32 = 0x00000014 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x000f0000 },
+	{ .u32 = 0x3e9057e6 }, /* 0.2819206 */
+	{ .u32 = 0xbf429a01 }, /* -0.7601624 */
+	{ .u32 = 0x00140013 },
+	{ .u32 = 0x3ea794c5 }, /* 0.3273069 */
+	{ .u32 = 0xbdbeace4 }, /* -0.0931032 */
+	{ .u32 = 0x000c0015 },
+	{ .u32 = 0x3f1fc449 }, /* 0.6240888 */
+	{ .u32 = 0xbd9df663 }, /* -0.0771301 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbe997717 }, /* -0.2997367 */
+	{ .u32 = 0x3cf993a0 }, /* 0.0304659 */
+	{ .u32 = 0x00010003 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000501 },
+	{ .u32 = 0x00080005 },
+	{ .u32 = 0xbefb4224 }, /* -0.4907390 */
+	{ .u32 = 0x3f7c0000 }, /* 0.9843750 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x3eae0002 }, /* 0.3398438 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e52e3c5 }, /* 0.2059470 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x000e000b },
+	{ .u32 = 0x00020010 },
+	{ .u32 = 0x00000006 },
+};
+#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_BF16)
+/** Packed neuron records with bf16 weights, 4496 bytes, largest weight error 0.0019531 */
+static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {
+	{ .u32 = 0x80060000 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3dd2be36 },
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x0000bf00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf803f00 },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0x3f00bf80 },
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0x3f00bf80 },
+	{ .u32 = 0x80010001 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003f3a },
+	{ .u32 = 0x80010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbf503f60 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003e80 },
+	{ .u32 = 0x00010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003e66 },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f3abf7c },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f533ec1 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf003f00 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3e423ee2 },
+	{ .u32 = 0x80080004 },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3e593f46 },
+	{ .u32 = 0x00020004 },
+	{ .u32 = 0xbf20beca },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0x3e973f80 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x3f50bf80 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3eb13dcf },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbeab3f06 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f543f00 },
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0xbea0bf00 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3ef5bf80 },
+	{ .u32 = 0x80050001 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x0000bea5 },
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0x3d03bda1 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003f69 },
+	{ .u32 = 0x80080005 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x41e13cc9 }, /* 28.1546803 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbe5dbf66 },
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0xbdf63d29 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x0000bc67 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbddbbf80 },
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf80be69 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3e60bdcb },
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x3e9cbf80 },
+	{ .u32 = 0x00060002 },
+	{ .u32 = 0xbbcf3f80 },
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0xbf80bf00 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3e573c82 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000bf52 },
+	{ .u32 = 0x80060004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbef1bf43 },
+	{ .u32 = 0x00090005 },
+	{ .u32 = 0xbf803e69 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f323ef7 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf4b3c8f },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbe023f69 },
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x41e0325a }, /* 28.0245857 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf62be6c },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3f08bf80 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x0000bf00 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x3ed7bf51 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3ddc3e34 },
+	{ .u32 = 0x80050005 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x41bcbca4 }, /* 23.5921097 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbf7a3f80 },
+	{ .u32 = 0x00060005 },
+	{ .u32 = 0xbe91bc71 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x00003f14 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbf80bf52 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbef5bf23 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003f3b },
+	{ .u32 = 0x80050002 },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00080000 },
+	{ .u32 = 0x3f40bf80 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003cfa },
+	{ .u32 = 0x80070003 },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3d81be9a },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x0000bf76 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3f80bd61 },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xbf7b3f20 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3d813f80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003cbe },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00080001 },
+	{ .u32 = 0x3f803ccf },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf80bf36 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbd7e3e14 },
+	{ .u32 = 0x80070007 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf713d92 },
+	{ .u32 = 0x00080004 },
+	{ .u32 = 0x3f803e70 },
+	{ .u32 = 0x000d000a },
+	{ .u32 = 0x3f803f78 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f4cbef4 },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0x3f03bf80 },
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0x3e96bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000be5f },
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0x3effbf56 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0xbf803f7a },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xbead3f80 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f07bee9 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbf4b3e53 },
+	{ .u32 = 0x80070005 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbcc4be03 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x3f63be7f },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf103e4c },
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0x3ea13ca7 },
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0x3b38be24 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003ebd },
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000013 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbf703c65 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x0000bf1a },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3f00bd2a },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3bf83c5a },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000014 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf313f5d },
+	{ .u32 = 0x0011000b },
+	{ .u32 = 0x3f80bf74 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3eb5bed6 },
+	{ .u32 = 0x8006000a },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x3a57bec0 },
+	{ .u32 = 0x00080006 },
+	{ .u32 = 0x3f80bea7 },
+	{ .u32 = 0x000c000a },
+	{ .u32 = 0xbf80be78 },
+	{ .u32 = 0x000f000d },
+	{ .u32 = 0x3f76bf6a },
+	{ .u32 = 0x00130011 },
+	{ .u32 = 0xbf2e3f52 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbea83efb },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbf3ebf4b },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3e853a97 },
+	{ .u32 = 0x80060005 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060000 },
+	{ .u32 = 0x3f1f3f7b },
+	{ .u32 = 0x0010000e },
+	{ .u32 = 0x3f80bdf3 },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3e87bf80 },
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x3e673f80 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbed4be06 },
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000017 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3e7fbc95 },
+	{ .u32 = 0x000a0006 },
+	{ .u32 = 0x3d593ea8 },
+	{ .u32 = 0x0014000e },
+	{ .u32 = 0xbd0b3f48 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xbe6ebf36 },
+	{ .u32 = 0x80050005 },
+	{ .u32 = 0x00000018 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3b033bde },
+	{ .u32 = 0x0011000a },
+	{ .u32 = 0x3e713c70 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x00003d6c },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3d07bf80 },
+	{ .u32 = 0x00070002 },
+	{ .u32 = 0xbf78bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003bf3 },
+	{ .u32 = 0x80030003 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00130004 },
+	{ .u32 = 0x3ece3b98 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x0000befa },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003b09 },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00100006 },
+	{ .u32 = 0x3f80bf1e },
+	{ .u32 = 0x00180012 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f78bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003c75 },
+	{ .u32 = 0x80050006 },
+	{ .u32 = 0x0000001b },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbf18bf29 },
+	{ .u32 = 0x00120011 },
+	{ .u32 = 0x3f30bf80 },
+	{ .u32 = 0x00190017 },
+	{ .u32 = 0xbf80bf41 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3ab1bf15 },
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0xbd743a4a },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003ed7 },
+	{ .u32 = 0x80070003 },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170004 },
+	{ .u32 = 0xbe5a3977 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3bd53f68 },
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0x3bbbbe33 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3a8bbe42 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003aa1 },
+	{ .u32 = 0x8006000d },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x4207f5ae }, /* 33.9899216 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbe323e3e },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0x3f52be44 },
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0x3da03f0f },
+	{ .u32 = 0x000f000c },
+	{ .u32 = 0x3f803f6b },
+	{ .u32 = 0x00150010 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x001a0016 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbe53bf00 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbed7befd },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbf2b3e87 },
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf3b3deb },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbf303f80 },
+	{ .u32 = 0x00120011 },
+	{ .u32 = 0x3f80bf6a },
+	{ .u32 = 0x001a0013 },
+	{ .u32 = 0x3f523dbb },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x00003daf },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbec4bf2c },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0xbe213ec1 },
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0xbf24bf10 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003f35 },
+	{ .u32 = 0x80030004 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf34bd8f },
+	{ .u32 = 0x00090011 },
+	{ .u32 = 0x3f6bbd9f },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf40bf60 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003f36 },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbf0fbf80 },
+	{ .u32 = 0x001d0012 },
+	{ .u32 = 0xbe9d3f60 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f68be46 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003f02 },
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0x3e163dc6 },
+	{ .u32 = 0x001f0011 },
+	{ .u32 = 0xbf80bf32 },
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x3e963f05 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbe343d82 },
+	{ .u32 = 0x00010007 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00110001 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00140012 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x001f001b },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x00003f30 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x41dfd6b8 }, /* 27.9798431 */
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0x3c1bbdec },
+	{ .u32 = 0x00150007 },
+	{ .u32 = 0xbf80bf72 },
+	{ .u32 = 0x001d001a },
+	{ .u32 = 0xbf80befe },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f5cbf80 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3f483d6c },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf3fbf4b },
+	{ .u32 = 0x001c000a },
+	{ .u32 = 0x3f80bf43 },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0xbf383e68 },
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x3f47bf6a },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0xbdb93f4f },
+	{ .u32 = 0x001c0019 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0x3f70bd88 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x0000bde4 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f6bbf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000bf60 },
+	{ .u32 = 0x80050009 },
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000a0000 },
+	{ .u32 = 0x3e8abf5f },
+	{ .u32 = 0x000d000c },
+	{ .u32 = 0x3f63bf6c },
+	{ .u32 = 0x0017000f },
+	{ .u32 = 0xbf803db1 },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0x3f6bbf80 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3f2f3f00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003d64 },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xbf193e0e },
+	{ .u32 = 0x0011000c },
+	{ .u32 = 0xbe73bf2d },
+	{ .u32 = 0x00210016 },
+	{ .u32 = 0x3ea33ea5 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x00003f28 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbf603f40 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000bdca },
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x001d0007 },
+	{ .u32 = 0xbf00bf20 },
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x0000bf35 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbf50becd },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3f633e62 },
+	{ .u32 = 0x80070005 },
+	{ .u32 = 0x00000025 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0017000e },
+	{ .u32 = 0xbd4dbf80 },
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0x3e90bf80 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x00003e52 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0x3cfcbf80 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3c5d3f00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003d06 },
+	{ .u32 = 0x8007000c },
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060001 },
+	{ .u32 = 0x3cc2bdf2 },
+	{ .u32 = 0x0013000e },
+	{ .u32 = 0x3f803dd7 },
+	{ .u32 = 0x00190018 },
+	{ .u32 = 0xbf653f00 },
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0x3d60bf80 },
+	{ .u32 = 0x00090020 },
+	{ .u32 = 0xbf803f13 },
+	{ .u32 = 0x00250024 },
+	{ .u32 = 0x3f80bf02 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f00bf80 },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xbeb0bf80 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xbd923f80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003d26 },
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00190004 },
+	{ .u32 = 0x3f7cbf80 },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x0000bea5 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f2ebf60 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3f0abf44 },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0018000c },
+	{ .u32 = 0x3f00bf60 },
+	{ .u32 = 0x001a0019 },
+	{ .u32 = 0x3f60bf80 },
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x00003f0a },
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0x3a98bf00 },
+	{ .u32 = 0x80020009 },
+	{ .u32 = 0x00000029 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0xbf00bdea },
+	{ .u32 = 0x000c000b },
+	{ .u32 = 0x3e1f3e08 },
+	{ .u32 = 0x001e0016 },
+	{ .u32 = 0xbf53bda3 },
+	{ .u32 = 0x0027001f },
+	{ .u32 = 0xbf803db5 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x000b0000 },
+	{ .u32 = 0x3f1cbed9 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3b67be84 },
+	{ .u32 = 0x0022000c },
+	{ .u32 = 0x3ecfbecc },
+	{ .u32 = 0x001f001e },
+	{ .u32 = 0xbf803f4d },
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0x0000bf78 },
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0x3c50bed4 },
+	{ .u32 = 0x00010007 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3f42bf80 },
+	{ .u32 = 0x001e0009 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00290011 },
+	{ .u32 = 0x3f38bf80 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003ed0 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbf183f60 },
+	{ .u32 = 0x0019000d },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0xbec5bea3 },
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbd503f80 },
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0x3e28be87 },
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbf20bf80 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf4abf80 },
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0xbeed3f57 },
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0x3e2c3f2e },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000be31 },
+	{ .u32 = 0x80040001 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x3f80bf5c },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3bc1bf32 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0000 },
+	{ .u32 = 0xbe70bea6 },
+	{ .u32 = 0x0013000f },
+	{ .u32 = 0xbe6e3e99 },
+	{ .u32 = 0x00250019 },
+	{ .u32 = 0xbe823f80 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3c25bdcd },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0013000f },
+	{ .u32 = 0xbf80be69 },
+	{ .u32 = 0x001c0019 },
+	{ .u32 = 0x3f50bf80 },
+	{ .u32 = 0x002a001e },
+	{ .u32 = 0xbe923cd6 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x0000bf64 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3bda3f5d },
+	{ .u32 = 0x80050008 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0x3ea1bf80 },
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbed63f6f },
+	{ .u32 = 0x00250023 },
+	{ .u32 = 0xbf293f80 },
+	{ .u32 = 0x00290028 },
+	{ .u32 = 0xbdcdbf7f },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3da83f42 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3c8abecc },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003d05 },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e0005 },
+	{ .u32 = 0xbd933a17 },
+	{ .u32 = 0x00250017 },
+	{ .u32 = 0xbf64bf43 },
+	{ .u32 = 0x00290028 },
+	{ .u32 = 0x3f44bf80 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x00003e91 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbf603f80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003b24 },
+	{ .u32 = 0x80030009 },
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbf5bbe57 },
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x3deb3f03 },
+	{ .u32 = 0x001f0026 },
+	{ .u32 = 0x3f00bf46 },
+	{ .u32 = 0x0028002a },
+	{ .u32 = 0xbf4a3dfd },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x3d46befa },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003bbb },
+	{ .u32 = 0x80040009 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0018000c },
+	{ .u32 = 0x3f80be4e },
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0xbf18be82 },
+	{ .u32 = 0x00230022 },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x002a0026 },
+	{ .u32 = 0x3f3bbece },
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x00003f64 },
+	{ .u32 = 0x00070001 },
+	{ .u32 = 0xbf80bd9f },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3c90bf00 },
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0xbf013bdf },
+	{ .u32 = 0x000a0019 },
+	{ .u32 = 0xbecd3f40 },
+	{ .u32 = 0x002f002a },
+	{ .u32 = 0xbf623f80 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3c203f4b },
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e0006 },
+	{ .u32 = 0xbe8a3e8d },
+	{ .u32 = 0x002a001c },
+	{ .u32 = 0x3f153ec0 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00050000 },
+	{ .u32 = 0xbe7dbf80 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3a2e3f00 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000033 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0xbee33c31 },
+	{ .u32 = 0x002a0019 },
+	{ .u32 = 0x3b2d3d62 },
+	{ .u32 = 0x0030002c },
+	{ .u32 = 0x3f80bf76 },
+	{ .u32 = 0x000b0005 },
+	{ .u32 = 0x3ad939ee },
+	{ .u32 = 0x0001000c },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbf80bf2c },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x00220021 },
+	{ .u32 = 0x3f00bf37 },
+	{ .u32 = 0x002f0024 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00310030 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x00330032 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003e34 },
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x00003f20 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3e9bbf80 },
+	{ .u32 = 0x00090004 },
+	{ .u32 = 0x3f673ee0 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xbf703f1a },
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x002e002a },
+	{ .u32 = 0x3f803ea0 },
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0x3f80be9d },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xbd373eaf },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3b6e3a97 },
+	{ .u32 = 0x80060009 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xbed4bdd8 },
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0xbecd3f0c },
+	{ .u32 = 0x002b0011 },
+	{ .u32 = 0xbe9a3d80 },
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0xbe08bda6 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3c2d3f68 },
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbc8c3d52 },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0015000c },
+	{ .u32 = 0xbf80bd42 },
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0x3f80bf2c },
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x00003f0e },
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x3b123d2a },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbf6c3bcd },
+	{ .u32 = 0x00180015 },
+	{ .u32 = 0xbf08bf21 },
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x3ea5bf06 },
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x00003ef0 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3b583e2e },
+	{ .u32 = 0x00010011 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00080000 },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x000f000e },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x00130010 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x000a0015 },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x00210023 },
+	{ .u32 = 0xbf20bf80 },
+	{ .u32 = 0x002b001f },
+	{ .u32 = 0xbf803f35 },
+	{ .u32 = 0x0022002c },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x002a0011 },
+	{ .u32 = 0xbf803f61 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80050003 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00200004 },
+	{ .u32 = 0x3f003f47 },
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x0000bf80 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xbf403d4d },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000be79 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170008 },
+	{ .u32 = 0xbcc73e61 },
+	{ .u32 = 0x00280019 },
+	{ .u32 = 0x3f80bf21 },
+	{ .u32 = 0x000b0000 },
+	{ .u32 = 0x3be5bf80 },
+	{ .u32 = 0x8003000a },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e000d },
+	{ .u32 = 0xbe59bf4d },
+	{ .u32 = 0x00200017 },
+	{ .u32 = 0xbf80bf60 },
+	{ .u32 = 0x0029001e },
+	{ .u32 = 0x3e103dfe },
+	{ .u32 = 0x0008002d },
+	{ .u32 = 0x3e973f55 },
+	{ .u32 = 0x00110022 },
+	{ .u32 = 0xbf003f80 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbf783f30 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003c33 },
+	{ .u32 = 0x00010011 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000d0007 },
+	{ .u32 = 0xbf803ed4 },
+	{ .u32 = 0x00170016 },
+	{ .u32 = 0x3f60bf68 },
+	{ .u32 = 0x00190018 },
+	{ .u32 = 0x3f00bf7b },
+	{ .u32 = 0x001c001a },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x00260025 },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00270004 },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x002d0028 },
+	{ .u32 = 0x3f80bf80 },
+	{ .u32 = 0x0008002e },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000bec1 },
+	{ .u32 = 0x8004000b },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x420f3fca }, /* 35.8122940 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3ec6bf80 },
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0x3f803eaf },
+	{ .u32 = 0x00150014 },
+	{ .u32 = 0x3f803f37 },
+	{ .u32 = 0x0020001c },
+	{ .u32 = 0xbf803f42 },
+	{ .u32 = 0x00290024 },
+	{ .u32 = 0xbf0abe27 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x00003f80 },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbee6be80 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbf68beaf },
+	{ .u32 = 0x80030008 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00140000 },
+	{ .u32 = 0xbf5f3ee7 },
+	{ .u32 = 0x00250016 },
+	{ .u32 = 0xbf79bf00 },
+	{ .u32 = 0x00280026 },
+	{ .u32 = 0x3f80bf71 },
+	{ .u32 = 0x002d0029 },
+	{ .u32 = 0x3f60bf80 },
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0x3e653f6f },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000bec1 },
+	{ .u32 = 0x8005000b },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbef13b31 },
+	{ .u32 = 0x000d0006 },
+	{ .u32 = 0xbf47bc3a },
+	{ .u32 = 0x0015000f },
+	{ .u32 = 0xbf80bf5e },
+	{ .u32 = 0x00290025 },
+	{ .u32 = 0x3f103ec1 },
+	{ .u32 = 0x0008002d },
+	{ .u32 = 0x3ec6bf7a },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x0000bd0b },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3d9fbf3c },
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0xbe143d2b },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003d99 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00150002 },
+	{ .u32 = 0x3f21bf80 },
+	{ .u32 = 0x0032002e },
+	{ .u32 = 0x3f803f80 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3f003f7b },
+	{ .u32 = 0x80020003 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0016000f },
+	{ .u32 = 0xbf803f72 },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x00003f4f },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3a9cbed4 },
+	{ .u32 = 0x8003000d },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070006 },
+	{ .u32 = 0x3f80bf79 },
+	{ .u32 = 0x0014000f },
+	{ .u32 = 0xbf803f26 },
+	{ .u32 = 0x00170015 },
+	{ .u32 = 0x3f563f80 },
+	{ .u32 = 0x0020001b },
+	{ .u32 = 0xbee43f7e },
+	{ .u32 = 0x00290024 },
+	{ .u32 = 0xbec63f5f },
+	{ .u32 = 0x0032002e },
+	{ .u32 = 0x3eb43f80 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x00003f76 },
+	{ .u32 = 0x00090001 },
+	{ .u32 = 0xbe51bf22 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000bea0 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000f0000 },
+	{ .u32 = 0xbf433e90 },
+	{ .u32 = 0x00140013 },
+	{ .u32 = 0xbdbf3ea8 },
+	{ .u32 = 0x000c0015 },
+	{ .u32 = 0xbd9e3f20 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3cfabe99 },
+	{ .u32 = 0x00010009 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0005 },
+	{ .u32 = 0xbf80befb },
+	{ .u32 = 0x0010000e },
+	{ .u32 = 0xbf80bf80 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbf803f80 },
+	{ .u32 = 0x00060008 },
+	{ .u32 = 0xbf803f7c },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00003eae },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003e53 },
+};
+#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_F16)
+/** Packed neuron records with f16 weights, 4496 bytes, largest weight error 0.0002410 */
+static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {
+	{ .u32 = 0x80060000 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x2e90b1ad },
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x0000b800 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbc003800 },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0x3800bc00 },
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0x3800bc00 },
+	{ .u32 = 0x80010001 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000039d1 },
+	{ .u32 = 0x80010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xba803b00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003400 },
+	{ .u32 = 0x00010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000332e },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x39d4bbe0 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3a983604 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xb8003800 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x320e3711 },
+	{ .u32 = 0x80080004 },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x32c73a2f },
+	{ .u32 = 0x00020004 },
+	{ .u32 = 0xb8feb64f },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3bfe3c00 },
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0x34b93c00 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x3a80bc00 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x35892e7a },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xb5593831 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3a9e3800 },
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0xb4feb800 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x37aabc00 },
+	{ .u32 = 0x80050001 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x0000b525 },
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0x281aad0c },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003b4a },
+	{ .u32 = 0x80080005 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x41e13cc9 }, /* 28.1546803 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xb2eabb30 },
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0xafb02947 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x0000a337 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xaed7bc00 },
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbc00b348 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x32fcae59 },
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x34dcbc00 },
+	{ .u32 = 0x00060002 },
+	{ .u32 = 0x9e7a3c00 },
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0xbc00b800 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x32b6240e },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000ba8e },
+	{ .u32 = 0x80060004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xb788ba1a },
+	{ .u32 = 0x00090005 },
+	{ .u32 = 0xbc003348 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x399137b9 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xba59247c },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xb00e3b4b },
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x41e0325a }, /* 28.0245857 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbb13b35f },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x383ebc00 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x0000b800 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x36b6ba89 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x2ee231a1 },
+	{ .u32 = 0x80050005 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x41bcbca4 }, /* 23.5921097 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbbd33c00 },
+	{ .u32 = 0x00060005 },
+	{ .u32 = 0xb484a386 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x000038a2 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbc00ba92 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xb7a5b917 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000039da },
+	{ .u32 = 0x80050002 },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00080000 },
+	{ .u32 = 0x3a00bc00 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000027d3 },
+	{ .u32 = 0x80070003 },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x2c0cb4cd },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x0000bbb4 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3c00ab0a },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xbbdb3900 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x2c083c00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000025f0 },
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00080001 },
+	{ .u32 = 0x3c00267a },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbc00b9af },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xabf030a0 },
+	{ .u32 = 0x80070007 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbb8a2c91 },
+	{ .u32 = 0x00080004 },
+	{ .u32 = 0x3c00337f },
+	{ .u32 = 0x000d000a },
+	{ .u32 = 0x3c003bc0 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3a5fb7a2 },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0x3818bc00 },
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0x34b0bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000b2fa },
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0x37f6bab2 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0xbbfe3bd3 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xb56c3c00 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x383bb747 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xba5b3296 },
+	{ .u32 = 0x80070005 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xa61db019 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x3b19b3f7 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xb880325d },
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0x35082535 },
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0x19c3b123 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000035e8 },
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000013 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbb80232a },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x0000b8cf },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3800a952 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x1fc322d3 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000014 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xb9853ae7 },
+	{ .u32 = 0x0011000b },
+	{ .u32 = 0x3c00bba2 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x35a4b6b3 },
+	{ .u32 = 0x8006000a },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x12bab600 },
+	{ .u32 = 0x00080006 },
+	{ .u32 = 0x3c00b53c },
+	{ .u32 = 0x000c000a },
+	{ .u32 = 0xbc00b3bc },
+	{ .u32 = 0x000f000d },
+	{ .u32 = 0x3bacbb54 },
+	{ .u32 = 0x00130011 },
+	{ .u32 = 0xb9723a93 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xb53f37d5 },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xb9f3ba57 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x342714b7 },
+	{ .u32 = 0x80060005 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060000 },
+	{ .u32 = 0x38fa3bd8 },
+	{ .u32 = 0x0010000e },
+	{ .u32 = 0x3c00af95 },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3437bc00 },
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x333a3c00 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xb6a1b032 },
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000017 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x33f7a4a9 },
+	{ .u32 = 0x000a0006 },
+	{ .u32 = 0x2ac53543 },
+	{ .u32 = 0x0014000e },
+	{ .u32 = 0xa85c3a40 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xb374b9ac },
+	{ .u32 = 0x80050005 },
+	{ .u32 = 0x00000018 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x18191ef3 },
+	{ .u32 = 0x0011000a },
+	{ .u32 = 0x33892380 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x00002b61 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x2835bc00 },
+	{ .u32 = 0x00070002 },
+	{ .u32 = 0xbbbebc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00001f95 },
+	{ .u32 = 0x80030003 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00130004 },
+	{ .u32 = 0x366c1cbf },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x0000b7d4 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000184b },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00100006 },
+	{ .u32 = 0x3c00b8f0 },
+	{ .u32 = 0x00180012 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3bc0bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000023ab },
+	{ .u32 = 0x80050006 },
+	{ .u32 = 0x0000001b },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xb8beb94c },
+	{ .u32 = 0x00120011 },
+	{ .u32 = 0x397dbc00 },
+	{ .u32 = 0x00190017 },
+	{ .u32 = 0xbc00ba0b },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x1586b8a8 },
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0xaba0124c },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000036b5 },
+	{ .u32 = 0x80070003 },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170004 },
+	{ .u32 = 0xb2d10bb5 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x1ea53b40 },
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0x1ddbb199 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x145ab20d },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000150c },
+	{ .u32 = 0x8006000d },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x4207f5ae }, /* 33.9899216 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xb19431f0 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0x3a8db21e },
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0x2d013875 },
+	{ .u32 = 0x000f000c },
+	{ .u32 = 0x3c003b55 },
+	{ .u32 = 0x00150010 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x001a0016 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xb297b800 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xb6b8b7ea },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xb95a343c },
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xb9d82f54 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xb97e3c00 },
+	{ .u32 = 0x00120011 },
+	{ .u32 = 0x3c00bb51 },
+	{ .u32 = 0x001a0013 },
+	{ .u32 = 0x3a932dd4 },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x00002d78 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xb61fb95e },
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0xb1063607 },
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0xb922b881 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000039a5 },
+	{ .u32 = 0x80030004 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xb9a1ac77 },
+	{ .u32 = 0x00090011 },
+	{ .u32 = 0x3b59acf5 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xba00bb00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x000039ad },
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xb875bc00 },
+	{ .u32 = 0x001d0012 },
+	{ .u32 = 0xb4e53b00 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3b40b233 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000380e },
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0x30ae2e2f },
+	{ .u32 = 0x001f0011 },
+	{ .u32 = 0xbc00b991 },
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x34b03826 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xb19d2c11 },
+	{ .u32 = 0x00010007 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00110001 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00140012 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x001f001b },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x00003980 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x41dfd6b8 }, /* 27.9798431 */
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0x20d7af5f },
+	{ .u32 = 0x00150007 },
+	{ .u32 = 0xbc00bb8d },
+	{ .u32 = 0x001d001a },
+	{ .u32 = 0xbc00b7ee },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3addbc00 },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3a422b64 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xb9f9ba57 },
+	{ .u32 = 0x001c000a },
+	{ .u32 = 0x3c00ba15 },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0xb9bd3343 },
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x3a34bb4e },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0xadc43a7b },
+	{ .u32 = 0x001c0019 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0x3b81ac40 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x0000af1e },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3b58bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000bb00 },
+	{ .u32 = 0x80050009 },
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000a0000 },
+	{ .u32 = 0x344ebaf7 },
+	{ .u32 = 0x000d000c },
+	{ .u32 = 0x3b18bb62 },
+	{ .u32 = 0x0017000f },
+	{ .u32 = 0xbc002d8b },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0x3b55bc00 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x39793800 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00002b21 },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xb8cb306f },
+	{ .u32 = 0x0011000c },
+	{ .u32 = 0xb399b965 },
+	{ .u32 = 0x00210016 },
+	{ .u32 = 0x35163526 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x0000393f },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbb003a00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000ae53 },
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x001d0007 },
+	{ .u32 = 0xb800b900 },
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x0000b9a6 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xba7fb668 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3b1a3312 },
+	{ .u32 = 0x80070005 },
+	{ .u32 = 0x00000025 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0017000e },
+	{ .u32 = 0xaa68bc00 },
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0x3483bc00 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x0000328e },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0x27e1bc00 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x22ea3800 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00002834 },
+	{ .u32 = 0x8007000c },
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060001 },
+	{ .u32 = 0x2612af91 },
+	{ .u32 = 0x0013000e },
+	{ .u32 = 0x3c002eb6 },
+	{ .u32 = 0x00190018 },
+	{ .u32 = 0xbb293800 },
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0x2b00bc00 },
+	{ .u32 = 0x00090020 },
+	{ .u32 = 0xbc003895 },
+	{ .u32 = 0x00250024 },
+	{ .u32 = 0x3c00b80e },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3800bc00 },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xb580bc00 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xac923c00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000292f },
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00190004 },
+	{ .u32 = 0x3bdebc00 },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x0000b525 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3970bafc },
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3851ba23 },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0018000c },
+	{ .u32 = 0x3800bb00 },
+	{ .u32 = 0x001a0019 },
+	{ .u32 = 0x3b00bc00 },
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x0000384c },
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0x14bcb800 },
+	{ .u32 = 0x80020009 },
+	{ .u32 = 0x00000029 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0xb800af52 },
+	{ .u32 = 0x000c000b },
+	{ .u32 = 0x30fa3042 },
+	{ .u32 = 0x001e0016 },
+	{ .u32 = 0xba99ad18 },
+	{ .u32 = 0x0027001f },
+	{ .u32 = 0xbc002da8 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x000b0000 },
+	{ .u32 = 0x38e0b6c8 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x1b37b41d },
+	{ .u32 = 0x0022000c },
+	{ .u32 = 0x367bb663 },
+	{ .u32 = 0x001f001e },
+	{ .u32 = 0xbc003a65 },
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0x0000bbbd },
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0x227db69e },
+	{ .u32 = 0x00010007 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3a10bc00 },
+	{ .u32 = 0x001e0009 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00290011 },
+	{ .u32 = 0x39c0bc00 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003680 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xb8c43afe },
+	{ .u32 = 0x0019000d },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0xb627b518 },
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xaa7e3c00 },
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0x313db438 },
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xb900bc00 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xba4ebc00 },
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0xb76b3ab5 },
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0x3161396f },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000b185 },
+	{ .u32 = 0x80040001 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x3c00bade },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x1e05b990 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0000 },
+	{ .u32 = 0xb37eb530 },
+	{ .u32 = 0x0013000f },
+	{ .u32 = 0xb37434c6 },
+	{ .u32 = 0x00250019 },
+	{ .u32 = 0xb40e3c00 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x212aae69 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0013000f },
+	{ .u32 = 0xbc00b348 },
+	{ .u32 = 0x001c0019 },
+	{ .u32 = 0x3a7ebc00 },
+	{ .u32 = 0x002a001e },
+	{ .u32 = 0xb48f26b1 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x0000bb22 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x1ecd3ae8 },
+	{ .u32 = 0x80050008 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0x3505bc00 },
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xb6af3b7a },
+	{ .u32 = 0x00250023 },
+	{ .u32 = 0xb9493c00 },
+	{ .u32 = 0x00290028 },
+	{ .u32 = 0xae66bbfc },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x2d433a0c },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x2453b662 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00002826 },
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e0005 },
+	{ .u32 = 0xac9c10b9 },
+	{ .u32 = 0x00250017 },
+	{ .u32 = 0xbb21ba18 },
+	{ .u32 = 0x00290028 },
+	{ .u32 = 0x3a1ebc00 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x00003485 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbb003c00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00001921 },
+	{ .u32 = 0x80030009 },
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbad4b2bb },
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x2f58381b },
+	{ .u32 = 0x001f0026 },
+	{ .u32 = 0x3800ba2e },
+	{ .u32 = 0x0028002a },
+	{ .u32 = 0xba4d2fe8 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x2a2cb7cf },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00001dd8 },
+	{ .u32 = 0x80040009 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0018000c },
+	{ .u32 = 0x3c00b273 },
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0xb8c0b411 },
+	{ .u32 = 0x00230022 },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x002a0026 },
+	{ .u32 = 0x39d6b66d },
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x00003b1d },
+	{ .u32 = 0x00070001 },
+	{ .u32 = 0xbc00acf9 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x2484b800 },
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0xb8061efa },
+	{ .u32 = 0x000a0019 },
+	{ .u32 = 0xb6693a00 },
+	{ .u32 = 0x002f002a },
+	{ .u32 = 0xbb0d3c00 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x21023a55 },
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e0006 },
+	{ .u32 = 0xb4523467 },
+	{ .u32 = 0x002a001c },
+	{ .u32 = 0x38a63600 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00050000 },
+	{ .u32 = 0xb3ebbc00 },
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x116e3800 },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000033 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0xb719218a },
+	{ .u32 = 0x002a0019 },
+	{ .u32 = 0x19682b0c },
+	{ .u32 = 0x0030002c },
+	{ .u32 = 0x3bfcbbb0 },
+	{ .u32 = 0x000b0005 },
+	{ .u32 = 0x16c90f6c },
+	{ .u32 = 0x0001000c },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbc00b95e },
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x00220021 },
+	{ .u32 = 0x3800b9b9 },
+	{ .u32 = 0x002f0024 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00310030 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x00330032 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000319f },
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x00003903 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x34d6bc00 },
+	{ .u32 = 0x00090004 },
+	{ .u32 = 0x3b363700 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xbb8038d3 },
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x002e002a },
+	{ .u32 = 0x3c003500 },
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0x3c00b4e5 },
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xa9b4357a },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x1b7014ba },
+	{ .u32 = 0x80060009 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xb69eaec1 },
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0xb6673862 },
+	{ .u32 = 0x002b0011 },
+	{ .u32 = 0xb4cf2c04 },
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0xb03dad32 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x21663b40 },
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xa4602a8f },
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0015000c },
+	{ .u32 = 0xbc00aa0e },
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0x3c00b960 },
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x00003873 },
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x18932952 },
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbb5f1e6a },
+	{ .u32 = 0x00180015 },
+	{ .u32 = 0xb83cb906 },
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x3526b832 },
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x00003781 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x1ac03172 },
+	{ .u32 = 0x00010011 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00080000 },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x000f000e },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x00130010 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x000a0015 },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x00210023 },
+	{ .u32 = 0xb900bc00 },
+	{ .u32 = 0x002b001f },
+	{ .u32 = 0xbc0039aa },
+	{ .u32 = 0x0022002c },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x002a0011 },
+	{ .u32 = 0xbc003b06 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x80050003 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00200004 },
+	{ .u32 = 0x38003a38 },
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x0000bc00 },
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xb9ff2a6b },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000b3c8 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170008 },
+	{ .u32 = 0xa63a3309 },
+	{ .u32 = 0x00280019 },
+	{ .u32 = 0x3c00b90b },
+	{ .u32 = 0x000b0000 },
+	{ .u32 = 0x1f28bc00 },
+	{ .u32 = 0x8003000a },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e000d },
+	{ .u32 = 0xb2c8ba69 },
+	{ .u32 = 0x00200017 },
+	{ .u32 = 0xbc00bb00 },
+	{ .u32 = 0x0029001e },
+	{ .u32 = 0x30822fef },
+	{ .u32 = 0x0008002d },
+	{ .u32 = 0x34bc3aab },
+	{ .u32 = 0x00110022 },
+	{ .u32 = 0xb8003c00 },
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbbc0397f },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00002197 },
+	{ .u32 = 0x00010011 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000d0007 },
+	{ .u32 = 0xbc00369f },
+	{ .u32 = 0x00170016 },
+	{ .u32 = 0x3b00bb40 },
+	{ .u32 = 0x00190018 },
+	{ .u32 = 0x3800bbd5 },
+	{ .u32 = 0x001c001a },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x00260025 },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00270004 },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x002d0028 },
+	{ .u32 = 0x3c00bc00 },
+	{ .u32 = 0x0008002e },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000b609 },
+	{ .u32 = 0x8004000b },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x420f3fca }, /* 35.8122940 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x362fbc00 },
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0x3c003579 },
+	{ .u32 = 0x00150014 },
+	{ .u32 = 0x3c0039bb },
+	{ .u32 = 0x0020001c },
+	{ .u32 = 0xbc003a10 },
+	{ .u32 = 0x00290024 },
+	{ .u32 = 0xb851b138 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x00003c00 },
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xb72eb400 },
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbb40b578 },
+	{ .u32 = 0x80030008 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00140000 },
+	{ .u32 = 0xbaf8373b },
+	{ .u32 = 0x00250016 },
+	{ .u32 = 0xbbcbb800 },
+	{ .u32 = 0x00280026 },
+	{ .u32 = 0x3c00bb89 },
+	{ .u32 = 0x002d0029 },
+	{ .u32 = 0x3afcbc00 },
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0x33243b76 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000b606 },
+	{ .u32 = 0x8005000b },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xb786198b },
+	{ .u32 = 0x000d0006 },
+	{ .u32 = 0xba39a1cf },
+	{ .u32 = 0x0015000f },
+	{ .u32 = 0xbc00baf1 },
+	{ .u32 = 0x00290025 },
+	{ .u32 = 0x38833606 },
+	{ .u32 = 0x0008002d },
+	{ .u32 = 0x3634bbd0 },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x0000a857 },
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x2cfab9df },
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0xb0a2295c },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00002cc7 },
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00150002 },
+	{ .u32 = 0x390abc00 },
+	{ .u32 = 0x0032002e },
+	{ .u32 = 0x3c003c00 },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x38043bd6 },
+	{ .u32 = 0x80020003 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0016000f },
+	{ .u32 = 0xbc003b8f },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x00003a75 },
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x14dfb6a3 },
+	{ .u32 = 0x8003000d },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070006 },
+	{ .u32 = 0x3c00bbc7 },
+	{ .u32 = 0x0014000f },
+	{ .u32 = 0xbc003934 },
+	{ .u32 = 0x00170015 },
+	{ .u32 = 0x3aac3c00 },
+	{ .u32 = 0x0020001b },
+	{ .u32 = 0xb71e3bf0 },
+	{ .u32 = 0x00290024 },
+	{ .u32 = 0xb6303af6 },
+	{ .u32 = 0x0032002e },
+	{ .u32 = 0x359d3c00 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x00003bae },
+	{ .u32 = 0x00090001 },
+	{ .u32 = 0xb286b90e },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x0000b4fc },
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000f0000 },
+	{ .u32 = 0xba153483 },
+	{ .u32 = 0x00140013 },
+	{ .u32 = 0xadf5353d },
+	{ .u32 = 0x000c0015 },
+	{ .u32 = 0xacf038fe },
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x27cdb4cc },
+	{ .u32 = 0x00010009 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0005 },
+	{ .u32 = 0xbc00b7da },
+	{ .u32 = 0x0010000e },
+	{ .u32 = 0xbc00bc00 },
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbc003c00 },
+	{ .u32 = 0x00060008 },
+	{ .u32 = 0xbc003be0 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x00003570 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00003297 },
+};
+#else
+/** Packed neuron records, 5908 bytes */
+static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {
+	{ .u32 = 0x80060000 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbe359b65 }, /* -0.1773506 */
+	{ .u32 = 0x3dd20734 }, /* 0.1025528 */
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x80010001 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f3a1771 }, /* 0.7269202 */
+	{ .u32 = 0x80010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0xbf4ffcef }, /* -0.8124532 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e8004da }, /* 0.2500370 */
+	{ .u32 = 0x00010002 },
+	{ .u32 = 0x00000003 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e65b50f }, /* 0.2243235 */
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf7bfb14 }, /* -0.9842999 */
+	{ .u32 = 0x3f3a7ac1 }, /* 0.7284356 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3ec08d23 }, /* 0.3760768 */
+	{ .u32 = 0x3f52f6a2 }, /* 0.8240758 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3ee22132 }, /* 0.4416595 */
+	{ .u32 = 0x3e41c0c4 }, /* 0.1892119 */
+	{ .u32 = 0x80080004 },
+	{ .u32 = 0x00000005 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f45d591 }, /* 0.7727900 */
+	{ .u32 = 0x3e58ded3 }, /* 0.2117875 */
+	{ .u32 = 0x00020004 },
+	{ .u32 = 0xbec9efc4 }, /* -0.3944074 */
+	{ .u32 = 0xbf1fcbf0 }, /* -0.6242056 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f7fbffe }, /* 0.9990233 */
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3e971458 }, /* 0.2950771 */
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f500003 }, /* 0.8125002 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3dcf39c4 }, /* 0.1011844 */
+	{ .u32 = 0x3eb12db0 }, /* 0.3460517 */
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x3f0618e2 }, /* 0.5238172 */
+	{ .u32 = 0xbeab1ceb }, /* -0.3342050 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x3f53bfd0 }, /* 0.8271456 */
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0xbe9fcebe }, /* -0.3121242 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xbf7fffe3 }, /* -0.9999983 */
+	{ .u32 = 0x3ef54904 }, /* 0.4790727 */
+	{ .u32 = 0x80050001 },
+	{ .u32 = 0x00000007 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0xbea4a687 }, /* -0.3215830 */
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0xbda17870 }, /* -0.0788430 */
+	{ .u32 = 0x3d0334d3 }, /* 0.0320328 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f6946a2 }, /* 0.9112340 */
+	{ .u32 = 0x80080005 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x41e13cc9 }, /* 28.1546803 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf66073b }, /* -0.8985478 */
+	{ .u32 = 0xbe5d48aa }, /* -0.2160975 */
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0x3d28d6d4 }, /* 0.0412205 */
+	{ .u32 = 0xbdf60d45 }, /* -0.1201425 */
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0xbc66e222 }, /* -0.0140920 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbddae3bf }, /* -0.1068797 */
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbe68f862 }, /* -0.2275100 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbdcb1939 }, /* -0.0991692 */
+	{ .u32 = 0x3e5f8f7d }, /* 0.2183208 */
+	{ .u32 = 0x80050004 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3e9b856c }, /* 0.3037523 */
+	{ .u32 = 0x00060002 },
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0xbbcf370a }, /* -0.0063237 */
+	{ .u32 = 0x00030000 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3c81b288 }, /* 0.0158322 */
+	{ .u32 = 0x3e56b690 }, /* 0.2096808 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbf51b48e }, /* -0.8191613 */
+	{ .u32 = 0x80060004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf433941 }, /* -0.7625924 */
+	{ .u32 = 0xbef0fa60 }, /* -0.4706602 */
+	{ .u32 = 0x00090005 },
+	{ .u32 = 0x3e68f20a }, /* 0.2274858 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3ef719d6 }, /* 0.4826190 */
+	{ .u32 = 0x3f32228a }, /* 0.6958395 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3c8f7a26 }, /* 0.0175143 */
+	{ .u32 = 0xbf4b206e }, /* -0.7934636 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3f695994 }, /* 0.9115231 */
+	{ .u32 = 0xbe01c5ab }, /* -0.1267306 */
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x41e0325a }, /* 28.0245857 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbe6bdb21 }, /* -0.2303281 */
+	{ .u32 = 0xbf6261b9 }, /* -0.8843036 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f07c503 }, /* 0.5303499 */
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0xbf512fcb }, /* -0.8171355 */
+	{ .u32 = 0x3ed6be1d }, /* 0.4194192 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3e3412bb }, /* 0.1758527 */
+	{ .u32 = 0x3ddc33c3 }, /* 0.1075206 */
+	{ .u32 = 0x80050005 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x41bcbca4 }, /* 23.5921097 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf7a5124 }, /* -0.9778006 */
+	{ .u32 = 0x00060005 },
+	{ .u32 = 0xbc70b0d8 }, /* -0.0146906 */
+	{ .u32 = 0xbe9082a4 }, /* -0.2822467 */
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x3f14308e }, /* 0.5788659 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbf524ca3 }, /* -0.8214819 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbf22e274 }, /* -0.6362679 */
+	{ .u32 = 0xbef4ab99 }, /* -0.4778717 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f3b3c38 }, /* 0.7313876 */
+	{ .u32 = 0x80050002 },
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00080000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f400000 }, /* 0.7500000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3cfa545a }, /* 0.0305578 */
+	{ .u32 = 0x80070003 },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbe99a350 }, /* -0.3000741 */
+	{ .u32 = 0x3d817771 }, /* 0.0632161 */
+	{ .u32 = 0x0000000d },
+	{ .u32 = 0xbf7679fb }, /* -0.9627988 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbd614e49 }, /* -0.0550063 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0x3f200000 }, /* 0.6250000 */
+	{ .u32 = 0xbf7b5071 }, /* -0.9816962 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3d80f2cc }, /* 0.0629631 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3cbe0f65 }, /* 0.0232007 */
+	{ .u32 = 0x80060002 },
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00080001 },
+	{ .u32 = 0x3ccf40e6 }, /* 0.0252995 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf7ffff9 }, /* -0.9999996 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbf35daca }, /* -0.7103697 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3e13f08c }, /* 0.1444723 */
+	{ .u32 = 0xbd7df48d }, /* -0.0620008 */
+	{ .u32 = 0x80070007 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3d921de7 }, /* 0.0713461 */
+	{ .u32 = 0xbf7131a7 }, /* -0.9421639 */
+	{ .u32 = 0x00080004 },
+	{ .u32 = 0x3e6fd3e2 }, /* 0.2342067 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000d000a },
+	{ .u32 = 0x3f780000 }, /* 0.9687500 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbef445a3 }, /* -0.4770938 */
+	{ .u32 = 0x3f4bd2c8 }, /* 0.7961850 */
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f02f970 }, /* 0.5116186 */
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3e96043d }, /* 0.2930011 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe5f3161 }, /* -0.2179618 */
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbf56405f }, /* -0.8369197 */
+	{ .u32 = 0x3efec765 }, /* 0.4976150 */
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0x3f7a627d }, /* 0.9780653 */
+	{ .u32 = 0xbf7fb513 }, /* -0.9988567 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbead7383 }, /* -0.3387719 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbee8ee6c }, /* -0.4549440 */
+	{ .u32 = 0x3f07530a }, /* 0.5286108 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3e52c387 }, /* 0.2058240 */
+	{ .u32 = 0xbf4b5035 }, /* -0.7941926 */
+	{ .u32 = 0x80070005 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbe032ea4 }, /* -0.1281076 */
+	{ .u32 = 0xbcc3a5a7 }, /* -0.0238827 */
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0xbe7edadf }, /* -0.2488818 */
+	{ .u32 = 0x3f63197a }, /* 0.8871075 */
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x3e4b9a7c }, /* 0.1988315 */
+	{ .u32 = 0xbf100000 }, /* -0.5625000 */
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0x3ca6a693 }, /* 0.0203431 */
+	{ .u32 = 0x3ea0fd53 }, /* 0.3144327 */
+	{ .u32 = 0x00090008 },
+	{ .u32 = 0xbe2458db }, /* -0.1604952 */
+	{ .u32 = 0x3b3862b2 }, /* 0.0028135 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3ebcfea6 }, /* 0.3691303 */
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000013 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0x3c654061 }, /* 0.0139924 */
+	{ .u32 = 0xbf700000 }, /* -0.9375000 */
+	{ .u32 = 0x0000000f },
+	{ .u32 = 0xbf19e35e }, /* -0.6011256 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbd2a4c04 }, /* -0.0415764 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3c5a554c }, /* 0.0133260 */
+	{ .u32 = 0x3bf85af0 }, /* 0.0075792 */
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000014 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3f5cd8d8 }, /* 0.8626838 */
+	{ .u32 = 0xbf30aed1 }, /* -0.6901675 */
+	{ .u32 = 0x0011000b },
+	{ .u32 = 0xbf744085 }, /* -0.9541095 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbed66b4a }, /* -0.4187873 */
+	{ .u32 = 0x3eb48058 }, /* 0.3525417 */
+	{ .u32 = 0x8006000a },
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0xbebfffba }, /* -0.3749979 */
+	{ .u32 = 0x3a573861 }, /* 0.0008210 */
+	{ .u32 = 0x00080006 },
+	{ .u32 = 0xbea77828 }, /* -0.3270886 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000c000a },
+	{ .u32 = 0xbe7781a6 }, /* -0.2417055 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000f000d },
+	{ .u32 = 0xbf6a7c92 }, /* -0.9159633 */
+	{ .u32 = 0x3f758000 }, /* 0.9589844 */
+	{ .u32 = 0x00130011 },
+	{ .u32 = 0x3f5267aa }, /* 0.8218943 */
+	{ .u32 = 0xbf2e4763 }, /* -0.6807768 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3efa9d87 }, /* 0.4894831 */
+	{ .u32 = 0xbea7de75 }, /* -0.3278691 */
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbf4ad6a0 }, /* -0.7923374 */
+	{ .u32 = 0xbf3e6c21 }, /* -0.7438374 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3a96d671 }, /* 0.0011508 */
+	{ .u32 = 0x3e84e19d }, /* 0.2595338 */
+	{ .u32 = 0x80060005 },
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060000 },
+	{ .u32 = 0x3f7b0a1f }, /* 0.9806232 */
+	{ .u32 = 0x3f1f373d }, /* 0.6219366 */
+	{ .u32 = 0x0010000e },
+	{ .u32 = 0xbdf2905b }, /* -0.1184394 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00000015 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3e86eb92 }, /* 0.2635160 */
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0x3e6741ff }, /* 0.2258377 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbe063800 }, /* -0.1310730 */
+	{ .u32 = 0xbed427be }, /* -0.4143657 */
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000017 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0xbc95248a }, /* -0.0182059 */
+	{ .u32 = 0x3e7ee009 }, /* 0.2489015 */
+	{ .u32 = 0x000a0006 },
+	{ .u32 = 0x3ea86ba0 }, /* 0.3289461 */
+	{ .u32 = 0x3d58996f }, /* 0.0528807 */
+	{ .u32 = 0x0014000e },
+	{ .u32 = 0x3f47fecb }, /* 0.7812316 */
+	{ .u32 = 0xbd0b70fd }, /* -0.0340433 */
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf7ffffe }, /* -0.9999999 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0xbf358436 }, /* -0.7090486 */
+	{ .u32 = 0xbe6e7bd8 }, /* -0.2328943 */
+	{ .u32 = 0x80050005 },
+	{ .u32 = 0x00000018 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0x3bde5662 }, /* 0.0067852 */
+	{ .u32 = 0x3b03126f }, /* 0.0020000 */
+	{ .u32 = 0x0011000a },
+	{ .u32 = 0x3c700764 }, /* 0.0146502 */
+	{ .u32 = 0x3e712543 }, /* 0.2354937 */
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0x3d6c1963 }, /* 0.0576414 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3d069398 }, /* 0.0328556 */
+	{ .u32 = 0x00070002 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf77c39d }, /* -0.9678286 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3bf29e18 }, /* 0.0074041 */
+	{ .u32 = 0x80030003 },
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00130004 },
+	{ .u32 = 0x3b97ec1a }, /* 0.0046363 */
+	{ .u32 = 0x3ecd8a29 }, /* 0.4014447 */
+	{ .u32 = 0x00000016 },
+	{ .u32 = 0xbefa7c76 }, /* -0.4892308 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3b0954a8 }, /* 0.0020955 */
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001a },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00100006 },
+	{ .u32 = 0xbf1e01c3 }, /* -0.6172144 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00180012 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f780000 }, /* 0.9687500 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3c755a1f }, /* 0.0149751 */
+	{ .u32 = 0x80050006 },
+	{ .u32 = 0x0000001b },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbf297370 }, /* -0.6619177 */
+	{ .u32 = 0xbf17bd87 }, /* -0.5927357 */
+	{ .u32 = 0x00120011 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f2fadd5 }, /* 0.6862462 */
+	{ .u32 = 0x00190017 },
+	{ .u32 = 0xbf41511e }, /* -0.7551440 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf150046 }, /* -0.5820354 */
+	{ .u32 = 0x3ab0c6dd }, /* 0.0013487 */
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0x3a498295 }, /* 0.0007687 */
+	{ .u32 = 0xbd740bd6 }, /* -0.0595816 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3ed6af4a }, /* 0.4193061 */
+	{ .u32 = 0x80070003 },
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170004 },
+	{ .u32 = 0x3976a005 }, /* 0.0002352 */
+	{ .u32 = 0xbe5a17e7 }, /* -0.2129818 */
+	{ .u32 = 0x00000019 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f67f103 }, /* 0.9060213 */
+	{ .u32 = 0x3bd4936b }, /* 0.0064873 */
+	{ .u32 = 0x00050002 },
+	{ .u32 = 0xbe3324f0 }, /* -0.1749456 */
+	{ .u32 = 0x3bbb5ab5 }, /* 0.0057176 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xbe41a870 }, /* -0.1891191 */
+	{ .u32 = 0x3a8b46f0 }, /* 0.0010626 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3aa17459 }, /* 0.0012318 */
+	{ .u32 = 0x8006000d },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x4207f5ae }, /* 33.9899216 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3e3dfd0b }, /* 0.1855356 */
+	{ .u32 = 0xbe3278de }, /* -0.1742892 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbe43b682 }, /* -0.1911259 */
+	{ .u32 = 0x3f519a61 }, /* 0.8187619 */
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0x3f0e973b }, /* 0.5569951 */
+	{ .u32 = 0x3da02265 }, /* 0.0781906 */
+	{ .u32 = 0x000f000c },
+	{ .u32 = 0x3f6a99a8 }, /* 0.9164071 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00150010 },
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0x3f7ffffd }, /* 0.9999998 */
+	{ .u32 = 0x001a0016 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0000001c },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0xbe52d073 }, /* -0.2058733 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbefd4a8a }, /* -0.4947093 */
+	{ .u32 = 0xbed6fbe7 }, /* -0.4198906 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3e8772ae }, /* 0.2645468 */
+	{ .u32 = 0xbf2b37e8 }, /* -0.6688218 */
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0x3dea86e5 }, /* 0.1145151 */
+	{ .u32 = 0xbf3afb76 }, /* -0.7303995 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf2fc81b }, /* -0.6866471 */
+	{ .u32 = 0x00120011 },
+	{ .u32 = 0xbf6a2493 }, /* -0.9146206 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x001a0013 },
+	{ .u32 = 0x3dba8d8d }, /* 0.0910903 */
+	{ .u32 = 0x3f52645e }, /* 0.8218440 */
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x3daf04f9 }, /* 0.0854587 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf2bbfa5 }, /* -0.6708930 */
+	{ .u32 = 0xbec3e590 }, /* -0.3826108 */
+	{ .u32 = 0x00070003 },
+	{ .u32 = 0x3ec0ed4e }, /* 0.3768105 */
+	{ .u32 = 0xbe20bd7a }, /* -0.1569728 */
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0xbf102d15 }, /* -0.5631879 */
+	{ .u32 = 0xbf244b99 }, /* -0.6417785 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f349dea }, /* 0.7055346 */
+	{ .u32 = 0x80030004 },
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070004 },
+	{ .u32 = 0xbd8ee35d }, /* -0.0697696 */
+	{ .u32 = 0xbf3428d8 }, /* -0.7037482 */
+	{ .u32 = 0x00090011 },
+	{ .u32 = 0xbd9e9029 }, /* -0.0774234 */
+	{ .u32 = 0x3f6b1f73 }, /* 0.9184486 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0xbf400000 }, /* -0.7500000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f359fa6 }, /* 0.7094673 */
+	{ .u32 = 0x80030005 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf0e9f37 }, /* -0.5571169 */
+	{ .u32 = 0x001d0012 },
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0xbe9caa9a }, /* -0.3059891 */
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbe465b35 }, /* -0.1937073 */
+	{ .u32 = 0x3f680000 }, /* 0.9062500 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3f01bd93 }, /* 0.5067989 */
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0006 },
+	{ .u32 = 0x3dc5ecfa }, /* 0.0966434 */
+	{ .u32 = 0x3e15bf77 }, /* 0.1462382 */
+	{ .u32 = 0x001f0011 },
+	{ .u32 = 0xbf322405 }, /* -0.6958621 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00080002 },
+	{ .u32 = 0x3f04b085 }, /* 0.5183185 */
+	{ .u32 = 0x3e9606cc }, /* 0.2930206 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3d822ff1 }, /* 0.0635680 */
+	{ .u32 = 0xbe33ae91 }, /* -0.1754706 */
+	{ .u32 = 0x00010007 },
+	{ .u32 = 0x00000012 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00110001 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00140012 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x001f001b },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x3f2ffffe }, /* 0.6874999 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 }, /* 0.0000000 */
+	{ .u32 = 0x80040006 },
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x41dfd6b8 }, /* 27.9798431 */
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0xbdebe7ca }, /* -0.1151882 */
+	{ .u32 = 0x3c1aef70 }, /* 0.0094565 */
+	{ .u32 = 0x00150007 },
+	{ .u32 = 0xbf71a08a }, /* -0.9438559 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x001d001a },
+	{ .u32 = 0xbefdcc71 }, /* -0.4957004 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f5baeda }, /* 0.8581368 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0x3d6c7615 }, /* 0.0577298 */
+	{ .u32 = 0x3f48482e }, /* 0.7823514 */
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf4ad6c1 }, /* -0.7923394 */
+	{ .u32 = 0xbf3f1be0 }, /* -0.7465191 */
+	{ .u32 = 0x001c000a },
+	{ .u32 = 0xbf429d82 }, /* -0.7602159 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0x3e686f3a }, /* 0.2269868 */
+	{ .u32 = 0xbf37aaef }, /* -0.7174520 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0xbf69c224 }, /* -0.9131186 */
+	{ .u32 = 0x3f4681f7 }, /* 0.7754206 */
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x000a0007 },
+	{ .u32 = 0x3f4f6b8b }, /* 0.8102347 */
+	{ .u32 = 0xbdb88278 }, /* -0.0900926 */
+	{ .u32 = 0x001c0019 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0xbd87f951 }, /* -0.0663935 */
+	{ .u32 = 0x3f7022ff }, /* 0.9380340 */
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0xbde3b13d }, /* -0.1111779 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f6b0369 }, /* 0.9180208 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbf6006f6 }, /* -0.8751062 */
+	{ .u32 = 0x80050009 },
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000a0000 },
+	{ .u32 = 0xbf5ed880 }, /* -0.8704910 */
+	{ .u32 = 0x3e89ced7 }, /* 0.2691562 */
+	{ .u32 = 0x000d000c },
+	{ .u32 = 0xbf6c3187 }, /* -0.9226307 */
+	{ .u32 = 0x3f6308a1 }, /* 0.8868504 */
+	{ .u32 = 0x0017000f },
+	{ .u32 = 0x3db15eb2 }, /* 0.0866064 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f6aa706 }, /* 0.9166111 */
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x3f2f23bd }, /* 0.6841391 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d642a16 }, /* 0.0557042 */
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3e0dd533 }, /* 0.1385086 */
+	{ .u32 = 0xbf195905 }, /* -0.5990146 */
+	{ .u32 = 0x0011000c },
+	{ .u32 = 0xbf2c9fd6 }, /* -0.6743139 */
+	{ .u32 = 0xbe731c22 }, /* -0.2374120 */
+	{ .u32 = 0x00210016 },
+	{ .u32 = 0x3ea4cf5e }, /* 0.3218946 */
+	{ .u32 = 0x3ea2bbe9 }, /* 0.3178399 */
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0x3f27df44 }, /* 0.6557505 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x3f400000 }, /* 0.7500000 */
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbdca6282 }, /* -0.0988207 */
+	{ .u32 = 0x80060003 },
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x001d0007 },
+	{ .u32 = 0xbf200000 }, /* -0.6250000 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0xbf34b1a8 }, /* -0.7058358 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0xbeccf48e }, /* -0.4003033 */
+	{ .u32 = 0xbf4fea55 }, /* -0.8121694 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3e624b9f }, /* 0.2209916 */
+	{ .u32 = 0x3f634953 }, /* 0.8878376 */
+	{ .u32 = 0x80070005 },
+	{ .u32 = 0x00000025 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0017000e },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbd4cf43a }, /* -0.0500376 */
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3e905d2e }, /* 0.2819609 */
+	{ .u32 = 0x00000020 },
+	{ .u32 = 0x3e51c058 }, /* 0.2048353 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3cfc1590 }, /* 0.0307720 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x3c5d43a8 }, /* 0.0135049 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d06783a }, /* 0.0328295 */
+	{ .u32 = 0x8007000c },
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00060001 },
+	{ .u32 = 0xbdf22e00 }, /* -0.1182518 */
+	{ .u32 = 0x3cc24016 }, /* 0.0237122 */
+	{ .u32 = 0x0013000e },
+	{ .u32 = 0x3dd6bb8b }, /* 0.1048499 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00190018 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0xbf6527b3 }, /* -0.8951370 */
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3d600707 }, /* 0.0546942 */
+	{ .u32 = 0x00090020 },
+	{ .u32 = 0x3f129342 }, /* 0.5725595 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00250024 },
+	{ .u32 = 0xbf01c81c }, /* -0.5069597 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbeb00542 }, /* -0.3437901 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbd92419c }, /* -0.0714142 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d25dcb9 }, /* 0.0404937 */
+	{ .u32 = 0x80040003 },
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00190004 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f7bce56 }, /* 0.9836172 */
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0xbea49951 }, /* -0.3214822 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0xbf5f8520 }, /* -0.8731251 */
+	{ .u32 = 0x3f2df442 }, /* 0.6795083 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbf446b60 }, /* -0.7672634 */
+	{ .u32 = 0x3f0a2bb1 }, /* 0.5397292 */
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0018000c },
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x001a0019 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0x00000026 },
+	{ .u32 = 0x3f098a49 }, /* 0.5372663 */
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x3a978847 }, /* 0.0011561 */
+	{ .u32 = 0x80020009 },
+	{ .u32 = 0x00000029 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0xbdea4b20 }, /* -0.1144011 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x000c000b },
+	{ .u32 = 0x3e083764 }, /* 0.1330238 */
+	{ .u32 = 0x3e1f4cee }, /* 0.1555669 */
+	{ .u32 = 0x001e0016 },
+	{ .u32 = 0xbda30aba }, /* -0.0796103 */
+	{ .u32 = 0xbf5326b0 }, /* -0.8248091 */
+	{ .u32 = 0x0027001f },
+	{ .u32 = 0x3db4f7a9 }, /* 0.0883630 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000b0000 },
+	{ .u32 = 0xbed8f682 }, /* -0.4237557 */
+	{ .u32 = 0x3f1c0bbd }, /* 0.6095541 */
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0008 },
+	{ .u32 = 0xbe83953b }, /* -0.2569979 */
+	{ .u32 = 0x3b66ef8e }, /* 0.0035238 */
+	{ .u32 = 0x0022000c },
+	{ .u32 = 0xbecc6ff3 }, /* -0.3992916 */
+	{ .u32 = 0x3ecf5826 }, /* 0.4049694 */
+	{ .u32 = 0x001f001e },
+	{ .u32 = 0x3f4c960b }, /* 0.7991645 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00000027 },
+	{ .u32 = 0xbf77ad44 }, /* -0.9674876 */
+	{ .u32 = 0x000b0003 },
+	{ .u32 = 0xbed3c5f6 }, /* -0.4136197 */
+	{ .u32 = 0x3c4fac10 }, /* 0.0126753 */
+	{ .u32 = 0x00010007 },
+	{ .u32 = 0x00000009 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f420000 }, /* 0.7578125 */
+	{ .u32 = 0x001e0009 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00290011 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f37fffe }, /* 0.7187499 */
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3ed00b21 }, /* 0.4063349 */
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00060004 },
+	{ .u32 = 0x3f5fbc7a }, /* 0.8739697 */
+	{ .u32 = 0xbf1873ad }, /* -0.5955151 */
+	{ .u32 = 0x0019000d },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0xbea2fb06 }, /* -0.3183214 */
+	{ .u32 = 0xbec4d49d }, /* -0.3844346 */
+	{ .u32 = 0x80070009 },
+	{ .u32 = 0x0000001f },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00040001 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbd4fb184 }, /* -0.0507064 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbe86f56a }, /* -0.2635911 */
+	{ .u32 = 0x3e279406 }, /* 0.1636506 */
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf7fffd9 }, /* -0.9999977 */
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf200000 }, /* -0.6250000 */
+	{ .u32 = 0x0000001e },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf49cf1b }, /* -0.7883164 */
+	{ .u32 = 0x00050004 },
+	{ .u32 = 0x3f5692a5 }, /* 0.8381751 */
+	{ .u32 = 0xbeed6840 }, /* -0.4636860 */
+	{ .u32 = 0x000a0009 },
+	{ .u32 = 0x3f2de95b }, /* 0.6793420 */
+	{ .u32 = 0x3e2c113c }, /* 0.1680345 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe30a43c }, /* -0.1725015 */
+	{ .u32 = 0x80040001 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x00000023 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00040000 },
+	{ .u32 = 0xbf5bb522 }, /* -0.8582326 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xbf31f03a }, /* -0.6950718 */
+	{ .u32 = 0x3bc0a9a9 }, /* 0.0058796 */
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0000 },
+	{ .u32 = 0xbea60f7c }, /* -0.3243369 */
+	{ .u32 = 0xbe6fcfdf }, /* -0.2341914 */
+	{ .u32 = 0x0013000f },
+	{ .u32 = 0x3e98cdc5 }, /* 0.2984449 */
+	{ .u32 = 0xbe6e77ad }, /* -0.2328784 */
+	{ .u32 = 0x00250019 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbe81c6e9 }, /* -0.2534707 */
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbdcd2590 }, /* -0.1001693 */
+	{ .u32 = 0x3c253975 }, /* 0.0100845 */
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000002c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0013000f },
+	{ .u32 = 0xbe68fece }, /* -0.2275345 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x001c0019 },
+	{ .u32 = 0xbf7ff2ac }, /* -0.9997966 */
+	{ .u32 = 0x3f4fc9d7 }, /* 0.8116736 */
+	{ .u32 = 0x002a001e },
+	{ .u32 = 0x3cd61870 }, /* 0.0261347 */
+	{ .u32 = 0xbe91d46d }, /* -0.2848238 */
+	{ .u32 = 0x00000028 },
+	{ .u32 = 0xbf64346e }, /* -0.8914250 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3f5cfa18 }, /* 0.8631911 */
+	{ .u32 = 0x3bd9aa2b }, /* 0.0066426 */
+	{ .u32 = 0x80050008 },
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3ea092f9 }, /* 0.3136213 */
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0x3f6f460c }, /* 0.9346626 */
+	{ .u32 = 0xbed5d2f2 }, /* -0.4176250 */
+	{ .u32 = 0x00250023 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf2917d0 }, /* -0.6605196 */
+	{ .u32 = 0x00290028 },
+	{ .u32 = 0xbf7f78a6 }, /* -0.9979347 */
+	{ .u32 = 0xbdccbe1f }, /* -0.0999720 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f418b3f }, /* 0.7560310 */
+	{ .u32 = 0x3da85f3d }, /* 0.0822129 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0xbecc4b40 }, /* -0.3990116 */
+	{ .u32 = 0x3c8a5d51 }, /* 0.0168902 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d04b9d9 }, /* 0.0324038 */
+	{ .u32 = 0x80030007 },
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e0005 },
+	{ .u32 = 0x3a1712d7 }, /* 0.0005763 */
+	{ .u32 = 0xbd937db4 }, /* -0.0720171 */
+	{ .u32 = 0x00250017 },
+	{ .u32 = 0xbf42f23e }, /* -0.7615088 */
+	{ .u32 = 0xbf641bcb }, /* -0.8910491 */
+	{ .u32 = 0x00290028 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f43b1d4 }, /* 0.7644322 */
+	{ .u32 = 0x0000002d },
+	{ .u32 = 0x3e909291 }, /* 0.2823682 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3b241370 }, /* 0.0025036 */
+	{ .u32 = 0x80030009 },
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x421517ad }, /* 37.2731209 */
+	{ .u32 = 0x001d0019 },
+	{ .u32 = 0xbe575bcb }, /* -0.2103111 */
+	{ .u32 = 0xbf5a8ae1 }, /* -0.8536816 */
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x3f03590a }, /* 0.5130774 */
+	{ .u32 = 0x3deaf46b }, /* 0.1147240 */
+	{ .u32 = 0x001f0026 },
+	{ .u32 = 0xbf45bfff }, /* -0.7724609 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x0028002a },
+	{ .u32 = 0x3dfcfd9c }, /* 0.1235306 */
+	{ .u32 = 0xbf49a490 }, /* -0.7876673 */
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00090007 },
+	{ .u32 = 0xbef9dcef }, /* -0.4880137 */
+	{ .u32 = 0x3d458cb7 }, /* 0.0482299 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3bbafa3c }, /* 0.0057061 */
+	{ .u32 = 0x80040009 },
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0018000c },
+	{ .u32 = 0xbe4e5160 }, /* -0.2014823 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x001d001c },
+	{ .u32 = 0xbe822637 }, /* -0.2541978 */
+	{ .u32 = 0xbf1801bd }, /* -0.5937765 */
+	{ .u32 = 0x00230022 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x002a0026 },
+	{ .u32 = 0xbecda442 }, /* -0.4016438 */
+	{ .u32 = 0x3f3ab244 }, /* 0.7292826 */
+	{ .u32 = 0x0000002b },
+	{ .u32 = 0x3f63aafd }, /* 0.8893278 */
+	{ .u32 = 0x00070001 },
+	{ .u32 = 0xbd9f2064 }, /* -0.0776985 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x3c907747 }, /* 0.0176350 */
+	{ .u32 = 0x80040007 },
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0x3bdf322a }, /* 0.0068114 */
+	{ .u32 = 0xbf00c835 }, /* -0.5030549 */
+	{ .u32 = 0x000a0019 },
+	{ .u32 = 0x3f400000 }, /* 0.7500000 */
+	{ .u32 = 0xbecd20b0 }, /* -0.4006400 */
+	{ .u32 = 0x002f002a },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf61aa09 }, /* -0.8815008 */
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3f4a9d9d }, /* 0.7914675 */
+	{ .u32 = 0x3c204ca7 }, /* 0.0097839 */
+	{ .u32 = 0x80040005 },
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e0006 },
+	{ .u32 = 0x3e8cd6c3 }, /* 0.2750760 */
+	{ .u32 = 0xbe8a33fd }, /* -0.2699279 */
+	{ .u32 = 0x002a001c },
+	{ .u32 = 0x3ec00000 }, /* 0.3750000 */
+	{ .u32 = 0x3f14b140 }, /* 0.5808296 */
+	{ .u32 = 0x00000030 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00050000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbe7d61c7 }, /* -0.2474433 */
+	{ .u32 = 0x000b0007 },
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x3a2dcd2d }, /* 0.0006630 */
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000033 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00180006 },
+	{ .u32 = 0x3c313024 }, /* 0.0108147 */
+	{ .u32 = 0xbee3283e }, /* -0.4436664 */
+	{ .u32 = 0x002a0019 },
+	{ .u32 = 0x3d61862d }, /* 0.0550596 */
+	{ .u32 = 0x3b2d0c3d }, /* 0.0026405 */
+	{ .u32 = 0x0030002c },
+	{ .u32 = 0xbf7601ac }, /* -0.9609630 */
+	{ .u32 = 0x3f7f8000 }, /* 0.9980469 */
+	{ .u32 = 0x000b0005 },
+	{ .u32 = 0x39ed8e0d }, /* 0.0004531 */
+	{ .u32 = 0x3ad92c57 }, /* 0.0016569 */
+	{ .u32 = 0x0001000c },
+	{ .u32 = 0x0000001d },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0xbf2bb94e }, /* -0.6707963 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0020001d },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00220021 },
+	{ .u32 = 0xbf37118f }, /* -0.7151117 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x002f0024 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00310030 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00330032 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e33ee7a }, /* 0.1757144 */
+	{ .u32 = 0x80060001 },
+	{ .u32 = 0x00000021 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x3f2064dc }, /* 0.6265390 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3e9ac468 }, /* 0.3022797 */
+	{ .u32 = 0x00090004 },
+	{ .u32 = 0x3ee00000 }, /* 0.4375000 */
+	{ .u32 = 0x3f66b0ac }, /* 0.9011333 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0x3f1a5c2f }, /* 0.6029691 */
+	{ .u32 = 0xbf700000 }, /* -0.9375000 */
+	{ .u32 = 0x80040004 },
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x002e002a },
+	{ .u32 = 0x3ea00000 }, /* 0.3125000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0xbe9ca3d0 }, /* -0.3059373 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00040003 },
+	{ .u32 = 0x3eaf480a }, /* 0.3423465 */
+	{ .u32 = 0xbd368c84 }, /* -0.0445676 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3a97310a }, /* 0.0011535 */
+	{ .u32 = 0x3b6e0be2 }, /* 0.0036323 */
+	{ .u32 = 0x80060009 },
+	{ .u32 = 0x00000011 },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00170013 },
+	{ .u32 = 0xbdd82d96 }, /* -0.1055557 */
+	{ .u32 = 0xbed3c570 }, /* -0.4136157 */
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0x3f0c4229 }, /* 0.5478845 */
+	{ .u32 = 0xbeccdf08 }, /* -0.4001391 */
+	{ .u32 = 0x002b0011 },
+	{ .u32 = 0x3d807bfe }, /* 0.0627365 */
+	{ .u32 = 0xbe99d3ed }, /* -0.3004450 */
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0xbda640dc }, /* -0.0811784 */
+	{ .u32 = 0xbe079450 }, /* -0.1324017 */
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3f680000 }, /* 0.9062500 */
+	{ .u32 = 0x3c2cb494 }, /* 0.0105411 */
+	{ .u32 = 0x00030002 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0x3d51d8a5 }, /* 0.0512320 */
+	{ .u32 = 0xbc8c084c }, /* -0.0170938 */
+	{ .u32 = 0x80020005 },
+	{ .u32 = 0x0000002a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x0015000c },
+	{ .u32 = 0xbd41c369 }, /* -0.0473055 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0030002f },
+	{ .u32 = 0xbf2c0943 }, /* -0.6720163 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00000031 },
+	{ .u32 = 0x3f0e62b2 }, /* 0.5561935 */
+	{ .u32 = 0x000b0001 },
+	{ .u32 = 0x3d2a4f44 }, /* 0.0415795 */
+	{ .u32 = 0x3b12684d }, /* 0.0022340 */
+	{ .u32 = 0x80020007 },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x000c0006 },
+	{ .u32 = 0x3bcd4167 }, /* 0.0062639 */
+	{ .u32 = 0xbf6bd272 }, /* -0.9211799 */
+	{ .u32 = 0x00180015 },
+	{ .u32 = 0xbf20c723 }, /* -0.6280386 */
+	{ .u32 = 0xbf078437 }, /* -0.5293612 */
+	{ .u32 = 0x00230020 },
+	{ .u32 = 0xbf064838 }, /* -0.5245395 */
+	{ .u32 = 0x3ea4b43d }, /* 0.3216876 */
+	{ .u32 = 0x0000002f },
+	{ .u32 = 0x3ef022fc }, /* 0.4690169 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3e2e3737 }, /* 0.1701325 */
+	{ .u32 = 0x3b58086a }, /* 0.0032964 */
+	{ .u32 = 0x00010011 },
+	{ .u32 = 0x0000000a },
+	{ .u32 = 0x42160663 }, /* 37.5062370 */
+	{ .u32 = 0x00080000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000f000e },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00130010 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x000a0015 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f7ffff6 }, /* 0.9999994 */
+	{ .u32 = 0x00210023 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf200000 }, /* -0.6250000 */
+	{ .u32 = 0x002b001f },
+	{ .u32 = 0x3f354d16 }, /* 0.7082075 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0022002c },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x002a0011 },
+	{ .u32 = 0x3f60c681 }, /* 0.8780289 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x00000000 }, /* 0.0000000 */
+	{ .u32 = 0x80050003 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00200004 },
+	{ .u32 = 0x3f46f937 }, /* 0.7772402 */
+	{ .u32 = 0x3f000000 }, /* 0.5000000 */
+	{ .u32 = 0x00000024 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00020000 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00080007 },
+	{ .u32 = 0x3d4d5a76 }, /* 0.0501351 */
+	{ .u32 = 0xbf3fe8fe }, /* -0.7496489 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe78fc0d }, /* -0.2431490 */
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00170008 },
+	{ .u32 = 0x3e611a04 }, /* 0.2198258 */
+	{ .u32 = 0xbcc73c6a }, /* -0.0243208 */
+	{ .u32 = 0x00280019 },
+	{ .u32 = 0xbf215146 }, /* -0.6301464 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000b0000 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3be4f5b8 }, /* 0.0069873 */
+	{ .u32 = 0x8003000a },
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000e000d },
+	{ .u32 = 0xbf4d1745 }, /* -0.8011363 */
+	{ .u32 = 0xbe58f05c }, /* -0.2118544 */
+	{ .u32 = 0x00200017 },
+	{ .u32 = 0xbf600000 }, /* -0.8750000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0029001e },
+	{ .u32 = 0x3dfdeaf5 }, /* 0.1239833 */
+	{ .u32 = 0x3e10408a }, /* 0.1408712 */
+	{ .u32 = 0x0008002d },
+	{ .u32 = 0x3f555463 }, /* 0.8333189 */
+	{ .u32 = 0x3e977aa6 }, /* 0.2958576 */
+	{ .u32 = 0x00110022 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0x00070000 },
+	{ .u32 = 0x3f2fe4be }, /* 0.6870841 */
+	{ .u32 = 0xbf780000 }, /* -0.9687500 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3c32e459 }, /* 0.0109187 */
+	{ .u32 = 0x00010011 },
+	{ .u32 = 0x00000004 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000d0007 },
+	{ .u32 = 0x3ed3ebc7 }, /* 0.4139082 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00170016 },
+	{ .u32 = 0xbf67fffe }, /* -0.9062499 */
+	{ .u32 = 0x3f600000 }, /* 0.8750000 */
+	{ .u32 = 0x00190018 },
+	{ .u32 = 0xbf7a92f4 }, /* -0.9788048 */
+	{ .u32 = 0x3effffba }, /* 0.4999979 */
+	{ .u32 = 0x001c001a },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00260025 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00270004 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x002d0028 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0008002e },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0000000c },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbec116d4 }, /* -0.3771273 */
+	{ .u32 = 0x8004000b },
+	{ .u32 = 0x0000000e },
+	{ .u32 = 0x420f3fca }, /* 35.8122940 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf7fffc4 }, /* -0.9999964 */
+	{ .u32 = 0x3ec5d29e }, /* 0.3863725 */
+	{ .u32 = 0x00070005 },
+	{ .u32 = 0x3eaf2d61 }, /* 0.3421431 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00150014 },
+	{ .u32 = 0x3f376452 }, /* 0.7163745 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0020001c },
+	{ .u32 = 0x3f420057 }, /* 0.7578177 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00290024 },
+	{ .u32 = 0xbe26f2ef }, /* -0.1630361 */
+	{ .u32 = 0xbf0a2974 }, /* -0.5396950 */
+	{ .u32 = 0x0000002e },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x00040002 },
+	{ .u32 = 0xbe800025 }, /* -0.2500011 */
+	{ .u32 = 0xbee5ccfe }, /* -0.4488296 */
+	{ .u32 = 0x000b0009 },
+	{ .u32 = 0xbeaf0c7b }, /* -0.3418921 */
+	{ .u32 = 0xbf67fb79 }, /* -0.9061809 */
+	{ .u32 = 0x80030008 },
+	{ .u32 = 0x00000010 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00140000 },
+	{ .u32 = 0x3ee76c59 }, /* 0.4519985 */
+	{ .u32 = 0xbf5f07bd }, /* -0.8712118 */
+	{ .u32 = 0x00250016 },
+	{ .u32 = 0xbf000000 }, /* -0.5000000 */
+	{ .u32 = 0xbf795e7b }, /* -0.9740979 */
+	{ .u32 = 0x00280026 },
+	{ .u32 = 0xbf7124d6 }, /* -0.9419683 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x002d0029 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f5f856e }, /* 0.8731297 */
+	{ .u32 = 0x000a0008 },
+	{ .u32 = 0x3f6eca8d }, /* 0.9327782 */
+	{ .u32 = 0x3e6485a7 }, /* 0.2231661 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbec0ba52 }, /* -0.3764215 */
+	{ .u32 = 0x8005000b },
+	{ .u32 = 0x00000001 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0x3b316491 }, /* 0.0027068 */
+	{ .u32 = 0xbef0bb2c }, /* -0.4701780 */
+	{ .u32 = 0x000d0006 },
+	{ .u32 = 0xbc39e569 }, /* -0.0113462 */
+	{ .u32 = 0xbf47152f }, /* -0.7776670 */
+	{ .u32 = 0x0015000f },
+	{ .u32 = 0xbf5e2000 }, /* -0.8676758 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00290025 },
+	{ .u32 = 0x3ec0ba69 }, /* 0.3764222 */
+	{ .u32 = 0x3f10512c }, /* 0.5637386 */
+	{ .u32 = 0x0008002d },
+	{ .u32 = 0xbf7a0000 }, /* -0.9765625 */
+	{ .u32 = 0x3ec67a9c }, /* 0.3876542 */
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0xbd0ad271 }, /* -0.0338921 */
+	{ .u32 = 0x00010000 },
+	{ .u32 = 0xbf3be1aa }, /* -0.7339121 */
+	{ .u32 = 0x3d9f488d }, /* 0.0777751 */
+	{ .u32 = 0x000a0004 },
+	{ .u32 = 0x3d2b71d4 }, /* 0.0418566 */
+	{ .u32 = 0xbe143b35 }, /* -0.1447571 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3d98e0e5 }, /* 0.0746477 */
+	{ .u32 = 0x80020004 },
+	{ .u32 = 0x00000002 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00150002 },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x3f213743 }, /* 0.6297495 */
+	{ .u32 = 0x0032002e },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0x3f7abcde }, /* 0.9794444 */
+	{ .u32 = 0x3f007c56 }, /* 0.5018972 */
+	{ .u32 = 0x80020003 },
+	{ .u32 = 0x00000008 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x0016000f },
+	{ .u32 = 0x3f71e521 }, /* 0.9449025 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00000032 },
+	{ .u32 = 0x3f4e92f4 }, /* 0.8069298 */
+	{ .u32 = 0x000b000a },
+	{ .u32 = 0xbed45ecb }, /* -0.4147857 */
+	{ .u32 = 0x3a9be249 }, /* 0.0011893 */
+	{ .u32 = 0x8003000d },
+	{ .u32 = 0x00000006 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x00070006 },
+	{ .u32 = 0xbf78dd7c }, /* -0.9721296 */
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x0014000f },
+	{ .u32 = 0x3f267ca0 }, /* 0.6503391 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00170015 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0x3f558466 }, /* 0.8340515 */
+	{ .u32 = 0x0020001b },
+	{ .u32 = 0x3f7e0000 }, /* 0.9921875 */
+	{ .u32 = 0xbee3becb }, /* -0.4448150 */
+	{ .u32 = 0x00290024 },
+	{ .u32 = 0x3f5eb60a }, /* 0.8699652 */
+	{ .u32 = 0xbec60dc2 }, /* -0.3868237 */
+	{ .u32 = 0x0032002e },
+	{ .u32 = 0x3f7ffffe }, /* 0.9999999 */
+	{ .u32 = 0x3eb3ade6 }, /* 0.3509361 */
+	{ .u32 = 0x00000022 },
+	{ .u32 = 0x3f75b404 }, /* 0.9597781 */
+	{ .u32 = 0x00090001 },
+	{ .u32 = 0xbf21bed0 }, /* -0.6318178 */
+	{ .u32 = 0xbe50c946 }, /* -0.2038928 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0xbe9f8bd5 }, /* -0.3116137 */
+	{ .u32 = 0x80020006 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000f0000 },
+	{ .u32 = 0x3e9057e6 }, /* 0.2819206 */
+	{ .u32 = 0xbf429a01 }, /* -0.7601624 */
+	{ .u32 = 0x00140013 },
+	{ .u32 = 0x3ea794c5 }, /* 0.3273069 */
+	{ .u32 = 0xbdbeace4 }, /* -0.0931032 */
+	{ .u32 = 0x000c0015 },
+	{ .u32 = 0x3f1fc449 }, /* 0.6240888 */
+	{ .u32 = 0xbd9df663 }, /* -0.0771301 */
+	{ .u32 = 0x000b0004 },
+	{ .u32 = 0xbe997717 }, /* -0.2997367 */
+	{ .u32 = 0x3cf993a0 }, /* 0.0304659 */
+	{ .u32 = 0x00010009 },
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x42200000 }, /* 40.0000000 */
+	{ .u32 = 0x000b0005 },
+	{ .u32 = 0xbefb4224 }, /* -0.4907390 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x0010000e },
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00020001 },
+	{ .u32 = 0x3f800000 }, /* 1.0000000 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00060008 },
+	{ .u32 = 0x3f7c0000 }, /* 0.9843750 */
+	{ .u32 = 0xbf800000 }, /* -1.0000000 */
+	{ .u32 = 0x00000000 },
+	{ .u32 = 0x3eae0002 }, /* 0.3398438 */
+	{ .u32 = 0x0000000b },
+	{ .u32 = 0x3e52e3c5 }, /* 0.2059470 */
+};
+#endif
+
+#endif /* _NRF_EDGEAI_USER_MODEL_PACKED_H_ */
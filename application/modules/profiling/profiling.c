@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+#include "profiling.h"
+
+LOG_MODULE_REGISTER(app_profiling, CONFIG_APP_PROFILING_LOG_LEVEL);
+
+/* Zbus channel for periodic statistics reports */
+ZBUS_CHAN_DEFINE(profiling_chan,
+		 struct profiling_report,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+/* Log-linear histogram, four buckets per power of two over the 32-bit range */
+#define PROFILING_BUCKET_SUB_BITS 2
+#define PROFILING_BUCKETS_NUM 124
+
+struct profiling_stage_data {
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint16_t buckets[PROFILING_BUCKETS_NUM];
+};
+
+static struct profiling_stage_data stages[PROFILING_STAGE_NUM];
+static struct k_spinlock profiling_lock;
+
+static const char *const STAGE_NAMES[PROFILING_STAGE_TIME_FEATURE_0] = {
+	[PROFILING_STAGE_FEED_INPUTS] = "feed_inputs",
+	[PROFILING_STAGE_PROCESS_FEATURES] = "process_features",
+	[PROFILING_STAGE_RUN_INFERENCE] = "run_inference",
+	[PROFILING_STAGE_PROPAGATE_OUTPUTS] = "propagate_outputs",
+	[PROFILING_STAGE_DECODE_OUTPUTS] = "decode_outputs",
+};
+
+#define TIME_FEATURE_NAME(i, _) "time_feature_" #i
+static const char *const TIME_FEATURE_NAMES[PROFILING_TIME_FEATURES_MAX] = {
+	LISTIFY(PROFILING_TIME_FEATURES_MAX, TIME_FEATURE_NAME, (,))
+};
+
+static uint16_t bucket_index(uint32_t cycles)
+{
+	uint32_t msb;
+
+	if (cycles < BIT(PROFILING_BUCKET_SUB_BITS)) {
+		return cycles;
+	}
+
+	msb = 31 - __builtin_clz(cycles);
+
+	return ((msb - 1) << PROFILING_BUCKET_SUB_BITS) +
+	       ((cycles >> (msb - PROFILING_BUCKET_SUB_BITS)) & BIT_MASK(PROFILING_BUCKET_SUB_BITS));
+}
+
+static uint32_t bucket_upper_bound(uint16_t index)
+{
+	uint32_t msb = (index >> PROFILING_BUCKET_SUB_BITS) + 1;
+	uint32_t sub = index & BIT_MASK(PROFILING_BUCKET_SUB_BITS);
+
+	if (index < BIT(PROFILING_BUCKET_SUB_BITS)) {
+		return index;
+	}
+
+	return (uint32_t)((((uint64_t)BIT(PROFILING_BUCKET_SUB_BITS) + sub + 1)
+			   << (msb - PROFILING_BUCKET_SUB_BITS)) - 1);
+}
+
+void profiling_record(enum profiling_stage stage, uint32_t cycles)
+{
+	struct profiling_stage_data *data;
+	k_spinlock_key_t key;
+	uint16_t index = bucket_index(cycles);
+
+	if (stage >= PROFILING_STAGE_NUM) {
+		return;
+	}
+
+	data = &stages[stage];
+	key = k_spin_lock(&profiling_lock);
+
+	data->min = (data->count == 0) ? cycles : MIN(data->min, cycles);
+	data->max = MAX(data->max, cycles);
+	data->sum += cycles;
+	data->count++;
+
+	/* Halve every bucket on overflow, the percentiles keep their shape */
+	if (data->buckets[index] == UINT16_MAX) {
+		for (uint16_t i = 0; i < PROFILING_BUCKETS_NUM; i++) {
+			data->buckets[i] = (data->buckets[i] + 1) / 2;
+		}
+	}
+	data->buckets[index]++;
+
+	k_spin_unlock(&profiling_lock, key);
+}
+
+static uint32_t stage_p99(const struct profiling_stage_data *data)
+{
+	uint64_t total = 0;
+	uint64_t target;
+	uint64_t sum = 0;
+
+	for (uint16_t i = 0; i < PROFILING_BUCKETS_NUM; i++) {
+		total += data->buckets[i];
+	}
+
+	/* Smallest bucket covering 99 % of the measurements */
+	target = DIV_ROUND_UP(total * 99, 100);
+
+	for (uint16_t i = 0; i < PROFILING_BUCKETS_NUM; i++) {
+		sum += data->buckets[i];
+		if (sum >= target) {
+			return MIN(bucket_upper_bound(i), data->max);
+		}
+	}
+
+	return data->max;
+}
+
+void profiling_get(enum profiling_stage stage, struct profiling_stats *stats)
+{
+	const struct profiling_stage_data *data;
+	k_spinlock_key_t key;
+
+	memset(stats, 0, sizeof(*stats));
+
+	if (stage >= PROFILING_STAGE_NUM) {
+		return;
+	}
+
+	data = &stages[stage];
+	key = k_spin_lock(&profiling_lock);
+
+	if (data->count > 0) {
+		stats->count = data->count;
+		stats->min = data->min;
+		stats->avg = (uint32_t)(data->sum / data->count);
+		stats->max = data->max;
+		stats->p99 = stage_p99(data);
+	}
+
+	k_spin_unlock(&profiling_lock, key);
+}
+
+void profiling_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&profiling_lock);
+
+	memset(stages, 0, sizeof(stages));
+
+	k_spin_unlock(&profiling_lock, key);
+}
+
+const char *profiling_stage_name(enum profiling_stage stage)
+{
+	if (stage < PROFILING_STAGE_TIME_FEATURE_0) {
+		return STAGE_NAMES[stage];
+	}
+
+	if (stage < PROFILING_STAGE_NUM) {
+		return TIME_FEATURE_NAMES[stage - PROFILING_STAGE_TIME_FEATURE_0];
+	}
+
+	return "unknown";
+}
+
+static uint32_t profiling_cycles_per_sec(void)
+{
+#if defined(CONFIG_APP_PROFILING_COUNTER_DWT)
+	return SystemCoreClock;
+#else
+	return sys_clock_hw_cycles_per_sec();
+#endif
+}
+
+#if CONFIG_APP_PROFILING_REPORT_INTERVAL_MS > 0
+static struct profiling_report report;
+
+static void profiling_report_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	int ret;
+
+	report.timestamp = k_uptime_get_32();
+	for (int i = 0; i < PROFILING_STAGE_NUM; i++) {
+		profiling_get(i, &report.stages[i]);
+	}
+
+	ret = zbus_chan_pub(&profiling_chan, &report, K_NO_WAIT);
+	if (ret) {
+		LOG_WRN("Failed to publish report: %d", ret);
+	}
+
+	k_work_schedule(dwork, K_MSEC(CONFIG_APP_PROFILING_REPORT_INTERVAL_MS));
+}
+
+static K_WORK_DELAYABLE_DEFINE(profiling_report_work, profiling_report_work_fn);
+#endif
+
+int profiling_init(void)
+{
+#if defined(CONFIG_APP_PROFILING_COUNTER_DWT)
+	uint32_t start;
+
+	if (DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) {
+		LOG_ERR("DWT cycle counter not implemented");
+		return -ENOTSUP;
+	}
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	/* Counting can be blocked for the non-secure image by the debug configuration */
+	start = DWT->CYCCNT;
+	k_busy_wait(10);
+	if (DWT->CYCCNT == start) {
+		LOG_ERR("DWT cycle counter not running");
+		return -EACCES;
+	}
+#endif
+
+	profiling_reset();
+
+#if CONFIG_APP_PROFILING_REPORT_INTERVAL_MS > 0
+	k_work_schedule(&profiling_report_work, K_MSEC(CONFIG_APP_PROFILING_REPORT_INTERVAL_MS));
+#endif
+
+	LOG_INF("Profiling at %u cycles/s", profiling_cycles_per_sec());
+	return 0;
+}
+
+#if defined(CONFIG_SHELL)
+static int cmd_profiling_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct profiling_stats stats;
+
+	shell_print(sh, "Cycles at %u cycles/s", profiling_cycles_per_sec());
+	shell_print(sh, "%-18s %8s %8s %8s %8s %8s", "stage", "count", "min", "avg", "max", "p99");
+
+	for (int i = 0; i < PROFILING_STAGE_NUM; i++) {
+		profiling_get(i, &stats);
+		if (stats.count == 0) {
+			continue;
+		}
+
+		shell_print(sh, "%-18s %8u %8u %8u %8u %8u", profiling_stage_name(i),
+			    stats.count, stats.min, stats.avg, stats.max, stats.p99);
+	}
+
+	return 0;
+}
+
+static int cmd_profiling_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	profiling_reset();
+	shell_print(sh, "Profiling statistics cleared");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(profiling_cmds,
+	SHELL_CMD(show, NULL, "Show cycle statistics per stage", cmd_profiling_show),
+	SHELL_CMD(reset, NULL, "Clear cycle statistics", cmd_profiling_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(profiling, &profiling_cmds, "Inference pipeline profiling", NULL);
+#endif
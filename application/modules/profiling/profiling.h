@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILING_H_
+#define _PROFILING_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include <stdint.h>
+
+#if defined(CONFIG_APP_PROFILING_COUNTER_DWT)
+#include <cmsis_core.h>
+#endif
+
+/* Maximum number of time-domain feature functions timed separately */
+#define PROFILING_TIME_FEATURES_MAX 12
+
+/* Timed stages of the inference pipeline */
+enum profiling_stage {
+	PROFILING_STAGE_FEED_INPUTS,
+	PROFILING_STAGE_PROCESS_FEATURES,
+	PROFILING_STAGE_RUN_INFERENCE,
+	PROFILING_STAGE_PROPAGATE_OUTPUTS,
+	PROFILING_STAGE_DECODE_OUTPUTS,
+	/* One stage per entry of the time-domain feature pipeline */
+	PROFILING_STAGE_TIME_FEATURE_0,
+	PROFILING_STAGE_NUM = PROFILING_STAGE_TIME_FEATURE_0 + PROFILING_TIME_FEATURES_MAX,
+};
+
+/* Cycle statistics of one stage */
+struct profiling_stats {
+	uint32_t count;
+	uint32_t min;
+	uint32_t avg;
+	uint32_t max;
+	/* Upper bound of the histogram bucket holding the 99th percentile */
+	uint32_t p99;
+};
+
+/* Statistics report published on profiling_chan */
+struct profiling_report {
+	uint32_t timestamp;
+	struct profiling_stats stages[PROFILING_STAGE_NUM];
+};
+
+/* Zbus channel declaration */
+ZBUS_CHAN_DECLARE(profiling_chan);
+
+/**
+ * @brief Read the cycle counter
+ * @return Current cycle count, wraps around
+ */
+static inline uint32_t profiling_cycles(void)
+{
+#if defined(CONFIG_APP_PROFILING_COUNTER_DWT)
+	return DWT->CYCCNT;
+#else
+	return k_cycle_get_32();
+#endif
+}
+
+/**
+ * @brief Start the cycle counter and clear all statistics
+ * @return 0 on success, negative error code on failure
+ */
+int profiling_init(void);
+
+/**
+ * @brief Add one measurement to the statistics of a stage
+ * @param stage Timed stage
+ * @param cycles Cycles spent in the stage
+ */
+void profiling_record(enum profiling_stage stage, uint32_t cycles);
+
+/**
+ * @brief Get the statistics of a stage
+ * @param stage Timed stage
+ * @param stats Statistics, all zero if the stage was never recorded
+ */
+void profiling_get(enum profiling_stage stage, struct profiling_stats *stats);
+
+/**
+ * @brief Clear the statistics of all stages
+ */
+void profiling_reset(void);
+
+/**
+ * @brief Get the name of a stage
+ * @param stage Timed stage
+ * @return Stage name
+ */
+const char *profiling_stage_name(enum profiling_stage stage);
+
+#endif /* _PROFILING_H_ */
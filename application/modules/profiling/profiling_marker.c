@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "profiling_marker.h"
+
+LOG_MODULE_REGISTER(app_profiling_marker, CONFIG_APP_PROFILING_LOG_LEVEL);
+
+#define MARKER_NODE DT_PATH(zephyr_user)
+
+BUILD_ASSERT(DT_NODE_HAS_PROP(MARKER_NODE, profiling_gpios),
+	     "CONFIG_APP_PROFILING_MARKERS needs profiling-gpios in the zephyr,user node");
+
+/* One GPIO per stage, stages past the end of the property have none */
+static const struct gpio_dt_spec marker_gpios[] = {
+	DT_FOREACH_PROP_ELEM_SEP(MARKER_NODE, profiling_gpios, GPIO_DT_SPEC_GET_BY_IDX, (,))
+};
+
+BUILD_ASSERT(ARRAY_SIZE(marker_gpios) <= PROFILING_MARKER_NUM,
+	     "profiling-gpios has more entries than there are stages");
+
+int profiling_marker_init(void)
+{
+	int ret;
+
+	for (size_t i = 0; i < ARRAY_SIZE(marker_gpios); i++) {
+		if (!gpio_is_ready_dt(&marker_gpios[i])) {
+			LOG_ERR("Marker GPIO %zu not ready", i);
+			return -ENODEV;
+		}
+
+		ret = gpio_pin_configure_dt(&marker_gpios[i], GPIO_OUTPUT_INACTIVE);
+		if (ret) {
+			LOG_ERR("Failed to configure marker GPIO %zu: %d", i, ret);
+			return ret;
+		}
+	}
+
+	LOG_INF("%zu pipeline stages marked on GPIOs", ARRAY_SIZE(marker_gpios));
+
+	return 0;
+}
+
+void profiling_marker_set(enum profiling_marker marker, int active)
+{
+	if (marker < ARRAY_SIZE(marker_gpios)) {
+		(void)gpio_pin_set_dt(&marker_gpios[marker], active);
+	}
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILING_MARKER_H_
+#define _PROFILING_MARKER_H_
+
+#include <zephyr/toolchain.h>
+
+/*
+ * Pipeline stages marked on GPIOs, in the order of the profiling-gpios
+ * property of the zephyr,user devicetree node
+ */
+enum profiling_marker {
+	/* Sensor read of a sample or FIFO batch */
+	PROFILING_MARKER_SAMPLING,
+	/* Samples fed into the model windows */
+	PROFILING_MARKER_FEED,
+	/* Feature extraction of a full window */
+	PROFILING_MARKER_FEATURES,
+	/* Neural network inference */
+	PROFILING_MARKER_INFERENCE,
+	/* Decoding, smoothing and publishing of the result */
+	PROFILING_MARKER_PUBLISH,
+	PROFILING_MARKER_NUM,
+};
+
+#if defined(CONFIG_APP_PROFILING_MARKERS)
+/**
+ * @brief Configure the marker GPIOs as inactive outputs
+ * @return 0 on success, negative error code on failure
+ */
+int profiling_marker_init(void);
+
+/**
+ * @brief Drive the GPIO of a stage
+ *
+ * Stages without a GPIO in profiling-gpios are ignored.
+ *
+ * @param marker Stage
+ * @param active 1 on entry, 0 on exit
+ */
+void profiling_marker_set(enum profiling_marker marker, int active);
+#endif
+
+/**
+ * @brief Mark the entry of a stage, compiled out without CONFIG_APP_PROFILING_MARKERS
+ * @param marker Stage
+ */
+static inline void profiling_marker_begin(enum profiling_marker marker)
+{
+#if defined(CONFIG_APP_PROFILING_MARKERS)
+	profiling_marker_set(marker, 1);
+#else
+	ARG_UNUSED(marker);
+#endif
+}
+
+/**
+ * @brief Mark the exit of a stage, compiled out without CONFIG_APP_PROFILING_MARKERS
+ * @param marker Stage
+ */
+static inline void profiling_marker_end(enum profiling_marker marker)
+{
+#if defined(CONFIG_APP_PROFILING_MARKERS)
+	profiling_marker_set(marker, 0);
+#else
+	ARG_UNUSED(marker);
+#endif
+}
+
+#endif /* _PROFILING_MARKER_H_ */
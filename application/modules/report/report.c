@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_ncs.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+#include <modem/lte_lc.h>
+#include <modem/nrf_modem_lib.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include "report.h"
+#include "report_encode.h"
+#include "detection.h"
+#include "../sampling/sampling.h"
+
+LOG_MODULE_REGISTER(app_report, CONFIG_APP_REPORT_LOG_LEVEL);
+
+#if defined(CONFIG_APP_REPORT_SUMMARY)
+BUILD_ASSERT(CONFIG_APP_REPORT_PAYLOAD_MAX >= REPORT_SUMMARY_SIZE_MAX,
+	     "Payload too small for one summary");
+#else
+BUILD_ASSERT(CONFIG_APP_REPORT_PAYLOAD_MAX >= REPORT_HEADER_SIZE_MAX + REPORT_EVENT_SIZE_MAX,
+	     "Payload too small for one event");
+#endif
+
+/* Report thread */
+#define REPORT_STACK_SIZE 2048
+#define REPORT_PRIORITY 10
+
+/* Wait before retrying after a failed uplink */
+#define REPORT_RETRY_DELAY K_SECONDS(60)
+
+static struct k_spinlock report_lock;
+static struct report_stats report_stats;
+
+#if defined(CONFIG_APP_REPORT_SUMMARY)
+/* Summaries waiting for an uplink, in the order they were taken */
+K_MSGQ_DEFINE(summary_msgq, sizeof(struct detection_summary), CONFIG_APP_REPORT_SUMMARY_QUEUE, 4);
+#else
+/* Models whose class changes are tracked, results of later models are always queued */
+#define REPORT_MODELS_MAX 8
+
+/* Events waiting for an uplink, oldest at ring_head */
+static struct report_event ring[CONFIG_APP_REPORT_RING_SIZE];
+static uint16_t ring_head;
+static uint16_t ring_count;
+/* Sequence number of the event at ring_head */
+static uint32_t ring_first_seq;
+
+#if defined(CONFIG_APP_REPORT_CHANGES_ONLY)
+static uint16_t last_class[REPORT_MODELS_MAX] = {
+	[0 ... REPORT_MODELS_MAX - 1] = UINT16_MAX,
+};
+#endif
+
+static struct report_event batch[CONFIG_APP_REPORT_BATCH_EVENTS];
+#endif /* CONFIG_APP_REPORT_SUMMARY */
+
+static uint8_t payload[CONFIG_APP_REPORT_PAYLOAD_MAX];
+
+static K_SEM_DEFINE(report_sem, 0, 1);
+/* Send the queued events on the next wakeup, before they are due */
+static atomic_t send_requested;
+static atomic_t lte_registered;
+static int report_fd = -1;
+
+static void report_thread_fn(void *arg1, void *arg2, void *arg3);
+K_THREAD_DEFINE(report_thread, REPORT_STACK_SIZE,
+		report_thread_fn, NULL, NULL, NULL,
+		REPORT_PRIORITY, 0, 0);
+
+/* Wake the report thread, to send or to reschedule the deadline of the oldest event */
+static void report_wake(bool send)
+{
+	if (send) {
+		atomic_set(&send_requested, true);
+	}
+
+	k_sem_give(&report_sem);
+}
+
+#if defined(CONFIG_APP_REPORT_SUMMARY)
+static void report_listener_callback(const struct zbus_channel *chan)
+{
+	const struct detection_summary *summary = zbus_chan_const_msg(chan);
+	k_spinlock_key_t key;
+	int ret;
+
+	/*
+	 * The report thread removes a summary only after sending it, so a full
+	 * queue drops the newest summary and the queued ones keep their order
+	 */
+	ret = k_msgq_put(&summary_msgq, summary, K_NO_WAIT);
+
+	key = k_spin_lock(&report_lock);
+	if (ret) {
+		report_stats.dropped++;
+	}
+	report_stats.events++;
+	k_spin_unlock(&report_lock, key);
+
+	report_wake(true);
+}
+#else
+static uint16_t report_pending(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&report_lock);
+	uint16_t count = ring_count;
+
+	k_spin_unlock(&report_lock, key);
+
+	return count;
+}
+
+static void report_listener_callback(const struct zbus_channel *chan)
+{
+	const struct detection_result *result = zbus_chan_const_msg(chan);
+	k_spinlock_key_t key;
+	uint16_t count;
+
+#if defined(CONFIG_APP_REPORT_CHANGES_ONLY)
+	if (result->model < REPORT_MODELS_MAX) {
+		if (last_class[result->model] == result->predicted_class) {
+			return;
+		}
+
+		last_class[result->model] = result->predicted_class;
+	}
+#endif
+
+	const struct report_event event = {
+		.timestamp_ms = result->timestamp,
+		.predicted_class = result->predicted_class,
+		.model = result->model,
+		.confidence_pct = (uint8_t)CLAMP(result->confidence * 100.0f, 0.0f, 100.0f),
+	};
+
+	key = k_spin_lock(&report_lock);
+
+	/* A full ring drops the oldest event, the server sees a sequence gap */
+	if (ring_count == ARRAY_SIZE(ring)) {
+		ring_head = (ring_head + 1) % ARRAY_SIZE(ring);
+		ring_count--;
+		ring_first_seq++;
+		report_stats.dropped++;
+	}
+
+	ring[(ring_head + ring_count) % ARRAY_SIZE(ring)] = event;
+	ring_count++;
+	report_stats.events++;
+	count = ring_count;
+
+	k_spin_unlock(&report_lock, key);
+
+	if (count == 1 || count >= CONFIG_APP_REPORT_BATCH_EVENTS) {
+		report_wake(count >= CONFIG_APP_REPORT_BATCH_EVENTS);
+	}
+}
+
+#endif /* CONFIG_APP_REPORT_SUMMARY */
+
+ZBUS_LISTENER_DEFINE(report_listener, report_listener_callback);
+
+static void report_lte_handler(const struct lte_lc_evt *const evt)
+{
+	switch (evt->type) {
+	case LTE_LC_EVT_NW_REG_STATUS: {
+		bool registered = evt->nw_reg_status == LTE_LC_NW_REG_REGISTERED_HOME ||
+				  evt->nw_reg_status == LTE_LC_NW_REG_REGISTERED_ROAMING;
+
+		if (atomic_set(&lte_registered, registered) != registered) {
+			LOG_INF("LTE %s", registered ? "registered" : "not registered");
+		}
+
+		if (registered) {
+			report_wake(false);
+		}
+		break;
+	}
+#if defined(CONFIG_APP_REPORT_EVENTS)
+	case LTE_LC_EVT_RRC_UPDATE:
+		/* The radio is up anyway, e.g. for a periodic TAU, so piggyback on it */
+		if (evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED &&
+		    report_pending() >= CONFIG_APP_REPORT_PIGGYBACK_EVENTS) {
+			report_wake(true);
+		}
+		break;
+#endif
+	case LTE_LC_EVT_PSM_UPDATE:
+		LOG_INF("PSM TAU %d s, active time %d s", evt->psm_cfg.tau,
+			evt->psm_cfg.active_time);
+		break;
+	case LTE_LC_EVT_EDRX_UPDATE:
+		LOG_INF("eDRX cycle %.2f s, PTW %.2f s", (double)evt->edrx_cfg.edrx,
+			(double)evt->edrx_cfg.ptw);
+		break;
+	default:
+		break;
+	}
+}
+
+static int report_connect(void)
+{
+	struct zsock_addrinfo hints = {
+		.ai_family = AF_INET,
+		.ai_socktype = SOCK_DGRAM,
+	};
+	struct zsock_addrinfo *res;
+	char port[6];
+	int ret;
+
+	snprintf(port, sizeof(port), "%d", CONFIG_APP_REPORT_SERVER_PORT);
+
+	ret = zsock_getaddrinfo(CONFIG_APP_REPORT_SERVER_HOST, port, &hints, &res);
+	if (ret) {
+		LOG_ERR("Failed to resolve %s: %d", CONFIG_APP_REPORT_SERVER_HOST, ret);
+		return -EHOSTUNREACH;
+	}
+
+	report_fd = zsock_socket(res->ai_family, SOCK_DGRAM, IPPROTO_UDP);
+	if (report_fd < 0) {
+		ret = -errno;
+		LOG_ERR("Failed to create socket: %d", ret);
+		zsock_freeaddrinfo(res);
+		return ret;
+	}
+
+	ret = zsock_connect(report_fd, res->ai_addr, res->ai_addrlen);
+	zsock_freeaddrinfo(res);
+	if (ret) {
+		ret = -errno;
+		LOG_ERR("Failed to connect socket: %d", ret);
+		zsock_close(report_fd);
+		report_fd = -1;
+		return ret;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Send the encoded payload as one datagram
+ * @param len Payload length
+ * @param last Nothing else is queued, so the RRC connection can be released
+ * @return 0 on success, negative error code with the socket closed otherwise
+ */
+static int report_datagram(size_t len, bool last)
+{
+	int rai = last ? RAI_LAST : RAI_ONGOING;
+	k_spinlock_key_t key;
+	int ret;
+
+	ret = zsock_setsockopt(report_fd, SOL_SOCKET, SO_RAI, &rai, sizeof(rai));
+	if (ret) {
+		LOG_DBG("Failed to set RAI: %d", -errno);
+	}
+
+	ret = zsock_send(report_fd, payload, len, 0);
+	if (ret < 0) {
+		ret = -errno;
+
+		key = k_spin_lock(&report_lock);
+		report_stats.send_errors++;
+		k_spin_unlock(&report_lock, key);
+
+		/* Resolve the server again on the next attempt */
+		zsock_close(report_fd);
+		report_fd = -1;
+		return ret;
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_APP_REPORT_SUMMARY)
+/* Send every queued summary, one datagram each */
+static int report_send_queued(void)
+{
+	struct detection_summary summary;
+	k_spinlock_key_t key;
+	int ret;
+
+	while (k_msgq_peek(&summary_msgq, &summary) == 0) {
+		size_t len = report_encode_summary(&summary, payload);
+
+		ret = report_datagram(len, k_msgq_num_used_get(&summary_msgq) == 1);
+		if (ret) {
+			LOG_WRN("Failed to send summary: %d", ret);
+			return ret;
+		}
+
+		(void)k_msgq_get(&summary_msgq, &summary, K_NO_WAIT);
+
+		key = k_spin_lock(&report_lock);
+		report_stats.sent++;
+		report_stats.uplinks++;
+		k_spin_unlock(&report_lock, key);
+
+		LOG_DBG("Sent summary of model %u in %zu bytes", summary.model, len);
+	}
+
+	return 0;
+}
+
+/* Summaries are sent as soon as they are taken */
+static k_timeout_t report_timeout(void)
+{
+	return K_FOREVER;
+}
+#else
+/* Remove the events up to a sequence number, unless they were dropped meanwhile */
+static void report_release(uint32_t end_seq, uint16_t sent)
+{
+	k_spinlock_key_t key = k_spin_lock(&report_lock);
+	int32_t num = (int32_t)(end_seq - ring_first_seq);
+
+	if (num > 0) {
+		num = MIN(num, ring_count);
+		ring_head = (ring_head + num) % ARRAY_SIZE(ring);
+		ring_count -= num;
+		ring_first_seq += num;
+	}
+
+	report_stats.sent += sent;
+	report_stats.uplinks++;
+
+	k_spin_unlock(&report_lock, key);
+}
+
+/* Send every queued event, one datagram per batch */
+static int report_send_queued(void)
+{
+	int ret;
+
+	while (true) {
+		k_spinlock_key_t key = k_spin_lock(&report_lock);
+		uint16_t num = MIN(ring_count, ARRAY_SIZE(batch));
+		uint32_t first_seq = ring_first_seq;
+		bool last = num == ring_count;
+
+		for (uint16_t i = 0; i < num; i++) {
+			batch[i] = ring[(ring_head + i) % ARRAY_SIZE(ring)];
+		}
+
+		k_spin_unlock(&report_lock, key);
+
+		if (num == 0) {
+			return 0;
+		}
+
+		size_t len;
+		uint16_t encoded = report_encode(batch, num, first_seq, payload, sizeof(payload),
+						 &len);
+
+		/* Release the RRC connection right after the last datagram */
+		ret = report_datagram(len, last && encoded == num);
+		if (ret) {
+			LOG_WRN("Failed to send %u events: %d", encoded, ret);
+			return ret;
+		}
+
+		report_release(first_seq + encoded, encoded);
+		LOG_DBG("Sent %u events in %zu bytes", encoded, len);
+	}
+}
+
+/* Time until the oldest queued event is due */
+static k_timeout_t report_timeout(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&report_lock);
+	uint32_t age_ms = k_uptime_get_32() - ring[ring_head].timestamp_ms;
+	uint16_t count = ring_count;
+
+	k_spin_unlock(&report_lock, key);
+
+	if (count == 0) {
+		return K_FOREVER;
+	}
+
+	if (age_ms >= CONFIG_APP_REPORT_MAX_DELAY_S * MSEC_PER_SEC) {
+		return K_NO_WAIT;
+	}
+
+	return K_MSEC(CONFIG_APP_REPORT_MAX_DELAY_S * MSEC_PER_SEC - age_ms);
+}
+#endif /* CONFIG_APP_REPORT_SUMMARY */
+
+static int report_send_pending(void)
+{
+	int ret;
+
+	if (report_fd < 0) {
+		ret = report_connect();
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return report_send_queued();
+}
+
+static void report_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	k_timeout_t timeout = K_FOREVER;
+
+	while (1) {
+		/* Woken by a full batch, a connected radio, a flush or the oldest event */
+		k_sem_take(&report_sem, timeout);
+
+		if (!atomic_get(&lte_registered)) {
+			timeout = K_FOREVER;
+			continue;
+		}
+
+		if (atomic_clear(&send_requested) ||
+		    K_TIMEOUT_EQ(report_timeout(), K_NO_WAIT)) {
+			if (report_send_pending()) {
+				atomic_set(&send_requested, true);
+				timeout = sampling_align_timeout(REPORT_RETRY_DELAY);
+				continue;
+			}
+		}
+
+		/* Deadlines fall into a sampling wakeup, less than one timer period late */
+		timeout = sampling_align_timeout(report_timeout());
+	}
+}
+
+void report_flush(void)
+{
+	report_wake(true);
+}
+
+void report_get_stats(struct report_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&report_lock);
+
+	*stats = report_stats;
+	k_spin_unlock(&report_lock, key);
+}
+
+int report_init(void)
+{
+	int ret;
+
+	ret = nrf_modem_lib_init();
+	if (ret) {
+		LOG_ERR("Failed to initialize modem library: %d", ret);
+		return ret;
+	}
+
+	/* Request PSM, the timers are set with CONFIG_LTE_PSM_REQ_RPTAU and _RAT */
+	ret = lte_lc_psm_req(true);
+	if (ret) {
+		LOG_WRN("Failed to request PSM: %d", ret);
+	}
+
+	if (IS_ENABLED(CONFIG_APP_REPORT_EDRX)) {
+		ret = lte_lc_edrx_req(true);
+		if (ret) {
+			LOG_WRN("Failed to request eDRX: %d", ret);
+		}
+	}
+
+#if defined(CONFIG_APP_REPORT_SUMMARY)
+	ret = zbus_chan_add_obs(&detection_summary_chan, &report_listener, K_MSEC(100));
+#else
+	ret = zbus_chan_add_obs(&detection_result_chan, &report_listener, K_MSEC(100));
+#endif
+	if (ret) {
+		LOG_ERR("Failed to observe detection results: %d", ret);
+		return ret;
+	}
+
+	ret = lte_lc_connect_async(report_lte_handler);
+	if (ret) {
+		LOG_ERR("Failed to start LTE connection: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Reporting to %s:%d", CONFIG_APP_REPORT_SERVER_HOST, CONFIG_APP_REPORT_SERVER_PORT);
+	return 0;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _REPORT_H_
+#define _REPORT_H_
+
+#include <stdint.h>
+
+/*
+ * Detection event uplink counters since boot, counting summaries instead of
+ * events with CONFIG_APP_REPORT_SUMMARY
+ */
+struct report_stats {
+	/* Events added to the ring */
+	uint32_t events;
+	/* Events dropped from the full ring or queue before they were sent */
+	uint32_t dropped;
+	/* Events sent */
+	uint32_t sent;
+	/* Datagrams sent */
+	uint32_t uplinks;
+	/* Failed datagram sends, the events stay queued */
+	uint32_t send_errors;
+};
+
+/**
+ * @brief Initialize the modem, attach to LTE and start collecting detection results
+ *
+ * Results are queued as events and sent in batches as UDP datagrams once a
+ * batch is full, once the oldest queued event is
+ * CONFIG_APP_REPORT_MAX_DELAY_S old, or earlier when the radio is connected
+ * anyway, so uplinks share the wakeups of the modem. With
+ * CONFIG_APP_REPORT_SUMMARY the class summaries of the detection module are
+ * sent instead, each as soon as it is taken.
+ *
+ * @return 0 on success, negative error code on failure
+ */
+int report_init(void);
+
+/**
+ * @brief Send the queued events at the next opportunity, regardless of the batch size
+ */
+void report_flush(void);
+
+/**
+ * @brief Get the uplink counters
+ * @param stats Counters since boot
+ */
+void report_get_stats(struct report_stats *stats);
+
+#endif /* _REPORT_H_ */
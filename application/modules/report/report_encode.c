@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/sys/byteorder.h>
+
+#include "report_encode.h"
+
+static size_t put_varint(uint8_t *buf, uint32_t value)
+{
+	size_t len = 0;
+
+	while (value >= 0x80) {
+		buf[len++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+
+	buf[len++] = (uint8_t)value;
+
+	return len;
+}
+
+uint16_t report_encode(const struct report_event *events, uint16_t num, uint32_t first_seq,
+		       uint8_t *buf, size_t size, size_t *len)
+{
+	uint32_t last_ms = 0;
+	size_t pos = 3;
+	uint16_t count;
+
+	pos += put_varint(&buf[pos], first_seq);
+
+	for (count = 0; count < num && size - pos >= REPORT_EVENT_SIZE_MAX; count++) {
+		const struct report_event *event = &events[count];
+
+		pos += put_varint(&buf[pos], event->timestamp_ms - last_ms);
+		buf[pos++] = event->model;
+		pos += put_varint(&buf[pos], event->predicted_class);
+		buf[pos++] = event->confidence_pct;
+		last_ms = event->timestamp_ms;
+	}
+
+	buf[0] = REPORT_FORMAT_EVENTS;
+	sys_put_le16(count, &buf[1]);
+	*len = pos;
+
+	return count;
+}
+
+size_t report_encode_summary(const struct detection_summary *p_summary, uint8_t *buf)
+{
+	size_t pos = 0;
+
+	buf[pos++] = REPORT_FORMAT_SUMMARY;
+	buf[pos++] = p_summary->model;
+	pos += put_varint(&buf[pos], p_summary->start_ms);
+	pos += put_varint(&buf[pos], p_summary->duration_ms);
+	buf[pos++] = (uint8_t)p_summary->num_classes;
+
+	for (uint16_t c = 0; c < p_summary->num_classes; c++) {
+		pos += put_varint(&buf[pos], p_summary->dwell_ms[c]);
+		pos += put_varint(&buf[pos], p_summary->entries[c]);
+
+		for (uint16_t bin = 0; bin < DETECTION_SUMMARY_DWELL_BINS; bin++) {
+			pos += put_varint(&buf[pos], p_summary->episodes[c][bin]);
+		}
+	}
+
+	return pos;
+}
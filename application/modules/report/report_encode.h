@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _REPORT_ENCODE_H_
+#define _REPORT_ENCODE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "detection.h"
+
+/* First byte of every datagram */
+#define REPORT_FORMAT_EVENTS 1
+#define REPORT_FORMAT_SUMMARY 2
+
+/**
+ * Detection event as kept in the report ring.
+ *
+ * An encoded batch starts with a header:
+ *
+ *   u8     format         REPORT_FORMAT_EVENTS
+ *   u16    count          number of events, little endian
+ *   varint seq            sequence number of the first event, a gap to the
+ *                         previous batch means events were dropped
+ *
+ * followed by count events:
+ *
+ *   varint delta_ms       time since the previous event, time since boot
+ *                         for the first event of the batch
+ *   u8     model          index in the detection registry
+ *   varint class          predicted class
+ *   u8     confidence     in percent
+ *
+ * Varints are unsigned LEB128, 7 bits per byte with the low bits first.
+ * scripts/report_server.py decodes batches and summaries.
+ */
+struct report_event {
+	uint32_t timestamp_ms;
+	uint16_t predicted_class;
+	uint8_t model;
+	uint8_t confidence_pct;
+};
+
+/* Largest encoded size of one event */
+#define REPORT_EVENT_SIZE_MAX (5 + 1 + 3 + 1)
+
+/* Largest encoded size of the header */
+#define REPORT_HEADER_SIZE_MAX (1 + 2 + 5)
+
+/**
+ * @brief Encode a batch of consecutive events
+ *
+ * Encodes as many events as fit into the buffer.
+ *
+ * @param events Events, oldest first
+ * @param num Number of events
+ * @param first_seq Sequence number of the first event
+ * @param buf Output buffer, at least REPORT_HEADER_SIZE_MAX + REPORT_EVENT_SIZE_MAX bytes
+ * @param size Size of the output buffer
+ * @param len Encoded length
+ * @return Number of events encoded
+ */
+uint16_t report_encode(const struct report_event *events, uint16_t num, uint32_t first_seq,
+		       uint8_t *buf, size_t size, size_t *len);
+
+/*
+ * A struct detection_summary is encoded as:
+ *
+ *   u8     format         REPORT_FORMAT_SUMMARY
+ *   u8     model
+ *   varint start_ms       uptime at the start of the interval
+ *   varint duration_ms
+ *   u8     num_classes
+ *
+ * followed by num_classes entries:
+ *
+ *   varint dwell_ms
+ *   varint entries
+ *   varint episodes[DETECTION_SUMMARY_DWELL_BINS]
+ */
+#define REPORT_SUMMARY_SIZE_MAX                                                                    \
+	(1 + 1 + 5 + 5 + 1 +                                                                       \
+	 DETECTION_SUMMARY_CLASSES_MAX * (5 + 3 + 3 * DETECTION_SUMMARY_DWELL_BINS))
+
+/**
+ * @brief Encode a class summary
+ * @param p_summary Summary
+ * @param buf Output buffer of at least REPORT_SUMMARY_SIZE_MAX bytes
+ * @return Encoded length
+ */
+size_t report_encode_summary(const struct detection_summary *p_summary, uint8_t *buf);
+
+#endif /* _REPORT_ENCODE_H_ */
@@ -10,7 +10,47 @@
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/zbus/zbus.h>
 #include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 #include "sampling.h"
+#include "app_log.h"
+#include "app_ring.h"
+#include "profiling_marker.h"
+
+#include <math.h>
+
+#if defined(CONFIG_APP_SAMPLING_RTIO)
+#include <zephyr/rtio/rtio.h>
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_PM_LOCK)
+#include <zephyr/pm/policy.h>
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO) || defined(CONFIG_APP_SAMPLING_REPLAY) || \
+	defined(CONFIG_APP_SAMPLING_BURST_READ)
+#include <zephyr/sys/byteorder.h>
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO) || defined(CONFIG_APP_SAMPLING_BURST_READ)
+#include "sampling_bmi270.h"
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+#include "sampling_coproc.h"
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_STREAM)
+#include "sampling_stream.h"
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_HISTORY)
+#include "sampling_history.h"
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_DECIMATOR_FIR) || defined(CONFIG_APP_SAMPLING_FUSION)
+#include "app_dsp.h"
+#endif
 
 LOG_MODULE_REGISTER(app_sampling, CONFIG_APP_SAMPLING_LOG_LEVEL);
 
@@ -22,75 +62,996 @@ ZBUS_CHAN_DEFINE(imu_data_chan,
 		 ZBUS_OBSERVERS_EMPTY,
 		 ZBUS_MSG_INIT(0));
 
+/* Zbus channel for batches of IMU data drained from the sensor FIFO */
+ZBUS_CHAN_DEFINE(imu_batch_chan,
+		 struct imu_sample_batch,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+/* Zbus channel for references to pooled blocks of IMU data drained from the sensor FIFO */
+ZBUS_CHAN_DEFINE(imu_block_chan,
+		 struct imu_sample_block,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+NET_BUF_POOL_FIXED_DEFINE(imu_block_pool, CONFIG_APP_SAMPLING_BLOCK_POOL_SIZE,
+			  SAMPLING_BATCH_MAX * sizeof(struct imu_sample), 0, NULL);
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+/* Zbus channel for IMU any-motion and no-motion events */
+ZBUS_CHAN_DEFINE(imu_motion_chan,
+		 struct imu_motion_event,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+#endif
+
+#if !defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
 static const struct device *imu_dev;
+#endif
+static int sampling_frequency_hz = CONFIG_APP_SAMPLING_ODR_HZ;
 static bool sampling_active = false;
+static bool sampling_suspended = false;
+static bool gyro_enabled = true;
 static bool print_enabled = false;
 static struct k_timer sampling_timer;
 static K_SEM_DEFINE(sampling_sem, 0, 1);
+static struct sampling_stats loss_stats;
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+/* Sequence number of the next frame drained from the FIFO */
+static uint32_t fifo_seq;
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+/* Set once the coprocessor bound its endpoint, it owns the IMU */
+static bool coproc_ready;
+/* IMU samples averaged into one published sample by the coprocessor */
+static uint16_t coproc_decimation = CONFIG_APP_SAMPLING_ODR_HZ / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+#else
+struct sampling_trigger_entry {
+	/* Sampling period since sampling started */
+	uint32_t seq;
+	/* Start time of the period */
+	uint32_t time_us;
+};
+
+/* Periods started by the timer or data-ready ISR, drained by the sampling thread */
+APP_RING_DEFINE(trigger_ring, struct sampling_trigger_entry, 4);
+/* Written by the trigger ISR only */
+static uint32_t trigger_periods;
+/* Next period the sampling thread expects */
+static uint32_t trigger_next_seq;
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_TIMING)
+static struct sampling_timing_stats timing_stats;
+/* Cycle counter and period of the last acquisition, only used by the sampling thread */
+static uint32_t timing_last_cycles;
+static uint32_t timing_last_seq;
+static bool timing_started;
+#endif
 
 /* Sampling thread */
-#define SAMPLING_STACK_SIZE 2048
+#define SAMPLING_STACK_SIZE CONFIG_APP_SAMPLING_THREAD_STACK_SIZE
 #define SAMPLING_PRIORITY 5
 
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+static uint8_t fifo_buf[SAMPLING_BATCH_MAX * BMI270_FIFO_FRAME_SIZE];
+#if !defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+static struct imu_sample_batch batch;
+#endif
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+static struct imu_sample_batch batch;
+#endif
+
+BUILD_ASSERT((CONFIG_APP_SAMPLING_ODR_HZ % CONFIG_APP_SAMPLING_FREQUENCY_HZ) == 0,
+	     "The IMU ODR must be a multiple of the sampling frequency");
+
+/* Sensor samples decimated into one published sample */
+static int decimation = CONFIG_APP_SAMPLING_ODR_HZ / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+
+#define IMU_AXES 6
+
+#if defined(CONFIG_APP_SAMPLING_REPLAY)
+/* Recorded trace, accel X..Z and gyro X..Z in little-endian int16 counts per sample */
+static const uint8_t replay_trace[] = {
+#include "sampling_replay_trace.inc"
+};
+
+#define REPLAY_SAMPLE_SIZE (IMU_AXES * sizeof(int16_t))
+
+BUILD_ASSERT(sizeof(replay_trace) >= REPLAY_SAMPLE_SIZE,
+	     "CONFIG_APP_SAMPLING_REPLAY_FILE holds no sample");
+
+/* Last replay, written by the sampling thread before replay_sem is given */
+static struct sampling_replay_stats replay_stats;
+static K_SEM_DEFINE(replay_sem, 0, 1);
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_DECIMATOR_FIR)
+BUILD_ASSERT(CONFIG_APP_SAMPLING_ODR_HZ <=
+	     CONFIG_APP_SAMPLING_DECIMATION_MAX * CONFIG_APP_SAMPLING_FREQUENCY_HZ,
+	     "The IMU ODR exceeds the maximum decimation factor");
+
+#define DECIMATOR_TAPS_MAX \
+	(CONFIG_APP_SAMPLING_DECIMATOR_TAPS_PER_PHASE * CONFIG_APP_SAMPLING_DECIMATION_MAX)
+
+/* Pass band edge as a fraction of the published rate, below its Nyquist frequency */
+#define DECIMATOR_CUTOFF 0.4f
+
+static float decimator_coeffs[DECIMATOR_TAPS_MAX];
+static float decimator_lines[APP_DSP_DECIMATOR_STATE_LEN(DECIMATOR_TAPS_MAX, IMU_AXES)];
+#endif
+
+/* Intermediate precision and conversions into imu_value_t */
+#if defined(CONFIG_APP_SAMPLING_FORMAT_DOUBLE)
+typedef double sampling_real_t;
+#define SENSOR_VALUE_TO_REAL(v) sensor_value_to_double(v)
+#define LDEXP_REAL(v, e) ldexp(v, e)
+#else
+typedef float sampling_real_t;
+#define SENSOR_VALUE_TO_REAL(v) sensor_value_to_float(v)
+#define LDEXP_REAL(v, e) ldexpf(v, e)
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_FORMAT_RAW)
+static inline imu_value_t sampling_si_to_counts(float value, float scale)
+{
+	long counts = lroundf(value / scale);
+
+	return (imu_value_t)CLAMP(counts, INT16_MIN, INT16_MAX);
+}
+
+#define FROM_SI(v, scale) sampling_si_to_counts(v, scale)
+#define FROM_COUNTS(c, lsb) ((imu_value_t)(c))
+#else
+#define FROM_SI(v, scale) ((imu_value_t)(v))
+#define FROM_COUNTS(c, lsb) ((imu_value_t)(c) * (lsb))
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_DECIMATOR_FIR)
+/* Filter state, count is 0 until the delay lines are filled with the first sample */
+static struct {
+	struct app_dsp_decimator fir;
+	float last[IMU_AXES];
+	uint32_t next_seq;
+	uint32_t delay_us;
+	int count;
+} decimator;
+#else
+/* Sums of the sensor samples in the group being decimated */
+static struct {
+	sampling_real_t sum[IMU_AXES];
+	uint32_t group;
+	int count;
+} decimator;
+#endif
+
+static void sampling_store_values(struct imu_sample *out, const sampling_real_t *values)
+{
+	/* Values are in imu_value_t units, rounded to counts in raw format */
+	out->accel_x = FROM_SI(values[0], 1.0f);
+	out->accel_y = FROM_SI(values[1], 1.0f);
+	out->accel_z = FROM_SI(values[2], 1.0f);
+	out->gyro_x = FROM_SI(values[3], 1.0f);
+	out->gyro_y = FROM_SI(values[4], 1.0f);
+	out->gyro_z = FROM_SI(values[5], 1.0f);
+}
+
+#if defined(CONFIG_APP_SAMPLING_DECIMATOR_FIR)
+/* Design the low-pass filter for the current decimation factor */
+static void sampling_decimator_configure(void)
+{
+	uint16_t taps = CONFIG_APP_SAMPLING_DECIMATOR_TAPS_PER_PHASE * decimation;
+
+	app_dsp_decimator_design_f32(decimator_coeffs, taps, DECIMATOR_CUTOFF / decimation);
+	app_dsp_decimator_init_f32(&decimator.fir, decimator_coeffs, taps, IMU_AXES,
+				   decimator_lines);
+
+	/* Group delay of the symmetric filter */
+	decimator.delay_us = (uint32_t)(taps - 1) * USEC_PER_SEC / (2 * sampling_frequency_hz);
+	decimator.count = 0;
+}
+#endif
+
+/**
+ * Decimate the sensor samples into published samples, one of each group of
+ * decimation consecutive samples. A group is identified by the sequence
+ * numbers of its samples and complete once the last of them is added, the
+ * output then takes the number of the group and the capture time of that
+ * sample. A group missing its last sample is dropped and shows up as a gap
+ * at the published rate.
+ *
+ * The FIR decimator low-pass filters the samples first, holding the last
+ * sample over lost ones, and dates outputs back by the filter delay. The
+ * average decimator publishes the mean of the samples present in a group.
+ *
+ * @return true if out holds a published sample
+ */
+static bool sampling_decimate(const struct imu_sample *in, struct imu_sample *out)
+{
+	uint32_t group = in->seq / decimation;
+	sampling_real_t values[IMU_AXES];
+
+	if (decimation == 1) {
+		*out = *in;
+		return true;
+	}
+
+#if defined(CONFIG_APP_SAMPLING_DECIMATOR_FIR)
+	const float frame[IMU_AXES] = {
+		in->accel_x, in->accel_y, in->accel_z,
+		in->gyro_x, in->gyro_y, in->gyro_z,
+	};
+
+	if (decimator.count == 0) {
+		/* Start from a steady state instead of the step response */
+		app_dsp_decimator_reset_f32(&decimator.fir, frame);
+		decimator.count = 1;
+	} else {
+		/* Longer gaps than the filter leave only held samples in it */
+		uint32_t lost = MIN(in->seq - decimator.next_seq, decimator.fir.num_taps);
+
+		while (lost-- > 0) {
+			app_dsp_decimator_push_f32(&decimator.fir, decimator.last);
+		}
+
+		app_dsp_decimator_push_f32(&decimator.fir, frame);
+	}
+
+	memcpy(decimator.last, frame, sizeof(frame));
+	decimator.next_seq = in->seq + 1;
+
+	if ((in->seq % decimation) != (decimation - 1)) {
+		return false;
+	}
+
+	float filtered[IMU_AXES];
+
+	app_dsp_decimator_output_f32(&decimator.fir, filtered);
+
+	for (int i = 0; i < IMU_AXES; i++) {
+		values[i] = filtered[i];
+	}
+
+	out->timestamp_us = in->timestamp_us - decimator.delay_us;
+#else
+	const imu_value_t frame[IMU_AXES] = {
+		in->accel_x, in->accel_y, in->accel_z,
+		in->gyro_x, in->gyro_y, in->gyro_z,
+	};
+
+	if (decimator.count == 0 || group != decimator.group) {
+		memset(decimator.sum, 0, sizeof(decimator.sum));
+		decimator.group = group;
+		decimator.count = 0;
+	}
+
+	for (int i = 0; i < IMU_AXES; i++) {
+		decimator.sum[i] += frame[i];
+	}
+	decimator.count++;
+
+	if ((in->seq % decimation) != (decimation - 1)) {
+		return false;
+	}
+
+	for (int i = 0; i < IMU_AXES; i++) {
+		values[i] = decimator.sum[i] / decimator.count;
+	}
+
+	out->timestamp_us = in->timestamp_us;
+	decimator.count = 0;
+#endif
+
+	sampling_store_values(out, values);
+	out->seq = group;
+
+	return true;
+}
+
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+static struct app_dsp_mahony fusion;
+/* Sampling period of the last fused sample */
+static uint32_t fusion_seq;
+
+/* Standard gravity in m/s^2 */
+#define FUSION_GRAVITY (SENSOR_G / 1000000.0f)
+
+/**
+ * @brief Update the orientation with a published sample and store the fusion outputs in it
+ *
+ * Runs at the published rate, after decimation. Lost samples lengthen the
+ * integration step, the rates of the sample are held over them.
+ */
+static void sampling_fuse(struct imu_sample *sample)
+{
+	const float accel[3] = {
+		sample->accel_x * SAMPLING_ACCEL_SCALE,
+		sample->accel_y * SAMPLING_ACCEL_SCALE,
+		sample->accel_z * SAMPLING_ACCEL_SCALE,
+	};
+	const float gyro[3] = {
+		sample->gyro_x * SAMPLING_GYRO_SCALE,
+		sample->gyro_y * SAMPLING_GYRO_SCALE,
+		sample->gyro_z * SAMPLING_GYRO_SCALE,
+	};
+	float dt = (float)(sample->seq - fusion_seq) / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+	float gravity[3];
+
+	app_dsp_mahony_update_f32(&fusion, accel, gyro, dt);
+	app_dsp_mahony_gravity_f32(&fusion, gravity);
+	fusion_seq = sample->seq;
+
+	sample->lin_accel_x = FROM_SI(accel[0] - FUSION_GRAVITY * gravity[0], SAMPLING_ACCEL_SCALE);
+	sample->lin_accel_y = FROM_SI(accel[1] - FUSION_GRAVITY * gravity[1], SAMPLING_ACCEL_SCALE);
+	sample->lin_accel_z = FROM_SI(accel[2] - FUSION_GRAVITY * gravity[2], SAMPLING_ACCEL_SCALE);
+	memcpy(sample->orientation, fusion.q, sizeof(sample->orientation));
+}
+#endif
+
+/* Timer period, one sensor sample or one FIFO watermark in FIFO mode */
+static k_timeout_t sampling_timer_period(void)
+{
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+	return K_USEC(CONFIG_APP_SAMPLING_FIFO_WATERMARK * USEC_PER_SEC / sampling_frequency_hz);
+#else
+	return K_USEC(USEC_PER_SEC / sampling_frequency_hz);
+#endif
+}
+
+#if defined(CONFIG_APP_SAMPLING_RTIO)
+/* One async request reads both accel and gyro */
+SENSOR_DT_READ_IODEV(imu_iodev, DT_ALIAS(imu0),
+		     {SENSOR_CHAN_ACCEL_XYZ, 0},
+		     {SENSOR_CHAN_GYRO_XYZ, 0});
+
+/* Accel only request while the gyroscope is disabled */
+SENSOR_DT_READ_IODEV(imu_accel_iodev, DT_ALIAS(imu0),
+		     {SENSOR_CHAN_ACCEL_XYZ, 0});
+
+/* Readings land in pre-allocated mempool blocks */
+RTIO_DEFINE_WITH_MEMPOOL(imu_rtio, 4, 4, 4, 64, 4);
+
+static const struct sensor_decoder_api *imu_decoder;
+
+/* Read submitted by the sampling thread, completed on its next sampling event */
+static bool rtio_read_pending;
+static struct sampling_trigger_entry rtio_read_trigger;
+#endif
+
 static void sampling_thread_fn(void *arg1, void *arg2, void *arg3);
 K_THREAD_DEFINE(sampling_thread, SAMPLING_STACK_SIZE,
 		sampling_thread_fn, NULL, NULL, NULL,
 		SAMPLING_PRIORITY, 0, 0);
 
+uint32_t sampling_time_us(void)
+{
+	return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+k_timeout_t sampling_align_timeout(k_timeout_t timeout)
+{
+#if defined(CONFIG_APP_SAMPLING_WAKE_ALIGN) && !defined(CONFIG_APP_SAMPLING_ACQUISITION_DATA_READY)
+	k_ticks_t period = sampling_timer_period().ticks;
+	k_ticks_t next;
+
+	if (!sampling_active || K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+	    K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		return timeout;
+	}
+
+	/* The timer is periodic, later expiries follow the next one by whole periods */
+	next = k_timer_remaining_ticks(&sampling_timer);
+	if (timeout.ticks <= next) {
+		return K_TICKS(next);
+	}
+
+	return K_TICKS(next + ROUND_UP(timeout.ticks - next, period));
+#else
+	return timeout;
+#endif
+}
+
+#if !defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO) && !defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+/* Start the next sampling period, periods still pending are merged into it */
+static void sampling_trigger(void)
+{
+	const struct sampling_trigger_entry entry = {
+		.seq = trigger_periods++,
+		.time_us = sampling_time_us(),
+	};
+
+	/* A full ring loses the period, the sampling thread sees it as a gap */
+	(void)app_ring_put(&trigger_ring, &entry);
+	k_sem_give(&sampling_sem);
+}
+#endif
+
 /* Timer handler */
 static void sampling_timer_handler(struct k_timer *timer)
 {
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+	/* Frames stay in the FIFO until the next drain, a late drain loses nothing */
 	k_sem_give(&sampling_sem);
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	/* Not started, blocks from the coprocessor wake the sampling thread */
+	ARG_UNUSED(timer);
+#else
+	sampling_trigger();
+#endif
+}
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_DATA_READY)
+/* Data-ready trigger handler, runs in the sensor driver trigger context */
+static void sampling_drdy_handler(const struct device *dev,
+				  const struct sensor_trigger *trig)
+{
+	if (sampling_active) {
+		sampling_trigger();
+	}
+}
+
+static const struct sensor_trigger sampling_drdy_trig = {
+	.type = SENSOR_TRIG_DATA_READY,
+	.chan = SENSOR_CHAN_ALL,
+};
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+/* Motion events are only published while armed, one event per arming */
+static bool no_motion_armed;
+static bool any_motion_armed;
+
+static void sampling_publish_motion(enum imu_motion_event_type type)
+{
+	struct imu_motion_event event = {
+		.type = type,
+		.timestamp = k_uptime_get_32(),
+	};
+	int ret = zbus_chan_pub(&imu_motion_chan, &event, K_NO_WAIT);
+
+	if (ret) {
+		LOG_WRN("Failed to publish motion event: %d", ret);
+	}
+}
+
+/* Motion trigger handlers, run in the sensor driver trigger context */
+static void sampling_any_motion_handler(const struct device *dev,
+					const struct sensor_trigger *trig)
+{
+	if (any_motion_armed) {
+		any_motion_armed = false;
+		sampling_publish_motion(IMU_MOTION_EVENT_ANY_MOTION);
+	}
+}
+
+static void sampling_no_motion_handler(const struct device *dev,
+				       const struct sensor_trigger *trig)
+{
+	if (no_motion_armed) {
+		no_motion_armed = false;
+		sampling_publish_motion(IMU_MOTION_EVENT_NO_MOTION);
+	}
+}
+
+static const struct sensor_trigger sampling_any_motion_trig = {
+	.type = SENSOR_TRIG_MOTION,
+	.chan = SENSOR_CHAN_ACCEL_XYZ,
+};
+
+static const struct sensor_trigger sampling_no_motion_trig = {
+	.type = SENSOR_TRIG_STATIONARY,
+	.chan = SENSOR_CHAN_ACCEL_XYZ,
+};
+
+#if defined(CONFIG_APP_SAMPLING_LP_ACCEL)
+static const struct device *const lp_accel_dev = DEVICE_DT_GET(DT_ALIAS(accel_lp));
+
+/* Activity of the low-power accelerometer, it wakes the BMI270 from power down */
+static const struct sensor_trigger sampling_lp_activity_trig = {
+	.type = SENSOR_TRIG_THRESHOLD,
+	.chan = SENSOR_CHAN_ACCEL_XYZ,
+};
+
+/* Keep the low-power accelerometer running with its activity detection armed */
+static int sampling_lp_accel_init(void)
+{
+	struct sensor_value value;
+	int ret;
+
+	if (!device_is_ready(lp_accel_dev)) {
+		LOG_ERR("Low-power accelerometer not ready");
+		return -ENODEV;
+	}
+
+	value.val1 = CONFIG_APP_SAMPLING_LP_ACCEL_FREQUENCY_HZ;
+	value.val2 = 0;
+	ret = sensor_attr_set(lp_accel_dev, SENSOR_CHAN_ACCEL_XYZ,
+			      SENSOR_ATTR_SAMPLING_FREQUENCY, &value);
+	if (ret) {
+		LOG_ERR("Failed to set low-power accel ODR: %d", ret);
+		return ret;
+	}
+
+	sensor_ug_to_ms2(CONFIG_APP_SAMPLING_MOTION_THRESHOLD_MG * 1000, &value);
+	ret = sensor_attr_set(lp_accel_dev, SENSOR_CHAN_ACCEL_XYZ,
+			      SENSOR_ATTR_UPPER_THRESH, &value);
+	if (ret == -ENOTSUP) {
+		LOG_WRN("Activity threshold not configurable, using sensor default");
+	} else if (ret) {
+		LOG_ERR("Failed to set activity threshold: %d", ret);
+		return ret;
+	}
+
+	/* Events outside of sampling_suspend() are ignored by the disarmed handler */
+	ret = sensor_trigger_set(lp_accel_dev, &sampling_lp_activity_trig,
+				 sampling_any_motion_handler);
+	if (ret) {
+		LOG_ERR("Failed to set activity trigger: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Motion gate on %s", lp_accel_dev->name);
+	return 0;
+}
+#endif
+
+static int sampling_motion_init(void)
+{
+	struct sensor_value threshold;
+	int ret;
+
+#if defined(CONFIG_APP_SAMPLING_LP_ACCEL)
+	ret = sampling_lp_accel_init();
+	if (ret) {
+		return ret;
+	}
+#endif
+
+	sensor_ug_to_ms2(CONFIG_APP_SAMPLING_MOTION_THRESHOLD_MG * 1000, &threshold);
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_ACCEL_XYZ,
+			      SENSOR_ATTR_SLOPE_TH, &threshold);
+	if (ret == -ENOTSUP) {
+		LOG_WRN("Motion threshold not configurable, using sensor default");
+	} else if (ret) {
+		LOG_ERR("Failed to set motion threshold: %d", ret);
+		return ret;
+	}
+
+	ret = sensor_trigger_set(imu_dev, &sampling_any_motion_trig, sampling_any_motion_handler);
+	if (ret) {
+		LOG_ERR("Failed to set any-motion trigger: %d", ret);
+		return ret;
+	}
+
+	ret = sensor_trigger_set(imu_dev, &sampling_no_motion_trig, sampling_no_motion_handler);
+	if (ret) {
+		LOG_ERR("Failed to set no-motion trigger: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+/* The IMU is owned by this core, or by the coprocessor once it bound its endpoint */
+static bool sampling_imu_ready(void)
+{
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	return coproc_ready;
+#else
+	return imu_dev != NULL;
+#endif
+}
+
+#if !defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+static int sampling_set_range(void)
+{
+	struct sensor_value range;
+	int ret;
+
+	sensor_g_to_ms2(CONFIG_APP_SAMPLING_ACCEL_RANGE_G, &range);
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_ACCEL_XYZ,
+			      SENSOR_ATTR_FULL_SCALE, &range);
+	if (ret) {
+		LOG_ERR("Failed to set accel range: %d", ret);
+		return ret;
+	}
+
+	sensor_degrees_to_rad(CONFIG_APP_SAMPLING_GYRO_RANGE_DPS, &range);
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_GYRO_XYZ,
+			      SENSOR_ATTR_FULL_SCALE, &range);
+	if (ret) {
+		LOG_ERR("Failed to set gyro range: %d", ret);
+		return ret;
+	}
+
+	return 0;
 }
+#endif
 
 int sampling_init(void)
 {
+	int ret;
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	/* The coprocessor configures the ranges with every start */
+	ret = sampling_coproc_init(&sampling_sem);
+	if (ret) {
+		return ret;
+	}
+
+	coproc_ready = true;
+#else
 	imu_dev = DEVICE_DT_GET(DT_ALIAS(imu0));
+
+#if DT_PROP(DT_ALIAS(imu0), zephyr_deferred_init)
+	/* Not initialized at boot, the configuration upload runs here */
+	ret = device_init(imu_dev);
+	if (ret) {
+		LOG_ERR("IMU device init failed: %d", ret);
+		return ret;
+	}
+#endif
+
 	if (!device_is_ready(imu_dev)) {
 		LOG_ERR("IMU device not ready");
 		return -ENODEV;
 	}
 
-	/* Initialize timer */
-	k_timer_init(&sampling_timer, sampling_timer_handler, NULL);
+	ret = sampling_set_range();
+	if (ret) {
+		return ret;
+	}
+#endif
+
+	ret = sampling_set_frequency(CONFIG_APP_SAMPLING_ODR_HZ);
+	if (ret) {
+		return ret;
+	}
+
+#if defined(CONFIG_APP_SAMPLING_RTIO)
+	ret = sensor_get_decoder(imu_dev, &imu_decoder);
+	if (ret) {
+		LOG_ERR("Failed to get sensor decoder: %d", ret);
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO) || defined(CONFIG_APP_SAMPLING_BURST_READ)
+	ret = sampling_bmi270_init();
+	if (ret) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_DATA_READY)
+	ret = sensor_trigger_set(imu_dev, &sampling_drdy_trig, sampling_drdy_handler);
+	if (ret) {
+		LOG_ERR("Failed to set data-ready trigger: %d", ret);
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+	ret = sampling_motion_init();
+	if (ret) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_STREAM)
+	ret = sampling_stream_init();
+	if (ret) {
+		return ret;
+	}
+#endif
+
+	/* Initialize timer */
+	k_timer_init(&sampling_timer, sampling_timer_handler, NULL);
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	LOG_INF("IMU initialized on the coprocessor");
+#else
+	LOG_INF("IMU initialized: %s", imu_dev->name);
+#endif
+	return 0;
+}
+
+/* Set accelerometer and gyroscope ODR, an ODR of 0 powers the sensor down */
+static int sampling_set_odr(int accel_hz, int gyro_hz)
+{
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	/* Sent to the coprocessor with the next start */
+	ARG_UNUSED(accel_hz);
+	ARG_UNUSED(gyro_hz);
+
+	return 0;
+#else
+	int ret;
+	struct sensor_value odr;
+
+	odr.val1 = accel_hz;
+	odr.val2 = 0;
+
+	/* Set accelerometer ODR */
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_ACCEL_XYZ,
+			      SENSOR_ATTR_SAMPLING_FREQUENCY, &odr);
+	if (ret) {
+		LOG_ERR("Failed to set accel ODR: %d", ret);
+		return ret;
+	}
+
+	odr.val1 = gyro_hz;
+
+	/* Set gyroscope ODR */
+	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_GYRO_XYZ,
+			      SENSOR_ATTR_SAMPLING_FREQUENCY, &odr);
+	if (ret) {
+		LOG_ERR("Failed to set gyro ODR: %d", ret);
+		return ret;
+	}
+
+	return 0;
+#endif
+}
+
+int sampling_set_frequency(int frequency_hz)
+{
+	int ret;
+
+	if (!sampling_imu_ready()) {
+		LOG_ERR("IMU not initialized");
+		return -ENODEV;
+	}
+
+	if (sampling_active) {
+		LOG_WRN("Sampling active");
+		return -EBUSY;
+	}
+
+	if (frequency_hz < CONFIG_APP_SAMPLING_FREQUENCY_HZ ||
+	    (frequency_hz % CONFIG_APP_SAMPLING_FREQUENCY_HZ) != 0) {
+		LOG_ERR("ODR %d Hz is not a multiple of %d Hz", frequency_hz,
+			CONFIG_APP_SAMPLING_FREQUENCY_HZ);
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_APP_SAMPLING_DECIMATOR_FIR) && !defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	if (frequency_hz / CONFIG_APP_SAMPLING_FREQUENCY_HZ > CONFIG_APP_SAMPLING_DECIMATION_MAX) {
+		LOG_ERR("ODR %d Hz exceeds the maximum decimation", frequency_hz);
+		return -EINVAL;
+	}
+#endif
+
+	/* Suspend keeps the low power rate, resume applies the new one */
+	if (!sampling_suspended) {
+		ret = sampling_set_odr(frequency_hz, gyro_enabled ? frequency_hz : 0);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	sampling_frequency_hz = frequency_hz;
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	/* The coprocessor averages the groups, blocks arrive at the published rate */
+	coproc_decimation = frequency_hz / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+	decimation = 1;
+#else
+	decimation = frequency_hz / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_DECIMATOR_FIR)
+	sampling_decimator_configure();
+#endif
+
+	LOG_INF("IMU ODR set to %d Hz, decimated by %d", frequency_hz,
+		frequency_hz / CONFIG_APP_SAMPLING_FREQUENCY_HZ);
+	return 0;
+}
+
+int sampling_get_frequency(void)
+{
+	return sampling_frequency_hz;
+}
+
+int sampling_set_gyro_enabled(bool enabled)
+{
+	int ret;
+
+	if (!sampling_imu_ready()) {
+		LOG_ERR("IMU not initialized");
+		return -ENODEV;
+	}
+
+	if (sampling_active) {
+		LOG_WRN("Sampling active");
+		return -EBUSY;
+	}
+
+	if (enabled == gyro_enabled) {
+		return 0;
+	}
+
+	/* Suspend keeps the gyroscope off, resume applies the new setting */
+	if (!sampling_suspended) {
+		ret = sampling_set_odr(sampling_frequency_hz, enabled ? sampling_frequency_hz : 0);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	gyro_enabled = enabled;
+
+	LOG_INF("Gyroscope %s", enabled ? "enabled" : "disabled");
+	return 0;
+}
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+int sampling_get_sample(struct imu_sample *sample)
+{
+	/* The IMU bus belongs to the coprocessor */
+	ARG_UNUSED(sample);
+
+	return -ENOTSUP;
+}
+#elif defined(CONFIG_APP_SAMPLING_RTIO)
+static sampling_real_t q31_to_real(q31_t value, int8_t shift)
+{
+	return LDEXP_REAL((sampling_real_t)value, shift - 31);
+}
+
+static int sampling_decode_sample(const uint8_t *buf, struct imu_sample *sample)
+{
+	struct sensor_three_axis_data accel;
+	struct sensor_three_axis_data gyro;
+	uint32_t fit;
+	int ret;
+
+	fit = 0;
+	ret = imu_decoder->decode(buf, (struct sensor_chan_spec){SENSOR_CHAN_ACCEL_XYZ, 0},
+				  &fit, 1, &accel);
+	if (ret <= 0) {
+		APP_LOG_ERR_RATELIMIT("Failed to decode accel data: %d", ret);
+		return ret ? ret : -ENODATA;
+	}
+
+	sample->accel_x = FROM_SI(q31_to_real(accel.readings[0].x, accel.shift),
+				   SAMPLING_ACCEL_SCALE);
+	sample->accel_y = FROM_SI(q31_to_real(accel.readings[0].y, accel.shift),
+				   SAMPLING_ACCEL_SCALE);
+	sample->accel_z = FROM_SI(q31_to_real(accel.readings[0].z, accel.shift),
+				   SAMPLING_ACCEL_SCALE);
+
+	if (!gyro_enabled) {
+		sample->gyro_x = 0;
+		sample->gyro_y = 0;
+		sample->gyro_z = 0;
+		return 0;
+	}
+
+	fit = 0;
+	ret = imu_decoder->decode(buf, (struct sensor_chan_spec){SENSOR_CHAN_GYRO_XYZ, 0},
+				  &fit, 1, &gyro);
+	if (ret <= 0) {
+		APP_LOG_ERR_RATELIMIT("Failed to decode gyro data: %d", ret);
+		return ret ? ret : -ENODATA;
+	}
+
+	sample->gyro_x = FROM_SI(q31_to_real(gyro.readings[0].x, gyro.shift),
+				   SAMPLING_GYRO_SCALE);
+	sample->gyro_y = FROM_SI(q31_to_real(gyro.readings[0].y, gyro.shift),
+				   SAMPLING_GYRO_SCALE);
+	sample->gyro_z = FROM_SI(q31_to_real(gyro.readings[0].z, gyro.shift),
+				   SAMPLING_GYRO_SCALE);
+
+	return 0;
+}
+
+/* Submit a read, the transfer completes into a mempool block */
+static int sampling_read_submit(void)
+{
+	int ret = sensor_read_async_mempool(gyro_enabled ? &imu_iodev : &imu_accel_iodev,
+					    &imu_rtio, NULL);
+
+	if (ret) {
+		APP_LOG_ERR_RATELIMIT("Failed to submit sensor read: %d", ret);
+	}
+
+	return ret;
+}
+
+/* Decode a completed read in place and hand its block back to the pool */
+static int sampling_read_complete(struct rtio_cqe *cqe, struct imu_sample *sample)
+{
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret = cqe->result;
+
+	if (ret == 0) {
+		ret = rtio_cqe_get_mempool_buffer(&imu_rtio, cqe, &buf, &buf_len);
+	}
+	rtio_cqe_release(&imu_rtio, cqe);
+
+	if (ret) {
+		APP_LOG_ERR_RATELIMIT("Failed to read sensor data: %d", ret);
+		return ret;
+	}
+
+	ret = sampling_decode_sample(buf, sample);
+	rtio_release_buffer(&imu_rtio, buf, buf_len);
+
+	return ret;
+}
+
+int sampling_get_sample(struct imu_sample *sample)
+{
+	int ret;
+
+	if (!imu_dev) {
+		LOG_ERR("IMU not initialized");
+		return -ENODEV;
+	}
+
+	if (!sample) {
+		return -EINVAL;
+	}
 
-	LOG_INF("IMU initialized: %s", imu_dev->name);
-	return 0;
-}
+	ret = sampling_read_submit();
+	if (ret) {
+		return ret;
+	}
 
-int sampling_set_frequency(int frequency_hz)
+	return sampling_read_complete(rtio_cqe_consume_block(&imu_rtio), sample);
+}
+#elif defined(CONFIG_APP_SAMPLING_BURST_READ)
+int sampling_get_sample(struct imu_sample *sample)
 {
+	uint8_t data[BMI270_DATA_SIZE];
 	int ret;
-	struct sensor_value odr;
 
 	if (!imu_dev) {
 		LOG_ERR("IMU not initialized");
 		return -ENODEV;
 	}
 
-	odr.val1 = frequency_hz;
-	odr.val2 = 0;
+	if (!sample) {
+		return -EINVAL;
+	}
 
-	/* Set accelerometer ODR */
-	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_ACCEL_XYZ,
-			      SENSOR_ATTR_SAMPLING_FREQUENCY, &odr);
+	/* Accel and gyro data registers are contiguous, one transaction reads both */
+	ret = sampling_bmi270_read(BMI270_REG_DATA_8, data,
+				   gyro_enabled ? BMI270_DATA_SIZE : BMI270_DATA_ACC_SIZE);
 	if (ret) {
-		LOG_ERR("Failed to set accel ODR: %d", ret);
+		APP_LOG_ERR_RATELIMIT("Failed to read sensor data: %d", ret);
 		return ret;
 	}
 
-	/* Set gyroscope ODR */
-	ret = sensor_attr_set(imu_dev, SENSOR_CHAN_GYRO_XYZ,
-			      SENSOR_ATTR_SAMPLING_FREQUENCY, &odr);
-	if (ret) {
-		LOG_ERR("Failed to set gyro ODR: %d", ret);
-		return ret;
+	sample->accel_x = FROM_COUNTS((int16_t)sys_get_le16(&data[0]), SAMPLING_ACCEL_LSB);
+	sample->accel_y = FROM_COUNTS((int16_t)sys_get_le16(&data[2]), SAMPLING_ACCEL_LSB);
+	sample->accel_z = FROM_COUNTS((int16_t)sys_get_le16(&data[4]), SAMPLING_ACCEL_LSB);
+
+	if (!gyro_enabled) {
+		sample->gyro_x = 0;
+		sample->gyro_y = 0;
+		sample->gyro_z = 0;
+		return 0;
 	}
 
-	LOG_INF("Sampling frequency set to %d Hz", frequency_hz);
+	sample->gyro_x = FROM_COUNTS((int16_t)sys_get_le16(&data[6]), SAMPLING_GYRO_LSB);
+	sample->gyro_y = FROM_COUNTS((int16_t)sys_get_le16(&data[8]), SAMPLING_GYRO_LSB);
+	sample->gyro_z = FROM_COUNTS((int16_t)sys_get_le16(&data[10]), SAMPLING_GYRO_LSB);
+
 	return 0;
 }
-
+#else
 int sampling_get_sample(struct imu_sample *sample)
 {
 	struct sensor_value accel[3];
@@ -109,69 +1070,508 @@ int sampling_get_sample(struct imu_sample *sample)
 	/* Fetch sensor data */
 	ret = sensor_sample_fetch(imu_dev);
 	if (ret) {
-		LOG_ERR("Failed to fetch sensor data: %d", ret);
+		APP_LOG_ERR_RATELIMIT("Failed to fetch sensor data: %d", ret);
 		return ret;
 	}
 
 	/* Get accelerometer data */
 	ret = sensor_channel_get(imu_dev, SENSOR_CHAN_ACCEL_XYZ, accel);
 	if (ret) {
-		LOG_ERR("Failed to get accel data: %d", ret);
+		APP_LOG_ERR_RATELIMIT("Failed to get accel data: %d", ret);
 		return ret;
 	}
 
+	/* Convert to the configured sample format */
+	sample->accel_x = FROM_SI(SENSOR_VALUE_TO_REAL(&accel[0]), SAMPLING_ACCEL_SCALE);
+	sample->accel_y = FROM_SI(SENSOR_VALUE_TO_REAL(&accel[1]), SAMPLING_ACCEL_SCALE);
+	sample->accel_z = FROM_SI(SENSOR_VALUE_TO_REAL(&accel[2]), SAMPLING_ACCEL_SCALE);
+
+	/* The driver fetches both sensors in one burst, skip the unused conversion */
+	if (!gyro_enabled) {
+		sample->gyro_x = 0;
+		sample->gyro_y = 0;
+		sample->gyro_z = 0;
+		return 0;
+	}
+
 	/* Get gyroscope data */
 	ret = sensor_channel_get(imu_dev, SENSOR_CHAN_GYRO_XYZ, gyro);
 	if (ret) {
-		LOG_ERR("Failed to get gyro data: %d", ret);
+		APP_LOG_ERR_RATELIMIT("Failed to get gyro data: %d", ret);
 		return ret;
 	}
 
-	/* Convert to double */
-	sample->accel_x = sensor_value_to_double(&accel[0]);
-	sample->accel_y = sensor_value_to_double(&accel[1]);
-	sample->accel_z = sensor_value_to_double(&accel[2]);
-	sample->gyro_x = sensor_value_to_double(&gyro[0]);
-	sample->gyro_y = sensor_value_to_double(&gyro[1]);
-	sample->gyro_z = sensor_value_to_double(&gyro[2]);
+	sample->gyro_x = FROM_SI(SENSOR_VALUE_TO_REAL(&gyro[0]), SAMPLING_GYRO_SCALE);
+	sample->gyro_y = FROM_SI(SENSOR_VALUE_TO_REAL(&gyro[1]), SAMPLING_GYRO_SCALE);
+	sample->gyro_z = FROM_SI(SENSOR_VALUE_TO_REAL(&gyro[2]), SAMPLING_GYRO_SCALE);
 
 	return 0;
 }
+#endif
 
-static void sampling_thread_fn(void *arg1, void *arg2, void *arg3)
+#if defined(CONFIG_APP_SAMPLING_STREAM)
+/* Queue a sample as a binary packet on the stream UART */
+static void sampling_print_sample(const struct imu_sample *sample)
 {
-	struct imu_sample sample;
+	/* A full ring buffer drops the packet, the host sees a sequence gap */
+	(void)sampling_stream_send(sample, sample->timestamp_us);
+}
+#else
+/* Print a sample as CSV in SI units */
+static void sampling_print_sample(const struct imu_sample *sample)
+{
+	printk("%f,%f,%f,%f,%f,%f\n",
+		(double)(sample->accel_x * SAMPLING_ACCEL_SCALE),
+		(double)(sample->accel_y * SAMPLING_ACCEL_SCALE),
+		(double)(sample->accel_z * SAMPLING_ACCEL_SCALE),
+		(double)(sample->gyro_x * SAMPLING_GYRO_SCALE),
+		(double)(sample->gyro_y * SAMPLING_GYRO_SCALE),
+		(double)(sample->gyro_z * SAMPLING_GYRO_SCALE));
+}
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+static void sampling_decode_frame(const uint8_t *frame, struct imu_sample *sample)
+{
+	const uint8_t *accel = frame;
+
+	/* Headerless frames hold gyro before accel, accel only frames have no gyro */
+	if (gyro_enabled) {
+		sample->gyro_x = FROM_COUNTS((int16_t)sys_get_le16(&frame[0]), SAMPLING_GYRO_LSB);
+		sample->gyro_y = FROM_COUNTS((int16_t)sys_get_le16(&frame[2]), SAMPLING_GYRO_LSB);
+		sample->gyro_z = FROM_COUNTS((int16_t)sys_get_le16(&frame[4]), SAMPLING_GYRO_LSB);
+		accel = &frame[6];
+	} else {
+		sample->gyro_x = 0;
+		sample->gyro_y = 0;
+		sample->gyro_z = 0;
+	}
+
+	sample->accel_x = FROM_COUNTS((int16_t)sys_get_le16(&accel[0]), SAMPLING_ACCEL_LSB);
+	sample->accel_y = FROM_COUNTS((int16_t)sys_get_le16(&accel[2]), SAMPLING_ACCEL_LSB);
+	sample->accel_z = FROM_COUNTS((int16_t)sys_get_le16(&accel[4]), SAMPLING_ACCEL_LSB);
+}
+
+static void sampling_drain_fifo(void)
+{
+	uint8_t frame_size = gyro_enabled ? BMI270_FIFO_FRAME_SIZE : BMI270_FIFO_ACC_FRAME_SIZE;
+	uint32_t period_us = USEC_PER_SEC / sampling_frequency_hz;
+	uint32_t timestamp_us;
+	uint16_t frames;
 	int ret;
 
-	LOG_INF("Sampling thread started");
+	ret = sampling_bmi270_fifo_frames(&frames);
+	if (ret) {
+		loss_stats.read_errors++;
+		APP_LOG_ERR_RATELIMIT("Failed to read FIFO length: %d", ret);
+		return;
+	}
 
-	while (1) {
-		/* Wait for trigger */
-		k_sem_take(&sampling_sem, K_FOREVER);
+	/* The newest frame was sampled about now, older ones one period apart */
+	timestamp_us = sampling_time_us() - (uint32_t)frames * period_us;
 
-		if (!sampling_active) {
-			continue;
-		}
+	while (frames > 0) {
+		uint16_t count = MIN(frames, SAMPLING_BATCH_MAX);
+		struct imu_sample *samples;
+		uint16_t n = 0;
 
-		/* Get sample */
-		ret = sampling_get_sample(&sample);
+		/* Drain the whole block in one bus transaction */
+		profiling_marker_begin(PROFILING_MARKER_SAMPLING);
+		ret = sampling_bmi270_fifo_read(fifo_buf, count);
+		profiling_marker_end(PROFILING_MARKER_SAMPLING);
 		if (ret) {
-			LOG_ERR("Failed to get sample: %d", ret);
+			loss_stats.read_errors++;
+			APP_LOG_ERR_RATELIMIT("Failed to read FIFO: %d", ret);
+			return;
+		}
+
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+		struct net_buf *buf = net_buf_alloc(&imu_block_pool, K_NO_WAIT);
+
+		if (!buf) {
+			/* The consumers hold every block, they do not keep up */
+			loss_stats.pool_dropped += count;
+			APP_LOG_WRN_RATELIMIT("No free sample block, %u samples dropped",
+					      loss_stats.pool_dropped);
+			fifo_seq += count;
+			timestamp_us += count * period_us;
+			frames -= count;
 			continue;
 		}
 
-		/* Publish to zbus */
-		ret = zbus_chan_pub(&imu_data_chan, &sample, K_NO_WAIT);
+		samples = (struct imu_sample *)net_buf_tail(buf);
+#else
+		samples = batch.samples;
+#endif
+
+		for (uint16_t i = 0; i < count; i++) {
+			struct imu_sample frame;
+
+			sampling_decode_frame(&fifo_buf[i * frame_size], &frame);
+			frame.seq = fifo_seq++;
+			frame.timestamp_us = timestamp_us + (i + 1) * period_us;
+
+			if (sampling_decimate(&frame, &samples[n])) {
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+				sampling_fuse(&samples[n]);
+#endif
+#if defined(CONFIG_APP_SAMPLING_HISTORY)
+				sampling_history_add(&samples[n]);
+#endif
+				n++;
+			}
+		}
+
+		/* A block shorter than the decimation may not complete a sample */
+		if (n > 0) {
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+			const struct imu_sample_block block = {
+				.buf = buf,
+			};
+
+			net_buf_add(buf, n * sizeof(*samples));
+			ret = zbus_chan_pub(&imu_block_chan, &block, K_NO_WAIT);
+#else
+			batch.count = n;
+
+			ret = zbus_chan_pub(&imu_batch_chan, &batch, K_NO_WAIT);
+#endif
+			if (ret) {
+				loss_stats.publish_errors++;
+				APP_LOG_WRN_RATELIMIT("Failed to publish batch: %d", ret);
+			}
+		}
+
+		if (print_enabled) {
+			for (uint16_t i = 0; i < n; i++) {
+				sampling_print_sample(&samples[i]);
+			}
+		}
+
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+		/* Observers that kept the block took their own references */
+		net_buf_unref(buf);
+#endif
+
+		timestamp_us += count * period_us;
+		frames -= count;
+	}
+}
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+static void sampling_drain_coproc(void)
+{
+	const uint32_t period_us = USEC_PER_SEC / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+	const struct sampling_coproc_samples *msg;
+	uint32_t recv_us;
+	int ret;
+
+	while (sampling_coproc_get(&msg, &recv_us) == 0) {
+		uint16_t count = MIN(msg->count, SAMPLING_BATCH_MAX);
+		/* The newest sample was captured about when the block was sent */
+		uint32_t timestamp_us = recv_us - (uint32_t)(count - 1) * period_us;
+
+		for (uint16_t i = 0; i < count; i++) {
+			const int16_t *values = msg->values[i];
+			struct imu_sample *sample = &batch.samples[i];
+
+			sample->accel_x = FROM_COUNTS(values[0], SAMPLING_ACCEL_LSB);
+			sample->accel_y = FROM_COUNTS(values[1], SAMPLING_ACCEL_LSB);
+			sample->accel_z = FROM_COUNTS(values[2], SAMPLING_ACCEL_LSB);
+			sample->gyro_x = FROM_COUNTS(values[3], SAMPLING_GYRO_LSB);
+			sample->gyro_y = FROM_COUNTS(values[4], SAMPLING_GYRO_LSB);
+			sample->gyro_z = FROM_COUNTS(values[5], SAMPLING_GYRO_LSB);
+			sample->seq = msg->seq + i;
+			sample->timestamp_us = timestamp_us + i * period_us;
+
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+			sampling_fuse(sample);
+#endif
+#if defined(CONFIG_APP_SAMPLING_HISTORY)
+			sampling_history_add(sample);
+#endif
+		}
+
+		batch.count = count;
+
+		ret = zbus_chan_pub(&imu_batch_chan, &batch, K_NO_WAIT);
 		if (ret) {
-			LOG_WRN("Failed to publish: %d", ret);
+			loss_stats.publish_errors++;
+			APP_LOG_WRN_RATELIMIT("Failed to publish batch: %d", ret);
 		}
 
-		/* Only print if enabled (for raw sampling mode) */
 		if (print_enabled) {
-			printk("%f,%f,%f,%f,%f,%f\n",
-				sample.accel_x, sample.accel_y, sample.accel_z,
-				sample.gyro_x, sample.gyro_y, sample.gyro_z);
+			for (uint16_t i = 0; i < count; i++) {
+				sampling_print_sample(&batch.samples[i]);
+			}
+		}
+	}
+}
+#else
+#if defined(CONFIG_APP_SAMPLING_TIMING)
+/* Measure the acquisition of a period against the nominal period */
+static void sampling_timing_update(const struct sampling_trigger_entry *trigger)
+{
+	uint32_t now = k_cycle_get_32();
+	uint32_t latency_us = sampling_time_us() - trigger->time_us;
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_DATA_READY)
+	uint32_t period_us = USEC_PER_SEC / sampling_frequency_hz;
+#else
+	/* The timer period is rounded to ticks */
+	uint32_t period_us = k_ticks_to_us_near32(sampling_timer_period().ticks);
+#endif
+
+	if (latency_us >= period_us) {
+		timing_stats.deadline_misses++;
+	}
+	timing_stats.latency_max_us = MAX(timing_stats.latency_max_us, latency_us);
+
+	if (timing_started) {
+		uint32_t interval_us = k_cyc_to_us_near32(now - timing_last_cycles);
+		int32_t deviation_us = interval_us - (trigger->seq - timing_last_seq) * period_us;
+		uint32_t jitter_us = abs(deviation_us);
+		int bin = 0;
+
+		while (bin < SAMPLING_TIMING_BINS - 1 &&
+		       jitter_us >= ((uint32_t)CONFIG_APP_SAMPLING_TIMING_BIN_US << bin)) {
+			bin++;
+		}
+
+		timing_stats.jitter_hist[bin]++;
+		timing_stats.jitter_max_us = MAX(timing_stats.jitter_max_us, jitter_us);
+		timing_stats.intervals++;
+	}
+
+	timing_last_cycles = now;
+	timing_last_seq = trigger->seq;
+	timing_started = true;
+}
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_RTIO)
+/*
+ * Complete the read submitted on the previous sampling event and submit the
+ * one of this event, so the sampling thread does not wait for the bus. The
+ * sample goes out one period after its capture, with the sequence number and
+ * time of its own event in trigger. -EAGAIN when no read completed.
+ */
+static int sampling_read_pipelined(struct sampling_trigger_entry *trigger,
+				   struct imu_sample *sample)
+{
+	struct sampling_trigger_entry submitted = *trigger;
+	struct rtio_cqe *cqe;
+	int ret = -EAGAIN;
+
+	if (rtio_read_pending) {
+		cqe = rtio_cqe_consume(&imu_rtio);
+		if (!cqe) {
+			/* Still on the bus a period later, this event gets no read */
+			loss_stats.overruns++;
+			return -EAGAIN;
+		}
+
+		rtio_read_pending = false;
+		*trigger = rtio_read_trigger;
+		ret = sampling_read_complete(cqe, sample);
+	}
+
+	if (sampling_read_submit() == 0) {
+		rtio_read_pending = true;
+		rtio_read_trigger = submitted;
+	} else {
+		loss_stats.read_errors++;
+	}
+
+	return ret;
+}
+
+/* Drop the read still pending from before the last stop, its period is gone */
+static void sampling_read_flush(void)
+{
+	struct rtio_cqe *cqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+
+	if (!rtio_read_pending) {
+		return;
+	}
+
+	cqe = rtio_cqe_consume_block(&imu_rtio);
+	if (cqe->result == 0 &&
+	    rtio_cqe_get_mempool_buffer(&imu_rtio, cqe, &buf, &buf_len) == 0) {
+		rtio_release_buffer(&imu_rtio, buf, buf_len);
+	}
+	rtio_cqe_release(&imu_rtio, cqe);
+	rtio_read_pending = false;
+}
+#endif
+
+static void sampling_publish_sample(void)
+{
+	struct sampling_trigger_entry trigger;
+	struct imu_sample reading;
+	struct imu_sample sample;
+	bool triggered = false;
+	int ret;
+
+	/* Only the latest pending period is sampled, the others show up as a gap */
+	while (app_ring_get(&trigger_ring, &trigger)) {
+		triggered = true;
+	}
+
+	if (!triggered) {
+		return;
+	}
+
+	loss_stats.overruns += trigger.seq - trigger_next_seq;
+	trigger_next_seq = trigger.seq + 1;
+
+#if defined(CONFIG_APP_SAMPLING_TIMING)
+	sampling_timing_update(&trigger);
+#endif
+
+	/* Get sample */
+	profiling_marker_begin(PROFILING_MARKER_SAMPLING);
+#if defined(CONFIG_APP_SAMPLING_RTIO)
+	ret = sampling_read_pipelined(&trigger, &reading);
+#else
+	ret = sampling_get_sample(&reading);
+#endif
+	profiling_marker_end(PROFILING_MARKER_SAMPLING);
+#if defined(CONFIG_APP_SAMPLING_RTIO)
+	if (ret == -EAGAIN) {
+		return;
+	}
+#endif
+	if (ret) {
+		loss_stats.read_errors++;
+		APP_LOG_ERR_RATELIMIT("Failed to get sample: %d", ret);
+		return;
+	}
+
+	reading.seq = trigger.seq;
+	reading.timestamp_us = trigger.time_us;
+
+	if (!sampling_decimate(&reading, &sample)) {
+		return;
+	}
+
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+	sampling_fuse(&sample);
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_HISTORY)
+	sampling_history_add(&sample);
+#endif
+
+	/* Publish to zbus */
+	ret = zbus_chan_pub(&imu_data_chan, &sample, K_NO_WAIT);
+	if (ret) {
+		loss_stats.publish_errors++;
+		APP_LOG_WRN_RATELIMIT("Failed to publish: %d", ret);
+	}
+
+	/* Only print if enabled (for raw sampling mode) */
+	if (print_enabled) {
+		sampling_print_sample(&sample);
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_REPLAY)
+/* Publish the trace back to back until all passes are done or sampling stops */
+static void sampling_replay(void)
+{
+	const uint32_t trace_samples = sizeof(replay_trace) / REPLAY_SAMPLE_SIZE;
+	const uint32_t period_us = USEC_PER_SEC / CONFIG_APP_SAMPLING_FREQUENCY_HZ;
+	uint32_t start_us = sampling_time_us();
+	uint32_t start = k_cycle_get_32();
+	uint64_t cycles = 0;
+	uint32_t seq = 0;
+	uint32_t errors = 0;
+
+	while (sampling_active && seq < trace_samples * CONFIG_APP_SAMPLING_REPLAY_PASSES) {
+		const uint8_t *p = &replay_trace[(seq % trace_samples) * REPLAY_SAMPLE_SIZE];
+		struct imu_sample sample = {
+			.accel_x = FROM_COUNTS((int16_t)sys_get_le16(&p[0]), SAMPLING_ACCEL_LSB),
+			.accel_y = FROM_COUNTS((int16_t)sys_get_le16(&p[2]), SAMPLING_ACCEL_LSB),
+			.accel_z = FROM_COUNTS((int16_t)sys_get_le16(&p[4]), SAMPLING_ACCEL_LSB),
+			.gyro_x = FROM_COUNTS((int16_t)sys_get_le16(&p[6]), SAMPLING_GYRO_LSB),
+			.gyro_y = FROM_COUNTS((int16_t)sys_get_le16(&p[8]), SAMPLING_GYRO_LSB),
+			.gyro_z = FROM_COUNTS((int16_t)sys_get_le16(&p[10]), SAMPLING_GYRO_LSB),
+			.seq = seq,
+			.timestamp_us = start_us + seq * period_us,
+		};
+		uint32_t now;
+
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+		sampling_fuse(&sample);
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_HISTORY)
+		sampling_history_add(&sample);
+#endif
+
+		if (zbus_chan_pub(&imu_data_chan, &sample, K_NO_WAIT)) {
+			errors++;
+		}
+
+		/* Accumulated per sample, the 32-bit cycle counter wraps within a minute */
+		now = k_cycle_get_32();
+		cycles += now - start;
+		start = now;
+		seq++;
+	}
+
+	replay_stats.samples = seq;
+	replay_stats.publish_errors = errors;
+	replay_stats.cycles = cycles;
+	loss_stats.publish_errors += errors;
+
+	LOG_INF("Replayed %u samples in %u ms, %u samples/s, %u publish errors", seq,
+		(uint32_t)k_cyc_to_ms_floor64(cycles),
+		cycles ? (uint32_t)(seq * (uint64_t)sys_clock_hw_cycles_per_sec() / cycles) : 0,
+		errors);
+
+	if (sampling_active) {
+		sampling_stop();
+	}
+
+	k_sem_give(&replay_sem);
+}
+
+int sampling_replay_wait(k_timeout_t timeout, struct sampling_replay_stats *stats)
+{
+	if (k_sem_take(&replay_sem, timeout)) {
+		return -EAGAIN;
+	}
+
+	*stats = replay_stats;
+
+	return 0;
+}
+#endif
+
+static void sampling_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	LOG_INF("Sampling thread started");
+
+	while (1) {
+		/* Wait for trigger */
+		k_sem_take(&sampling_sem, K_FOREVER);
+
+		if (!sampling_active) {
+			continue;
 		}
+
+#if defined(CONFIG_APP_SAMPLING_REPLAY)
+		sampling_replay();
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+		sampling_drain_fifo();
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+		sampling_drain_coproc();
+#else
+		sampling_publish_sample();
+#endif
 	}
 }
 
@@ -182,11 +1582,69 @@ int sampling_start(void)
 		return -EALREADY;
 	}
 
-	LOG_INF("Starting continuous sampling at %d Hz", CONFIG_APP_SAMPLING_FREQUENCY_HZ);
+	if (sampling_suspended) {
+		LOG_WRN("Sampling suspended");
+		return -EBUSY;
+	}
+
+	LOG_INF("Starting continuous sampling at %d Hz, IMU ODR %d Hz",
+		CONFIG_APP_SAMPLING_FREQUENCY_HZ, sampling_frequency_hz);
+
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+	int ret = sampling_bmi270_fifo_enable(CONFIG_APP_SAMPLING_FIFO_WATERMARK, gyro_enabled);
+
+	if (ret) {
+		LOG_ERR("Failed to enable FIFO: %d", ret);
+		return ret;
+	}
+
+	fifo_seq = 0;
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	int ret = sampling_coproc_start(sampling_frequency_hz, coproc_decimation, gyro_enabled);
+
+	if (ret) {
+		return ret;
+	}
+#else
+	/* The trigger ISR and the sampling thread are idle until sampling is active */
+	app_ring_flush(&trigger_ring);
+	trigger_periods = 0;
+	trigger_next_seq = 0;
+#if defined(CONFIG_APP_SAMPLING_RTIO)
+	sampling_read_flush();
+#endif
+#if defined(CONFIG_APP_SAMPLING_TIMING)
+	/* The first acquisition after a start has no interval */
+	timing_started = false;
+#endif
+#endif
+
+	decimator.count = 0;
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+	app_dsp_mahony_init_f32(&fusion, CONFIG_APP_SAMPLING_FUSION_KP / 1000.0f,
+				CONFIG_APP_SAMPLING_FUSION_KI / 1000.0f);
+	fusion_seq = 0;
+#endif
 	sampling_active = true;
 
-	/* Start timer at CONFIG_APP_SAMPLING_FREQUENCY_HZ Hz (1000 / CONFIG_APP_SAMPLING_FREQUENCY_HZ ms period) */
-	k_timer_start(&sampling_timer, K_MSEC(1000 / CONFIG_APP_SAMPLING_FREQUENCY_HZ), K_MSEC(1000 / CONFIG_APP_SAMPLING_FREQUENCY_HZ));
+#if defined(CONFIG_APP_SAMPLING_PM_LOCK)
+	/* Single samples are read on time only without the exit latency of deep states */
+	pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_REPLAY)
+	/* The trace is published at once, without the sampling timer */
+	k_sem_reset(&replay_sem);
+	k_sem_give(&sampling_sem);
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_DATA_READY)
+	/* Samples are paced by the IMU data-ready interrupt */
+	k_sem_reset(&sampling_sem);
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	/* Blocks are paced by the coprocessor, no timer runs on this core */
+#else
+	/* Timer period is one sample, or one FIFO watermark in FIFO mode */
+	k_timer_start(&sampling_timer, sampling_timer_period(), sampling_timer_period());
+#endif
 
 	return 0;
 }
@@ -200,13 +1658,143 @@ int sampling_stop(void)
 
 	LOG_INF("Stopping continuous sampling");
 	sampling_active = false;
+#if !defined(CONFIG_APP_SAMPLING_ACQUISITION_DATA_READY)
 	k_timer_stop(&sampling_timer);
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_PM_LOCK)
+	pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+#endif
 
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+	sampling_bmi270_fifo_disable();
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+	(void)sampling_coproc_stop();
+#endif
+
+#if defined(CONFIG_APP_SAMPLING_STACK_USAGE)
+	size_t used;
+	size_t size;
+
+	if (sampling_get_stack_usage(&used, &size) == 0) {
+		LOG_INF("Sampling thread stack: %zu of %zu bytes used", used, size);
+	}
+#endif
+
+	return 0;
+}
+
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+void sampling_set_no_motion_detection(bool enabled)
+{
+	no_motion_armed = enabled;
+}
+
+int sampling_suspend(void)
+{
+	int ret;
+
+	if (sampling_active) {
+		LOG_WRN("Sampling active");
+		return -EBUSY;
+	}
+
+	if (sampling_suspended) {
+		return -EALREADY;
+	}
+
+#if defined(CONFIG_APP_SAMPLING_LP_ACCEL)
+	/* The low-power accelerometer watches for motion, the BMI270 powers down */
+	ret = sampling_set_odr(0, 0);
+#else
+	/* Accelerometer only at a low rate, enough for the motion features */
+	ret = sampling_set_odr(CONFIG_APP_SAMPLING_LOW_POWER_FREQUENCY_HZ, 0);
+#endif
+	if (ret) {
+		return ret;
+	}
+
+	sampling_suspended = true;
+	any_motion_armed = true;
+
+	LOG_INF("Sampling suspended until motion");
+	return 0;
+}
+
+int sampling_resume(void)
+{
+	int ret;
+
+	if (!sampling_suspended) {
+		return -EALREADY;
+	}
+
+	any_motion_armed = false;
+
+	ret = sampling_set_odr(sampling_frequency_hz, gyro_enabled ? sampling_frequency_hz : 0);
+	if (ret) {
+		return ret;
+	}
+
+	sampling_suspended = false;
+
+	LOG_INF("Sampling resumed at %d Hz", sampling_frequency_hz);
 	return 0;
 }
+#endif
 
 void sampling_set_print_enabled(bool enabled)
 {
 	print_enabled = enabled;
 	LOG_DBG("Sample printing %s", enabled ? "enabled" : "disabled");
+
+#if defined(CONFIG_APP_SAMPLING_STREAM)
+	/* Describe the samples before the first one, the host may have just connected */
+	if (enabled) {
+		(void)sampling_stream_send_info();
+	}
+#endif
+}
+
+void sampling_get_stats(struct sampling_stats *stats)
+{
+	*stats = loss_stats;
+}
+
+int sampling_get_timing_stats(struct sampling_timing_stats *stats)
+{
+#if defined(CONFIG_APP_SAMPLING_TIMING)
+	*stats = timing_stats;
+
+	return 0;
+#else
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+#endif
+}
+
+k_tid_t sampling_get_thread(void)
+{
+	return sampling_thread;
+}
+
+int sampling_get_stack_usage(size_t *used, size_t *size)
+{
+#if defined(CONFIG_APP_SAMPLING_STACK_USAGE)
+	size_t unused;
+	int ret;
+
+	ret = k_thread_stack_space_get(sampling_thread, &unused);
+	if (ret) {
+		return ret;
+	}
+
+	*size = sampling_thread->stack_info.size;
+	*used = *size - unused;
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
 }
@@ -8,24 +8,309 @@
 #define _SAMPLING_H_
 
 #include <zephyr/zbus/zbus.h>
+#include <zephyr/sys/util.h>
+#include <math.h>
+#include <stdint.h>
+
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+#include <zephyr/net_buf.h>
+#endif
+
+/* SI units per raw count (m/s^2 and rad/s) for the configured full-scale ranges */
+#define SAMPLING_ACCEL_LSB (CONFIG_APP_SAMPLING_ACCEL_RANGE_G * 9.80665f / 32768.0f)
+#define SAMPLING_GYRO_LSB \
+	(CONFIG_APP_SAMPLING_GYRO_RANGE_DPS * 3.14159265f / 180.0f / 32768.0f)
+
+/* Sample value type, multiply by the scale to get SI units */
+#if defined(CONFIG_APP_SAMPLING_FORMAT_RAW)
+typedef int16_t imu_value_t;
+#define SAMPLING_ACCEL_SCALE SAMPLING_ACCEL_LSB
+#define SAMPLING_GYRO_SCALE SAMPLING_GYRO_LSB
+#elif defined(CONFIG_APP_SAMPLING_FORMAT_FLOAT)
+typedef float imu_value_t;
+#define SAMPLING_ACCEL_SCALE 1.0f
+#define SAMPLING_GYRO_SCALE 1.0f
+#else
+typedef double imu_value_t;
+#define SAMPLING_ACCEL_SCALE 1.0f
+#define SAMPLING_GYRO_SCALE 1.0f
+#endif
+
+/* Sample value to sensor counts, saturated to the int16 range */
+static inline int16_t sampling_value_counts(imu_value_t value, float scale, float lsb)
+{
+#if defined(CONFIG_APP_SAMPLING_FORMAT_RAW)
+	ARG_UNUSED(scale);
+	ARG_UNUSED(lsb);
+	return value;
+#else
+	long counts = lroundf((float)value * scale / lsb);
+
+	return (int16_t)CLAMP(counts, INT16_MIN, INT16_MAX);
+#endif
+}
 
 struct imu_sample {
-	double accel_x;
-	double accel_y;
-	double accel_z;
-	double gyro_x;
-	double gyro_y;
-	double gyro_z;
+	imu_value_t accel_x;
+	imu_value_t accel_y;
+	imu_value_t accel_z;
+	imu_value_t gyro_x;
+	imu_value_t gyro_y;
+	imu_value_t gyro_z;
+	/*
+	 * Sampling period of a published sample since sampling started, at
+	 * CONFIG_APP_SAMPLING_FREQUENCY_HZ, a gap means samples were lost. Not
+	 * set by sampling_get_sample().
+	 */
+	uint32_t seq;
+	/* Capture time of a published sample in microseconds, see sampling_time_us() */
+	uint32_t timestamp_us;
+#if defined(CONFIG_APP_SAMPLING_FUSION)
+	/*
+	 * Acceleration without gravity, in the unit of accel_x, and orientation
+	 * quaternion w, x, y, z from the sensor to a world frame with its z axis
+	 * up. Only set for published samples.
+	 */
+	imu_value_t lin_accel_x;
+	imu_value_t lin_accel_y;
+	imu_value_t lin_accel_z;
+	float orientation[4];
+#endif
+};
+
+/* Maximum number of samples carried by one batch message */
+#if defined(CONFIG_APP_SAMPLING_ACQUISITION_FIFO)
+#define SAMPLING_BATCH_MAX CONFIG_APP_SAMPLING_FIFO_WATERMARK
+#elif defined(CONFIG_APP_SAMPLING_ACQUISITION_COPROC)
+#define SAMPLING_BATCH_MAX CONFIG_APP_SAMPLING_COPROC_BLOCK_SAMPLES
+#else
+#define SAMPLING_BATCH_MAX 1
+#endif
+
+/* Block of consecutive samples drained from the sensor FIFO or sent by the coprocessor */
+struct imu_sample_batch {
+	uint16_t count;
+	struct imu_sample samples[SAMPLING_BATCH_MAX];
+};
+
+#if defined(CONFIG_APP_SAMPLING_BLOCK_POOL)
+/*
+ * Reference counted block of consecutive samples drained from the sensor
+ * FIFO, published on imu_block_chan. The observers share one pooled buffer
+ * without copying. Listeners may read it during the callback, to keep it
+ * longer take a reference with net_buf_ref() in the callback and drop it
+ * with net_buf_unref() once done. The block returns to the pool with the
+ * last reference. While no block is free, drained samples are dropped.
+ */
+struct imu_sample_block {
+	struct net_buf *buf;
+};
+
+static inline const struct imu_sample *imu_sample_block_samples(const struct net_buf *buf)
+{
+	return (const struct imu_sample *)buf->data;
+}
+
+static inline uint16_t imu_sample_block_count(const struct net_buf *buf)
+{
+	return buf->len / sizeof(struct imu_sample);
+}
+#endif
+
+/* Motion events from the IMU motion detection features */
+enum imu_motion_event_type {
+	IMU_MOTION_EVENT_NO_MOTION,
+	IMU_MOTION_EVENT_ANY_MOTION,
+};
+
+struct imu_motion_event {
+	enum imu_motion_event_type type;
+	uint32_t timestamp;
+};
+
+/* Samples lost in the sampling module since boot */
+struct sampling_stats {
+	/* Failed sensor or FIFO reads */
+	uint32_t read_errors;
+	/* Failed publishes on the IMU data channels */
+	uint32_t publish_errors;
+	/* Sampling periods missed while the sampling thread was still busy */
+	uint32_t overruns;
+	/* Samples dropped while every pooled sample block was in use */
+	uint32_t pool_dropped;
+};
+
+/* Bins of the acquisition jitter histogram */
+#define SAMPLING_TIMING_BINS 8
+
+/* Acquisition timing of single sample modes since boot */
+struct sampling_timing_stats {
+	/* Intervals between two acquisitions measured */
+	uint32_t intervals;
+	/* Acquisitions made after the next sampling period had started */
+	uint32_t deadline_misses;
+	/* Largest deviation of an interval from the nominal period */
+	uint32_t jitter_max_us;
+	/* Largest delay from the start of a period to its acquisition */
+	uint32_t latency_max_us;
+	/*
+	 * Intervals by deviation from the nominal period, bin n below
+	 * CONFIG_APP_SAMPLING_TIMING_BIN_US << n, the last bin all others
+	 */
+	uint32_t jitter_hist[SAMPLING_TIMING_BINS];
 };
 
 /* Zbus channel declaration */
 ZBUS_CHAN_DECLARE(imu_data_chan);
+ZBUS_CHAN_DECLARE(imu_batch_chan);
+ZBUS_CHAN_DECLARE(imu_block_chan);
+ZBUS_CHAN_DECLARE(imu_motion_chan);
 
 int sampling_init(void);
-int sampling_set_frequency(int frequency_hz);
 int sampling_get_sample(struct imu_sample *sample);
 int sampling_start(void);
 int sampling_stop(void);
 void sampling_set_print_enabled(bool enabled);
 
+/**
+ * @brief Get the time base of sample timestamps
+ * @return Time since boot in microseconds, wraps around after about 71 minutes
+ */
+uint32_t sampling_time_us(void);
+
+/**
+ * @brief Align a relative timeout to the sampling wake cycle
+ *
+ * With CONFIG_APP_SAMPLING_WAKE_ALIGN the timeout is rounded up to the next
+ * expiry of the sampling timer at or after it, so work due about then runs
+ * in the same CPU wakeup as the sampling thread instead of one of its own.
+ * Returned unchanged otherwise, while sampling is stopped or paced by the IMU.
+ *
+ * @param timeout Relative timeout, K_NO_WAIT or K_FOREVER
+ * @return Timeout delayed by less than one sampling timer period
+ */
+k_timeout_t sampling_align_timeout(k_timeout_t timeout);
+
+/**
+ * @brief Set the IMU output data rate
+ *
+ * Sampling must be stopped. The ODR must be a multiple of
+ * CONFIG_APP_SAMPLING_FREQUENCY_HZ, samples are decimated down to that
+ * rate before they are published, so published samples, their sequence
+ * numbers and the model windows keep the same rate at every ODR. The
+ * sampling timer follows the ODR from the next sampling_start().
+ *
+ * @param frequency_hz ODR in Hz, CONFIG_APP_SAMPLING_ODR_HZ after sampling_init()
+ * @return 0 on success, -EBUSY while sampling, -EINVAL if the ODR is not a
+ *	   multiple of CONFIG_APP_SAMPLING_FREQUENCY_HZ or, with the FIR
+ *	   decimator, above CONFIG_APP_SAMPLING_DECIMATION_MAX times it,
+ *	   negative error code on other failures
+ */
+int sampling_set_frequency(int frequency_hz);
+
+/**
+ * @brief Get the IMU output data rate
+ * @return ODR in Hz
+ */
+int sampling_get_frequency(void);
+
+/**
+ * @brief Get the sample loss counters
+ * @param stats Counters since boot
+ */
+void sampling_get_stats(struct sampling_stats *stats);
+
+/**
+ * @brief Get the acquisition jitter histogram and deadline misses
+ *
+ * Requires CONFIG_APP_SAMPLING_TIMING. Intervals spanning missed periods
+ * are compared against the same number of nominal periods.
+ *
+ * @param stats Timing since boot
+ * @return 0 on success, -ENOTSUP if not enabled
+ */
+int sampling_get_timing_stats(struct sampling_timing_stats *stats);
+
+/**
+ * @brief Power the gyroscope up or down
+ *
+ * Sampling must be stopped. While disabled the gyroscope ODR is 0, only
+ * accelerometer data is read from the IMU and the gyro fields of published
+ * samples are 0.
+ *
+ * @param enabled Read the gyroscope along with the accelerometer
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_set_gyro_enabled(bool enabled);
+
+/**
+ * @brief Publish one no-motion event on imu_motion_chan when the IMU gets still
+ * @param enabled Arm or disarm no-motion detection
+ */
+void sampling_set_no_motion_detection(bool enabled);
+
+/**
+ * @brief Enter the low power accelerometer only mode until motion is detected
+ *
+ * Sampling must be stopped. The gyroscope is powered down and the
+ * accelerometer runs at CONFIG_APP_SAMPLING_LOW_POWER_FREQUENCY_HZ, or with
+ * CONFIG_APP_SAMPLING_LP_ACCEL the IMU is powered down completely and the
+ * low-power accelerometer watches for motion. One any-motion event is
+ * published on imu_motion_chan when motion is detected.
+ *
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_suspend(void);
+
+/**
+ * @brief Leave the low power mode and restore the sampling frequency
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_resume(void);
+
+/**
+ * @brief Get the peak stack usage of the sampling thread
+ *
+ * Requires CONFIG_APP_SAMPLING_STACK_USAGE.
+ *
+ * @param used Peak number of stack bytes used since the thread started
+ * @param size Stack size in bytes
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_get_stack_usage(size_t *used, size_t *size);
+
+#if defined(CONFIG_APP_SAMPLING_REPLAY)
+/* Throughput of a trace replay */
+struct sampling_replay_stats {
+	/* Samples published, and not accepted by imu_data_chan */
+	uint32_t samples;
+	uint32_t publish_errors;
+	/* Hardware cycles from the first to the last published sample */
+	uint64_t cycles;
+};
+
+/**
+ * @brief Wait for the trace replay started by sampling_start() to end
+ *
+ * Requires CONFIG_APP_SAMPLING_REPLAY. Sampling stops by itself after
+ * CONFIG_APP_SAMPLING_REPLAY_PASSES passes over the trace, or earlier with
+ * sampling_stop().
+ *
+ * @param timeout Time to wait
+ * @param stats Throughput of the replay
+ * @return 0 on success, -EAGAIN if the replay did not end in time
+ */
+int sampling_replay_wait(k_timeout_t timeout, struct sampling_replay_stats *stats);
+#endif
+
+/**
+ * @brief Get the sampling thread
+ *
+ * Detection and the other listeners of the IMU data channels run in this
+ * thread unless they hand the samples off.
+ *
+ * @return Thread ID
+ */
+k_tid_t sampling_get_thread(void);
+
 #endif /* _SAMPLING_H_ */
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/byteorder.h>
+#include <errno.h>
+
+#if DT_ON_BUS(DT_ALIAS(imu0), spi)
+#include <zephyr/drivers/spi.h>
+#else
+#include <zephyr/drivers/i2c.h>
+#endif
+
+#include "sampling_bmi270.h"
+
+LOG_MODULE_DECLARE(app_sampling, CONFIG_APP_SAMPLING_LOG_LEVEL);
+
+#define BMI270_SPI_READ_BIT 0x80
+
+#if DT_ON_BUS(DT_ALIAS(imu0), spi)
+static const struct spi_dt_spec imu_bus =
+	SPI_DT_SPEC_GET(DT_ALIAS(imu0), SPI_WORD_SET(8) | SPI_TRANSFER_MSB, 0);
+#else
+static const struct i2c_dt_spec imu_bus = I2C_DT_SPEC_GET(DT_ALIAS(imu0));
+#endif
+
+/* Size of the frames collected since the last FIFO enable */
+static uint8_t fifo_frame_size = BMI270_FIFO_FRAME_SIZE;
+
+int sampling_bmi270_init(void)
+{
+#if DT_ON_BUS(DT_ALIAS(imu0), spi)
+	if (!spi_is_ready_dt(&imu_bus)) {
+#else
+	if (!i2c_is_ready_dt(&imu_bus)) {
+#endif
+		LOG_ERR("IMU bus not ready");
+		return -ENODEV;
+	}
+
+	return 0;
+}
+
+int sampling_bmi270_read(uint8_t reg, uint8_t *buf, size_t len)
+{
+#if DT_ON_BUS(DT_ALIAS(imu0), spi)
+	/* SPI reads return one dummy byte after the address byte */
+	uint8_t addr = reg | BMI270_SPI_READ_BIT;
+	const struct spi_buf tx_buf = { .buf = &addr, .len = 1 };
+	const struct spi_buf_set tx = { .buffers = &tx_buf, .count = 1 };
+	struct spi_buf rx_bufs[] = {
+		{ .buf = NULL, .len = 2 },
+		{ .buf = buf, .len = len },
+	};
+	const struct spi_buf_set rx = { .buffers = rx_bufs, .count = ARRAY_SIZE(rx_bufs) };
+
+	return spi_transceive_dt(&imu_bus, &tx, &rx);
+#else
+	return i2c_burst_read_dt(&imu_bus, reg, buf, len);
+#endif
+}
+
+int sampling_bmi270_write(uint8_t reg, uint8_t val)
+{
+#if DT_ON_BUS(DT_ALIAS(imu0), spi)
+	uint8_t data[2] = { reg & ~BMI270_SPI_READ_BIT, val };
+	const struct spi_buf tx_buf = { .buf = data, .len = sizeof(data) };
+	const struct spi_buf_set tx = { .buffers = &tx_buf, .count = 1 };
+
+	return spi_write_dt(&imu_bus, &tx);
+#else
+	return i2c_reg_write_byte_dt(&imu_bus, reg, val);
+#endif
+}
+
+int sampling_bmi270_fifo_enable(uint16_t watermark_frames, bool gyro)
+{
+	uint16_t watermark_bytes;
+	int ret;
+
+	fifo_frame_size = gyro ? BMI270_FIFO_FRAME_SIZE : BMI270_FIFO_ACC_FRAME_SIZE;
+	watermark_bytes = watermark_frames * fifo_frame_size;
+
+	/* Stream mode, no sensortime frames */
+	ret = sampling_bmi270_write(BMI270_REG_FIFO_CONFIG_0, 0x00);
+	if (ret) {
+		return ret;
+	}
+
+	ret = sampling_bmi270_write(BMI270_REG_FIFO_WTM_0, watermark_bytes & 0xFF);
+	if (ret) {
+		return ret;
+	}
+
+	ret = sampling_bmi270_write(BMI270_REG_FIFO_WTM_0 + 1, (watermark_bytes >> 8) & 0x1F);
+	if (ret) {
+		return ret;
+	}
+
+	/* Headerless mode, accel and optionally gyro frames */
+	ret = sampling_bmi270_write(BMI270_REG_FIFO_CONFIG_1,
+				    BMI270_FIFO_CONFIG_1_ACC_EN |
+				    (gyro ? BMI270_FIFO_CONFIG_1_GYR_EN : 0));
+	if (ret) {
+		return ret;
+	}
+
+	return sampling_bmi270_write(BMI270_REG_CMD, BMI270_CMD_FIFO_FLUSH);
+}
+
+int sampling_bmi270_fifo_disable(void)
+{
+	return sampling_bmi270_write(BMI270_REG_FIFO_CONFIG_1, 0x00);
+}
+
+int sampling_bmi270_fifo_frames(uint16_t *frames)
+{
+	uint8_t len[2];
+	int ret;
+
+	ret = sampling_bmi270_read(BMI270_REG_FIFO_LENGTH_0, len, sizeof(len));
+	if (ret) {
+		return ret;
+	}
+
+	*frames = (sys_get_le16(len) & BMI270_FIFO_LENGTH_MASK) / fifo_frame_size;
+
+	return 0;
+}
+
+int sampling_bmi270_fifo_read(uint8_t *buf, uint16_t frames)
+{
+	return sampling_bmi270_read(BMI270_REG_FIFO_DATA, buf, frames * fifo_frame_size);
+}
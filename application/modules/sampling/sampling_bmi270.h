@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLING_BMI270_H_
+#define _SAMPLING_BMI270_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <zephyr/sys/util.h>
+
+/* BMI270 register map (subset used by the sampling module) */
+#define BMI270_REG_DATA_8		0x0C
+#define BMI270_REG_FIFO_LENGTH_0	0x24
+#define BMI270_REG_FIFO_DATA		0x26
+#define BMI270_REG_FIFO_WTM_0		0x46
+#define BMI270_REG_FIFO_CONFIG_0	0x48
+#define BMI270_REG_FIFO_CONFIG_1	0x49
+#define BMI270_REG_CMD			0x7E
+
+#define BMI270_FIFO_LENGTH_MASK		0x3FFF
+#define BMI270_FIFO_CONFIG_1_ACC_EN	BIT(6)
+#define BMI270_FIFO_CONFIG_1_GYR_EN	BIT(7)
+#define BMI270_CMD_FIFO_FLUSH		0xB0
+
+/* Data registers from DATA_8: ACC_X..ACC_Z, GYR_X..GYR_Z, int16 little endian */
+#define BMI270_DATA_SIZE		12
+#define BMI270_DATA_ACC_SIZE		6
+
+/* Headerless accel + gyro frame: GYR_X..GYR_Z, ACC_X..ACC_Z, int16 little endian */
+#define BMI270_FIFO_FRAME_SIZE		12
+
+/* Headerless accel only frame: ACC_X..ACC_Z, int16 little endian */
+#define BMI270_FIFO_ACC_FRAME_SIZE	6
+
+/**
+ * @brief Set up raw register access to the BMI270 behind the imu0 alias
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_bmi270_init(void);
+
+/**
+ * @brief Burst read consecutive registers (or the FIFO data port)
+ * @param reg First register address
+ * @param buf Destination buffer
+ * @param len Number of bytes to read
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_bmi270_read(uint8_t reg, uint8_t *buf, size_t len);
+
+/**
+ * @brief Write a single register
+ * @param reg Register address
+ * @param val Value to write
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_bmi270_write(uint8_t reg, uint8_t val);
+
+/**
+ * @brief Enable headerless FIFO with a frame watermark and flush it
+ *
+ * Frames hold accel and gyro data, BMI270_FIFO_FRAME_SIZE bytes, or accel
+ * data only, BMI270_FIFO_ACC_FRAME_SIZE bytes, until the next enable.
+ *
+ * @param watermark_frames Watermark level in frames
+ * @param gyro Include gyro data in the frames
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_bmi270_fifo_enable(uint16_t watermark_frames, bool gyro);
+
+/**
+ * @brief Stop collecting frames in the FIFO
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_bmi270_fifo_disable(void);
+
+/**
+ * @brief Get the number of complete frames currently held in the FIFO
+ * @param frames Number of frames available
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_bmi270_fifo_frames(uint16_t *frames);
+
+/**
+ * @brief Drain frames from the FIFO in a single burst transaction
+ * @param buf Destination buffer, at least frames times the frame size bytes
+ * @param frames Number of frames to read
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_bmi270_fifo_read(uint8_t *buf, uint16_t frames);
+
+#endif /* _SAMPLING_BMI270_H_ */
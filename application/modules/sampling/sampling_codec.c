@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+
+#include "sampling_codec.h"
+
+static inline uint32_t zigzag(int32_t value)
+{
+	return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t value)
+{
+	return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+/* 7 bits per byte, least significant first, high bit set on all but the last */
+static inline size_t varint_put(uint32_t value, uint8_t *buf)
+{
+	size_t n = 0;
+
+	while (value >= 0x80) {
+		buf[n++] = (uint8_t)value | 0x80;
+		value >>= 7;
+	}
+	buf[n++] = (uint8_t)value;
+
+	return n;
+}
+
+static inline int varint_get(const uint8_t *buf, size_t len, uint32_t *value)
+{
+	uint32_t result = 0;
+
+	for (size_t n = 0; n < MIN(len, 5); n++) {
+		result |= (uint32_t)(buf[n] & 0x7f) << (7 * n);
+		if (!(buf[n] & 0x80)) {
+			*value = result;
+			return n + 1;
+		}
+	}
+
+	return -EINVAL;
+}
+
+void sampling_codec_reset(struct sampling_codec_state *state)
+{
+	memset(state, 0, sizeof(*state));
+}
+
+size_t sampling_codec_encode(struct sampling_codec_state *state, uint32_t timestamp_us,
+			     const int16_t axes[SAMPLING_CODEC_AXES], uint8_t *buf)
+{
+	uint32_t period_us = timestamp_us - state->timestamp_us;
+	size_t n;
+
+	n = varint_put(zigzag((int32_t)(period_us - state->period_us)), buf);
+	state->timestamp_us = timestamp_us;
+	state->period_us = period_us;
+
+	for (int i = 0; i < SAMPLING_CODEC_AXES; i++) {
+		n += varint_put(zigzag((int32_t)axes[i] - state->axes[i]), &buf[n]);
+		state->axes[i] = axes[i];
+	}
+
+	return n;
+}
+
+int sampling_codec_decode(struct sampling_codec_state *state, const uint8_t *buf, size_t len,
+			  uint32_t *timestamp_us, int16_t axes[SAMPLING_CODEC_AXES])
+{
+	uint32_t value;
+	size_t n;
+	int ret;
+
+	ret = varint_get(buf, len, &value);
+	if (ret < 0) {
+		return ret;
+	}
+	n = ret;
+
+	state->period_us += (uint32_t)unzigzag(value);
+	state->timestamp_us += state->period_us;
+	*timestamp_us = state->timestamp_us;
+
+	for (int i = 0; i < SAMPLING_CODEC_AXES; i++) {
+		ret = varint_get(&buf[n], len - n, &value);
+		if (ret < 0) {
+			return ret;
+		}
+		n += ret;
+
+		state->axes[i] = (int16_t)(state->axes[i] + unzigzag(value));
+		axes[i] = state->axes[i];
+	}
+
+	return n;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLING_CODEC_H_
+#define _SAMPLING_CODEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Axes per sample, accel X..Z then gyro X..Z in sensor counts */
+#define SAMPLING_CODEC_AXES 6
+
+/*
+ * Largest encoded sample, a 32-bit timestamp varint and six 17-bit delta
+ * varints. Axes changing by less than 64 counts per sample take one byte.
+ */
+#define SAMPLING_CODEC_SAMPLE_MAX (5 + SAMPLING_CODEC_AXES * 3)
+
+/**
+ * @brief Prediction state of one encoded block, the same on both ends
+ *
+ * A block starts from the zero state, so every block decodes on its own and
+ * a lost block does not corrupt the ones after it.
+ */
+struct sampling_codec_state {
+	uint32_t timestamp_us;
+	uint32_t period_us;
+	int16_t axes[SAMPLING_CODEC_AXES];
+};
+
+/**
+ * @brief Reset the state at the start of a block
+ * @param state Codec state
+ */
+void sampling_codec_reset(struct sampling_codec_state *state);
+
+/**
+ * @brief Encode one sample
+ *
+ * Each axis is stored as the zigzag varint of its difference to the previous
+ * sample, the timestamp as the zigzag varint of the change of the sampling
+ * period, so the steady period of a stream takes one byte. Lossless.
+ *
+ * @param state Codec state, advanced to the sample
+ * @param timestamp_us Capture time of the sample
+ * @param axes Accel X..Z and gyro X..Z in sensor counts
+ * @param buf Output of at least SAMPLING_CODEC_SAMPLE_MAX bytes
+ * @return Number of bytes written
+ */
+size_t sampling_codec_encode(struct sampling_codec_state *state, uint32_t timestamp_us,
+			     const int16_t axes[SAMPLING_CODEC_AXES], uint8_t *buf);
+
+/**
+ * @brief Decode one sample
+ * @param state Codec state, advanced to the sample
+ * @param buf Encoded samples
+ * @param len Bytes left in buf
+ * @param timestamp_us Capture time of the sample
+ * @param axes Accel X..Z and gyro X..Z in sensor counts
+ * @return Number of bytes consumed, -EINVAL if buf ends inside the sample
+ */
+int sampling_codec_decode(struct sampling_codec_state *state, const uint8_t *buf, size_t len,
+			  uint32_t *timestamp_us, int16_t axes[SAMPLING_CODEC_AXES]);
+
+#endif /* _SAMPLING_CODEC_H_ */
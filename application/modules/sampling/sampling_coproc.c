@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/logging/log.h>
+#include <errno.h>
+#include <string.h>
+#include "sampling.h"
+#include "sampling_coproc.h"
+#include "app_log.h"
+
+LOG_MODULE_DECLARE(app_sampling, CONFIG_APP_SAMPLING_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_APP_SAMPLING_COPROC_BLOCK_SAMPLES <= SAMPLING_COPROC_BLOCK_MAX,
+	     "Samples messages hold at most SAMPLING_COPROC_BLOCK_MAX samples");
+
+static const struct device *const ipc_dev = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+static struct ipc_ept ept;
+static K_SEM_DEFINE(bound_sem, 0, 1);
+static struct k_sem *ready_sem;
+
+struct sampling_coproc_entry {
+	struct sampling_coproc_samples msg;
+	uint32_t recv_us;
+};
+
+/* Samples messages received in the IPC context, drained by the sampling thread */
+K_MSGQ_DEFINE(coproc_msgq, sizeof(struct sampling_coproc_entry),
+	      CONFIG_APP_SAMPLING_COPROC_QUEUE_SIZE, 4);
+
+/* Last message taken, only accessed from the sampling thread */
+static struct sampling_coproc_entry current;
+static uint32_t dropped;
+
+static void ept_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	k_sem_give(&bound_sem);
+}
+
+static void ept_received(const void *data, size_t len, void *priv)
+{
+	const struct sampling_coproc_samples *msg = data;
+	struct sampling_coproc_entry entry;
+
+	ARG_UNUSED(priv);
+
+	/* The receive time dates the block, take it before anything else */
+	entry.recv_us = sampling_time_us();
+
+	if (len != sizeof(*msg) || msg->type != SAMPLING_COPROC_MSG_SAMPLES ||
+	    msg->count == 0 || msg->count > SAMPLING_COPROC_BLOCK_MAX) {
+		APP_LOG_WRN_RATELIMIT("Malformed message from coprocessor, %zu bytes", len);
+		return;
+	}
+
+	memcpy(&entry.msg, msg, sizeof(entry.msg));
+
+	/* The sampling thread is behind, the block shows up as a sequence gap */
+	if (k_msgq_put(&coproc_msgq, &entry, K_NO_WAIT)) {
+		dropped += msg->count;
+		APP_LOG_WRN_RATELIMIT("Coprocessor queue full, %u samples dropped", dropped);
+		return;
+	}
+
+	k_sem_give(ready_sem);
+}
+
+static const struct ipc_ept_cfg ept_cfg = {
+	.name = SAMPLING_COPROC_ENDPOINT,
+	.cb = {
+		.bound = ept_bound,
+		.received = ept_received,
+	},
+};
+
+int sampling_coproc_init(struct k_sem *ready)
+{
+	int ret;
+
+	ready_sem = ready;
+
+	ret = ipc_service_open_instance(ipc_dev);
+	if (ret && ret != -EALREADY) {
+		LOG_ERR("Failed to open IPC instance: %d", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc_dev, &ept, &ept_cfg);
+	if (ret) {
+		LOG_ERR("Failed to register IPC endpoint: %d", ret);
+		return ret;
+	}
+
+	ret = k_sem_take(&bound_sem, K_MSEC(CONFIG_APP_SAMPLING_COPROC_BIND_TIMEOUT_MS));
+	if (ret) {
+		LOG_ERR("Coprocessor did not bind the sampling endpoint");
+		return -ETIMEDOUT;
+	}
+
+	LOG_INF("IMU acquisition delegated to the coprocessor, %u samples per message",
+		CONFIG_APP_SAMPLING_COPROC_BLOCK_SAMPLES);
+
+	return 0;
+}
+
+int sampling_coproc_start(uint16_t odr_hz, uint16_t decimation, bool gyro)
+{
+	const struct sampling_coproc_start start = {
+		.type = SAMPLING_COPROC_MSG_START,
+		.gyro_enabled = gyro,
+		.block_samples = CONFIG_APP_SAMPLING_COPROC_BLOCK_SAMPLES,
+		.odr_hz = odr_hz,
+		.decimation = decimation,
+		.accel_range_g = CONFIG_APP_SAMPLING_ACCEL_RANGE_G,
+		.gyro_range_dps = CONFIG_APP_SAMPLING_GYRO_RANGE_DPS,
+	};
+	int ret;
+
+	k_msgq_purge(&coproc_msgq);
+
+	ret = ipc_service_send(&ept, &start, sizeof(start));
+	if (ret < 0) {
+		LOG_ERR("Failed to start coprocessor acquisition: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+int sampling_coproc_stop(void)
+{
+	static const struct sampling_coproc_stop stop = {
+		.type = SAMPLING_COPROC_MSG_STOP,
+	};
+	int ret;
+
+	ret = ipc_service_send(&ept, &stop, sizeof(stop));
+	k_msgq_purge(&coproc_msgq);
+
+	if (ret < 0) {
+		LOG_ERR("Failed to stop coprocessor acquisition: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+int sampling_coproc_get(const struct sampling_coproc_samples **msg, uint32_t *recv_us)
+{
+	if (k_msgq_get(&coproc_msgq, &current, K_NO_WAIT)) {
+		return -EAGAIN;
+	}
+
+	*msg = &current.msg;
+	*recv_us = current.recv_us;
+
+	return 0;
+}
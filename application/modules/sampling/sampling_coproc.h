@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLING_COPROC_H_
+#define _SAMPLING_COPROC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+/* Name of the IPC service endpoint on both cores */
+#define SAMPLING_COPROC_ENDPOINT "sampling"
+
+/* Largest number of samples in one samples message */
+#define SAMPLING_COPROC_BLOCK_MAX 64
+
+/* Axes per sample, accel X..Z then gyro X..Z */
+#define SAMPLING_COPROC_AXES 6
+
+enum sampling_coproc_msg_type {
+	/* Application core to coprocessor */
+	SAMPLING_COPROC_MSG_START = 1,
+	SAMPLING_COPROC_MSG_STOP = 2,
+	/* Coprocessor to application core */
+	SAMPLING_COPROC_MSG_SAMPLES = 3,
+};
+
+/**
+ * @brief Start acquisition, sent with the settings of the run
+ *
+ * The coprocessor configures the IMU, samples it at the ODR and publishes
+ * the group average of every decimation consecutive samples.
+ */
+struct sampling_coproc_start {
+	uint8_t type;
+	uint8_t gyro_enabled;
+	/* Published samples per samples message */
+	uint16_t block_samples;
+	/* IMU output data rate in Hz */
+	uint16_t odr_hz;
+	/* IMU samples averaged into one published sample */
+	uint16_t decimation;
+	/* Full-scale ranges, the counts of the samples messages are in them */
+	uint16_t accel_range_g;
+	uint16_t gyro_range_dps;
+};
+
+/**
+ * @brief Stop acquisition and power the IMU down, sent without payload
+ */
+struct sampling_coproc_stop {
+	uint8_t type;
+};
+
+/**
+ * @brief Block of consecutive published samples in int16 sensor counts
+ *
+ * Gyro counts are 0 while the gyroscope is disabled. The newest sample of
+ * the block was captured when the message was sent.
+ */
+struct sampling_coproc_samples {
+	uint8_t type;
+	uint8_t reserved;
+	uint16_t count;
+	/* Sampling period of the first sample since the start, a gap means lost samples */
+	uint32_t seq;
+	int16_t values[SAMPLING_COPROC_BLOCK_MAX][SAMPLING_COPROC_AXES];
+};
+
+/**
+ * @brief Open the IPC endpoint to the acquisition coprocessor
+ *
+ * Waits up to CONFIG_APP_SAMPLING_COPROC_BIND_TIMEOUT_MS for the coprocessor
+ * to register its endpoint.
+ *
+ * @param ready Semaphore given whenever a samples message is queued
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_coproc_init(struct k_sem *ready);
+
+/**
+ * @brief Start acquisition on the coprocessor
+ * @param odr_hz IMU output data rate in Hz
+ * @param decimation IMU samples averaged into one published sample
+ * @param gyro Read the gyroscope along with the accelerometer
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_coproc_start(uint16_t odr_hz, uint16_t decimation, bool gyro);
+
+/**
+ * @brief Stop acquisition on the coprocessor and drop the queued messages
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_coproc_stop(void);
+
+/**
+ * @brief Take the next queued samples message
+ * @param msg Samples message, valid until the next call
+ * @param recv_us Time the message was received, see sampling_time_us()
+ * @return 0 on success, -EAGAIN if no message is queued
+ */
+int sampling_coproc_get(const struct sampling_coproc_samples **msg, uint32_t *recv_us);
+
+#endif /* _SAMPLING_COPROC_H_ */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+
+#include "sampling_history.h"
+
+/* Latest samples, sample n since boot at history[n % size] */
+static struct sampling_history_sample history[CONFIG_APP_SAMPLING_HISTORY_SAMPLES];
+/* Samples added since boot, only written by the sampling thread */
+static atomic_t history_added;
+
+static struct sampling_history_snapshot snapshots[2];
+/* Bit n set while snapshots[n] is held */
+static atomic_t snapshots_held;
+
+void sampling_history_add(const struct imu_sample *sample)
+{
+	atomic_val_t n = atomic_get(&history_added);
+	struct sampling_history_sample *p = &history[(uint32_t)n % ARRAY_SIZE(history)];
+
+	p->timestamp_us = sample->timestamp_us;
+	p->axes[0] = sampling_value_counts(sample->accel_x, SAMPLING_ACCEL_SCALE,
+					   SAMPLING_ACCEL_LSB);
+	p->axes[1] = sampling_value_counts(sample->accel_y, SAMPLING_ACCEL_SCALE,
+					   SAMPLING_ACCEL_LSB);
+	p->axes[2] = sampling_value_counts(sample->accel_z, SAMPLING_ACCEL_SCALE,
+					   SAMPLING_ACCEL_LSB);
+	p->axes[3] = sampling_value_counts(sample->gyro_x, SAMPLING_GYRO_SCALE, SAMPLING_GYRO_LSB);
+	p->axes[4] = sampling_value_counts(sample->gyro_y, SAMPLING_GYRO_SCALE, SAMPLING_GYRO_LSB);
+	p->axes[5] = sampling_value_counts(sample->gyro_z, SAMPLING_GYRO_SCALE, SAMPLING_GYRO_LSB);
+
+	/* Publish the sample to snapshots after it is complete */
+	atomic_set(&history_added, n + 1);
+}
+
+int sampling_history_snapshot(uint32_t since_us,
+			      const struct sampling_history_snapshot **pp_snapshot)
+{
+	struct sampling_history_snapshot *p_snap;
+	uint32_t first, end, added;
+	uint16_t count = 0;
+	uint16_t skip = 0;
+
+	if (!atomic_test_and_set_bit(&snapshots_held, 0)) {
+		p_snap = &snapshots[0];
+	} else if (!atomic_test_and_set_bit(&snapshots_held, 1)) {
+		p_snap = &snapshots[1];
+	} else {
+		return -EBUSY;
+	}
+
+	/* The oldest slot is the one the sampling thread writes next */
+	end = (uint32_t)atomic_get(&history_added);
+	first = end >= ARRAY_SIZE(history) ? end - ARRAY_SIZE(history) + 1 : 0;
+
+	/*
+	 * Copy without a lock, the sampling thread may overwrite the oldest
+	 * samples meanwhile, which is checked once the copy is done
+	 */
+	for (uint32_t i = first; i != end; i++) {
+		const struct sampling_history_sample *s = &history[i % ARRAY_SIZE(history)];
+
+		if ((int32_t)(s->timestamp_us - since_us) < 0) {
+			first = i + 1;
+			continue;
+		}
+
+		p_snap->samples[count++] = *s;
+	}
+
+	/* Samples up to index added - size were overwritten during the copy */
+	added = (uint32_t)atomic_get(&history_added);
+	if (count > 0 && added - first >= ARRAY_SIZE(history)) {
+		skip = MIN(added - first - ARRAY_SIZE(history) + 1, count);
+		memmove(p_snap->samples, &p_snap->samples[skip],
+			(count - skip) * sizeof(p_snap->samples[0]));
+	}
+
+	p_snap->count = count - skip;
+	p_snap->lost = skip;
+	*pp_snapshot = p_snap;
+
+	return 0;
+}
+
+void sampling_history_release(const struct sampling_history_snapshot *p_snapshot)
+{
+	atomic_clear_bit(&snapshots_held, p_snapshot == &snapshots[1] ? 1 : 0);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLING_HISTORY_H_
+#define _SAMPLING_HISTORY_H_
+
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include "sampling.h"
+
+/* Compact published sample in sensor counts, see SAMPLING_*_LSB */
+struct sampling_history_sample {
+	/* Capture time in microseconds, see sampling_time_us() */
+	uint32_t timestamp_us;
+	/* Accel X..Z and gyro X..Z */
+	int16_t axes[6];
+} __packed;
+
+/**
+ * @brief Copy of the latest published samples
+ */
+struct sampling_history_snapshot {
+	/* Samples in capture order */
+	struct sampling_history_sample samples[CONFIG_APP_SAMPLING_HISTORY_SAMPLES];
+	uint16_t count;
+	/* Samples in the requested range overwritten in the history during the copy */
+	uint16_t lost;
+};
+
+/**
+ * @brief Add a published sample to the history, called by the sampling thread
+ *
+ * Never waits, the oldest sample is overwritten.
+ *
+ * @param sample Published sample
+ */
+void sampling_history_add(const struct imu_sample *sample);
+
+/**
+ * @brief Take a snapshot of the history
+ *
+ * Copies the samples captured at or after since_us into the free one of two
+ * snapshot buffers, without stopping or delaying the sampling thread.
+ * Samples the sampling thread overwrites during the copy are left out of the
+ * snapshot. A snapshot stays valid until released, so a second one can be
+ * taken while the first is still processed.
+ *
+ * @param since_us Capture time of the oldest sample of interest
+ * @param pp_snapshot Snapshot, owned by the caller until released
+ * @return 0 on success, -EBUSY if both snapshot buffers are held
+ */
+int sampling_history_snapshot(uint32_t since_us,
+			      const struct sampling_history_snapshot **pp_snapshot);
+
+/**
+ * @brief Release a snapshot buffer
+ * @param p_snapshot Snapshot taken with sampling_history_snapshot()
+ */
+void sampling_history_release(const struct sampling_history_snapshot *p_snapshot);
+
+#endif /* _SAMPLING_HISTORY_H_ */
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "sampling_stream.h"
+
+#if defined(CONFIG_APP_SAMPLING_STREAM_COMPRESS)
+#include "sampling_codec.h"
+#endif
+
+LOG_MODULE_DECLARE(app_sampling, CONFIG_APP_SAMPLING_LOG_LEVEL);
+
+BUILD_ASSERT(sizeof(struct sampling_stream_packet) == 22, "Wire format changed");
+BUILD_ASSERT(sizeof(struct sampling_stream_info) == 18, "Wire format changed");
+
+static const struct device *const stream_uart = DEVICE_DT_GET(DT_ALIAS(stream_uart));
+
+/* Packets queued for transmission, the head block is owned by the UART while busy */
+RING_BUF_DECLARE(stream_ring, CONFIG_APP_SAMPLING_STREAM_BUFFER_SIZE);
+static struct k_spinlock stream_lock;
+static bool stream_tx_busy;
+static uint16_t stream_seq;
+static uint16_t features_seq;
+
+#if defined(CONFIG_APP_SAMPLING_STREAM_COMPRESS)
+/* Block being filled, only accessed from the sampling thread */
+static struct {
+	struct sampling_stream_block hdr;
+	uint8_t data[CONFIG_APP_SAMPLING_STREAM_COMPRESS_SAMPLES * SAMPLING_CODEC_SAMPLE_MAX +
+		     sizeof(uint16_t)];
+} __packed stream_block;
+static struct sampling_codec_state stream_codec;
+#endif
+
+/* Start a transfer of the next contiguous block, call with stream_lock held */
+static void stream_tx_start(void)
+{
+	uint8_t *data;
+	uint32_t len;
+
+	len = ring_buf_get_claim(&stream_ring, &data, CONFIG_APP_SAMPLING_STREAM_BUFFER_SIZE);
+	if (len == 0 || uart_tx(stream_uart, data, len, SYS_FOREVER_US) != 0) {
+		/* Nothing to send or the UART refused it, retried on the next packet */
+		ring_buf_get_finish(&stream_ring, 0);
+		stream_tx_busy = false;
+		return;
+	}
+
+	stream_tx_busy = true;
+}
+
+/* Copy a whole packet into the ring buffer and start sending if idle */
+static int stream_queue(const void *packet, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&stream_lock);
+
+	if (ring_buf_space_get(&stream_ring) < len) {
+		k_spin_unlock(&stream_lock, key);
+		return -ENOBUFS;
+	}
+
+	ring_buf_put(&stream_ring, packet, len);
+
+	if (!stream_tx_busy) {
+		stream_tx_start();
+	}
+
+	k_spin_unlock(&stream_lock, key);
+
+	return 0;
+}
+
+static void stream_uart_callback(const struct device *dev, struct uart_event *evt,
+				 void *user_data)
+{
+	k_spinlock_key_t key;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		key = k_spin_lock(&stream_lock);
+		ring_buf_get_finish(&stream_ring, evt->data.tx.len);
+		stream_tx_start();
+		k_spin_unlock(&stream_lock, key);
+		break;
+	default:
+		break;
+	}
+}
+
+int sampling_stream_init(void)
+{
+	int ret;
+
+	if (!device_is_ready(stream_uart)) {
+		LOG_ERR("Stream UART not ready");
+		return -ENODEV;
+	}
+
+	ret = uart_callback_set(stream_uart, stream_uart_callback, NULL);
+	if (ret) {
+		LOG_ERR("Failed to set stream UART callback: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Streaming raw samples on %s", stream_uart->name);
+	return 0;
+}
+
+int sampling_stream_send_info(void)
+{
+	struct sampling_stream_info info = {
+		.sync = sys_cpu_to_le16(SAMPLING_STREAM_INFO_SYNC),
+		.version = SAMPLING_STREAM_INFO_VERSION,
+		.channels = SAMPLING_STREAM_CHANNELS,
+		.frequency_hz = sys_cpu_to_le16(CONFIG_APP_SAMPLING_FREQUENCY_HZ),
+		.accel_range_g = sys_cpu_to_le16(CONFIG_APP_SAMPLING_ACCEL_RANGE_G),
+		.gyro_range_dps = sys_cpu_to_le16(CONFIG_APP_SAMPLING_GYRO_RANGE_DPS),
+	};
+
+	for (int i = 0; i < SAMPLING_STREAM_CHANNELS; i++) {
+		info.channel_map[i] = i;
+	}
+
+	info.crc = sys_cpu_to_le16(crc16_itu_t(0xFFFF, &info.version,
+					       offsetof(struct sampling_stream_info, crc) -
+					       offsetof(struct sampling_stream_info, version)));
+
+	return stream_queue(&info, sizeof(info));
+}
+
+#if defined(CONFIG_APP_SAMPLING_STREAM_COMPRESS)
+int sampling_stream_send(const struct imu_sample *sample, uint32_t timestamp_us)
+{
+	const imu_value_t values[6] = {
+		sample->accel_x, sample->accel_y, sample->accel_z,
+		sample->gyro_x, sample->gyro_y, sample->gyro_z,
+	};
+	int16_t axes[SAMPLING_CODEC_AXES];
+	uint16_t len = stream_block.hdr.len;
+	uint16_t crc;
+	int ret;
+
+	if (stream_block.hdr.count == 0) {
+		sampling_codec_reset(&stream_codec);
+		len = 0;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		axes[i] = sampling_value_counts(values[i], SAMPLING_ACCEL_SCALE,
+						SAMPLING_ACCEL_LSB);
+		axes[i + 3] = sampling_value_counts(values[i + 3], SAMPLING_GYRO_SCALE,
+						    SAMPLING_GYRO_LSB);
+	}
+
+	len += sampling_codec_encode(&stream_codec, timestamp_us, axes, &stream_block.data[len]);
+	stream_block.hdr.len = len;
+
+	if (++stream_block.hdr.count < CONFIG_APP_SAMPLING_STREAM_COMPRESS_SAMPLES) {
+		return 0;
+	}
+
+	if ((stream_seq % SAMPLING_STREAM_INFO_INTERVAL) == 0) {
+		(void)sampling_stream_send_info();
+	}
+
+	stream_block.hdr.sync = sys_cpu_to_le16(SAMPLING_STREAM_BLOCK_SYNC);
+	/* Dropped blocks still consume a sequence number */
+	stream_block.hdr.seq = sys_cpu_to_le16(stream_seq++);
+	stream_block.hdr.len = sys_cpu_to_le16(len);
+
+	crc = crc16_itu_t(0xFFFF, (const uint8_t *)&stream_block.hdr.seq,
+			  sizeof(stream_block.hdr) - offsetof(struct sampling_stream_block, seq) +
+			  len);
+	sys_put_le16(crc, &stream_block.data[len]);
+
+	/* The next sample starts a new block whether or not this one was queued */
+	ret = stream_queue(&stream_block, sizeof(stream_block.hdr) + len + sizeof(crc));
+	stream_block.hdr.count = 0;
+
+	return ret;
+}
+#else
+int sampling_stream_send(const struct imu_sample *sample, uint32_t timestamp_us)
+{
+	struct sampling_stream_packet packet = {
+		.sync = sys_cpu_to_le16(SAMPLING_STREAM_SYNC),
+		.seq = sys_cpu_to_le16(stream_seq),
+		.timestamp_us = sys_cpu_to_le32(timestamp_us),
+	};
+	const imu_value_t values[6] = {
+		sample->accel_x, sample->accel_y, sample->accel_z,
+		sample->gyro_x, sample->gyro_y, sample->gyro_z,
+	};
+
+	if ((stream_seq % SAMPLING_STREAM_INFO_INTERVAL) == 0) {
+		(void)sampling_stream_send_info();
+	}
+
+	/* Dropped packets still consume a sequence number */
+	stream_seq++;
+
+	for (int i = 0; i < 3; i++) {
+		packet.axes[i] = (int16_t)sys_cpu_to_le16(sampling_value_counts(
+			values[i], SAMPLING_ACCEL_SCALE, SAMPLING_ACCEL_LSB));
+		packet.axes[i + 3] = (int16_t)sys_cpu_to_le16(sampling_value_counts(
+			values[i + 3], SAMPLING_GYRO_SCALE, SAMPLING_GYRO_LSB));
+	}
+
+	packet.crc = sys_cpu_to_le16(crc16_itu_t(0xFFFF, (const uint8_t *)&packet.seq,
+						 offsetof(struct sampling_stream_packet, crc) -
+						 offsetof(struct sampling_stream_packet, seq)));
+
+	return stream_queue(&packet, sizeof(packet));
+}
+#endif
+
+int sampling_stream_send_features(uint8_t model, uint16_t predicted_class,
+				  uint32_t window_end_us, const float *features, uint8_t num)
+{
+	uint8_t packet[sizeof(struct sampling_stream_features) +
+		       SAMPLING_STREAM_FEATURES_MAX * sizeof(float) + sizeof(uint16_t)];
+	struct sampling_stream_features header = {
+		.sync = sys_cpu_to_le16(SAMPLING_STREAM_FEATURES_SYNC),
+		.model = model,
+		.num = num,
+		.predicted_class = sys_cpu_to_le16(predicted_class),
+		.window_end_us = sys_cpu_to_le32(window_end_us),
+	};
+	size_t len = sizeof(header);
+	uint16_t crc;
+
+	if (num > SAMPLING_STREAM_FEATURES_MAX) {
+		return -EINVAL;
+	}
+
+	/* Sent from the detection thread, numbered apart from the sample packets */
+	header.seq = sys_cpu_to_le16(features_seq++);
+	memcpy(packet, &header, sizeof(header));
+
+	for (uint8_t i = 0; i < num; i++) {
+		uint32_t bits;
+
+		memcpy(&bits, &features[i], sizeof(bits));
+		sys_put_le32(bits, &packet[len]);
+		len += sizeof(bits);
+	}
+
+	crc = crc16_itu_t(0xFFFF, &packet[offsetof(struct sampling_stream_features, seq)],
+			  len - offsetof(struct sampling_stream_features, seq));
+	sys_put_le16(crc, &packet[len]);
+	len += sizeof(crc);
+
+	return stream_queue(packet, len);
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLING_STREAM_H_
+#define _SAMPLING_STREAM_H_
+
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include "sampling.h"
+
+/* Start of every packet on the wire, 0xA5 then 0x5A */
+#define SAMPLING_STREAM_SYNC		0x5AA5
+
+/* Start of every feature packet on the wire, 0xA5 then 0x5B */
+#define SAMPLING_STREAM_FEATURES_SYNC	0x5BA5
+
+/* Start of every compressed block packet on the wire, 0xA5 then 0x5C */
+#define SAMPLING_STREAM_BLOCK_SYNC	0x5CA5
+
+/* Start of every info packet on the wire, 0xA5 then 0x5D */
+#define SAMPLING_STREAM_INFO_SYNC	0x5DA5
+
+/* Version of the info packet and of the axis layout it describes */
+#define SAMPLING_STREAM_INFO_VERSION	1
+
+/* Sample packets between two info packets */
+#define SAMPLING_STREAM_INFO_INTERVAL	1024
+
+/* Axis identifiers of the channel map, the order of the axes in a sample */
+enum sampling_stream_channel {
+	SAMPLING_STREAM_CHANNEL_ACCEL_X,
+	SAMPLING_STREAM_CHANNEL_ACCEL_Y,
+	SAMPLING_STREAM_CHANNEL_ACCEL_Z,
+	SAMPLING_STREAM_CHANNEL_GYRO_X,
+	SAMPLING_STREAM_CHANNEL_GYRO_Y,
+	SAMPLING_STREAM_CHANNEL_GYRO_Z,
+	SAMPLING_STREAM_CHANNELS,
+};
+
+/* Largest number of features in one feature packet */
+#define SAMPLING_STREAM_FEATURES_MAX	32
+
+/**
+ * Binary sample packet, all fields little endian. The CRC-16/CCITT-FALSE
+ * covers every byte from seq up to the CRC. A gap in seq means packets
+ * were dropped because the ring buffer was full.
+ */
+struct sampling_stream_packet {
+	uint16_t sync;
+	uint16_t seq;
+	/* Sample time in microseconds, wraps around */
+	uint32_t timestamp_us;
+	/* Accel X..Z and gyro X..Z in sensor counts, see SAMPLING_*_LSB */
+	int16_t axes[6];
+	uint16_t crc;
+} __packed;
+
+/**
+ * Compressed block packet header, all fields little endian. The header is
+ * followed by len bytes of count samples encoded with sampling_codec_encode()
+ * from the reset state and a CRC-16/CCITT-FALSE covering every byte from seq
+ * up to the CRC. Blocks share the sequence numbers of the sample packets, one
+ * per block.
+ */
+struct sampling_stream_block {
+	uint16_t sync;
+	uint16_t seq;
+	uint8_t count;
+	uint8_t reserved;
+	uint16_t len;
+} __packed;
+
+/**
+ * Stream info packet, all fields little endian. Describes the samples that
+ * follow, so the host can scale the counts and write a self-describing trace
+ * without knowing the firmware configuration. Sent when streaming starts and
+ * again every SAMPLING_STREAM_INFO_INTERVAL sample packets, for hosts that
+ * connect late. The CRC-16/CCITT-FALSE covers every byte from version up to
+ * the CRC.
+ */
+struct sampling_stream_info {
+	uint16_t sync;
+	uint8_t version;
+	uint8_t channels;
+	/* Rate of the published samples */
+	uint16_t frequency_hz;
+	uint16_t accel_range_g;
+	uint16_t gyro_range_dps;
+	/* Axis of each value of a sample, see enum sampling_stream_channel */
+	uint8_t channel_map[SAMPLING_STREAM_CHANNELS];
+	uint16_t crc;
+} __packed;
+
+/**
+ * Binary feature packet header, all fields little endian. The header is
+ * followed by num float32 features and a CRC-16/CCITT-FALSE covering every
+ * byte from seq up to the CRC. Feature packets have their own sequence
+ * numbers, a gap means dropped feature packets.
+ */
+struct sampling_stream_features {
+	uint16_t sync;
+	uint16_t seq;
+	/* Capture time of the last sample of the window in microseconds, wraps around */
+	uint32_t window_end_us;
+	/* Model index in the detection registry and number of features */
+	uint8_t model;
+	uint8_t num;
+	/* Class of the window, 0xFFFF for regression and anomaly models */
+	uint16_t predicted_class;
+} __packed;
+
+/**
+ * @brief Set up the UART behind the stream-uart alias for streaming
+ * @return 0 on success, negative error code on failure
+ */
+int sampling_stream_init(void);
+
+/**
+ * @brief Queue one sample for transmission
+ *
+ * Does not block, the packet is copied into the ring buffer and sent by
+ * asynchronous UART transfers. The sample is dropped if the ring buffer
+ * is full. With CONFIG_APP_SAMPLING_STREAM_COMPRESS the sample is added to
+ * the current block, which is queued once it is full.
+ *
+ * @param sample Sample to send
+ * @param timestamp_us Sample time in microseconds
+ * @return 0 on success, -ENOBUFS if the sample or its block was dropped
+ */
+int sampling_stream_send(const struct imu_sample *sample, uint32_t timestamp_us);
+
+/**
+ * @brief Queue an info packet describing the samples
+ *
+ * Does not block, like sampling_stream_send().
+ *
+ * @return 0 on success, -ENOBUFS if the packet was dropped
+ */
+int sampling_stream_send_info(void);
+
+/**
+ * @brief Queue the feature vector of one window for transmission
+ *
+ * Does not block, like sampling_stream_send().
+ *
+ * @param model Model index in the detection registry
+ * @param predicted_class Class of the window
+ * @param window_end_us Capture time of the last sample of the window
+ * @param features Scaled features
+ * @param num Number of features, at most SAMPLING_STREAM_FEATURES_MAX
+ * @return 0 on success, -EINVAL if num is too large, -ENOBUFS if the
+ *	   packet was dropped
+ */
+int sampling_stream_send_features(uint8_t model, uint16_t predicted_class,
+				  uint32_t window_end_us, const float *features, uint8_t num);
+
+#endif /* _SAMPLING_STREAM_H_ */
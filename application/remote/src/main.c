@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Inference image for the second core of multi-core SoCs. Receives blocks of
+ * acceleration magnitudes from the detection module on the application core
+ * over IPC service, feeds them to the generated model and sends back the
+ * classification of every full window, see modules/detection/detection_remote.h.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/logging/log.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+#include <string.h>
+#include "detection_user_model.h"
+#include "detection_remote.h"
+
+LOG_MODULE_REGISTER(app_remote, CONFIG_APP_REMOTE_LOG_LEVEL);
+
+/* Index of the model in the detection registry of the application core */
+#define REMOTE_MODEL_INDEX 0
+
+static const struct device *const ipc_dev = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+static struct ipc_ept ept;
+static K_SEM_DEFINE(bound_sem, 0, 1);
+
+/* Sample and restart messages, in arrival order */
+K_MSGQ_DEFINE(remote_msgq, sizeof(struct detection_remote_samples), CONFIG_APP_REMOTE_QUEUE_SIZE,
+	      4);
+
+static nrf_edgeai_t *p_model;
+static uint32_t dropped;
+
+static void ept_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	k_sem_give(&bound_sem);
+}
+
+static void ept_received(const void *data, size_t len, void *priv)
+{
+	struct detection_remote_samples msg;
+
+	ARG_UNUSED(priv);
+
+	/* Restart messages are queued as well so they apply after the samples before them */
+	if (len == sizeof(struct detection_remote_restart) &&
+	    *(const uint8_t *)data == DETECTION_REMOTE_MSG_RESTART) {
+		msg.type = DETECTION_REMOTE_MSG_RESTART;
+	} else if (len == sizeof(msg) && *(const uint8_t *)data == DETECTION_REMOTE_MSG_SAMPLES) {
+		memcpy(&msg, data, sizeof(msg));
+	} else {
+		LOG_WRN("Malformed message from application core, %zu bytes", len);
+		return;
+	}
+
+	if (k_msgq_put(&remote_msgq, &msg, K_NO_WAIT)) {
+		dropped++;
+		LOG_WRN("Message queue full, %u messages dropped", dropped);
+	}
+}
+
+static const struct ipc_ept_cfg ept_cfg = {
+	.name = DETECTION_REMOTE_ENDPOINT,
+	.cb = {
+		.bound = ept_bound,
+		.received = ept_received,
+	},
+};
+
+/**
+ * @brief Run inference on the full window and send its classification
+ * @param window_end_us Capture time of the last sample of the window
+ */
+static void run_inference_and_send(uint32_t window_end_us)
+{
+	struct detection_remote_result result = {
+		.type = DETECTION_REMOTE_MSG_RESULT,
+		.model = REMOTE_MODEL_INDEX,
+		.window_end_us = window_end_us,
+		.outputs_num = nrf_edgeai_model_outputs_num(p_model),
+	};
+	nrf_edgeai_err_t res;
+	int ret;
+
+	res = nrf_edgeai_run_inference(p_model);
+	if (res != NRF_EDGEAI_ERR_SUCCESS) {
+		LOG_ERR("Inference failed: %d", res);
+		return;
+	}
+
+	result.predicted_class = p_model->decoded_output.classif.predicted_class;
+	memcpy(result.probabilities, p_model->decoded_output.classif.probabilities.p_f32,
+	       result.outputs_num * sizeof(result.probabilities[0]));
+
+	ret = ipc_service_send(&ept, &result, sizeof(result));
+	if (ret < 0) {
+		LOG_WRN("Failed to send result: %d", ret);
+	}
+}
+
+/**
+ * @brief Feed a block of samples, running inference at every window boundary
+ *
+ * The runtime drops values fed beyond the end of the window, so values are
+ * fed one at a time.
+ *
+ * @param p_msg Samples message
+ */
+static void feed_samples(const struct detection_remote_samples *p_msg)
+{
+	const uint8_t *p_values = (const uint8_t *)&p_msg->values;
+
+	if (p_msg->input_type != nrf_edgeai_input_type(p_model) ||
+	    p_msg->count > DETECTION_REMOTE_BLOCK_MAX) {
+		LOG_WRN("Samples of type %u do not fit the model", p_msg->input_type);
+		return;
+	}
+
+	for (uint16_t i = 0; i < p_msg->count; i++) {
+		nrf_edgeai_err_t res = nrf_edgeai_feed_inputs(
+			p_model, (void *)(p_values + i * p_msg->input_type), 1);
+
+		if (res == NRF_EDGEAI_ERR_SUCCESS) {
+			run_inference_and_send(p_msg->times_us[i]);
+		} else if (res != NRF_EDGEAI_ERR_INPROGRESS) {
+			LOG_ERR("Failed to feed input: %d", res);
+		}
+	}
+}
+
+int main(void)
+{
+	struct detection_remote_samples msg;
+	nrf_edgeai_err_t res;
+	int ret;
+
+	p_model = nrf_edgeai_user_model();
+
+	res = nrf_edgeai_init(p_model);
+	if (res != NRF_EDGEAI_ERR_SUCCESS) {
+		LOG_ERR("Failed to initialize EdgeAI model: %d", res);
+		return -EIO;
+	}
+
+	if (nrf_edgeai_model_outputs_num(p_model) > DETECTION_REMOTE_CLASSES_MAX) {
+		LOG_ERR("Model has too many classes for result messages");
+		return -EINVAL;
+	}
+
+	ret = ipc_service_open_instance(ipc_dev);
+	if (ret && ret != -EALREADY) {
+		LOG_ERR("Failed to open IPC instance: %d", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc_dev, &ept, &ept_cfg);
+	if (ret) {
+		LOG_ERR("Failed to register IPC endpoint: %d", ret);
+		return ret;
+	}
+
+	k_sem_take(&bound_sem, K_FOREVER);
+
+	LOG_INF("Remote inference ready, window %u samples, %u classes",
+		nrf_edgeai_input_window_size(p_model), nrf_edgeai_model_outputs_num(p_model));
+
+	while (1) {
+		k_msgq_get(&remote_msgq, &msg, K_FOREVER);
+
+		if (msg.type == DETECTION_REMOTE_MSG_RESTART) {
+			/* Setting up the input again empties the window */
+			res = nrf_edgeai_init(p_model);
+			if (res != NRF_EDGEAI_ERR_SUCCESS) {
+				LOG_ERR("Failed to restart window: %d", res);
+			}
+		} else {
+			feed_samples(&msg);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Decode raw IMU captures from a dump of the capture flash partition.
+
+Reads the flash circular buffer written with CONFIG_APP_CAPTURE, see
+modules/capture/capture.h, and writes one CSV row per sample:
+id,model,class,confidence_pct,timestamp_us followed by the accel X..Z and
+gyro X..Z sensor counts. Sample entries written with
+CONFIG_APP_CAPTURE_COMPRESS are decoded. Captures are written oldest first. Captures whose
+header was erased along with the oldest sector are skipped.
+
+Usage: capture_dump.py <partition dump> [sector size] [write block size]
+"""
+
+import struct
+import sys
+
+from sample_codec import decode_block
+
+MAGIC = 0x54504143
+VERSION = 1
+
+ENTRY_HEADER = 1
+ENTRY_SAMPLES = 2
+ENTRY_SAMPLES_CODED = 3
+
+# struct fcb_disk_area
+SECTOR_HEADER = struct.Struct('<IBBH')
+# struct capture_header, struct capture_samples_header, struct sampling_history_sample
+HEADER = struct.Struct('<BBHIIIIBBBB')
+SAMPLES = struct.Struct('<BBHI')
+SAMPLE = struct.Struct('<I6h')
+
+
+def align(value, alignment):
+	return (value + alignment - 1) // alignment * alignment
+
+
+def crc8_ccitt(crc, data):
+	for byte in data:
+		crc ^= byte
+		for _ in range(8):
+			crc = ((crc << 1) ^ 0x07) & 0xff if crc & 0x80 else (crc << 1) & 0xff
+	return crc
+
+
+def sector_entries(sector, alignment):
+	"""Yield the data of the valid entries of one sector."""
+	pos = align(SECTOR_HEADER.size, alignment)
+	while pos < len(sector) and sector[pos] != 0xff:
+		if sector[pos] & 0x80:
+			length = (sector[pos] & 0x7f) | (sector[pos + 1] << 7)
+			length_size = 2
+		else:
+			length = sector[pos]
+			length_size = 1
+
+		data_pos = pos + align(length_size, alignment)
+		crc_pos = data_pos + align(length, alignment)
+		if crc_pos >= len(sector):
+			return
+
+		data = sector[data_pos:data_pos + length]
+		crc = crc8_ccitt(crc8_ccitt(0xff, sector[pos:pos + length_size]), data)
+		if crc == sector[crc_pos]:
+			yield data
+		else:
+			print(f'bad entry CRC at sector offset {pos}', file=sys.stderr)
+
+		pos = crc_pos + align(1, alignment)
+
+
+def main():
+	if len(sys.argv) < 2:
+		sys.exit(__doc__)
+
+	sector_size = int(sys.argv[2], 0) if len(sys.argv) > 2 else 4096
+	alignment = int(sys.argv[3], 0) if len(sys.argv) > 3 else 1
+
+	with open(sys.argv[1], 'rb') as f:
+		dump = f.read()
+
+	sectors = []
+	for offset in range(0, len(dump) - SECTOR_HEADER.size + 1, sector_size):
+		magic, version, _, sector_id = SECTOR_HEADER.unpack_from(dump, offset)
+		if magic == MAGIC and version == VERSION:
+			sectors.append((sector_id, dump[offset:offset + sector_size]))
+
+	# Sector ids increase in write order and may wrap around
+	ids = [s[0] for s in sectors]
+	if ids and max(ids) - min(ids) > 0x8000:
+		sectors = [((i + 0x10000) if i < 0x8000 else i, s) for i, s in sectors]
+	sectors.sort(key=lambda s: s[0])
+
+	headers = {}
+	print('id,model,class,confidence_pct,timestamp_us,'
+	      'accel_x,accel_y,accel_z,gyro_x,gyro_y,gyro_z')
+	for _, sector in sectors:
+		for data in sector_entries(sector, alignment):
+			if data[0] == ENTRY_HEADER and len(data) == HEADER.size:
+				fields = HEADER.unpack(data)
+				headers[fields[3]] = fields
+			elif data[0] in (ENTRY_SAMPLES, ENTRY_SAMPLES_CODED) and \
+			     len(data) >= SAMPLES.size:
+				_, _, count, capture_id = SAMPLES.unpack_from(data)
+				if capture_id not in headers:
+					continue
+				header = headers[capture_id]
+				prefix = (capture_id, header[1], header[2], header[7])
+				if data[0] == ENTRY_SAMPLES_CODED:
+					samples = decode_block(data[SAMPLES.size:], count)
+				else:
+					samples = [SAMPLE.unpack_from(data, SAMPLES.size + i * SAMPLE.size)
+						   for i in range(count)]
+				for sample in samples:
+					print(','.join(str(v) for v in prefix + tuple(sample)))
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Generate the feature reference of CONFIG_APP_DETECTION_FEATURE_CALIBRATION.
+
+Runs the windows of a trace through the firmware pipeline with the
+edgeai_host module of the host tools and writes the mean and standard
+deviation of each scaled feature as nrf_edgeai_user_model_calibration.h.
+Record the trace with a device of the training data in the condition the
+devices calibrate in, e.g. at rest for the first windows after boot. Each
+device then maps the statistics of its own first windows onto these.
+
+The acceleration magnitudes are computed as host_replay does. Convert CSV
+recordings with imu_trace.py first. The host tools must be built with the
+Python headers, see tools/host_replay/CMakeLists.txt.
+
+Usage: feature_reference.py [-b host build dir] <trace.imt> <output header>
+"""
+
+import array
+import getopt
+import math
+import os
+import sys
+
+import imu_trace
+
+ACCEL_X = 0
+HOST_BUILD = os.path.join(os.path.dirname(__file__), '..', 'build_host')
+
+
+def magnitudes(path):
+	header, columns = imu_trace.read_trace(path)
+	channel_map = header['channel_map']
+	try:
+		axes = [columns[channel_map.index(ACCEL_X + i)] for i in range(3)]
+	except ValueError:
+		sys.exit(f'{path} has no accelerometer channels')
+	# Sensor counts to milli-g
+	scale = header['accel_range_g'] * 1000 / 32768
+	return array.array('f', (math.sqrt(x * x + y * y + z * z) * scale for x, y, z in zip(*axes)))
+
+
+def format_table(name, values):
+	rows = ',\n'.join('\t' + ', '.join(f'{v:.7f}f' for v in values[i:i + 6])
+			  for i in range(0, len(values), 6))
+	return f'static const float {name}[] = {{\n{rows}\n}};\n'
+
+
+def main():
+	try:
+		opts, args = getopt.getopt(sys.argv[1:], 'b:')
+	except getopt.GetoptError:
+		sys.exit(__doc__)
+	if len(args) != 2:
+		sys.exit(__doc__)
+
+	sys.path.insert(0, dict(opts).get('-b', HOST_BUILD))
+	try:
+		import edgeai_host
+	except ImportError:
+		sys.exit('edgeai_host not found, build the host tools or pass their build directory')
+
+	values = magnitudes(args[0])
+	window = edgeai_host.WINDOW_SIZE
+	windows = len(values) // window
+	if edgeai_host.INPUTS != 1 or windows < 2:
+		sys.exit('The model must take the magnitude only, the trace at least two windows')
+
+	view = memoryview(values[:windows * window]).cast('B').cast('f', (windows, window))
+	features = edgeai_host.evaluate(view)[0]
+	mean = []
+	std = []
+	for i in range(edgeai_host.FEATURES):
+		column = [features[w, i] for w in range(windows)]
+		mean.append(sum(column) / windows)
+		std.append(math.sqrt(sum((v - mean[i]) ** 2 for v in column) / windows))
+
+	with open(args[1], 'w') as out:
+		out.write(f'''/*
+ * Generated by scripts/feature_reference.py from {os.path.basename(args[0])}, do not edit.
+ */
+
+#ifndef _NRF_EDGEAI_USER_MODEL_CALIBRATION_H_
+#define _NRF_EDGEAI_USER_MODEL_CALIBRATION_H_
+
+/* Statistics of the scaled features over {windows} windows of the reference device */
+{format_table('EXTRACTED_FEATURES_CAL_MEAN', mean)}
+{format_table('EXTRACTED_FEATURES_CAL_STD', std)}
+#endif /* _NRF_EDGEAI_USER_MODEL_CALIBRATION_H_ */
+''')
+	print(f'Reference of {edgeai_host.FEATURES} features over {windows} windows written to {args[1]}')
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Generate the FFT plan of a frequency-domain feature pipeline for one window length.
+
+The real FFT of the runtime spectrum utilities needs a real twiddle table
+for the FFT length, and a complex twiddle and bit reversal table for half
+of it. nrf_dsp_fft_const_tables_f32.h defines the tables of every length
+as global objects. This script copies the three tables of one length into
+a header of static constants instead, so the model only carries the slice
+it uses and no other source file has to include the full table header.
+
+The FFT length is the smallest one with a runtime spectrum utility, i.e.
+nrf_edgeai_feature_utility_rfft_<len>_f32(), that holds the window.
+
+When a window function is given, its coefficients at the exact window
+length are added as a static constant table, so the model applies it while
+loading the FFT buffer instead of generating it into RAM at runtime. The
+symmetric definitions of nrf_dsp_window_hanning_f32() and numpy are used.
+
+Usage: fft_tables.py <window size> <output header> [hann|hamming|blackman]
+"""
+
+import math
+import os
+import re
+import sys
+
+RFFT_LENS = (128, 256, 512, 1024, 2048)
+
+WINDOWS = {
+	'hann': lambda x: 0.5 - 0.5 * math.cos(x),
+	'hamming': lambda x: 0.54 - 0.46 * math.cos(x),
+	'blackman': lambda x: 0.42 - 0.5 * math.cos(x) + 0.08 * math.cos(2 * x),
+}
+
+TABLES = os.path.join(os.path.dirname(__file__), '..', '..', 'external', 'edge-ai', 'include',
+		      'nrf_edgeai', 'dsp', 'transform', 'fft', 'nrf_dsp_fft_const_tables_f32.h')
+
+
+def parse_table(source, name):
+	match = re.search(r'\b' + name + r'\[[^\]]*\]\s*=\s*\{(.*?)\};', source, re.S)
+	if not match:
+		sys.exit(f'{name} not found')
+	body = re.sub(r'/\*.*?\*/', '', match.group(1), flags=re.S)
+	return [v.strip() for v in body.split(',') if v.strip()]
+
+
+def format_table(values, per_line):
+	return ',\n'.join('\t' + ', '.join(values[i:i + per_line])
+			  for i in range(0, len(values), per_line))
+
+
+def window_function(name, window):
+	if name not in WINDOWS:
+		sys.exit(f'unknown window function {name}')
+	return [f'{WINDOWS[name](2 * math.pi * i / (window - 1)):.9f}f' for i in range(window)]
+
+
+def main():
+	if len(sys.argv) not in (3, 4):
+		sys.exit(__doc__)
+
+	window = int(sys.argv[1])
+	window_name = sys.argv[3] if len(sys.argv) == 4 else None
+	rfft_len = next((n for n in RFFT_LENS if n >= window), None)
+	if rfft_len is None:
+		sys.exit(f'no real FFT holds a window of {window} samples')
+	cfft_len = rfft_len // 2
+
+	with open(TABLES) as f:
+		source = f.read()
+
+	rfft_twiddle = parse_table(source, f'NRF_DSP_RFFT_TWIDDLE_COEF_{rfft_len}_F32')
+	cfft_twiddle = parse_table(source, f'NRF_DSP_CFFT_TWIDDLE_COEF_{cfft_len}_F32')
+	bitrev = parse_table(source, f'NRF_DSP_BITREVINDEX_TABLE_{cfft_len}_F32')
+
+	coefs = window_function(window_name, window) if window_name else []
+
+	tables_bytes = 4 * (len(rfft_twiddle) + len(cfft_twiddle) + len(coefs)) + 2 * len(bitrev)
+
+	with open(sys.argv[2], 'w') as f:
+		f.write('/*\n'
+			' * Generated by scripts/fft_tables.py from nrf_dsp_fft_const_tables_f32.h, '
+			'do not edit.\n'
+			' */\n\n'
+			'#ifndef _NRF_EDGEAI_USER_FFT_TABLES_H_\n'
+			'#define _NRF_EDGEAI_USER_FFT_TABLES_H_\n\n'
+			'#include <nrf_edgeai/dsp/nrf_dsp_types.h>\n\n'
+			f'/** Real FFT length for a window of {window} samples */\n'
+			f'#define FREQDOMAIN_RFFT_LEN {rfft_len}\n\n'
+			'/** Runtime utility computing the amplitude spectrum at this length */\n'
+			'#define FREQDOMAIN_RFFT_FEATURE '
+			f'nrf_edgeai_feature_utility_rfft_{rfft_len}_f32\n\n'
+			'/** Length of the complex FFT bit reversal table */\n'
+			f'#define FREQDOMAIN_CFFT_BITREV_LEN {len(bitrev)}\n\n'
+			f'/* FFT tables, {tables_bytes} bytes */\n'
+			f'static const flt32_t FREQDOMAIN_RFFT_TWIDDLE[{len(rfft_twiddle)}] = {{\n'
+			f'{format_table(rfft_twiddle, 4)}\n'
+			'};\n\n'
+			f'static const flt32_t FREQDOMAIN_CFFT_TWIDDLE[{len(cfft_twiddle)}] = {{\n'
+			f'{format_table(cfft_twiddle, 4)}\n'
+			'};\n\n'
+			'static const uint16_t FREQDOMAIN_CFFT_BITREV[FREQDOMAIN_CFFT_BITREV_LEN] = {\n'
+			f'{format_table(bitrev, 12)}\n'
+			'};\n\n')
+		if coefs:
+			f.write(f'/** {window_name.capitalize()} window function, applied when the FFT '
+				'buffer is loaded */\n'
+				f'#define FREQDOMAIN_WINDOW_LEN {window}\n\n'
+				'static const flt32_t FREQDOMAIN_WINDOW[FREQDOMAIN_WINDOW_LEN] = {\n'
+				f'{format_table(coefs, 4)}\n'
+				'};\n\n')
+		f.write('#endif /* _NRF_EDGEAI_USER_FFT_TABLES_H_ */\n')
+
+
+if __name__ == '__main__':
+	main()
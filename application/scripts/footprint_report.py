@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Print the memory footprint of the detection pipeline in a linked image.
+
+Groups the symbols of the ELF file into the components of the generated
+model (constants, default instance with its buffers and runtime context,
+DSP pipeline and FFT state), the EdgeAI runtime and application DSP and NN
+code, and lists every thread stack. The split of an instance into its
+buffers is logged by the detection module at boot. Run after the build with
+CONFIG_APP_DETECTION_FOOTPRINT_REPORT or by hand on build/zephyr/zephyr.elf.
+
+Usage: footprint_report.py <zephyr.elf>
+"""
+
+import re
+import sys
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+# Component, symbol type and name pattern, the first match wins
+COMPONENTS = (
+	('Model constants', 'STT_OBJECT',
+	 r'^(MODEL_|model_params$|INPUT_FEATURES_SCALE_|EXTRACTED_FEATURES_SCALE_|'
+	 r'FEATURES_EXTRACTION_MASK)'),
+	('Model instance', 'STT_OBJECT', r'^model_default_instance$'),
+	('Shared scratch arena', 'STT_OBJECT', r'^detection_scratch$'),
+	('DSP pipeline', 'STT_OBJECT', r'^model_(dsp|timedomain)_pipeline$'),
+	('FFT tables and context', 'STT_OBJECT', r'(?i)fft'),
+	('Batch neurons', 'STT_OBJECT', r'^model_batch_neurons$'),
+	('Runtime context template', 'STT_OBJECT', r'^model_edgeai$'),
+	('EdgeAI runtime code', 'STT_FUNC', r'^nrf_(edgeai|dsp|nn)_'),
+	('Application DSP and NN code', 'STT_FUNC', r'^app_(dsp|nn)_'),
+)
+
+STACK = re.compile(r'^(_k_thread_stack_\w+|z_main_stack|z_idle_stacks|z_interrupt_stacks|'
+		   r'\w+_stack_area)$')
+
+
+def symbols(elf):
+	for section in elf.iter_sections():
+		if not isinstance(section, SymbolTableSection):
+			continue
+		for symbol in section.iter_symbols():
+			index = symbol['st_shndx']
+			if not isinstance(index, int) or symbol['st_size'] == 0:
+				continue
+			flags = elf.get_section(index)['sh_flags']
+			if not flags & SH_FLAGS.SHF_ALLOC:
+				continue
+			memory = 'RAM' if flags & SH_FLAGS.SHF_WRITE else 'Flash'
+			yield symbol.name, symbol['st_info']['type'], memory, symbol['st_size']
+
+
+def main():
+	if len(sys.argv) != 2:
+		sys.exit(__doc__)
+
+	totals = {name: {'Flash': 0, 'RAM': 0} for name, _, _ in COMPONENTS}
+	stacks = []
+	seen = set()
+
+	with open(sys.argv[1], 'rb') as file:
+		for name, kind, memory, size in symbols(ELFFile(file)):
+			# Aliases of one object, e.g. thread stacks, appear more than once
+			if (name, size) in seen:
+				continue
+			seen.add((name, size))
+
+			if kind == 'STT_OBJECT' and memory == 'RAM' and STACK.match(name):
+				stacks.append((name, size))
+				continue
+
+			for component, component_kind, pattern in COMPONENTS:
+				if kind == component_kind and re.search(pattern, name):
+					totals[component][memory] += size
+					break
+
+	print(f'{"Component":<32} {"Flash":>8} {"RAM":>8}')
+	for component, _, _ in COMPONENTS:
+		print(f'{component:<32} {totals[component]["Flash"]:>8} {totals[component]["RAM"]:>8}')
+	print(f'{"Total":<32} {sum(t["Flash"] for t in totals.values()):>8} '
+	      f'{sum(t["RAM"] for t in totals.values()):>8}')
+
+	print()
+	print(f'{"Stack":<32} {"RAM":>8}')
+	for name, size in sorted(stacks):
+		print(f'{name:<32} {size:>8}')
+	print(f'{"Total":<32} {sum(size for _, size in stacks):>8}')
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Write binary IMU traces for the host replay tools.
+
+A trace is a 64 byte header, see struct replay_trace_header in
+tools/host_replay/trace.h, followed by blocks of BLOCK_SAMPLES samples with
+one little-endian int16 column of sensor counts per axis. host_replay and
+host_fleet map the file and read the columns in place instead of parsing
+text. stream_capture.py --trace writes traces from the firmware stream.
+
+Run as a script to convert a CSV recording: the CSV printed by the sampling
+module in m/s^2 and rad/s, scaled to counts with the given ranges, or the CSV
+written by stream_capture.py or capture_dump.py, whose last six columns are
+sensor counts. Rows that are not all numbers, e.g. log output, are skipped.
+
+Usage: imu_trace.py [-f frequency_hz] [-a accel_range_g] [-y gyro_range_dps]
+                    <recording.csv> <trace.imt>
+"""
+
+import csv
+import getopt
+import math
+import struct
+import sys
+
+MAGIC = 0x54554d49
+VERSION = 1
+HEADER = struct.Struct('<IHHIHHB3x8sIQI20x')
+BLOCK_SAMPLES = 4096
+AXES = 6
+
+STANDARD_GRAVITY = 9.80665
+
+
+class TraceWriter:
+	"""Write samples of accel X..Z and gyro X..Z in sensor counts to a trace"""
+
+	def __init__(self, path, frequency_hz, accel_range_g, gyro_range_dps,
+		     channel_map=tuple(range(AXES)), block_samples=BLOCK_SAMPLES):
+		self.file = open(path, 'wb')
+		self.frequency_hz = frequency_hz
+		self.accel_range_g = accel_range_g
+		self.gyro_range_dps = gyro_range_dps
+		self.channel_map = tuple(channel_map)
+		self.block_samples = block_samples
+		self.start_timestamp_us = 0
+		self.samples = 0
+		self.columns = [[] for _ in self.channel_map]
+		# The sample count is only known at the end, the header is rewritten then
+		self.file.write(self._header())
+
+	def _header(self):
+		return HEADER.pack(MAGIC, VERSION, HEADER.size, self.frequency_hz,
+				   self.accel_range_g, self.gyro_range_dps, len(self.channel_map),
+				   bytes(self.channel_map).ljust(8, b'\0'), self.block_samples,
+				   self.samples, self.start_timestamp_us)
+
+	def _flush(self):
+		for column in self.columns:
+			column.extend([0] * (self.block_samples - len(column)))
+			self.file.write(struct.pack(f'<{self.block_samples}h', *column))
+			column.clear()
+
+	def write(self, axes, timestamp_us=None):
+		if self.samples == 0 and timestamp_us is not None:
+			self.start_timestamp_us = timestamp_us
+		for column, value in zip(self.columns, axes):
+			column.append(value)
+		self.samples += 1
+		if len(self.columns[0]) == self.block_samples:
+			self._flush()
+
+	def close(self):
+		if self.columns[0]:
+			self._flush()
+		self.file.seek(0)
+		self.file.write(self._header())
+		self.file.close()
+
+
+def read_trace(path):
+	"""Return the header fields of a trace and its samples, one list per channel"""
+	with open(path, 'rb') as trace:
+		data = trace.read()
+	if len(data) < HEADER.size:
+		raise ValueError(f'{path} is not a trace')
+	(magic, version, header_size, frequency_hz, accel_range_g, gyro_range_dps, channels,
+	 channel_map, block_samples, samples, start_timestamp_us) = HEADER.unpack_from(data)
+	if magic != MAGIC or version != VERSION or block_samples == 0:
+		raise ValueError(f'{path} is not a version {VERSION} trace')
+	header = {
+		'frequency_hz': frequency_hz,
+		'accel_range_g': accel_range_g,
+		'gyro_range_dps': gyro_range_dps,
+		'channel_map': tuple(channel_map[:channels]),
+		'start_timestamp_us': start_timestamp_us,
+	}
+	columns = [[] for _ in range(channels)]
+	column = struct.Struct(f'<{block_samples}h')
+	pos = header_size
+	while sum(map(len, columns)) < samples * channels:
+		for values in columns:
+			values.extend(column.unpack_from(data, pos))
+			pos += column.size
+	return header, [values[:samples] for values in columns]
+
+
+def counts(value, lsb):
+	return max(-32768, min(32767, round(value / lsb)))
+
+
+def main():
+	try:
+		opts, args = getopt.getopt(sys.argv[1:], 'f:a:y:')
+	except getopt.GetoptError:
+		sys.exit(__doc__)
+	if len(args) != 2:
+		sys.exit(__doc__)
+
+	opts = dict(opts)
+	frequency_hz = int(opts.get('-f', 100))
+	accel_range_g = int(opts.get('-a', 8))
+	gyro_range_dps = int(opts.get('-y', 2000))
+	accel_lsb = accel_range_g * STANDARD_GRAVITY / 32768
+	gyro_lsb = gyro_range_dps * math.pi / 180 / 32768
+
+	trace = TraceWriter(args[1], frequency_hz, accel_range_g, gyro_range_dps)
+	with open(args[0], newline='') as recording:
+		for row in csv.reader(recording):
+			if len(row) < AXES:
+				continue
+			try:
+				values = [int(v) for v in row[-AXES:]]
+			except ValueError:
+				try:
+					si = [float(v) for v in row[-AXES:]]
+				except ValueError:
+					continue
+				values = [counts(v, accel_lsb) for v in si[:3]] + \
+					 [counts(v, gyro_lsb) for v in si[3:]]
+			trace.write(values)
+	trace.close()
+
+	if trace.samples == 0:
+		sys.exit('No samples in the recording')
+	print(f'{trace.samples} samples written to {args[1]}')
+
+
+if __name__ == '__main__':
+	main()
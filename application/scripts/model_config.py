@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Derive the sampling configuration of a generated model.
+
+Reads the input description of nrf_edgeai_user_model.c, the number of
+unique input features, the usage mask, the window size and the window
+shift, and prints the Kconfig options of the cheapest acquisition pipeline
+for it, one CONFIG_<name>=<value> per line. sysbuild.cmake applies them to
+the application with SB_CONFIG_APP_MODEL_SAMPLING_CONFIG.
+
+The generated model does not record the rate it was trained at, so it is
+an argument. The IMU runs at the lowest BMI270 ODR that is a multiple of
+it, so nothing is decimated when the rate is an ODR of the sensor. The FIFO
+wakes the sampling thread once per window shift, or an integer fraction of
+it when the shift exceeds the FIFO watermark range, so a window is never
+completed by a partly drained FIFO.
+
+A model with int16 input gets the integer input path on raw samples.
+
+Which IMU channels feed the model is decided from the channel list of the
+model in the detection registry at runtime, see detection_uses_gyro().
+Only the number of inputs is checked against the model here.
+
+Usage: model_config.py [-r rate in Hz] <nrf_edgeai_user_model.c>
+"""
+
+import getopt
+import re
+import sys
+
+DEFAULT_RATE_HZ = 100
+# Integer BMI270 output data rates, 25 Hz * 2^n
+BMI270_ODR_HZ = [25 << n for n in range(7)]
+FIFO_WATERMARK_MAX = 128
+
+
+def read_defines(path):
+	with open(path) as f:
+		source = f.read()
+	# The last definition of a name is the unconditional one of the model
+	defines = dict(re.findall(r'^#define\s+(INPUT_\w+)\s+(\w+)\s*$', source, re.M))
+	return source, defines
+
+
+def used_features(source, defines, num):
+	mask = defines.get('INPUT_FEATURES_USAGE_MASK', 'NULL')
+	if mask == 'NULL':
+		return num
+	values = re.search(rf'\b{mask}\[\]\s*=\s*\{{([^}}]*)\}}', source)
+	if values is None:
+		sys.exit(f'Usage mask {mask} not found')
+	return sum(bin(int(v, 0)).count('1') for v in values.group(1).split(',') if v.strip())
+
+
+def lowest_odr(rate):
+	for odr in BMI270_ODR_HZ:
+		if odr >= rate and odr % rate == 0:
+			return odr
+	sys.exit(f'No BMI270 ODR is a multiple of {rate} Hz')
+
+
+def fifo_watermark(shift):
+	return max(d for d in range(1, min(shift, FIFO_WATERMARK_MAX) + 1) if shift % d == 0)
+
+
+def main():
+	try:
+		opts, args = getopt.getopt(sys.argv[1:], 'r:')
+	except getopt.GetoptError:
+		sys.exit(__doc__)
+	if len(args) != 1:
+		sys.exit(__doc__)
+
+	rate = int(dict(opts).get('-r', DEFAULT_RATE_HZ))
+	source, defines = read_defines(args[0])
+	try:
+		features = int(defines['INPUT_UNIQ_FEATURES_NUM'])
+		window = int(defines['INPUT_WINDOW_SIZE'])
+		shift = int(defines['INPUT_WINDOW_SHIFT'])
+	except (KeyError, ValueError) as e:
+		sys.exit(f'{args[0]} has no numeric {e}')
+
+	used = used_features(source, defines, features)
+	if used != int(defines.get('INPUT_UNIQ_FEATURES_USED_NUM', used)):
+		sys.exit('The usage mask does not match INPUT_UNIQ_FEATURES_USED_NUM')
+	if not 0 < shift <= window:
+		sys.exit(f'Window shift {shift} outside the window of {window} samples')
+
+	odr = lowest_odr(rate)
+	print(f'CONFIG_APP_SAMPLING_FREQUENCY_HZ={rate}')
+	print(f'CONFIG_APP_SAMPLING_ODR_HZ={odr}')
+	print('CONFIG_APP_SAMPLING_ACQUISITION_FIFO=y')
+	print(f'CONFIG_APP_SAMPLING_FIFO_WATERMARK={fifo_watermark(shift)}')
+	# The single input pipeline feeds the acceleration magnitude only
+	print(f'CONFIG_APP_DETECTION_MULTI_INPUT={"y" if features > 1 else "n"}')
+	# Quantized models take int16 milli-g computed from raw counts
+	input_i16 = defines.get('INPUT_TYPE') == 'i16'
+	if input_i16:
+		print('CONFIG_APP_SAMPLING_FORMAT_RAW=y')
+	print(f'CONFIG_APP_DETECTION_INPUT_I16={"y" if input_i16 else "n"}')
+	print(f'{features} inputs, {used} used, window {window} shift {shift}', file=sys.stderr)
+
+
+if __name__ == '__main__':
+	main()
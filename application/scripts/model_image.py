@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Generate a serialized model image from an Edge AI Lab nrf_edgeai_user_model.c.
+
+The image holds the network and the feature scaling of the model, see
+struct detection_model_image_header in modules/detection/detection_model_swap.h.
+It replaces the network of a built-in model with the same window, feature
+extraction and classes at runtime, with CONFIG_APP_DETECTION_MODEL_SWAP.
+Write it to the start of the model_partition flash partition, or pass it to
+detection_model_update(). Images for the partition are 8-byte aligned when the
+partition is, as needed to use them in place from flash.
+
+Usage: model_image.py <nrf_edgeai_user_model.c> <output image>
+"""
+
+import struct
+import sys
+import zlib
+
+from neuton_pack import parse_array, parse_define
+
+MAGIC = 0x4c444d4e
+VERSION = 2
+
+# struct detection_model_image_header
+HEADER = struct.Struct('<IHHIIHHHHIHHI')
+
+
+def floats(values):
+	return struct.pack(f'<{len(values)}f', *(float(v.rstrip('fF')) for v in values))
+
+
+def integers(fmt, values):
+	return struct.pack(f'<{len(values)}{fmt}', *(int(v, 0) for v in values))
+
+
+def pad(data, alignment):
+	return data + bytes(-len(data) % alignment)
+
+
+def main():
+	if len(sys.argv) != 3:
+		sys.exit(__doc__)
+
+	with open(sys.argv[1]) as f:
+		source = f.read()
+
+	if 'MODEL_PARAMS_TYPE f32' not in source:
+		sys.exit('only f32 models can be serialized')
+
+	neurons_num = parse_define(source, 'MODEL_NEURONS_NUM')
+	outputs_num = parse_define(source, 'MODEL_OUTPUTS_NUM')
+	weights_num = parse_define(source, 'MODEL_WEIGHTS_NUM')
+	features_num = parse_define(source, 'EXTRACTED_FEATURES_NUM')
+	masks = parse_array(source, 'FEATURES_EXTRACTION_MASK')
+	act_type_mask = parse_array(source, 'MODEL_NEURON_ACTIVATION_TYPE_MASK')
+
+	arrays = [
+		integers('Q', masks),
+		floats(parse_array(source, 'MODEL_WEIGHTS')),
+		floats(parse_array(source, 'MODEL_NEURON_ACTIVATION_WEIGHTS')),
+		floats(parse_array(source, 'EXTRACTED_FEATURES_SCALE_MIN')),
+		floats(parse_array(source, 'EXTRACTED_FEATURES_SCALE_MAX')),
+		integers('H', parse_array(source, 'MODEL_NEURONS_LINKS')),
+		integers('H', parse_array(source, 'MODEL_NEURON_INTERNAL_LINKS_NUM')),
+		integers('H', parse_array(source, 'MODEL_NEURON_EXTERNAL_LINKS_NUM')),
+		integers('H', parse_array(source, 'MODEL_OUTPUT_NEURONS_INDICES')),
+		integers('B', act_type_mask[:(neurons_num + 7) // 8]),
+	]
+
+	# Arrays after the header start on 4 bytes, the masks on 8 bytes
+	body = bytes(-HEADER.size % 8) + b''.join(pad(a, 4) for a in arrays)
+	header = HEADER.pack(MAGIC, VERSION, HEADER.size, HEADER.size + len(body),
+			     zlib.crc32(body), parse_define(source, 'INPUT_WINDOW_SIZE'),
+			     parse_define(source, 'MODEL_TASK'), neurons_num, outputs_num, weights_num,
+			     features_num, len(masks), parse_define(source, 'EDGEAI_RUNTIME_VERSION_COMBINED'))
+
+	with open(sys.argv[2], 'wb') as f:
+		f.write(header + body)
+
+	print(f'{sys.argv[2]}: {len(header) + len(body)} bytes, {neurons_num} neurons, '
+	      f'{weights_num} weights')
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Compile a Neuton model from an Edge AI Lab nrf_edgeai_user_model.c into C.
+
+Writes a header with one straight-line function that evaluates the network,
+one expression per neuron with the weights as immediates, for
+CONFIG_APP_DETECTION_COMPILED_MODEL. Neurons are local variables, so the
+compiler keeps them in registers where it can and schedules the loads and
+multiplies freely. Only the outputs are stored, in the order of
+MODEL_OUTPUT_NEURONS_INDICES. Neurons no output depends on are dropped.
+
+Each sum adds the internal then the external links in the order of the
+model arrays, as the runtime does, so outputs match the table driven
+inference. Code size grows with the number of links, this suits small
+models like the generated 80 neuron one.
+
+Usage: neuton_compile.py <nrf_edgeai_user_model.c> <output header>
+"""
+
+import re
+import struct
+import sys
+
+from neuton_pack import evaluation_order, parse_array, parse_define
+
+TERMS_PER_LINE = 3
+
+
+def f32_literal(value):
+	"""Shortest exact literal of the f32 the model array initializer rounds to."""
+	f32 = struct.unpack('<f', struct.pack('<f', float(value.rstrip('fF'))))[0]
+	literal = f'{f32:.9g}'
+	if '.' not in literal and 'e' not in literal:
+		literal += '.0'
+	return literal + 'f'
+
+
+def neuron_terms(links, weights, first, internal, external, inputs_num):
+	"""Weighted link terms of one neuron, a bias link is its weight alone."""
+	terms = [(f32_literal(weights[i]), f'n{links[i]}') for i in range(first, internal)]
+	for i in range(internal, external):
+		source = f'p_inputs[{links[i]}]' if links[i] < inputs_num else None
+		terms.append((f32_literal(weights[i]), source))
+	return terms
+
+
+def sum_lines(terms):
+	"""Sum of the terms in link order, TERMS_PER_LINE per line."""
+	if not terms:
+		return ['0.0f']
+
+	parts = []
+	for i, (weight, source) in enumerate(terms):
+		value = weight if source is None else f'{weight} * {source}'
+		if i == 0:
+			parts.append(value)
+		elif value.startswith('-'):
+			# Subtracting is exact the same as adding the negated product
+			parts.append(f'- {value[1:]}')
+		else:
+			parts.append(f'+ {value}')
+
+	return [' '.join(parts[i:i + TERMS_PER_LINE]) for i in range(0, len(parts), TERMS_PER_LINE)]
+
+
+def compile_model(source):
+	params_type = re.search(r'#define\s+MODEL_PARAMS_TYPE\s+(\w+)', source).group(1)
+	if params_type != 'f32':
+		sys.exit(f'only f32 models can be compiled, got {params_type}')
+
+	neurons_num = parse_define(source, 'MODEL_NEURONS_NUM')
+	weights = parse_array(source, 'MODEL_WEIGHTS')
+	links = [int(v, 0) for v in parse_array(source, 'MODEL_NEURONS_LINKS')]
+	internal = [int(v, 0) for v in parse_array(source, 'MODEL_NEURON_INTERNAL_LINKS_NUM')]
+	external = [int(v, 0) for v in parse_array(source, 'MODEL_NEURON_EXTERNAL_LINKS_NUM')]
+	act_weights = parse_array(source, 'MODEL_NEURON_ACTIVATION_WEIGHTS')
+	act_mask = [int(v, 0) for v in parse_array(source, 'MODEL_NEURON_ACTIVATION_TYPE_MASK')]
+	outputs = [int(v, 0) for v in parse_array(source, 'MODEL_OUTPUT_NEURONS_INDICES')]
+
+	if parse_define(source, 'MODEL_USES_AS_INPUT_INPUT_FEATURES'):
+		inputs_num = (parse_define(source, 'INPUT_UNIQ_FEATURES_USED_NUM') *
+			      parse_define(source, 'INPUT_WINDOW_SIZE'))
+	else:
+		inputs_num = parse_define(source, 'EXTRACTED_FEATURES_NUM')
+
+	first = [0] + external[:-1]
+	sources = [links[first[n]:internal[n]] for n in range(neurons_num)]
+	order, _ = evaluation_order(neurons_num, sources, outputs)
+
+	body = []
+	for n in sorted(order):
+		lines = sum_lines(neuron_terms(links, weights, first[n], internal[n], external[n],
+					       inputs_num))
+		if (act_mask[n >> 3] >> (n & 7)) & 1:
+			body.append(f'    const flt32_t n{n} = compiled_clamp_(')
+			end = ');'
+		else:
+			body.append(f'    const flt32_t n{n} = compiled_sigmoid_('
+				    f'{f32_literal(act_weights[n])} * (')
+			end = '));'
+		body += [f'        {line}' for line in lines]
+		body[-1] += end
+
+	body += [f'    p_outputs[{i}] = n{n};' for i, n in enumerate(outputs)]
+
+	links_num = sum(external[n] - first[n] for n in order)
+
+	return body, len(order), links_num, len(outputs)
+
+
+def main():
+	if len(sys.argv) != 3:
+		sys.exit(__doc__)
+
+	with open(sys.argv[1]) as f:
+		body, neurons_num, links_num, outputs_num = compile_model(f.read())
+
+	with open(sys.argv[2], 'w') as f:
+		f.write('/*\n'
+			' * Generated by scripts/neuton_compile.py from nrf_edgeai_user_model.c, '
+			'do not edit.\n'
+			' */\n\n'
+			'#ifndef _NRF_EDGEAI_USER_MODEL_COMPILED_H_\n'
+			'#define _NRF_EDGEAI_USER_MODEL_COMPILED_H_\n\n'
+			'#include <math.h>\n'
+			'#include <nrf_edgeai/nrf_edgeai_ctypes.h>\n\n'
+			'/** Neuron buffer entries holding the outputs */\n'
+			'static const uint16_t MODEL_COMPILED_OUTPUT_SLOTS[] = { '
+			f'{", ".join(str(i) for i in range(outputs_num))} }};\n\n'
+			'static inline flt32_t compiled_sigmoid_(flt32_t x)\n'
+			'{\n'
+			'    return 1.0f / (1.0f + expf(-x));\n'
+			'}\n\n'
+			'static inline flt32_t compiled_clamp_(flt32_t x)\n'
+			'{\n'
+			'    return (x > 1.0f) ? 1.0f : ((x < 0.0f) ? 0.0f : x);\n'
+			'}\n\n'
+			f'/** Evaluate the {neurons_num} neurons and {links_num} links of the network, '
+			'stores the outputs to p_outputs */\n'
+			'static void model_compiled_run_f32_(const flt32_t* p_inputs, '
+			'flt32_t* p_outputs)\n'
+			'{\n')
+		f.write('\n'.join(body))
+		f.write('\n}\n\n'
+			'#endif /* _NRF_EDGEAI_USER_MODEL_COMPILED_H_ */\n')
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,453 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Generate a packed Neuton model header from an Edge AI Lab nrf_edgeai_user_model.c.
+
+The packed format interleaves each neuron's links and weights into one
+sequential record stream, see union app_nn_packed_word in lib/nn/app_nn.h.
+
+Records are ordered by output: each output neuron follows the neurons it
+depends on, starting with the output that needs the fewest neurons still
+to be evaluated. Outputs are then known as early as possible, which lets
+app_nn_packed_run_early_exit_f32() stop once the top output stands out.
+Neurons no output depends on are dropped.
+
+Neuron activations are assigned to buffer slots from a liveness pass over
+the graph: a slot is reused once every successor of its neuron has been
+evaluated, so the activation buffer only holds the peak live set. Output
+neurons stay live to the end of inference.
+
+The records are also generated in the q8 format, which stores each weight
+as an int8 multiple of a per-neuron scale and each source index in one
+byte. The scale is the largest weight over 127, or the power of two that
+represents the weights with the smaller error, since exported weights are
+often short binary fractions such as 0.5 or 0.875. The format is selected
+with CONFIG_APP_DETECTION_PACKED_MODEL_Q8. Links that quantize to 0 are
+pruned, the others are sorted by source and each index byte holds the
+delta to the previous source, so models of any size fit. A gap of more
+than 255 is bridged with links of weight 0 and delta 255.
+
+The unit format keeps the links with a weight of exactly +1 or -1 apart as
+source indices only, evaluated with additions and subtractions. It is
+selected with CONFIG_APP_DETECTION_PACKED_MODEL_UNIT. Other powers of two
+stay f32 links, a multiply costs no more than an exponent adjustment on a
+core with an FPU.
+
+The f16 and bf16 formats keep the layout of the f32 format with each weight
+in 16 bits, as IEEE half precision or as bfloat16, the high half of the
+f32, both rounded to nearest even. Two weights share one word. They are
+selected with CONFIG_APP_DETECTION_PACKED_MODEL_F16 and
+CONFIG_APP_DETECTION_PACKED_MODEL_BF16.
+
+With a prune threshold, links with a weight of smaller magnitude are
+dropped from all formats, along with the neurons left without a path to an
+output. Pruning changes the outputs, compare the pruned model against the
+full one with tools/host_replay.
+
+Usage: neuton_pack.py <nrf_edgeai_user_model.c> <output header> [prune threshold]
+"""
+
+import heapq
+import math
+import re
+import struct
+import sys
+
+ACT_CLAMP = 0x8000
+DELTA_MAX = 255
+
+
+def parse_array(source, name):
+	match = re.search(r'\b' + name + r'\[\]\s*=\s*\{(.*?)\};', source, re.S)
+	if not match:
+		sys.exit(f'{name} not found')
+	return [v.strip() for v in match.group(1).split(',') if v.strip()]
+
+
+def parse_define(source, name):
+	match = re.search(r'#define\s+' + name + r'\s+(0x[0-9a-fA-F]+|\d+)', source)
+	if not match:
+		sys.exit(f'{name} not found')
+	return int(match.group(1), 0)
+
+
+def f32_word(value):
+	return struct.unpack('<I', struct.pack('<f', float(value.rstrip('fF'))))[0]
+
+
+def evaluation_order(neurons_num, sources, outputs):
+	"""Order neurons by output, returns the neuron order and output order."""
+	dependencies = []
+	for out in outputs:
+		needed = set()
+		pending = [out]
+		while pending:
+			n = pending.pop()
+			if n not in needed:
+				needed.add(n)
+				pending.extend(sources[n])
+		dependencies.append(needed)
+
+	order = []
+	output_order = []
+	evaluated = set()
+	remaining = list(range(len(outputs)))
+	while remaining:
+		# Links always point to lower neuron indices, ascending order is topological
+		best = min(remaining, key=lambda i: (len(dependencies[i] - evaluated), i))
+		remaining.remove(best)
+		order += sorted(dependencies[best] - evaluated)
+		evaluated |= dependencies[best]
+		output_order.append(best)
+
+	return order, output_order
+
+
+def assign_slots(order, sources, outputs):
+	"""Map each neuron to an activation slot, returns the map and the slot count."""
+	never = len(order)
+	position = {n: pos for pos, n in enumerate(order)}
+	last_use = {n: position[n] for n in order}
+	for n in order:
+		for src in sources[n]:
+			last_use[src] = max(last_use[src], position[n])
+	for n in outputs:
+		last_use[n] = never
+
+	dying = [[] for _ in order]
+	for n, last in last_use.items():
+		if position[n] < last < never:
+			dying[last].append(n)
+
+	slots = {}
+	free = []
+	slots_num = 0
+	for pos, n in enumerate(order):
+		# All inputs are summed before the result is stored, so the slot of an
+		# input read for the last time by this neuron can hold its result
+		for src in dying[pos]:
+			heapq.heappush(free, slots[src])
+		if free:
+			slots[n] = heapq.heappop(free)
+		else:
+			slots[n] = slots_num
+			slots_num += 1
+		if last_use[n] == pos:
+			heapq.heappush(free, slots[n])
+
+	return slots, slots_num
+
+
+def pack_links(links, weights):
+	words = []
+	for i in range(0, len(links), 2):
+		pair = links[i:i + 2]
+		words.append(('u32', pair[0] | ((pair[1] if len(pair) > 1 else 0) << 16)))
+		words.extend(('f32', w) for w in weights[i:i + 2])
+	return words
+
+
+def quantize_q8(weights):
+	"""Quantize the weights of one neuron, returns the scale, values and largest error."""
+	largest = max(abs(w) for w in weights) if weights else 0.0
+	if largest == 0.0:
+		return 1.0, [0] * len(weights), 0.0
+
+	best = None
+	for scale in (largest / 127, 2.0 ** -math.floor(math.log2(127 / largest))):
+		values = [max(-127, min(127, round(w / scale))) for w in weights]
+		error = max(abs(w - v * scale) for w, v in zip(weights, values))
+		if best is None or error < best[2]:
+			best = (scale, values, error)
+
+	return best
+
+
+def delta_links_q8(links, values):
+	"""Prune zero links and code the sources as deltas, returns the deltas and values."""
+	deltas = []
+	coded = []
+	last = 0
+	for idx, v in sorted((idx, v) for idx, v in zip(links, values) if v != 0):
+		while idx - last > DELTA_MAX:
+			last += DELTA_MAX
+			deltas.append(DELTA_MAX)
+			coded.append(0)
+		deltas.append(idx - last)
+		coded.append(v)
+		last = idx
+	return deltas, coded
+
+
+def pack_links_q8(links, values):
+	words = []
+	for i in range(0, len(links), 4):
+		indices = links[i:i + 4]
+		group = values[i:i + 4]
+		words.append(('u32', sum(idx << (8 * j) for j, idx in enumerate(indices))))
+		words.append(('u32', sum((v & 0xff) << (8 * j) for j, v in enumerate(group))))
+	return words
+
+
+def f16_bits(value):
+	try:
+		return struct.unpack('<H', struct.pack('<e', value))[0]
+	except OverflowError:
+		sys.exit(f'weight {value} does not fit in half precision')
+
+
+def f16_value(bits):
+	return struct.unpack('<e', struct.pack('<H', bits))[0]
+
+
+def bf16_bits(value):
+	bits = struct.unpack('<I', struct.pack('<f', value))[0]
+	return (bits + 0x7fff + ((bits >> 16) & 1)) >> 16
+
+
+def bf16_value(bits):
+	return struct.unpack('<f', struct.pack('<I', bits << 16))[0]
+
+
+# Encoder and decoder of each 16-bit weight format
+HALF_FORMATS = {'f16': (f16_bits, f16_value), 'bf16': (bf16_bits, bf16_value)}
+
+
+def pack_links_h16(links, weights, encode):
+	"""Pack links with 16-bit weights, returns the words and the largest weight error."""
+	words = []
+	error = 0.0
+	for i in range(0, len(links), 2):
+		pair = links[i:i + 2]
+		values = [float(w.rstrip('fF')) for w in weights[i:i + 2]]
+		bits = [encode[0](v) for v in values]
+		error = max([error] + [abs(v - encode[1](b)) for v, b in zip(values, bits)])
+		words.append(('u32', pair[0] | ((pair[1] if len(pair) > 1 else 0) << 16)))
+		words.append(('u32', bits[0] | ((bits[1] if len(bits) > 1 else 0) << 16)))
+	return words, error
+
+
+def pack_units(links):
+	words = []
+	for i in range(0, len(links), 2):
+		pair = links[i:i + 2]
+		words.append(('u32', pair[0] | ((pair[1] if len(pair) > 1 else 0) << 16)))
+	return words
+
+
+def split_units(links, weights):
+	"""Split links into f32 links and the sources of +1 and -1 links."""
+	general = ([], [])
+	plus = []
+	minus = []
+	for idx, w in zip(links, weights):
+		value = float(w.rstrip('fF'))
+		if value == 1.0 and len(plus) < 255:
+			plus.append(idx)
+		elif value == -1.0 and len(minus) < 255:
+			minus.append(idx)
+		else:
+			general[0].append(idx)
+			general[1].append(w)
+	return general, plus, minus
+
+
+def prune(weights, links, internal, external, threshold):
+	"""Drop the links with a weight below threshold, returns the arrays without them."""
+	kept = ([], [], [], [])
+	first = 0
+	for n in range(len(external)):
+		for end, ends in ((internal[n], kept[2]), (external[n], kept[3])):
+			for i in range(first, end):
+				if abs(float(weights[i].rstrip('fF'))) >= threshold:
+					kept[0].append(weights[i])
+					kept[1].append(links[i])
+			ends.append(len(kept[0]))
+			first = end
+	return kept
+
+
+def pack(source, threshold):
+	params_type = re.search(r'#define\s+MODEL_PARAMS_TYPE\s+(\w+)', source).group(1)
+	if params_type != 'f32':
+		sys.exit(f'only f32 models can be packed, got {params_type}')
+
+	neurons_num = parse_define(source, 'MODEL_NEURONS_NUM')
+	weights = parse_array(source, 'MODEL_WEIGHTS')
+	links = [int(v, 0) for v in parse_array(source, 'MODEL_NEURONS_LINKS')]
+	internal = [int(v, 0) for v in parse_array(source, 'MODEL_NEURON_INTERNAL_LINKS_NUM')]
+	external = [int(v, 0) for v in parse_array(source, 'MODEL_NEURON_EXTERNAL_LINKS_NUM')]
+	act_weights = parse_array(source, 'MODEL_NEURON_ACTIVATION_WEIGHTS')
+	act_mask = [int(v, 0) for v in parse_array(source, 'MODEL_NEURON_ACTIVATION_TYPE_MASK')]
+	outputs = [int(v, 0) for v in parse_array(source, 'MODEL_OUTPUT_NEURONS_INDICES')]
+	links_num = len(links)
+
+	if threshold > 0.0:
+		weights, links, internal, external = prune(weights, links, internal, external,
+							   threshold)
+
+	# Links of neuron n are links[first[n]:internal[n]] internal, then up to external[n]
+	first = [0] + external[:-1]
+	sources = [links[first[n]:internal[n]] for n in range(neurons_num)]
+
+	order, output_order = evaluation_order(neurons_num, sources, outputs)
+	position = {n: pos for pos, n in enumerate(order)}
+	slots, slots_num = assign_slots(order, sources, outputs)
+
+	words = []
+	words_q8 = []
+	words_unit = []
+	words_h16 = {name: [] for name in HALF_FORMATS}
+	error_h16 = {name: 0.0 for name in HALF_FORMATS}
+	error_q8 = 0.0
+	links_q8_num = 0
+	units_num = 0
+	for n in order:
+		internal_num = internal[n] - first[n]
+		external_num = external[n] - internal[n]
+		clamp = (act_mask[n >> 3] >> (n & 7)) & 1
+
+		if external_num >= ACT_CLAMP:
+			sys.exit(f'neuron {n} has too many external links')
+
+		header = ('u32', internal_num | ((external_num | (ACT_CLAMP if clamp else 0)) << 16))
+		words.append(header)
+		words.append(('u32', slots[n]))
+		words.append(('f32', act_weights[n]))
+		words += pack_links([slots[src] for src in sources[n]], weights[first[n]:internal[n]])
+		words += pack_links(links[internal[n]:external[n]], weights[internal[n]:external[n]])
+
+		for name, encode in HALF_FORMATS.items():
+			internal_h16 = pack_links_h16([slots[src] for src in sources[n]],
+						      weights[first[n]:internal[n]], encode)
+			external_h16 = pack_links_h16(links[internal[n]:external[n]],
+						      weights[internal[n]:external[n]], encode)
+			words_h16[name] += [header, ('u32', slots[n]), ('f32', act_weights[n])]
+			words_h16[name] += internal_h16[0] + external_h16[0]
+			error_h16[name] = max(error_h16[name], internal_h16[1], external_h16[1])
+
+		internal_split = split_units([slots[src] for src in sources[n]],
+					     weights[first[n]:internal[n]])
+		external_split = split_units(links[internal[n]:external[n]],
+					     weights[internal[n]:external[n]])
+		unit_external = len(external_split[0][0]) | (ACT_CLAMP if clamp else 0)
+		words_unit.append(('u32', len(internal_split[0][0]) | (unit_external << 16)))
+		words_unit.append(('u32', slots[n]))
+		words_unit.append(('f32', act_weights[n]))
+		words_unit.append(('u32', len(internal_split[1]) | (len(internal_split[2]) << 8) |
+				   (len(external_split[1]) << 16) | (len(external_split[2]) << 24)))
+		words_unit += pack_links(*internal_split[0])
+		words_unit += pack_links(*external_split[0])
+		for split in (internal_split, external_split):
+			words_unit += pack_units(split[1]) + pack_units(split[2])
+			units_num += len(split[1]) + len(split[2])
+
+		scale, values, error = quantize_q8([float(w.rstrip('fF'))
+						    for w in weights[first[n]:external[n]]])
+		error_q8 = max(error_q8, error)
+		internal_q8 = delta_links_q8([slots[src] for src in sources[n]],
+					     values[:internal_num])
+		external_q8 = delta_links_q8(links[internal[n]:external[n]], values[internal_num:])
+		external_q8_num = len(external_q8[0]) | (ACT_CLAMP if clamp else 0)
+		words_q8.append(('u32', len(internal_q8[0]) | (external_q8_num << 16)))
+		words_q8.append(('u32', slots[n]))
+		words_q8.append(('f32', act_weights[n]))
+		words_q8.append(('f32', f'{scale:.9g}'))
+		words_q8 += pack_links_q8(*internal_q8)
+		words_q8 += pack_links_q8(*external_q8)
+		links_q8_num += len(internal_q8[0]) + len(external_q8[0])
+
+	output_records = [(position[outputs[i]], slots[outputs[i]]) for i in output_order]
+
+	return (words, words_q8, error_q8, links_q8_num, words_unit, units_num, words_h16,
+		error_h16, links_num, len(links), len(order), slots_num,
+		[slots[n] for n in outputs], output_records)
+
+
+def format_words(words):
+	lines = []
+	for kind, value in words:
+		if kind == 'u32':
+			lines.append(f'\t{{ .u32 = 0x{value:08x} }},')
+		else:
+			lines.append(f'\t{{ .u32 = 0x{f32_word(value):08x} }}, /* {value} */')
+	return '\n'.join(lines)
+
+
+def main():
+	if len(sys.argv) not in (3, 4):
+		sys.exit(__doc__)
+
+	threshold = float(sys.argv[3]) if len(sys.argv) == 4 else 0.0
+
+	with open(sys.argv[1]) as f:
+		(words, words_q8, error_q8, links_q8_num, words_unit, units_num, words_h16,
+		 error_h16, links_num, kept_num, records_num, slots_num, output_slots,
+		 output_records) = pack(f.read(), threshold)
+
+	with open(sys.argv[2], 'w') as f:
+		f.write('/*\n'
+			' * Generated by scripts/neuton_pack.py from nrf_edgeai_user_model.c, do not edit.\n'
+			' */\n\n'
+			'#ifndef _NRF_EDGEAI_USER_MODEL_PACKED_H_\n'
+			'#define _NRF_EDGEAI_USER_MODEL_PACKED_H_\n\n'
+			'#include "app_nn.h"\n\n'
+			'/** Qualifier of the packed records, defined empty to keep them in RAM */\n'
+			'#ifndef MODEL_PACKED_CONST\n'
+			'#define MODEL_PACKED_CONST const\n'
+			'#endif\n\n'
+			'/** Activation slots needed for the peak live set of neurons */\n'
+			f'#define MODEL_PACKED_SLOTS_NUM {slots_num}\n\n'
+			'/** Number of packed neuron records */\n'
+			f'#define MODEL_PACKED_RECORDS_NUM {records_num}\n\n'
+			'/** Activation slots holding the output neurons */\n'
+			'static const uint16_t MODEL_PACKED_OUTPUT_SLOTS[] = { '
+			f'{", ".join(str(s) for s in output_slots)} }};\n\n'
+			'/** Output neuron records in evaluation order */\n'
+			'static const struct app_nn_packed_output MODEL_PACKED_OUTPUTS[] = {\n')
+		f.write('\n'.join(f'\t{{ .position = {p}, .slot = {s} }},' for p, s in output_records))
+		f.write('\n};\n\n')
+		if threshold > 0.0:
+			f.write(f'/* Pruned below {threshold:g}, '
+				f'{kept_num} of {links_num} links kept */\n')
+		f.write('#if defined(CONFIG_APP_DETECTION_PACKED_MODEL_Q8)\n'
+			f'/** Packed neuron records with q8 weights, {len(words_q8) * 4} bytes, '
+			f'{links_q8_num} links, largest weight error {error_q8:.7f} */\n'
+			'static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {\n'
+			f'{format_words(words_q8)}\n'
+			'};\n'
+			'#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_UNIT)\n'
+			f'/** Packed neuron records with unit weight links, {len(words_unit) * 4} '
+			f'bytes, {units_num} unit links */\n'
+			'static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {\n'
+			f'{format_words(words_unit)}\n'
+			'};\n'
+			'#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_BF16)\n'
+			'/** Packed neuron records with bf16 weights, '
+			f'{len(words_h16["bf16"]) * 4} bytes, '
+			f'largest weight error {error_h16["bf16"]:.7f} */\n'
+			'static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {\n'
+			f'{format_words(words_h16["bf16"])}\n'
+			'};\n'
+			'#elif defined(CONFIG_APP_DETECTION_PACKED_MODEL_F16)\n'
+			'/** Packed neuron records with f16 weights, '
+			f'{len(words_h16["f16"]) * 4} bytes, '
+			f'largest weight error {error_h16["f16"]:.7f} */\n'
+			'static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {\n'
+			f'{format_words(words_h16["f16"])}\n'
+			'};\n'
+			'#else\n'
+			f'/** Packed neuron records, {len(words) * 4} bytes */\n'
+			'static MODEL_PACKED_CONST union app_nn_packed_word MODEL_PACKED[] = {\n'
+			f'{format_words(words)}\n'
+			'};\n'
+			'#endif\n\n'
+			'#endif /* _NRF_EDGEAI_USER_MODEL_PACKED_H_ */\n')
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Convert a CSV recording into a trace for CONFIG_APP_SAMPLING_REPLAY.
+
+Reads the CSV written by stream_capture.py or capture_dump.py, whose last six
+columns are the accel X..Z and gyro X..Z sensor counts, and writes them as
+little-endian int16 values, six per sample. Rows that are not all numbers,
+e.g. the header, are skipped. A capture_dump.py CSV holds the windows around
+every trigger one after the other, pass a capture id to keep only one.
+
+Usage: replay_trace.py <recording.csv> <trace.bin> [capture id]
+"""
+
+import csv
+import struct
+import sys
+
+SAMPLE = struct.Struct('<6h')
+
+
+def main():
+	if len(sys.argv) not in (3, 4):
+		sys.exit(__doc__)
+
+	capture_id = int(sys.argv[3]) if len(sys.argv) == 4 else None
+	samples = 0
+
+	with open(sys.argv[1], newline='') as recording, open(sys.argv[2], 'wb') as trace:
+		for row in csv.reader(recording):
+			try:
+				values = [int(v) for v in row]
+			except ValueError:
+				continue
+			if len(values) < 6 or (capture_id is not None and values[0] != capture_id):
+				continue
+			trace.write(SAMPLE.pack(*values[-6:]))
+			samples += 1
+
+	if samples == 0:
+		sys.exit('No samples in the recording')
+	print(f'{samples} samples written to {sys.argv[2]}')
+
+
+if __name__ == '__main__':
+	main()
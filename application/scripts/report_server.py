@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Receive batched detection events or class summaries and print them as CSV.
+
+Listens for datagrams sent with CONFIG_APP_REPORT, see report_encode.h in
+modules/report, and writes one CSV row per event:
+address,seq,timestamp_ms,model,class,confidence_pct. Timestamps are device
+uptime in milliseconds. Sequence gaps, events dropped from the device ring,
+are reported on stderr.
+
+Summaries, sent with CONFIG_APP_REPORT_SUMMARY, are written as one row per
+class, under a header of their own printed before the first of them:
+address,model,start_ms,duration_ms,class,dwell_ms,entries and the number of
+episodes per duration bin.
+
+Usage: report_server.py [port]
+"""
+
+import socket
+import sys
+
+FORMAT_EVENTS = 1
+FORMAT_SUMMARY = 2
+
+# Upper episode durations of the bins in detection_summary.c, the last bin is open
+DWELL_BINS = ('10s', '60s', '600s', '3600s', 'long')
+
+EVENTS_HEADER = 'address,seq,timestamp_ms,model,class,confidence_pct'
+SUMMARY_HEADER = ('address,model,start_ms,duration_ms,class,dwell_ms,entries,' +
+		  ','.join(f'episodes_{b}' for b in DWELL_BINS))
+
+
+def varint(data, pos):
+	value = 0
+	shift = 0
+	while True:
+		byte = data[pos]
+		pos += 1
+		value |= (byte & 0x7f) << shift
+		shift += 7
+		if not byte & 0x80:
+			return value, pos
+
+
+def decode_events(data):
+	count = int.from_bytes(data[1:3], 'little')
+	seq, pos = varint(data, 3)
+	timestamp = 0
+	events = []
+	for i in range(count):
+		delta, pos = varint(data, pos)
+		model = data[pos]
+		predicted_class, pos = varint(data, pos + 1)
+		confidence = data[pos]
+		pos += 1
+		timestamp = (timestamp + delta) & 0xffffffff
+		events.append((seq + i, timestamp, model, predicted_class, confidence))
+	return events
+
+
+def decode_summary(data):
+	model = data[1]
+	start, pos = varint(data, 2)
+	duration, pos = varint(data, pos)
+	num_classes = data[pos]
+	pos += 1
+	rows = []
+	for predicted_class in range(num_classes):
+		dwell, pos = varint(data, pos)
+		entries, pos = varint(data, pos)
+		episodes = []
+		for _ in DWELL_BINS:
+			value, pos = varint(data, pos)
+			episodes.append(value)
+		rows.append((model, start, duration, predicted_class, dwell, entries, *episodes))
+	return rows
+
+
+def main():
+	port = int(sys.argv[1]) if len(sys.argv) > 1 else 4242
+
+	sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+	sock.bind(('', port))
+
+	next_seq = {}
+	headers = set()
+	while True:
+		data, (host, _) = sock.recvfrom(2048)
+		try:
+			if data[0] == FORMAT_SUMMARY:
+				rows = decode_summary(data)
+			elif data[0] == FORMAT_EVENTS:
+				events = decode_events(data)
+			else:
+				raise ValueError(f'unsupported format {data[0]}')
+		except (IndexError, ValueError) as e:
+			print(f'{host}: bad datagram: {e}', file=sys.stderr)
+			continue
+
+		header = SUMMARY_HEADER if data[0] == FORMAT_SUMMARY else EVENTS_HEADER
+		if header not in headers:
+			headers.add(header)
+			print(header, flush=True)
+
+		if data[0] == FORMAT_SUMMARY:
+			for row in rows:
+				print(host + ',' + ','.join(str(v) for v in row), flush=True)
+			continue
+
+		if events and host in next_seq and events[0][0] > next_seq[host]:
+			print(f'{host}: {events[0][0] - next_seq[host]} events dropped', file=sys.stderr)
+		if events:
+			next_seq[host] = events[-1][0] + 1
+
+		for event in events:
+			print(host + ',' + ','.join(str(v) for v in event), flush=True)
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,51 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Decoder of the lossless sample codec, see modules/sampling/sampling_codec.h.
+
+Each sample is seven zigzag varints: the change of the sampling period in
+microseconds, then the difference of accel X..Z and gyro X..Z to the
+previous sample in sensor counts. A block starts from a zero timestamp,
+period and axes.
+"""
+
+AXES = 6
+
+
+def _varint(data, pos):
+	value = 0
+	shift = 0
+	while True:
+		if pos >= len(data) or shift > 28:
+			raise ValueError('truncated sample')
+		byte = data[pos]
+		value |= (byte & 0x7f) << shift
+		pos += 1
+		if not byte & 0x80:
+			return value, pos
+		shift += 7
+
+
+def _unzigzag(value):
+	return (value >> 1) ^ -(value & 1)
+
+
+def decode_block(data, count):
+	"""Return count (timestamp_us, accel_x, ..., gyro_z) tuples."""
+	timestamp = 0
+	period = 0
+	axes = [0] * AXES
+	samples = []
+	pos = 0
+	for _ in range(count):
+		value, pos = _varint(data, pos)
+		period = (period + _unzigzag(value)) & 0xffffffff
+		timestamp = (timestamp + period) & 0xffffffff
+		for i in range(AXES):
+			value, pos = _varint(data, pos)
+			axes[i] = ((axes[i] + _unzigzag(value) + 0x8000) & 0xffff) - 0x8000
+		samples.append((timestamp, *axes))
+	return samples
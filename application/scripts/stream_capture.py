@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Convert a binary raw sample stream into CSV.
+
+Reads packets sent with CONFIG_APP_SAMPLING_STREAM, see struct
+sampling_stream_packet in modules/sampling/sampling_stream.h, from a serial
+port or capture file and writes one CSV row per sample:
+seq,timestamp_us,accel_x,accel_y,accel_z,gyro_x,gyro_y,gyro_z in sensor
+counts. Compressed blocks sent with CONFIG_APP_SAMPLING_STREAM_COMPRESS are
+decoded into one row per sample, all with the sequence number of the
+block. Packets failing the CRC are skipped and sequence gaps are reported
+on stderr.
+
+With --trace, the samples are also written to a binary trace for the host
+replay tools, see imu_trace.py, described by the info packets of the stream.
+Without an info packet before the first sample the Kconfig defaults are
+assumed.
+
+With --features, feature packets sent with
+CONFIG_APP_DETECTION_FEATURE_EXPORT_STREAM, see struct
+sampling_stream_features, are written to a second CSV file with one row per
+window: seq,window_end_us,model,predicted_class,f0,f1,...
+
+Usage: stream_capture.py [--features FILE] [--trace FILE]
+                         <serial port or capture file> [baudrate]
+"""
+
+import os
+import struct
+import sys
+
+from imu_trace import TraceWriter
+from sample_codec import decode_block
+
+SYNC = b'\xa5\x5a'
+FEATURES_SYNC = b'\xa5\x5b'
+BLOCK_SYNC = b'\xa5\x5c'
+INFO_SYNC = b'\xa5\x5d'
+PACKET = struct.Struct('<2sHI6hH')
+FEATURES_HEADER = struct.Struct('<2sHIBBH')
+BLOCK_HEADER = struct.Struct('<2sHBBH')
+INFO = struct.Struct('<2sBBHHH6sH')
+CRC = struct.Struct('<H')
+
+
+def crc16_ccitt_false(data):
+	crc = 0xffff
+	for byte in data:
+		crc ^= byte << 8
+		for _ in range(8):
+			crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+			crc &= 0xffff
+	return crc
+
+
+def find_sync(buf):
+	starts = [i for i in (buf.find(s) for s in (SYNC, FEATURES_SYNC, BLOCK_SYNC, INFO_SYNC)) if i >= 0]
+	return min(starts) if starts else -1
+
+
+def packet_size(buf, start):
+	"""Size of the packet at start, None until enough bytes are buffered"""
+	if buf[start:start + 2] == SYNC:
+		return PACKET.size
+	if buf[start:start + 2] == INFO_SYNC:
+		return INFO.size
+	if buf[start:start + 2] == BLOCK_SYNC:
+		if len(buf) - start < BLOCK_HEADER.size:
+			return None
+		return BLOCK_HEADER.size + BLOCK_HEADER.unpack_from(buf, start)[4] + CRC.size
+	if len(buf) - start < FEATURES_HEADER.size:
+		return None
+	num = FEATURES_HEADER.unpack_from(buf, start)[4]
+	return FEATURES_HEADER.size + 4 * num + CRC.size
+
+
+def packets(stream):
+	"""Yield ('sample', fields), ('features', fields) and ('info', fields) tuples
+
+	Compressed blocks are yielded as ('sample', (seq, [samples])).
+	"""
+	buf = b''
+	while True:
+		chunk = stream.read(4096)
+		if not chunk:
+			return
+		buf += chunk
+		while True:
+			start = find_sync(buf)
+			if start < 0:
+				buf = buf[-1:]
+				break
+			size = packet_size(buf, start)
+			if size is None or len(buf) - start < size:
+				buf = buf[start:]
+				break
+			raw = buf[start:start + size]
+			if crc16_ccitt_false(raw[2:-2]) != CRC.unpack_from(raw, size - CRC.size)[0]:
+				# False sync inside a packet, resynchronize on the next byte
+				buf = buf[start + 1:]
+				continue
+			buf = buf[start + size:]
+			if raw[:2] == SYNC:
+				yield 'sample', PACKET.unpack(raw)[1:-1]
+			elif raw[:2] == INFO_SYNC:
+				yield 'info', INFO.unpack(raw)[1:-1]
+			elif raw[:2] == BLOCK_SYNC:
+				_, seq, count, _, length = BLOCK_HEADER.unpack_from(raw)
+				data = raw[BLOCK_HEADER.size:BLOCK_HEADER.size + length]
+				yield 'sample', (seq, decode_block(data, count))
+			else:
+				_, seq, window_end_us, model, num, predicted_class = \
+					FEATURES_HEADER.unpack_from(raw)
+				features = struct.unpack_from(f'<{num}f', raw, FEATURES_HEADER.size)
+				yield 'features', (seq, window_end_us, model, predicted_class, *features)
+
+
+def open_input(path, baudrate):
+	if os.path.isfile(path):
+		return open(path, 'rb')
+	import serial
+	return serial.Serial(path, baudrate)
+
+
+def main():
+	args = sys.argv[1:]
+	outputs = {'--features': None, '--trace': None}
+	while len(args) >= 2 and args[0] in outputs:
+		outputs[args[0]] = args[1]
+		args = args[2:]
+	if len(args) not in (1, 2):
+		sys.exit(__doc__)
+
+	baudrate = int(args[1]) if len(args) == 2 else 1000000
+	features_out = open(outputs['--features'], 'w') if outputs['--features'] else None
+	trace = None
+	# Kconfig defaults until an info packet says otherwise
+	info = (1, 6, 100, 8, 2000, bytes(range(6)))
+	expected = {'sample': None, 'features': None}
+	features_num = None
+
+	print('seq,timestamp_us,accel_x,accel_y,accel_z,gyro_x,gyro_y,gyro_z')
+	with open_input(args[0], baudrate) as stream:
+		for kind, fields in packets(stream):
+			if kind == 'info':
+				if trace is not None and fields != info:
+					print('Stream settings changed, trace keeps the first ones',
+					      file=sys.stderr)
+				info = fields
+				continue
+
+			seq = fields[0]
+			if expected[kind] is not None and seq != expected[kind]:
+				print(f'{(seq - expected[kind]) & 0xffff} {kind} packets lost before {seq}',
+				      file=sys.stderr)
+			expected[kind] = (seq + 1) & 0xffff
+
+			if kind == 'sample':
+				samples = fields[1] if isinstance(fields[1], list) else [fields[1:]]
+				if trace is None and outputs['--trace']:
+					_, channels, frequency_hz, accel_range_g, gyro_range_dps, \
+						channel_map = info
+					trace = TraceWriter(outputs['--trace'], frequency_hz, accel_range_g,
+							    gyro_range_dps, channel_map[:channels])
+				for sample in samples:
+					print(','.join(str(v) for v in (seq, *sample)))
+					if trace is not None:
+						trace.write(sample[1:], sample[0])
+				continue
+			if features_out is None:
+				continue
+			if features_num is None:
+				features_num = len(fields) - 4
+				names = ','.join(f'f{i}' for i in range(features_num))
+				print(f'seq,window_end_us,model,predicted_class,{names}', file=features_out)
+			print(','.join(str(v) for v in fields), file=features_out)
+
+	if trace is not None:
+		trace.close()
+	if features_out is not None:
+		features_out.close()
+
+
+if __name__ == '__main__':
+	main()
@@ -14,20 +14,60 @@
 #include "../modules/sampling/sampling.h"
 #include "../modules/detection/detection.h"
 
+#if defined(CONFIG_APP_CAPTURE)
+#include "../modules/capture/capture.h"
+#endif
+
+#if defined(CONFIG_APP_PROFILING)
+#include "../modules/profiling/profiling.h"
+#endif
+
+#if defined(CONFIG_APP_PROFILING_MARKERS)
+#include "../modules/profiling/profiling_marker.h"
+#endif
+
+#if defined(CONFIG_APP_REPORT)
+#include "../modules/report/report.h"
+#endif
+
+#if defined(CONFIG_APP_ZBUS_DEFERRED)
+#include "app_zbus.h"
+#endif
+
 LOG_MODULE_REGISTER(app_main, LOG_LEVEL_DBG);
 
 enum app_states {
 	STATE_IDLE,
 	STATE_DETECTING,
-	STATE_SENSOR_SAMPLING
+	STATE_SENSOR_SAMPLING,
+	STATE_MOTION_WAIT
+};
+
+enum app_event_type {
+	APP_EVENT_BUTTON,
+	APP_EVENT_MOTION,
+	APP_EVENT_DORMANT,
+};
+
+struct app_event {
+	enum app_event_type type;
+	union {
+		enum button_event button;
+		enum imu_motion_event_type motion;
+	};
 };
 
 struct app_context {
 	struct smf_ctx ctx;
+	/* Event being handled by the current run handler */
+	struct app_event event;
 };
 
 static struct app_context app_ctx;
 
+/* Events posted from listener context, the state machine only runs in main() */
+K_MSGQ_DEFINE(app_event_msgq, sizeof(struct app_event), 8, 4);
+
 static const char *DETECTION_CLASS_NAMES[] = {
 	"Idle", "Shaking", "Impact", "Free Fall", "Carrying", "in Car", "Placed",
 };
@@ -42,6 +82,7 @@ enum {
 	DETECTION_CLASS_PLACED,
 };
 
+
 static void idle_entry(void *obj);
 static enum smf_state_result idle_run(void *obj);
 
@@ -53,6 +94,10 @@ static void sensor_sampling_entry(void *obj);
 static enum smf_state_result sensor_sampling_run(void *obj);
 static void sensor_sampling_exit(void *obj);
 
+static void motion_wait_entry(void *obj);
+static enum smf_state_result motion_wait_run(void *obj);
+static void motion_wait_exit(void *obj);
+
 static const struct smf_state states[] = {
 	[STATE_IDLE] = SMF_CREATE_STATE(
 		idle_entry,
@@ -75,8 +120,35 @@ static const struct smf_state states[] = {
 		NULL,
 		NULL
 	),
+	[STATE_MOTION_WAIT] = SMF_CREATE_STATE(
+		motion_wait_entry,
+		motion_wait_run,
+		motion_wait_exit,
+		NULL,
+		NULL
+	),
 };
 
+/* Button presses switch between the top level modes from any state */
+static void button_transition(const struct app_event *event)
+{
+	if (event->type != APP_EVENT_BUTTON) {
+		return;
+	}
+
+	switch (event->button) {
+		case BUTTON_EVENT_SINGLE_PRESS:
+			smf_set_state(SMF_CTX(&app_ctx), &states[STATE_DETECTING]);
+			break;
+		case BUTTON_EVENT_DOUBLE_PRESS:
+			smf_set_state(SMF_CTX(&app_ctx), &states[STATE_SENSOR_SAMPLING]);
+			break;
+		case BUTTON_EVENT_LONG_PRESS:
+			smf_set_state(SMF_CTX(&app_ctx), &states[STATE_IDLE]);
+			break;
+	}
+}
+
 static void idle_entry(void *obj)
 {
 	ARG_UNUSED(obj);
@@ -85,7 +157,9 @@ static void idle_entry(void *obj)
 
 static enum smf_state_result idle_run(void *obj)
 {
-	k_sleep(K_MSEC(1000));
+	struct app_context *ctx = obj;
+
+	button_transition(&ctx->event);
 	return SMF_EVENT_HANDLED;
 }
 
@@ -97,17 +171,37 @@ static void detecting_entry(void *obj)
 	detection_reset_state();
 	sampling_set_print_enabled(false);
 
-	int err = sampling_start();
+	/* Only read the sensors the model consumes */
+	int err = sampling_set_gyro_enabled(detection_uses_gyro());
+	if (err) {
+		LOG_ERR("gyro setup failed: %d", err);
+	}
+
+	err = sampling_start();
 	if (err) {
 		LOG_ERR("sampling start failed: %d", err);
 		smf_set_state(SMF_CTX(&app_ctx), &states[STATE_IDLE]);
+		return;
 	}
+
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+	sampling_set_no_motion_detection(true);
+#endif
 }
 
 static enum smf_state_result detecting_run(void *obj)
 {
-	ARG_UNUSED(obj);
-	k_sleep(K_MSEC(100));
+	struct app_context *ctx = obj;
+
+	/* Detection sleeps while the device is still or classified at rest */
+	if ((ctx->event.type == APP_EVENT_MOTION &&
+	     ctx->event.motion == IMU_MOTION_EVENT_NO_MOTION) ||
+	    ctx->event.type == APP_EVENT_DORMANT) {
+		smf_set_state(SMF_CTX(&app_ctx), &states[STATE_MOTION_WAIT]);
+		return SMF_EVENT_HANDLED;
+	}
+
+	button_transition(&ctx->event);
 	return SMF_EVENT_HANDLED;
 }
 
@@ -116,6 +210,10 @@ static void detecting_exit(void *obj)
 	ARG_UNUSED(obj);
 	LOG_INF("Detection stopped");
 
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+	sampling_set_no_motion_detection(false);
+#endif
+
 	int err = sampling_stop();
 	if (err) {
 		LOG_ERR("sampling stop failed: %d", err);
@@ -129,7 +227,13 @@ static void sensor_sampling_entry(void *obj)
 
 	sampling_set_print_enabled(true);
 
-	int err = sampling_start();
+	/* Raw samples carry all six axes */
+	int err = sampling_set_gyro_enabled(true);
+	if (err) {
+		LOG_ERR("gyro setup failed: %d", err);
+	}
+
+	err = sampling_start();
 	if (err) {
 		LOG_ERR("sampling start failed: %d", err);
 		smf_set_state(SMF_CTX(&app_ctx), &states[STATE_IDLE]);
@@ -138,8 +242,9 @@ static void sensor_sampling_entry(void *obj)
 
 static enum smf_state_result sensor_sampling_run(void *obj)
 {
-	ARG_UNUSED(obj);
-	k_sleep(K_MSEC(100));
+	struct app_context *ctx = obj;
+
+	button_transition(&ctx->event);
 	return SMF_EVENT_HANDLED;
 }
 
@@ -154,51 +259,230 @@ static void sensor_sampling_exit(void *obj)
 	}
 }
 
+static void motion_wait_entry(void *obj)
+{
+	ARG_UNUSED(obj);
+	LOG_INF("Waiting for motion");
+
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+	int err = sampling_suspend();
+	if (err) {
+		LOG_ERR("sampling suspend failed: %d", err);
+		smf_set_state(SMF_CTX(&app_ctx), &states[STATE_DETECTING]);
+	}
+#endif
+}
+
+static enum smf_state_result motion_wait_run(void *obj)
+{
+	struct app_context *ctx = obj;
+
+	/* Detection resumes on motion */
+	if (ctx->event.type == APP_EVENT_MOTION &&
+	    ctx->event.motion == IMU_MOTION_EVENT_ANY_MOTION) {
+		smf_set_state(SMF_CTX(&app_ctx), &states[STATE_DETECTING]);
+		return SMF_EVENT_HANDLED;
+	}
+
+	button_transition(&ctx->event);
+	return SMF_EVENT_HANDLED;
+}
+
+static void motion_wait_exit(void *obj)
+{
+	ARG_UNUSED(obj);
+
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+	int err = sampling_resume();
+	if (err && err != -EALREADY) {
+		LOG_ERR("sampling resume failed: %d", err);
+	}
+#endif
+}
+
+static void app_event_post(const struct app_event *event)
+{
+	int err = k_msgq_put(&app_event_msgq, event, K_NO_WAIT);
+
+	if (err) {
+		LOG_WRN("Event queue full, event %d dropped", event->type);
+	}
+}
+
+/* Runs in the interrupt context of the button gesture timer */
 static void button_listener_callback(const struct zbus_channel *chan)
 {
 	const struct button_event_msg *button_msg = zbus_chan_const_msg(chan);
 
-	switch (button_msg->event) {
-		case BUTTON_EVENT_SINGLE_PRESS:
-			smf_set_state(SMF_CTX(&app_ctx), &states[STATE_DETECTING]);
-			break;
-		case BUTTON_EVENT_DOUBLE_PRESS:
-			smf_set_state(SMF_CTX(&app_ctx), &states[STATE_SENSOR_SAMPLING]);
-			break;
-		case BUTTON_EVENT_LONG_PRESS:
-			smf_set_state(SMF_CTX(&app_ctx), &states[STATE_IDLE]);
-			break;
-	}
+	app_event_post(&(struct app_event){
+		.type = APP_EVENT_BUTTON,
+		.button = button_msg->event,
+	});
 }
 
 ZBUS_LISTENER_DEFINE(button_listener, button_listener_callback);
 
-static void detection_result_listener_callback(const struct zbus_channel *chan)
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+static void motion_listener_callback(const struct zbus_channel *chan)
+{
+	const struct imu_motion_event *event = zbus_chan_const_msg(chan);
+
+	app_event_post(&(struct app_event){
+		.type = APP_EVENT_MOTION,
+		.motion = event->type,
+	});
+}
+
+ZBUS_LISTENER_DEFINE(motion_listener, motion_listener_callback);
+#endif
+
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+/* Detection counts the windows at rest, repeated classes are not published as results */
+static void dormant_listener_callback(const struct zbus_channel *chan)
+{
+	ARG_UNUSED(chan);
+
+	app_event_post(&(struct app_event){
+		.type = APP_EVENT_DORMANT,
+	});
+}
+
+ZBUS_LISTENER_DEFINE(dormant_listener, dormant_listener_callback);
+#endif
+
+static void detection_result_log(const void *p_msg)
 {
-	const struct detection_result *result = zbus_chan_const_msg(chan);
+	const struct detection_result *result = p_msg;
+
+	/* Class names are those of the activity model, the first one registered */
+	if (result->model != 0) {
+		LOG_INF("%s: class %u (%u%%)", detection_model_name(result->model),
+			result->predicted_class, (uint32_t)(result->confidence * 100.0f));
+		return;
+	}
 
 	LOG_INF("%s (%u%%)",
 		DETECTION_CLASS_NAMES[result->predicted_class],
 		(uint32_t)(result->confidence * 100.0f));
 }
 
+#if defined(CONFIG_APP_ZBUS_DEFERRED)
+static void detection_result_log_deferred(const void *p_msg);
+
+/* Logging formats and may block on the log buffer, so it runs off the inference path */
+APP_ZBUS_DEFERRED_DEFINE(detection_result_logger, struct detection_result,
+			 CONFIG_APP_RESULT_LOG_QUEUE, detection_result_log_deferred);
+
+static void detection_result_log_deferred(const void *p_msg)
+{
+	static uint32_t dropped;
+	struct app_zbus_deferred_stats stats;
+
+	app_zbus_deferred_get_stats(&detection_result_logger_deferred, &stats);
+	if (stats.dropped != dropped) {
+		LOG_WRN("%u results not logged", stats.dropped - dropped);
+		dropped = stats.dropped;
+	}
+
+	detection_result_log(p_msg);
+}
+#else
+static void detection_result_listener_callback(const struct zbus_channel *chan)
+{
+	detection_result_log(zbus_chan_const_msg(chan));
+}
+
 ZBUS_LISTENER_DEFINE(detection_result_listener, detection_result_listener_callback);
+#endif
+
+#if defined(CONFIG_APP_PARALLEL_INIT)
+/* Module initialization run on a work queue while main() continues */
+struct boot_task {
+	struct k_work work;
+	const char *name;
+	int (*init)(void);
+	int err;
+};
+
+static void boot_task_fn(struct k_work *work)
+{
+	struct boot_task *task = CONTAINER_OF(work, struct boot_task, work);
+	uint32_t start = k_uptime_get_32();
+
+	task->err = task->init();
+	if (task->err) {
+		LOG_ERR("%s: %d", task->name, task->err);
+		return;
+	}
+
+	LOG_INF("%s done in %u ms", task->name, k_uptime_get_32() - start);
+}
+
+static void boot_task_start(struct boot_task *task, struct k_work_q *queue)
+{
+	k_work_init(&task->work, boot_task_fn);
+	(void)k_work_submit_to_queue(queue, &task->work);
+}
+
+/* Wait for a boot task, returns its initialization result */
+static int boot_task_wait(struct boot_task *task)
+{
+	struct k_work_sync sync;
+
+	(void)k_work_flush(&task->work, &sync);
+	return task->err;
+}
+
+static struct boot_task sampling_task = {
+	.name = "sampling_init",
+	.init = sampling_init,
+};
+
+#if defined(CONFIG_APP_REPORT)
+/* The modem bring-up blocks for longest, it gets a queue of its own */
+static K_THREAD_STACK_DEFINE(boot_stack, CONFIG_APP_PARALLEL_INIT_STACK_SIZE);
+static struct k_work_q boot_work_q;
+
+static struct boot_task report_task = {
+	.name = "report_init",
+	.init = report_init,
+};
+#endif
+#endif
 
 int main(void)
 {
 	int err;
 
-	err = sampling_init();
+#if defined(CONFIG_APP_PROFILING)
+	err = profiling_init();
 	if (err) {
-		LOG_ERR("sampling_init: %d", err);
+		LOG_ERR("profiling_init: %d", err);
 		return err;
 	}
+#endif
 
-	err = sampling_set_frequency(100);
+#if defined(CONFIG_APP_PROFILING_MARKERS)
+	err = profiling_marker_init();
 	if (err) {
-		LOG_ERR("sampling_set_frequency: %d", err);
+		LOG_ERR("profiling_marker_init: %d", err);
 		return err;
 	}
+#endif
+
+#if defined(CONFIG_APP_PARALLEL_INIT)
+	/*
+	 * The sensor and the modem mostly wait on their buses while detection
+	 * sets up the models. Both queues preempt main() once their I/O is done.
+	 */
+	boot_task_start(&sampling_task, &k_sys_work_q);
+#if defined(CONFIG_APP_REPORT)
+	k_work_queue_start(&boot_work_q, boot_stack, K_THREAD_STACK_SIZEOF(boot_stack),
+			   CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &(struct k_work_queue_config){
+				   .name = "boot_workq",
+			   });
+	boot_task_start(&report_task, &boot_work_q);
+#endif
 
 	err = detection_init();
 	if (err) {
@@ -206,6 +490,41 @@ int main(void)
 		return err;
 	}
 
+	/* Logged by the task on failure */
+	err = boot_task_wait(&sampling_task);
+	if (err) {
+		return err;
+	}
+#else
+	err = sampling_init();
+	if (err) {
+		LOG_ERR("sampling_init: %d", err);
+		return err;
+	}
+
+	err = detection_init();
+	if (err) {
+		LOG_ERR("detection_init: %d", err);
+		return err;
+	}
+#endif
+
+#if defined(CONFIG_APP_CAPTURE)
+	err = capture_init();
+	if (err) {
+		LOG_ERR("capture_init: %d", err);
+		return err;
+	}
+#endif
+
+#if defined(CONFIG_APP_REPORT) && !defined(CONFIG_APP_PARALLEL_INIT)
+	err = report_init();
+	if (err) {
+		LOG_ERR("report_init: %d", err);
+		return err;
+	}
+#endif
+
 	err = button_init();
 	if (err) {
 		LOG_ERR("button_init: %d", err);
@@ -218,21 +537,43 @@ int main(void)
 		return err;
 	}
 
+#if defined(CONFIG_APP_ZBUS_DEFERRED)
+	err = zbus_chan_add_obs(&detection_result_chan, &detection_result_logger, K_MSEC(100));
+#else
 	err = zbus_chan_add_obs(&detection_result_chan, &detection_result_listener, K_MSEC(100));
+#endif
 	if (err) {
 		LOG_ERR("zbus detection subscribe: %d", err);
 		return err;
 	}
 
+#if defined(CONFIG_APP_SAMPLING_MOTION_WAKEUP)
+	err = zbus_chan_add_obs(&imu_motion_chan, &motion_listener, K_MSEC(100));
+	if (err) {
+		LOG_ERR("zbus motion subscribe: %d", err);
+		return err;
+	}
+#endif
+
+#if defined(CONFIG_APP_DORMANT_SLEEP)
+	err = zbus_chan_add_obs(&detection_dormant_chan, &dormant_listener, K_MSEC(100));
+	if (err) {
+		LOG_ERR("zbus dormant subscribe: %d", err);
+		return err;
+	}
+#endif
+
 	smf_set_initial(SMF_CTX(&app_ctx), &states[STATE_IDLE]);
 
 	while (1) {
+		/* Block until a listener posts an event, no periodic wakeups */
+		k_msgq_get(&app_event_msgq, &app_ctx.event, K_FOREVER);
+
 		err = smf_run_state(SMF_CTX(&app_ctx));
 		if (err) {
 			LOG_ERR("smf_run_state: %d", err);
 			return err;
 		}
-		k_yield();
 	}
 
 	return 0;
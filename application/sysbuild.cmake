@@ -0,0 +1,72 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# Inference offloaded to a second core, see modules/detection/detection_remote.h
+if(SB_CONFIG_APP_REMOTE_INFERENCE)
+	ExternalZephyrProject_Add(
+		APPLICATION remote_inference
+		SOURCE_DIR ${APP_DIR}/remote
+		BOARD ${SB_CONFIG_APP_REMOTE_INFERENCE_BOARD}
+	)
+
+	set_config_bool(${DEFAULT_IMAGE} CONFIG_APP_DETECTION_REMOTE y)
+endif()
+
+# IMU acquisition on the VPR coprocessor, see modules/sampling/sampling_coproc.h
+if(SB_CONFIG_APP_SAMPLING_COPROC)
+	# The tree ships no devicetree for it: the application core needs the ipc0
+	# instance, the coprocessor ipc0, the imu0 alias and the IMU bus. Each
+	# comes from a board overlay of the image or an overlay passed with
+	# <image>_EXTRA_DTC_OVERLAY_FILE.
+	string(REPLACE "/" "_" app_board "${BOARD}${BOARD_QUALIFIERS}")
+	string(REPLACE "/" "_" coproc_board "${SB_CONFIG_APP_SAMPLING_COPROC_BOARD}")
+	foreach(image_overlay
+		"${DEFAULT_IMAGE}:${APP_DIR}/boards/${app_board}.overlay"
+		"sampling_coproc:${APP_DIR}/coprocessor/boards/${coproc_board}.overlay")
+		string(REGEX MATCH "^([^:]+):(.*)$" _ ${image_overlay})
+		if(NOT EXISTS ${CMAKE_MATCH_2} AND NOT DEFINED ${CMAKE_MATCH_1}_EXTRA_DTC_OVERLAY_FILE)
+			message(FATAL_ERROR "SB_CONFIG_APP_SAMPLING_COPROC needs ${CMAKE_MATCH_2} "
+					    "or ${CMAKE_MATCH_1}_EXTRA_DTC_OVERLAY_FILE, "
+					    "see APP_SAMPLING_COPROC in Kconfig.sysbuild")
+		endif()
+	endforeach()
+
+	ExternalZephyrProject_Add(
+		APPLICATION sampling_coproc
+		SOURCE_DIR ${APP_DIR}/coprocessor
+		BOARD ${SB_CONFIG_APP_SAMPLING_COPROC_BOARD}
+	)
+
+	set_config_bool(${DEFAULT_IMAGE} CONFIG_APP_SAMPLING_ACQUISITION_COPROC y)
+endif()
+
+# Sampling configuration derived from the generated model, see scripts/model_config.py
+if(SB_CONFIG_APP_MODEL_SAMPLING_CONFIG)
+	set(model_source ${APP_DIR}/modules/detection/nrf_edgeai_generated/nrf_edgeai_user_model.c)
+	set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${model_source})
+
+	execute_process(
+		COMMAND ${PYTHON_EXECUTABLE} ${APP_DIR}/scripts/model_config.py
+			-r ${SB_CONFIG_APP_MODEL_SAMPLE_RATE_HZ} ${model_source}
+		OUTPUT_VARIABLE model_config
+		RESULT_VARIABLE model_config_result
+	)
+	if(NOT model_config_result EQUAL 0)
+		message(FATAL_ERROR "scripts/model_config.py failed on ${model_source}")
+	endif()
+
+	string(REGEX MATCHALL "CONFIG_[A-Z0-9_]+=[^\n]*" model_options "${model_config}")
+	foreach(option ${model_options})
+		string(REGEX MATCH "^([^=]+)=(.*)$" _ ${option})
+		set(name ${CMAKE_MATCH_1})
+		set(value ${CMAKE_MATCH_2})
+		if(value MATCHES "^[yn]$")
+			set_config_bool(${DEFAULT_IMAGE} ${name} ${value})
+		else()
+			set_config_int(${DEFAULT_IMAGE} ${name} ${value})
+		endif()
+	endforeach()
+endif()
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * CPython module evaluating batches of windows with the firmware pipeline.
+ *
+ * evaluate() takes a C-contiguous 2-D float32 buffer, e.g. a NumPy array,
+ * with one window per row: WINDOW_SIZE samples of INPUTS interleaved input
+ * features, as the detection module feeds them. Every window runs through
+ * the same feature extraction, scaling and model as on the device, with the
+ * GIL released and no Python object per window. The results are float32 and
+ * uint16 memoryviews, which numpy.asarray() wraps without a copy:
+ *
+ *   import numpy as np, edgeai_host
+ *   features, probabilities, classes = edgeai_host.evaluate(windows)
+ *   features = np.asarray(features)   # (n, FEATURES) scaled model inputs
+ *
+ * The C kernels of the firmware run unless HOST_KERNELS selects SIMD ones,
+ * see host_kernels.h, so the results match the firmware bit for bit.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdlib.h>
+#include <string.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include "detection_user_model.h"
+#include "host_kernels.h"
+
+/* Dimensions of the model, read once at import */
+static uint16_t window_size;
+static uint16_t inputs_num;
+static uint16_t features_num;
+static uint16_t classes_num;
+
+/* 2-D memoryview of the rows x cols items of a bytearray */
+static PyObject *result_view(PyObject *array, const char *format, Py_ssize_t rows,
+			     Py_ssize_t cols)
+{
+	PyObject *view = PyMemoryView_FromObject(array);
+	PyObject *shaped;
+
+	if (view == NULL) {
+		return NULL;
+	}
+
+	shaped = (cols > 0) ? PyObject_CallMethod(view, "cast", "s(nn)", format, rows, cols)
+			    : PyObject_CallMethod(view, "cast", "s(n)", format, rows);
+	Py_DECREF(view);
+
+	return shaped;
+}
+
+/* Feed every window to its own instance and collect the results */
+static int evaluate_windows(nrf_edgeai_t *p_model, const float *p_windows, Py_ssize_t num,
+			    float *p_features, float *p_probabilities, uint16_t *p_classes)
+{
+	size_t window_len = (size_t)window_size * inputs_num;
+	float window[window_len];
+
+	for (Py_ssize_t w = 0; w < num; w++) {
+		nrf_edgeai_err_t res;
+
+		/* The feed may scale the inputs in place, the caller's buffer is read only */
+		memcpy(window, &p_windows[w * window_len], sizeof(window));
+
+		res = nrf_edgeai_input_setup_discrete_window(&p_model->input);
+		if (res == NRF_EDGEAI_ERR_SUCCESS) {
+			res = nrf_edgeai_feed_inputs(p_model, window, window_len);
+		}
+		if (res == NRF_EDGEAI_ERR_SUCCESS) {
+			res = nrf_edgeai_user_model_instance_run_inference(p_model);
+		}
+		if (res != NRF_EDGEAI_ERR_SUCCESS) {
+			return res;
+		}
+
+		memcpy(&p_features[w * features_num], p_model->p_dsp->features.extracted_memory.p_f32,
+		       features_num * sizeof(float));
+		memcpy(&p_probabilities[w * classes_num],
+		       nrf_edgeai_user_model_probabilities(p_model), classes_num * sizeof(float));
+		p_classes[w] = p_model->decoded_output.classif.predicted_class;
+	}
+
+	return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+static PyObject *evaluate(PyObject *self, PyObject *args)
+{
+	PyObject *windows;
+	PyObject *results[3] = { NULL };
+	PyObject *views[3] = { NULL };
+	PyObject *ret = NULL;
+	void *p_instance = NULL;
+	Py_buffer buf;
+	Py_ssize_t num;
+	int res = NRF_EDGEAI_ERR_SUCCESS;
+
+	if (!PyArg_ParseTuple(args, "O", &windows)) {
+		return NULL;
+	}
+
+	if (PyObject_GetBuffer(windows, &buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+		return NULL;
+	}
+
+	if (buf.ndim != 2 || buf.itemsize != sizeof(float) ||
+	    strchr("f", buf.format[strspn(buf.format, "@=<")]) == NULL ||
+	    buf.shape[1] != (Py_ssize_t)window_size * inputs_num) {
+		PyErr_Format(PyExc_ValueError, "expected float32 windows of shape (n, %u)",
+			     window_size * inputs_num);
+		goto out;
+	}
+
+	num = buf.shape[0];
+	results[0] = PyByteArray_FromStringAndSize(NULL, num * features_num * sizeof(float));
+	results[1] = PyByteArray_FromStringAndSize(NULL, num * classes_num * sizeof(float));
+	results[2] = PyByteArray_FromStringAndSize(NULL, num * sizeof(uint16_t));
+	p_instance = aligned_alloc(64, (nrf_edgeai_user_model_instance_size() + 63) / 64 * 64);
+	if (results[0] == NULL || results[1] == NULL || results[2] == NULL) {
+		goto out;
+	}
+	if (p_instance == NULL) {
+		PyErr_NoMemory();
+		goto out;
+	}
+
+	/* A fresh instance per call, so threads may evaluate at the same time */
+	Py_BEGIN_ALLOW_THREADS
+	res = evaluate_windows(nrf_edgeai_user_model_instance_init(p_instance), buf.buf, num,
+			       (float *)PyByteArray_AS_STRING(results[0]),
+			       (float *)PyByteArray_AS_STRING(results[1]),
+			       (uint16_t *)PyByteArray_AS_STRING(results[2]));
+	Py_END_ALLOW_THREADS
+
+	if (res != NRF_EDGEAI_ERR_SUCCESS) {
+		PyErr_Format(PyExc_RuntimeError, "inference failed: %d", res);
+		goto out;
+	}
+
+	views[0] = result_view(results[0], "f", num, features_num);
+	views[1] = result_view(results[1], "f", num, classes_num);
+	views[2] = result_view(results[2], "H", num, 0);
+	if (views[0] != NULL && views[1] != NULL && views[2] != NULL) {
+		ret = PyTuple_Pack(3, views[0], views[1], views[2]);
+	}
+
+out:
+	for (int i = 0; i < 3; i++) {
+		Py_XDECREF(views[i]);
+		Py_XDECREF(results[i]);
+	}
+	free(p_instance);
+	PyBuffer_Release(&buf);
+
+	return ret;
+}
+
+static PyMethodDef edgeai_host_methods[] = {
+	{ "evaluate", evaluate, METH_VARARGS,
+	  "evaluate(windows) -> (features, probabilities, classes)\n\n"
+	  "Run a C-contiguous float32 buffer of shape (n, WINDOW_SIZE * INPUTS)\n"
+	  "through the firmware pipeline. Returns memoryviews of the scaled\n"
+	  "features (n, FEATURES), the class probabilities (n, CLASSES) and the\n"
+	  "predicted classes (n,)." },
+	{ NULL, NULL, 0, NULL },
+};
+
+static struct PyModuleDef edgeai_host_module = {
+	PyModuleDef_HEAD_INIT,
+	.m_name = "edgeai_host",
+	.m_doc = "Batch evaluation of windows with the firmware pipeline",
+	.m_size = -1,
+	.m_methods = edgeai_host_methods,
+};
+
+PyMODINIT_FUNC PyInit_edgeai_host(void)
+{
+	nrf_edgeai_t *p_model = nrf_edgeai_user_model();
+	const char *kernels = "scalar";
+	PyObject *module;
+
+	/* Once, the setup writes the scaling tables all instances share */
+	if (nrf_edgeai_init(p_model) != NRF_EDGEAI_ERR_SUCCESS) {
+		PyErr_SetString(PyExc_ImportError, "failed to initialize EdgeAI");
+		return NULL;
+	}
+
+	if (getenv("HOST_KERNELS") != NULL) {
+		kernels = host_kernels_init();
+	}
+
+	window_size = nrf_edgeai_input_window_size(p_model);
+	inputs_num = nrf_edgeai_uniq_inputs_num(p_model);
+	features_num = p_model->p_dsp->features.overall_num;
+	classes_num = p_model->model.meta.outputs_num;
+
+	module = PyModule_Create(&edgeai_host_module);
+	if (module == NULL) {
+		return NULL;
+	}
+
+	if (PyModule_AddIntConstant(module, "WINDOW_SIZE", window_size) ||
+	    PyModule_AddIntConstant(module, "INPUTS", inputs_num) ||
+	    PyModule_AddIntConstant(module, "FEATURES", features_num) ||
+	    PyModule_AddIntConstant(module, "CLASSES", classes_num) ||
+	    PyModule_AddStringConstant(module, "KERNELS", kernels)) {
+		Py_DECREF(module);
+		return NULL;
+	}
+
+	return module;
+}
@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Replay a fleet of recorded IMU traces through the firmware pipeline on all
+ * cores.
+ *
+ * Every trace is fed to its own instance of the generated model the same way
+ * the detection module does, with the firmware class smoothing of
+ * detection_smoothing.c on the results. Traces are spread over a pool of
+ * worker threads, each with a deque of traces: a worker takes its own traces
+ * from the back and, once out of work, steals from the front of the others,
+ * so a few long traces do not leave the other cores idle.
+ *
+ * Inputs are CSV recordings or binary traces as read by host_replay, given on the command line
+ * or listed in a manifest of path,class lines with the true class of each
+ * trace. One CSV row per trace goes to stdout:
+ * trace,label,samples,windows,class,smoothed_class,accuracy,smoothed_accuracy
+ * with the majority classes of the trace. With labels, the confusion
+ * matrices of all windows before and after smoothing go to stderr along with
+ * the throughput.
+ *
+ * The DSP and model kernels are the AVX2 or NEON ones the CPU supports, the
+ * HOST_KERNELS environment variable restricts them, see host_kernels.h.
+ *
+ * Usage: host_fleet [-g accel_range_g] [-j threads] [-l manifest] [file.csv|file.imt...]
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <zephyr/sys/util.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include "detection_user_model.h"
+#include "detection_smoothing.h"
+#include "host_kernels.h"
+#include "trace.h"
+
+/* Magnitudes fed to the model per call, as a sampling FIFO batch would */
+#define FEED_BLOCK_SIZE 32
+
+/* Largest number of classes in the confusion matrices */
+#define FLEET_CLASSES_MAX DETECTION_SMOOTHING_CLASSES_MAX
+
+/* Trace without a known class */
+#define FLEET_LABEL_NONE -1
+
+struct fleet_trace {
+	const char *path;
+	int label;
+	/* Results, written by the worker that replayed the trace */
+	int error;
+	size_t samples;
+	unsigned long windows;
+	unsigned long class_windows[FLEET_CLASSES_MAX];
+	unsigned long smoothed_windows[FLEET_CLASSES_MAX];
+};
+
+struct fleet_worker {
+	pthread_t thread;
+	/* Deque of trace indices, the owner takes from the tail, thieves from the head */
+	pthread_mutex_t lock;
+	size_t *tasks;
+	size_t head;
+	size_t tail;
+	nrf_edgeai_user_model_instance_t *p_instance;
+	nrf_edgeai_t *p_model;
+	/* Windows by true class and predicted class */
+	unsigned long confusion[FLEET_CLASSES_MAX][FLEET_CLASSES_MAX];
+	unsigned long smoothed_confusion[FLEET_CLASSES_MAX][FLEET_CLASSES_MAX];
+	unsigned long undecided;
+	unsigned long stolen;
+};
+
+static struct fleet_trace *traces;
+static size_t traces_num;
+static struct fleet_worker *workers;
+static unsigned int workers_num;
+static float accel_range_g = 8.0f;
+static uint16_t classes_num;
+
+static bool deque_pop(struct fleet_worker *worker, size_t *task)
+{
+	bool found = false;
+
+	pthread_mutex_lock(&worker->lock);
+	if (worker->tail > worker->head) {
+		*task = worker->tasks[--worker->tail];
+		found = true;
+	}
+	pthread_mutex_unlock(&worker->lock);
+
+	return found;
+}
+
+static bool deque_steal(struct fleet_worker *victim, size_t *task)
+{
+	bool found = false;
+
+	pthread_mutex_lock(&victim->lock);
+	if (victim->tail > victim->head) {
+		*task = victim->tasks[victim->head++];
+		found = true;
+	}
+	pthread_mutex_unlock(&victim->lock);
+
+	return found;
+}
+
+/* Traces are never added once the workers run, so no work anywhere means done */
+static bool next_task(struct fleet_worker *worker, size_t *task)
+{
+	unsigned int self = worker - workers;
+
+	if (deque_pop(worker, task)) {
+		return true;
+	}
+
+	for (unsigned int i = 1; i < workers_num; i++) {
+		if (deque_steal(&workers[(self + i) % workers_num], task)) {
+			worker->stolen++;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void record_window(struct fleet_worker *worker, struct fleet_trace *trace,
+			  nrf_edgeai_t *p_model, struct detection_smoothing *p_smoothing)
+{
+	uint16_t predicted_class = p_model->decoded_output.classif.predicted_class;
+	const float *p_probabilities = nrf_edgeai_user_model_probabilities(p_model);
+	uint16_t smoothed_class;
+	float confidence;
+
+	smoothed_class = detection_smoothing_update(p_smoothing, p_probabilities, &confidence);
+
+	trace->windows++;
+	trace->class_windows[predicted_class]++;
+	if (smoothed_class != DETECTION_SMOOTHING_CLASS_NONE) {
+		trace->smoothed_windows[smoothed_class]++;
+	}
+
+	if (trace->label == FLEET_LABEL_NONE) {
+		return;
+	}
+
+	worker->confusion[trace->label][predicted_class]++;
+	if (smoothed_class != DETECTION_SMOOTHING_CLASS_NONE) {
+		worker->smoothed_confusion[trace->label][smoothed_class]++;
+	} else {
+		worker->undecided++;
+	}
+}
+
+/* Same splitting at window boundaries as feed_magnitudes() in the detection module */
+static int replay_trace(struct fleet_worker *worker, struct fleet_trace *trace,
+			const struct replay_input *input)
+{
+	struct detection_smoothing smoothing;
+	nrf_edgeai_t *p_model = worker->p_model;
+	uint16_t window_size = nrf_edgeai_input_window_size(p_model);
+	uint16_t window_fill = 0;
+	nrf_edgeai_err_t res;
+
+	/*
+	 * Every trace starts from an empty window. Only the window is reset,
+	 * nrf_edgeai_init() also rewrites the scaling tables all instances share.
+	 */
+	res = nrf_edgeai_input_setup_discrete_window(&p_model->input);
+	if (res != NRF_EDGEAI_ERR_SUCCESS) {
+		return -EIO;
+	}
+	(void)detection_smoothing_init(&smoothing, classes_num, NULL);
+
+	for (size_t i = 0; i < input->num;) {
+		float block[FEED_BLOCK_SIZE];
+		float *values = block;
+		uint16_t num = replay_read(input, i, block, FEED_BLOCK_SIZE);
+
+		i += num;
+
+		while (num > 0) {
+			uint16_t chunk = MIN(window_size - window_fill, num);
+
+			res = nrf_edgeai_feed_inputs(p_model, values, chunk);
+			if (res == NRF_EDGEAI_ERR_SUCCESS) {
+				window_fill = 0;
+				res = nrf_edgeai_user_model_instance_run_inference(p_model);
+				if (res != NRF_EDGEAI_ERR_SUCCESS) {
+					return -EIO;
+				}
+				record_window(worker, trace, p_model, &smoothing);
+			} else if (res == NRF_EDGEAI_ERR_INPROGRESS) {
+				window_fill += chunk;
+			} else {
+				return -EIO;
+			}
+
+			values += chunk;
+			num -= chunk;
+		}
+	}
+
+	return 0;
+}
+
+static void *worker_fn(void *arg)
+{
+	struct fleet_worker *worker = arg;
+	size_t task;
+
+	while (next_task(worker, &task)) {
+		struct fleet_trace *trace = &traces[task];
+		struct replay_input input = { 0 };
+
+		trace->error = replay_open(trace->path, accel_range_g, &input);
+		if (trace->error == 0) {
+			trace->samples = input.num;
+			trace->error = replay_trace(worker, trace, &input);
+		}
+
+		replay_input_free(&input);
+	}
+
+	return NULL;
+}
+
+static int trace_add(const char *path, int label)
+{
+	static size_t size;
+
+	if (traces_num == size) {
+		size_t new_size = size ? size * 2 : 256;
+		struct fleet_trace *p = realloc(traces, new_size * sizeof(*traces));
+
+		if (p == NULL) {
+			return -ENOMEM;
+		}
+
+		traces = p;
+		size = new_size;
+	}
+
+	traces[traces_num++] = (struct fleet_trace){
+		.path = path,
+		.label = label,
+	};
+
+	return 0;
+}
+
+/* Read the path,class lines of a manifest, the paths are kept for the whole run */
+static int read_manifest(const char *manifest)
+{
+	FILE *file = fopen(manifest, "r");
+	char line[1024];
+	int ret = 0;
+
+	if (file == NULL) {
+		return -errno;
+	}
+
+	while (ret == 0 && fgets(line, sizeof(line), file)) {
+		char *comma = strrchr(line, ',');
+		char *end;
+		long label;
+
+		line[strcspn(line, "\r\n")] = '\0';
+		if (comma == NULL || line[0] == '#') {
+			continue;
+		}
+
+		*comma = '\0';
+		label = strtol(comma + 1, &end, 0);
+		if (end == comma + 1 || label < 0 || label >= FLEET_CLASSES_MAX) {
+			/* Header line */
+			continue;
+		}
+
+		ret = trace_add(strdup(line), label);
+	}
+
+	fclose(file);
+	return ret;
+}
+
+static unsigned long majority(const unsigned long *windows, uint16_t num, int *p_class)
+{
+	unsigned long max = 0;
+
+	*p_class = -1;
+	for (uint16_t i = 0; i < num; i++) {
+		if (windows[i] > max) {
+			max = windows[i];
+			*p_class = i;
+		}
+	}
+
+	return max;
+}
+
+static void print_trace(const struct fleet_trace *trace)
+{
+	unsigned long smoothed = 0;
+	int predicted_class;
+	int smoothed_class;
+	double accuracy = 0.0;
+	double smoothed_accuracy = 0.0;
+
+	if (trace->error) {
+		fprintf(stderr, "%s: replay failed: %d\n", trace->path, trace->error);
+		return;
+	}
+
+	majority(trace->class_windows, classes_num, &predicted_class);
+	majority(trace->smoothed_windows, classes_num, &smoothed_class);
+
+	for (uint16_t i = 0; i < classes_num; i++) {
+		smoothed += trace->smoothed_windows[i];
+	}
+
+	if (trace->label != FLEET_LABEL_NONE && trace->windows > 0) {
+		accuracy = (double)trace->class_windows[trace->label] / trace->windows;
+		smoothed_accuracy = (double)trace->smoothed_windows[trace->label] / trace->windows;
+	}
+
+	printf("%s,%d,%zu,%lu,%d,%d,%.4f,%.4f\n", trace->path, trace->label, trace->samples,
+	       trace->windows, predicted_class, smoothed_class, accuracy, smoothed_accuracy);
+}
+
+static void print_confusion(const char *name, unsigned long (*confusion)[FLEET_CLASSES_MAX])
+{
+	unsigned long correct = 0;
+	unsigned long total = 0;
+
+	fprintf(stderr, "%s confusion, rows true class, columns predicted class\n", name);
+	for (uint16_t t = 0; t < classes_num; t++) {
+		fprintf(stderr, "%4u:", t);
+		for (uint16_t p = 0; p < classes_num; p++) {
+			fprintf(stderr, " %8lu", confusion[t][p]);
+			total += confusion[t][p];
+		}
+		correct += confusion[t][t];
+		fprintf(stderr, "\n");
+	}
+
+	fprintf(stderr, "%s accuracy %.4f over %lu windows\n", name,
+		total ? (double)correct / total : 0.0, total);
+}
+
+static double time_now_s(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long confusion[FLEET_CLASSES_MAX][FLEET_CLASSES_MAX] = { 0 };
+	unsigned long smoothed_confusion[FLEET_CLASSES_MAX][FLEET_CLASSES_MAX] = { 0 };
+	unsigned long undecided = 0;
+	unsigned long stolen = 0;
+	unsigned long windows = 0;
+	size_t samples = 0;
+	bool labeled = false;
+	const char *kernels;
+	nrf_edgeai_t *p_model;
+	double start;
+	double elapsed;
+	int opt;
+	int ret;
+
+	workers_num = sysconf(_SC_NPROCESSORS_ONLN);
+
+	while ((opt = getopt(argc, argv, "g:j:l:")) != -1) {
+		switch (opt) {
+		case 'g':
+			accel_range_g = strtof(optarg, NULL);
+			break;
+		case 'j':
+			workers_num = strtoul(optarg, NULL, 0);
+			break;
+		case 'l':
+			ret = read_manifest(optarg);
+			if (ret) {
+				fprintf(stderr, "%s: %s\n", optarg, strerror(-ret));
+				return EXIT_FAILURE;
+			}
+			break;
+		default:
+			fprintf(stderr,
+				"Usage: %s [-g accel_range_g] [-j threads] [-l manifest] [file.csv|file.imt...]\n",
+				argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	for (int i = optind; i < argc; i++) {
+		if (trace_add(argv[i], FLEET_LABEL_NONE)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (traces_num == 0) {
+		fprintf(stderr, "No traces\n");
+		return EXIT_FAILURE;
+	}
+
+	workers_num = MAX(1U, MIN(workers_num, traces_num));
+	kernels = host_kernels_init();
+
+	/* The shared model context tells the number of classes and inputs */
+	p_model = nrf_edgeai_user_model();
+	if (nrf_edgeai_init(p_model) != NRF_EDGEAI_ERR_SUCCESS) {
+		fprintf(stderr, "Failed to initialize EdgeAI\n");
+		return EXIT_FAILURE;
+	}
+
+	if (nrf_edgeai_uniq_inputs_num(p_model) != 1) {
+		fprintf(stderr, "Model expects %u input features, only the accel magnitude is fed\n",
+			nrf_edgeai_uniq_inputs_num(p_model));
+		return EXIT_FAILURE;
+	}
+
+	classes_num = p_model->model.meta.outputs_num;
+	if (classes_num > FLEET_CLASSES_MAX) {
+		fprintf(stderr, "Model has %u classes, at most %u are supported\n", classes_num,
+			FLEET_CLASSES_MAX);
+		return EXIT_FAILURE;
+	}
+
+	for (size_t i = 0; i < traces_num; i++) {
+		if (traces[i].label >= classes_num) {
+			fprintf(stderr, "%s: class %d out of range\n", traces[i].path,
+				traces[i].label);
+			return EXIT_FAILURE;
+		}
+		labeled |= traces[i].label != FLEET_LABEL_NONE;
+	}
+
+	workers = calloc(workers_num, sizeof(*workers));
+	if (workers == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	/* Deal the traces round robin, each worker starts on its own share */
+	for (unsigned int w = 0; w < workers_num; w++) {
+		struct fleet_worker *worker = &workers[w];
+		size_t instance_size = nrf_edgeai_user_model_instance_size();
+
+		pthread_mutex_init(&worker->lock, NULL);
+		worker->tasks = malloc((traces_num / workers_num + 1) * sizeof(size_t));
+		worker->p_instance = aligned_alloc(64, (instance_size + 63) / 64 * 64);
+		if (worker->tasks == NULL || worker->p_instance == NULL) {
+			return EXIT_FAILURE;
+		}
+
+		/* Before the workers start, the setup writes tables shared by all instances */
+		worker->p_model = nrf_edgeai_user_model_instance_init(worker->p_instance);
+		if (nrf_edgeai_init(worker->p_model) != NRF_EDGEAI_ERR_SUCCESS) {
+			fprintf(stderr, "Failed to initialize model instance\n");
+			return EXIT_FAILURE;
+		}
+
+		for (size_t i = w; i < traces_num; i += workers_num) {
+			worker->tasks[worker->tail++] = i;
+		}
+	}
+
+	start = time_now_s();
+
+	for (unsigned int w = 0; w < workers_num; w++) {
+		ret = pthread_create(&workers[w].thread, NULL, worker_fn, &workers[w]);
+		if (ret) {
+			fprintf(stderr, "Failed to start worker: %s\n", strerror(ret));
+			return EXIT_FAILURE;
+		}
+	}
+
+	for (unsigned int w = 0; w < workers_num; w++) {
+		struct fleet_worker *worker = &workers[w];
+
+		pthread_join(worker->thread, NULL);
+
+		for (uint16_t t = 0; t < classes_num; t++) {
+			for (uint16_t p = 0; p < classes_num; p++) {
+				confusion[t][p] += worker->confusion[t][p];
+				smoothed_confusion[t][p] += worker->smoothed_confusion[t][p];
+			}
+		}
+		undecided += worker->undecided;
+		stolen += worker->stolen;
+	}
+
+	elapsed = time_now_s() - start;
+
+	printf("trace,label,samples,windows,class,smoothed_class,accuracy,smoothed_accuracy\n");
+	for (size_t i = 0; i < traces_num; i++) {
+		print_trace(&traces[i]);
+		samples += traces[i].samples;
+		windows += traces[i].windows;
+	}
+
+	if (labeled) {
+		print_confusion("Window", confusion);
+		print_confusion("Smoothed", smoothed_confusion);
+		fprintf(stderr, "%lu labeled windows before the smoothing accepted a class\n",
+			undecided);
+	}
+
+	fprintf(stderr, "%zu traces, %zu samples, %lu windows in %.3f s on %u threads, "
+		"%lu traces stolen: %.0f samples/s, %s kernels\n", traces_num, samples, windows,
+		elapsed, workers_num, stolen, samples / elapsed, kernels);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,566 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * AVX2 and NEON versions of the hot kernels of the replay pipeline. The host
+ * build renames the C kernels of the firmware to *_scalar, the functions of
+ * the same name here call the ones selected by host_kernels_init().
+ *
+ * Elementwise kernels do the operations of the C kernels in the same order
+ * without fused multiply-adds, the whole host build has contraction off, so
+ * their results are the same bit for bit. Reductions keep one partial sum
+ * per lane and only differ from the C kernels in rounding. Minimum and
+ * maximum are exact, the mean crossings and the samples over the mean only
+ * change for samples within rounding of the mean.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+#include "app_dsp_features_inline.h"
+#include "app_nn.h"
+#include "host_kernels.h"
+
+/* C kernels of the firmware, renamed by the host build */
+void app_dsp_magnitude_f32_scalar(const float *p_xyz, uint16_t stride, uint16_t num,
+				  float scale, float *p_out);
+void app_dsp_scale_clip_f32_scalar(const struct app_dsp_scale *p_scale, const float *p_input,
+				   float *p_output);
+void app_dsp_stats_f32_scalar(const float *p_window, uint16_t num, uint32_t mask,
+			      struct app_dsp_stats *p_stats);
+uint16_t app_dsp_stats_features_f32_scalar(const struct app_dsp_stats *p_stats,
+					   const float *p_window, uint16_t num, uint32_t mask,
+					   float *p_features);
+float app_nn_packed_links_f32_scalar(const union app_nn_packed_word **pp, uint16_t num,
+				     const float *p_src, uint16_t bias_idx, float sum);
+
+static struct {
+	void (*magnitude_f32)(const float *p_xyz, uint16_t stride, uint16_t num, float scale,
+			      float *p_out);
+	void (*scale_clip_f32)(const struct app_dsp_scale *p_scale, const float *p_input,
+			       float *p_output);
+	void (*stats_f32)(const float *p_window, uint16_t num, uint32_t mask,
+			  struct app_dsp_stats *p_stats);
+	uint16_t (*stats_features_f32)(const struct app_dsp_stats *p_stats, const float *p_window,
+				       uint16_t num, uint32_t mask, float *p_features);
+	float (*packed_links_f32)(const union app_nn_packed_word **pp, uint16_t num,
+				  const float *p_src, uint16_t bias_idx, float sum);
+} kernels = {
+	.magnitude_f32 = app_dsp_magnitude_f32_scalar,
+	.scale_clip_f32 = app_dsp_scale_clip_f32_scalar,
+	.stats_f32 = app_dsp_stats_f32_scalar,
+	.stats_features_f32 = app_dsp_stats_features_f32_scalar,
+	.packed_links_f32 = app_nn_packed_links_f32_scalar,
+};
+
+/* Same as the C kernel, for the samples past the last full vector */
+static inline float scale_clip(const struct app_dsp_scale *p_scale, float x, uint16_t i)
+{
+	float y = (x - p_scale->p_min[i]) * p_scale->p_recip[i];
+
+	return (y < 0.0f) ? 0.0f : (y > 1.0f) ? 1.0f : y;
+}
+
+/* Statistics of the samples from start on, added to p_stats */
+static void stats_tail(const float *p_window, uint16_t start, uint16_t num, bool diffs,
+		       struct app_dsp_stats *p_stats)
+{
+	for (uint16_t i = start; i < num; i++) {
+		float x = p_window[i];
+		float rel = x - p_stats->offset;
+
+		p_stats->sum += rel;
+		p_stats->sum_sq += rel * rel;
+		p_stats->abs_sum += fabsf(x);
+		p_stats->min = fminf(p_stats->min, x);
+		p_stats->max = fmaxf(p_stats->max, x);
+
+		if (diffs && i > 0) {
+			float d1 = p_window[i - 1] - x;
+
+			p_stats->diff_abs_sum += fabsf(d1);
+			p_stats->diff_sq_sum += d1 * d1;
+
+			if (i > 1) {
+				float d2 = (p_window[i - 2] - p_window[i - 1]) - d1;
+
+				p_stats->diff2_sq_sum += d2 * d2;
+			}
+		}
+	}
+}
+
+/* Mean pass over the samples from start on, added to p_pass */
+static void mean_pass_tail(const float *p_window, uint16_t start, uint16_t num, float mean,
+			   bool prev_below, struct app_dsp_mean_pass *p_pass)
+{
+	for (uint16_t i = start; i < num; i++) {
+		float dev = p_window[i] - mean;
+		bool below = signbit(dev);
+
+		p_pass->mad_sum += fabsf(dev);
+		p_pass->over_mean += (dev > 0.0f);
+		p_pass->crossings += (below != prev_below);
+		prev_below = below;
+	}
+}
+
+#if defined(__x86_64__)
+#define AVX2 __attribute__((target("avx2")))
+
+AVX2 static inline float hsum_avx2(__m256 v)
+{
+	__m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+
+	return _mm_cvtss_f32(sum);
+}
+
+AVX2 static inline float hmin_avx2(__m256 v)
+{
+	__m128 min = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+	min = _mm_min_ps(min, _mm_movehl_ps(min, min));
+	min = _mm_min_ss(min, _mm_shuffle_ps(min, min, 1));
+
+	return _mm_cvtss_f32(min);
+}
+
+AVX2 static inline float hmax_avx2(__m256 v)
+{
+	__m128 max = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+	max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+	max = _mm_max_ss(max, _mm_shuffle_ps(max, max, 1));
+
+	return _mm_cvtss_f32(max);
+}
+
+AVX2 static void magnitude_f32_avx2(const float *p_xyz, uint16_t stride, uint16_t num,
+				    float scale, float *p_out)
+{
+	__m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+					     _mm256_set1_epi32(stride));
+	__m256 vscale = _mm256_set1_ps(scale);
+	uint16_t i = 0;
+
+	for (; i + 8 <= num; i += 8) {
+		const float *p = p_xyz + (size_t)i * stride;
+		__m256 x = _mm256_i32gather_ps(p, offsets, 4);
+		__m256 y = _mm256_i32gather_ps(p + 1, offsets, 4);
+		__m256 z = _mm256_i32gather_ps(p + 2, offsets, 4);
+		__m256 sum = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+					   _mm256_mul_ps(z, z));
+
+		_mm256_storeu_ps(&p_out[i], _mm256_mul_ps(_mm256_sqrt_ps(sum), vscale));
+	}
+
+	app_dsp_magnitude_f32_scalar(p_xyz + (size_t)i * stride, stride, num - i, scale,
+				     &p_out[i]);
+}
+
+AVX2 static void scale_clip_f32_avx2(const struct app_dsp_scale *p_scale, const float *p_input,
+				     float *p_output)
+{
+	__m256 zero = _mm256_setzero_ps();
+	__m256 one = _mm256_set1_ps(1.0f);
+	uint16_t i = 0;
+
+	for (; i + 8 <= p_scale->num; i += 8) {
+		__m256 y = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&p_input[i]),
+						       _mm256_loadu_ps(&p_scale->p_min[i])),
+					 _mm256_loadu_ps(&p_scale->p_recip[i]));
+
+		y = _mm256_blendv_ps(y, zero, _mm256_cmp_ps(y, zero, _CMP_LT_OQ));
+		y = _mm256_blendv_ps(y, one, _mm256_cmp_ps(y, one, _CMP_GT_OQ));
+		_mm256_storeu_ps(&p_output[i], y);
+	}
+
+	for (; i < p_scale->num; i++) {
+		p_output[i] = scale_clip(p_scale, p_input[i], i);
+	}
+}
+
+AVX2 static void stats_f32_avx2(const float *p_window, uint16_t num, uint32_t mask,
+				struct app_dsp_stats *p_stats)
+{
+	bool diffs = (mask & APP_DSP_DIFF_FEATURES) != 0;
+	__m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+	__m256 offset = _mm256_set1_ps(p_window[0]);
+	__m256 sum = _mm256_setzero_ps();
+	__m256 sum_sq = _mm256_setzero_ps();
+	__m256 abs_sum = _mm256_setzero_ps();
+	__m256 min = offset;
+	__m256 max = offset;
+	__m256 diff_abs_sum = _mm256_setzero_ps();
+	__m256 diff_sq_sum = _mm256_setzero_ps();
+	__m256 diff2_sq_sum = _mm256_setzero_ps();
+	uint16_t i = 2;
+
+	/* The first two samples have no second difference, the vectors start after them */
+	*p_stats = (struct app_dsp_stats){
+		.offset = p_window[0],
+		.min = p_window[0],
+		.max = p_window[0],
+	};
+	stats_tail(p_window, 0, MIN(num, 2), diffs, p_stats);
+
+	for (; i + 8 <= num; i += 8) {
+		__m256 x = _mm256_loadu_ps(&p_window[i]);
+		__m256 rel = _mm256_sub_ps(x, offset);
+
+		sum = _mm256_add_ps(sum, rel);
+		sum_sq = _mm256_add_ps(sum_sq, _mm256_mul_ps(rel, rel));
+		abs_sum = _mm256_add_ps(abs_sum, _mm256_and_ps(x, abs_mask));
+		min = _mm256_min_ps(min, x);
+		max = _mm256_max_ps(max, x);
+
+		if (diffs) {
+			__m256 prev = _mm256_loadu_ps(&p_window[i - 1]);
+			__m256 d1 = _mm256_sub_ps(prev, x);
+			__m256 d2 = _mm256_sub_ps(
+				_mm256_sub_ps(_mm256_loadu_ps(&p_window[i - 2]), prev), d1);
+
+			diff_abs_sum = _mm256_add_ps(diff_abs_sum, _mm256_and_ps(d1, abs_mask));
+			diff_sq_sum = _mm256_add_ps(diff_sq_sum, _mm256_mul_ps(d1, d1));
+			diff2_sq_sum = _mm256_add_ps(diff2_sq_sum, _mm256_mul_ps(d2, d2));
+		}
+	}
+
+	p_stats->sum += hsum_avx2(sum);
+	p_stats->sum_sq += hsum_avx2(sum_sq);
+	p_stats->abs_sum += hsum_avx2(abs_sum);
+	p_stats->min = fminf(p_stats->min, hmin_avx2(min));
+	p_stats->max = fmaxf(p_stats->max, hmax_avx2(max));
+	p_stats->diff_abs_sum += hsum_avx2(diff_abs_sum);
+	p_stats->diff_sq_sum += hsum_avx2(diff_sq_sum);
+	p_stats->diff2_sq_sum += hsum_avx2(diff2_sq_sum);
+
+	stats_tail(p_window, i, num, diffs, p_stats);
+}
+
+AVX2 static uint16_t stats_features_f32_avx2(const struct app_dsp_stats *p_stats,
+					     const float *p_window, uint16_t num, uint32_t mask,
+					     float *p_features)
+{
+	struct app_dsp_mean_pass pass = { 0 };
+
+	if (mask & APP_DSP_MEAN_PASS_FEATURES) {
+		float mean = app_dsp_stats_mean_inline_f32(p_stats, num);
+		__m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+		__m256 vmean = _mm256_set1_ps(mean);
+		__m256 zero = _mm256_setzero_ps();
+		__m256 mad_sum = _mm256_setzero_ps();
+		uint32_t prev_below = signbit(p_window[0] - mean) ? 1 : 0;
+		uint16_t i = 0;
+
+		for (; i + 8 <= num; i += 8) {
+			__m256 dev = _mm256_sub_ps(_mm256_loadu_ps(&p_window[i]), vmean);
+			/* Bit k is the sign of sample i + k, shifted in is the one before */
+			uint32_t below = _mm256_movemask_ps(dev);
+			uint32_t before = ((below << 1) | prev_below) & 0xff;
+
+			mad_sum = _mm256_add_ps(mad_sum, _mm256_and_ps(dev, abs_mask));
+			pass.over_mean += __builtin_popcount(
+				_mm256_movemask_ps(_mm256_cmp_ps(dev, zero, _CMP_GT_OQ)));
+			pass.crossings += __builtin_popcount(below ^ before);
+			prev_below = below >> 7;
+		}
+
+		pass.mad_sum = hsum_avx2(mad_sum);
+		mean_pass_tail(p_window, i, num, mean, prev_below, &pass);
+	}
+
+	return app_dsp_stats_emit_inline_f32(p_stats, &pass, num, mask, p_features);
+}
+
+/* Eight links per step, four index words and their eight weights gathered at once */
+AVX2 static float packed_links_f32_avx2(const union app_nn_packed_word **pp, uint16_t num,
+					const float *p_src, uint16_t bias_idx, float sum)
+{
+	const union app_nn_packed_word *p = *pp;
+	__m256i word_offsets = _mm256_setr_epi32(0, 0, 3, 3, 6, 6, 9, 9);
+	__m256i weight_offsets = _mm256_setr_epi32(1, 2, 4, 5, 7, 8, 10, 11);
+	__m256i shifts = _mm256_setr_epi32(0, 16, 0, 16, 0, 16, 0, 16);
+	__m256i low_half = _mm256_set1_epi32(UINT16_MAX);
+	__m256i bias = _mm256_set1_epi32(bias_idx);
+	__m256 one = _mm256_set1_ps(1.0f);
+	__m256 acc = _mm256_setzero_ps();
+	uint16_t i = 0;
+
+	for (; i + 8 <= num; i += 8, p += 12) {
+		__m256i words = _mm256_i32gather_epi32((const int *)p, word_offsets, 4);
+		__m256i idx = _mm256_and_si256(_mm256_srlv_epi32(words, shifts), low_half);
+		__m256 weights = _mm256_i32gather_ps((const float *)p, weight_offsets, 4);
+		__m256 in_src = _mm256_castsi256_ps(_mm256_cmpgt_epi32(bias, idx));
+		__m256 src = _mm256_mask_i32gather_ps(one, p_src, idx, in_src, 4);
+
+		acc = _mm256_add_ps(acc, _mm256_mul_ps(weights, src));
+	}
+
+	*pp = p;
+	sum += hsum_avx2(acc);
+
+	return app_nn_packed_links_f32_scalar(pp, num - i, p_src, bias_idx, sum);
+}
+#endif /* __x86_64__ */
+
+#if defined(__aarch64__)
+static void magnitude_f32_neon(const float *p_xyz, uint16_t stride, uint16_t num, float scale,
+			       float *p_out)
+{
+	uint16_t i = 0;
+
+	/* Packed XYZ deinterleaves in the load, other layouts take the C kernel */
+	if (stride == 3) {
+		for (; i + 4 <= num; i += 4) {
+			float32x4x3_t xyz = vld3q_f32(&p_xyz[i * 3]);
+			float32x4_t sum = vaddq_f32(vaddq_f32(vmulq_f32(xyz.val[0], xyz.val[0]),
+							      vmulq_f32(xyz.val[1], xyz.val[1])),
+						    vmulq_f32(xyz.val[2], xyz.val[2]));
+
+			vst1q_f32(&p_out[i], vmulq_n_f32(vsqrtq_f32(sum), scale));
+		}
+	}
+
+	app_dsp_magnitude_f32_scalar(p_xyz + (size_t)i * stride, stride, num - i, scale,
+				     &p_out[i]);
+}
+
+static void scale_clip_f32_neon(const struct app_dsp_scale *p_scale, const float *p_input,
+				float *p_output)
+{
+	float32x4_t zero = vdupq_n_f32(0.0f);
+	float32x4_t one = vdupq_n_f32(1.0f);
+	uint16_t i = 0;
+
+	for (; i + 4 <= p_scale->num; i += 4) {
+		float32x4_t y = vmulq_f32(vsubq_f32(vld1q_f32(&p_input[i]),
+						    vld1q_f32(&p_scale->p_min[i])),
+					  vld1q_f32(&p_scale->p_recip[i]));
+
+		y = vbslq_f32(vcltq_f32(y, zero), zero, y);
+		y = vbslq_f32(vcgtq_f32(y, one), one, y);
+		vst1q_f32(&p_output[i], y);
+	}
+
+	for (; i < p_scale->num; i++) {
+		p_output[i] = scale_clip(p_scale, p_input[i], i);
+	}
+}
+
+static void stats_f32_neon(const float *p_window, uint16_t num, uint32_t mask,
+			   struct app_dsp_stats *p_stats)
+{
+	bool diffs = (mask & APP_DSP_DIFF_FEATURES) != 0;
+	float32x4_t offset = vdupq_n_f32(p_window[0]);
+	float32x4_t sum = vdupq_n_f32(0.0f);
+	float32x4_t sum_sq = vdupq_n_f32(0.0f);
+	float32x4_t abs_sum = vdupq_n_f32(0.0f);
+	float32x4_t min = offset;
+	float32x4_t max = offset;
+	float32x4_t diff_abs_sum = vdupq_n_f32(0.0f);
+	float32x4_t diff_sq_sum = vdupq_n_f32(0.0f);
+	float32x4_t diff2_sq_sum = vdupq_n_f32(0.0f);
+	uint16_t i = 2;
+
+	/* The first two samples have no second difference, the vectors start after them */
+	*p_stats = (struct app_dsp_stats){
+		.offset = p_window[0],
+		.min = p_window[0],
+		.max = p_window[0],
+	};
+	stats_tail(p_window, 0, MIN(num, 2), diffs, p_stats);
+
+	for (; i + 4 <= num; i += 4) {
+		float32x4_t x = vld1q_f32(&p_window[i]);
+		float32x4_t rel = vsubq_f32(x, offset);
+
+		sum = vaddq_f32(sum, rel);
+		sum_sq = vaddq_f32(sum_sq, vmulq_f32(rel, rel));
+		abs_sum = vaddq_f32(abs_sum, vabsq_f32(x));
+		min = vminq_f32(min, x);
+		max = vmaxq_f32(max, x);
+
+		if (diffs) {
+			float32x4_t prev = vld1q_f32(&p_window[i - 1]);
+			float32x4_t d1 = vsubq_f32(prev, x);
+			float32x4_t d2 = vsubq_f32(vsubq_f32(vld1q_f32(&p_window[i - 2]), prev), d1);
+
+			diff_abs_sum = vaddq_f32(diff_abs_sum, vabsq_f32(d1));
+			diff_sq_sum = vaddq_f32(diff_sq_sum, vmulq_f32(d1, d1));
+			diff2_sq_sum = vaddq_f32(diff2_sq_sum, vmulq_f32(d2, d2));
+		}
+	}
+
+	p_stats->sum += vaddvq_f32(sum);
+	p_stats->sum_sq += vaddvq_f32(sum_sq);
+	p_stats->abs_sum += vaddvq_f32(abs_sum);
+	p_stats->min = fminf(p_stats->min, vminvq_f32(min));
+	p_stats->max = fmaxf(p_stats->max, vmaxvq_f32(max));
+	p_stats->diff_abs_sum += vaddvq_f32(diff_abs_sum);
+	p_stats->diff_sq_sum += vaddvq_f32(diff_sq_sum);
+	p_stats->diff2_sq_sum += vaddvq_f32(diff2_sq_sum);
+
+	stats_tail(p_window, i, num, diffs, p_stats);
+}
+
+static uint16_t stats_features_f32_neon(const struct app_dsp_stats *p_stats,
+					const float *p_window, uint16_t num, uint32_t mask,
+					float *p_features)
+{
+	struct app_dsp_mean_pass pass = { 0 };
+
+	if (mask & APP_DSP_MEAN_PASS_FEATURES) {
+		float mean = app_dsp_stats_mean_inline_f32(p_stats, num);
+		float32x4_t vmean = vdupq_n_f32(mean);
+		float32x4_t zero = vdupq_n_f32(0.0f);
+		float32x4_t mad_sum = vdupq_n_f32(0.0f);
+		uint32x4_t over_mean = vdupq_n_u32(0);
+		uint32x4_t crossings = vdupq_n_u32(0);
+		/* Sign of the sample before the vector in the last lane */
+		uint32x4_t prev_below = vdupq_n_u32(signbit(p_window[0] - mean) ? 1 : 0);
+		uint16_t i = 0;
+
+		for (; i + 4 <= num; i += 4) {
+			float32x4_t dev = vsubq_f32(vld1q_f32(&p_window[i]), vmean);
+			uint32x4_t below = vshrq_n_u32(vreinterpretq_u32_f32(dev), 31);
+
+			mad_sum = vaddq_f32(mad_sum, vabsq_f32(dev));
+			/* A true comparison is all ones, subtracting it counts one */
+			over_mean = vsubq_u32(over_mean, vcgtq_f32(dev, zero));
+			crossings = vaddq_u32(crossings,
+					      veorq_u32(below, vextq_u32(prev_below, below, 3)));
+			prev_below = below;
+		}
+
+		pass.mad_sum = vaddvq_f32(mad_sum);
+		pass.over_mean = vaddvq_u32(over_mean);
+		pass.crossings = vaddvq_u32(crossings);
+		mean_pass_tail(p_window, i, num, mean, vgetq_lane_u32(prev_below, 3), &pass);
+	}
+
+	return app_dsp_stats_emit_inline_f32(p_stats, &pass, num, mask, p_features);
+}
+
+/* Four links per step, NEON has no gather so the sources are loaded one by one */
+static float packed_links_f32_neon(const union app_nn_packed_word **pp, uint16_t num,
+				   const float *p_src, uint16_t bias_idx, float sum)
+{
+	const union app_nn_packed_word *p = *pp;
+	float32x4_t acc = vdupq_n_f32(0.0f);
+	uint16_t i = 0;
+
+	for (; i + 4 <= num; i += 4, p += 6) {
+		const uint16_t idx[4] = { p[0].u16[0], p[0].u16[1], p[3].u16[0], p[3].u16[1] };
+		const float weights[4] = { p[1].f32, p[2].f32, p[4].f32, p[5].f32 };
+		float src[4];
+
+		for (int k = 0; k < 4; k++) {
+			src[k] = (idx[k] < bias_idx) ? p_src[idx[k]] : 1.0f;
+		}
+
+		acc = vaddq_f32(acc, vmulq_f32(vld1q_f32(weights), vld1q_f32(src)));
+	}
+
+	*pp = p;
+	sum += vaddvq_f32(acc);
+
+	return app_nn_packed_links_f32_scalar(pp, num - i, p_src, bias_idx, sum);
+}
+#endif /* __aarch64__ */
+
+const char *host_kernels_init(void)
+{
+	const char *mode = getenv("HOST_KERNELS");
+	bool fast = true;
+
+	if (mode != NULL && strcmp(mode, "scalar") == 0) {
+		return "scalar";
+	}
+	if (mode != NULL && strcmp(mode, "exact") == 0) {
+		fast = false;
+	}
+
+#if defined(__x86_64__)
+	if (!__builtin_cpu_supports("avx2")) {
+		return "scalar";
+	}
+
+	kernels.magnitude_f32 = magnitude_f32_avx2;
+	kernels.scale_clip_f32 = scale_clip_f32_avx2;
+	if (fast) {
+		kernels.stats_f32 = stats_f32_avx2;
+		kernels.stats_features_f32 = stats_features_f32_avx2;
+		kernels.packed_links_f32 = packed_links_f32_avx2;
+	}
+
+	return fast ? "avx2 fast" : "avx2 exact";
+#elif defined(__aarch64__)
+	/* Advanced SIMD is part of the ARMv8-A baseline */
+	kernels.magnitude_f32 = magnitude_f32_neon;
+	kernels.scale_clip_f32 = scale_clip_f32_neon;
+	if (fast) {
+		kernels.stats_f32 = stats_f32_neon;
+		kernels.stats_features_f32 = stats_features_f32_neon;
+		kernels.packed_links_f32 = packed_links_f32_neon;
+	}
+
+	return fast ? "neon fast" : "neon exact";
+#else
+	return "scalar";
+#endif
+}
+
+void app_dsp_magnitude_f32(const float *p_xyz, uint16_t stride, uint16_t num, float scale,
+			   float *p_out)
+{
+	kernels.magnitude_f32(p_xyz, stride, num, scale, p_out);
+}
+
+void app_dsp_scale_clip_f32(const struct app_dsp_scale *p_scale, const float *p_input,
+			    float *p_output)
+{
+	kernels.scale_clip_f32(p_scale, p_input, p_output);
+}
+
+void app_dsp_stats_f32(const float *p_window, uint16_t num, uint32_t mask,
+		       struct app_dsp_stats *p_stats)
+{
+	kernels.stats_f32(p_window, num, mask, p_stats);
+}
+
+uint16_t app_dsp_stats_features_f32(const struct app_dsp_stats *p_stats, const float *p_window,
+				    uint16_t num, uint32_t mask, float *p_features)
+{
+	return kernels.stats_features_f32(p_stats, p_window, num, mask, p_features);
+}
+
+uint16_t app_dsp_features_f32(const float *p_window, uint16_t num, uint32_t mask,
+			      float *p_features)
+{
+	struct app_dsp_stats stats;
+
+	kernels.stats_f32(p_window, num, mask, &stats);
+
+	return kernels.stats_features_f32(&stats, p_window, num, mask, p_features);
+}
+
+float app_nn_packed_links_f32(const union app_nn_packed_word **pp, uint16_t num,
+			      const float *p_src, uint16_t bias_idx, float sum)
+{
+	return kernels.packed_links_f32(pp, num, p_src, bias_idx, sum);
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* SIMD kernels of the host tools, selected at run time */
+
+#ifndef _HOST_KERNELS_H_
+#define _HOST_KERNELS_H_
+
+/**
+ * @brief Select the kernels for the CPU
+ *
+ * Picks AVX2 kernels on x86-64 CPUs that have it and NEON kernels on ARM64,
+ * the C kernels of the firmware otherwise. The HOST_KERNELS environment
+ * variable narrows the choice:
+ *
+ * - fast, the default: all SIMD kernels. The window sums and the link sums
+ *   of the model are added in a different order, so features and outputs
+ *   may differ from the firmware in the last bits, and samples within
+ *   rounding of the window mean may count on the other side of it.
+ * - exact: only the SIMD kernels whose results are bit for bit the ones of
+ *   the C kernels, the magnitudes and the feature scaling.
+ * - scalar: the C kernels only.
+ *
+ * The C kernels run until this is called. Call before any thread uses them.
+ *
+ * @return Description of the selected kernels, e.g. "avx2 fast"
+ */
+const char *host_kernels_init(void);
+
+#endif /* _HOST_KERNELS_H_ */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Host implementation of the runtime entry points the generated model still
+ * uses with the specialized DSP pipeline and the packed model. The runtime
+ * is only shipped prebuilt for Cortex-M, these follow its behavior for
+ * discrete input windows and f32 classification outputs.
+ */
+
+#include <float.h>
+#include <stdint.h>
+#include <string.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+
+/* Runtime version the generated model was built against */
+#define HOST_RUNTIME_VERSION_MAJOR 1
+
+nrf_edgeai_err_t nrf_edgeai_init(nrf_edgeai_t *p_edgeai)
+{
+	if (p_edgeai == NULL) {
+		return NRF_EDGEAI_ERR_NULL_ARGUMENT;
+	}
+
+	if (p_edgeai->interfaces.input_setup == NULL) {
+		return NRF_EDGEAI_ERR_INVALID_ARGUMENT;
+	}
+
+	if (p_edgeai->metadata.version.field.major != HOST_RUNTIME_VERSION_MAJOR) {
+		return NRF_EDGEAI_ERR_INCOMPATIBLE;
+	}
+
+	return p_edgeai->interfaces.input_setup(&p_edgeai->input);
+}
+
+nrf_edgeai_err_t nrf_edgeai_feed_inputs(nrf_edgeai_t *p_edgeai, void *p_input_values,
+					uint16_t num_values)
+{
+	if (p_edgeai == NULL || p_input_values == NULL) {
+		return NRF_EDGEAI_ERR_NULL_ARGUMENT;
+	}
+
+	if (num_values == 0 || num_values < p_edgeai->input.unique_num) {
+		return NRF_EDGEAI_ERR_INVALID_ARGUMENT;
+	}
+
+	return p_edgeai->interfaces.feed_inputs(&p_edgeai->input, p_input_values, num_values);
+}
+
+nrf_edgeai_input_type_t nrf_edgeai_input_type(const nrf_edgeai_t *p_edgeai)
+{
+	return p_edgeai->input.type;
+}
+
+uint16_t nrf_edgeai_uniq_inputs_num(const nrf_edgeai_t *p_edgeai)
+{
+	return p_edgeai->input.unique_num;
+}
+
+uint16_t nrf_edgeai_input_window_size(const nrf_edgeai_t *p_edgeai)
+{
+	return p_edgeai->input.window_size;
+}
+
+nrf_edgeai_err_t nrf_edgeai_input_setup_discrete_window(nrf_edgeai_input_t *p_input_ctx)
+{
+	nrf_dsp_window_flatten_t *p_window = &p_input_ctx->p_window_ctx->discrete;
+
+	if (p_input_ctx->window_memory.p_void == NULL || p_input_ctx->window_size < 2 ||
+	    p_input_ctx->unique_num == 0) {
+		return NRF_EDGEAI_ERR_INVALID_ARGUMENT;
+	}
+
+	p_window->p_window.generic = p_input_ctx->window_memory.p_void;
+	p_window->max_samples_num = p_input_ctx->window_size;
+	p_window->current_sample = 0;
+	p_window->uniq_features_num = p_input_ctx->unique_num;
+	p_window->uniq_features_collected = p_input_ctx->unique_num;
+
+	return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+nrf_edgeai_err_t nrf_edgeai_input_feed_discrete_window_f32(nrf_edgeai_input_t *p_input_ctx,
+							   void *p_input_values,
+							   uint16_t num_values)
+{
+	nrf_dsp_window_flatten_t *p_window = &p_input_ctx->p_window_ctx->discrete;
+	const flt32_t *p_input = p_input_values;
+	uint16_t features = p_window->uniq_features_num;
+	uint16_t size = p_window->max_samples_num;
+	uint16_t num = num_values / features;
+	uint16_t end;
+
+	if ((uintptr_t)p_input_values % sizeof(flt32_t)) {
+		return NRF_EDGEAI_ERR_WRONG_MEM_ALIGNMENT;
+	}
+
+	/* Samples beyond the end of the window are dropped */
+	end = p_window->current_sample + num;
+	if (end > size) {
+		end = size;
+	}
+
+	/* The window is stored by columns, window_size samples of each feature */
+	for (uint16_t s = p_window->current_sample; s < end; s++) {
+		for (uint16_t f = 0; f < features; f++) {
+			p_window->p_window.f32[f * size + s] = *p_input++;
+		}
+	}
+
+	if (end < size) {
+		p_window->current_sample = end;
+		return NRF_EDGEAI_ERR_INPROGRESS;
+	}
+
+	p_window->current_sample = 0;
+	return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+void nrf_edgeai_output_propagate_f32(nrf_edgeai_model_t *p_model)
+{
+	const uint16_t *p_indices = p_model->meta.p_output_neurons_indices;
+
+	for (uint16_t i = 0; i < p_model->output.num; i++) {
+		p_model->output.memory.p_f32[i] = p_model->params.f32.p_neurons[p_indices[i]];
+	}
+}
+
+void nrf_edgeai_output_decode_classification_f32(nrf_edgeai_model_output_t *p_model_output,
+						 nrf_edgeai_decoded_output_t *p_decoded_output)
+{
+	flt32_t *p_outputs = p_model_output->memory.p_f32;
+	uint16_t num = p_model_output->num;
+	uint16_t predicted_class = 0;
+	flt32_t sum = 0.0f;
+	flt32_t max = 0.0f;
+
+	for (uint16_t i = 0; i < num; i++) {
+		sum += p_outputs[i];
+	}
+
+	/* Normalize to probabilities, all zero if the outputs vanish */
+	if (sum > FLT_EPSILON) {
+		for (uint16_t i = 0; i < num; i++) {
+			p_outputs[i] /= sum;
+		}
+	} else {
+		memset(p_outputs, 0, num * sizeof(flt32_t));
+	}
+
+	for (uint16_t i = 0; i < num; i++) {
+		if (p_outputs[i] > max) {
+			max = p_outputs[i];
+			predicted_class = i;
+		}
+	}
+
+	p_decoded_output->classif.predicted_class = predicted_class;
+	p_decoded_output->classif.num_classes = num;
+	p_decoded_output->classif.probabilities.p_f32 = p_outputs;
+}
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Host stand-in for the Zephyr kernel header, as far as the app modules need it */
+
+#ifndef _HOST_ZEPHYR_KERNEL_H_
+#define _HOST_ZEPHYR_KERNEL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#endif /* _HOST_ZEPHYR_KERNEL_H_ */
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Host stand-in for the Zephyr utility macros used by the app libraries */
+
+#ifndef _HOST_ZEPHYR_SYS_UTIL_H_
+#define _HOST_ZEPHYR_SYS_UTIL_H_
+
+#include <zephyr/toolchain.h>
+
+#define BIT(n) (1UL << (n))
+#define BIT_MASK(n) (BIT(n) - 1UL)
+#define ARG_UNUSED(x) (void)(x)
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define CLAMP(val, low, high) (((val) <= (low)) ? (low) : MIN(val, high))
+#define ROUND_UP(x, align) ((((x) + (align) - 1) / (align)) * (align))
+
+#endif /* _HOST_ZEPHYR_SYS_UTIL_H_ */
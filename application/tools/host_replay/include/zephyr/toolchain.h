@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Host stand-in for the Zephyr toolchain macros used by the app libraries */
+
+#ifndef _HOST_ZEPHYR_TOOLCHAIN_H_
+#define _HOST_ZEPHYR_TOOLCHAIN_H_
+
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+
+#define BUILD_ASSERT(cond, msg) _Static_assert(cond, msg)
+
+#endif /* _HOST_ZEPHYR_TOOLCHAIN_H_ */
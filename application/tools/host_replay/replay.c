@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Replay recorded IMU samples through the generated model on the host.
+ *
+ * Reads the CSV printed by the sampling module (accel and gyro in m/s^2 and
+ * rad/s), the CSV written by scripts/stream_capture.py (sequence number,
+ * timestamp, then sensor counts) or a binary trace written by
+ * scripts/imu_trace.py, which is mapped instead of parsed, and feeds the
+ * acceleration magnitudes to nrf_edgeai_user_model() the same way the
+ * detection module does. One row window,class,confidence is printed per
+ * inference, the throughput goes to stderr.
+ *
+ * The DSP and model kernels are the AVX2 or NEON ones the CPU supports, the
+ * HOST_KERNELS environment variable restricts them, see host_kernels.h.
+ *
+ * Usage: host_replay [-g accel_range_g] [-n repeat] [-q] [file.csv|file.imt]
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+#include "detection_user_model.h"
+#include "host_kernels.h"
+#include "trace.h"
+
+/* Magnitudes fed to the model per call, as a sampling FIFO batch would */
+#define FEED_BLOCK_SIZE 32
+
+static nrf_edgeai_t *p_model;
+static uint16_t window_size;
+static uint16_t window_fill;
+static unsigned long windows;
+static bool print_windows = true;
+
+static void run_inference(void)
+{
+	nrf_edgeai_err_t res = nrf_edgeai_user_model_run_inference();
+
+	if (res != NRF_EDGEAI_ERR_SUCCESS) {
+		fprintf(stderr, "Inference failed: %d\n", res);
+		return;
+	}
+
+	if (print_windows) {
+		uint16_t predicted_class = p_model->decoded_output.classif.predicted_class;
+		const float *p_probabilities = nrf_edgeai_user_model_probabilities(p_model);
+
+		printf("%lu,%u,%f\n", windows, predicted_class, p_probabilities[predicted_class]);
+	}
+
+	windows++;
+}
+
+/* Same splitting at window boundaries as feed_magnitudes() in the detection module */
+static int feed_magnitudes(float *values, uint16_t num)
+{
+	nrf_edgeai_err_t res;
+
+	while (num > 0) {
+		uint16_t chunk = window_size - window_fill;
+
+		if (chunk > num) {
+			chunk = num;
+		}
+
+		res = nrf_edgeai_feed_inputs(p_model, values, chunk);
+
+		if (res == NRF_EDGEAI_ERR_SUCCESS) {
+			window_fill = 0;
+			run_inference();
+		} else if (res == NRF_EDGEAI_ERR_INPROGRESS) {
+			window_fill += chunk;
+		} else {
+			fprintf(stderr, "Failed to feed input: %d\n", res);
+			return -EIO;
+		}
+
+		values += chunk;
+		num -= chunk;
+	}
+
+	return 0;
+}
+
+static double time_now_s(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+	struct replay_input input = { 0 };
+	float accel_range_g = 8.0f;
+	unsigned long repeat = 1;
+	float values[FEED_BLOCK_SIZE];
+	const char *kernels;
+	nrf_edgeai_err_t res;
+	double start;
+	double elapsed;
+	int opt;
+	int ret;
+
+	while ((opt = getopt(argc, argv, "g:n:q")) != -1) {
+		switch (opt) {
+		case 'g':
+			accel_range_g = strtof(optarg, NULL);
+			break;
+		case 'n':
+			repeat = strtoul(optarg, NULL, 0);
+			break;
+		case 'q':
+			print_windows = false;
+			break;
+		default:
+			fprintf(stderr,
+				"Usage: %s [-g accel_range_g] [-n repeat] [-q] [file.csv|file.imt]\n",
+				argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	kernels = host_kernels_init();
+
+	if (optind < argc) {
+		ret = replay_open(argv[optind], accel_range_g, &input);
+	} else {
+		ret = replay_read_csv(stdin, accel_range_g, &input);
+	}
+	if (ret) {
+		fprintf(stderr, "Failed to read samples: %d\n", ret);
+		return EXIT_FAILURE;
+	}
+
+	p_model = nrf_edgeai_user_model();
+	res = nrf_edgeai_init(p_model);
+	if (res != NRF_EDGEAI_ERR_SUCCESS) {
+		fprintf(stderr, "Failed to initialize EdgeAI: %d\n", res);
+		return EXIT_FAILURE;
+	}
+
+	if (nrf_edgeai_uniq_inputs_num(p_model) != 1) {
+		fprintf(stderr, "Model expects %u input features, only the accel magnitude is fed\n",
+			nrf_edgeai_uniq_inputs_num(p_model));
+		return EXIT_FAILURE;
+	}
+
+	window_size = nrf_edgeai_input_window_size(p_model);
+
+	if (print_windows) {
+		printf("window,class,confidence\n");
+	}
+
+	start = time_now_s();
+
+	for (unsigned long r = 0; r < repeat; r++) {
+		size_t num;
+
+		for (size_t i = 0; i < input.num; i += num) {
+			num = replay_read(&input, i, values, FEED_BLOCK_SIZE);
+
+			if (feed_magnitudes(values, num)) {
+				return EXIT_FAILURE;
+			}
+		}
+
+		/* Only the first pass is printed, the others are for timing */
+		print_windows = false;
+	}
+
+	elapsed = time_now_s() - start;
+
+	fprintf(stderr,
+		"%zu samples x %lu, %lu windows in %.3f s: %.0f samples/s, %.0f ns/window, "
+		"%s kernels\n", input.num, repeat, windows, elapsed, input.num * repeat / elapsed,
+		windows ? elapsed * 1e9 / windows : 0.0, kernels);
+
+	replay_input_free(&input);
+	return EXIT_SUCCESS;
+}
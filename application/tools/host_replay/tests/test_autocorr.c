@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Autocorrelation against a double precision one, on the direct sums and on
+ * the FFT path, with its FFT lengths, a constant window and invalid lags.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_dsp.h"
+
+#define NUM_MAX 200
+
+APP_DSP_AUTOCORR_DEFINE(short_lags, 50, 3);
+APP_DSP_AUTOCORR_DEFINE(long_lags, 200, 100);
+APP_DSP_AUTOCORR_DEFINE(all_lags, 64, 63);
+static struct app_dsp_autocorr no_buffers = { .num = 200, .max_lag = 100 };
+
+/**
+ * @brief Compare the autocorrelation of a window with doubles
+ * @return Number of mismatching lags
+ */
+static int check_autocorr(const char *name, const struct app_dsp_autocorr *p_autocorr,
+			  const float *p_input)
+{
+	float output[NUM_MAX];
+	double mean = 0.0, var = 0.0;
+	int failures = 0;
+
+	app_dsp_autocorr_f32(p_autocorr, p_input, output);
+
+	for (int i = 0; i < p_autocorr->num; i++) {
+		mean += p_input[i];
+	}
+	mean /= p_autocorr->num;
+	for (int i = 0; i < p_autocorr->num; i++) {
+		var += (p_input[i] - mean) * (p_input[i] - mean);
+	}
+	var /= p_autocorr->num;
+
+	for (int k = 0; k <= p_autocorr->max_lag; k++) {
+		double acc = 0.0;
+
+		for (int i = 0; i + k < p_autocorr->num; i++) {
+			acc += (p_input[i] - mean) * (p_input[i + k] - mean);
+		}
+		acc /= (p_autocorr->num - k) * var;
+
+		if (fabs(output[k] - acc) > 1e-4) {
+			fprintf(stderr, "%s lag %d: %f, expected %f\n", name, k, output[k], acc);
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	static float input[NUM_MAX];
+	static struct app_dsp_autocorr *const configs[] = {
+		&short_lags, &long_lags, &all_lags, &no_buffers,
+	};
+	static const char *const names[] = { "Short lags", "Long lags", "All lags", "No buffers" };
+	struct app_dsp_autocorr invalid = { .num = 50, .max_lag = 50 };
+	int failures = 0;
+
+	srand(1);
+	for (int i = 0; i < NUM_MAX; i++) {
+		input[i] = 1000.0f + 300.0f * sinf(2.0f * (float)M_PI * i / 25.0f) +
+			   (float)(rand() % 2001 - 1000) / 10.0f;
+	}
+
+	for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+		uint16_t num = configs[c]->num, max_lag = configs[c]->max_lag;
+		uint16_t len = app_dsp_autocorr_fft_len(num, max_lag);
+
+		if (app_dsp_autocorr_init_f32(configs[c])) {
+			fprintf(stderr, "%s: not initialized\n", names[c]);
+			failures++;
+			continue;
+		}
+		if (len < num + max_lag || len % 2 != 0 ||
+		    len > APP_DSP_AUTOCORR_FFT_LEN_MAX(num, max_lag)) {
+			fprintf(stderr, "%s: FFT length %u\n", names[c], len);
+			failures++;
+		}
+		failures += check_autocorr(names[c], configs[c], input);
+	}
+
+	/* Both paths covered: the short lags are cheaper summed, the long ones by FFT */
+	if (short_lags.use_fft || !long_lags.use_fft || no_buffers.use_fft) {
+		fprintf(stderr, "Paths: short %d, long %d, no buffers %d\n", short_lags.use_fft,
+			long_lags.use_fft, no_buffers.use_fft);
+		failures++;
+	}
+
+	for (int i = 0; i < NUM_MAX; i++) {
+		input[i] = 1000.0f;
+	}
+	for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+		float output[NUM_MAX];
+
+		app_dsp_autocorr_f32(configs[c], input, output);
+		for (int k = 0; k <= configs[c]->max_lag; k++) {
+			if (output[k] != 0.0f) {
+				fprintf(stderr, "%s constant lag %d: %f\n", names[c], k, output[k]);
+				failures++;
+			}
+		}
+	}
+
+	if (app_dsp_autocorr_init_f32(&invalid) != -EINVAL) {
+		fprintf(stderr, "Lag of the window length accepted\n");
+		failures++;
+	}
+
+	return failures ? 1 : 0;
+}
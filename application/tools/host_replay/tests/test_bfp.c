@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Block floating point spectrum against a double precision one, for loud,
+ * quiet and silent inputs, with its centroid, spread and the peak height
+ * handed to nrf_dsp_findpeaks_i16(). The runtime peak finder is only shipped
+ * for Cortex-M, the stand-in below records the height it is called with.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/sys/util.h>
+#include <nrf_edgeai/dsp/spectral/nrf_dsp_findpeaks.h>
+#include "app_dsp.h"
+
+#define LEN 64
+#define NUM (LEN / 2 + 1)
+#define FRACT_BITS 3
+
+static int16_t findpeaks_height;
+
+void nrf_dsp_findpeaks_i16(int16_t p_input[], uint16_t num, int16_t min_peak_height,
+			   uint16_t min_peak_distance, int16_t p_peaks[], uint16_t peaks_num)
+{
+	findpeaks_height = min_peak_height;
+
+	for (uint16_t i = 0; i < peaks_num; i++) {
+		p_peaks[i] = -1;
+	}
+}
+
+/**
+ * @brief Compare the spectrum of Hartley coefficients of a given range with doubles
+ * @return Number of mismatches
+ */
+static int check_spectrum(const char *name, int range)
+{
+	int16_t fht[LEN];
+	int16_t amplitude[NUM];
+	struct app_dsp_bfp_spectrum spectrum = { .p_amplitude = amplitude };
+	double weighted = 0.0, sum = 0.0, spread = 0.0, centroid;
+	int16_t max_mantissa = 0;
+	int16_t peaks[2];
+	int failures = 0;
+
+	for (int i = 0; i < LEN; i++) {
+		fht[i] = (range != 0) ? (int16_t)(rand() % (2 * range + 1) - range) : 0;
+	}
+
+	app_dsp_bfp_spectrum_i16(fht, LEN, FRACT_BITS, &spectrum);
+	if (spectrum.num != NUM) {
+		fprintf(stderr, "%s: %u bins\n", name, spectrum.num);
+		return 1;
+	}
+
+	for (int k = 0; k < NUM; k++) {
+		double h1 = fht[k], h2 = fht[(LEN - k) % LEN];
+		double expected = sqrt((h1 * h1 + h2 * h2) / 2.0) / (1 << FRACT_BITS);
+		double unit = ldexp(1.0, spectrum.exponent);
+
+		/* The integer root truncates to the mantissa below */
+		if (fabs(amplitude[k] * unit - expected) > unit) {
+			fprintf(stderr, "%s bin %d: %f, expected %f\n", name, k,
+				amplitude[k] * unit, expected);
+			failures++;
+		}
+		max_mantissa = (amplitude[k] > max_mantissa) ? amplitude[k] : max_mantissa;
+		weighted += (double)k * amplitude[k];
+		sum += amplitude[k];
+	}
+
+	if (range == 0) {
+		if (app_dsp_bfp_centroid_q16(&spectrum) != 0 ||
+		    app_dsp_bfp_spread_q16(&spectrum, 0) != 0) {
+			fprintf(stderr, "%s: centroid or spread of an empty spectrum\n", name);
+			failures++;
+		}
+		return failures;
+	}
+
+	/* Normalized to use the full int16 range, up to the 15 bit shift */
+	if (max_mantissa < INT16_MAX / 2 && spectrum.exponent > -(FRACT_BITS + 15)) {
+		fprintf(stderr, "%s: largest mantissa %d, exponent %d\n", name, max_mantissa,
+			spectrum.exponent);
+		failures++;
+	}
+
+	centroid = weighted / sum;
+	for (int k = 0; k < NUM; k++) {
+		spread += (k - centroid) * (k - centroid) * amplitude[k];
+	}
+	spread = sqrt(spread / sum);
+
+	uint32_t centroid_q16 = app_dsp_bfp_centroid_q16(&spectrum);
+	uint32_t spread_q16 = app_dsp_bfp_spread_q16(&spectrum, centroid_q16);
+
+	if (fabs(centroid_q16 / 65536.0 - centroid) > 2.0 / 65536.0 ||
+	    fabs(spread_q16 / 65536.0 - spread) > 1e-3 * NUM) {
+		fprintf(stderr, "%s: centroid %f, spread %f, expected %f, %f\n", name,
+			centroid_q16 / 65536.0, spread_q16 / 65536.0, centroid, spread);
+		failures++;
+	}
+
+	/* A quarter of the largest amplitude, in input units, to the block exponent */
+	double height = max_mantissa * ldexp(1.0, spectrum.exponent) / 4.0;
+
+	app_dsp_bfp_findpeaks_i16(&spectrum, (uint32_t)(height * 65536.0), 1, peaks,
+				  ARRAY_SIZE(peaks));
+	if (abs(findpeaks_height - max_mantissa / 4) > 1) {
+		fprintf(stderr, "%s: peak height %d, expected %d\n", name, findpeaks_height,
+			max_mantissa / 4);
+		failures++;
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	srand(1);
+	failures += check_spectrum("Loud", INT16_MAX);
+	failures += check_spectrum("Moderate", 1000);
+	failures += check_spectrum("Quiet", 3);
+	failures += check_spectrum("Silent", 0);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * One-pass crossing rates against crossings counted one reference at a
+ * time in double precision, float and int16, contiguous and strided, with
+ * partial masks, a sigma level above the int16 range and short windows.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#define NUM 201
+#define THRESHOLD 200
+#define ALL_RATES BIT_MASK(APP_DSP_CROSSING_NUM)
+
+/**
+ * @brief Count the crossings of each reference in double precision
+ * @param p_counts APP_DSP_CROSSING_NUM crossing counts
+ */
+static void crossings_reference(const double *p_input, int num, double threshold,
+				nrf_dsp_sigma_factor_t sigma_factor, int *p_counts)
+{
+	double mean = 0.0, var = 0.0;
+	double refs[APP_DSP_CROSSING_NUM];
+
+	for (int i = 0; i < num; i++) {
+		mean += p_input[i];
+	}
+	mean /= num;
+	for (int i = 0; i < num; i++) {
+		var += (p_input[i] - mean) * (p_input[i] - mean);
+	}
+	var /= num;
+
+	refs[APP_DSP_CROSSING_ZERO] = 0.0;
+	refs[APP_DSP_CROSSING_MEAN] = mean;
+	refs[APP_DSP_CROSSING_THRESHOLD] = threshold;
+	refs[APP_DSP_CROSSING_SIGMA] = mean + sigma_factor * sqrt(var);
+
+	for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+		p_counts[k] = 0;
+		for (int i = 1; i < num; i++) {
+			p_counts[k] += (p_input[i] < refs[k]) != (p_input[i - 1] < refs[k]);
+		}
+	}
+}
+
+static int check_f32(const char *name, const float *p_input, int num, int stride,
+		     uint8_t mask, nrf_dsp_sigma_factor_t sigma_factor)
+{
+	double values[NUM];
+	int counts[APP_DSP_CROSSING_NUM];
+	float rates[APP_DSP_CROSSING_NUM];
+	int failures = 0;
+
+	for (int i = 0; i < num; i++) {
+		values[i] = p_input[i * stride];
+	}
+	crossings_reference(values, num, THRESHOLD, sigma_factor, counts);
+
+	app_dsp_crossings_f32_s(p_input, num, stride, mask, THRESHOLD, sigma_factor, rates);
+
+	for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+		float expected = (mask & BIT(k)) ? counts[k] / (num - 1.0f) : 0.0f;
+
+		if (fabsf(rates[k] - expected) > 0.5f / (num - 1)) {
+			fprintf(stderr, "%s rate %d: %f, expected %f\n", name, k, rates[k],
+				expected);
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+static int check_i16(const char *name, const int16_t *p_input, int num, int stride,
+		     uint8_t mask, nrf_dsp_sigma_factor_t sigma_factor)
+{
+	double values[NUM];
+	int counts[APP_DSP_CROSSING_NUM];
+	int16_t rates[APP_DSP_CROSSING_NUM];
+	int failures = 0;
+
+	for (int i = 0; i < num; i++) {
+		values[i] = p_input[i * stride];
+	}
+	crossings_reference(values, num, THRESHOLD, sigma_factor, counts);
+
+	if (stride == 1) {
+		app_dsp_crossings_i16(p_input, num, mask, THRESHOLD, sigma_factor, rates);
+	} else {
+		app_dsp_crossings_i16_s(p_input, num, stride, mask, THRESHOLD, sigma_factor,
+					rates);
+	}
+
+	for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+		int16_t expected = (mask & BIT(k)) ? counts[k] * 1000 / (num - 1) : 0;
+
+		if (rates[k] != expected) {
+			fprintf(stderr, "%s rate %d: %d, expected %d\n", name, k, rates[k],
+				expected);
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	static float input[2 * NUM];
+	static int16_t input_i16[2 * NUM];
+	float rates[APP_DSP_CROSSING_NUM];
+	int16_t rates_i16[APP_DSP_CROSSING_NUM];
+	int failures = 0;
+
+	/* Oscillation on an offset, so the zero, mean and threshold crossings differ */
+	srand(1);
+	for (int i = 0; i < 2 * NUM; i++) {
+		input[i] = 30.0f + 300.0f * sinf(2.0f * (float)M_PI * i / 17.0f) +
+			   (float)(rand() % 2001 - 1000) / 10.0f;
+		input_i16[i] = (int16_t)lrintf(input[i]);
+	}
+
+	failures += check_f32("Float", input, NUM, 1, ALL_RATES, NRF_DSP_SIGMA_FACTOR_P_1);
+	failures += check_f32("Float strided", input, NUM, 2, ALL_RATES,
+			      NRF_DSP_SIGMA_FACTOR_N_2);
+	failures += check_f32("Float mean only", input, NUM, 1, BIT(APP_DSP_CROSSING_MEAN),
+			      NRF_DSP_SIGMA_FACTOR_P_1);
+	failures += check_i16("Int16", input_i16, NUM, 1, ALL_RATES, NRF_DSP_SIGMA_FACTOR_P_1);
+	failures += check_i16("Int16 even", input_i16, NUM - 1, 1, ALL_RATES,
+			      NRF_DSP_SIGMA_FACTOR_N_1);
+	failures += check_i16("Int16 strided", input_i16, NUM, 2, ALL_RATES,
+			      NRF_DSP_SIGMA_FACTOR_P_2);
+	failures += check_i16("Int16 threshold only", input_i16, NUM, 1,
+			      BIT(APP_DSP_CROSSING_ZERO) | BIT(APP_DSP_CROSSING_THRESHOLD),
+			      NRF_DSP_SIGMA_FACTOR_P_1);
+
+	/* Near full scale, mean + 3 sigma is above INT16_MAX and never crossed */
+	for (int i = 0; i < NUM; i++) {
+		input_i16[i] = (i % 2) ? INT16_MAX : 32000;
+	}
+	failures += check_i16("Int16 full scale", input_i16, NUM, 1, ALL_RATES,
+			      NRF_DSP_SIGMA_FACTOR_P_3);
+
+	app_dsp_crossings_f32(input, 1, ALL_RATES, THRESHOLD, NRF_DSP_SIGMA_FACTOR_P_1, rates);
+	app_dsp_crossings_i16(input_i16, 1, ALL_RATES, THRESHOLD, NRF_DSP_SIGMA_FACTOR_P_1,
+			      rates_i16);
+	for (int k = 0; k < APP_DSP_CROSSING_NUM; k++) {
+		if (rates[k] != 0.0f || rates_i16[k] != 0) {
+			fprintf(stderr, "One value rate %d: %f, %d\n", k, rates[k], rates_i16[k]);
+			failures++;
+		}
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Runs of windows at rest as detection counts them for CONFIG_APP_DORMANT_SLEEP,
+ * built with the Kconfig defaults of 5 windows at 80% confidence.
+ */
+
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include "detection_dormant.h"
+
+enum {
+	CLASS_IDLE = 0,
+	CLASS_SHAKING = 1,
+	CLASS_PLACED = 6,
+};
+
+static int failures;
+
+#define CHECK(cond)                                                                  \
+	do {                                                                         \
+		if (!(cond)) {                                                       \
+			fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond);   \
+			failures++;                                                  \
+		}                                                                    \
+	} while (0)
+
+/* Feed windows of one class and return the number of events they posted */
+static int feed(struct detection_dormant *p_dormant, uint16_t predicted_class, float confidence,
+		int windows)
+{
+	int events = 0;
+
+	for (int i = 0; i < windows; i++) {
+		events += detection_dormant_update(p_dormant, predicted_class, confidence);
+	}
+
+	return events;
+}
+
+int main(void)
+{
+	struct detection_dormant dormant;
+
+	detection_dormant_init(&dormant, BIT(CLASS_IDLE) | BIT(CLASS_PLACED));
+
+	/* Five Idle windows in a row, the result channel publishes only the first one */
+	CHECK(feed(&dormant, CLASS_IDLE, 0.9f, 4) == 0);
+	CHECK(feed(&dormant, CLASS_IDLE, 0.9f, 1) == 1);
+	/* Once per run */
+	CHECK(feed(&dormant, CLASS_IDLE, 0.9f, 10) == 0);
+
+	/* Another class ends the run */
+	CHECK(feed(&dormant, CLASS_SHAKING, 0.9f, 1) == 0);
+	CHECK(feed(&dormant, CLASS_IDLE, 0.9f, 4) == 0);
+	CHECK(feed(&dormant, CLASS_SHAKING, 0.9f, 1) == 0);
+	CHECK(feed(&dormant, CLASS_IDLE, 0.9f, 5) == 1);
+
+	/* So does a window below the confidence */
+	detection_dormant_init(&dormant, BIT(CLASS_IDLE) | BIT(CLASS_PLACED));
+	CHECK(feed(&dormant, CLASS_IDLE, 0.9f, 3) == 0);
+	CHECK(feed(&dormant, CLASS_IDLE, 0.5f, 1) == 0);
+	CHECK(feed(&dormant, CLASS_IDLE, 0.8f, 4) == 0);
+	CHECK(feed(&dormant, CLASS_IDLE, 0.8f, 1) == 1);
+
+	/* Rest classes mix in one run */
+	detection_dormant_init(&dormant, BIT(CLASS_IDLE) | BIT(CLASS_PLACED));
+	CHECK(feed(&dormant, CLASS_IDLE, 0.9f, 2) == 0);
+	CHECK(feed(&dormant, CLASS_PLACED, 0.9f, 3) == 1);
+
+	/* A model without rest classes never sleeps */
+	detection_dormant_init(&dormant, 0);
+	CHECK(feed(&dormant, CLASS_IDLE, 1.0f, 10) == 0);
+	CHECK(feed(&dormant, 40, 1.0f, 10) == 0);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Exponentially weighted statistics against the weighted mean and variance
+ * of the whole stream in double precision, through a step in the baseline,
+ * with the strided and fixed-point variants matching the float one.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_dsp.h"
+
+#define NUM 2000
+#define ALPHA 0.02f
+
+/**
+ * @brief Weighted mean and variance of the first num values
+ *
+ * The first value weighs (1 - alpha)^(num - 1), each later one
+ * alpha * (1 - alpha)^(newer values), which sums to 1.
+ */
+static void ewma_reference(const float *p_input, int num, double *p_mean, double *p_var)
+{
+	double mean = 0.0, var = 0.0;
+
+	for (int i = 0; i < num; i++) {
+		double weight = pow(1.0 - ALPHA, num - 1 - i) * (i > 0 ? ALPHA : 1.0);
+
+		mean += weight * p_input[i];
+	}
+	for (int i = 0; i < num; i++) {
+		double weight = pow(1.0 - ALPHA, num - 1 - i) * (i > 0 ? ALPHA : 1.0);
+
+		var += weight * (p_input[i] - mean) * (p_input[i] - mean);
+	}
+
+	*p_mean = mean;
+	*p_var = var;
+}
+
+int main(void)
+{
+	static float input[NUM];
+	static float interleaved[3 * NUM];
+	static int16_t input_i16[NUM];
+	static float integers[NUM];
+	struct app_dsp_ewma ewma, ewma_s, ewma_f32, ewma_i16;
+	int failures = 0;
+	int pos = 0;
+
+	srand(1);
+	for (int i = 0; i < NUM; i++) {
+		/* Baseline steps from 1 g to 1.2 g halfway */
+		input[i] = (i < NUM / 2 ? 1000.0f : 1200.0f) + (float)(rand() % 2001 - 1000) / 10.0f;
+		interleaved[3 * i + 1] = input[i];
+		input_i16[i] = (int16_t)lrintf(input[i]);
+		integers[i] = input_i16[i];
+	}
+
+	app_dsp_ewma_init_f32(&ewma, ALPHA);
+	app_dsp_ewma_init_f32(&ewma_s, ALPHA);
+	app_dsp_ewma_init_f32(&ewma_f32, ALPHA);
+	app_dsp_ewma_init_f32(&ewma_i16, ALPHA);
+
+	if (app_dsp_ewma_mean_f32(&ewma) != 0.0f || app_dsp_ewma_var_f32(&ewma) != 0.0f) {
+		fprintf(stderr, "Statistics before the first value\n");
+		failures++;
+	}
+
+	while (pos < NUM) {
+		int num = 1 + rand() % 50;
+		double mean, var;
+
+		num = (num < NUM - pos) ? num : NUM - pos;
+		app_dsp_ewma_update_f32(&ewma, &input[pos], num);
+		app_dsp_ewma_update_f32_s(&ewma_s, &interleaved[3 * pos + 1], num, 3);
+		app_dsp_ewma_update_f32(&ewma_f32, &integers[pos], num);
+		app_dsp_ewma_update_i16(&ewma_i16, &input_i16[pos], num);
+		pos += num;
+
+		ewma_reference(input, pos, &mean, &var);
+		if (fabs(app_dsp_ewma_mean_f32(&ewma) - mean) > 1e-5 * fabs(mean) ||
+		    fabs(app_dsp_ewma_var_f32(&ewma) - var) > 1e-3 * var + 1e-3) {
+			fprintf(stderr, "%d values: mean %f, var %f, expected %f, %f\n", pos,
+				app_dsp_ewma_mean_f32(&ewma), app_dsp_ewma_var_f32(&ewma), mean,
+				var);
+			failures++;
+		}
+		if (fabs(app_dsp_ewma_rms_f32(&ewma) - sqrt(var + mean * mean)) >
+		    1e-5 * sqrt(var + mean * mean)) {
+			fprintf(stderr, "%d values: rms %f, expected %f\n", pos,
+				app_dsp_ewma_rms_f32(&ewma), sqrt(var + mean * mean));
+			failures++;
+		}
+		if (ewma_s.mean != ewma.mean || ewma_s.var != ewma.var ||
+		    ewma_i16.mean != ewma_f32.mean || ewma_i16.var != ewma_f32.var) {
+			fprintf(stderr, "%d values: strided or fixed-point statistics differ\n", pos);
+			failures++;
+		}
+	}
+
+	/* Settled on the new baseline and the noise, uniform over +-100 mg */
+	if (fabsf(app_dsp_ewma_mean_f32(&ewma) - 1200.0f) > 20.0f ||
+	    fabsf(sqrtf(app_dsp_ewma_var_f32(&ewma)) - 100.0f / sqrtf(3.0f)) > 15.0f) {
+		fprintf(stderr, "Settled at mean %f, deviation %f\n", app_dsp_ewma_mean_f32(&ewma),
+			sqrtf(app_dsp_ewma_var_f32(&ewma)));
+		failures++;
+	}
+
+	return failures ? 1 : 0;
+}
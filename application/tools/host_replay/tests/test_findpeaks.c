@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * One-pass peak finder against a sort of all peaks that pass the height and
+ * distance rules, float and int16, with tied heights, more peaks requested
+ * than kept and vectors too short for a peak.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_dsp.h"
+
+#define NUM 129
+#define PEAKS_OUT 20
+
+/**
+ * @brief Highest peaks first, equal peaks in index order, -1 for the rest
+ *
+ * Peaks are accepted left to right, a peak closer than the minimum distance
+ * to the previous accepted one is dropped whatever its height.
+ */
+static void findpeaks_reference(const float *p_input, int num, float min_peak_height,
+				int min_peak_distance, int peaks_num, int16_t *p_peaks)
+{
+	int16_t accepted[NUM];
+	int accepted_num = 0;
+	int last = -min_peak_distance;
+	int kept = (peaks_num < APP_DSP_FINDPEAKS_MAX) ? peaks_num : APP_DSP_FINDPEAKS_MAX;
+
+	for (int i = 1; i + 1 < num; i++) {
+		if (p_input[i] > p_input[i - 1] && p_input[i] > p_input[i + 1] &&
+		    p_input[i] >= min_peak_height && i - last >= min_peak_distance) {
+			accepted[accepted_num++] = i;
+			last = i;
+		}
+	}
+
+	for (int k = 0; k < peaks_num; k++) {
+		int best = -1;
+
+		for (int j = 0; j < accepted_num && k < kept; j++) {
+			if (accepted[j] >= 0 &&
+			    (best < 0 || p_input[accepted[j]] > p_input[accepted[best]])) {
+				best = j;
+			}
+		}
+
+		p_peaks[k] = (best >= 0) ? accepted[best] : -1;
+		if (best >= 0) {
+			accepted[best] = -1;
+		}
+	}
+}
+
+static int check_peaks(const char *name, const float *p_input, const int16_t *p_input_i16,
+		       int num, float min_peak_height, int min_peak_distance, int peaks_num)
+{
+	int16_t expected[PEAKS_OUT], peaks[PEAKS_OUT], peaks_i16[PEAKS_OUT];
+	int failures = 0;
+
+	findpeaks_reference(p_input, num, min_peak_height, min_peak_distance, peaks_num, expected);
+	app_dsp_findpeaks_f32(p_input, num, min_peak_height, min_peak_distance, peaks, peaks_num);
+	app_dsp_findpeaks_i16(p_input_i16, num, (int16_t)min_peak_height, min_peak_distance,
+			      peaks_i16, peaks_num);
+
+	for (int k = 0; k < peaks_num; k++) {
+		if (peaks[k] != expected[k] || peaks_i16[k] != expected[k]) {
+			fprintf(stderr, "%s peak %d: %d, int16 %d, expected %d\n", name, k,
+				peaks[k], peaks_i16[k], expected[k]);
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	static float input[NUM];
+	static int16_t input_i16[NUM];
+	int failures = 0;
+
+	/* Integer amplitudes, so float and int16 agree and equal peaks are common */
+	srand(1);
+	for (int i = 0; i < NUM; i++) {
+		input_i16[i] = (int16_t)(rand() % 50 + ((i % 16 == 5) ? 200 : 0));
+		input[i] = input_i16[i];
+	}
+
+	failures += check_peaks("All", input, input_i16, NUM, 0.0f, 1, PEAKS_OUT);
+	failures += check_peaks("Highest", input, input_i16, NUM, 0.0f, 1, 1);
+	failures += check_peaks("Height", input, input_i16, NUM, 40.0f, 1, 8);
+	failures += check_peaks("Distance", input, input_i16, NUM, 0.0f, 5, 16);
+	failures += check_peaks("Strong", input, input_i16, NUM, 200.0f, 10, PEAKS_OUT);
+	failures += check_peaks("Odd length", input, input_i16, NUM - 2, 10.0f, 3, 4);
+	failures += check_peaks("Too short", input, input_i16, 2, 0.0f, 1, 4);
+
+	return failures ? 1 : 0;
+}
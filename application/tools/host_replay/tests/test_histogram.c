@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Log histogram and P-square running quantile against the exact quantiles of
+ * a skewed stream, with the strided and fixed-point variants counting the
+ * same as the contiguous float ones.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app_dsp.h"
+
+#define NUM 4000
+#define SUB_BITS 4
+#define BINS 160
+
+APP_DSP_HISTOGRAM_DEFINE(hist, BINS, SUB_BITS, 0.5f);
+APP_DSP_HISTOGRAM_DEFINE(hist_s, BINS, SUB_BITS, 0.5f);
+APP_DSP_HISTOGRAM_DEFINE(hist_f32, BINS, SUB_BITS, 1.0f);
+APP_DSP_HISTOGRAM_DEFINE(hist_i16, BINS, SUB_BITS, 1.0f);
+
+static const float quantiles[] = { 0.01f, 0.25f, 0.5f, 0.9f, 0.99f, 1.0f };
+
+static int compare_floats(const void *a, const void *b)
+{
+	float fa = *(const float *)a, fb = *(const float *)b;
+
+	return (fa > fb) - (fa < fb);
+}
+
+/* Nearest rank quantile of sorted values, as counted by the histogram */
+static float exact_quantile(const float *p_sorted, float quantile)
+{
+	int rank = (int)ceilf(quantile * NUM);
+
+	return p_sorted[(rank > 0 ? rank : 1) - 1];
+}
+
+static int check_histogram(const float *p_sorted)
+{
+	int failures = 0;
+
+	if (hist.count != NUM) {
+		fprintf(stderr, "Histogram counted %u values\n", hist.count);
+		failures++;
+	}
+
+	for (size_t q = 0; q < sizeof(quantiles) / sizeof(quantiles[0]); q++) {
+		float estimate = app_dsp_histogram_quantile_f32(&hist, quantiles[q]);
+		float exact = exact_quantile(p_sorted, quantiles[q]);
+
+		/* Half a bin, at most 1/2^sub_bits of the value, or half a unit */
+		if (fabsf(estimate - exact) > exact / (1 << SUB_BITS) + hist.resolution) {
+			fprintf(stderr, "Histogram quantile %.2f: %f, expected %f\n", quantiles[q],
+				estimate, exact);
+			failures++;
+		}
+	}
+
+	if (memcmp(hist_counts, hist_s_counts, sizeof(hist_counts)) != 0 ||
+	    memcmp(hist_f32_counts, hist_i16_counts, sizeof(hist_f32_counts)) != 0) {
+		fprintf(stderr, "Strided or fixed-point histogram counts differ\n");
+		failures++;
+	}
+
+	/* Negative values in the first bin, values beyond the range in the last */
+	app_dsp_histogram_reset(&hist);
+	app_dsp_histogram_update_f32(&hist, (const float[]){ -3.0f, 1e12f }, 2);
+	if (hist.count != 2 || hist_counts[0] != 1 || hist_counts[BINS - 1] != 1) {
+		fprintf(stderr, "Out of range values not clamped\n");
+		failures++;
+	}
+	app_dsp_histogram_reset(&hist);
+	if (hist.count != 0 || app_dsp_histogram_quantile_f32(&hist, 0.5f) != 0.0f) {
+		fprintf(stderr, "Histogram not reset\n");
+		failures++;
+	}
+
+	return failures;
+}
+
+static int check_quantile(const float *p_input, const int16_t *p_input_i16,
+			  const float *p_sorted)
+{
+	struct app_dsp_quantile quantile, quantile_s, quantile_f32, quantile_i16;
+	static float integers[NUM];
+	int failures = 0;
+
+	for (int i = 0; i < NUM; i++) {
+		integers[i] = p_input_i16[i];
+	}
+
+	for (size_t q = 1; q < sizeof(quantiles) / sizeof(quantiles[0]) - 2; q++) {
+		float exact = exact_quantile(p_sorted, quantiles[q]);
+		float estimate;
+
+		app_dsp_quantile_init_f32(&quantile, quantiles[q]);
+		app_dsp_quantile_init_f32(&quantile_s, quantiles[q]);
+		app_dsp_quantile_init_f32(&quantile_f32, quantiles[q]);
+		app_dsp_quantile_init_f32(&quantile_i16, quantiles[q]);
+
+		for (int i = 0; i < NUM; i += 100) {
+			app_dsp_quantile_update_f32(&quantile, &p_input[2 * i], 100);
+			app_dsp_quantile_update_f32_s(&quantile_s, &p_input[2 * i + 1], 100, 2);
+			app_dsp_quantile_update_f32(&quantile_f32, &integers[i], 100);
+			app_dsp_quantile_update_i16_s(&quantile_i16, &p_input_i16[i], 100, 1);
+		}
+
+		/* P-square is an estimate, within a few percent on a smooth distribution */
+		estimate = app_dsp_quantile_get_f32(&quantile_s);
+		if (fabsf(estimate - exact) > 0.05f * exact) {
+			fprintf(stderr, "Running quantile %.2f: %f, expected %f\n", quantiles[q],
+				estimate, exact);
+			failures++;
+		}
+		if (app_dsp_quantile_get_f32(&quantile_f32) !=
+		    app_dsp_quantile_get_f32(&quantile_i16)) {
+			fprintf(stderr, "Running quantile %.2f: fixed-point %f, float %f\n",
+				quantiles[q], app_dsp_quantile_get_f32(&quantile_i16),
+				app_dsp_quantile_get_f32(&quantile_f32));
+			failures++;
+		}
+	}
+
+	/* Nearest rank of the values so far, exact up to five */
+	app_dsp_quantile_init_f32(&quantile, 0.5f);
+	app_dsp_quantile_update_f32(&quantile, (const float[]){ 5.0f, 1.0f, 4.0f }, 3);
+	if (app_dsp_quantile_get_f32(&quantile) != 4.0f) {
+		fprintf(stderr, "Median of three: %f\n", app_dsp_quantile_get_f32(&quantile));
+		failures++;
+	}
+	app_dsp_quantile_update_f32(&quantile, (const float[]){ 2.0f, 3.0f }, 2);
+	if (app_dsp_quantile_get_f32(&quantile) != 3.0f) {
+		fprintf(stderr, "Median of five: %f\n", app_dsp_quantile_get_f32(&quantile));
+		failures++;
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	/* Interleaved two-channel stream, both channels alike */
+	static float input[2 * NUM];
+	static float sorted[NUM];
+	static int16_t input_i16[NUM];
+	int failures = 0;
+
+	srand(1);
+	for (int i = 0; i < NUM; i++) {
+		float u = (rand() + 1.0f) / ((float)RAND_MAX + 2.0f);
+
+		/* Exponential, a long tail like scores and latencies */
+		input[2 * i] = -100.0f * logf(u);
+		input[2 * i + 1] = input[2 * i];
+		sorted[i] = input[2 * i];
+		input_i16[i] = (int16_t)lrintf(input[2 * i]);
+	}
+	qsort(sorted, NUM, sizeof(sorted[0]), compare_floats);
+
+	for (int i = 0; i < NUM; i += 100) {
+		float integers[100];
+
+		for (int j = 0; j < 100; j++) {
+			integers[j] = input_i16[i + j];
+		}
+
+		app_dsp_histogram_update_f32(&hist, &input[2 * i], 1);
+		app_dsp_histogram_update_f32_s(&hist, &input[2 * i + 2], 99, 2);
+		app_dsp_histogram_update_f32_s(&hist_s, &input[2 * i + 1], 100, 2);
+		app_dsp_histogram_update_f32(&hist_f32, integers, 100);
+		app_dsp_histogram_update_i16(&hist_i16, &input_i16[i], 100);
+	}
+
+	failures += check_quantile(input, input_i16, sorted);
+	failures += check_histogram(sorted);
+
+	return failures ? 1 : 0;
+}
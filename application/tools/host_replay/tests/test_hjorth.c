@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Hjorth mobility and complexity of the fused time-domain kernel: 0 on flat
+ * windows instead of NaN or Inf, and the double precision definition on a
+ * noisy one.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_dsp.h"
+
+#define WINDOW 50
+
+#define HJORTH_MASK (NRF_EDGEAI_FEATURE_BIT_HJ_MOBILITY | NRF_EDGEAI_FEATURE_BIT_HJ_COMPLEXITY)
+
+/**
+ * @brief Reference Hjorth parameters, population variances as in app_dsp
+ */
+static void hjorth_reference(const float *p_window, int num, double *p_mobility,
+			     double *p_complexity)
+{
+	double mean = 0.0, var = 0.0, var_d1 = 0.0, var_d2 = 0.0;
+
+	for (int i = 0; i < num; i++) {
+		mean += p_window[i];
+	}
+	mean /= num;
+	for (int i = 0; i < num; i++) {
+		var += (p_window[i] - mean) * (p_window[i] - mean);
+	}
+	var /= num;
+	for (int i = 0; i < num - 1; i++) {
+		double d1 = (double)p_window[i + 1] - p_window[i];
+
+		var_d1 += d1 * d1;
+	}
+	var_d1 /= num - 1;
+	for (int i = 0; i < num - 2; i++) {
+		double d2 = (double)p_window[i + 2] - 2.0 * p_window[i + 1] + p_window[i];
+
+		var_d2 += d2 * d2;
+	}
+	var_d2 /= num - 2;
+
+	*p_mobility = sqrt(var_d1 / var);
+	*p_complexity = sqrt(var_d2 / var_d1) / *p_mobility;
+}
+
+static int check_flat(const char *name, const float *p_window)
+{
+	float features[2];
+
+	app_dsp_features_f32(p_window, WINDOW, HJORTH_MASK, features);
+	if (features[0] != 0.0f || features[1] != 0.0f) {
+		fprintf(stderr, "%s window: mobility %f, complexity %f, expected 0\n", name,
+			features[0], features[1]);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	float window[WINDOW];
+	float features[2];
+	double mobility, complexity;
+	int failures = 0;
+
+	/* Device lying still, at rest and at 1 g */
+	for (int i = 0; i < WINDOW; i++) {
+		window[i] = 0.0f;
+	}
+	failures += check_flat("Zero", window);
+	for (int i = 0; i < WINDOW; i++) {
+		window[i] = 1000.0f;
+	}
+	failures += check_flat("1 g", window);
+
+	srand(1);
+	for (int i = 0; i < WINDOW; i++) {
+		window[i] = 1000.0f + (float)(rand() % 2001 - 1000) / 10.0f;
+	}
+	app_dsp_features_f32(window, WINDOW, HJORTH_MASK, features);
+	hjorth_reference(window, WINDOW, &mobility, &complexity);
+	if (fabs(features[0] - mobility) > 1e-3 * mobility ||
+	    fabs(features[1] - complexity) > 1e-3 * complexity) {
+		fprintf(stderr, "Noisy window: mobility %f, complexity %f, expected %f, %f\n",
+			features[0], features[1], mobility, complexity);
+		failures++;
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Integer model input of CONFIG_APP_DETECTION_INPUT_I16: acceleration
+ * magnitudes in int16 milli-g from raw counts, against the float magnitudes
+ * of the same counts, for every accelerometer range.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_dsp.h"
+
+/* Raw counts to milli-g in Q16.16 as in detection.c */
+#define ACCEL_MG_SCALE_Q16(range_g) ((range_g) * 2000U)
+
+#define VECTORS 4096
+
+static const int ranges_g[] = { 2, 4, 8, 16 };
+
+int main(void)
+{
+	static int16_t counts[VECTORS * 3];
+	static int16_t magnitudes_i16[VECTORS];
+	static float magnitudes_f32[VECTORS];
+	int failures = 0;
+
+	srand(1);
+	for (int i = 0; i < VECTORS * 3; i++) {
+		counts[i] = (int16_t)((rand() & 0xffff) - 0x8000);
+	}
+	/* Full scale on every axis, the largest magnitude */
+	counts[0] = counts[1] = counts[2] = INT16_MIN;
+
+	for (size_t r = 0; r < sizeof(ranges_g) / sizeof(ranges_g[0]); r++) {
+		int range_g = ranges_g[r];
+
+		app_dsp_magnitude_i16_q16(counts, 3, VECTORS, ACCEL_MG_SCALE_Q16(range_g),
+					  magnitudes_i16);
+		app_dsp_magnitude_i16(counts, 3, VECTORS, range_g * 1000.0f / 32768.0f,
+				      magnitudes_f32);
+
+		/* The integer root truncates by less than a count, then rounds to 1 mg */
+		for (int i = 0; i < VECTORS; i++) {
+			float error = fabsf(magnitudes_i16[i] - magnitudes_f32[i]);
+
+			if (error > range_g * 1000.0f / 32768.0f + 0.5f) {
+				fprintf(stderr, "%d g vector %d: %d mg, expected %.2f mg\n",
+					range_g, i, magnitudes_i16[i], magnitudes_f32[i]);
+				failures++;
+			}
+		}
+	}
+
+	return failures ? 1 : 0;
+}
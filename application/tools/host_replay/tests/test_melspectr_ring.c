@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Mel-spectrogram ring: contiguous frames, oldest first, while it fills, once
+ * it wraps and after dropped frames. The runtime mel-spectrogram is only
+ * shipped for Cortex-M, the stand-in below behaves as the ring expects it to,
+ * see app_dsp_melspectr_ring.c, and writes the block number into the frame.
+ */
+
+#include <stdio.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#define FREQ_BANDS 4
+#define TIME_BANDS 5
+#define BLOCKS 23
+
+static flt32_t melspectrum[APP_DSP_MELSPECTR_RING_LEN(FREQ_BANDS, TIME_BANDS)];
+
+int8_t nrf_dsp_melspectr_make_f32(nrf_dsp_melspectr_ctx_f32_t *p_ctx, flt32_t *p_audio_input)
+{
+	flt32_t *p_frame = &p_ctx->p_melspectrum[p_ctx->current_fill * p_ctx->freq_bands];
+
+	for (uint16_t b = 0; b < p_ctx->freq_bands; b++) {
+		p_frame[b] = p_audio_input[0] * 100.0f + b;
+	}
+
+	return (++p_ctx->current_fill == p_ctx->time_bands) ? 0 : 1;
+}
+
+/**
+ * @brief Check that the view holds the frames of blocks first to last
+ * @return Number of mismatching values
+ */
+static int check_view(const struct app_dsp_melspectr_ring *p_ring, int first, int last)
+{
+	const flt32_t *p_view = app_dsp_melspectr_ring_view_f32(p_ring);
+	int failures = 0;
+
+	for (int block = first; block <= last; block++) {
+		for (int b = 0; b < FREQ_BANDS; b++) {
+			float expected = block * 100.0f + b;
+
+			if (p_view[(block - first) * FREQ_BANDS + b] != expected) {
+				fprintf(stderr, "Frames %d to %d: block %d band %d is %f\n", first,
+					last, block, b, p_view[(block - first) * FREQ_BANDS + b]);
+				failures++;
+			}
+		}
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	nrf_dsp_melspectr_ctx_f32_t ctx = {
+		.p_melspectrum = melspectrum,
+		.freq_bands = FREQ_BANDS,
+		.time_bands = TIME_BANDS,
+	};
+	struct app_dsp_melspectr_ring ring;
+	int first = 0;
+	int failures = 0;
+
+	app_dsp_melspectr_ring_init(&ring, &ctx);
+
+	for (int block = 0; block < BLOCKS; block++) {
+		flt32_t audio = (flt32_t)block;
+		bool full = app_dsp_melspectr_ring_push_f32(&ring, &audio);
+
+		if (block - first >= TIME_BANDS) {
+			first = block - TIME_BANDS + 1;
+		}
+		if (full != (block - first + 1 == TIME_BANDS)) {
+			fprintf(stderr, "Block %d: full %d\n", block, full);
+			failures++;
+		}
+		failures += check_view(&ring, first, block);
+
+		/* Hop two frames now and then, as between two inferences */
+		if (block % 7 == 6) {
+			app_dsp_melspectr_ring_drop(&ring, 2);
+			first = MIN(first + 2, block + 1);
+			failures += check_view(&ring, first, block);
+		}
+	}
+
+	return failures ? 1 : 0;
+}
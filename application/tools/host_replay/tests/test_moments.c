@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * One-pass central moments against two-pass double precision ones, updated
+ * in one state and merged from blocks, with the strided and fixed-point
+ * variants matching the float one and a constant stream.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_dsp.h"
+
+#define NUM 1000
+#define BLOCKS 4
+
+static int check_moments(const char *name, const struct app_dsp_moments *p_moments,
+			 const float *p_input)
+{
+	double mean = 0.0, m2 = 0.0, m3 = 0.0, m4 = 0.0;
+	double var, skew, kur;
+	int failures = 0;
+
+	for (int i = 0; i < NUM; i++) {
+		mean += p_input[i];
+	}
+	mean /= NUM;
+	for (int i = 0; i < NUM; i++) {
+		double d = p_input[i] - mean;
+
+		m2 += d * d;
+		m3 += d * d * d;
+		m4 += d * d * d * d;
+	}
+	var = m2 / NUM;
+	skew = sqrt(NUM) * m3 / (m2 * sqrt(m2));
+	kur = NUM * m4 / (m2 * m2) - 3.0;
+
+	if (p_moments->count != NUM ||
+	    fabs(app_dsp_moments_mean_f32(p_moments) - mean) > 1e-5 * fabs(mean) ||
+	    fabs(app_dsp_moments_var_f32(p_moments) - var) > 1e-4 * var ||
+	    fabs(app_dsp_moments_skew_f32(p_moments) - skew) > 1e-3 * fabs(skew) + 1e-3 ||
+	    fabs(app_dsp_moments_kur_f32(p_moments) - kur) > 1e-3 * fabs(kur) + 1e-3) {
+		fprintf(stderr, "%s: %u values, mean %f, var %f, skew %f, kur %f, "
+			"expected mean %f, var %f, skew %f, kur %f\n", name, p_moments->count,
+			app_dsp_moments_mean_f32(p_moments), app_dsp_moments_var_f32(p_moments),
+			app_dsp_moments_skew_f32(p_moments), app_dsp_moments_kur_f32(p_moments),
+			mean, var, skew, kur);
+		failures++;
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	static float input[NUM];
+	static float interleaved[2 * NUM];
+	static int16_t input_i16[NUM];
+	static float integers[NUM];
+	struct app_dsp_moments moments, merged, block, strided, moments_f32, moments_i16;
+	int failures = 0;
+
+	srand(1);
+	for (int i = 0; i < NUM; i++) {
+		float u = (rand() + 1.0f) / ((float)RAND_MAX + 2.0f);
+
+		/* Exponential on an offset, skewed and heavy tailed */
+		input[i] = 1000.0f - 100.0f * logf(u);
+		interleaved[2 * i] = input[i];
+		input_i16[i] = (int16_t)lrintf(input[i]);
+		integers[i] = input_i16[i];
+	}
+
+	app_dsp_moments_reset(&moments);
+	app_dsp_moments_reset(&merged);
+	app_dsp_moments_reset(&strided);
+	app_dsp_moments_reset(&moments_f32);
+	app_dsp_moments_reset(&moments_i16);
+
+	app_dsp_moments_update_f32(&moments, input, NUM);
+	app_dsp_moments_update_f32_s(&strided, interleaved, NUM, 2);
+	app_dsp_moments_update_f32(&moments_f32, integers, NUM);
+	app_dsp_moments_update_i16_s(&moments_i16, input_i16, NUM / 2, 1);
+	app_dsp_moments_update_i16(&moments_i16, &input_i16[NUM / 2], NUM - NUM / 2);
+
+	/* Uneven blocks, merged in order, and an empty one */
+	for (int b = 0, pos = 0; b <= BLOCKS; b++) {
+		int num = (b < BLOCKS) ? (NUM / BLOCKS) + (b - BLOCKS / 2) * 37 : NUM - pos;
+
+		app_dsp_moments_reset(&block);
+		app_dsp_moments_update_f32(&block, &input[pos], num);
+		app_dsp_moments_merge(&merged, &block);
+		pos += num;
+	}
+	app_dsp_moments_reset(&block);
+	app_dsp_moments_merge(&merged, &block);
+
+	failures += check_moments("Updated", &moments, input);
+	failures += check_moments("Merged", &merged, input);
+	failures += check_moments("Fixed-point", &moments_i16, integers);
+
+	if (strided.mean != moments.mean || strided.m2 != moments.m2 ||
+	    strided.m3 != moments.m3 || strided.m4 != moments.m4 ||
+	    moments_i16.mean != moments_f32.mean || moments_i16.m2 != moments_f32.m2 ||
+	    moments_i16.m3 != moments_f32.m3 || moments_i16.m4 != moments_f32.m4) {
+		fprintf(stderr, "Strided or fixed-point moments differ\n");
+		failures++;
+	}
+
+	/* Device lying still */
+	for (int i = 0; i < NUM; i++) {
+		input[i] = 1000.0f;
+	}
+	app_dsp_moments_reset(&moments);
+	app_dsp_moments_update_f32(&moments, input, NUM);
+	if (app_dsp_moments_var_f32(&moments) != 0.0f || app_dsp_moments_skew_f32(&moments) != 0.0f ||
+	    app_dsp_moments_kur_f32(&moments) != 0.0f) {
+		fprintf(stderr, "Constant: var %f, skew %f, kur %f\n",
+			app_dsp_moments_var_f32(&moments), app_dsp_moments_skew_f32(&moments),
+			app_dsp_moments_kur_f32(&moments));
+		failures++;
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Sliding peak-to-peak amplitudes against the low and high frequency
+ * extremes of the last window in double precision, after runs of inputs of
+ * varying length, with the strided and fixed-point variants and a reset.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#define WINDOW 50
+#define AVERAGE 8
+#define SAMPLES 600
+
+APP_DSP_PK2PK_DEFINE(pk2pk, WINDOW, AVERAGE);
+APP_DSP_PK2PK_DEFINE(pk2pk_s, WINDOW, AVERAGE);
+APP_DSP_PK2PK_DEFINE(pk2pk_f32, WINDOW, AVERAGE);
+APP_DSP_PK2PK_DEFINE(pk2pk_i16, WINDOW, AVERAGE);
+
+/**
+ * @brief Peak-to-peak amplitudes of the window ending before sample end
+ *
+ * Filtered value j is the average of inputs j to j + AVERAGE - 1 and the
+ * input in the middle of them minus the average.
+ */
+static void pk2pk_reference(const float *p_input, int end, double *p_lf, double *p_hf)
+{
+	const float *p_window = &p_input[end - WINDOW];
+	double lf_min = INFINITY, lf_max = -INFINITY, hf_min = INFINITY, hf_max = -INFINITY;
+
+	for (int j = 0; j <= WINDOW - AVERAGE; j++) {
+		double lf = 0.0, hf;
+
+		for (int i = 0; i < AVERAGE; i++) {
+			lf += p_window[j + i];
+		}
+		lf /= AVERAGE;
+		hf = p_window[j + AVERAGE / 2] - lf;
+
+		lf_min = fmin(lf_min, lf);
+		lf_max = fmax(lf_max, lf);
+		hf_min = fmin(hf_min, hf);
+		hf_max = fmax(hf_max, hf);
+	}
+
+	*p_lf = lf_max - lf_min;
+	*p_hf = hf_max - hf_min;
+}
+
+static int run_stream(const float *p_input, const float *p_interleaved,
+		      const int16_t *p_input_i16, const float *p_integers)
+{
+	int failures = 0;
+	int pos = 0;
+
+	while (pos < SAMPLES) {
+		int num = MIN(1 + rand() % 23, SAMPLES - pos);
+		float lf, hf, lf_s, hf_s, lf_f32, hf_f32, lf_i16, hf_i16;
+		double lf_ref, hf_ref;
+		bool full;
+
+		app_dsp_pk2pk_update_f32(&pk2pk, &p_input[pos], num);
+		app_dsp_pk2pk_update_f32_s(&pk2pk_s, &p_interleaved[2 * pos + 1], num, 2);
+		app_dsp_pk2pk_update_f32(&pk2pk_f32, &p_integers[pos], num);
+		app_dsp_pk2pk_update_i16(&pk2pk_i16, &p_input_i16[pos], num);
+		pos += num;
+
+		full = app_dsp_pk2pk_get_f32(&pk2pk, &lf, &hf);
+		if (full != (pos >= WINDOW)) {
+			fprintf(stderr, "%d samples: full %d\n", pos, full);
+			failures++;
+		}
+		if (!full) {
+			continue;
+		}
+
+		/* The running sum drifts by a few float ulps of the input between resums */
+		pk2pk_reference(p_input, pos, &lf_ref, &hf_ref);
+		if (fabs(lf - lf_ref) > 1e-3 || fabs(hf - hf_ref) > 1e-3) {
+			fprintf(stderr, "%d samples: lf %f, hf %f, expected %f, %f\n", pos, lf, hf,
+				lf_ref, hf_ref);
+			failures++;
+		}
+
+		app_dsp_pk2pk_get_f32(&pk2pk_s, &lf_s, &hf_s);
+		app_dsp_pk2pk_get_f32(&pk2pk_f32, &lf_f32, &hf_f32);
+		app_dsp_pk2pk_get_f32(&pk2pk_i16, &lf_i16, &hf_i16);
+		if (lf_s != lf || hf_s != hf || lf_i16 != lf_f32 || hf_i16 != hf_f32) {
+			fprintf(stderr, "%d samples: strided or fixed-point amplitudes differ\n",
+				pos);
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	static float input[SAMPLES];
+	static float interleaved[2 * SAMPLES];
+	static int16_t input_i16[SAMPLES];
+	static float integers[SAMPLES];
+	float lf, hf;
+	int failures = 0;
+
+	/* Slow sway with a fast vibration on top */
+	srand(1);
+	for (int i = 0; i < SAMPLES; i++) {
+		input[i] = 1.0f + 0.3f * sinf(2.0f * (float)M_PI * i / 120.0f) +
+			   0.05f * sinf(2.0f * (float)M_PI * i / 3.0f) +
+			   (float)(rand() % 2001 - 1000) / 100000.0f;
+		interleaved[2 * i + 1] = input[i];
+		input_i16[i] = (int16_t)lrintf(input[i] * 1000.0f);
+		integers[i] = input_i16[i];
+	}
+
+	failures += run_stream(input, interleaved, input_i16, integers);
+
+	/* Starts over, no amplitudes until the window is refilled */
+	app_dsp_pk2pk_reset(&pk2pk);
+	app_dsp_pk2pk_update_f32(&pk2pk, input, WINDOW - 1);
+	if (app_dsp_pk2pk_get_f32(&pk2pk, &lf, &hf)) {
+		fprintf(stderr, "Amplitudes before the window is refilled\n");
+		failures++;
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Mixed-radix real FFT against a double precision DFT, for power of two,
+ * odd and mixed 2, 3 and 5 lengths, with own and shared twiddle tables.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_dsp.h"
+
+#define LEN_MAX 300
+
+static const uint16_t lens[] = { 2, 3, 4, 5, 6, 9, 15, 25, 50, 60, 64, 75, 100, 128, 150, 300 };
+
+/**
+ * @brief Compare the FFT of a plan with the DFT of the same input
+ * @return Number of mismatching bins
+ */
+static int check_plan(const struct app_dsp_rfft_f32 *p_rfft, const float *p_input)
+{
+	static float output[APP_DSP_RFFT_OUTPUT_LEN(LEN_MAX)];
+	uint16_t len = p_rfft->len;
+	double scale = 0.0;
+	int failures = 0;
+
+	for (uint16_t i = 0; i < len; i++) {
+		scale += fabs(p_input[i]);
+	}
+
+	app_dsp_rfft_f32(p_rfft, p_input, output);
+
+	for (uint16_t k = 0; k <= len / 2; k++) {
+		double re = 0.0, im = 0.0;
+
+		for (uint16_t i = 0; i < len; i++) {
+			double phase = -2.0 * M_PI * k * i / len;
+
+			re += p_input[i] * cos(phase);
+			im += p_input[i] * sin(phase);
+		}
+
+		/* Float rounding grows with the sum of the magnitudes */
+		if (fabs(output[2 * k] - re) > 1e-5 * scale ||
+		    fabs(output[2 * k + 1] - im) > 1e-5 * scale) {
+			fprintf(stderr, "%u samples bin %u: %f%+fi, expected %f%+fi\n", len, k,
+				output[2 * k], output[2 * k + 1], re, im);
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	static float input[LEN_MAX];
+	static float twiddle[APP_DSP_RFFT_TWIDDLE_LEN(LEN_MAX)];
+	static float twiddle_base[APP_DSP_RFFT_TWIDDLE_LEN(LEN_MAX)];
+	struct app_dsp_rfft_f32 rfft;
+	struct app_dsp_rfft_f32 base;
+	int failures = 0;
+
+	srand(1);
+	for (int i = 0; i < LEN_MAX; i++) {
+		input[i] = (float)(rand() % 20001 - 10000) / 10.0f;
+	}
+
+	for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+		if (app_dsp_rfft_init_f32(&rfft, lens[l], twiddle)) {
+			fprintf(stderr, "%u samples not supported\n", lens[l]);
+			failures++;
+			continue;
+		}
+		failures += check_plan(&rfft, input);
+	}
+
+	/* Shorter plans on the table of the longest */
+	if (app_dsp_rfft_init_f32(&base, LEN_MAX, twiddle_base)) {
+		return 1;
+	}
+	for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+		if (LEN_MAX % lens[l] != 0) {
+			continue;
+		}
+		if (app_dsp_rfft_init_shared_f32(&rfft, lens[l], &base)) {
+			fprintf(stderr, "%u samples not supported on a %u table\n", lens[l],
+				LEN_MAX);
+			failures++;
+			continue;
+		}
+		failures += check_plan(&rfft, input);
+	}
+
+	/* Prime factors other than 2, 3 and 5, and lengths the table does not divide */
+	if (app_dsp_rfft_init_f32(&rfft, 7, twiddle) == 0 ||
+	    app_dsp_rfft_init_f32(&rfft, 98, twiddle) == 0 ||
+	    app_dsp_rfft_init_shared_f32(&rfft, 64, &base) == 0) {
+		fprintf(stderr, "Unsupported length accepted\n");
+		failures++;
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Sliding DFT against a double precision DFT of the last window, after runs
+ * of samples of varying length, across several resyncs of the recursion.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#define WINDOW 50
+#define SAMPLES 1000
+
+static const uint16_t bins[] = { 0, 1, 3, 7, 12, 25 };
+
+APP_DSP_SDFT_DEFINE(sdft, WINDOW, bins);
+
+int main(void)
+{
+	static float samples[SAMPLES];
+	float spectrum[WINDOW / 2 + 1];
+	int failures = 0;
+	int pos = 0;
+
+	srand(1);
+	for (int i = 0; i < SAMPLES; i++) {
+		samples[i] = 1000.0f + 300.0f * sinf(2.0f * (float)M_PI * 3 * i / WINDOW) +
+			     (float)(rand() % 2001 - 1000) / 10.0f;
+	}
+
+	app_dsp_sdft_init_f32(&sdft);
+
+	while (pos < SAMPLES) {
+		int num = MIN(1 + rand() % 17, SAMPLES - pos);
+		bool full;
+
+		app_dsp_sdft_update_f32(&sdft, &samples[pos], num);
+		pos += num;
+
+		full = app_dsp_sdft_amplitude_f32(&sdft, 1.0f, spectrum);
+		if (full != (pos >= WINDOW)) {
+			fprintf(stderr, "%d samples: full %d\n", pos, full);
+			failures++;
+		}
+		if (!full) {
+			continue;
+		}
+
+		for (size_t b = 0; b < sizeof(bins) / sizeof(bins[0]); b++) {
+			double re = 0.0, im = 0.0;
+
+			for (int n = 0; n < WINDOW; n++) {
+				double phase = -2.0 * M_PI * bins[b] * n / WINDOW;
+
+				re += samples[pos - WINDOW + n] * cos(phase);
+				im += samples[pos - WINDOW + n] * sin(phase);
+			}
+
+			/* Relative to the DC bin, the largest, drift between resyncs included */
+			if (fabs(spectrum[bins[b]] - hypot(re, im)) > 1e-4 * 1000.0 * WINDOW) {
+				fprintf(stderr, "%d samples bin %u: %f, expected %f\n", pos,
+					bins[b], spectrum[bins[b]], hypot(re, im));
+				failures++;
+			}
+		}
+	}
+
+	return failures ? 1 : 0;
+}
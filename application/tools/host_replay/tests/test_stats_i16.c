@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Int16 magnitude and statistics kernels against the float path on the same
+ * samples: strided XYZ vectors up to full negative scale, and vectors of odd
+ * and even length with the extremes of int16.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+
+#define VECTORS 1024
+#define STRIDE 4
+#define NUM 257
+
+/* Counts to milli-g of a 16 g range, in float and in Q16.16 */
+#define SCALE (16000.0f / 32768.0f)
+#define SCALE_Q16 32000U
+
+static int check_magnitudes(void)
+{
+	static int16_t xyz[VECTORS * STRIDE];
+	static float xyz_f32[VECTORS * STRIDE];
+	static float magnitudes[VECTORS], magnitudes_f32[VECTORS];
+	static int16_t magnitudes_q16[VECTORS];
+	int failures = 0;
+
+	for (int i = 0; i < VECTORS * STRIDE; i++) {
+		xyz[i] = (int16_t)(rand() % 65536 - 32768);
+	}
+	/* Sums of squares above 2^31, the largest at full negative scale */
+	for (int axis = 0; axis < 3; axis++) {
+		xyz[axis] = INT16_MIN;
+		xyz[STRIDE + axis] = INT16_MAX;
+	}
+	for (int i = 0; i < VECTORS * STRIDE; i++) {
+		xyz_f32[i] = xyz[i];
+	}
+
+	app_dsp_magnitude_i16(xyz, STRIDE, VECTORS, SCALE, magnitudes);
+	app_dsp_magnitude_i16_q16(xyz, STRIDE, VECTORS, SCALE_Q16, magnitudes_q16);
+	app_dsp_magnitude_f32(xyz_f32, STRIDE, VECTORS, SCALE, magnitudes_f32);
+
+	for (int i = 0; i < VECTORS; i++) {
+		/* The integer root truncates by up to one count before scaling */
+		if (fabsf(magnitudes[i] - magnitudes_f32[i]) > 1e-6f * magnitudes_f32[i] ||
+		    fabsf(magnitudes_q16[i] - MIN(magnitudes_f32[i], INT16_MAX)) > SCALE + 0.5f) {
+			fprintf(stderr, "Vector %d: %f, Q16 %d, expected %f\n", i, magnitudes[i],
+				magnitudes_q16[i], magnitudes_f32[i]);
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+static int check_stats(const int16_t *p_input, int num)
+{
+	struct app_dsp_stats_i16 stats;
+	double sum = 0.0, sum_sq = 0.0;
+	float min = INFINITY, max = -INFINITY;
+	int failures = 0;
+
+	app_dsp_stats_i16(p_input, num, &stats);
+
+	for (int i = 0; i < num; i++) {
+		float x = p_input[i];
+
+		sum += x;
+		sum_sq += (double)x * x;
+		min = fminf(min, x);
+		max = fmaxf(max, x);
+	}
+
+	if (stats.sum != sum || (double)stats.sum_sq != sum_sq || stats.min != min ||
+	    stats.max != max) {
+		fprintf(stderr, "%d samples: sum %d, sum_sq %llu, min %d, max %d, "
+			"expected %.0f, %.0f, %.0f, %.0f\n", num, stats.sum,
+			(unsigned long long)stats.sum_sq, stats.min, stats.max, sum, sum_sq, min,
+			max);
+		failures++;
+	}
+
+	return failures;
+}
+
+int main(void)
+{
+	static int16_t input[NUM];
+	int failures = 0;
+
+	srand(1);
+	failures += check_magnitudes();
+
+	for (int i = 0; i < NUM; i++) {
+		input[i] = (int16_t)(rand() % 65536 - 32768);
+	}
+	input[17] = INT16_MIN;
+	input[200] = INT16_MAX;
+
+	failures += check_stats(input, NUM);
+	failures += check_stats(input, NUM - 1);
+	failures += check_stats(&input[1], 2);
+	failures += check_stats(&input[17], 1);
+
+	/* Full negative scale throughout, the largest sum of squares */
+	for (int i = 0; i < NUM; i++) {
+		input[i] = INT16_MIN;
+	}
+	failures += check_stats(input, NUM);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zephyr/sys/util.h>
+#include "app_dsp.h"
+#include "trace.h"
+
+/* Binary traces are read in place */
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "Binary traces are little endian"
+#endif
+
+_Static_assert(sizeof(struct replay_trace_header) == 64, "Trace format changed");
+
+/* Samples of a binary trace converted per magnitude kernel call */
+#define REPLAY_READ_CHUNK 64
+
+/* Standard gravity in m/s^2 */
+#define STANDARD_GRAVITY 9.80665f
+
+static int input_append(struct replay_input *input, float magnitude)
+{
+	if (input->num == input->size) {
+		size_t size = input->size ? input->size * 2 : 4096;
+		float *magnitudes = realloc(input->magnitudes, size * sizeof(float));
+
+		if (magnitudes == NULL) {
+			return -ENOMEM;
+		}
+
+		input->magnitudes = magnitudes;
+		input->size = size;
+	}
+
+	input->magnitudes[input->num++] = magnitude;
+	return 0;
+}
+
+int replay_read_csv(FILE *file, float accel_range_g, struct replay_input *input)
+{
+	/* Accel X column and scale to milli-g, counts once the stream header is seen */
+	int skip = 0;
+	float scale = 1000.0f / STANDARD_GRAVITY;
+	char line[256];
+
+	while (fgets(line, sizeof(line), file)) {
+		float xyz[3];
+		float magnitude;
+		char *p = line;
+		char *end;
+		int ret;
+
+		if (strncmp(line, "seq,", 4) == 0) {
+			skip = 2;
+			scale = accel_range_g * 1000.0f / 32768.0f;
+			continue;
+		}
+
+		for (int i = 0; i < skip + 3; i++) {
+			float value = strtof(p, &end);
+
+			if (end == p) {
+				break;
+			}
+
+			if (i >= skip) {
+				xyz[i - skip] = value;
+			}
+
+			p = (*end == ',') ? end + 1 : end;
+			if (i == skip + 2) {
+				app_dsp_magnitude_f32(xyz, 3, 1, scale, &magnitude);
+				ret = input_append(input, magnitude);
+				if (ret) {
+					return ret;
+				}
+			}
+		}
+	}
+
+	return ferror(file) ? -EIO : 0;
+}
+
+static int trace_check(const struct replay_trace_header *hdr, size_t len,
+		       struct replay_input *input)
+{
+	uint64_t blocks;
+	bool found[3] = { false };
+
+	if (len < sizeof(*hdr) || hdr->version != REPLAY_TRACE_VERSION ||
+	    hdr->header_size < sizeof(*hdr) || hdr->channels == 0 ||
+	    hdr->channels > REPLAY_TRACE_CHANNELS_MAX || hdr->block_samples == 0 ||
+	    hdr->accel_range_g == 0) {
+		return -EINVAL;
+	}
+
+	blocks = (hdr->samples + hdr->block_samples - 1) / hdr->block_samples;
+	if (blocks > (len - hdr->header_size) /
+		     ((uint64_t)hdr->channels * hdr->block_samples * sizeof(int16_t))) {
+		return -EINVAL;
+	}
+
+	for (uint8_t i = 0; i < hdr->channels; i++) {
+		uint8_t axis = hdr->channel_map[i];
+
+		if (axis <= REPLAY_TRACE_ACCEL_Z && !found[axis]) {
+			input->accel_column[axis] = i;
+			found[axis] = true;
+		}
+	}
+
+	if (!found[0] || !found[1] || !found[2]) {
+		return -EINVAL;
+	}
+
+	input->scale = hdr->accel_range_g * 1000.0f / 32768.0f;
+	return 0;
+}
+
+int replay_open(const char *path, float accel_range_g, struct replay_input *input)
+{
+	struct stat st;
+	uint32_t magic = 0;
+	void *mapped;
+	FILE *file;
+	int fd;
+	int ret;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return -errno;
+	}
+
+	if (fstat(fd, &st) || pread(fd, &magic, sizeof(magic), 0) < 0) {
+		ret = -errno;
+		close(fd);
+		return ret;
+	}
+
+	if (magic != REPLAY_TRACE_MAGIC) {
+		file = fdopen(fd, "r");
+		if (file == NULL) {
+			ret = -errno;
+			close(fd);
+			return ret;
+		}
+
+		ret = replay_read_csv(file, accel_range_g, input);
+		fclose(file);
+		return ret;
+	}
+
+	mapped = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) {
+		return -errno;
+	}
+
+	/* Samples are read once from start to end */
+	(void)madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+
+	ret = trace_check(mapped, st.st_size, input);
+	if (ret) {
+		munmap(mapped, st.st_size);
+		return ret;
+	}
+
+	input->trace = mapped;
+	input->mapped_len = st.st_size;
+	input->num = input->trace->samples;
+	return 0;
+}
+
+size_t replay_read(const struct replay_input *input, size_t pos, float *values, size_t max)
+{
+	const struct replay_trace_header *hdr = input->trace;
+	const int16_t *columns[3];
+	const int16_t *block;
+	size_t offset;
+	size_t num;
+
+	if (pos >= input->num) {
+		return 0;
+	}
+
+	num = MIN(input->num - pos, max);
+
+	if (hdr == NULL) {
+		memcpy(values, &input->magnitudes[pos], num * sizeof(float));
+		return num;
+	}
+
+	offset = pos % hdr->block_samples;
+	num = MIN(num, hdr->block_samples - offset);
+	block = (const int16_t *)((const uint8_t *)hdr + hdr->header_size) +
+		(pos / hdr->block_samples) * hdr->channels * hdr->block_samples;
+
+	for (int axis = 0; axis < 3; axis++) {
+		columns[axis] = &block[input->accel_column[axis] * hdr->block_samples + offset];
+	}
+
+	/* Interleaved in chunks, so the magnitude kernel gets whole vectors */
+	for (size_t i = 0; i < num; i += REPLAY_READ_CHUNK) {
+		size_t chunk = MIN(num - i, REPLAY_READ_CHUNK);
+		float xyz[REPLAY_READ_CHUNK][3];
+
+		for (size_t k = 0; k < chunk; k++) {
+			xyz[k][0] = columns[0][i + k];
+			xyz[k][1] = columns[1][i + k];
+			xyz[k][2] = columns[2][i + k];
+		}
+
+		app_dsp_magnitude_f32(&xyz[0][0], 3, chunk, input->scale, &values[i]);
+	}
+
+	return num;
+}
+
+void replay_input_free(struct replay_input *input)
+{
+	if (input->trace != NULL) {
+		munmap((void *)input->trace, input->mapped_len);
+	}
+	free(input->magnitudes);
+	*input = (struct replay_input){ 0 };
+}
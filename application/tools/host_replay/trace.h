@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Recorded IMU traces of the host tools */
+
+#ifndef _HOST_TRACE_H_
+#define _HOST_TRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* "IMUT" at the start of a binary trace */
+#define REPLAY_TRACE_MAGIC	0x54554d49
+#define REPLAY_TRACE_VERSION	1
+
+/* Most columns of a binary trace */
+#define REPLAY_TRACE_CHANNELS_MAX 8
+
+/*
+ * Axis identifiers of the channel map, the same as enum
+ * sampling_stream_channel of the firmware stream
+ */
+#define REPLAY_TRACE_ACCEL_X	0
+#define REPLAY_TRACE_ACCEL_Y	1
+#define REPLAY_TRACE_ACCEL_Z	2
+
+/**
+ * Binary trace header, little endian, written by scripts/imu_trace.py.
+ *
+ * The header is followed at header_size by blocks of block_samples samples.
+ * A block holds one int16 column per channel, block_samples sensor counts of
+ * the axis channel_map[i] each, so every column is contiguous and the file
+ * is read in place once mapped. The last block is padded with zeros.
+ */
+struct replay_trace_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t header_size;
+	uint32_t frequency_hz;
+	uint16_t accel_range_g;
+	uint16_t gyro_range_dps;
+	uint8_t channels;
+	uint8_t reserved[3];
+	uint8_t channel_map[REPLAY_TRACE_CHANNELS_MAX];
+	uint32_t block_samples;
+	uint64_t samples;
+	/* Capture time of the first sample in microseconds, 0 if unknown */
+	uint32_t start_timestamp_us;
+	uint8_t padding[20];
+};
+
+/**
+ * Acceleration magnitudes of a recording in milli-g, computed up front for
+ * a CSV recording and on the fly from the mapped columns of a binary trace
+ */
+struct replay_input {
+	float *magnitudes;
+	size_t num;
+	size_t size;
+	/* Mapped binary trace, NULL for a CSV recording */
+	const struct replay_trace_header *trace;
+	size_t mapped_len;
+	/* Columns of accel X..Z and counts to milli-g, binary traces only */
+	uint8_t accel_column[3];
+	float scale;
+};
+
+/**
+ * @brief Read the acceleration magnitudes in milli-g of a CSV recording
+ *
+ * Reads the CSV printed by the sampling module (accel and gyro in m/s^2 and
+ * rad/s) or the CSV written by scripts/stream_capture.py (sequence number,
+ * timestamp, then sensor counts). Lines that do not start with a number,
+ * e.g. log output, are skipped.
+ *
+ * @param file CSV recording
+ * @param accel_range_g Accelerometer range for recordings in sensor counts
+ * @param input Magnitudes read, appended to the ones already in it
+ * @return 0 on success, negative error code on failure
+ */
+int replay_read_csv(FILE *file, float accel_range_g, struct replay_input *input);
+
+/**
+ * @brief Open a recording, a binary trace or a CSV recording
+ *
+ * Binary traces are recognized by their magic and mapped, nothing is read
+ * until the magnitudes are. Anything else is read with replay_read_csv().
+ *
+ * @param path Recording
+ * @param accel_range_g Accelerometer range for CSV recordings in sensor counts,
+ *			binary traces carry their own
+ * @param input Recording opened, empty before the call
+ * @return 0 on success, negative error code on failure
+ */
+int replay_open(const char *path, float accel_range_g, struct replay_input *input);
+
+/**
+ * @brief Get the acceleration magnitudes of a recording in milli-g
+ * @param input Recording
+ * @param pos Index of the first sample
+ * @param values Magnitudes of the samples from pos on
+ * @param max Most magnitudes to get
+ * @return Number of magnitudes got, less than max at the end of a trace
+ *	   block or of the recording
+ */
+size_t replay_read(const struct replay_input *input, size_t pos, float *values, size_t max);
+
+/**
+ * @brief Free the magnitudes or unmap the trace of a recording
+ * @param input Recording, empty afterwards
+ */
+void replay_input_free(struct replay_input *input);
+
+#endif /* _HOST_TRACE_H_ */